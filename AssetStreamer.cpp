@@ -0,0 +1,348 @@
+/**
+ * AssetStreamer.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "AssetStreamer.h"
+#include "ResourceManager.h"
+#include "DecodedAssetCache.h"
+
+#include "BlammoEngine/ObjReader.h"
+#include "BlammoEngine/MtlReader.h"
+
+const int AssetStreamer::DEFAULT_NUM_WORKER_THREADS = 2;
+
+AssetStreamer::StreamRequest::StreamRequest(const std::string& filepath, const AssetType& type) :
+filepath(filepath), type(type), state(Pending), isAbandoned(false), fileBuffer(NULL), fileLength(0), image(NULL), meshData(NULL) {
+}
+
+AssetStreamer::StreamRequest::~StreamRequest() {
+	delete[] this->fileBuffer;
+	this->fileBuffer = NULL;
+	delete this->image;
+	this->image = NULL;
+	delete this->meshData;
+	this->meshData = NULL;
+}
+
+AssetStreamer::AssetStreamer(int numWorkerThreads, DecodedAssetCache* assetCache) : assetCache(assetCache), requestMutex(SDL_CreateMutex()), 
+requestQueuedCond(SDL_CreateCond()), requestFinishedCond(SDL_CreateCond()), isShuttingDown(false) {
+	assert(numWorkerThreads > 0);
+	assert(this->requestMutex != NULL && this->requestQueuedCond != NULL && this->requestFinishedCond != NULL);
+
+	this->workerThreads.reserve(numWorkerThreads);
+	for (int i = 0; i < numWorkerThreads; i++) {
+		SDL_Thread* thread = SDL_CreateThread(AssetStreamer::WorkerThreadMain, this);
+		if (thread == NULL) {
+			debug_output("Failed to create asset streaming thread: " << SDL_GetError());
+			continue;
+		}
+		this->workerThreads.push_back(thread);
+	}
+}
+
+AssetStreamer::~AssetStreamer() {
+	// Let the worker threads finish whatever they're currently on and then wait for them to exit
+	SDL_mutexP(this->requestMutex);
+	this->isShuttingDown = true;
+	SDL_CondBroadcast(this->requestQueuedCond);
+	SDL_mutexV(this->requestMutex);
+
+	for (std::vector<SDL_Thread*>::iterator iter = this->workerThreads.begin(); iter != this->workerThreads.end(); ++iter) {
+		SDL_WaitThread(*iter, NULL);
+	}
+	this->workerThreads.clear();
+
+	for (RequestMapIter iter = this->requests.begin(); iter != this->requests.end(); ++iter) {
+		delete iter->second;
+		iter->second = NULL;
+	}
+	this->requests.clear();
+	this->pendingRequests.clear();
+
+	SDL_DestroyCond(this->requestFinishedCond);
+	this->requestFinishedCond = NULL;
+	SDL_DestroyCond(this->requestQueuedCond);
+	this->requestQueuedCond = NULL;
+	SDL_DestroyMutex(this->requestMutex);
+	this->requestMutex = NULL;
+}
+
+/**
+ * Start streaming in the given asset on the worker threads, this returns immediately. If the asset
+ * was already prefetched (and not yet taken) then this does nothing.
+ */
+void AssetStreamer::Prefetch(const std::string& filepath, const AssetType& type) {
+	if (this->workerThreads.empty()) {
+		return;
+	}
+
+	SDL_mutexP(this->requestMutex);
+	this->QueueRequest(filepath, type);
+	SDL_mutexV(this->requestMutex);
+}
+
+/**
+ * Throw away everything that was prefetched but never taken (e.g., assets that were already loaded
+ * by the time they were needed or a world that the player didn't end up going into). This doesn't
+ * wait on the worker threads, anything they're in the middle of is deleted once they finish it.
+ */
+void AssetStreamer::ClearPrefetched() {
+	SDL_mutexP(this->requestMutex);
+
+	for (RequestMapIter iter = this->requests.begin(); iter != this->requests.end(); ++iter) {
+		StreamRequest* request = iter->second;
+		if (request->state == InProgress) {
+			request->isAbandoned = true;
+		}
+		else {
+			delete request;
+		}
+		iter->second = NULL;
+	}
+	this->requests.clear();
+	this->pendingRequests.clear();
+
+	SDL_mutexV(this->requestMutex);
+}
+
+/**
+ * Take the bytes of a streamed file, the caller owns the returned buffer (it is null terminated
+ * just like the buffers from ResourceManager::FilepathToMemoryBuffer).
+ * Returns: The file's bytes, NULL if the file wasn't streamed.
+ */
+char* AssetStreamer::TakeFileBuffer(const std::string& filepath, long& length) {
+	StreamRequest* request = this->TakeRequest(filepath, FileAsset);
+	if (request == NULL) {
+		request = this->TakeRequest(filepath, MaterialFileAsset);
+		if (request == NULL) {
+			return NULL;
+		}
+	}
+
+	char* fileBuffer = request->fileBuffer;
+	length = request->fileLength;
+	request->fileBuffer = NULL;
+	delete request;
+
+	return fileBuffer;
+}
+
+/**
+ * Take a streamed image that has been decoded and is ready to be uploaded as a texture.
+ * Returns: The decoded image (owned by the caller), NULL if the image wasn't streamed or failed to decode.
+ */
+Texture::DecodedImage* AssetStreamer::TakeDecodedImage(const std::string& filepath) {
+	StreamRequest* request = this->TakeRequest(filepath, ImageAsset);
+	if (request == NULL) {
+		return NULL;
+	}
+
+	Texture::DecodedImage* image = request->image;
+	request->image = NULL;
+	delete request;
+
+	return image;
+}
+
+/**
+ * Take the parsed data of a streamed obj file, the mesh can then be built with ObjReader::BuildMesh.
+ * Returns: The parsed obj data (owned by the caller), NULL if the obj wasn't streamed or failed to parse.
+ */
+ObjMeshData* AssetStreamer::TakeObjMeshData(const std::string& filepath) {
+	StreamRequest* request = this->TakeRequest(filepath, ObjMeshAsset);
+	if (request == NULL) {
+		return NULL;
+	}
+
+	ObjMeshData* meshData = request->meshData;
+	request->meshData = NULL;
+	delete request;
+
+	return meshData;
+}
+
+// Queue up a new request for the worker threads - the request mutex must be held when calling this
+void AssetStreamer::QueueRequest(const std::string& filepath, const AssetType& type) {
+	if (this->requests.find(filepath) != this->requests.end()) {
+		return;
+	}
+
+	StreamRequest* request = new StreamRequest(filepath, type);
+	this->requests.insert(std::make_pair(filepath, request));
+	this->pendingRequests.push_back(request);
+	SDL_CondSignal(this->requestQueuedCond);
+}
+
+/**
+ * Remove the request for the given asset so that the caller can take its results, this waits
+ * if a worker thread is currently streaming the asset.
+ * Returns: The finished request (owned by the caller), NULL if there's nothing to take.
+ */
+AssetStreamer::StreamRequest* AssetStreamer::TakeRequest(const std::string& filepath, const AssetType& type) {
+	SDL_mutexP(this->requestMutex);
+
+	RequestMapIter findIter = this->requests.find(filepath);
+	if (findIter == this->requests.end() || findIter->second->type != type) {
+		SDL_mutexV(this->requestMutex);
+		return NULL;
+	}
+	StreamRequest* request = findIter->second;
+
+	if (request->state == Pending) {
+		// No worker thread has started on it yet, the caller will be quicker just loading it right now
+		this->pendingRequests.remove(request);
+		this->requests.erase(findIter);
+		SDL_mutexV(this->requestMutex);
+
+		delete request;
+		return NULL;
+	}
+
+	while (request->state != Finished) {
+		SDL_CondWait(this->requestFinishedCond, this->requestMutex);
+	}
+	this->requests.erase(filepath);
+
+	SDL_mutexV(this->requestMutex);
+	return request;
+}
+
+/**
+ * Does the actual streaming work for the given request, this is called on a worker thread
+ * without the request mutex held.
+ */
+void AssetStreamer::ProcessRequest(StreamRequest* request) {
+	assert(request != NULL);
+
+	request->fileBuffer = ResourceManager::ReadFileToMemoryBuffer(request->filepath, request->fileLength);
+	if (request->fileBuffer == NULL) {
+		return;
+	}
+
+	switch (request->type) {
+
+		case FileAsset:
+			break;
+
+		case MaterialFileAsset: {
+			// Stream in the textures that the materials use as well
+			std::istringstream inStream(std::string(request->fileBuffer, request->fileLength), std::ios_base::in | std::ios_base::binary);
+			std::vector<std::string> texturePaths;
+			MtlReader::ReadTextureFilepathsFromStream(inStream, texturePaths);
+
+			SDL_mutexP(this->requestMutex);
+			if (!request->isAbandoned) {
+				for (std::vector<std::string>::const_iterator iter = texturePaths.begin(); iter != texturePaths.end(); ++iter) {
+					this->QueueRequest(*iter, ImageAsset);
+				}
+			}
+			SDL_mutexV(this->requestMutex);
+			break;
+		}
+
+		case ImageAsset:
+			if (this->assetCache != NULL) {
+				request->image = this->assetCache->GetDecodedImage(request->filepath, reinterpret_cast<unsigned char*>(request->fileBuffer), 
+					request->fileLength);
+			}
+			else {
+				request->image = Texture::DecodeImageFromBuffer(reinterpret_cast<unsigned char*>(request->fileBuffer), request->fileLength);
+			}
+			delete[] request->fileBuffer;
+			request->fileBuffer = NULL;
+			break;
+
+		case ObjMeshAsset: {
+			bool success = false;
+			request->meshData = new ObjMeshData();
+			if (this->assetCache != NULL) {
+				success = this->assetCache->GetObjMeshData(request->filepath, request->fileBuffer, request->fileLength, *request->meshData);
+			}
+			else {
+				std::istringstream inStream(std::string(request->fileBuffer, request->fileLength), std::ios_base::in | std::ios_base::binary);
+				success = ObjReader::ParseMeshFromStream(request->filepath, inStream, *request->meshData);
+			}
+			delete[] request->fileBuffer;
+			request->fileBuffer = NULL;
+
+			if (!success) {
+				delete request->meshData;
+				request->meshData = NULL;
+				break;
+			}
+
+			// The mesh's material file will be needed right after the mesh is built
+			SDL_mutexP(this->requestMutex);
+			if (!request->isAbandoned) {
+				this->QueueRequest(request->meshData->mtlFilepath, MaterialFileAsset);
+			}
+			SDL_mutexV(this->requestMutex);
+			break;
+		}
+
+		default:
+			assert(false);
+			break;
+	}
+}
+
+int AssetStreamer::WorkerThreadMain(void* data) {
+	AssetStreamer* streamer = static_cast<AssetStreamer*>(data);
+	assert(streamer != NULL);
+
+	SDL_mutexP(streamer->requestMutex);
+	for (;;) {
+		while (streamer->pendingRequests.empty() && !streamer->isShuttingDown) {
+			SDL_CondWait(streamer->requestQueuedCond, streamer->requestMutex);
+		}
+		if (streamer->isShuttingDown) {
+			break;
+		}
+
+		StreamRequest* request = streamer->pendingRequests.front();
+		streamer->pendingRequests.pop_front();
+		request->state = InProgress;
+		SDL_mutexV(streamer->requestMutex);
+
+		streamer->ProcessRequest(request);
+
+		SDL_mutexP(streamer->requestMutex);
+		if (request->isAbandoned) {
+			delete request;
+		}
+		else {
+			request->state = Finished;
+			SDL_CondBroadcast(streamer->requestFinishedCond);
+		}
+	}
+	SDL_mutexV(streamer->requestMutex);
+
+	return 0;
+}
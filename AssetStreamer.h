@@ -0,0 +1,110 @@
+/**
+ * AssetStreamer.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ASSETSTREAMER_H__
+#define __ASSETSTREAMER_H__
+
+#include "BlammoEngine/BasicIncludes.h"
+#include "BlammoEngine/Texture.h"
+
+struct ObjMeshData;
+class DecodedAssetCache;
+
+/**
+ * Streams resources in on background threads ahead of when they're needed (e.g., the next world's
+ * meshes, textures and sounds while the player is still in a menu). The worker threads do all of the
+ * file reading, image decoding and obj parsing - whatever needs the graphics context (building materials,
+ * uploading textures, creating effects) is left for the thread that takes the streamed asset. When given a decoded
+ * asset cache the worker threads go through it rather than decoding images and parsing meshes themselves.
+ * All of the public functions must be called from the main/render thread.
+ */
+class AssetStreamer {
+public:
+	static const int DEFAULT_NUM_WORKER_THREADS;
+
+	enum AssetType { FileAsset, MaterialFileAsset, ImageAsset, ObjMeshAsset };
+
+	AssetStreamer(int numWorkerThreads, DecodedAssetCache* assetCache);
+	~AssetStreamer();
+
+	void Prefetch(const std::string& filepath, const AssetType& type);
+	void ClearPrefetched();
+
+	// Take ownership of a streamed asset - these wait on the asset if a worker thread is in the middle of it
+	// and return NULL when it was never prefetched (or hasn't been started yet), in which case the caller should load it itself
+	char* TakeFileBuffer(const std::string& filepath, long& length);
+	Texture::DecodedImage* TakeDecodedImage(const std::string& filepath);
+	ObjMeshData* TakeObjMeshData(const std::string& filepath);
+
+private:
+	enum RequestState { Pending, InProgress, Finished };
+
+	struct StreamRequest {
+		std::string filepath;
+		AssetType type;
+		RequestState state;
+		bool isAbandoned;    // Cleared while a worker thread was still on it, the worker thread deletes it when done
+
+		char* fileBuffer;
+		long fileLength;
+		Texture::DecodedImage* image;
+		ObjMeshData* meshData;
+
+		StreamRequest(const std::string& filepath, const AssetType& type);
+		~StreamRequest();
+
+	private:
+		DISALLOW_COPY_AND_ASSIGN(StreamRequest);
+	};
+
+	typedef std::map<std::string, StreamRequest*> RequestMap;
+	typedef RequestMap::iterator RequestMapIter;
+
+	DecodedAssetCache* assetCache;    // Not owned by this, may be NULL
+	std::vector<SDL_Thread*> workerThreads;
+	SDL_mutex* requestMutex;          // Guards everything below
+	SDL_cond* requestQueuedCond;      // Signalled when there's a new pending request (or when shutting down)
+	SDL_cond* requestFinishedCond;    // Signalled whenever a worker thread finishes a request
+
+	RequestMap requests;                          // All requests that haven't been taken yet, keyed on their filepath
+	std::list<StreamRequest*> pendingRequests;    // Requests that no worker thread has started on yet
+	bool isShuttingDown;
+
+	void QueueRequest(const std::string& filepath, const AssetType& type);
+	StreamRequest* TakeRequest(const std::string& filepath, const AssetType& type);
+	void ProcessRequest(StreamRequest* request);
+
+	static int WorkerThreadMain(void* data);
+
+	DISALLOW_COPY_AND_ASSIGN(AssetStreamer);
+};
+
+#endif // __ASSETSTREAMER_H__
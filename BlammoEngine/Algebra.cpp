@@ -32,8 +32,12 @@
 #include "Algebra.h"
 
 Randomizer* Randomizer::instance = NULL;
+Randomizer* Randomizer::presentationInstance = NULL;
+BLAMMO_THREAD_LOCAL Randomizer* Randomizer::presentationStream = NULL;
 
 Randomizer::Randomizer() : 
-randomIntGen(BlammoTime::GetSystemTimeInMillisecs()), 
-randomDoubleGen(BlammoTime::GetSystemTimeInMillisecs()) {
+randomIntGen(BlammoTime::GetSystemTimeInMillisecs()) {
+}
+
+Randomizer::Randomizer(unsigned long seed) : randomIntGen(seed) {
 }
@@ -128,32 +128,76 @@ inline float NumberFuncs::Clamp(float n, float min, float max) {
 	return n;
 }
 
+/**
+ * There are two randomizers: the main instance is used by the game simulation (the game model) and
+ * is the one that gets seeded for reproducible runs, the presentation instance is used by everything
+ * that is only seen or heard (effects, sounds, menus). Keeping them apart means the simulation's
+ * sequence of random numbers doesn't depend on what happens to be drawn or played.
+ */
 class Randomizer {
 private:
 	static Randomizer* instance;
+	static Randomizer* presentationInstance;
+	static BLAMMO_THREAD_LOCAL Randomizer* presentationStream;
 
-	MTRand_int32  randomIntGen;     // Generates random 32-bit integers
-	MTRand_closed randomDoubleGen;	// Generates random double precision floating point numbers in [0, 1]
+	MTRand_int32 randomIntGen;  // Generates random 32-bit integers, doubles are derived from these
 
 	Randomizer();
-	~Randomizer(){};
+
+	DISALLOW_COPY_AND_ASSIGN(Randomizer);
 
 public:
-	
+	// Independent random streams, e.g., one for each particle emitter, are created with their own seed
+	explicit Randomizer(unsigned long seed);
+	~Randomizer(){};
+
+	/**
+	 * While one of these is in scope the calling thread's presentation instance is the given
+	 * randomizer. This lets things that tick on other threads (e.g., particle emitters) use their
+	 * own stream of random numbers without touching the shared one.
+	 */
+	class PresentationStreamScope {
+	public:
+		PresentationStreamScope(Randomizer& stream) : prevStream(Randomizer::presentationStream) {
+			Randomizer::presentationStream = &stream;
+		}
+		~PresentationStreamScope() {
+			Randomizer::presentationStream = this->prevStream;
+		}
+	private:
+		Randomizer* prevStream;
+		DISALLOW_COPY_AND_ASSIGN(PresentationStreamScope);
+	};
+
 	static Randomizer* GetInstance() {
 		if (Randomizer::instance == NULL) {
 			Randomizer::instance = new Randomizer();
 		}
 		return Randomizer::instance;
 	}
+	static Randomizer* GetPresentationInstance() {
+		if (Randomizer::presentationStream != NULL) {
+			return Randomizer::presentationStream;
+		}
+		if (Randomizer::presentationInstance == NULL) {
+			Randomizer::presentationInstance = new Randomizer();
+		}
+		return Randomizer::presentationInstance;
+	}
 
 	static void DeleteInstance() {
 		if (Randomizer::instance != NULL) {
 			delete Randomizer::instance;
 			Randomizer::instance = NULL;
 		}
+		if (Randomizer::presentationInstance != NULL) {
+			delete Randomizer::presentationInstance;
+			Randomizer::presentationInstance = NULL;
+		}
 	}
 	
+	void SetSeed(unsigned long seed);
+
 	unsigned int RandomUnsignedInt();
 	int		 RandomNegativeOrPositive();
 	double RandomNumZeroToOne();
@@ -161,6 +205,14 @@ public:
     bool RandomTrueOrFalse();
 };
 
+/**
+ * Reseed the random number generators, after this the sequence of random numbers
+ * produced will be identical for identical seeds (e.g., for reproducible simulation runs).
+ */
+inline void Randomizer::SetSeed(unsigned long seed) {
+	this->randomIntGen.seed(seed);
+}
+
 /**
  * Get a random unsigned integer.
  * Returns: Random uint.
@@ -186,7 +238,7 @@ inline int Randomizer::RandomNegativeOrPositive() {
  * Returns: double in range [0,1].
  */
 inline double Randomizer::RandomNumZeroToOne() {
-	return this->randomDoubleGen();
+	return static_cast<double>(this->randomIntGen()) * (1.0 / 4294967295.0); // divided by 2^32 - 1
 }
 
 /**
@@ -194,7 +246,7 @@ inline double Randomizer::RandomNumZeroToOne() {
  * Returns: double in range [-1, 1]
  */
 inline double Randomizer::RandomNumNegOneToOne() {
-	double randNum = this->randomDoubleGen();
+	double randNum = this->RandomNumZeroToOne();
 	double randomSign = this->RandomNegativeOrPositive();
 	return randNum * randomSign;
 }
@@ -0,0 +1,205 @@
+/**
+ * AsyncFileWriter.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "AsyncFileWriter.h"
+
+#include <cstdio>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+AsyncFileWriter* AsyncFileWriter::instance = NULL;
+
+AsyncFileWriter::AsyncFileWriter() : thread(NULL), mutex(NULL), workCond(NULL), idleCond(NULL),
+isWriting(false), isShuttingDown(false) {
+    this->mutex    = SDL_CreateMutex();
+    this->workCond = SDL_CreateCond();
+    this->idleCond = SDL_CreateCond();
+    assert(this->mutex != NULL && this->workCond != NULL && this->idleCond != NULL);
+
+    this->thread = SDL_CreateThread(&AsyncFileWriter::WriterThreadMain, this);
+    if (this->thread == NULL) {
+        // Everything gets written on the calling thread instead
+        debug_output("Failed to create the file writer thread: " << SDL_GetError());
+    }
+}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    if (this->thread != NULL) {
+        SDL_mutexP(this->mutex);
+        this->isShuttingDown = true;
+        SDL_CondSignal(this->workCond);
+        SDL_mutexV(this->mutex);
+
+        // The writer thread finishes off everything that's queued before it exits
+        SDL_WaitThread(this->thread, NULL);
+        this->thread = NULL;
+    }
+    assert(this->pendingWrites.empty());
+
+    SDL_DestroyCond(this->idleCond);
+    this->idleCond = NULL;
+    SDL_DestroyCond(this->workCond);
+    this->workCond = NULL;
+    SDL_DestroyMutex(this->mutex);
+    this->mutex = NULL;
+}
+
+/**
+ * Queue the given data to be written to the file at the given path, replacing any data
+ * that's still waiting to be written to that file.
+ */
+void AsyncFileWriter::Write(const std::string& filepath, const std::string& data) {
+    if (this->thread == NULL) {
+        bool success = AsyncFileWriter::WriteFileAtomically(filepath, data.data(), data.size());
+        SDL_mutexP(this->mutex);
+        this->RecordWriteResult(filepath, success);
+        SDL_mutexV(this->mutex);
+        return;
+    }
+
+    SDL_mutexP(this->mutex);
+    this->pendingWrites[filepath] = data;
+    this->failedWrites.erase(filepath);
+    SDL_CondSignal(this->workCond);
+    SDL_mutexV(this->mutex);
+}
+
+/**
+ * Blocks until everything that's been queued so far has been written.
+ * Returns: true if the most recent write of every file succeeded, false if any of them failed.
+ */
+bool AsyncFileWriter::Flush() {
+    SDL_mutexP(this->mutex);
+    while (!this->pendingWrites.empty() || this->isWriting) {
+        SDL_CondWait(this->idleCond, this->mutex);
+    }
+    bool success = this->failedWrites.empty();
+    SDL_mutexV(this->mutex);
+    return success;
+}
+
+/**
+ * Find out whether the most recent write of the given file failed, the failure is forgotten once it's
+ * been taken. A write of the file that's still queued hasn't failed (yet).
+ * Returns: true if the last write of the file failed, false otherwise.
+ */
+bool AsyncFileWriter::TakeFailedWrite(const std::string& filepath) {
+    SDL_mutexP(this->mutex);
+    bool hasFailed = (this->failedWrites.erase(filepath) > 0);
+    SDL_mutexV(this->mutex);
+    return hasFailed;
+}
+
+// Must be called with the mutex locked
+void AsyncFileWriter::RecordWriteResult(const std::string& filepath, bool success) {
+    if (success) {
+        this->failedWrites.erase(filepath);
+    }
+    else if (this->pendingWrites.find(filepath) == this->pendingWrites.end()) {
+        // Only remembered if there isn't already a newer write of the file on the way
+        this->failedWrites.insert(filepath);
+    }
+}
+
+/**
+ * Writes the given data to the file at the given path by writing it to a temporary file, making sure
+ * it's on disk and then renaming it over the original file.
+ * Returns: true on success, false otherwise (the original file is left untouched).
+ */
+bool AsyncFileWriter::WriteFileAtomically(const std::string& filepath, const char* data, size_t size) {
+    std::string tempFilepath = filepath + ".tmp";
+
+    FILE* file = fopen(tempFilepath.c_str(), "wb");
+    if (file == NULL) {
+        debug_output("ERROR: Could not open " << tempFilepath << " for writing");
+        return false;
+    }
+
+    bool success = (size == 0 || fwrite(data, 1, size, file) == size) && fflush(file) == 0;
+#ifdef _WIN32
+    success = success && _commit(_fileno(file)) == 0;
+#else
+    success = success && fsync(fileno(file)) == 0;
+#endif
+    success = (fclose(file) == 0) && success;
+
+    if (success) {
+#ifdef _WIN32
+        success = MoveFileExA(tempFilepath.c_str(), filepath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+        success = rename(tempFilepath.c_str(), filepath.c_str()) == 0;
+#endif
+    }
+
+    if (!success) {
+        debug_output("ERROR: Failed to write " << filepath);
+        remove(tempFilepath.c_str());
+    }
+    return success;
+}
+
+int AsyncFileWriter::WriterThreadMain(void* data) {
+    AsyncFileWriter* writer = static_cast<AsyncFileWriter*>(data);
+
+    SDL_mutexP(writer->mutex);
+    for (;;) {
+        while (writer->pendingWrites.empty() && !writer->isShuttingDown) {
+            SDL_CondWait(writer->workCond, writer->mutex);
+        }
+        if (writer->pendingWrites.empty()) {
+            // Shutting down and there's nothing left to write
+            break;
+        }
+
+        std::map<std::string, std::string>::iterator writeIter = writer->pendingWrites.begin();
+        std::string filepath = writeIter->first;
+        std::string fileData;
+        fileData.swap(writeIter->second);
+        writer->pendingWrites.erase(writeIter);
+        writer->isWriting = true;
+
+        SDL_mutexV(writer->mutex);
+        bool success = AsyncFileWriter::WriteFileAtomically(filepath, fileData.data(), fileData.size());
+        SDL_mutexP(writer->mutex);
+
+        writer->RecordWriteResult(filepath, success);
+        writer->isWriting = false;
+        if (writer->pendingWrites.empty()) {
+            SDL_CondBroadcast(writer->idleCond);
+        }
+    }
+    SDL_mutexV(writer->mutex);
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * AsyncFileWriter.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ASYNCFILEWRITER_H__
+#define __ASYNCFILEWRITER_H__
+
+#include "BasicIncludes.h"
+
+/**
+ * Writes files on a background thread so that saving (progress, leaderboards, etc.) never stalls
+ * the game. Every file is written atomically: the data goes to a temporary file next to it which is
+ * flushed to disk and then renamed over the original, so a crash or power cut part way through a
+ * write leaves the previous version of the file intact.
+ *
+ * Writes of the same file that are still waiting to be written are coalesced, only the most recent
+ * data for each file gets written. Files whose most recent write failed are remembered until they're
+ * written again (or the failure is taken with TakeFailedWrite) so callers can find out and retry.
+ */
+class AsyncFileWriter {
+public:
+    static AsyncFileWriter* GetInstance() {
+        if (AsyncFileWriter::instance == NULL) {
+            AsyncFileWriter::instance = new AsyncFileWriter();
+        }
+        return AsyncFileWriter::instance;
+    }
+    // Waits for all of the queued writes to finish before the writer is deleted
+    static void DeleteInstance() {
+        if (AsyncFileWriter::instance != NULL) {
+            delete AsyncFileWriter::instance;
+            AsyncFileWriter::instance = NULL;
+        }
+    }
+
+    void Write(const std::string& filepath, const std::string& data);
+    bool Flush();
+    bool TakeFailedWrite(const std::string& filepath);
+
+    static bool WriteFileAtomically(const std::string& filepath, const char* data, size_t size);
+
+private:
+    static AsyncFileWriter* instance;
+
+    std::map<std::string, std::string> pendingWrites; // File paths mapped to the data to write to them
+    std::set<std::string> failedWrites;               // File paths whose most recent write failed
+    SDL_Thread* thread;
+    SDL_mutex* mutex;
+    SDL_cond* workCond;     // Signalled when there's something to write or the writer is shutting down
+    SDL_cond* idleCond;     // Signalled when everything queued has been written
+    bool isWriting;         // Whether the writer thread is in the middle of a write
+    bool isShuttingDown;
+
+    AsyncFileWriter();
+    ~AsyncFileWriter();
+
+    void RecordWriteResult(const std::string& filepath, bool success);
+
+    static int WriterThreadMain(void* data);
+
+    DISALLOW_COPY_AND_ASSIGN(AsyncFileWriter);
+};
+
+#endif // __ASYNCFILEWRITER_H__
@@ -59,6 +59,13 @@
 
 #define STRINGIFY(x) # x
 
+// Storage class for variables that have a separate instance in each thread
+#ifdef _WIN32
+#define BLAMMO_THREAD_LOCAL __declspec(thread)
+#else
+#define BLAMMO_THREAD_LOCAL __thread
+#endif
+
 // STL includes
 //#ifdef _SECURE_SCL
 //#undef _SECURE_SCL
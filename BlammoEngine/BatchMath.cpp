@@ -0,0 +1,197 @@
+/**
+ * BatchMath.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "BatchMath.h"
+#include "Matrix.h"
+
+// The batch functions treat arrays of points and vectors as tightly packed floats
+static void AssertPackedLayouts() {
+    assert(sizeof(Point2D)  == 2 * sizeof(float));
+    assert(sizeof(Vector2D) == 2 * sizeof(float));
+    assert(sizeof(Point3D)  == 3 * sizeof(float));
+    assert(sizeof(Vector3D) == 3 * sizeof(float));
+}
+
+// Transforms packed xyz triples by the upper 3x4 part of the given matrix (w is 1 for points, 0 for vectors)
+static void TransformXYZ(const float* m, bool isPoint, float* xyz, size_t count) {
+    AssertPackedLayouts();
+    const float tX = isPoint ? m[12] : 0.0f;
+    const float tY = isPoint ? m[13] : 0.0f;
+    const float tZ = isPoint ? m[14] : 0.0f;
+    size_t i = 0;
+
+#ifdef BLAMMO_SIMD_SSE
+    const __m128 m0 = _mm_set1_ps(m[0]), m4 = _mm_set1_ps(m[4]), m8  = _mm_set1_ps(m[8]);
+    const __m128 m1 = _mm_set1_ps(m[1]), m5 = _mm_set1_ps(m[5]), m9  = _mm_set1_ps(m[9]);
+    const __m128 m2 = _mm_set1_ps(m[2]), m6 = _mm_set1_ps(m[6]), m10 = _mm_set1_ps(m[10]);
+    const __m128 t0 = _mm_set1_ps(tX),   t1 = _mm_set1_ps(tY),   t2  = _mm_set1_ps(tZ);
+
+    // Four triples at a time: load [x0 y0 z0 x1] [y1 z1 x2 y2] [z2 x3 y3 z3], de-interleave
+    // into xxxx, yyyy, zzzz, transform and then interleave them back again
+    for (; i + 4 <= count; i += 4) {
+        float* curr = xyz + 3*i;
+        const __m128 a = _mm_loadu_ps(curr);
+        const __m128 b = _mm_loadu_ps(curr + 4);
+        const __m128 c = _mm_loadu_ps(curr + 8);
+
+        const __m128 x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1,1,2,2)), _MM_SHUFFLE(2,0,3,0));
+        const __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0,0,1,1)), 
+            _mm_shuffle_ps(b, c, _MM_SHUFFLE(2,2,3,3)), _MM_SHUFFLE(2,0,2,0));
+        const __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1,1,2,2)), c, _MM_SHUFFLE(3,0,2,0));
+
+        const __m128 rX = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m0), _mm_mul_ps(y, m4)), _mm_mul_ps(z, m8)),  t0);
+        const __m128 rY = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m1), _mm_mul_ps(y, m5)), _mm_mul_ps(z, m9)),  t1);
+        const __m128 rZ = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m2), _mm_mul_ps(y, m6)), _mm_mul_ps(z, m10)), t2);
+
+        _mm_storeu_ps(curr, _mm_shuffle_ps(_mm_shuffle_ps(rX, rY, _MM_SHUFFLE(0,0,0,0)), 
+            _mm_shuffle_ps(rZ, rX, _MM_SHUFFLE(1,1,0,0)), _MM_SHUFFLE(2,0,2,0)));
+        _mm_storeu_ps(curr + 4, _mm_shuffle_ps(_mm_shuffle_ps(rY, rZ, _MM_SHUFFLE(1,1,1,1)), 
+            _mm_shuffle_ps(rX, rY, _MM_SHUFFLE(2,2,2,2)), _MM_SHUFFLE(2,0,2,0)));
+        _mm_storeu_ps(curr + 8, _mm_shuffle_ps(_mm_shuffle_ps(rZ, rX, _MM_SHUFFLE(3,3,2,2)), 
+            _mm_shuffle_ps(rY, rZ, _MM_SHUFFLE(3,3,3,3)), _MM_SHUFFLE(2,0,2,0)));
+    }
+#endif
+
+    // Scalar fallback (and whatever is left over from the SIMD loop)
+    for (; i < count; i++) {
+        float* curr = xyz + 3*i;
+        const float x = curr[0];
+        const float y = curr[1];
+        const float z = curr[2];
+        curr[0] = x * m[0] + y * m[4] + z * m[8]  + tX;
+        curr[1] = x * m[1] + y * m[5] + z * m[9]  + tY;
+        curr[2] = x * m[2] + y * m[6] + z * m[10] + tZ;
+    }
+}
+
+// Applies the given 2x2 linear part and translation to packed xy pairs
+static void TransformXY(float m00, float m01, float m10, float m11, float tX, float tY, float* xy, size_t count) {
+    AssertPackedLayouts();
+    size_t i = 0;
+
+#ifdef BLAMMO_SIMD_SSE
+    const __m128 a00 = _mm_set1_ps(m00), a01 = _mm_set1_ps(m01), t0 = _mm_set1_ps(tX);
+    const __m128 a10 = _mm_set1_ps(m10), a11 = _mm_set1_ps(m11), t1 = _mm_set1_ps(tY);
+
+    // Four pairs at a time: load [x0 y0 x1 y1] [x2 y2 x3 y3], de-interleave, transform, interleave
+    for (; i + 4 <= count; i += 4) {
+        float* curr = xy + 2*i;
+        const __m128 a = _mm_loadu_ps(curr);
+        const __m128 b = _mm_loadu_ps(curr + 4);
+        const __m128 x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0));
+        const __m128 y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3,1,3,1));
+
+        const __m128 rX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, a00), _mm_mul_ps(y, a01)), t0);
+        const __m128 rY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, a10), _mm_mul_ps(y, a11)), t1);
+
+        _mm_storeu_ps(curr,     _mm_unpacklo_ps(rX, rY));
+        _mm_storeu_ps(curr + 4, _mm_unpackhi_ps(rX, rY));
+    }
+#endif
+
+    for (; i < count; i++) {
+        float* curr = xy + 2*i;
+        const float x = curr[0];
+        const float y = curr[1];
+        curr[0] = x * m00 + y * m01 + tX;
+        curr[1] = x * m10 + y * m11 + tY;
+    }
+}
+
+/**
+ * Transforms each of the given points by the given matrix, in place.
+ */
+void BatchMath::TransformPoints(const Matrix4x4& m, Point3D* pts, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    TransformXYZ(m.begin(), true, reinterpret_cast<float*>(pts), count);
+}
+
+/**
+ * Transforms each of the given vectors by the given matrix (ignoring translation), in place.
+ */
+void BatchMath::TransformVectors(const Matrix4x4& m, Vector3D* vecs, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    TransformXYZ(m.begin(), false, reinterpret_cast<float*>(vecs), count);
+}
+
+/**
+ * Transforms each of the given 2D points (as points on the z = 0 plane) by the given matrix, in place.
+ */
+void BatchMath::TransformPoints(const Matrix4x4& m, Point2D* pts, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    TransformXY(m[0], m[4], m[1], m[5], m[12], m[13], reinterpret_cast<float*>(pts), count);
+}
+
+/**
+ * Transforms each of the given 2D vectors (as vectors on the z = 0 plane) by the given matrix, in place.
+ */
+void BatchMath::TransformVectors(const Matrix4x4& m, Vector2D* vecs, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    TransformXY(m[0], m[4], m[1], m[5], 0.0f, 0.0f, reinterpret_cast<float*>(vecs), count);
+}
+
+/**
+ * Rotates each of the given points counter-clockwise about the given center, in place.
+ */
+void BatchMath::RotatePoints(float angleInDegs, const Point2D& rotationCenter, Point2D* pts, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    const float angleInRads = Trig::degreesToRadians(angleInDegs);
+    const float c = cosf(angleInRads);
+    const float s = sinf(angleInRads);
+    
+    // p' = center + R(p - center) = Rp + (center - R*center)
+    const float cX = rotationCenter[0];
+    const float cY = rotationCenter[1];
+    TransformXY(c, -s, s, c, cX - (c * cX - s * cY), cY - (s * cX + c * cY), reinterpret_cast<float*>(pts), count);
+}
+
+/**
+ * Rotates each of the given vectors counter-clockwise, in place.
+ */
+void BatchMath::RotateVectors(float angleInDegs, Vector2D* vecs, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    const float angleInRads = Trig::degreesToRadians(angleInDegs);
+    const float c = cosf(angleInRads);
+    const float s = sinf(angleInRads);
+    TransformXY(c, -s, s, c, 0.0f, 0.0f, reinterpret_cast<float*>(vecs), count);
+}
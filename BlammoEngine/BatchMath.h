@@ -0,0 +1,113 @@
+/**
+ * BatchMath.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BATCHMATH_H__
+#define __BATCHMATH_H__
+
+#include "BasicIncludes.h"
+
+// SSE is used for the batch kernels whenever the target has it, define BLAMMO_NO_SIMD
+// to force the portable scalar versions instead
+#if !defined(BLAMMO_NO_SIMD) && (defined(_M_IX86) || defined(_M_X64) || defined(__SSE__))
+#define BLAMMO_SIMD_SSE
+#include <xmmintrin.h>
+#endif
+
+class Matrix4x4;
+class Point2D;
+class Point3D;
+class Vector2D;
+class Vector3D;
+
+/**
+ * BatchMath.h
+ * Batched versions of the common Matrix4x4, Point and Vector operations for transforming
+ * whole arrays at once. Matrices are the column-major arrays of 16 floats used by Matrix4x4
+ * (and OpenGL). Every function gives the same results as applying the matching Matrix4x4
+ * operator to each element in turn.
+ */
+namespace BatchMath {
+
+    bool IsSIMDEnabled();
+
+    // result = a * b, the result must not overlap either of the operands
+    void MultiplyMatrix4x4(const float* a, const float* b, float* result);
+    void MultiplyMatrix4x4Scalar(const float* a, const float* b, float* result);
+
+    void TransformPoints(const Matrix4x4& m, Point3D* pts, size_t count);
+    void TransformVectors(const Matrix4x4& m, Vector3D* vecs, size_t count);
+    void TransformPoints(const Matrix4x4& m, Point2D* pts, size_t count);
+    void TransformVectors(const Matrix4x4& m, Vector2D* vecs, size_t count);
+
+    void RotatePoints(float angleInDegs, const Point2D& rotationCenter, Point2D* pts, size_t count);
+    void RotateVectors(float angleInDegs, Vector2D* vecs, size_t count);
+};
+
+inline bool BatchMath::IsSIMDEnabled() {
+#ifdef BLAMMO_SIMD_SSE
+    return true;
+#else
+    return false;
+#endif
+}
+
+inline void BatchMath::MultiplyMatrix4x4Scalar(const float* a, const float* b, float* result) {
+    assert(result != a && result != b);
+    for (int j = 0; j < 4; j++) {
+        const float* bCol = b + 4*j;
+        for (int i = 0; i < 4; i++) {
+            result[i + 4*j] = a[i] * bCol[0] + a[i + 4] * bCol[1] + a[i + 8] * bCol[2] + a[i + 12] * bCol[3];
+        }
+    }
+}
+
+inline void BatchMath::MultiplyMatrix4x4(const float* a, const float* b, float* result) {
+#ifdef BLAMMO_SIMD_SSE
+    assert(result != a && result != b);
+    // Each column of the result is a linear combination of the columns of a
+    const __m128 aCol0 = _mm_loadu_ps(a);
+    const __m128 aCol1 = _mm_loadu_ps(a + 4);
+    const __m128 aCol2 = _mm_loadu_ps(a + 8);
+    const __m128 aCol3 = _mm_loadu_ps(a + 12);
+    for (int j = 0; j < 4; j++) {
+        const float* bCol = b + 4*j;
+        __m128 col = _mm_mul_ps(aCol0, _mm_set1_ps(bCol[0]));
+        col = _mm_add_ps(col, _mm_mul_ps(aCol1, _mm_set1_ps(bCol[1])));
+        col = _mm_add_ps(col, _mm_mul_ps(aCol2, _mm_set1_ps(bCol[2])));
+        col = _mm_add_ps(col, _mm_mul_ps(aCol3, _mm_set1_ps(bCol[3])));
+        _mm_storeu_ps(result + 4*j, col);
+    }
+#else
+    MultiplyMatrix4x4Scalar(a, b, result);
+#endif
+}
+
+#endif // __BATCHMATH_H__
@@ -31,6 +31,10 @@
 
 #include "BlammoTime.h"
 
+#ifndef WIN32
+#include <time.h>
+#endif
+
 #ifdef WIN32
 typedef BOOL (APIENTRY *PFNWGLSWAPINTERVALFARPROC)( int );
 PFNWGLSWAPINTERVALFARPROC wglSwapIntervalEXT = 0;
@@ -56,4 +60,29 @@ void BlammoTime::SetVSync(bool vSyncOn) {
 #endif
 		// TODO: other ways of setting VSync...
 	}
-}
\ No newline at end of file
+}
+
+/**
+ * Platform independent method of obtaining a monotonic, high resolution (sub-millisecond)
+ * time stamp in seconds. Only differences between two of these values are meaningful, this
+ * is meant for timing/profiling and should never be used to drive the game simulation.
+ */
+double BlammoTime::GetHighResolutionTimeInSecs() {
+#ifdef WIN32
+	static LARGE_INTEGER frequency;
+	static bool frequencyQueried = false;
+	if (!frequencyQueried) {
+		QueryPerformanceFrequency(&frequency);
+		frequencyQueried = true;
+	}
+
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+	return static_cast<double>(counter.QuadPart) / static_cast<double>(frequency.QuadPart);
+#else
+	// Unlike the wall clock this never jumps when the system time gets changed
+	struct timespec currTime;
+	clock_gettime(CLOCK_MONOTONIC, &currTime);
+	return static_cast<double>(currTime.tv_sec) + static_cast<double>(currTime.tv_nsec) / 1000000000.0;
+#endif
+}
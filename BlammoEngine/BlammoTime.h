@@ -52,6 +52,8 @@ public:
 		return SDL_GetTicks();
 	}
 
+	static double GetHighResolutionTimeInSecs();
+
 	/**
 	 * Platform independent sleep function for the current thread.
 	 */
@@ -32,6 +32,7 @@
 #include "CgFxEffect.h"
 #include "Camera.h"
 #include "Matrix.h"
+#include "StaticGeometryBatch.h"
 
 #include "../ResourceManager.h"
 
@@ -49,6 +50,21 @@ CgFxEffectBase::~CgFxEffectBase() {
     UNUSED_VARIABLE(success);
 }
 
+/**
+ * Draw each of the given geometry batches in the given pass, batches may be NULL or empty
+ * in which case they're skipped.
+ */
+void CgFxEffectBase::DrawPass(CGpass pass, const std::vector<StaticGeometryBatch*>& batches) {
+	cgSetPassState(pass);
+	for (std::vector<StaticGeometryBatch*>::const_iterator iter = batches.begin(); iter != batches.end(); ++iter) {
+		const StaticGeometryBatch* batch = *iter;
+		if (batch != NULL) {
+			batch->Draw();
+		}
+	}
+	cgResetPassState(pass);
+}
+
 const char* MaterialProperties::MATERIAL_CELBASIC_TYPE  = "outlinedcel";
 const char* MaterialProperties::MATERIAL_PHONG_TYPE     = "phong";
 const char* MaterialProperties::MATERIAL_INKBLOCK_TYPE	= "inkblock";
@@ -140,27 +156,8 @@ void CgFxMaterialEffect::LoadParameters() {
  * Private helper function for setting up the parameters for the effect.
  */
 void CgFxMaterialEffect::SetupBeforePasses(const Camera& camera) {
-	// Transforms
-	cgGLSetStateMatrixParameter(this->wvpMatrixParam, CG_GL_MODELVIEW_PROJECTION_MATRIX, CG_GL_MATRIX_IDENTITY);
-
-	// Obtain the current model view and inverse view transforms
-	float tempMVXfVals[16];
-	glGetFloatv(GL_MODELVIEW_MATRIX, tempMVXfVals);
-
-	const Matrix4x4& invViewXf = camera.GetInvViewTransform();
-    cgGLSetMatrixParameterfc(this->viewInvMatrixParam, invViewXf.begin());
-
-	// Make sure that JUST the world transform is set
-	glPushMatrix();
-	glLoadIdentity();
-	glMultMatrixf(invViewXf.begin());
-	glMultMatrixf(tempMVXfVals);
+	this->SetupTransforms(camera);
 
-	// Set the world transform parameters
-	cgGLSetStateMatrixParameter(this->worldITMatrixParam, CG_GL_MODELVIEW_MATRIX, CG_GL_MATRIX_INVERSE_TRANSPOSE);
-	cgGLSetStateMatrixParameter(this->worldMatrixParam, CG_GL_MODELVIEW_MATRIX, CG_GL_MATRIX_IDENTITY);
-	glPopMatrix();
-    
 	// Textures
 	if (this->properties->diffuseTexture != NULL) {
 		cgGLSetTextureParameter(this->texSamplerParam, this->properties->diffuseTexture->GetTextureID());
@@ -204,4 +201,31 @@ void CgFxMaterialEffect::SetupBeforePasses(const Camera& camera) {
 	}
 
 	debug_cg_state();
+}
+
+/**
+ * Private helper function for setting up just the transform parameters of the effect
+ * from the current modelview.
+ */
+void CgFxMaterialEffect::SetupTransforms(const Camera& camera) {
+	// Transforms
+	cgGLSetStateMatrixParameter(this->wvpMatrixParam, CG_GL_MODELVIEW_PROJECTION_MATRIX, CG_GL_MATRIX_IDENTITY);
+
+	// Obtain the current model view and inverse view transforms
+	float tempMVXfVals[16];
+	glGetFloatv(GL_MODELVIEW_MATRIX, tempMVXfVals);
+
+	const Matrix4x4& invViewXf = camera.GetInvViewTransform();
+    cgGLSetMatrixParameterfc(this->viewInvMatrixParam, invViewXf.begin());
+
+	// Make sure that JUST the world transform is set
+	glPushMatrix();
+	glLoadIdentity();
+	glMultMatrixf(invViewXf.begin());
+	glMultMatrixf(tempMVXfVals);
+
+	// Set the world transform parameters
+	cgGLSetStateMatrixParameter(this->worldITMatrixParam, CG_GL_MODELVIEW_MATRIX, CG_GL_MATRIX_INVERSE_TRANSPOSE);
+	cgGLSetStateMatrixParameter(this->worldMatrixParam, CG_GL_MODELVIEW_MATRIX, CG_GL_MATRIX_IDENTITY);
+	glPopMatrix();
 }
\ No newline at end of file
@@ -45,6 +45,7 @@
 
 class PolygonGroup;
 class FBObj;
+class StaticGeometryBatch;
 
 /**
  * Holds all of the possible material properties in every type of material,
@@ -182,6 +183,16 @@ public:
 			currPass = cgGetNextPass(currPass);
 		}
 	}
+	void Draw(const Camera& camera, const std::vector<StaticGeometryBatch*>& batches) {
+		this->SetupBeforePasses(camera);
+
+		// Draw each pass of this effect
+		CGpass currPass = cgGetFirstPass(this->currTechnique);
+		while (currPass) {
+			CgFxEffectBase::DrawPass(currPass, batches);
+			currPass = cgGetNextPass(currPass);
+		}
+	}
     //void Draw(const Camera& camera, boost::function<void()> drawFunc) {
     //    this->SetupBeforePasses(camera);
 
@@ -221,6 +232,20 @@ public:
 			this->currTechnique = temp;
 		}
 	}
+
+	/**
+	 * Hooks used by the RenderCommandQueue to draw a whole run of commands that share this
+	 * effect with a single setup: BeginQueuedDraws is called once for the run and then
+	 * UpdateQueuedDrawTransforms is called whenever the modelview changes between commands.
+	 */
+	void BeginQueuedDraws(const Camera& camera) {
+		this->SetupBeforePasses(camera);
+	}
+	virtual void UpdateQueuedDrawTransforms(const Camera& camera) {
+		// By default just redo the full setup, subclasses can do better
+		this->SetupBeforePasses(camera);
+	}
+
 protected:
 	// The Cg Effect pointer
 	CGeffect cgEffect;
@@ -254,6 +279,7 @@ private:
 		glCallLists(displayListIDs.size(), GL_UNSIGNED_INT, &displayListIDs[0]);
 		cgResetPassState(pass);
 	}
+	static void DrawPass(CGpass pass, const std::vector<StaticGeometryBatch*>& batches);
     //static void DrawPassWithFunction(CGpass pass, boost::function<void()> drawFunc) {
     //    cgSetPassState(pass);
     //    drawFunc();
@@ -325,8 +351,13 @@ public:
 		this->ballLight = ballLight;
 	}
 
+	void UpdateQueuedDrawTransforms(const Camera& camera) {
+		this->SetupTransforms(camera);
+	}
+
 protected:
 	virtual void SetupBeforePasses(const Camera& camera);
+	void SetupTransforms(const Camera& camera);
 
 	// Cg Parameters shared by all effects
 	// Transforms
@@ -567,10 +567,10 @@ namespace Collision {
 	}
 
 	/**
-	 * Check for collision between a 2D ray and AABB, calculate the ray parameter for distance
-	 * multiplier from its origin.
+	 * Check for collision between a 2D ray and AABB, calculate the ray parameters (distance
+	 * multipliers from its origin) where the ray enters and exits the AABB.
 	 */
-	inline bool IsCollision(const Ray2D& ray, const AABB2D& aabb, float& tMin) {
+	inline bool IsCollision(const Ray2D& ray, const AABB2D& aabb, float& tMin, float& tMax) {
 		const Point2D& RAY_ORIGIN = ray.GetOrigin();
 		const Vector2D& RAY_DIR   = ray.GetUnitDirection();
 		
@@ -578,7 +578,7 @@ namespace Collision {
 		const Point2D& AABB_MAX	 = aabb.GetMax();
 
 		tMin = 0.0f;
-		float tMax = FLT_MAX;
+		tMax = FLT_MAX;
 
 		for (int i = 0; i < 2; i++) {
 
@@ -606,6 +606,15 @@ namespace Collision {
 		return true;
 	}
 
+	/**
+	 * Check for collision between a 2D ray and AABB, calculate the ray parameter for distance
+	 * multiplier from its origin.
+	 */
+	inline bool IsCollision(const Ray2D& ray, const AABB2D& aabb, float& tMin) {
+		float tMax;
+		return IsCollision(ray, aabb, tMin, tMax);
+	}
+
 	inline bool GetCollisionPoint(const Collision::AABB2D& aabb, const Collision::LineSeg2D& l, Point2D& collisionPt) {
 		Vector2D lineVec = l.P2() - l.P1();
 		float lineLength = Vector2D::Magnitude(lineVec);
@@ -0,0 +1,374 @@
+/**
+ * FrameProfiler.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "FrameProfiler.h"
+#include "BlammoTime.h"
+
+// Weight given to the newest frame in the running averages shown on the overlay
+static const double AVERAGE_SMOOTHING = 0.05;
+// Number of frames that a maximum is held for before it's reset
+static const int MAX_TIME_WINDOW_IN_FRAMES = 120;
+
+// The buffer of the calling thread, buffers are created the first time a thread runs a scope
+static BLAMMO_THREAD_LOCAL FrameProfiler::ThreadBuffer* threadBuffer = NULL;
+
+// All thread buffers that have been created and the ones whose threads have exited (these are
+// handed to the next new thread), the mutex guards both
+static std::vector<FrameProfiler::ThreadBuffer*> threadBuffers;
+static std::vector<FrameProfiler::ThreadBuffer*> freeThreadBuffers;
+static SDL_mutex* threadBuffersMutex = NULL;
+
+// Exported times are relative to when the profiler was first enabled
+static double epochTimeInSecs = 0.0;
+
+// Running statistics for every scope seen so far, keyed on the scope name, depth and thread
+struct ScopeKey {
+    const char* name;
+    int depth;
+    int threadIdx;
+
+    bool operator<(const ScopeKey& other) const {
+        if (this->threadIdx != other.threadIdx) { return this->threadIdx < other.threadIdx; }
+        if (this->depth != other.depth) { return this->depth < other.depth; }
+        return this->name < other.name;
+    }
+};
+typedef std::map<ScopeKey, FrameProfiler::FrameEntry> ScopeEntryMap;
+static ScopeEntryMap scopeEntries;
+static int framesSinceMaxReset = 0;
+
+bool FrameProfiler::isEnabled = false;
+double FrameProfiler::lastFrameEndTimeInSecs = 0.0;
+double FrameProfiler::lastFrameTimeInSecs = 0.0;
+
+static void MemoryFence() {
+#ifdef _WIN32
+    MemoryBarrier();
+#else
+    __sync_synchronize();
+#endif
+}
+
+// Copies the list of thread buffers so that it can be walked while other threads register theirs
+static void CopyThreadBuffers(std::vector<FrameProfiler::ThreadBuffer*>& buffers) {
+    buffers.clear();
+    if (threadBuffersMutex == NULL) {
+        // The profiler has never been enabled, so no buffers exist
+        return;
+    }
+    SDL_mutexP(threadBuffersMutex);
+    buffers = threadBuffers;
+    SDL_mutexV(threadBuffersMutex);
+}
+
+static bool CompareFrameEntries(const FrameProfiler::FrameEntry& a, const FrameProfiler::FrameEntry& b) {
+    if (a.threadIdx != b.threadIdx) {
+        return a.threadIdx < b.threadIdx;
+    }
+    return a.firstStartTimeInSecs < b.firstStartTimeInSecs;
+}
+
+FrameProfiler::ThreadBuffer::ThreadBuffer(int threadIdx) : currDepth(0), readIdx(0),
+events(new ScopeEvent[CAPACITY]), writeIdx(0), threadIdx(threadIdx) {
+}
+
+FrameProfiler::ThreadBuffer::~ThreadBuffer() {
+    delete[] this->events;
+    this->events = NULL;
+}
+
+void FrameProfiler::ThreadBuffer::Push(const ScopeEvent& event) {
+    size_t currWriteIdx = this->writeIdx;
+    this->events[currWriteIdx & (CAPACITY - 1)] = event;
+    // The event must be fully written before the main thread can see it
+    MemoryFence();
+    this->writeIdx = currWriteIdx + 1;
+}
+
+void FrameProfiler::SetEnabled(bool enabled) {
+    if (enabled == FrameProfiler::isEnabled) {
+        return;
+    }
+    if (enabled) {
+        if (threadBuffersMutex == NULL) {
+            threadBuffersMutex = SDL_CreateMutex();
+            epochTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs();
+        }
+        // Skip anything recorded before the profiler was last disabled
+        for (size_t i = 0; i < threadBuffers.size(); i++) {
+            threadBuffers[i]->readIdx = threadBuffers[i]->GetWriteIndex();
+        }
+        scopeEntries.clear();
+        framesSinceMaxReset = 0;
+        FrameProfiler::lastFrameEndTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs();
+        FrameProfiler::lastFrameTimeInSecs = 0.0;
+    }
+    FrameProfiler::isEnabled = enabled;
+}
+
+FrameProfiler::ThreadBuffer* FrameProfiler::GetThreadBuffer() {
+    if (threadBuffer == NULL) {
+        assert(threadBuffersMutex != NULL);
+        SDL_mutexP(threadBuffersMutex);
+        if (freeThreadBuffers.empty()) {
+            threadBuffer = new ThreadBuffer(static_cast<int>(threadBuffers.size()));
+            threadBuffers.push_back(threadBuffer);
+        }
+        else {
+            threadBuffer = freeThreadBuffers.back();
+            freeThreadBuffers.pop_back();
+            threadBuffer->currDepth = 0;
+        }
+        SDL_mutexV(threadBuffersMutex);
+    }
+    return threadBuffer;
+}
+
+/**
+ * Hands the calling thread's buffer (if it has one) back so that the next new thread can use it
+ * instead of allocating another. Threads that can run profiled scopes must call this right
+ * before they exit, the events already in the buffer are kept for exporting.
+ */
+void FrameProfiler::ReleaseThreadBuffer() {
+    if (threadBuffer == NULL) {
+        return;
+    }
+    assert(threadBuffer->currDepth == 0);
+    assert(threadBuffersMutex != NULL);
+    SDL_mutexP(threadBuffersMutex);
+    freeThreadBuffers.push_back(threadBuffer);
+    SDL_mutexV(threadBuffersMutex);
+    threadBuffer = NULL;
+}
+
+/**
+ * Gathers up all the scopes that were exited since the last call into the per-frame entries.
+ * This must be called from the main thread.
+ */
+void FrameProfiler::EndFrame() {
+    if (!FrameProfiler::isEnabled) {
+        return;
+    }
+
+    double currTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs();
+    FrameProfiler::lastFrameTimeInSecs = currTimeInSecs - FrameProfiler::lastFrameEndTimeInSecs;
+    FrameProfiler::lastFrameEndTimeInSecs = currTimeInSecs;
+
+    framesSinceMaxReset++;
+    bool resetMax = (framesSinceMaxReset >= MAX_TIME_WINDOW_IN_FRAMES);
+    if (resetMax) {
+        framesSinceMaxReset = 0;
+    }
+
+    for (ScopeEntryMap::iterator iter = scopeEntries.begin(); iter != scopeEntries.end(); ++iter) {
+        FrameEntry& entry = iter->second;
+        entry.numCalls = 0;
+        entry.frameTimeInSecs = 0.0;
+    }
+
+    std::vector<ThreadBuffer*> buffers;
+    CopyThreadBuffers(buffers);
+
+    for (size_t i = 0; i < buffers.size(); i++) {
+        ThreadBuffer* buffer = buffers[i];
+        size_t endIdx = buffer->GetWriteIndex();
+        MemoryFence();
+
+        // If the owning thread lapped us then the oldest events are already gone
+        if (endIdx - buffer->readIdx > ThreadBuffer::CAPACITY) {
+            buffer->readIdx = endIdx - ThreadBuffer::CAPACITY;
+        }
+
+        for (; buffer->readIdx != endIdx; buffer->readIdx++) {
+            const ScopeEvent& event = buffer->GetEvent(buffer->readIdx);
+
+            ScopeKey key;
+            key.name = event.name;
+            key.depth = event.depth;
+            key.threadIdx = buffer->GetThreadIndex();
+
+            ScopeEntryMap::iterator findIter = scopeEntries.find(key);
+            if (findIter == scopeEntries.end()) {
+                FrameEntry newEntry;
+                newEntry.name = event.name;
+                newEntry.depth = event.depth;
+                newEntry.threadIdx = key.threadIdx;
+                newEntry.numCalls = 0;
+                newEntry.frameTimeInSecs = 0.0;
+                newEntry.avgTimeInSecs = -1.0;
+                newEntry.maxTimeInSecs = 0.0;
+                newEntry.firstStartTimeInSecs = event.startTimeInSecs;
+                findIter = scopeEntries.insert(std::make_pair(key, newEntry)).first;
+            }
+
+            FrameEntry& entry = findIter->second;
+            if (entry.numCalls == 0) {
+                entry.firstStartTimeInSecs = event.startTimeInSecs;
+            }
+            entry.numCalls++;
+            entry.frameTimeInSecs += event.durationInSecs;
+        }
+    }
+
+    for (ScopeEntryMap::iterator iter = scopeEntries.begin(); iter != scopeEntries.end(); ++iter) {
+        FrameEntry& entry = iter->second;
+        if (entry.avgTimeInSecs < 0.0) {
+            entry.avgTimeInSecs = entry.frameTimeInSecs;
+        }
+        else {
+            entry.avgTimeInSecs += AVERAGE_SMOOTHING * (entry.frameTimeInSecs - entry.avgTimeInSecs);
+        }
+        if (resetMax) {
+            entry.maxTimeInSecs = entry.frameTimeInSecs;
+        }
+        else {
+            entry.maxTimeInSecs = std::max<double>(entry.maxTimeInSecs, entry.frameTimeInSecs);
+        }
+    }
+}
+
+/**
+ * Fills the given vector with the scopes that ran in the last frame, in the order they were
+ * started on each thread - so a scope is always followed by the scopes nested in it.
+ */
+void FrameProfiler::GetFrameEntries(std::vector<FrameEntry>& entries) {
+    entries.clear();
+    for (ScopeEntryMap::const_iterator iter = scopeEntries.begin(); iter != scopeEntries.end(); ++iter) {
+        if (iter->second.numCalls > 0) {
+            entries.push_back(iter->second);
+        }
+    }
+    std::stable_sort(entries.begin(), entries.end(), CompareFrameEntries);
+}
+
+/**
+ * Writes every event still held in the thread buffers in the Chrome trace-event format,
+ * this can be loaded by chrome://tracing.
+ */
+void FrameProfiler::WriteChromeTrace(std::ostream& out) {
+    std::streamsize oldPrecision = out.precision(3);
+    out.setf(std::ios::fixed, std::ios::floatfield);
+
+    std::vector<ThreadBuffer*> buffers;
+    CopyThreadBuffers(buffers);
+
+    out << "{\"traceEvents\":[" << std::endl;
+    bool isFirst = true;
+    for (size_t i = 0; i < buffers.size(); i++) {
+        const ThreadBuffer* buffer = buffers[i];
+        size_t endIdx = buffer->GetWriteIndex();
+        size_t startIdx = (endIdx > ThreadBuffer::CAPACITY) ? endIdx - ThreadBuffer::CAPACITY : 0;
+
+        for (size_t j = startIdx; j != endIdx; j++) {
+            const ScopeEvent& event = buffer->GetEvent(j);
+            if (!isFirst) {
+                out << "," << std::endl;
+            }
+            isFirst = false;
+            // Trace timestamps are in microseconds
+            out << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"ts\":" << (event.startTimeInSecs - epochTimeInSecs) * 1000000.0
+                << ",\"dur\":" << event.durationInSecs * 1000000.0 << ",\"pid\":0,\"tid\":"
+                << buffer->GetThreadIndex() << "}";
+        }
+    }
+    out << std::endl << "]}" << std::endl;
+
+    out.unsetf(std::ios::floatfield);
+    out.precision(oldPrecision);
+}
+
+/**
+ * Writes every event still held in the thread buffers as comma separated values, one per line.
+ */
+void FrameProfiler::WriteCSV(std::ostream& out) {
+    std::streamsize oldPrecision = out.precision(6);
+    out.setf(std::ios::fixed, std::ios::floatfield);
+
+    std::vector<ThreadBuffer*> buffers;
+    CopyThreadBuffers(buffers);
+
+    out << "thread,depth,name,start_ms,duration_ms" << std::endl;
+    for (size_t i = 0; i < buffers.size(); i++) {
+        const ThreadBuffer* buffer = buffers[i];
+        size_t endIdx = buffer->GetWriteIndex();
+        size_t startIdx = (endIdx > ThreadBuffer::CAPACITY) ? endIdx - ThreadBuffer::CAPACITY : 0;
+
+        for (size_t j = startIdx; j != endIdx; j++) {
+            const ScopeEvent& event = buffer->GetEvent(j);
+            out << buffer->GetThreadIndex() << "," << event.depth << "," << event.name << ","
+                << (event.startTimeInSecs - epochTimeInSecs) * 1000.0 << "," << event.durationInSecs * 1000.0 << std::endl;
+        }
+    }
+
+    out.unsetf(std::ios::floatfield);
+    out.precision(oldPrecision);
+}
+
+/**
+ * Writes the recorded events to the given file, a path ending in ".csv" gets CSV and anything
+ * else gets a Chrome trace.
+ */
+bool FrameProfiler::WriteToFile(const std::string& filepath) {
+    std::ofstream outFile(filepath.c_str());
+    if (!outFile.is_open()) {
+        debug_output("Failed to open profile output file: " << filepath);
+        return false;
+    }
+
+    static const std::string CSV_EXTENSION(".csv");
+    if (filepath.size() >= CSV_EXTENSION.size() &&
+        filepath.compare(filepath.size() - CSV_EXTENSION.size(), CSV_EXTENSION.size(), CSV_EXTENSION) == 0) {
+        FrameProfiler::WriteCSV(outFile);
+    }
+    else {
+        FrameProfiler::WriteChromeTrace(outFile);
+    }
+
+    outFile.close();
+    return true;
+}
+
+void ProfileScope::Begin(const char* name) {
+    this->buffer = FrameProfiler::GetThreadBuffer();
+    this->name = name;
+    this->buffer->currDepth++;
+    this->startTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs();
+}
+
+void ProfileScope::End() {
+    FrameProfiler::ScopeEvent event;
+    event.name = this->name;
+    event.startTimeInSecs = this->startTimeInSecs;
+    event.durationInSecs  = BlammoTime::GetHighResolutionTimeInSecs() - this->startTimeInSecs;
+    this->buffer->currDepth--;
+    event.depth = this->buffer->currDepth;
+    this->buffer->Push(event);
+}
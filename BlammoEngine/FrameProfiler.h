@@ -0,0 +1,154 @@
+/**
+ * FrameProfiler.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __FRAMEPROFILER_H__
+#define __FRAMEPROFILER_H__
+
+#include "BasicIncludes.h"
+
+/**
+ * Hierarchical, scoped timers for finding out where the time in a frame goes. Code is instrumented
+ * with PROFILE_SCOPE("Name") (the name must be a string literal), each scope that is exited is
+ * recorded to a ring buffer that belongs to the thread that ran it, so recording never takes a lock.
+ *
+ * The main thread calls EndFrame once per frame to gather up the last frame's scopes for the
+ * on-screen overlay (see GetFrameEntries); everything still held in the ring buffers can be written
+ * out as Chrome trace-event JSON (chrome://tracing) or CSV for offline analysis.
+ *
+ * While the profiler is disabled a scope costs a single flag check, defining BLAMMO_DISABLE_PROFILER
+ * removes the scopes entirely.
+ */
+class FrameProfiler {
+public:
+    // A single exited scope
+    struct ScopeEvent {
+        const char* name;
+        double startTimeInSecs;
+        double durationInSecs;
+        int depth;
+    };
+
+    // Per-thread ring buffer of scope events, only the owning thread ever writes to it
+    class ThreadBuffer {
+    public:
+        static const size_t CAPACITY = 65536;  // Must be a power of two
+
+        ThreadBuffer(int threadIdx);
+        ~ThreadBuffer();
+
+        void Push(const ScopeEvent& event);
+
+        int GetThreadIndex() const { return this->threadIdx; }
+        size_t GetWriteIndex() const { return this->writeIdx; }
+        const ScopeEvent& GetEvent(size_t idx) const { return this->events[idx & (CAPACITY - 1)]; }
+
+        int currDepth;      // Depth of the next scope opened on the owning thread
+        size_t readIdx;     // Next event to gather in EndFrame, only used by the main thread
+
+    private:
+        ScopeEvent* events;
+        volatile size_t writeIdx;
+        int threadIdx;
+
+        DISALLOW_COPY_AND_ASSIGN(ThreadBuffer);
+    };
+
+    // Time spent in a scope over the last frame, along with a running average
+    struct FrameEntry {
+        const char* name;
+        int depth;
+        int threadIdx;
+        int numCalls;
+        double frameTimeInSecs;
+        double avgTimeInSecs;
+        double maxTimeInSecs;
+        double firstStartTimeInSecs;
+    };
+
+    static bool IsEnabled() { return FrameProfiler::isEnabled; }
+    static void SetEnabled(bool enabled);
+
+    static void EndFrame();
+    static double GetLastFrameTimeInSecs() { return FrameProfiler::lastFrameTimeInSecs; }
+    static void GetFrameEntries(std::vector<FrameEntry>& entries);
+
+    static void WriteChromeTrace(std::ostream& out);
+    static void WriteCSV(std::ostream& out);
+    static bool WriteToFile(const std::string& filepath);
+
+    static ThreadBuffer* GetThreadBuffer();
+    static void ReleaseThreadBuffer();
+
+private:
+    static bool isEnabled;
+    static double lastFrameEndTimeInSecs;
+    static double lastFrameTimeInSecs;
+
+    FrameProfiler() {}
+    ~FrameProfiler() {}
+};
+
+/**
+ * Times the enclosing scope while the FrameProfiler is enabled.
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name) : buffer(NULL) {
+        if (FrameProfiler::IsEnabled()) {
+            this->Begin(name);
+        }
+    }
+    ~ProfileScope() {
+        if (this->buffer != NULL) {
+            this->End();
+        }
+    }
+
+private:
+    FrameProfiler::ThreadBuffer* buffer;
+    const char* name;
+    double startTimeInSecs;
+
+    void Begin(const char* name);
+    void End();
+
+    DISALLOW_COPY_AND_ASSIGN(ProfileScope);
+};
+
+#ifdef BLAMMO_DISABLE_PROFILER
+#define PROFILE_SCOPE(name)
+#else
+#define PROFILE_SCOPE_CONCAT_IMPL(a, b) a ## b
+#define PROFILE_SCOPE_CONCAT(a, b) PROFILE_SCOPE_CONCAT_IMPL(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_SCOPE_CONCAT(profileScope, __LINE__)(name)
+#endif
+
+#endif // __FRAMEPROFILER_H__
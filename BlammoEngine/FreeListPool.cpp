@@ -0,0 +1,136 @@
+/**
+ * FreeListPool.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "FreeListPool.h"
+
+// Every slot has to be able to hold the free list link and keep the alignment of anything stored in it
+static const size_t SLOT_ALIGNMENT = 16;
+
+FreeListPool::FreeListPool(const char* name, size_t objectSize, size_t numSlotsPerChunk) :
+name(name), slotSize(0), numSlotsPerChunk(numSlotsPerChunk), freeList(NULL) {
+    assert(name != NULL);
+    assert(objectSize > 0);
+    assert(numSlotsPerChunk > 0);
+
+    this->slotSize = std::max<size_t>(objectSize, sizeof(FreeSlot));
+    this->slotSize = (this->slotSize + SLOT_ALIGNMENT - 1) & ~(SLOT_ALIGNMENT - 1);
+
+    GetRegistry().push_back(this);
+}
+
+FreeListPool::~FreeListPool() {
+    std::vector<FreeListPool*>& registry = GetRegistry();
+    registry.erase(std::remove(registry.begin(), registry.end(), this), registry.end());
+
+    // Pools are typically static, anything still alive when the program shuts down keeps
+    // its memory (freeing it here would leave those objects dangling)
+    if (this->stats.numInUse > 0) {
+        return;
+    }
+    for (size_t i = 0; i < this->chunks.size(); i++) {
+        ::operator delete(this->chunks[i]);
+    }
+    this->chunks.clear();
+    this->freeList = NULL;
+}
+
+/**
+ * Make sure that at least the given number of slots have been taken from the heap.
+ */
+void FreeListPool::Reserve(size_t numSlots) {
+    while (this->stats.numSlots < numSlots) {
+        this->AddChunk();
+    }
+}
+
+void FreeListPool::ResetCounters() {
+    this->stats.numAllocations = 0;
+    this->stats.numHeapAllocations = 0;
+    this->stats.peakInUse = this->stats.numInUse;
+}
+
+void FreeListPool::AddChunk() {
+    char* chunk = static_cast<char*>(::operator new(this->slotSize * this->numSlotsPerChunk));
+    this->chunks.push_back(chunk);
+    this->stats.numSlots += this->numSlotsPerChunk;
+    this->stats.numHeapAllocations++;
+
+    // Thread the new slots onto the front of the free list, in address order
+    for (size_t i = this->numSlotsPerChunk; i > 0; i--) {
+        FreeSlot* slot = reinterpret_cast<FreeSlot*>(chunk + (i-1) * this->slotSize);
+        slot->next = this->freeList;
+        this->freeList = slot;
+    }
+}
+
+/**
+ * Writes a line for every pool that has been used, with its occupancy and allocation counts.
+ */
+void FreeListPool::WriteAllStats(std::ostream& out) {
+    const std::vector<FreeListPool*>& registry = GetRegistry();
+    for (size_t i = 0; i < registry.size(); i++) {
+        const FreeListPool* pool = registry[i];
+        const Stats& stats = pool->GetStats();
+        if (stats.numAllocations == 0 && stats.numSlots == 0) {
+            continue;
+        }
+        out << pool->GetName() << ": "
+            << "slot(bytes)="       << pool->GetSlotSize()
+            << ", slots="           << stats.numSlots
+            << ", in use="          << stats.numInUse
+            << ", peak="            << stats.peakInUse
+            << ", allocs="          << stats.numAllocations
+            << ", heap allocs="     << stats.numHeapAllocations
+            << std::endl;
+    }
+}
+
+void FreeListPool::ResetAllCounters() {
+    const std::vector<FreeListPool*>& registry = GetRegistry();
+    for (size_t i = 0; i < registry.size(); i++) {
+        registry[i]->ResetCounters();
+    }
+}
+
+unsigned long FreeListPool::GetTotalNumHeapAllocations() {
+    unsigned long total = 0;
+    const std::vector<FreeListPool*>& registry = GetRegistry();
+    for (size_t i = 0; i < registry.size(); i++) {
+        total += registry[i]->GetStats().numHeapAllocations;
+    }
+    return total;
+}
+
+std::vector<FreeListPool*>& FreeListPool::GetRegistry() {
+    // Constructed on first use so that pools in any translation unit can register during static initialization
+    static std::vector<FreeListPool*> registry;
+    return registry;
+}
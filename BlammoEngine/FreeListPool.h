@@ -0,0 +1,144 @@
+/**
+ * FreeListPool.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __FREELISTPOOL_H__
+#define __FREELISTPOOL_H__
+
+#include "BasicIncludes.h"
+
+/**
+ * Fixed-size object allocator: memory is taken from the heap in chunks of slots and freed
+ * slots are kept on a free list to be handed out again, so objects that are constantly
+ * created and destroyed (projectiles, item drops) stop hitting the heap once the pool has
+ * grown to the size of the scene. Chunks are never given back while the pool is in use.
+ *
+ * Requests larger than the slot size (e.g., a derived class that isn't pooled itself) are
+ * passed through to the heap. Pools are NOT thread-safe. Every pool is registered by name
+ * so that the occupancy of all the pools can be reported together.
+ */
+class FreeListPool {
+public:
+    struct Stats {
+        Stats() : numSlots(0), numInUse(0), peakInUse(0), numAllocations(0), numHeapAllocations(0) {}
+        size_t numSlots;                    // Slots taken from the heap so far (in use and free)
+        size_t numInUse;                    // Slots currently handed out
+        size_t peakInUse;                   // Most slots handed out at once
+        unsigned long numAllocations;       // Allocations requested from the pool
+        unsigned long numHeapAllocations;   // Allocations that went to the heap (new chunks and oversized requests)
+    };
+
+    FreeListPool(const char* name, size_t objectSize, size_t numSlotsPerChunk);
+    ~FreeListPool();
+
+    void* Allocate(size_t size);
+    void Free(void* ptr, size_t size);
+
+    void Reserve(size_t numSlots);
+
+    const char* GetName() const { return this->name; }
+    size_t GetSlotSize() const { return this->slotSize; }
+    const Stats& GetStats() const { return this->stats; }
+    void ResetCounters();
+
+    static void WriteAllStats(std::ostream& out);
+    static void ResetAllCounters();
+    static unsigned long GetTotalNumHeapAllocations();
+
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    const char* name;
+    size_t slotSize;
+    size_t numSlotsPerChunk;
+
+    std::vector<char*> chunks;
+    FreeSlot* freeList;
+    Stats stats;
+
+    void AddChunk();
+
+    static std::vector<FreeListPool*>& GetRegistry();
+
+    DISALLOW_COPY_AND_ASSIGN(FreeListPool);
+};
+
+inline void* FreeListPool::Allocate(size_t size) {
+    this->stats.numAllocations++;
+    if (size > this->slotSize) {
+        this->stats.numHeapAllocations++;
+        return ::operator new(size);
+    }
+
+    if (this->freeList == NULL) {
+        this->AddChunk();
+    }
+    FreeSlot* slot = this->freeList;
+    this->freeList = slot->next;
+
+    this->stats.numInUse++;
+    this->stats.peakInUse = std::max<size_t>(this->stats.peakInUse, this->stats.numInUse);
+    return slot;
+}
+
+/**
+ * Give back memory from Allocate, size MUST be the same size it was allocated with.
+ */
+inline void FreeListPool::Free(void* ptr, size_t size) {
+    if (ptr == NULL) {
+        return;
+    }
+    if (size > this->slotSize) {
+        ::operator delete(ptr);
+        return;
+    }
+
+    assert(this->stats.numInUse > 0);
+    FreeSlot* slot = static_cast<FreeSlot*>(ptr);
+    slot->next = this->freeList;
+    this->freeList = slot;
+    this->stats.numInUse--;
+}
+
+// Declares class-specific allocation functions that take instances of the class from
+// a pool of its own, the class' source file must contain the matching DEFINE_POOLED_ALLOCATION.
+// Only the most derived (concrete) classes should be pooled.
+#define DECLARE_POOLED_ALLOCATION() \
+    static void* operator new(size_t size); \
+    static void operator delete(void* ptr, size_t size)
+
+#define DEFINE_POOLED_ALLOCATION(className, numSlotsPerChunk) \
+    static FreeListPool className##Pool(#className, sizeof(className), numSlotsPerChunk); \
+    void* className::operator new(size_t size) { return className##Pool.Allocate(size); } \
+    void className::operator delete(void* ptr, size_t size) { className##Pool.Free(ptr, size); }
+
+#endif // __FREELISTPOOL_H__
@@ -0,0 +1,240 @@
+/**
+ * GlyphAtlas.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "GlyphAtlas.h"
+#include "Algebra.h"
+
+// Taller glyphs are packed first so that each shelf wastes as little height as possible
+class GlyphPackOrder {
+public:
+    GlyphPackOrder(const std::vector<TextureFontSet::BakedGlyph>& glyphs) : glyphs(glyphs) {}
+    bool operator()(size_t left, size_t right) const {
+        const TextureFontSet::BakedGlyph& leftGlyph  = this->glyphs[left];
+        const TextureFontSet::BakedGlyph& rightGlyph = this->glyphs[right];
+        if (leftGlyph.rows != rightGlyph.rows) {
+            return leftGlyph.rows > rightGlyph.rows;
+        }
+        if (leftGlyph.width != rightGlyph.width) {
+            return leftGlyph.width > rightGlyph.width;
+        }
+        return left < right;
+    }
+private:
+    const std::vector<TextureFontSet::BakedGlyph>& glyphs;
+};
+
+GlyphAtlas::GlyphAtlas() : heightInPixels(0), width(0), height(0) {
+}
+
+/**
+ * Packs the glyphs of the given baked font into this atlas, replacing anything that was in it.
+ * Returns: true on success, false if the glyphs don't fit into the largest allowed atlas.
+ */
+bool GlyphAtlas::Pack(const TextureFontSet::BakedFont& bakedFont) {
+    this->heightInPixels = bakedFont.heightInPixels;
+    this->width  = 0;
+    this->height = 0;
+    this->pixels.clear();
+
+    size_t numGlyphs = std::min<size_t>(bakedFont.glyphs.size(), MAX_NUM_GLYPHS);
+    this->glyphs.clear();
+    this->glyphs.resize(numGlyphs);
+
+    std::vector<size_t> packOrder;
+    packOrder.reserve(numGlyphs);
+    int totalArea = 0;
+    for (size_t i = 0; i < numGlyphs; i++) {
+        const TextureFontSet::BakedGlyph& bakedGlyph = bakedFont.glyphs[i];
+        Glyph& glyph = this->glyphs[i];
+        glyph.advance = static_cast<float>(bakedGlyph.advance);
+
+        if (bakedGlyph.bitmap.empty()) {
+            continue;
+        }
+        assert(bakedGlyph.bitmap.size() == static_cast<size_t>(bakedGlyph.width * bakedGlyph.rows));
+        glyph.left  = bakedGlyph.left;
+        glyph.top   = bakedGlyph.top;
+        glyph.width = bakedGlyph.width;
+        glyph.rows  = bakedGlyph.rows;
+
+        packOrder.push_back(i);
+        totalArea += (bakedGlyph.width + GLYPH_PADDING) * (bakedGlyph.rows + GLYPH_PADDING);
+    }
+    std::sort(packOrder.begin(), packOrder.end(), GlyphPackOrder(bakedFont.glyphs));
+
+    // Start at the smallest square that could hold all the glyphs and keep growing until they fit
+    int atlasWidth = MIN_ATLAS_SIZE;
+    while (atlasWidth * atlasWidth < totalArea && atlasWidth < MAX_ATLAS_SIZE) {
+        atlasWidth *= 2;
+    }
+    int atlasHeight = atlasWidth;
+    if (atlasWidth * atlasHeight / 2 >= totalArea && atlasHeight > MIN_ATLAS_SIZE) {
+        atlasHeight /= 2;
+    }
+    while (!this->PlaceGlyphs(packOrder, atlasWidth, atlasHeight)) {
+        if (atlasWidth <= atlasHeight) {
+            atlasWidth *= 2;
+        }
+        else {
+            atlasHeight *= 2;
+        }
+        if (atlasWidth > MAX_ATLAS_SIZE || atlasHeight > MAX_ATLAS_SIZE) {
+            debug_output("Font glyphs do not fit into a " << MAX_ATLAS_SIZE << "x" << MAX_ATLAS_SIZE << " atlas.");
+            this->glyphs.clear();
+            return false;
+        }
+    }
+
+    // Copy each glyph's bitmap into place and figure out its texture coordinates
+    this->width  = atlasWidth;
+    this->height = atlasHeight;
+    this->pixels.resize(this->width * this->height, 0);
+
+    float invWidth  = 1.0f / static_cast<float>(this->width);
+    float invHeight = 1.0f / static_cast<float>(this->height);
+    for (size_t i = 0; i < packOrder.size(); i++) {
+        const TextureFontSet::BakedGlyph& bakedGlyph = bakedFont.glyphs[packOrder[i]];
+        Glyph& glyph = this->glyphs[packOrder[i]];
+
+        for (int row = 0; row < glyph.rows; row++) {
+            memcpy(&this->pixels[(glyph.y + row) * this->width + glyph.x], 
+                &bakedGlyph.bitmap[row * glyph.width], glyph.width);
+        }
+
+        glyph.u0 = static_cast<float>(glyph.x) * invWidth;
+        glyph.v0 = static_cast<float>(glyph.y) * invHeight;
+        glyph.u1 = static_cast<float>(glyph.x + glyph.width) * invWidth;
+        glyph.v1 = static_cast<float>(glyph.y + glyph.rows) * invHeight;
+    }
+
+    return true;
+}
+
+/**
+ * Frees the atlas bitmap, only the glyph metrics are needed once it has been uploaded.
+ */
+void GlyphAtlas::ReleasePixels() {
+    std::vector<unsigned char> empty;
+    this->pixels.swap(empty);
+}
+
+// Places the glyphs, in the given order, onto shelves in an atlas of the given size.
+// Returns: true if they all fit, false otherwise.
+bool GlyphAtlas::PlaceGlyphs(const std::vector<size_t>& packOrder, int atlasWidth, int atlasHeight) {
+    int penX = GLYPH_PADDING;
+    int penY = GLYPH_PADDING;
+    int shelfHeight = 0;
+
+    for (size_t i = 0; i < packOrder.size(); i++) {
+        Glyph& glyph = this->glyphs[packOrder[i]];
+        if (penX + glyph.width + GLYPH_PADDING > atlasWidth) {
+            // Start a new shelf
+            penX = GLYPH_PADDING;
+            penY += shelfHeight + GLYPH_PADDING;
+            shelfHeight = 0;
+        }
+        if (penX + glyph.width + GLYPH_PADDING > atlasWidth || penY + glyph.rows + GLYPH_PADDING > atlasHeight) {
+            return false;
+        }
+
+        glyph.x = penX;
+        glyph.y = penY;
+        penX += glyph.width + GLYPH_PADDING;
+        shelfHeight = std::max<int>(shelfHeight, glyph.rows);
+    }
+
+    return true;
+}
+
+/**
+ * Builds the quads for the given string into the given layout. Characters without a glyph
+ * are skipped and glyphs with nothing to draw (e.g., spaces) only move the pen.
+ */
+void GlyphAtlas::LayoutText(const std::string& s, TextLayout& layout) const {
+    layout.vertices.clear();
+    layout.vertices.reserve(s.size() * TextLayout::NUM_VERTICES_PER_GLYPH * TextLayout::NUM_FLOATS_PER_VERTEX);
+
+    float penX = 0.0f;
+    for (std::string::const_iterator strIter = s.begin(); strIter != s.end(); ++strIter) {
+        size_t glyphIdx = static_cast<unsigned char>(*strIter);
+        if (glyphIdx >= this->glyphs.size()) {
+            continue;
+        }
+
+        const Glyph& glyph = this->glyphs[glyphIdx];
+        if (glyph.width > 0) {
+            // The bitmap hangs below the baseline for characters like 'g' or 'y'
+            float x0 = penX + static_cast<float>(glyph.left);
+            float x1 = x0 + static_cast<float>(glyph.width);
+            float y0 = static_cast<float>(glyph.top - glyph.rows);
+            float y1 = static_cast<float>(glyph.top);
+
+            // The first row of the bitmap is the top of the glyph
+            const float quad[TextLayout::NUM_VERTICES_PER_GLYPH * TextLayout::NUM_FLOATS_PER_VERTEX] = {
+                x0, y1, glyph.u0, glyph.v0,
+                x0, y0, glyph.u0, glyph.v1,
+                x1, y0, glyph.u1, glyph.v1,
+                x1, y1, glyph.u1, glyph.v0
+            };
+            layout.vertices.insert(layout.vertices.end(), quad, quad + TextLayout::NUM_VERTICES_PER_GLYPH * TextLayout::NUM_FLOATS_PER_VERTEX);
+        }
+        penX += glyph.advance;
+    }
+
+    layout.width = penX;
+}
+
+/**
+ * Scales, rotates (about z) and then translates the given layout, appending the results as
+ * coloured batch vertices. This is the same transform the font would otherwise have applied
+ * to the modelview matrix before drawing the layout.
+ */
+void GlyphAtlas::AppendTransformedLayout(const TextLayout& layout, float translateX, float translateY, float translateZ,
+                                         float rotationInDegs, float scale, const float colour[4],
+                                         std::vector<float>& batchVertices) {
+
+    float rotationInRads = Trig::degreesToRadians(rotationInDegs);
+    float cosRot = scale * cosf(rotationInRads);
+    float sinRot = scale * sinf(rotationInRads);
+
+    size_t numVertices = layout.GetNumVertices();
+    for (size_t i = 0; i < numVertices; i++) {
+        const float* vertex = &layout.vertices[i * TextLayout::NUM_FLOATS_PER_VERTEX];
+        float batchVertex[NUM_FLOATS_PER_BATCH_VERTEX] = {
+            translateX + cosRot * vertex[0] - sinRot * vertex[1],
+            translateY + sinRot * vertex[0] + cosRot * vertex[1],
+            translateZ,
+            vertex[2], vertex[3],
+            colour[0], colour[1], colour[2], colour[3]
+        };
+        batchVertices.insert(batchVertices.end(), batchVertex, batchVertex + NUM_FLOATS_PER_BATCH_VERTEX);
+    }
+}
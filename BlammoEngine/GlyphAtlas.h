@@ -0,0 +1,120 @@
+/**
+ * GlyphAtlas.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __GLYPHATLAS_H__
+#define __GLYPHATLAS_H__
+
+#include "BasicIncludes.h"
+#include "TextureFontSet.h"
+
+/**
+ * The vertices for a string of text laid out with a GlyphAtlas: one quad per drawn glyph, each
+ * vertex is a position (2) followed by a texture coordinate (2). Positions are in font pixels with
+ * the pen starting at the origin on the baseline - i.e., exactly where the old per-glyph display
+ * lists drew them.
+ */
+struct TextLayout {
+    static const size_t NUM_FLOATS_PER_VERTEX = 4;
+    static const size_t NUM_VERTICES_PER_GLYPH = 4;
+
+    std::vector<float> vertices;
+    float width;                    // How far the pen moved over the whole string
+
+    TextLayout() : width(0.0f) {}
+
+    size_t GetNumVertices() const { return this->vertices.size() / NUM_FLOATS_PER_VERTEX; }
+    bool IsEmpty() const { return this->vertices.empty(); }
+};
+
+/**
+ * All the glyphs of a font (at one size) packed into a single coverage bitmap so that any string
+ * can be drawn with one texture and one draw call. Packing and layout are done entirely on the CPU,
+ * the only thing that ever goes to OpenGL is the finished bitmap (see TextureFontSet).
+ *
+ * Glyphs are packed onto shelves, tallest first, into the smallest power of two sized bitmap that
+ * fits them.
+ */
+class GlyphAtlas {
+public:
+    // Only the glyphs that can be indexed by a character are packed
+    static const int MAX_NUM_GLYPHS = 256;
+    // Empty texels around each glyph so that filtering never bleeds into a neighbour
+    static const int GLYPH_PADDING = 1;
+    static const int MIN_ATLAS_SIZE = 64;
+    static const int MAX_ATLAS_SIZE = 4096;
+    // Batched text vertices are a position (3), texture coordinate (2) and colour (4)
+    static const size_t NUM_FLOATS_PER_BATCH_VERTEX = 9;
+
+    struct Glyph {
+        int x, y;                   // Top-left of the glyph's bitmap in the atlas, in texels
+        int left, top;              // Offset of the bitmap from the pen position
+        int width, rows;            // Size of the bitmap, both are zero for glyphs with nothing to draw
+        float advance;              // How far the pen moves after drawing the glyph
+        float u0, v0, u1, v1;       // Texture coordinates of the top-left and bottom-right of the bitmap
+
+        Glyph() : x(0), y(0), left(0), top(0), width(0), rows(0), advance(0.0f), u0(0.0f), v0(0.0f), u1(0.0f), v1(0.0f) {}
+    };
+
+    GlyphAtlas();
+    ~GlyphAtlas() {}
+
+    bool Pack(const TextureFontSet::BakedFont& bakedFont);
+    void ReleasePixels();
+
+    int GetWidth() const { return this->width; }
+    int GetHeight() const { return this->height; }
+    unsigned int GetHeightInPixels() const { return this->heightInPixels; }
+    const std::vector<unsigned char>& GetPixels() const { return this->pixels; }
+
+    size_t GetNumGlyphs() const { return this->glyphs.size(); }
+    const Glyph& GetGlyph(size_t glyphIdx) const {
+        assert(glyphIdx < this->glyphs.size());
+        return this->glyphs[glyphIdx];
+    }
+
+    void LayoutText(const std::string& s, TextLayout& layout) const;
+
+    static void AppendTransformedLayout(const TextLayout& layout, float translateX, float translateY, float translateZ,
+        float rotationInDegs, float scale, const float colour[4], std::vector<float>& batchVertices);
+
+private:
+    unsigned int heightInPixels;
+    int width;
+    int height;
+    std::vector<Glyph> glyphs;
+    std::vector<unsigned char> pixels;  // 8-bit coverage, width bytes per row
+
+    bool PlaceGlyphs(const std::vector<size_t>& packOrder, int atlasWidth, int atlasHeight);
+
+    DISALLOW_COPY_AND_ASSIGN(GlyphAtlas);
+};
+
+#endif // __GLYPHATLAS_H__
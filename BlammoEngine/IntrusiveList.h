@@ -0,0 +1,243 @@
+/**
+ * IntrusiveList.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __INTRUSIVELIST_H__
+#define __INTRUSIVELIST_H__
+
+#include "BasicIncludes.h"
+
+/**
+ * The links an object needs to be stored in an IntrusiveList, classes that want to be stored
+ * derive from this. An object can be in at most one intrusive list at a time. Copying an
+ * object never copies its links.
+ */
+class IntrusiveListNode {
+public:
+    IntrusiveListNode() : prevNode(NULL), nextNode(NULL), ownerList(NULL) {}
+    IntrusiveListNode(const IntrusiveListNode&) : prevNode(NULL), nextNode(NULL), ownerList(NULL) {}
+    IntrusiveListNode& operator=(const IntrusiveListNode&) { return *this; }
+
+    bool IsInList() const { return this->ownerList != NULL; }
+
+private:
+    template <typename T> friend class IntrusiveList;
+    IntrusiveListNode* prevNode;
+    IntrusiveListNode* nextNode;
+    const void* ownerList;  // The list this is linked into, NULL if it isn't in one
+};
+
+/**
+ * Doubly-linked list of pointers to objects that carry their own links (see IntrusiveListNode),
+ * so adding and removing never allocates. The interface is the subset of std::list<T*> that
+ * the game uses: dereferencing an iterator gives the T*.
+ *
+ * The list never owns or deletes its objects, it only links and unlinks them. Objects must
+ * be erased from the list (or the list cleared) before they're deleted. Lists can't be copied
+ * since the links live in the objects.
+ */
+template <typename T>
+class IntrusiveList {
+public:
+    class const_iterator;
+
+    class iterator {
+    public:
+        iterator() : node(NULL) {}
+        T* operator*() const { assert(this->node != NULL); return static_cast<T*>(this->node); }
+        iterator& operator++() { this->node = this->node->nextNode; return *this; }
+        iterator operator++(int) { iterator temp(*this); ++(*this); return temp; }
+        bool operator==(const iterator& other) const { return this->node == other.node; }
+        bool operator!=(const iterator& other) const { return this->node != other.node; }
+    private:
+        friend class IntrusiveList;
+        friend class const_iterator;
+        explicit iterator(IntrusiveListNode* node) : node(node) {}
+        IntrusiveListNode* node;
+    };
+
+    class const_iterator {
+    public:
+        const_iterator() : node(NULL) {}
+        const_iterator(const iterator& iter) : node(iter.node) {}
+        T* operator*() const { assert(this->node != NULL); return static_cast<T*>(const_cast<IntrusiveListNode*>(this->node)); }
+        const_iterator& operator++() { this->node = this->node->nextNode; return *this; }
+        const_iterator operator++(int) { const_iterator temp(*this); ++(*this); return temp; }
+        bool operator==(const const_iterator& other) const { return this->node == other.node; }
+        bool operator!=(const const_iterator& other) const { return this->node != other.node; }
+    private:
+        friend class IntrusiveList;
+        explicit const_iterator(const IntrusiveListNode* node) : node(node) {}
+        const IntrusiveListNode* node;
+    };
+
+    IntrusiveList() : head(NULL), tail(NULL), numNodes(0) {}
+    ~IntrusiveList() { this->clear(); }
+
+    iterator begin() { return iterator(this->head); }
+    iterator end() { return iterator(NULL); }
+    const_iterator begin() const { return const_iterator(this->head); }
+    const_iterator end() const { return const_iterator(NULL); }
+
+    bool empty() const { return this->numNodes == 0; }
+    size_t size() const { return this->numNodes; }
+    bool contains(const T* obj) const { assert(obj != NULL); return static_cast<const IntrusiveListNode*>(obj)->ownerList == this; }
+
+    T* front() const { assert(!this->empty()); return static_cast<T*>(this->head); }
+    T* back() const { assert(!this->empty()); return static_cast<T*>(this->tail); }
+
+    void push_back(T* obj);
+    void push_front(T* obj);
+    iterator erase(iterator iter);
+    void remove(T* obj);
+    void clear();
+
+private:
+    IntrusiveListNode* head;
+    IntrusiveListNode* tail;
+    size_t numNodes;
+
+    DISALLOW_COPY_AND_ASSIGN(IntrusiveList);
+};
+
+/**
+ * Links the given object in at the end of this list, objects that are already in a list are
+ * left where they are.
+ */
+template <typename T>
+inline void IntrusiveList<T>::push_back(T* obj) {
+    assert(obj != NULL);
+    IntrusiveListNode* node = obj;
+    if (node->ownerList != NULL) {
+        assert(false);
+        return;
+    }
+    node->ownerList = this;
+    node->prevNode = this->tail;
+    node->nextNode = NULL;
+    if (this->tail != NULL) {
+        this->tail->nextNode = node;
+    }
+    else {
+        this->head = node;
+    }
+    this->tail = node;
+    this->numNodes++;
+}
+
+template <typename T>
+inline void IntrusiveList<T>::push_front(T* obj) {
+    assert(obj != NULL);
+    IntrusiveListNode* node = obj;
+    if (node->ownerList != NULL) {
+        assert(false);
+        return;
+    }
+    node->ownerList = this;
+    node->prevNode = NULL;
+    node->nextNode = this->head;
+    if (this->head != NULL) {
+        this->head->prevNode = node;
+    }
+    else {
+        this->tail = node;
+    }
+    this->head = node;
+    this->numNodes++;
+}
+
+/**
+ * Unlinks the object at the given iterator from this list, iterators that aren't from this
+ * list are ignored.
+ * Returns: An iterator to the object that followed the erased one.
+ */
+template <typename T>
+inline typename IntrusiveList<T>::iterator IntrusiveList<T>::erase(iterator iter) {
+    IntrusiveListNode* node = iter.node;
+    if (node == NULL || node->ownerList != this) {
+        assert(false);
+        return this->end();
+    }
+    assert(this->numNodes > 0);
+    IntrusiveListNode* nextNode = node->nextNode;
+
+    if (node->prevNode != NULL) {
+        node->prevNode->nextNode = nextNode;
+    }
+    else {
+        assert(this->head == node);
+        this->head = nextNode;
+    }
+    if (nextNode != NULL) {
+        nextNode->prevNode = node->prevNode;
+    }
+    else {
+        assert(this->tail == node);
+        this->tail = node->prevNode;
+    }
+
+    node->prevNode = NULL;
+    node->nextNode = NULL;
+    node->ownerList = NULL;
+    this->numNodes--;
+    return iterator(nextNode);
+}
+
+/**
+ * Unlinks the given object if it's in this list, does nothing otherwise.
+ */
+template <typename T>
+inline void IntrusiveList<T>::remove(T* obj) {
+    assert(obj != NULL);
+    if (!this->contains(obj)) {
+        return;
+    }
+    this->erase(iterator(obj));
+}
+
+/**
+ * Unlinks every object in this list, the objects must all still exist.
+ */
+template <typename T>
+inline void IntrusiveList<T>::clear() {
+    IntrusiveListNode* node = this->head;
+    while (node != NULL) {
+        IntrusiveListNode* nextNode = node->nextNode;
+        node->prevNode  = NULL;
+        node->nextNode  = NULL;
+        node->ownerList = NULL;
+        node = nextNode;
+    }
+    this->head = NULL;
+    this->tail = NULL;
+    this->numNodes = 0;
+}
+
+#endif // __INTRUSIVELIST_H__
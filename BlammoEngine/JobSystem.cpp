@@ -0,0 +1,285 @@
+/**
+ * JobSystem.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "JobSystem.h"
+#include "FrameProfiler.h"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+JobSystem* JobSystem::instance = NULL;
+
+// Aim for this many jobs per thread when the caller lets the grain size be picked, enough
+// for the stealing to even out jobs that take longer than others
+static const size_t NUM_JOBS_PER_THREAD = 8;
+
+JobSystem::JobSystem(int numThreads) : workSemaphore(NULL), completionMutex(NULL), completionCond(NULL),
+numPendingJobs(0), isShuttingDown(false), isInParallelFor(false) {
+    this->workSemaphore   = SDL_CreateSemaphore(0);
+    this->completionMutex = SDL_CreateMutex();
+    this->completionCond  = SDL_CreateCond();
+    assert(this->workSemaphore != NULL && this->completionMutex != NULL && this->completionCond != NULL);
+
+    this->StartThreads(numThreads);
+}
+
+JobSystem::~JobSystem() {
+    this->StopThreads();
+
+    SDL_DestroyCond(this->completionCond);
+    this->completionCond = NULL;
+    SDL_DestroyMutex(this->completionMutex);
+    this->completionMutex = NULL;
+    SDL_DestroySemaphore(this->workSemaphore);
+    this->workSemaphore = NULL;
+}
+
+/**
+ * Get the number of processors that are available to run threads on.
+ */
+int JobSystem::GetNumProcessors() {
+#ifdef _WIN32
+    SYSTEM_INFO sysInfo;
+    GetSystemInfo(&sysInfo);
+    return std::max<int>(1, static_cast<int>(sysInfo.dwNumberOfProcessors));
+#else
+    return std::max<int>(1, static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN)));
+#endif
+}
+
+void JobSystem::SetNumThreads(int numThreads) {
+    assert(!this->isInParallelFor);
+    numThreads = std::max<int>(1, numThreads);
+    if (numThreads == this->GetNumThreads()) {
+        return;
+    }
+
+    this->StopThreads();
+    this->StartThreads(numThreads);
+}
+
+void JobSystem::StartThreads(int numThreads) {
+    assert(this->queues.empty() && this->threads.empty());
+    numThreads = std::max<int>(1, numThreads);
+
+    SDL_mutexP(this->completionMutex);
+    this->isShuttingDown = false;
+    SDL_mutexV(this->completionMutex);
+    this->queues.reserve(numThreads);
+    for (int i = 0; i < numThreads; i++) {
+        JobQueue* queue = new JobQueue();
+        queue->mutex = SDL_CreateMutex();
+        assert(queue->mutex != NULL);
+        this->queues.push_back(queue);
+    }
+
+    // The worker infos have to stay put once the threads have been given pointers to them
+    this->workerInfos.resize(numThreads - 1);
+    for (int i = 1; i < numThreads; i++) {
+        WorkerInfo& info = this->workerInfos[i - 1];
+        info.jobSystem = this;
+        info.queueIdx  = i;
+
+        SDL_Thread* thread = SDL_CreateThread(&JobSystem::WorkerThreadMain, &info);
+        if (thread == NULL) {
+            // Carry on with fewer threads, the caller's thread will pick up the slack
+            debug_output("Failed to create job system worker thread: " << SDL_GetError());
+            continue;
+        }
+        this->threads.push_back(thread);
+    }
+}
+
+void JobSystem::StopThreads() {
+    assert(!this->isInParallelFor);
+
+    SDL_mutexP(this->completionMutex);
+    this->isShuttingDown = true;
+    SDL_mutexV(this->completionMutex);
+    for (size_t i = 0; i < this->threads.size(); i++) {
+        SDL_SemPost(this->workSemaphore);
+    }
+    for (size_t i = 0; i < this->threads.size(); i++) {
+        SDL_WaitThread(this->threads[i], NULL);
+    }
+    this->threads.clear();
+    this->workerInfos.clear();
+
+    // Any wake-ups that weren't used up are stale now
+    while (SDL_SemTryWait(this->workSemaphore) == 0) {}
+
+    for (size_t i = 0; i < this->queues.size(); i++) {
+        assert(this->queues[i]->jobs.empty());
+        SDL_DestroyMutex(this->queues[i]->mutex);
+        delete this->queues[i];
+    }
+    this->queues.clear();
+}
+
+/**
+ * Take a job for the given queue's thread: the newest job of its own queue if there is one,
+ * otherwise the oldest job from any of the other queues.
+ */
+bool JobSystem::TakeJob(int queueIdx, Job& job) {
+    JobQueue* ownQueue = this->queues[queueIdx];
+    SDL_mutexP(ownQueue->mutex);
+    if (!ownQueue->jobs.empty()) {
+        job = ownQueue->jobs.back();
+        ownQueue->jobs.pop_back();
+        SDL_mutexV(ownQueue->mutex);
+        return true;
+    }
+    SDL_mutexV(ownQueue->mutex);
+
+    int numQueues = static_cast<int>(this->queues.size());
+    for (int i = 1; i < numQueues; i++) {
+        JobQueue* victimQueue = this->queues[(queueIdx + i) % numQueues];
+        SDL_mutexP(victimQueue->mutex);
+        if (!victimQueue->jobs.empty()) {
+            job = victimQueue->jobs.front();
+            victimQueue->jobs.pop_front();
+            SDL_mutexV(victimQueue->mutex);
+            return true;
+        }
+        SDL_mutexV(victimQueue->mutex);
+    }
+
+    return false;
+}
+
+/**
+ * Run the next job available to the given queue's thread. Returns false if there was no job left.
+ */
+bool JobSystem::RunNextJob(int queueIdx) {
+    Job job;
+    if (!this->TakeJob(queueIdx, job)) {
+        return false;
+    }
+
+    job.func(job.context, job.begin, job.end);
+
+    SDL_mutexP(this->completionMutex);
+    assert(this->numPendingJobs > 0);
+    this->numPendingJobs--;
+    if (this->numPendingJobs == 0) {
+        SDL_CondSignal(this->completionCond);
+    }
+    SDL_mutexV(this->completionMutex);
+
+    return true;
+}
+
+int JobSystem::WorkerThreadMain(void* data) {
+    WorkerInfo* info = static_cast<WorkerInfo*>(data);
+    JobSystem* jobSystem = info->jobSystem;
+
+    for (;;) {
+        SDL_SemWait(jobSystem->workSemaphore);
+
+        // A worker can wake up late from an earlier ParallelFor, so the flag has to be read under the lock
+        SDL_mutexP(jobSystem->completionMutex);
+        bool isShuttingDown = jobSystem->isShuttingDown;
+        SDL_mutexV(jobSystem->completionMutex);
+        if (isShuttingDown) {
+            break;
+        }
+        while (jobSystem->RunNextJob(info->queueIdx)) {}
+    }
+
+    FrameProfiler::ReleaseThreadBuffer();
+    return 0;
+}
+
+/**
+ * Call the given function over all of the items [0, count), split up into ranges of grainSize items
+ * that get run on any of the threads. If grainSize is zero then one is picked based on the number of
+ * threads. Returns once every item has been done.
+ */
+void JobSystem::ParallelFor(size_t count, size_t grainSize, RangeFunc func, void* context) {
+    assert(func != NULL);
+    assert(!this->isInParallelFor);
+    if (count == 0) {
+        return;
+    }
+
+    size_t numThreads = this->threads.size() + 1;
+    if (grainSize == 0) {
+        grainSize = std::max<size_t>(1, count / (numThreads * NUM_JOBS_PER_THREAD));
+    }
+
+    // Not worth waking anyone up for
+    if (numThreads == 1 || count <= grainSize) {
+        func(context, 0, count);
+        return;
+    }
+
+    this->isInParallelFor = true;
+
+    size_t numJobs = (count + grainSize - 1) / grainSize;
+    SDL_mutexP(this->completionMutex);
+    this->numPendingJobs = numJobs;
+    SDL_mutexV(this->completionMutex);
+
+    // Deal the jobs out to all of the queues
+    size_t numQueues = this->queues.size();
+    for (size_t i = 0; i < numQueues; i++) {
+        SDL_mutexP(this->queues[i]->mutex);
+    }
+    for (size_t jobIdx = 0; jobIdx < numJobs; jobIdx++) {
+        Job job;
+        job.func    = func;
+        job.context = context;
+        job.begin   = jobIdx * grainSize;
+        job.end     = std::min<size_t>(count, job.begin + grainSize);
+        this->queues[jobIdx % numQueues]->jobs.push_back(job);
+    }
+    for (size_t i = 0; i < numQueues; i++) {
+        SDL_mutexV(this->queues[i]->mutex);
+    }
+
+    // Each woken worker keeps taking jobs until there are none left
+    size_t numWakeUps = std::min<size_t>(numJobs, this->threads.size());
+    for (size_t i = 0; i < numWakeUps; i++) {
+        SDL_SemPost(this->workSemaphore);
+    }
+
+    // Help out, then wait on whatever is still running on the workers
+    while (this->RunNextJob(0)) {}
+
+    SDL_mutexP(this->completionMutex);
+    while (this->numPendingJobs > 0) {
+        SDL_CondWait(this->completionCond, this->completionMutex);
+    }
+    SDL_mutexV(this->completionMutex);
+
+    this->isInParallelFor = false;
+}
@@ -0,0 +1,119 @@
+/**
+ * JobSystem.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __JOBSYSTEM_H__
+#define __JOBSYSTEM_H__
+
+#include "BasicIncludes.h"
+
+#include <deque>
+
+/**
+ * A small pool of worker threads for running independent pieces of work in parallel. Work is
+ * given as a range of items that gets split into jobs, each worker thread has its own queue of
+ * jobs and once that's empty it steals jobs from the other queues, so uneven jobs still keep every
+ * thread busy. The thread that calls ParallelFor works on the jobs as well and only returns once
+ * all of them are done.
+ *
+ * ParallelFor is meant to be called from a single thread (e.g., the main/GL thread) and jobs
+ * must not call it themselves.
+ */
+class JobSystem {
+public:
+    // Function that does the work for the items [begin, end) of a ParallelFor
+    typedef void (*RangeFunc)(void* context, size_t begin, size_t end);
+
+    static JobSystem* GetInstance() {
+        if (JobSystem::instance == NULL) {
+            JobSystem::instance = new JobSystem(JobSystem::GetNumProcessors());
+        }
+        return JobSystem::instance;
+    }
+    static void DeleteInstance() {
+        if (JobSystem::instance != NULL) {
+            delete JobSystem::instance;
+            JobSystem::instance = NULL;
+        }
+    }
+
+    static int GetNumProcessors();
+
+    // The number of threads includes the calling thread, so a single thread runs everything serially
+    void SetNumThreads(int numThreads);
+    int GetNumThreads() const { return static_cast<int>(this->queues.size()); }
+
+    void ParallelFor(size_t count, size_t grainSize, RangeFunc func, void* context);
+
+private:
+    static JobSystem* instance;
+
+    struct Job {
+        RangeFunc func;
+        void* context;
+        size_t begin;
+        size_t end;
+    };
+    struct JobQueue {
+        std::deque<Job> jobs;
+        SDL_mutex* mutex;
+    };
+    struct WorkerInfo {
+        JobSystem* jobSystem;
+        int queueIdx;
+    };
+
+    // Queue 0 belongs to the thread calling ParallelFor, the rest belong to the worker threads
+    std::vector<JobQueue*> queues;
+    std::vector<SDL_Thread*> threads;
+    std::vector<WorkerInfo> workerInfos;
+
+    SDL_sem* workSemaphore;     // Posted to wake up the workers when there are new jobs
+    SDL_mutex* completionMutex;
+    SDL_cond* completionCond;   // Signalled when the last pending job finishes
+    size_t numPendingJobs;      // Guarded by the completion mutex
+    bool isShuttingDown;        // Guarded by the completion mutex
+    bool isInParallelFor;
+
+    JobSystem(int numThreads);
+    ~JobSystem();
+
+    void StartThreads(int numThreads);
+    void StopThreads();
+
+    bool TakeJob(int queueIdx, Job& job);
+    bool RunNextJob(int queueIdx);
+
+    static int WorkerThreadMain(void* data);
+
+    DISALLOW_COPY_AND_ASSIGN(JobSystem);
+};
+
+#endif // __JOBSYSTEM_H__
@@ -36,6 +36,7 @@
 #include "Algebra.h"
 #include "Vector.h"
 #include "Point.h"
+#include "BatchMath.h"
 
 class Matrix4x4 {
 
@@ -376,17 +377,7 @@ public:
 inline Matrix4x4 operator *(const Matrix4x4& a, const Matrix4x4& b)
 {
     Matrix4x4 ret;
-
-    for (int i = 0; i < 4; ++i) {
-        Vector4D lhsRow = a.getRow(i);
-
-        for (int j = 0; j < 4; ++j) {
-            int jTimes4 = j*4;
-            Vector4D rhsCol(b[jTimes4], b[jTimes4+1], b[jTimes4+2], b[jTimes4+3]);
-            ret[i + jTimes4] = Vector4D::Dot(lhsRow, rhsCol);
-        }
-    }
-
+    BatchMath::MultiplyMatrix4x4(a.begin(), b.begin(), &ret[0]);
     return ret;
 }
 
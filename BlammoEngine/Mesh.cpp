@@ -30,6 +30,7 @@
  */
 
 #include "Mesh.h"
+#include "MeshPack.h"
 
 // Copy constructor
 PolygonGroup::PolygonGroup(const PolygonGroup& other) : polyType(other.polyType), vertexStream(other.vertexStream),
@@ -53,6 +54,32 @@ PolygonGroup::PolygonGroup(const PolyGrpIndexer& faceIndexer, const std::vector<
 
 }
 
+/**
+ * Build the polygon group from compiled, indexed geometry (see MeshPack) where each vertex is
+ * interleaved as its position, normal and then texture coordinate. The vertices are expanded into
+ * the same per-polygon streams that the obj indexed constructor produces.
+ */
+PolygonGroup::PolygonGroup(GLenum polyType, const float* interleavedVertices, size_t numVertices,
+                           const unsigned short* indices, size_t numIndices) : polyType(polyType) {
+	assert(numIndices >= 3);
+	assert(numIndices <= USHRT_MAX);
+	UNUSED_PARAMETER(numVertices);
+
+	this->vertexStream.reserve(numIndices);
+	this->normalStream.reserve(numIndices);
+	this->texCoordStream.reserve(numIndices);
+	this->indices.reserve(numIndices);
+
+	for (size_t i = 0; i < numIndices; i++) {
+		assert(indices[i] < numVertices);
+		const float* vertex = interleavedVertices + CompiledMesh::FLOATS_PER_VERTEX * indices[i];
+		this->vertexStream.push_back(Point3D(vertex[0], vertex[1], vertex[2]));
+		this->normalStream.push_back(Vector3D(vertex[3], vertex[4], vertex[5]));
+		this->texCoordStream.push_back(Point2D(vertex[6], vertex[7]));
+		this->indices.push_back(static_cast<GLushort>(i));
+	}
+}
+
 void PolygonGroup::Draw() const {
 	glBegin(this->polyType);
 	std::vector<Point3D>::const_iterator vertexIter = this->vertexStream.begin();
@@ -101,20 +128,17 @@ void PolygonGroup::Translate(const Vector3D& t) {
 }
 
 void PolygonGroup::TransformVerticesAndNormals(const Matrix4x4& m) {
-	for (size_t i = 0; i < this->vertexStream.size(); ++i) {
-		Point3D& currPt = this->vertexStream[i];
-		currPt = m * currPt;
+	if (!this->vertexStream.empty()) {
+		BatchMath::TransformPoints(m, &this->vertexStream[0], this->vertexStream.size());
 	}
-	for (size_t i = 0; i < this->normalStream.size(); ++i) {
-		Vector3D& currNormal = this->normalStream[i];
-		currNormal = m * currNormal;
+	if (!this->normalStream.empty()) {
+		BatchMath::TransformVectors(m, &this->normalStream[0], this->normalStream.size());
 	}
 }
 
 void PolygonGroup::TransformTexCoords(const Matrix4x4& m) {
-    for (size_t i = 0; i < this->texCoordStream.size(); i++) {
-        Point2D& currTexCoord = this->texCoordStream[i];
-        currTexCoord = m * currTexCoord;
+    if (!this->texCoordStream.empty()) {
+        BatchMath::TransformPoints(m, &this->texCoordStream[0], this->texCoordStream.size());
     }
 }
 
@@ -124,9 +148,8 @@ void PolygonGroup::TransformVerticesNormalsAndTexCoords(const Matrix4x4& m) {
 }
 
 void PolygonGroup::RotateTexCoords(float degs) {
-    for (size_t i = 0; i < this->texCoordStream.size(); i++) {
-        Point2D& currTexCoord = this->texCoordStream[i];
-        currTexCoord.Rotate(degs);
+    if (!this->texCoordStream.empty()) {
+        BatchMath::RotatePoints(degs, Point2D(0,0), &this->texCoordStream[0], this->texCoordStream.size());
     }
 }
 
@@ -38,6 +38,7 @@
 #include "Point.h"
 #include "Vector.h"
 #include "CgFxEffect.h"
+#include "RenderCommandQueue.h"
 #include "Light.h"
 
 class Camera;
@@ -70,11 +71,18 @@ public:
 							 const std::vector<Point3D>& vertexStream, 
 							 const std::vector<Vector3D>& normalStream,
 							 const std::vector<Point2D>& texCoordStream);
+	PolygonGroup(GLenum polyType, const float* interleavedVertices, size_t numVertices,
+	             const unsigned short* indices, size_t numIndices);
 
 	~PolygonGroup() {};
 
 	void Draw() const;
 
+	GLenum GetPolygonType() const { return this->polyType; }
+	const std::vector<Point3D>& GetVertexStream() const { return this->vertexStream; }
+	const std::vector<Vector3D>& GetNormalStream() const { return this->normalStream; }
+	const std::vector<Point2D>& GetTexCoordStream() const { return this->texCoordStream; }
+
 	GLuint GenerateDisplayList() const {
 		GLuint displayListID = glGenLists(1);
 		glNewList(displayListID, GL_COMPILE);
@@ -174,6 +182,29 @@ public:
 		glCallList(this->displayListID);
 	}
 
+	/**
+	 * Record this material group into the given queue with the given modelview (column-major,
+	 * 16 floats) and colour (RGBA), rather than drawing it right away.
+	 */
+	inline void Record(RenderCommandQueue& queue, unsigned char pass, const float* modelViewMatrix,
+	                   const float* colour) const {
+		assert(this->displayListID != 0);
+		const MaterialProperties* properties = this->material->GetProperties();
+		GLuint textureID = 0;
+		if (properties != NULL && properties->diffuseTexture != NULL) {
+			textureID = properties->diffuseTexture->GetTextureID();
+		}
+		queue.Add(pass, this->material, textureID, this->displayListID, modelViewMatrix, colour);
+	}
+	inline void Record(RenderCommandQueue& queue, unsigned char pass, const float* modelViewMatrix,
+	                   const float* colour, const BasicPointLight& keyLight,
+	                   const BasicPointLight& fillLight, const BasicPointLight& ballLight) {
+		this->material->SetKeyLight(keyLight);
+		this->material->SetFillLight(fillLight);
+		this->material->SetBallLight(ballLight);
+		this->Record(queue, pass, modelViewMatrix, colour);
+	}
+
 	CgFxAbstractMaterialEffect* GetMaterial() const {
 		return this->material;
 	}
@@ -288,6 +319,20 @@ public:
 	}
 
 
+	/**
+	 * Record the mesh into the given queue (see RenderCommandQueue) with the given modelview,
+	 * colour and lights - the lights are shared by everything recorded with the same materials
+	 * in a frame.
+	 */
+	void Record(RenderCommandQueue& queue, unsigned char pass, const Matrix4x4& modelView,
+	            const float* colour, const BasicPointLight& keyLight,
+	            const BasicPointLight& fillLight, const BasicPointLight& ballLight) {
+		std::map<std::string, MaterialGroup*>::const_iterator matGrpIter = this->matGrps.begin();
+		for (matGrpIter = this->matGrps.begin(); matGrpIter != this->matGrps.end(); ++matGrpIter) {
+			matGrpIter->second->Record(queue, pass, modelView.begin(), colour, keyLight, fillLight, ballLight);
+		}
+	}
+
     /**
 	 * Draw all of the mesh without the material.
 	 */
@@ -0,0 +1,385 @@
+/**
+ * MeshPack.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "MeshPack.h"
+#include "ObjReader.h"
+
+#include "../ResourceManager.h"
+
+const char* MeshPack::FILE_EXTENSION        = ".meshpack";
+const unsigned int MeshPack::FILE_MAGIC     = 0x504D4242; // "BBMP" when read as little-endian bytes
+const unsigned int MeshPack::FILE_VERSION   = 2;
+
+// Limits on what a pack can hold, anything over these is treated as a corrupt file. A group's indices
+// are unsigned shorts and so is the index count that a PolygonGroup is built with.
+static const unsigned int MAX_NUM_GROUP_VERTICES = USHRT_MAX + 1;
+static const unsigned int MAX_NUM_GROUP_INDICES  = USHRT_MAX;
+static const unsigned int MIN_NUM_MESH_BYTES     = 20; // Two empty file paths, the source size and hash and no material groups
+static const unsigned int MIN_NUM_GROUP_BYTES    = 16; // An empty material name and no geometry
+
+/**
+ * A fully expanded vertex (position, normal, texture coordinate), vertices are only
+ * merged when every one of their components is bit-for-bit identical.
+ */
+struct PackedVertex {
+    float values[CompiledMesh::FLOATS_PER_VERTEX];
+
+    bool operator<(const PackedVertex& other) const {
+        return memcmp(this->values, other.values, sizeof(this->values)) < 0;
+    }
+};
+
+/**
+ * Compiles the parsed geometry of an obj file (the contents of which are given) into one deduplicated,
+ * indexed vertex array per material group.
+ * Returns: true on success, false if the obj data has out of range indices or if a material group has
+ * more unique vertices or indices than can be addressed with unsigned shorts.
+ */
+bool CompiledMesh::CompileFromObj(const std::string& objFilepath, const char* objFileBuffer, size_t objFileLength,
+                                  const ObjMeshData& meshData, CompiledMesh& mesh) {
+    mesh.objFilepath = objFilepath;
+    mesh.mtlFilepath = meshData.mtlFilepath;
+    mesh.objFileSize = static_cast<unsigned int>(objFileLength);
+    mesh.objFileHash = CompiledMesh::HashObjFile(objFileBuffer, objFileLength);
+    mesh.materialGeometry.clear();
+    mesh.materialGeometry.reserve(meshData.materialNames.size());
+
+    for (std::vector<std::string>::const_iterator nameIter = meshData.materialNames.begin();
+         nameIter != meshData.materialNames.end(); ++nameIter) {
+
+        mesh.materialGeometry.push_back(MaterialGeometry());
+        MaterialGeometry& geometry = mesh.materialGeometry.back();
+        geometry.materialName = *nameIter;
+
+        // A material can be named without ever having any faces, in which case it has no geometry
+        std::map<std::string, PolyGrpIndexer>::const_iterator polyGrpIter = meshData.polyGrps.find(*nameIter);
+        if (polyGrpIter == meshData.polyGrps.end()) {
+            continue;
+        }
+
+        const PolyGrpIndexer& indexer = polyGrpIter->second;
+        if (indexer.normalIndices.size() != indexer.vertexIndices.size() ||
+            indexer.texCoordIndices.size() != indexer.vertexIndices.size()) {
+            debug_output("ERROR: Mismatched face indices in obj file: " << objFilepath);
+            return false;
+        }
+        if (indexer.vertexIndices.size() > MAX_NUM_GROUP_INDICES) {
+            debug_output("ERROR: Too many indices in material group " << *nameIter << " of obj file: " << objFilepath);
+            return false;
+        }
+
+        geometry.polyType = indexer.polyType;
+        geometry.indices.reserve(indexer.vertexIndices.size());
+
+        std::map<PackedVertex, unsigned short> uniqueVertices;
+        for (size_t i = 0; i < indexer.vertexIndices.size(); i++) {
+            unsigned short vertexIdx   = indexer.vertexIndices[i];
+            unsigned short normalIdx   = indexer.normalIndices[i];
+            unsigned short texCoordIdx = indexer.texCoordIndices[i];
+            if (vertexIdx >= meshData.vertices.size() || normalIdx >= meshData.normals.size() ||
+                texCoordIdx >= meshData.texCoords.size()) {
+                debug_output("ERROR: Face index out of range in obj file: " << objFilepath);
+                return false;
+            }
+
+            const Point3D& position   = meshData.vertices[vertexIdx];
+            const Vector3D& normal    = meshData.normals[normalIdx];
+            const Point2D& texCoord   = meshData.texCoords[texCoordIdx];
+
+            PackedVertex vertex;
+            vertex.values[0] = position[0];
+            vertex.values[1] = position[1];
+            vertex.values[2] = position[2];
+            vertex.values[3] = normal[0];
+            vertex.values[4] = normal[1];
+            vertex.values[5] = normal[2];
+            vertex.values[6] = texCoord[0];
+            vertex.values[7] = texCoord[1];
+
+            size_t numVertices = geometry.GetNumVertices();
+            std::map<PackedVertex, unsigned short>::const_iterator findIter = uniqueVertices.find(vertex);
+            if (findIter == uniqueVertices.end()) {
+                if (numVertices >= MAX_NUM_GROUP_VERTICES) {
+                    debug_output("ERROR: Too many unique vertices in material group " << *nameIter << " of obj file: " << objFilepath);
+                    return false;
+                }
+                findIter = uniqueVertices.insert(std::make_pair(vertex, static_cast<unsigned short>(numVertices))).first;
+                geometry.vertices.insert(geometry.vertices.end(), vertex.values, vertex.values + FLOATS_PER_VERTEX);
+            }
+            geometry.indices.push_back(findIter->second);
+        }
+    }
+
+    return true;
+}
+
+// 32-bit FNV-1a hash of the contents of an obj file
+unsigned int CompiledMesh::HashObjFile(const char* objFileBuffer, size_t objFileLength) {
+    unsigned int hash = 2166136261U;
+    for (size_t i = 0; i < objFileLength; i++) {
+        hash ^= static_cast<unsigned char>(objFileBuffer[i]);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+// Binary reading/writing helpers, all values are stored little-endian
+
+static void WriteUInt32(std::ostream& out, unsigned int value) {
+    char bytes[4];
+    bytes[0] = static_cast<char>(value & 0xFF);
+    bytes[1] = static_cast<char>((value >> 8) & 0xFF);
+    bytes[2] = static_cast<char>((value >> 16) & 0xFF);
+    bytes[3] = static_cast<char>((value >> 24) & 0xFF);
+    out.write(bytes, 4);
+}
+static void WriteString(std::ostream& out, const std::string& str) {
+    WriteUInt32(out, static_cast<unsigned int>(str.size()));
+    out.write(str.data(), str.size());
+}
+
+static bool ReadUInt32(const char*& curr, const char* end, unsigned int& value) {
+    if (end - curr < 4) {
+        return false;
+    }
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(curr);
+    value = static_cast<unsigned int>(bytes[0]) | (static_cast<unsigned int>(bytes[1]) << 8) |
+        (static_cast<unsigned int>(bytes[2]) << 16) | (static_cast<unsigned int>(bytes[3]) << 24);
+    curr += 4;
+    return true;
+}
+static bool ReadString(const char*& curr, const char* end, std::string& str) {
+    unsigned int length;
+    if (!ReadUInt32(curr, end, length) || static_cast<unsigned int>(end - curr) < length) {
+        return false;
+    }
+    str.assign(curr, length);
+    curr += length;
+    return true;
+}
+
+// The vertex and index arrays are stored as raw (little-endian) memory so that they can be copied
+// straight in and out of the file rather than being converted one value at a time
+
+template <typename T>
+static void WriteArray(std::ostream& out, const std::vector<T>& values) {
+    if (!values.empty()) {
+        out.write(reinterpret_cast<const char*>(&values[0]), values.size() * sizeof(T));
+    }
+}
+template <typename T>
+static bool ReadArray(const char*& curr, const char* end, size_t count, std::vector<T>& values) {
+    size_t numBytes = count * sizeof(T);
+    if (static_cast<size_t>(end - curr) < numBytes) {
+        return false;
+    }
+    values.resize(count);
+    if (count > 0) {
+        memcpy(&values[0], curr, numBytes);
+    }
+    curr += numBytes;
+    return true;
+}
+
+/**
+ * Loads the mesh pack at the given resource path with a single read of the file.
+ * Returns: The loaded pack on success, NULL if the file doesn't exist or isn't a valid pack.
+ */
+MeshPack* MeshPack::LoadFromResource(const std::string& filepath) {
+    long length = 0;
+    char* buffer = ResourceManager::FilepathToMemoryBuffer(filepath, length);
+    if (buffer == NULL) {
+        return NULL;
+    }
+
+    MeshPack* pack = new MeshPack();
+    bool success = pack->ReadFromMemory(buffer, static_cast<size_t>(length));
+    delete[] buffer;
+    buffer = NULL;
+
+    if (!success) {
+        debug_output("ERROR: Invalid mesh pack file: " << filepath);
+        delete pack;
+        return NULL;
+    }
+    return pack;
+}
+
+/**
+ * Reads the binary mesh pack format:
+ * magic, version, mesh count, then each mesh - its obj and mtl file paths, the size and hash of its obj file and
+ * then its material groups, each of which is its material name, polygon type, vertex count, index count, vertices
+ * and then indices.
+ */
+bool MeshPack::ReadFromMemory(const char* buffer, size_t length) {
+    this->meshes.clear();
+    this->meshIndices.clear();
+
+    const char* curr = buffer;
+    const char* end  = buffer + length;
+
+    unsigned int magic, version, numMeshes;
+    if (!ReadUInt32(curr, end, magic) || magic != MeshPack::FILE_MAGIC ||
+        !ReadUInt32(curr, end, version) || version != MeshPack::FILE_VERSION ||
+        !ReadUInt32(curr, end, numMeshes) || numMeshes > length / MIN_NUM_MESH_BYTES) {
+        return false;
+    }
+
+    // Reserving up front avoids copying every mesh read so far whenever the list grows
+    this->meshes.reserve(numMeshes);
+    for (unsigned int i = 0; i < numMeshes; i++) {
+        // Read straight into the pack so that the geometry arrays are never copied
+        this->meshes.push_back(CompiledMesh());
+        CompiledMesh& mesh = this->meshes.back();
+        unsigned int numGroups;
+        if (!ReadString(curr, end, mesh.objFilepath) || !ReadString(curr, end, mesh.mtlFilepath) ||
+            !ReadUInt32(curr, end, mesh.objFileSize) || !ReadUInt32(curr, end, mesh.objFileHash) ||
+            !ReadUInt32(curr, end, numGroups) || numGroups > static_cast<size_t>(end - curr) / MIN_NUM_GROUP_BYTES) {
+            return false;
+        }
+
+        mesh.materialGeometry.resize(numGroups);
+        for (unsigned int j = 0; j < numGroups; j++) {
+            CompiledMesh::MaterialGeometry& geometry = mesh.materialGeometry[j];
+            unsigned int polyType, numVertices, numIndices;
+            if (!ReadString(curr, end, geometry.materialName) || !ReadUInt32(curr, end, polyType) ||
+                !ReadUInt32(curr, end, numVertices) || !ReadUInt32(curr, end, numIndices) ||
+                numVertices > MAX_NUM_GROUP_VERTICES || numIndices > MAX_NUM_GROUP_INDICES) {
+                return false;
+            }
+            geometry.polyType = static_cast<GLenum>(polyType);
+
+            if (!ReadArray(curr, end, numVertices * CompiledMesh::FLOATS_PER_VERTEX, geometry.vertices) ||
+                !ReadArray(curr, end, numIndices, geometry.indices)) {
+                return false;
+            }
+            for (size_t k = 0; k < geometry.indices.size(); k++) {
+                if (geometry.indices[k] >= numVertices) {
+                    return false;
+                }
+            }
+        }
+
+        if (!this->meshIndices.insert(std::make_pair(mesh.objFilepath, this->meshes.size() - 1)).second) {
+            this->meshes.pop_back();
+        }
+    }
+
+    return (curr == end);
+}
+
+bool MeshPack::WriteToFile(const std::string& filepath) const {
+    std::ofstream outFile(filepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!outFile.is_open()) {
+        debug_output("ERROR: Could not open mesh pack file for writing: " << filepath);
+        return false;
+    }
+
+    WriteUInt32(outFile, MeshPack::FILE_MAGIC);
+    WriteUInt32(outFile, MeshPack::FILE_VERSION);
+    WriteUInt32(outFile, static_cast<unsigned int>(this->meshes.size()));
+
+    for (std::vector<CompiledMesh>::const_iterator iter = this->meshes.begin(); iter != this->meshes.end(); ++iter) {
+        const CompiledMesh& mesh = *iter;
+        WriteString(outFile, mesh.objFilepath);
+        WriteString(outFile, mesh.mtlFilepath);
+        WriteUInt32(outFile, mesh.objFileSize);
+        WriteUInt32(outFile, mesh.objFileHash);
+        WriteUInt32(outFile, static_cast<unsigned int>(mesh.materialGeometry.size()));
+
+        for (size_t i = 0; i < mesh.materialGeometry.size(); i++) {
+            const CompiledMesh::MaterialGeometry& geometry = mesh.materialGeometry[i];
+            WriteString(outFile, geometry.materialName);
+            WriteUInt32(outFile, static_cast<unsigned int>(geometry.polyType));
+            WriteUInt32(outFile, static_cast<unsigned int>(geometry.GetNumVertices()));
+            WriteUInt32(outFile, static_cast<unsigned int>(geometry.indices.size()));
+            WriteArray(outFile, geometry.vertices);
+            WriteArray(outFile, geometry.indices);
+        }
+    }
+
+    bool success = outFile.good();
+    outFile.close();
+    return success;
+}
+
+void MeshPack::AddMesh(const CompiledMesh& mesh) {
+    std::pair<std::map<std::string, size_t>::iterator, bool> insertResult = 
+        this->meshIndices.insert(std::make_pair(mesh.objFilepath, this->meshes.size()));
+    if (insertResult.second) {
+        this->meshes.push_back(mesh);
+    }
+}
+
+const CompiledMesh* MeshPack::GetMesh(const std::string& objFilepath) const {
+    std::map<std::string, size_t>::const_iterator findIter = this->meshIndices.find(objFilepath);
+    if (findIter == this->meshIndices.end()) {
+        return NULL;
+    }
+    return &this->meshes[findIter->second];
+}
+
+/**
+ * Same as GetMesh, except that a mesh whose obj file is overridden in the modifications directory (debug only)
+ * or has changed since the pack was built is treated as if it weren't in the pack. The size of the obj file is
+ * always checked, only debug builds (where the resources get edited) read the whole file to check its hash.
+ */
+const CompiledMesh* MeshPack::GetCurrentMesh(const std::string& objFilepath) const {
+    const CompiledMesh* mesh = this->GetMesh(objFilepath);
+    if (mesh == NULL || ResourceManager::IsFilepathOverriddenByMod(objFilepath)) {
+        return NULL;
+    }
+
+    PHYSFS_File* fileHandle = PHYSFS_openRead(objFilepath.c_str());
+    if (fileHandle == NULL) {
+        return NULL;
+    }
+    PHYSFS_sint64 fileLength = PHYSFS_fileLength(fileHandle);
+    PHYSFS_close(fileHandle);
+    fileHandle = NULL;
+
+    bool isCurrent = (fileLength == static_cast<PHYSFS_sint64>(mesh->objFileSize));
+#ifdef _DEBUG
+    if (isCurrent) {
+        long length = 0;
+        char* buffer = ResourceManager::ReadFileToMemoryBuffer(objFilepath, length);
+        isCurrent = (buffer != NULL && CompiledMesh::HashObjFile(buffer, static_cast<size_t>(length)) == mesh->objFileHash);
+        delete[] buffer;
+        buffer = NULL;
+    }
+#endif
+
+    if (!isCurrent) {
+        debug_output("Mesh pack is out of date for " << objFilepath << ", loading its obj file instead");
+        return NULL;
+    }
+    return mesh;
+}
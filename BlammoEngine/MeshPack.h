@@ -0,0 +1,107 @@
+/**
+ * MeshPack.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MESHPACK_H__
+#define __MESHPACK_H__
+
+#include "BasicIncludes.h"
+
+struct ObjMeshData;
+
+/**
+ * The compiled geometry of a single .obj mesh. Each material group keeps its own interleaved
+ * vertex array (position, normal, texture coordinate - FLOATS_PER_VERTEX floats per vertex) with
+ * all of the duplicate vertices removed, along with the indices of its polygons into that array.
+ * Groups are kept in the order that the obj file first used their materials. The size and hash of
+ * the obj file it was compiled from are kept so that a mesh can be checked against its source.
+ */
+struct CompiledMesh {
+    static const size_t FLOATS_PER_VERTEX = 8;
+
+    struct MaterialGeometry {
+        std::string materialName;
+        GLenum polyType;
+        std::vector<float> vertices;
+        std::vector<unsigned short> indices;
+
+        MaterialGeometry() : polyType(GL_TRIANGLES) {}
+        size_t GetNumVertices() const { return this->vertices.size() / FLOATS_PER_VERTEX; }
+    };
+
+    std::string objFilepath;
+    std::string mtlFilepath;
+    unsigned int objFileSize;
+    unsigned int objFileHash;
+    std::vector<MaterialGeometry> materialGeometry;
+
+    CompiledMesh() : objFileSize(0), objFileHash(0) {}
+
+    static bool CompileFromObj(const std::string& objFilepath, const char* objFileBuffer, size_t objFileLength,
+        const ObjMeshData& meshData, CompiledMesh& mesh);
+    static unsigned int HashObjFile(const char* objFileBuffer, size_t objFileLength);
+};
+
+/**
+ * A versioned binary file holding the compiled geometry of meshes in the game. It's built offline
+ * from the .obj files (see the HeadlessModelRunner's -compilemeshes option) and is loaded with a
+ * single read, after which meshes are looked up by their .obj file paths. The materials are still
+ * read from the meshes' .mtl files and any mesh missing from the pack is loaded from its .obj file instead,
+ * as is any mesh whose .obj file has changed since the pack was built (see GetCurrentMesh).
+ */
+class MeshPack {
+public:
+    static const char* FILE_EXTENSION;
+    static const unsigned int FILE_MAGIC;
+    static const unsigned int FILE_VERSION;
+
+    MeshPack() {}
+    ~MeshPack() {}
+
+    static MeshPack* LoadFromResource(const std::string& filepath);
+
+    bool ReadFromMemory(const char* buffer, size_t length);
+    bool WriteToFile(const std::string& filepath) const;
+
+    void AddMesh(const CompiledMesh& mesh);
+    const CompiledMesh* GetMesh(const std::string& objFilepath) const;
+    const CompiledMesh* GetCurrentMesh(const std::string& objFilepath) const;
+
+    size_t GetNumMeshes() const { return this->meshes.size(); }
+    const CompiledMesh& GetMeshAt(size_t idx) const { return this->meshes[idx]; }
+
+private:
+    std::vector<CompiledMesh> meshes;
+    std::map<std::string, size_t> meshIndices;
+
+    DISALLOW_COPY_AND_ASSIGN(MeshPack);
+};
+
+#endif // __MESHPACK_H__
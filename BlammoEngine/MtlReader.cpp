@@ -115,6 +115,22 @@ std::map<std::string, CgFxMaterialEffect*> MtlReader::ReadMaterialFile(const std
 	return MtlReader::ReadMaterialFileFromStream(filepath, fileSS);
 }
 
+/**
+ * Read only the paths of the textures used by the materials in the given mtl file stream, this
+ * doesn't create anything so it can be used to find the textures to stream in ahead of time.
+ */
+void MtlReader::ReadTextureFilepathsFromStream(std::istream &inFile, std::vector<std::string>& texturePaths) {
+	std::string currStr;
+	while (inFile >> currStr) {
+		if (currStr == MTL_DIFF_TEXTURE) {
+			std::string texturePath;
+			if (inFile >> texturePath) {
+				texturePaths.push_back(texturePath);
+			}
+		}
+	}
+}
+
 /**
  * Private helper function that does most of the work using a given istream
  * representing the file information.
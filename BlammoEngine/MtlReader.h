@@ -65,6 +65,8 @@ public:
 	static std::map<std::string, CgFxMaterialEffect*> ReadMaterialFileFromStream(const std::string &filepath, std::istream &inFile);
 	static std::map<std::string, CgFxMaterialEffect*> ReadMaterialFile(const std::string &filepath);
 	static std::map<std::string, CgFxMaterialEffect*> ReadMaterialFile(const std::string &filepath, PHYSFS_File* fileHandle);
+
+	static void ReadTextureFilepathsFromStream(std::istream &inFile, std::vector<std::string>& texturePaths);
 	
 };
 
@@ -31,6 +31,7 @@
 
 #include "ObjReader.h"
 #include "Mesh.h"
+#include "MeshPack.h"
 #include "CgFxEffect.h"
 
 #include "../ResourceManager.h"
@@ -103,37 +104,39 @@ Mesh* ObjReader::ReadMesh(const std::string &filepath, PHYSFS_File* fileHandle)
  * Returns: Mesh on successful read, NULL otherwise.
  */
 Mesh* ObjReader::ReadMeshFromStream(const std::string &filepath, std::istream &inFile) {
+	ObjMeshData meshData;
+	if (!ObjReader::ParseMeshFromStream(filepath, inFile, meshData)) {
+		return NULL;
+	}
+	return ObjReader::BuildMesh(filepath, meshData);
+}
+
+/**
+ * Parse the geometry of an obj file from the given input stream. This doesn't touch the
+ * resource manager or the graphics context so it is safe to call from any thread.
+ * Returns: true on a successful parse, false otherwise.
+ */
+bool ObjReader::ParseMeshFromStream(const std::string &filepath, std::istream &inFile, ObjMeshData& meshData) {
 	std::string currStr = "";
 
-	// We first start by finding and reading the material file
-	std::string mtlFilepath = "";
+	// We first start by finding the material file
+	meshData.mtlFilepath = "";
 	while (inFile >> currStr) {
 		if (currStr == OBJ_MTLFILE) {
-			inFile >> mtlFilepath;
+			inFile >> meshData.mtlFilepath;
 			// Add the path to the obj to the path... the mtl file SHOULD be in the same dir
 			size_t pos = filepath.find_last_of("/");
 			if (pos == std::string::npos) {
 				pos = filepath.find_last_of("\\");
 			}
-			mtlFilepath.insert(0, filepath.substr(0, pos+1));
+			meshData.mtlFilepath.insert(0, filepath.substr(0, pos+1));
 			break;
 		}
 	}
-	
-	// Figure out what materials to make and make them
-	std::map<std::string, CgFxMaterialEffect*> meshMaterials;
-	assert(mtlFilepath != "");
-	meshMaterials = ResourceManager::GetInstance()->GetMtlMeshResource(mtlFilepath);
+	assert(meshData.mtlFilepath != "");
 
 	std::string grpName = "";
 	std::string matName = "";
-	
-	std::vector<Point3D> vertices;
-	std::vector<Vector3D> normals;
-	std::vector<Point2D> texCoords;
-	std::map<std::string, MaterialGroup*> matGrps;		// Material groups, mapped by their group name
-	std::map<std::string, PolyGrpIndexer> polyGrps;		// Set of polygons associated with material group names
-
 
 	while (inFile >> currStr) {
 		
@@ -142,7 +145,7 @@ Mesh* ObjReader::ReadMeshFromStream(const std::string &filepath, std::istream &i
 			// up a mesh unto itself
 			if (!(inFile >> grpName)) {
 				debug_output("ERROR: Group name not provided with proper syntax in obj file: " << filepath); 
-				return NULL;
+				return false;
 			}
 		}
 		else if (currStr == OBJ_VERTEX_COORD) {
@@ -150,32 +153,33 @@ Mesh* ObjReader::ReadMeshFromStream(const std::string &filepath, std::istream &i
 			Point3D pt;
 			if (!(inFile >> pt[0] && inFile >> pt[1] && inFile >> pt[2])) {
 				debug_output("ERROR: could not read vertex/point properly from obj file: " << filepath); 
-				return NULL;				
+				return false;				
 			}
-			vertices.push_back(pt);
+			meshData.vertices.push_back(pt);
 		}
 		else if (currStr == OBJ_VERTEX_NORMAL) {
 			// Read in a normal vector
 			Vector3D normal;
 			if (!(inFile >> normal[0] && inFile >> normal[1] && inFile >> normal[2])) {
 				debug_output("ERROR: could not read normal properly from obj file: " << filepath); 
-				return NULL;				
+				return false;				
 			}
-			normals.push_back(normal);
+			meshData.normals.push_back(normal);
 		}
 		else if (currStr == OBJ_VERTEX_TEXCOORD) {
 			// Read in a texture coordinate
 			Point2D texCoord;
 			if (!(inFile >> texCoord[0] && inFile >> texCoord[1])) {
 				debug_output("ERROR: could not read texture coordinate properly from obj file: " << filepath); 
-				return NULL;				
+				return false;				
 			}
-			texCoords.push_back(texCoord);
+			meshData.texCoords.push_back(texCoord);
 		}
 		else if (currStr == OBJ_FACE) {
 			assert(matName != "");
 			char trash;
 
+			PolyGrpIndexer& polyGrp = meshData.polyGrps[matName];
 			for (unsigned int i = 0; i < 3; i++) {
 				unsigned int vertexIndex;
 				unsigned int normalIndex;
@@ -194,9 +198,9 @@ Mesh* ObjReader::ReadMeshFromStream(const std::string &filepath, std::istream &i
 				normalIndex--;
 
 				// Add the indices to their respective lists
-				polyGrps[matName].vertexIndices.push_back(vertexIndex);
-				polyGrps[matName].normalIndices.push_back(normalIndex);
-				polyGrps[matName].texCoordIndices.push_back(texCoordIndex);
+				polyGrp.vertexIndices.push_back(vertexIndex);
+				polyGrp.normalIndices.push_back(normalIndex);
+				polyGrp.texCoordIndices.push_back(texCoordIndex);
 			}
 
 		}
@@ -204,32 +208,56 @@ Mesh* ObjReader::ReadMeshFromStream(const std::string &filepath, std::istream &i
 			// Obtain the material group name
 			if (!(inFile >> matName)) {
 				debug_output("ERROR: Material name not provided with proper syntax in obj file: " << filepath); 
-				return NULL;
+				return false;
 			}
 			
-			// Ensure the material group doesn't already exist (so we don't overwrite it)
-			std::map<std::string, MaterialGroup*>::iterator matGrpCheck = matGrps.find(matName);
-			if (matGrpCheck == matGrps.end()) {
-				// Inline: We are initializing the material for the first time
-
-				// Look up the material name from the list of materials
-				std::map<std::string, CgFxMaterialEffect*>::iterator valIter = meshMaterials.find(matName);
-				if (valIter == meshMaterials.end()) {
-					// Not good: the material was not found...
-					debug_output("ERROR: Material name in obj file with no matching material in mtl file: " << filepath); 
-					return NULL;
-				}
-
-				matGrps[matName] = new MaterialGroup(valIter->second);
+			// Remember the material group the first time it's used (so we don't make it twice)
+			if (std::find(meshData.materialNames.begin(), meshData.materialNames.end(), matName) == meshData.materialNames.end()) {
+				meshData.materialNames.push_back(matName);
 			}
 		}
 	}
 
-	// Go through all the polygon groups and set the material groups
-	std::map<std::string, PolyGrpIndexer>::iterator polyGrpIter;
-	for (polyGrpIter = polyGrps.begin(); polyGrpIter != polyGrps.end(); ++polyGrpIter) {
-		MaterialGroup* currMatGrp = matGrps[polyGrpIter->first];
-		currMatGrp->AddFaces(polyGrpIter->second, vertices, normals, texCoords);
+	return true;
+}
+
+/**
+ * Creates a material group for each of the given material names from the materials in the
+ * given mtl file, any materials in the mtl file that the mesh doesn't use are released.
+ * Returns: true on success, false if any of the material names isn't in the mtl file.
+ */
+static bool BuildMaterialGroups(const std::string &filepath, const std::string &mtlFilepath,
+                                const std::vector<std::string>& materialNames,
+                                std::map<std::string, MaterialGroup*>& matGrps) {
+
+	// Figure out what materials to make and make them
+	std::map<std::string, CgFxMaterialEffect*> meshMaterials;
+	assert(mtlFilepath != "");
+	meshMaterials = ResourceManager::GetInstance()->GetMtlMeshResource(mtlFilepath);
+
+	bool success = true;
+	for (std::vector<std::string>::const_iterator iter = materialNames.begin(); iter != materialNames.end(); ++iter) {
+		const std::string& matName = *iter;
+
+		// Look up the material name from the list of materials
+		std::map<std::string, CgFxMaterialEffect*>::iterator valIter = meshMaterials.find(matName);
+		if (valIter == meshMaterials.end()) {
+			// Not good: the material was not found...
+			debug_output("ERROR: Material name in obj file with no matching material in mtl file: " << filepath); 
+			success = false;
+			break;
+		}
+
+		matGrps[matName] = new MaterialGroup(valIter->second);
+	}
+
+	if (!success) {
+		// The material groups own their materials, so only the ones without a group are deleted below
+		for (std::map<std::string, MaterialGroup*>::iterator iter = matGrps.begin(); iter != matGrps.end(); ++iter) {
+			meshMaterials.erase(iter->first);
+			delete iter->second;
+		}
+		matGrps.clear();
 	}
 
     // Check to see what materials are in the matGrps, if not all of the materials were used from the MTL file then we release the
@@ -244,6 +272,59 @@ Mesh* ObjReader::ReadMeshFromStream(const std::string &filepath, std::istream &i
         }
     }
 
+	return success;
+}
+
+/**
+ * Build a mesh from obj data that was already parsed, this creates the materials (loading
+ * the mtl file through the resource manager) and display lists so it must be called on the
+ * thread with the graphics context.
+ * Returns: Mesh on success, NULL otherwise.
+ */
+Mesh* ObjReader::BuildMesh(const std::string &filepath, const ObjMeshData& meshData) {
+	std::map<std::string, MaterialGroup*> matGrps;		// Material groups, mapped by their group name
+	if (!BuildMaterialGroups(filepath, meshData.mtlFilepath, meshData.materialNames, matGrps)) {
+		return NULL;
+	}
+
+	// Go through all the polygon groups and set the material groups
+	std::map<std::string, PolyGrpIndexer>::const_iterator polyGrpIter;
+	for (polyGrpIter = meshData.polyGrps.begin(); polyGrpIter != meshData.polyGrps.end(); ++polyGrpIter) {
+		MaterialGroup* currMatGrp = matGrps[polyGrpIter->first];
+		currMatGrp->AddFaces(polyGrpIter->second, meshData.vertices, meshData.normals, meshData.texCoords);
+	}
+
+	return new Mesh(filepath, matGrps);
+}
+
+/**
+ * Build a mesh from its compiled geometry in a mesh pack, the materials are still created from
+ * the mesh's mtl file. Like the obj version this must be called on the thread with the graphics context.
+ * Returns: Mesh on success, NULL otherwise.
+ */
+Mesh* ObjReader::BuildMesh(const std::string &filepath, const CompiledMesh& compiledMesh) {
+	std::vector<std::string> materialNames;
+	materialNames.reserve(compiledMesh.materialGeometry.size());
+	for (size_t i = 0; i < compiledMesh.materialGeometry.size(); i++) {
+		materialNames.push_back(compiledMesh.materialGeometry[i].materialName);
+	}
+
+	std::map<std::string, MaterialGroup*> matGrps;		// Material groups, mapped by their group name
+	if (!BuildMaterialGroups(filepath, compiledMesh.mtlFilepath, materialNames, matGrps)) {
+		return NULL;
+	}
+
+	for (size_t i = 0; i < compiledMesh.materialGeometry.size(); i++) {
+		const CompiledMesh::MaterialGeometry& geometry = compiledMesh.materialGeometry[i];
+		if (geometry.indices.empty()) {
+			continue;
+		}
+
+		MaterialGroup* currMatGrp = matGrps[geometry.materialName];
+		currMatGrp->SetPolygonGroup(new PolygonGroup(geometry.polyType, &geometry.vertices[0], geometry.GetNumVertices(),
+			&geometry.indices[0], geometry.indices.size()));
+		currMatGrp->ResetDisplayList();
+	}
 
 	return new Mesh(filepath, matGrps);
 }
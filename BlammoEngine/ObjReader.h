@@ -33,9 +33,24 @@
 #define __OBJREADER_H__
 
 #include "BasicIncludes.h"
+#include "Mesh.h"
 
-class Mesh;
-class PolygonGroup;
+struct CompiledMesh;
+
+/**
+ * Everything read out of an obj file before any materials, effects or display lists are made
+ * for it - this can be parsed on any thread, the mesh is then built from it on the render thread.
+ */
+struct ObjMeshData {
+	std::string mtlFilepath;
+
+	std::vector<Point3D> vertices;
+	std::vector<Vector3D> normals;
+	std::vector<Point2D> texCoords;
+
+	std::vector<std::string> materialNames;            // Material groups in the order that they're first used
+	std::map<std::string, PolyGrpIndexer> polyGrps;    // Set of polygons associated with material group names
+};
 
 class ObjReader {
 
@@ -56,6 +71,9 @@ private:
 
 public:
 	static Mesh* ReadMeshFromStream(const std::string &filepath, std::istream &inFile);
+	static bool ParseMeshFromStream(const std::string &filepath, std::istream &inFile, ObjMeshData& meshData);
+	static Mesh* BuildMesh(const std::string &filepath, const ObjMeshData& meshData);
+	static Mesh* BuildMesh(const std::string &filepath, const CompiledMesh& compiledMesh);
 	static Mesh* ReadMesh(const std::string &filepath);
 	static Mesh* ReadMesh(const std::string &filepath, PHYSFS_File* fileHandle);
 
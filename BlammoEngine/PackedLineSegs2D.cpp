@@ -0,0 +1,348 @@
+/**
+ * PackedLineSegs2D.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "PackedLineSegs2D.h"
+
+void PackedLineSegs2D::Reserve(size_t numLines) {
+    const size_t oldCapacity = this->GetCapacity();
+    if (numLines <= oldCapacity) {
+        return;
+    }
+
+    // Every component array moves when the capacity changes, so copy them over one at a time
+    std::vector<float> newValues(NUM_COMPONENTS * numLines, 0.0f);
+    for (int c = 0; c < NUM_COMPONENTS; c++) {
+        std::copy(this->values.begin() + c * oldCapacity, this->values.begin() + c * oldCapacity + this->numLines,
+            newValues.begin() + c * numLines);
+    }
+    this->values.swap(newValues);
+}
+
+void PackedLineSegs2D::Erase(size_t idx) {
+    assert(idx < this->numLines);
+    for (int c = 0; c < NUM_COMPONENTS; c++) {
+        float* component = this->GetComponent(static_cast<Component>(c));
+        std::copy(component + idx + 1, component + this->numLines, component + idx);
+    }
+    this->numLines--;
+}
+
+void PackedLineSegs2D::Set(const std::vector<Collision::LineSeg2D>& lines, const std::vector<Vector2D>& normals) {
+    assert(lines.size() == normals.size());
+    this->Reserve(lines.size());
+    this->numLines = lines.size();
+    for (size_t i = 0; i < lines.size(); i++) {
+        this->SetLine(i, lines[i], normals[i]);
+    }
+}
+
+// Same as Point2D::SqDistance(Collision::ClosestPoint(pt, line), pt)
+float PackedLineSegs2D::SqrDistToLine(size_t idx, const Point2D& pt) const {
+    const float dirX = this->x1()[idx] - this->x0()[idx];
+    const float dirY = this->y1()[idx] - this->y0()[idx];
+    float t = ((pt[0] - this->x0()[idx]) * dirX + (pt[1] - this->y0()[idx]) * dirY) / (dirX * dirX + dirY * dirY);
+    if (t < 0.0f) {
+        t = 0.0f;
+    }
+    else if (t > 1.0f) {
+        t = 1.0f;
+    }
+    const float diffX = (this->x0()[idx] + t * dirX) - pt[0];
+    const float diffY = (this->y0()[idx] + t * dirY) - pt[1];
+    return diffX * diffX + diffY * diffY;
+}
+
+// Same as Collision::IsCollision(ray, line, rayT)
+bool PackedLineSegs2D::RayHitsLine(size_t idx, const Collision::Ray2D& ray, float& rayT) const {
+    const Vector2D& d0 = ray.GetUnitDirection();
+    const float d1X = this->x1()[idx] - this->x0()[idx];
+    const float d1Y = this->y1()[idx] - this->y0()[idx];
+
+    const float dotPerpD1D0 = d1Y * d0[0] + (-d1X) * d0[1];
+    if (fabs(dotPerpD1D0) < EPSILON) {
+        return false;
+    }
+
+    const float pX = this->x0()[idx] - ray.GetOrigin()[0];
+    const float pY = this->y0()[idx] - ray.GetOrigin()[1];
+    rayT = (d1Y * pX + (-d1X) * pY) / dotPerpD1D0;
+    const float lineT = (d0[1] * pX + (-d0[0]) * pY) / dotPerpD1D0;
+
+    return (rayT >= 0 && lineT >= -EPSILON && lineT <= (1+EPSILON));
+}
+
+// Half-plane test used by BoundingLines::IsInside
+bool PackedLineSegs2D::IsBehindLine(size_t idx, const Point2D& pt) const {
+    float diffX = pt[0] - this->x0()[idx];
+    float diffY = pt[1] - this->y0()[idx];
+    if (fabs(diffX) < EPSILON && fabs(diffY) < EPSILON) {
+        diffX = pt[0] - this->x1()[idx];
+        diffY = pt[1] - this->y1()[idx];
+    }
+    return !((diffX * this->nx()[idx] + diffY * this->ny()[idx]) >= 0.0f);
+}
+
+#ifdef BLAMMO_SIMD_SSE
+
+static inline __m128 NegatePS(__m128 v) {
+    return _mm_xor_ps(v, _mm_set1_ps(-0.0f));
+}
+
+static inline __m128 AbsPS(__m128 v) {
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+}
+
+// SqrDistToLine for the four lines starting at firstIdx
+__m128 PackedLineSegs2D::SqrDistToLines(size_t firstIdx, const Point2D& pt) const {
+    const __m128 ptX = _mm_set1_ps(pt[0]);
+    const __m128 ptY = _mm_set1_ps(pt[1]);
+    const __m128 lx0 = _mm_loadu_ps(&this->x0()[firstIdx]);
+    const __m128 ly0 = _mm_loadu_ps(&this->y0()[firstIdx]);
+    const __m128 dirX = _mm_sub_ps(_mm_loadu_ps(&this->x1()[firstIdx]), lx0);
+    const __m128 dirY = _mm_sub_ps(_mm_loadu_ps(&this->y1()[firstIdx]), ly0);
+
+    __m128 t = _mm_div_ps(
+        _mm_add_ps(_mm_mul_ps(_mm_sub_ps(ptX, lx0), dirX), _mm_mul_ps(_mm_sub_ps(ptY, ly0), dirY)),
+        _mm_add_ps(_mm_mul_ps(dirX, dirX), _mm_mul_ps(dirY, dirY)));
+    
+    // Clamp to [0,1], the operand order keeps NaNs from degenerate lines the same as the scalar version
+    t = _mm_min_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_setzero_ps(), t));
+
+    const __m128 diffX = _mm_sub_ps(_mm_add_ps(lx0, _mm_mul_ps(t, dirX)), ptX);
+    const __m128 diffY = _mm_sub_ps(_mm_add_ps(ly0, _mm_mul_ps(t, dirY)), ptY);
+    return _mm_add_ps(_mm_mul_ps(diffX, diffX), _mm_mul_ps(diffY, diffY));
+}
+
+// RayHitsLine for the four lines starting at firstIdx, returns the hit mask
+__m128 PackedLineSegs2D::RayHitsLines(size_t firstIdx, const Collision::Ray2D& ray, __m128& rayT) const {
+    const __m128 d0X = _mm_set1_ps(ray.GetUnitDirection()[0]);
+    const __m128 d0Y = _mm_set1_ps(ray.GetUnitDirection()[1]);
+    const __m128 lx0 = _mm_loadu_ps(&this->x0()[firstIdx]);
+    const __m128 ly0 = _mm_loadu_ps(&this->y0()[firstIdx]);
+    const __m128 d1X = _mm_sub_ps(_mm_loadu_ps(&this->x1()[firstIdx]), lx0);
+    const __m128 d1Y = _mm_sub_ps(_mm_loadu_ps(&this->y1()[firstIdx]), ly0);
+    const __m128 negD1X = NegatePS(d1X);
+
+    const __m128 dotPerpD1D0 = _mm_add_ps(_mm_mul_ps(d1Y, d0X), _mm_mul_ps(negD1X, d0Y));
+    const __m128 notParallel = _mm_cmpge_ps(AbsPS(dotPerpD1D0), _mm_set1_ps(EPSILON));
+
+    const __m128 pX = _mm_sub_ps(lx0, _mm_set1_ps(ray.GetOrigin()[0]));
+    const __m128 pY = _mm_sub_ps(ly0, _mm_set1_ps(ray.GetOrigin()[1]));
+    rayT = _mm_div_ps(_mm_add_ps(_mm_mul_ps(d1Y, pX), _mm_mul_ps(negD1X, pY)), dotPerpD1D0);
+    const __m128 lineT = _mm_div_ps(_mm_add_ps(_mm_mul_ps(d0Y, pX), _mm_mul_ps(NegatePS(d0X), pY)), dotPerpD1D0);
+
+    __m128 hit = _mm_and_ps(notParallel, _mm_cmpge_ps(rayT, _mm_setzero_ps()));
+    hit = _mm_and_ps(hit, _mm_cmpge_ps(lineT, _mm_set1_ps(-EPSILON)));
+    return _mm_and_ps(hit, _mm_cmple_ps(lineT, _mm_set1_ps(1+EPSILON)));
+}
+
+#endif
+
+unsigned int PackedLineSegs2D::GetAABBOverlapMask(size_t firstIdx, const Collision::AABB2D& aabb) const {
+    assert(firstIdx < this->GetNumLines());
+    const float minX = aabb.GetMin()[0];
+    const float minY = aabb.GetMin()[1];
+    const float maxX = aabb.GetMax()[0];
+    const float maxY = aabb.GetMax()[1];
+
+#ifdef BLAMMO_SIMD_SSE
+    if (firstIdx + 4 <= this->GetNumLines()) {
+        const __m128 lx0 = _mm_loadu_ps(&this->x0()[firstIdx]);
+        const __m128 ly0 = _mm_loadu_ps(&this->y0()[firstIdx]);
+        const __m128 lx1 = _mm_loadu_ps(&this->x1()[firstIdx]);
+        const __m128 ly1 = _mm_loadu_ps(&this->y1()[firstIdx]);
+
+        __m128 overlap = _mm_cmple_ps(_mm_min_ps(lx0, lx1), _mm_set1_ps(maxX));
+        overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_max_ps(lx0, lx1), _mm_set1_ps(minX)));
+        overlap = _mm_and_ps(overlap, _mm_cmple_ps(_mm_min_ps(ly0, ly1), _mm_set1_ps(maxY)));
+        overlap = _mm_and_ps(overlap, _mm_cmpge_ps(_mm_max_ps(ly0, ly1), _mm_set1_ps(minY)));
+        return static_cast<unsigned int>(_mm_movemask_ps(overlap));
+    }
+#endif
+
+    unsigned int mask = 0;
+    const size_t endIdx = std::min<size_t>(firstIdx + 4, this->GetNumLines());
+    for (size_t i = firstIdx; i < endIdx; i++) {
+        if (std::min<float>(this->x0()[i], this->x1()[i]) <= maxX && std::max<float>(this->x0()[i], this->x1()[i]) >= minX &&
+            std::min<float>(this->y0()[i], this->y1()[i]) <= maxY && std::max<float>(this->y0()[i], this->y1()[i]) >= minY) {
+            mask |= (1 << (i - firstIdx));
+        }
+    }
+    return mask;
+}
+
+/**
+ * Finds the first line whose closest point to the given point is within the given squared distance.
+ * Returns: The index of that line (with its squared distance in sqrDist) or -1 if there isn't one
+ * (sqrDist is then the squared distance to the last line, if there are any lines).
+ */
+int PackedLineSegs2D::FindFirstWithinSqrDist(const Point2D& pt, float maxSqrDist, float& sqrDist) const {
+    const size_t numLines = this->GetNumLines();
+    size_t i = 0;
+
+#ifdef BLAMMO_SIMD_SSE
+    const __m128 maxSqrDist4 = _mm_set1_ps(maxSqrDist);
+    for (; i + 4 <= numLines; i += 4) {
+        const __m128 sqrDists = this->SqrDistToLines(i, pt);
+        const int mask = _mm_movemask_ps(_mm_cmple_ps(sqrDists, maxSqrDist4));
+        if (mask != 0) {
+            float sqrDistValues[4];
+            _mm_storeu_ps(sqrDistValues, sqrDists);
+            for (int k = 0; k < 4; k++) {
+                if (mask & (1 << k)) {
+                    sqrDist = sqrDistValues[k];
+                    return static_cast<int>(i) + k;
+                }
+            }
+        }
+    }
+#endif
+
+    for (; i < numLines; i++) {
+        sqrDist = this->SqrDistToLine(i, pt);
+        if (sqrDist <= maxSqrDist) {
+            return static_cast<int>(i);
+        }
+    }
+
+    if (numLines > 0) {
+        sqrDist = this->SqrDistToLine(numLines - 1, pt);
+    }
+    return -1;
+}
+
+/**
+ * Finds the first line that the given ray hits.
+ * Returns: The index of that line or -1 if the ray doesn't hit any of them.
+ */
+int PackedLineSegs2D::FindFirstRayHit(const Collision::Ray2D& ray) const {
+    const size_t numLines = this->GetNumLines();
+    size_t i = 0;
+
+#ifdef BLAMMO_SIMD_SSE
+    __m128 rayTs;
+    for (; i + 4 <= numLines; i += 4) {
+        const int mask = _mm_movemask_ps(this->RayHitsLines(i, ray, rayTs));
+        if (mask != 0) {
+            for (int k = 0; k < 4; k++) {
+                if (mask & (1 << k)) {
+                    return static_cast<int>(i) + k;
+                }
+            }
+        }
+    }
+#endif
+
+    float rayT;
+    for (; i < numLines; i++) {
+        if (this->RayHitsLine(i, ray, rayT)) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+/**
+ * Casts the given ray against all the lines.
+ * Returns: true if any line was hit, with the smallest ray parameter of all the hits in minRayT.
+ */
+bool PackedLineSegs2D::RayCast(const Collision::Ray2D& ray, float& minRayT) const {
+    const size_t numLines = this->GetNumLines();
+    bool collisionFound = false;
+    size_t i = 0;
+
+#ifdef BLAMMO_SIMD_SSE
+    __m128 rayTs;
+    __m128 minRayTs = _mm_set1_ps(minRayT);
+    for (; i + 4 <= numLines; i += 4) {
+        const __m128 hits = this->RayHitsLines(i, ray, rayTs);
+        minRayTs = _mm_min_ps(minRayTs, _mm_or_ps(_mm_and_ps(hits, rayTs), _mm_andnot_ps(hits, minRayTs)));
+        collisionFound |= (_mm_movemask_ps(hits) != 0);
+    }
+    float minRayTValues[4];
+    _mm_storeu_ps(minRayTValues, minRayTs);
+    for (int k = 0; k < 4; k++) {
+        if (minRayTValues[k] < minRayT) {
+            minRayT = minRayTValues[k];
+        }
+    }
+#endif
+
+    float rayT;
+    for (; i < numLines; i++) {
+        if (this->RayHitsLine(i, ray, rayT)) {
+            collisionFound = true;
+            if (rayT < minRayT) {
+                minRayT = rayT;
+            }
+        }
+    }
+    return collisionFound;
+}
+
+/**
+ * Half-plane test of the given point against every line.
+ * Returns: true if the point is behind (opposite the normal of) every line.
+ */
+bool PackedLineSegs2D::IsBehindAllLines(const Point2D& pt) const {
+    const size_t numLines = this->GetNumLines();
+    size_t i = 0;
+
+#ifdef BLAMMO_SIMD_SSE
+    const __m128 ptX = _mm_set1_ps(pt[0]);
+    const __m128 ptY = _mm_set1_ps(pt[1]);
+    const __m128 epsilon = _mm_set1_ps(EPSILON);
+    for (; i + 4 <= numLines; i += 4) {
+        const __m128 diff0X = _mm_sub_ps(ptX, _mm_loadu_ps(&this->x0()[i]));
+        const __m128 diff0Y = _mm_sub_ps(ptY, _mm_loadu_ps(&this->y0()[i]));
+        const __m128 diff1X = _mm_sub_ps(ptX, _mm_loadu_ps(&this->x1()[i]));
+        const __m128 diff1Y = _mm_sub_ps(ptY, _mm_loadu_ps(&this->y1()[i]));
+
+        // Use the second end point wherever the point sits on the first one
+        const __m128 onP1 = _mm_and_ps(_mm_cmplt_ps(AbsPS(diff0X), epsilon), _mm_cmplt_ps(AbsPS(diff0Y), epsilon));
+        const __m128 diffX = _mm_or_ps(_mm_and_ps(onP1, diff1X), _mm_andnot_ps(onP1, diff0X));
+        const __m128 diffY = _mm_or_ps(_mm_and_ps(onP1, diff1Y), _mm_andnot_ps(onP1, diff0Y));
+
+        const __m128 dots = _mm_add_ps(_mm_mul_ps(diffX, _mm_loadu_ps(&this->nx()[i])), 
+            _mm_mul_ps(diffY, _mm_loadu_ps(&this->ny()[i])));
+        if (_mm_movemask_ps(_mm_cmpge_ps(dots, _mm_setzero_ps())) != 0) {
+            return false;
+        }
+    }
+#endif
+
+    for (; i < numLines; i++) {
+        if (!this->IsBehindLine(i, pt)) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,125 @@
+/**
+ * PackedLineSegs2D.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __PACKEDLINESEGS2D_H__
+#define __PACKEDLINESEGS2D_H__
+
+#include "BasicIncludes.h"
+#include "BatchMath.h"
+#include "Collision.h"
+
+/**
+ * Structure-of-arrays copy of a set of 2D line segments and their normals (separate x0, y0, x1, y1,
+ * nx and ny arrays) with collision kernels that test four segments at a time. Each kernel gives
+ * exactly the same results as running the matching Collision function over the segments in order.
+ * All six arrays live back to back in a single buffer so a copy only costs one allocation.
+ */
+class PackedLineSegs2D {
+public:
+    PackedLineSegs2D() : numLines(0) {}
+    ~PackedLineSegs2D() {}
+
+    size_t GetNumLines() const { return this->numLines; }
+
+    void Clear();
+    void Reserve(size_t numLines);
+    void Push(const Collision::LineSeg2D& line, const Vector2D& normal);
+    void PopLast();
+    void Erase(size_t idx);
+    void Set(const std::vector<Collision::LineSeg2D>& lines, const std::vector<Vector2D>& normals);
+    void SetLine(size_t idx, const Collision::LineSeg2D& line, const Vector2D& normal);
+
+    // Bit k is set if the bounding box of line firstIdx+k overlaps the given box, for up to 4 lines
+    unsigned int GetAABBOverlapMask(size_t firstIdx, const Collision::AABB2D& aabb) const;
+
+    int FindFirstWithinSqrDist(const Point2D& pt, float maxSqrDist, float& sqrDist) const;
+    int FindFirstRayHit(const Collision::Ray2D& ray) const;
+    bool RayCast(const Collision::Ray2D& ray, float& minRayT) const;
+    bool IsBehindAllLines(const Point2D& pt) const;
+
+private:
+    enum Component { X0 = 0, Y0, X1, Y1, NX, NY, NUM_COMPONENTS };
+
+    // Holds NUM_COMPONENTS arrays of GetCapacity() floats each, in Component order
+    std::vector<float> values;
+    size_t numLines;
+
+    size_t GetCapacity() const { return this->values.size() / NUM_COMPONENTS; }
+    float* GetComponent(Component c) { return &this->values[c * this->GetCapacity()]; }
+    const float* GetComponent(Component c) const { return &this->values[c * this->GetCapacity()]; }
+
+    const float* x0() const { return this->GetComponent(X0); }
+    const float* y0() const { return this->GetComponent(Y0); }
+    const float* x1() const { return this->GetComponent(X1); }
+    const float* y1() const { return this->GetComponent(Y1); }
+    const float* nx() const { return this->GetComponent(NX); }
+    const float* ny() const { return this->GetComponent(NY); }
+
+    float SqrDistToLine(size_t idx, const Point2D& pt) const;
+    bool RayHitsLine(size_t idx, const Collision::Ray2D& ray, float& rayT) const;
+    bool IsBehindLine(size_t idx, const Point2D& pt) const;
+
+#ifdef BLAMMO_SIMD_SSE
+    __m128 SqrDistToLines(size_t firstIdx, const Point2D& pt) const;
+    __m128 RayHitsLines(size_t firstIdx, const Collision::Ray2D& ray, __m128& rayT) const;
+#endif
+};
+
+inline void PackedLineSegs2D::Clear() {
+    this->numLines = 0;
+}
+
+inline void PackedLineSegs2D::Push(const Collision::LineSeg2D& line, const Vector2D& normal) {
+    if (this->numLines == this->GetCapacity()) {
+        this->Reserve(this->numLines < 4 ? 4 : 2 * this->numLines);
+    }
+    this->numLines++;
+    this->SetLine(this->numLines - 1, line, normal);
+}
+
+inline void PackedLineSegs2D::PopLast() {
+    assert(this->numLines > 0);
+    this->numLines--;
+}
+
+inline void PackedLineSegs2D::SetLine(size_t idx, const Collision::LineSeg2D& line, const Vector2D& normal) {
+    assert(idx < this->numLines);
+    const size_t capacity = this->GetCapacity();
+    float* lineValues = &this->values[idx];
+    lineValues[X0 * capacity] = line.P1()[0];
+    lineValues[Y0 * capacity] = line.P1()[1];
+    lineValues[X1 * capacity] = line.P2()[0];
+    lineValues[Y1 * capacity] = line.P2()[1];
+    lineValues[NX * capacity] = normal[0];
+    lineValues[NY * capacity] = normal[1];
+}
+
+#endif // __PACKEDLINESEGS2D_H__
@@ -0,0 +1,261 @@
+/**
+ * RenderCommandQueue.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "RenderCommandQueue.h"
+#include "CgFxEffect.h"
+#include "StaticGeometryBatch.h"
+#include "Camera.h"
+
+// Layout of the 64-bit sort key, from most to least significant:
+// pass (8 bits) | effect (16 bits) | texture (16 bits) | depth (24 bits)
+static const int PASS_SHIFT    = 56;
+static const int EFFECT_SHIFT  = 40;
+static const int TEXTURE_SHIFT = 24;
+static const unsigned long long DEPTH_MASK   = 0xFFFFFFULL;
+static const unsigned long long TEXTURE_MASK = 0xFFFFULL;
+
+const float RenderCommandQueue::MAX_SORT_DEPTH = 1000.0f;
+
+// Returns true if the given 16 floats are the same as the last applied ones (which may be NULL)
+static bool IsSameMatrix(const float* lastMatrix, const float* matrix) {
+    return lastMatrix != NULL && memcmp(lastMatrix, matrix, sizeof(float) * 16) == 0;
+}
+static bool IsSameColour(const float* lastColour, const float* colour) {
+    return lastColour != NULL && memcmp(lastColour, colour, sizeof(float) * 4) == 0;
+}
+
+void CgFxRenderBackend::BeginExecution() {
+    // The commands carry their own modelview and colour, make sure we don't trample the caller's
+    glPushAttrib(GL_CURRENT_BIT);
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+}
+
+void CgFxRenderBackend::EndExecution() {
+    assert(this->currPass == NULL);
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+    glPopAttrib();
+}
+
+void CgFxRenderBackend::SetTransform(const float* modelViewMatrix) {
+    glLoadMatrixf(modelViewMatrix);
+}
+
+void CgFxRenderBackend::SetColour(const float* colour) {
+    glColor4fv(colour);
+}
+
+void CgFxRenderBackend::BindEffect(CgFxEffectBase* effect, const Camera& camera) {
+    assert(effect != NULL);
+    effect->BeginQueuedDraws(camera);
+}
+
+void CgFxRenderBackend::UpdateEffectTransforms(CgFxEffectBase* effect, const Camera& camera) {
+    effect->UpdateQueuedDrawTransforms(camera);
+    // Parameters changed in the middle of a pass have to be pushed to the pass' programs
+    if (this->currPass != NULL) {
+        cgUpdatePassParameters(this->currPass);
+    }
+}
+
+bool CgFxRenderBackend::BeginPass(CgFxEffectBase* effect, int passIdx) {
+    assert(this->currPass == NULL || passIdx > 0);
+    CGpass pass = NULL;
+    if (passIdx == 0) {
+        pass = cgGetFirstPass(effect->GetCurrentTechnique());
+    }
+    else {
+        assert(this->lastPass != NULL);
+        pass = cgGetNextPass(this->lastPass);
+    }
+    this->lastPass = pass;
+    if (pass == NULL) {
+        return false;
+    }
+
+    cgSetPassState(pass);
+    this->currPass = pass;
+    return true;
+}
+
+void CgFxRenderBackend::EndPass() {
+    assert(this->currPass != NULL);
+    cgResetPassState(this->currPass);
+    this->currPass = NULL;
+}
+
+void CgFxRenderBackend::DrawGeometry(const RenderCommand& cmd) {
+    if (cmd.batch != NULL) {
+        cmd.batch->Draw();
+    }
+    else {
+        assert(cmd.displayListID != 0);
+        glCallList(cmd.displayListID);
+    }
+}
+
+RenderCommandQueue::RenderCommandQueue() : sortingEnabled(true) {
+}
+
+/**
+ * Build the sort key for a command. The depth is the distance in front of the camera,
+ * anything past MAX_SORT_DEPTH just sorts as the furthest depth.
+ */
+unsigned long long RenderCommandQueue::BuildSortKey(unsigned char pass, unsigned short effectID,
+                                                    GLuint textureID, float depth) {
+
+    depth = std::max<float>(0.0f, std::min<float>(MAX_SORT_DEPTH, depth));
+    unsigned long long quantizedDepth = static_cast<unsigned long long>((depth / MAX_SORT_DEPTH) * static_cast<float>(DEPTH_MASK));
+
+    return (static_cast<unsigned long long>(pass) << PASS_SHIFT) |
+        (static_cast<unsigned long long>(effectID) << EFFECT_SHIFT) |
+        ((static_cast<unsigned long long>(textureID) & TEXTURE_MASK) << TEXTURE_SHIFT) |
+        (quantizedDepth & DEPTH_MASK);
+}
+
+unsigned short RenderCommandQueue::GetEffectID(const CgFxEffectBase* effect) {
+    std::map<const CgFxEffectBase*, unsigned short>::const_iterator findIter = this->effectIDs.find(effect);
+    if (findIter != this->effectIDs.end()) {
+        return findIter->second;
+    }
+
+    // If we ever run out of ids the effects still draw correctly, they just stop being grouped
+    assert(this->effectIDs.size() < 0xFFFF);
+    unsigned short newID = static_cast<unsigned short>(std::min<size_t>(this->effectIDs.size(), 0xFFFF));
+    this->effectIDs.insert(std::make_pair(effect, newID));
+    return newID;
+}
+
+RenderCommand& RenderCommandQueue::AddCommand(unsigned char pass, CgFxEffectBase* effect, GLuint textureID,
+                                              const float* modelViewMatrix, const float* colour) {
+    assert(effect != NULL);
+    assert(modelViewMatrix != NULL && colour != NULL);
+
+    this->commands.push_back(RenderCommand());
+    RenderCommand& cmd = this->commands.back();
+    memcpy(cmd.modelViewMatrix, modelViewMatrix, sizeof(cmd.modelViewMatrix));
+    memcpy(cmd.colour, colour, sizeof(cmd.colour));
+    cmd.effect        = effect;
+    cmd.displayListID = 0;
+    cmd.batch         = NULL;
+
+    // The camera looks down -z, so the depth is the negated z of the modelview translation
+    cmd.sortKey = RenderCommandQueue::BuildSortKey(pass, this->GetEffectID(effect), textureID, -modelViewMatrix[14]);
+    return cmd;
+}
+
+void RenderCommandQueue::Add(unsigned char pass, CgFxEffectBase* effect, GLuint textureID, GLuint displayListID,
+                             const float* modelViewMatrix, const float* colour) {
+    assert(displayListID != 0);
+    RenderCommand& cmd = this->AddCommand(pass, effect, textureID, modelViewMatrix, colour);
+    cmd.displayListID = displayListID;
+}
+
+void RenderCommandQueue::Add(unsigned char pass, CgFxEffectBase* effect, GLuint textureID, const StaticGeometryBatch* batch,
+                             const float* modelViewMatrix, const float* colour) {
+    assert(batch != NULL);
+    RenderCommand& cmd = this->AddCommand(pass, effect, textureID, modelViewMatrix, colour);
+    cmd.batch = batch;
+}
+
+void RenderCommandQueue::Sort() {
+    this->sortedOrder.resize(this->commands.size());
+    for (size_t i = 0; i < this->commands.size(); i++) {
+        this->sortedOrder[i].sortKey    = this->sortingEnabled ? this->commands[i].sortKey : 0;
+        this->sortedOrder[i].commandIdx = i;
+    }
+    if (this->sortingEnabled) {
+        std::sort(this->sortedOrder.begin(), this->sortedOrder.end());
+    }
+}
+
+/**
+ * Execute all of the recorded commands against the given backend and clear the queue. Consecutive
+ * commands (after sorting) that share an effect are drawn as a single run: the effect is set up once
+ * and each of its passes is set once for the whole run, only the transform and colour are changed
+ * between commands - and only when they actually differ from the previous command's.
+ */
+void RenderCommandQueue::Execute(RenderBackend& backend, const Camera& camera) {
+    if (this->commands.empty()) {
+        return;
+    }
+
+    this->Sort();
+    backend.BeginExecution();
+
+    const float* lastMatrix = NULL;
+    const float* lastColour = NULL;
+
+    size_t runStart = 0;
+    while (runStart < this->sortedOrder.size()) {
+        CgFxEffectBase* effect = this->commands[this->sortedOrder[runStart].commandIdx].effect;
+
+        // Without sorting every command gets its own setup, just like an immediate draw would
+        size_t runEnd = runStart + 1;
+        if (this->sortingEnabled) {
+            while (runEnd < this->sortedOrder.size() && this->commands[this->sortedOrder[runEnd].commandIdx].effect == effect) {
+                ++runEnd;
+            }
+        }
+
+        // The effect setup reads the current modelview, so the first command's has to be set beforehand
+        const RenderCommand& firstCmd = this->commands[this->sortedOrder[runStart].commandIdx];
+        if (!IsSameMatrix(lastMatrix, firstCmd.modelViewMatrix)) {
+            backend.SetTransform(firstCmd.modelViewMatrix);
+            lastMatrix = firstCmd.modelViewMatrix;
+        }
+        backend.BindEffect(effect, camera);
+
+        for (int passIdx = 0; backend.BeginPass(effect, passIdx); ++passIdx) {
+            for (size_t i = runStart; i < runEnd; i++) {
+                const RenderCommand& cmd = this->commands[this->sortedOrder[i].commandIdx];
+
+                if (!IsSameMatrix(lastMatrix, cmd.modelViewMatrix)) {
+                    backend.SetTransform(cmd.modelViewMatrix);
+                    backend.UpdateEffectTransforms(effect, camera);
+                    lastMatrix = cmd.modelViewMatrix;
+                }
+                if (!IsSameColour(lastColour, cmd.colour)) {
+                    backend.SetColour(cmd.colour);
+                    lastColour = cmd.colour;
+                }
+                backend.DrawGeometry(cmd);
+            }
+            backend.EndPass();
+        }
+
+        runStart = runEnd;
+    }
+
+    backend.EndExecution();
+    this->commands.clear();
+}
@@ -0,0 +1,229 @@
+/**
+ * RenderCommandQueue.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __RENDERCOMMANDQUEUE_H__
+#define __RENDERCOMMANDQUEUE_H__
+
+#include "BasicIncludes.h"
+
+class Camera;
+class CgFxEffectBase;
+class StaticGeometryBatch;
+
+/**
+ * A single recorded draw: the effect to draw with, the geometry to draw (either a display list
+ * or a geometry batch) and the modelview and colour that were current when it was recorded.
+ */
+struct RenderCommand {
+    unsigned long long sortKey;
+    CgFxEffectBase* effect;
+    GLuint displayListID;
+    const StaticGeometryBatch* batch;
+    float modelViewMatrix[16];
+    float colour[4];
+};
+
+/**
+ * Interface for whatever the recorded commands are eventually executed against. The queue
+ * only calls into the backend when the state actually changes between commands.
+ */
+class RenderBackend {
+public:
+    RenderBackend() {}
+    virtual ~RenderBackend() {}
+
+    virtual void BeginExecution() = 0;
+    virtual void EndExecution() = 0;
+
+    virtual void SetTransform(const float* modelViewMatrix) = 0;
+    virtual void SetColour(const float* colour) = 0;
+
+    virtual void BindEffect(CgFxEffectBase* effect, const Camera& camera) = 0;
+    virtual void UpdateEffectTransforms(CgFxEffectBase* effect, const Camera& camera) = 0;
+    // Returns false when the bound effect has no pass with the given index
+    virtual bool BeginPass(CgFxEffectBase* effect, int passIdx) = 0;
+    virtual void EndPass() = 0;
+
+    virtual void DrawGeometry(const RenderCommand& cmd) = 0;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(RenderBackend);
+};
+
+/**
+ * Backend that executes the commands with OpenGL and the Cg runtime.
+ */
+class CgFxRenderBackend : public RenderBackend {
+public:
+    CgFxRenderBackend() : currPass(NULL), lastPass(NULL) {}
+    ~CgFxRenderBackend() {}
+
+    void BeginExecution();
+    void EndExecution();
+
+    void SetTransform(const float* modelViewMatrix);
+    void SetColour(const float* colour);
+
+    void BindEffect(CgFxEffectBase* effect, const Camera& camera);
+    void UpdateEffectTransforms(CgFxEffectBase* effect, const Camera& camera);
+    bool BeginPass(CgFxEffectBase* effect, int passIdx);
+    void EndPass();
+
+    void DrawGeometry(const RenderCommand& cmd);
+
+private:
+    CGpass currPass; // The pass that is currently set, NULL between passes
+    CGpass lastPass; // The last pass that was started, used to walk to the next one
+
+    DISALLOW_COPY_AND_ASSIGN(CgFxRenderBackend);
+};
+
+/**
+ * Backend that doesn't draw anything, it just counts the state changes that it is asked
+ * to make - used to check and benchmark the command sorting without a GL context.
+ */
+class NullRenderBackend : public RenderBackend {
+public:
+    NullRenderBackend(int numPassesPerEffect = 1) : numPassesPerEffect(numPassesPerEffect) {
+        this->ResetCounts();
+    }
+    ~NullRenderBackend() {}
+
+    void ResetCounts() {
+        this->numEffectBinds = 0;
+        this->numEffectTransformUpdates = 0;
+        this->numPassChanges = 0;
+        this->numTransformChanges = 0;
+        this->numColourChanges = 0;
+        this->numDraws = 0;
+    }
+    size_t GetNumEffectBinds() const { return this->numEffectBinds; }
+    size_t GetNumEffectTransformUpdates() const { return this->numEffectTransformUpdates; }
+    size_t GetNumPassChanges() const { return this->numPassChanges; }
+    size_t GetNumTransformChanges() const { return this->numTransformChanges; }
+    size_t GetNumColourChanges() const { return this->numColourChanges; }
+    size_t GetNumDraws() const { return this->numDraws; }
+
+    void BeginExecution() {}
+    void EndExecution() {}
+
+    void SetTransform(const float*) { this->numTransformChanges++; }
+    void SetColour(const float*) { this->numColourChanges++; }
+
+    void BindEffect(CgFxEffectBase*, const Camera&) { this->numEffectBinds++; }
+    void UpdateEffectTransforms(CgFxEffectBase*, const Camera&) { this->numEffectTransformUpdates++; }
+    bool BeginPass(CgFxEffectBase*, int passIdx) {
+        if (passIdx >= this->numPassesPerEffect) {
+            return false;
+        }
+        this->numPassChanges++;
+        return true;
+    }
+    void EndPass() {}
+
+    void DrawGeometry(const RenderCommand&) { this->numDraws++; }
+
+private:
+    int numPassesPerEffect;
+
+    size_t numEffectBinds;
+    size_t numEffectTransformUpdates;
+    size_t numPassChanges;
+    size_t numTransformChanges;
+    size_t numColourChanges;
+    size_t numDraws;
+
+    DISALLOW_COPY_AND_ASSIGN(NullRenderBackend);
+};
+
+/**
+ * Records draws for a frame so that they can be sorted by a key of (pass, effect, texture, depth)
+ * and then executed with each effect set up only once per run of commands that share it.
+ *
+ * The effect state (material properties, lights) is read when the run is executed, not when the
+ * command is recorded - so all of the commands that share an effect in a frame will be drawn with
+ * the same effect state, only the transform and colour are kept per-command. Depth is sorted front
+ * to back, so the queue is meant for opaque geometry where the order within a pass doesn't matter.
+ */
+class RenderCommandQueue {
+public:
+    static const int MAX_PASS = 255;
+    static const float MAX_SORT_DEPTH;
+
+    RenderCommandQueue();
+    ~RenderCommandQueue() {}
+
+    void Add(unsigned char pass, CgFxEffectBase* effect, GLuint textureID, GLuint displayListID,
+        const float* modelViewMatrix, const float* colour);
+    void Add(unsigned char pass, CgFxEffectBase* effect, GLuint textureID, const StaticGeometryBatch* batch,
+        const float* modelViewMatrix, const float* colour);
+
+    void Execute(RenderBackend& backend, const Camera& camera);
+    void Clear() { this->commands.clear(); }
+
+    size_t GetNumCommands() const { return this->commands.size(); }
+    bool IsEmpty() const { return this->commands.empty(); }
+    const RenderCommand& GetCommand(size_t idx) const { assert(idx < this->commands.size()); return this->commands[idx]; }
+
+    // When sorting is off the commands are executed in the order they were recorded with a full
+    // effect setup per command (i.e., just like drawing them immediately) - for comparison
+    void SetSortingEnabled(bool enabled) { this->sortingEnabled = enabled; }
+    bool GetSortingEnabled() const { return this->sortingEnabled; }
+
+    // Sorts the commands by their keys, this is done by Execute but is exposed for benchmarking
+    void Sort();
+
+    static unsigned long long BuildSortKey(unsigned char pass, unsigned short effectID, GLuint textureID, float depth);
+
+private:
+    struct SortEntry {
+        unsigned long long sortKey;
+        size_t commandIdx;
+        bool operator<(const SortEntry& other) const {
+            // Ties keep the recorded order so that execution is deterministic
+            return this->sortKey < other.sortKey || (this->sortKey == other.sortKey && this->commandIdx < other.commandIdx);
+        }
+    };
+
+    std::vector<RenderCommand> commands;
+    std::vector<SortEntry> sortedOrder;
+    // Small ids for effects so that they fit in the sort key, kept across frames
+    std::map<const CgFxEffectBase*, unsigned short> effectIDs;
+    bool sortingEnabled;
+
+    unsigned short GetEffectID(const CgFxEffectBase* effect);
+    RenderCommand& AddCommand(unsigned char pass, CgFxEffectBase* effect, GLuint textureID,
+        const float* modelViewMatrix, const float* colour);
+
+    DISALLOW_COPY_AND_ASSIGN(RenderCommandQueue);
+};
+
+#endif // __RENDERCOMMANDQUEUE_H__
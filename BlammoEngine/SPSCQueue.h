@@ -0,0 +1,133 @@
+/**
+ * SPSCQueue.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SPSCQUEUE_H__
+#define __SPSCQUEUE_H__
+
+#include "BasicIncludes.h"
+
+/**
+ * Bounded, lock-free, single-producer/single-consumer FIFO queue of POD records. All storage
+ * is allocated up front, pushing and popping never allocate and never take a lock. Exactly
+ * one thread may push and exactly one (possibly the same) thread may pop.
+ *
+ * The capacity is rounded up to a power of two; one slot is always left empty so that a full
+ * queue can be told apart from an empty one.
+ */
+template <typename T>
+class SPSCQueue {
+public:
+    explicit SPSCQueue(size_t minCapacity);
+    ~SPSCQueue();
+
+    bool Push(const T& value);
+    bool Pop(T& value);
+
+    bool IsEmpty() const { return this->head == this->tail; }
+    size_t GetCapacity() const { return this->mask; }
+
+private:
+    T* buffer;
+    size_t mask;
+    
+    volatile size_t head;   // Next slot to pop, only written by the consumer
+    volatile size_t tail;   // Next slot to push, only written by the producer
+
+    static void MemoryFence();
+
+    DISALLOW_COPY_AND_ASSIGN(SPSCQueue);
+};
+
+template <typename T>
+inline SPSCQueue<T>::SPSCQueue(size_t minCapacity) : buffer(NULL), mask(0), head(0), tail(0) {
+    size_t size = 2;
+    while (size <= minCapacity) {
+        size <<= 1;
+    }
+    this->buffer = new T[size];
+    this->mask = size - 1;
+}
+
+template <typename T>
+inline SPSCQueue<T>::~SPSCQueue() {
+    delete[] this->buffer;
+    this->buffer = NULL;
+}
+
+/**
+ * Publishes the given value to the consumer (producer thread only).
+ * Returns: true on success, false if the queue is full (nothing is pushed).
+ */
+template <typename T>
+inline bool SPSCQueue<T>::Push(const T& value) {
+    size_t currTail = this->tail;
+    size_t nextTail = (currTail + 1) & this->mask;
+    if (nextTail == this->head) {
+        return false;
+    }
+
+    this->buffer[currTail] = value;
+    // The record must be fully written before the consumer can see the new tail
+    MemoryFence();
+    this->tail = nextTail;
+    return true;
+}
+
+/**
+ * Takes the oldest value out of the queue (consumer thread only).
+ * Returns: true on success, false if the queue is empty (value is untouched).
+ */
+template <typename T>
+inline bool SPSCQueue<T>::Pop(T& value) {
+    size_t currHead = this->head;
+    if (currHead == this->tail) {
+        return false;
+    }
+    // Don't read the record until the tail that published it has been seen
+    MemoryFence();
+
+    value = this->buffer[currHead];
+    // The record must be fully read before the producer can reuse its slot
+    MemoryFence();
+    this->head = (currHead + 1) & this->mask;
+    return true;
+}
+
+template <typename T>
+inline void SPSCQueue<T>::MemoryFence() {
+#ifdef _WIN32
+    MemoryBarrier();
+#else
+    __sync_synchronize();
+#endif
+}
+
+#endif // __SPSCQUEUE_H__
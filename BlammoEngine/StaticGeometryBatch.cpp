@@ -0,0 +1,271 @@
+/**
+ * StaticGeometryBatch.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "StaticGeometryBatch.h"
+#include "Mesh.h"
+#include "BatchMath.h"
+
+StaticGeometryBatch::StaticGeometryBatch() : numRemovedVertices(0), dirtyBeginVertex(0), dirtyEndVertex(0),
+bufferID(0), bufferCapacityInVertices(0) {
+}
+
+StaticGeometryBatch::~StaticGeometryBatch() {
+    if (this->bufferID != 0) {
+        glDeleteBuffers(1, &this->bufferID);
+        this->bufferID = 0;
+    }
+}
+
+/**
+ * Append the given polygon group, transformed into place and coloured, to the end of this batch.
+ * The owner is what's used to identify the geometry when it's removed.
+ */
+void StaticGeometryBatch::AddGeometry(const void* owner, const PolygonGroup& polyGrp,
+                                      const Matrix4x4& transform, const ColourRGBA& colour) {
+    assert(owner != NULL);
+    assert(!this->HasGeometry(owner));
+    assert(polyGrp.GetPolygonType() == GL_TRIANGLES);
+
+    std::vector<Point3D> vertices(polyGrp.GetVertexStream());
+    std::vector<Vector3D> normals(polyGrp.GetNormalStream());
+    const std::vector<Point2D>& texCoords = polyGrp.GetTexCoordStream();
+    assert(vertices.size() == normals.size() && vertices.size() == texCoords.size());
+
+    if (!vertices.empty()) {
+        BatchMath::TransformPoints(transform, &vertices[0], vertices.size());
+        BatchMath::TransformVectors(transform, &normals[0], normals.size());
+    }
+
+    GeometryRange range;
+    range.firstVertex = this->GetNumVertices();
+    range.numVertices = vertices.size();
+
+    this->vertexData.reserve(this->vertexData.size() + range.numVertices * NUM_FLOATS_PER_VERTEX);
+    for (size_t i = 0; i < vertices.size(); i++) {
+        const Point3D& vertex = vertices[i];
+        const Vector3D& normal = normals[i];
+        const Point2D& texCoord = texCoords[i];
+
+        this->vertexData.push_back(vertex[0]);
+        this->vertexData.push_back(vertex[1]);
+        this->vertexData.push_back(vertex[2]);
+        this->vertexData.push_back(normal[0]);
+        this->vertexData.push_back(normal[1]);
+        this->vertexData.push_back(normal[2]);
+        this->vertexData.push_back(texCoord[0]);
+        this->vertexData.push_back(texCoord[1]);
+        this->vertexData.push_back(colour.R());
+        this->vertexData.push_back(colour.G());
+        this->vertexData.push_back(colour.B());
+        this->vertexData.push_back(colour.A());
+    }
+
+    this->ranges.insert(std::make_pair(owner, range));
+    this->MarkDirty(range.firstVertex, range.numVertices);
+}
+
+/**
+ * Remove the geometry of the given owner from this batch. Its vertices are collapsed in place
+ * (every triangle becomes degenerate and is never rasterized) and the batch is compacted if
+ * it's become mostly dead space.
+ * Returns: true if the owner had geometry in this batch, false otherwise.
+ */
+bool StaticGeometryBatch::RemoveGeometry(const void* owner) {
+    GeometryRangeMap::iterator findIter = this->ranges.find(owner);
+    if (findIter == this->ranges.end()) {
+        return false;
+    }
+
+    const GeometryRange& range = findIter->second;
+    if (range.numVertices > 0) {
+        float* firstVertex = &this->vertexData[range.firstVertex * NUM_FLOATS_PER_VERTEX];
+        for (size_t i = 1; i < range.numVertices; i++) {
+            float* currVertex = firstVertex + i * NUM_FLOATS_PER_VERTEX;
+            currVertex[0] = firstVertex[0];
+            currVertex[1] = firstVertex[1];
+            currVertex[2] = firstVertex[2];
+        }
+        this->MarkDirty(range.firstVertex, range.numVertices);
+    }
+
+    this->numRemovedVertices += range.numVertices;
+    this->ranges.erase(findIter);
+
+    if (this->ranges.empty()) {
+        // Nothing left to draw, just let go of everything
+        this->vertexData.clear();
+        this->numRemovedVertices = 0;
+        this->dirtyBeginVertex = this->dirtyEndVertex = 0;
+    }
+    else if (this->GetNumVertices() >= MIN_VERTICES_TO_COMPACT && 2 * this->numRemovedVertices > this->GetNumVertices()) {
+        this->Compact();
+    }
+
+    return true;
+}
+
+/**
+ * Rebuild the batch from only the geometry that's still in it, getting rid of the space left
+ * behind by removed geometry.
+ */
+void StaticGeometryBatch::Compact() {
+    if (this->numRemovedVertices == 0) {
+        return;
+    }
+
+    // Keep the geometry in the order it was added so that ranges only ever move down
+    std::vector<std::pair<size_t, GeometryRange*> > sortedRanges;
+    sortedRanges.reserve(this->ranges.size());
+    for (GeometryRangeMap::iterator iter = this->ranges.begin(); iter != this->ranges.end(); ++iter) {
+        sortedRanges.push_back(std::make_pair(iter->second.firstVertex, &iter->second));
+    }
+    std::sort(sortedRanges.begin(), sortedRanges.end());
+
+    size_t nextVertex = 0;
+    for (size_t i = 0; i < sortedRanges.size(); i++) {
+        GeometryRange& range = *sortedRanges[i].second;
+        assert(range.firstVertex >= nextVertex);
+        if (range.firstVertex != nextVertex) {
+            std::copy(this->vertexData.begin() + range.firstVertex * NUM_FLOATS_PER_VERTEX,
+                this->vertexData.begin() + (range.firstVertex + range.numVertices) * NUM_FLOATS_PER_VERTEX,
+                this->vertexData.begin() + nextVertex * NUM_FLOATS_PER_VERTEX);
+            range.firstVertex = nextVertex;
+        }
+        nextVertex += range.numVertices;
+    }
+
+    this->vertexData.resize(nextVertex * NUM_FLOATS_PER_VERTEX);
+    this->numRemovedVertices = 0;
+    this->dirtyBeginVertex = 0;
+    this->dirtyEndVertex = nextVertex;
+}
+
+bool StaticGeometryBatch::GetGeometryRange(const void* owner, size_t& firstVertex, size_t& numVertices) const {
+    GeometryRangeMap::const_iterator findIter = this->ranges.find(owner);
+    if (findIter == this->ranges.end()) {
+        return false;
+    }
+    firstVertex = findIter->second.firstVertex;
+    numVertices = findIter->second.numVertices;
+    return true;
+}
+
+bool StaticGeometryBatch::GetDirtyRange(size_t& firstVertex, size_t& numVertices) const {
+    if (this->dirtyEndVertex <= this->dirtyBeginVertex) {
+        return false;
+    }
+    firstVertex = this->dirtyBeginVertex;
+    numVertices = this->dirtyEndVertex - this->dirtyBeginVertex;
+    return true;
+}
+
+void StaticGeometryBatch::MarkDirty(size_t firstVertex, size_t numVertices) {
+    if (numVertices == 0) {
+        return;
+    }
+    if (this->dirtyEndVertex <= this->dirtyBeginVertex) {
+        this->dirtyBeginVertex = firstVertex;
+        this->dirtyEndVertex   = firstVertex + numVertices;
+    }
+    else {
+        this->dirtyBeginVertex = std::min<size_t>(this->dirtyBeginVertex, firstVertex);
+        this->dirtyEndVertex   = std::max<size_t>(this->dirtyEndVertex, firstVertex + numVertices);
+    }
+}
+
+/**
+ * Send any changes to the geometry over to the vertex buffer on the GPU, only the range that
+ * changed is uploaded unless the buffer has to grow.
+ */
+void StaticGeometryBatch::UpdateBuffer() {
+    size_t numVertices = this->GetNumVertices();
+    size_t dirtyFirstVertex = 0;
+    size_t dirtyNumVertices = 0;
+    bool isDirty = this->GetDirtyRange(dirtyFirstVertex, dirtyNumVertices);
+    if (!isDirty || numVertices == 0) {
+        return;
+    }
+
+    if (this->bufferID == 0) {
+        glGenBuffers(1, &this->bufferID);
+        assert(this->bufferID != 0);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, this->bufferID);
+
+    if (numVertices > this->bufferCapacityInVertices) {
+        // Leave some room so that pieces being added to the level don't reallocate every time
+        this->bufferCapacityInVertices = numVertices + numVertices / 2;
+        glBufferData(GL_ARRAY_BUFFER, this->bufferCapacityInVertices * NUM_FLOATS_PER_VERTEX * sizeof(float),
+            NULL, GL_STATIC_DRAW);
+        dirtyFirstVertex = 0;
+        dirtyNumVertices = numVertices;
+    }
+
+    dirtyNumVertices = std::min<size_t>(dirtyNumVertices, numVertices - dirtyFirstVertex);
+    glBufferSubData(GL_ARRAY_BUFFER, dirtyFirstVertex * NUM_FLOATS_PER_VERTEX * sizeof(float),
+        dirtyNumVertices * NUM_FLOATS_PER_VERTEX * sizeof(float), this->GetVertex(dirtyFirstVertex));
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    this->dirtyBeginVertex = this->dirtyEndVertex = 0;
+}
+
+/**
+ * Draw all of the geometry in this batch, UpdateBuffer must have been called since it last changed.
+ */
+void StaticGeometryBatch::Draw() const {
+    if (this->IsEmpty() || this->bufferID == 0) {
+        return;
+    }
+
+    static const GLsizei STRIDE = NUM_FLOATS_PER_VERTEX * sizeof(float);
+
+    // Drawing with a colour array leaves the current colour undefined afterwards, keep it (and
+    // the client arrays) as they were for whatever gets drawn next
+    glPushAttrib(GL_CURRENT_BIT);
+    glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+
+    glBindBuffer(GL_ARRAY_BUFFER, this->bufferID);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glEnableClientState(GL_NORMAL_ARRAY);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glEnableClientState(GL_COLOR_ARRAY);
+
+    glVertexPointer(3, GL_FLOAT, STRIDE, BUFFER_OFFSET(0));
+    glNormalPointer(GL_FLOAT, STRIDE, BUFFER_OFFSET(NORMAL_OFFSET * sizeof(float)));
+    glTexCoordPointer(2, GL_FLOAT, STRIDE, BUFFER_OFFSET(TEXCOORD_OFFSET * sizeof(float)));
+    glColorPointer(4, GL_FLOAT, STRIDE, BUFFER_OFFSET(COLOUR_OFFSET * sizeof(float)));
+
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(this->GetNumVertices()));
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glPopClientAttrib();
+    glPopAttrib();
+}
@@ -0,0 +1,112 @@
+/**
+ * StaticGeometryBatch.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __STATICGEOMETRYBATCH_H__
+#define __STATICGEOMETRYBATCH_H__
+
+#include "BasicIncludes.h"
+#include "Colour.h"
+#include "Matrix.h"
+
+class PolygonGroup;
+
+/**
+ * A single interleaved vertex buffer holding many pieces of static, triangulated geometry that
+ * all share the same material - so they can all be drawn with one call. Each piece is added with
+ * its own transform and colour baked in and keeps track of the range of vertices it owns so that
+ * it can later be removed.
+ *
+ * Removing a piece only collapses its vertices into degenerate triangles and patches that range
+ * on the GPU. Once enough of the batch is dead space it gets compacted (rebuilt from the live
+ * pieces). All of the building and patching is done on the CPU-side copy of the geometry, the
+ * only functions that touch OpenGL are UpdateBuffer, Draw and the destructor.
+ */
+class StaticGeometryBatch {
+public:
+    // Each vertex is a position (3), normal (3), texture coordinate (2) and colour (4)
+    static const size_t NUM_FLOATS_PER_VERTEX = 12;
+    static const size_t NORMAL_OFFSET = 3;
+    static const size_t TEXCOORD_OFFSET = 6;
+    static const size_t COLOUR_OFFSET = 8;
+
+    StaticGeometryBatch();
+    ~StaticGeometryBatch();
+
+    void AddGeometry(const void* owner, const PolygonGroup& polyGrp, const Matrix4x4& transform, const ColourRGBA& colour);
+    bool RemoveGeometry(const void* owner);
+    bool HasGeometry(const void* owner) const { return this->ranges.find(owner) != this->ranges.end(); }
+    void Compact();
+
+    // All vertices in the batch, including the ones left behind by removed geometry
+    size_t GetNumVertices() const { return this->vertexData.size() / NUM_FLOATS_PER_VERTEX; }
+    size_t GetNumRemovedVertices() const { return this->numRemovedVertices; }
+    size_t GetNumLiveVertices() const { return this->GetNumVertices() - this->numRemovedVertices; }
+    size_t GetNumGeometryPieces() const { return this->ranges.size(); }
+    bool IsEmpty() const { return this->ranges.empty(); }
+
+    const float* GetVertex(size_t vertexIdx) const {
+        assert(vertexIdx < this->GetNumVertices());
+        return &this->vertexData[vertexIdx * NUM_FLOATS_PER_VERTEX];
+    }
+    bool GetGeometryRange(const void* owner, size_t& firstVertex, size_t& numVertices) const;
+
+    // The range of vertices that has changed since the last UpdateBuffer
+    bool GetDirtyRange(size_t& firstVertex, size_t& numVertices) const;
+
+    void UpdateBuffer();
+    void Draw() const;
+
+private:
+    // Batches that are at least this big and more than half dead space get compacted
+    static const size_t MIN_VERTICES_TO_COMPACT = 512;
+
+    struct GeometryRange {
+        size_t firstVertex;
+        size_t numVertices;
+    };
+    typedef std::map<const void*, GeometryRange> GeometryRangeMap;
+
+    std::vector<float> vertexData;
+    GeometryRangeMap ranges;
+    size_t numRemovedVertices;
+
+    size_t dirtyBeginVertex;
+    size_t dirtyEndVertex;
+
+    GLuint bufferID;
+    size_t bufferCapacityInVertices;
+
+    void MarkDirty(size_t firstVertex, size_t numVertices);
+
+    DISALLOW_COPY_AND_ASSIGN(StaticGeometryBatch);
+};
+
+#endif // __STATICGEOMETRYBATCH_H__
@@ -0,0 +1,235 @@
+/**
+ * SweepAndPrune.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SWEEPANDPRUNE_H__
+#define __SWEEPANDPRUNE_H__
+
+#include "BasicIncludes.h"
+#include "Collision.h"
+
+/**
+ * Single-axis sweep and prune broad phase for 2D axis-aligned bounding boxes. Objects are
+ * inserted with their AABBs, the set is then finalized (sorted along the x-axis) and queried 
+ * for objects whose AABBs overlap a given AABB - this lets narrow phase collision checks be
+ * skipped for every pair that can't possibly be touching.
+ *
+ * Objects are NOT owned by this. All storage is kept between uses, so once the structure has
+ * grown to the size of the scene, clearing and rebuilding it does not allocate.
+ */
+template <typename T>
+class SweepAndPrune {
+public:
+    SweepAndPrune() : maxEntryWidth(0.0f), isFinalized(true) {}
+    ~SweepAndPrune() {}
+
+    void Clear();
+    void Reserve(size_t size);
+
+    void Insert(T* obj, const Collision::AABB2D& aabb);
+    void Finalize();
+
+    void Remove(const T* obj);
+    bool Update(const T* obj, const Collision::AABB2D& aabb);
+    void Query(const Collision::AABB2D& aabb, std::vector<T*>& result) const;
+
+    size_t GetSize() const { return this->entries.size(); }
+    bool IsEmpty() const { return this->entries.empty(); }
+
+private:
+    struct Entry {
+        float minX, minY, maxX, maxY;
+        T* obj;     // NULL when the object has been removed
+        
+        bool operator<(const Entry& other) const { return this->minX < other.minX; }
+        bool operator<(float x) const { return this->minX < x; }
+    };
+    struct LookupEntry {
+        const T* obj;
+        size_t entryIdx;    // REMOVED_ENTRY_IDX when the object has been removed
+
+        bool operator<(const LookupEntry& other) const { return this->obj < other.obj; }
+        bool operator<(const T* other) const { return this->obj < other; }
+    };
+
+    std::vector<Entry> entries;         // Sorted by minimum x-coordinate once finalized
+    std::vector<LookupEntry> lookup;    // Sorted by object address, for quick removal
+    float maxEntryWidth;                // Widest AABB along the x-axis, bounds how far back a query must look
+    bool isFinalized;
+
+    static const size_t REMOVED_ENTRY_IDX = static_cast<size_t>(-1);
+
+    void MoveEntry(size_t fromIdx, size_t toIdx);
+
+    DISALLOW_COPY_AND_ASSIGN(SweepAndPrune);
+};
+
+template <typename T>
+inline void SweepAndPrune<T>::Clear() {
+    this->entries.clear();
+    this->lookup.clear();
+    this->maxEntryWidth = 0.0f;
+    this->isFinalized = true;
+}
+
+template <typename T>
+inline void SweepAndPrune<T>::Reserve(size_t size) {
+    this->entries.reserve(size);
+    this->lookup.reserve(size);
+}
+
+template <typename T>
+inline void SweepAndPrune<T>::Insert(T* obj, const Collision::AABB2D& aabb) {
+    assert(obj != NULL);
+
+    Entry entry;
+    entry.minX = aabb.GetMin()[0];
+    entry.minY = aabb.GetMin()[1];
+    entry.maxX = aabb.GetMax()[0];
+    entry.maxY = aabb.GetMax()[1];
+    entry.obj  = obj;
+    
+    this->entries.push_back(entry);
+    this->maxEntryWidth = std::max<float>(this->maxEntryWidth, entry.maxX - entry.minX);
+    this->isFinalized = false;
+}
+
+/**
+ * Sort the inserted objects so that the structure can be queried, this MUST be called
+ * after inserting objects and before querying or removing them.
+ */
+template <typename T>
+inline void SweepAndPrune<T>::Finalize() {
+    std::sort(this->entries.begin(), this->entries.end());
+
+    this->lookup.resize(this->entries.size());
+    for (size_t i = 0; i < this->entries.size(); i++) {
+        this->lookup[i].obj = this->entries[i].obj;
+        this->lookup[i].entryIdx = i;
+    }
+    std::sort(this->lookup.begin(), this->lookup.end());
+
+    this->isFinalized = true;
+}
+
+/**
+ * Remove the given object so that it will no longer show up in queries (e.g., it was destroyed).
+ * Removing an object that was never inserted does nothing.
+ */
+template <typename T>
+inline void SweepAndPrune<T>::Remove(const T* obj) {
+    assert(this->isFinalized);
+
+    typename std::vector<LookupEntry>::iterator findIter = 
+        std::lower_bound(this->lookup.begin(), this->lookup.end(), obj);
+    if (findIter == this->lookup.end() || findIter->obj != obj || findIter->entryIdx == REMOVED_ENTRY_IDX) {
+        return;
+    }
+    this->entries[findIter->entryIdx].obj = NULL;
+    findIter->entryIdx = REMOVED_ENTRY_IDX;
+}
+
+/**
+ * Give the given object a new AABB (e.g., it was teleported) without rebuilding the structure,
+ * only the object's entry is shifted back into sorted order. Returns false (and changes nothing)
+ * if the object was never inserted or has been removed.
+ */
+template <typename T>
+inline bool SweepAndPrune<T>::Update(const T* obj, const Collision::AABB2D& aabb) {
+    assert(this->isFinalized);
+
+    typename std::vector<LookupEntry>::iterator findIter = 
+        std::lower_bound(this->lookup.begin(), this->lookup.end(), obj);
+    if (findIter == this->lookup.end() || findIter->obj != obj || findIter->entryIdx == REMOVED_ENTRY_IDX) {
+        return false;
+    }
+
+    size_t entryIdx = findIter->entryIdx;
+    Entry entry = this->entries[entryIdx];
+    entry.minX = aabb.GetMin()[0];
+    entry.minY = aabb.GetMin()[1];
+    entry.maxX = aabb.GetMax()[0];
+    entry.maxY = aabb.GetMax()[1];
+    this->maxEntryWidth = std::max<float>(this->maxEntryWidth, entry.maxX - entry.minX);
+
+    // Shift the entries between the old and new positions over by one to make room
+    while (entryIdx > 0 && entry.minX < this->entries[entryIdx-1].minX) {
+        this->MoveEntry(entryIdx-1, entryIdx);
+        entryIdx--;
+    }
+    while (entryIdx+1 < this->entries.size() && this->entries[entryIdx+1].minX < entry.minX) {
+        this->MoveEntry(entryIdx+1, entryIdx);
+        entryIdx++;
+    }
+
+    this->entries[entryIdx] = entry;
+    findIter->entryIdx = entryIdx;
+    return true;
+}
+
+/**
+ * Find all objects with AABBs overlapping the given AABB, the result is cleared and
+ * then filled in ascending order of the objects' minimum x-coordinates.
+ */
+template <typename T>
+inline void SweepAndPrune<T>::Query(const Collision::AABB2D& aabb, std::vector<T*>& result) const {
+    assert(this->isFinalized);
+    result.clear();
+
+    const float queryMinX = aabb.GetMin()[0];
+    const float queryMinY = aabb.GetMin()[1];
+    const float queryMaxX = aabb.GetMax()[0];
+    const float queryMaxY = aabb.GetMax()[1];
+
+    // Nothing that starts further back than the widest entry can reach the query box
+    typename std::vector<Entry>::const_iterator iter = 
+        std::lower_bound(this->entries.begin(), this->entries.end(), queryMinX - this->maxEntryWidth);
+
+    for (; iter != this->entries.end() && iter->minX <= queryMaxX; ++iter) {
+        if (iter->obj == NULL || iter->maxX < queryMinX || iter->maxY < queryMinY || iter->minY > queryMaxY) {
+            continue;
+        }
+        result.push_back(iter->obj);
+    }
+}
+
+template <typename T>
+inline void SweepAndPrune<T>::MoveEntry(size_t fromIdx, size_t toIdx) {
+    const Entry& entry = this->entries[fromIdx];
+    if (entry.obj != NULL) {
+        typename std::vector<LookupEntry>::iterator findIter = 
+            std::lower_bound(this->lookup.begin(), this->lookup.end(), static_cast<const T*>(entry.obj));
+        assert(findIter != this->lookup.end() && findIter->obj == entry.obj);
+        findIter->entryIdx = toIdx;
+    }
+    this->entries[toIdx] = entry;
+}
+
+#endif // __SWEEPANDPRUNE_H__
@@ -0,0 +1,323 @@
+/**
+ * TaskGraph.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TaskGraph.h"
+#include "BlammoTime.h"
+#include "FrameProfiler.h"
+
+TaskGraph::TaskGraph() : numFinishedTasks(0), numRunningTasks(0), isShuttingDown(false),
+mutex(NULL), workAvailableCond(NULL), taskFinishedCond(NULL), runStartTimeInSecs(0.0), runTimeInSecs(0.0) {
+    this->mutex             = SDL_CreateMutex();
+    this->workAvailableCond = SDL_CreateCond();
+    this->taskFinishedCond  = SDL_CreateCond();
+    assert(this->mutex != NULL && this->workAvailableCond != NULL && this->taskFinishedCond != NULL);
+}
+
+TaskGraph::~TaskGraph() {
+    SDL_DestroyCond(this->taskFinishedCond);
+    this->taskFinishedCond = NULL;
+    SDL_DestroyCond(this->workAvailableCond);
+    this->workAvailableCond = NULL;
+    SDL_DestroyMutex(this->mutex);
+    this->mutex = NULL;
+}
+
+TaskGraph::TaskID TaskGraph::AddTask(const std::string& name, TaskFunc func, void* context, ThreadAffinity affinity) {
+    assert(func != NULL);
+
+    Task task;
+    task.name     = name;
+    task.func     = func;
+    task.context  = context;
+    task.affinity = affinity;
+    task.numPrerequisites = 0;
+    task.numUnfinishedPrerequisites = 0;
+    task.state    = Waiting;
+    task.ranOnMainThread = false;
+    task.startTimeInSecs = 0.0;
+    task.endTimeInSecs   = 0.0;
+
+    this->tasks.push_back(task);
+    return this->tasks.size() - 1;
+}
+
+/**
+ * Make the given task wait until the prerequisite task has finished successfully.
+ */
+void TaskGraph::AddDependency(TaskID task, TaskID prerequisite) {
+    assert(task < this->tasks.size() && prerequisite < this->tasks.size());
+    assert(task != prerequisite);
+
+    this->tasks[prerequisite].dependents.push_back(task);
+    this->tasks[task].numPrerequisites++;
+}
+
+/**
+ * Run every task in the graph, returns once they've all finished (or been skipped). The listener
+ * (if any) is told about each task as it finishes from the calling thread, so it may do things
+ * like draw a loading screen. Returns true if every task succeeded.
+ */
+bool TaskGraph::Run(int numWorkerThreads, Listener* listener) {
+    this->runStartTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs();
+
+    // There's no point in starting more workers than there are tasks for them to run
+    size_t numAnyThreadTasks = 0;
+    for (size_t i = 0; i < this->tasks.size(); i++) {
+        if (this->tasks[i].affinity == AnyThread) {
+            numAnyThreadTasks++;
+        }
+    }
+    numWorkerThreads = std::min<int>(std::max<int>(0, numWorkerThreads), static_cast<int>(numAnyThreadTasks));
+
+    SDL_mutexP(this->mutex);
+    this->numFinishedTasks = 0;
+    this->numRunningTasks  = 0;
+    this->isShuttingDown   = false;
+    for (size_t i = 0; i < this->tasks.size(); i++) {
+        Task& task = this->tasks[i];
+        task.state = Waiting;
+        task.numUnfinishedPrerequisites = task.numPrerequisites;
+    }
+    for (size_t i = 0; i < this->tasks.size(); i++) {
+        if (this->tasks[i].numUnfinishedPrerequisites == 0) {
+            this->MakeReady(i);
+        }
+    }
+    SDL_mutexV(this->mutex);
+
+    std::vector<SDL_Thread*> threads;
+    threads.reserve(numWorkerThreads);
+    for (int i = 0; i < numWorkerThreads; i++) {
+        SDL_Thread* thread = SDL_CreateThread(&TaskGraph::WorkerThreadMain, this);
+        if (thread == NULL) {
+            // Carry on with fewer threads, if there are none then this thread runs everything
+            debug_output("Failed to create task graph worker thread: " << SDL_GetError());
+            continue;
+        }
+        threads.push_back(thread);
+    }
+    const bool runAnyThreadTasks = threads.empty();
+
+    SDL_mutexP(this->mutex);
+    while (this->numFinishedTasks < this->tasks.size() || !this->finishedTasks.empty()) {
+
+        if (!this->finishedTasks.empty()) {
+            TaskID finishedTask = this->finishedTasks.front();
+            this->finishedTasks.pop_front();
+            if (listener != NULL) {
+                bool succeeded = (this->tasks[finishedTask].state == Succeeded);
+                SDL_mutexV(this->mutex);
+                listener->TaskFinished(*this, finishedTask, succeeded);
+                SDL_mutexP(this->mutex);
+            }
+            continue;
+        }
+
+        // Pick the earliest added task that this thread is allowed to run
+        std::set<TaskID>* readyTasks = NULL;
+        if (!this->readyMainTasks.empty()) {
+            readyTasks = &this->readyMainTasks;
+        }
+        if (runAnyThreadTasks && !this->readyWorkerTasks.empty() &&
+            (readyTasks == NULL || *this->readyWorkerTasks.begin() < *readyTasks->begin())) {
+            readyTasks = &this->readyWorkerTasks;
+        }
+        if (readyTasks != NULL) {
+            TaskID nextTask = *readyTasks->begin();
+            readyTasks->erase(readyTasks->begin());
+            this->tasks[nextTask].state = Running;
+            this->numRunningTasks++;
+
+            SDL_mutexV(this->mutex);
+            this->RunTask(nextTask, true);
+            SDL_mutexP(this->mutex);
+            continue;
+        }
+
+        if (this->numRunningTasks == 0 && (runAnyThreadTasks || this->readyWorkerTasks.empty())) {
+            // Nothing is running and nothing can start, whatever is left depends on itself
+            assert(false);
+            debug_output("Task graph has a dependency cycle, skipping the remaining tasks.");
+            for (size_t i = 0; i < this->tasks.size(); i++) {
+                this->SkipTask(i);
+            }
+            continue;
+        }
+
+        SDL_CondWait(this->taskFinishedCond, this->mutex);
+    }
+
+    this->isShuttingDown = true;
+    SDL_CondBroadcast(this->workAvailableCond);
+    SDL_mutexV(this->mutex);
+
+    for (size_t i = 0; i < threads.size(); i++) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    assert(this->readyWorkerTasks.empty() && this->readyMainTasks.empty());
+
+    this->runTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs() - this->runStartTimeInSecs;
+
+    for (size_t i = 0; i < this->tasks.size(); i++) {
+        if (this->tasks[i].state != Succeeded) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Writes out when each task ran, on which thread and for how long, followed by how long running
+ * all of them took compared to how long they'd take one after the other.
+ */
+void TaskGraph::WriteTimingReport(std::ostream& outStream) const {
+    double totalTaskTimeInSecs = 0.0;
+    for (size_t i = 0; i < this->tasks.size(); i++) {
+        const Task& task = this->tasks[i];
+        outStream << "  " << task.name << ": ";
+        if (task.state == Skipped || task.state == Waiting) {
+            outStream << "skipped" << std::endl;
+            continue;
+        }
+
+        double taskTimeInSecs = task.endTimeInSecs - task.startTimeInSecs;
+        totalTaskTimeInSecs += taskTimeInSecs;
+        outStream << taskTimeInSecs << "s starting at " << task.startTimeInSecs << "s on the "
+            << (task.ranOnMainThread ? "main" : "worker") << " thread";
+        if (task.state == Failed) {
+            outStream << " (failed)";
+        }
+        outStream << std::endl;
+    }
+    outStream << "Running all tasks took " << this->runTimeInSecs << "s, " << totalTaskTimeInSecs
+        << "s if run one after the other" << std::endl;
+}
+
+// Queue up a task whose prerequisites have all finished, must be called with the mutex held
+void TaskGraph::MakeReady(TaskID task) {
+    assert(this->tasks[task].state == Waiting);
+    this->tasks[task].state = Ready;
+    if (this->tasks[task].affinity == MainThread) {
+        this->readyMainTasks.insert(task);
+        SDL_CondSignal(this->taskFinishedCond);
+    }
+    else {
+        this->readyWorkerTasks.insert(task);
+        SDL_CondSignal(this->workAvailableCond);
+        // The calling thread runs these itself when there are no workers
+        SDL_CondSignal(this->taskFinishedCond);
+    }
+}
+
+// Must be called with the mutex held
+void TaskGraph::FinishTask(TaskID task, bool succeeded) {
+    Task& finishedTask = this->tasks[task];
+    assert(finishedTask.state == Running);
+    assert(this->numRunningTasks > 0);
+
+    finishedTask.state = succeeded ? Succeeded : Failed;
+    this->numRunningTasks--;
+    this->numFinishedTasks++;
+    this->finishedTasks.push_back(task);
+
+    for (size_t i = 0; i < finishedTask.dependents.size(); i++) {
+        TaskID dependent = finishedTask.dependents[i];
+        if (!succeeded) {
+            this->SkipTask(dependent);
+            continue;
+        }
+
+        Task& dependentTask = this->tasks[dependent];
+        assert(dependentTask.numUnfinishedPrerequisites > 0);
+        dependentTask.numUnfinishedPrerequisites--;
+        if (dependentTask.numUnfinishedPrerequisites == 0 && dependentTask.state == Waiting) {
+            this->MakeReady(dependent);
+        }
+    }
+
+    SDL_CondSignal(this->taskFinishedCond);
+}
+
+// Skip the given task and everything that depends on it, must be called with the mutex held
+void TaskGraph::SkipTask(TaskID task) {
+    Task& skippedTask = this->tasks[task];
+    if (skippedTask.state != Waiting) {
+        return;
+    }
+
+    skippedTask.state = Skipped;
+    this->numFinishedTasks++;
+    this->finishedTasks.push_back(task);
+    for (size_t i = 0; i < skippedTask.dependents.size(); i++) {
+        this->SkipTask(skippedTask.dependents[i]);
+    }
+}
+
+// Runs the task's function and marks it as finished, must be called without the mutex held
+void TaskGraph::RunTask(TaskID task, bool onMainThread) {
+    // Nothing else touches a running task's function, context or times
+    Task& runningTask = this->tasks[task];
+    runningTask.ranOnMainThread = onMainThread;
+    runningTask.startTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs() - this->runStartTimeInSecs;
+    bool succeeded = runningTask.func(runningTask.context);
+    runningTask.endTimeInSecs   = BlammoTime::GetHighResolutionTimeInSecs() - this->runStartTimeInSecs;
+
+    SDL_mutexP(this->mutex);
+    this->FinishTask(task, succeeded);
+    SDL_mutexV(this->mutex);
+}
+
+int TaskGraph::WorkerThreadMain(void* data) {
+    TaskGraph* graph = static_cast<TaskGraph*>(data);
+
+    SDL_mutexP(graph->mutex);
+    for (;;) {
+        while (!graph->isShuttingDown && graph->readyWorkerTasks.empty()) {
+            SDL_CondWait(graph->workAvailableCond, graph->mutex);
+        }
+        if (graph->isShuttingDown) {
+            break;
+        }
+
+        TaskID nextTask = *graph->readyWorkerTasks.begin();
+        graph->readyWorkerTasks.erase(graph->readyWorkerTasks.begin());
+        graph->tasks[nextTask].state = Running;
+        graph->numRunningTasks++;
+
+        SDL_mutexV(graph->mutex);
+        graph->RunTask(nextTask, false);
+        SDL_mutexP(graph->mutex);
+    }
+    SDL_mutexV(graph->mutex);
+
+    FrameProfiler::ReleaseThreadBuffer();
+    return 0;
+}
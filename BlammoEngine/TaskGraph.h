@@ -0,0 +1,141 @@
+/**
+ * TaskGraph.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __TASKGRAPH_H__
+#define __TASKGRAPH_H__
+
+#include "BasicIncludes.h"
+
+#include <deque>
+#include <set>
+
+/**
+ * A set of tasks with dependencies between them, each task is run as soon as all the tasks it
+ * depends on have finished. Tasks that can run on any thread are handed to worker threads that
+ * live for the length of Run, tasks that have to run on the main thread (e.g., anything that makes
+ * OpenGL calls) are run by the thread that called Run, in the order they were added.
+ *
+ * Unlike the JobSystem this is meant for a handful of long, dissimilar pieces of work (e.g.,
+ * loading the game) rather than splitting up one loop. If a task fails then every task that
+ * depends on it is skipped, everything else still gets run.
+ */
+class TaskGraph {
+public:
+    // Does the work for a task, returns false if it failed
+    typedef bool (*TaskFunc)(void* context);
+    typedef size_t TaskID;
+
+    enum ThreadAffinity { AnyThread, MainThread };
+
+    // Told about every task once it's done, always on the thread that called Run
+    class Listener {
+    public:
+        virtual ~Listener() {}
+        virtual void TaskFinished(const TaskGraph& graph, TaskID task, bool succeeded) = 0;
+    };
+
+    TaskGraph();
+    ~TaskGraph();
+
+    TaskID AddTask(const std::string& name, TaskFunc func, void* context, ThreadAffinity affinity);
+    void AddDependency(TaskID task, TaskID prerequisite);
+
+    // With no worker threads every task is run on the calling thread, one after the other
+    bool Run(int numWorkerThreads, Listener* listener);
+
+    size_t GetNumTasks() const { return this->tasks.size(); }
+    const std::string& GetTaskName(TaskID task) const;
+    bool GetTaskSucceeded(TaskID task) const;
+    double GetTaskTimeInSecs(TaskID task) const;
+    double GetRunTimeInSecs() const { return this->runTimeInSecs; }
+
+    void WriteTimingReport(std::ostream& outStream) const;
+
+private:
+    enum TaskState { Waiting, Ready, Running, Succeeded, Failed, Skipped };
+
+    struct Task {
+        std::string name;
+        TaskFunc func;
+        void* context;
+        ThreadAffinity affinity;
+        std::vector<TaskID> dependents;
+        size_t numPrerequisites;
+        size_t numUnfinishedPrerequisites;
+        TaskState state;
+        bool ranOnMainThread;
+        double startTimeInSecs;  // Relative to the start of the run
+        double endTimeInSecs;
+    };
+
+    std::vector<Task> tasks;
+
+    // Everything below is guarded by the mutex while running
+    std::set<TaskID> readyWorkerTasks;  // Ordered so that earlier added tasks are run first
+    std::set<TaskID> readyMainTasks;
+    std::deque<TaskID> finishedTasks;   // Finished tasks that the listener hasn't been told about yet
+    size_t numFinishedTasks;
+    size_t numRunningTasks;
+    bool isShuttingDown;
+
+    SDL_mutex* mutex;
+    SDL_cond* workAvailableCond;   // Signalled when there's a task for the workers
+    SDL_cond* taskFinishedCond;    // Signalled when a task finishes or a main thread task becomes ready
+
+    double runStartTimeInSecs;
+    double runTimeInSecs;
+
+    void MakeReady(TaskID task);
+    void FinishTask(TaskID task, bool succeeded);
+    void SkipTask(TaskID task);
+    void RunTask(TaskID task, bool onMainThread);
+
+    static int WorkerThreadMain(void* data);
+
+    DISALLOW_COPY_AND_ASSIGN(TaskGraph);
+};
+
+inline const std::string& TaskGraph::GetTaskName(TaskID task) const {
+    assert(task < this->tasks.size());
+    return this->tasks[task].name;
+}
+
+inline bool TaskGraph::GetTaskSucceeded(TaskID task) const {
+    assert(task < this->tasks.size());
+    return this->tasks[task].state == Succeeded;
+}
+
+inline double TaskGraph::GetTaskTimeInSecs(TaskID task) const {
+    assert(task < this->tasks.size());
+    return this->tasks[task].endTimeInSecs - this->tasks[task].startTimeInSecs;
+}
+
+#endif // __TASKGRAPH_H__
@@ -71,33 +71,39 @@ TextLabel2D::~TextLabel2D() {
 void TextLabel2D::Draw(bool depthTestOn, float depth) {
 	assert(this->font != NULL);
 
+    // The text and its shadow are drawn together
+    TextureFontSet::BeginBatch();
+
 	// Draw drop shadow part
 	if (this->dropShadow.isSet) {
 		float dropAmt = static_cast<float>(this->GetHeight()) * this->dropShadow.amountPercentage;
-		glColor4f(this->dropShadow.colour.R(), this->dropShadow.colour.G(), this->dropShadow.colour.B(), this->colour.A());
 		this->font->OrthoPrint(Point3D(this->topLeftCorner, depth - 0.01f) + Vector3D(dropAmt, -dropAmt, 0), 
-													 this->text, depthTestOn, this->scale);
+		                       this->text, ColourRGBA(this->dropShadow.colour, this->colour.A()), depthTestOn, this->scale);
 	}
 
 	// Draw coloured text part
-	glColor4f(this->colour.R(), this->colour.G(), this->colour.B(), this->colour.A());
-	this->font->OrthoPrint(Point3D(this->topLeftCorner, depth), this->text, depthTestOn, this->scale);
+	this->font->OrthoPrint(Point3D(this->topLeftCorner, depth), this->text, this->colour, depthTestOn, this->scale);
+
+    TextureFontSet::EndBatch();
 }
 
 void TextLabel2D::Draw(float rotationInDegs) {
 	assert(this->font != NULL);
 
+    // The text and its shadow are drawn together
+    TextureFontSet::BeginBatch();
+
 	// Draw drop shadow part
 	if (this->dropShadow.isSet) {
 		float dropAmt = static_cast<float>(this->GetHeight()) * this->dropShadow.amountPercentage;
-		glColor4f(this->dropShadow.colour.R(), this->dropShadow.colour.G(), this->dropShadow.colour.B(), this->colour.A());
 		this->font->OrthoPrint(Point3D(this->topLeftCorner, -0.01f) + Vector3D(dropAmt, -dropAmt, 0), 
-                               this->text, rotationInDegs, this->scale);
+                               this->text, ColourRGBA(this->dropShadow.colour, this->colour.A()), rotationInDegs, this->scale);
 	}
 
 	// Draw coloured text part
-	glColor4f(this->colour.R(), this->colour.G(), this->colour.B(), this->colour.A());
-    this->font->OrthoPrint(Point3D(this->topLeftCorner, 0.0f), this->text, rotationInDegs, this->scale);
+    this->font->OrthoPrint(Point3D(this->topLeftCorner, 0.0f), this->text, this->colour, rotationInDegs, this->scale);
+
+    TextureFontSet::EndBatch();
 }
 
 void TextLabel2D::Draw3D(const Camera& camera, float rotationInDegs, float z) {
@@ -185,19 +191,22 @@ std::string TextLabel2DFixedWidth::GetText() const {
 }
 
 void TextLabel2DFixedWidth::Draw() {
+    // All the lines (and their shadows) are drawn together
+    TextureFontSet::BeginBatch();
+
 	// Draw drop shadow part
 	if (this->dropShadow.isSet) {
         float dropAmt = static_cast<float>(this->font->GetHeight()) * this->dropShadow.amountPercentage;
-		glColor4f(this->dropShadow.colour.R(), this->dropShadow.colour.G(), this->dropShadow.colour.B(), this->colour.A());
-        this->DrawTextLines(dropAmt, -dropAmt);
+        this->DrawTextLines(dropAmt, -dropAmt, ColourRGBA(this->dropShadow.colour, this->colour.A()));
 	}
 
 	// Draw coloured text part
-	glColor4f(this->colour.R(), this->colour.G(), this->colour.B(), this->colour.A());
-	this->DrawTextLines(0, 0);
+	this->DrawTextLines(0, 0, this->colour);
+
+    TextureFontSet::EndBatch();
 }
 
-void TextLabel2DFixedWidth::DrawTextLines(float xOffset, float yOffset) {
+void TextLabel2DFixedWidth::DrawTextLines(float xOffset, float yOffset, const ColourRGBA& colour) {
     Point3D currTextTopLeftPos(this->topLeftCorner[0] + xOffset, this->topLeftCorner[1] + yOffset, 0);
 
     switch (this->alignment) {
@@ -216,7 +225,7 @@ void TextLabel2DFixedWidth::DrawTextLines(float xOffset, float yOffset) {
 
                     const std::string& currLineTxt = *iter;
                     currTopLeftCorner[0] = currTextTopLeftPos[0] + ((maxWidth - (this->scale * this->font->GetWidth(currLineTxt))) / 2.0f);
-                    this->font->OrthoPrint(currTopLeftCorner, currLineTxt, false, this->scale);
+                    this->font->OrthoPrint(currTopLeftCorner, currLineTxt, colour, false, this->scale);
                     currTopLeftCorner[1] -= (this->scale * this->font->GetHeight() + this->lineSpacing);
                 }
             }
@@ -228,7 +237,7 @@ void TextLabel2DFixedWidth::DrawTextLines(float xOffset, float yOffset) {
                  iter != this->textLines.end(); ++iter) {
 
                 const std::string& currLineTxt = *iter;
-                this->font->OrthoPrint(currTextTopLeftPos, currLineTxt, false, this->scale);
+                this->font->OrthoPrint(currTextTopLeftPos, currLineTxt, colour, false, this->scale);
                 currTextTopLeftPos[1] -= (this->scale * this->font->GetHeight() + this->lineSpacing);
             }
 
@@ -241,7 +250,7 @@ void TextLabel2DFixedWidth::DrawTextLines(float xOffset, float yOffset) {
                     
                     const std::string& currLineTxt = *iter;
                     currTextTopLeftPos[0] = baseTopLeftX - (this->scale * this->font->GetWidth(currLineTxt));
-                    this->font->OrthoPrint(currTextTopLeftPos, currLineTxt, false, this->scale);
+                    this->font->OrthoPrint(currTextTopLeftPos, currLineTxt, colour, false, this->scale);
                     currTextTopLeftPos[1] -= (this->scale * this->font->GetHeight() + this->lineSpacing);
                 }
             }
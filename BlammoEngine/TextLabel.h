@@ -254,7 +254,7 @@ private:
     float currTextWidth;
     std::vector<std::string> textLines;
 
-    void DrawTextLines(float xOffset, float yOffset);
+    void DrawTextLines(float xOffset, float yOffset, const ColourRGBA& colour);
 
     DISALLOW_COPY_AND_ASSIGN(TextLabel2DFixedWidth);
 };
@@ -31,6 +31,82 @@
 
 #include "Texture.h"
 
+SDL_mutex* Texture::imageLibraryMutex = NULL;
+
+/**
+ * Initialize DevIL for loading images into OpenGL textures, this requires an OpenGL context.
+ */
+void Texture::InitImageLibrary() {
+	ilInit();
+	iluInit();
+	ILboolean ilResult = ilutRenderer(ILUT_OPENGL);
+	assert(ilResult);
+	ilResult = ilutEnable(ILUT_OPENGL_CONV);
+	assert(ilResult);
+	UNUSED_VARIABLE(ilResult);
+
+	if (Texture::imageLibraryMutex == NULL) {
+		Texture::imageLibraryMutex = SDL_CreateMutex();
+	}
+}
+
+void Texture::ShutdownImageLibrary() {
+	if (Texture::imageLibraryMutex != NULL) {
+		SDL_DestroyMutex(Texture::imageLibraryMutex);
+		Texture::imageLibraryMutex = NULL;
+	}
+}
+
+/**
+ * Any use of DevIL must be wrapped in a lock/unlock of the image library since images
+ * may be decoded on the asset streaming threads at the same time.
+ */
+void Texture::LockImageLibrary() {
+	if (Texture::imageLibraryMutex != NULL) {
+		SDL_mutexP(Texture::imageLibraryMutex);
+	}
+}
+
+void Texture::UnlockImageLibrary() {
+	if (Texture::imageLibraryMutex != NULL) {
+		SDL_mutexV(Texture::imageLibraryMutex);
+	}
+}
+
+/**
+ * Decode the given image file buffer into RGBA pixels without touching OpenGL - this is safe
+ * to call from any thread. The caller takes ownership of the returned image.
+ * Returns: The decoded image on success, NULL otherwise.
+ */
+Texture::DecodedImage* Texture::DecodeImageFromBuffer(const unsigned char* fileBuffer, long fileBufferLength) {
+	DecodedImage* image = NULL;
+
+	Texture::LockImageLibrary();
+	int imageID = ilGenImage();
+	ilBindImage(imageID);
+
+	ILboolean resultOfImageLoad = ilLoadL(IL_TYPE_UNKNOWN, const_cast<unsigned char*>(fileBuffer), fileBufferLength);
+	if (resultOfImageLoad) {
+		// Flip the image the same way ilut does when it uploads an image itself
+		if (ilGetInteger(IL_IMAGE_ORIGIN) != IL_ORIGIN_LOWER_LEFT) {
+			iluFlipImage();
+		}
+
+		if (ilConvertImage(IL_RGBA, IL_UNSIGNED_BYTE)) {
+			image = new DecodedImage(ilGetInteger(IL_IMAGE_WIDTH), ilGetInteger(IL_IMAGE_HEIGHT));
+			memcpy(image->pixels, ilGetData(), 4 * image->width * image->height);
+		}
+	}
+	else {
+		debug_output("Failed to decode texture image.");
+	}
+
+	ilDeleteImage(imageID);
+	Texture::UnlockImageLibrary();
+
+	return image;
+}
+
 Texture::Texture(TextureFilterType texFilter, int textureType) : texFilter(texFilter), textureType(textureType), texID(0) {
 }
 
@@ -206,6 +282,44 @@ bool Texture::Load2DOr1DTextureFromBuffer(unsigned char* fileBuffer, long fileBu
 	return this->texID != 0;
 }
 
+/**
+ * Upload an already decoded image as this texture, only the OpenGL work happens here.
+ */
+bool Texture::Load2DTextureFromDecodedImage(const DecodedImage& image, Texture::TextureFilterType texFilter) {
+	assert(this->textureType == GL_TEXTURE_2D);
+
+	this->width  = image.width;
+	this->height = image.height;
+
+	glGenTextures(1, &this->texID);
+	glBindTexture(this->textureType, this->texID);
+
+	if (Texture::IsMipmappedFilter(texFilter)) {
+		GLint result = gluBuild2DMipmaps(this->textureType, GL_RGBA, image.width, image.height, GL_RGBA, GL_UNSIGNED_BYTE, image.pixels);
+
+		assert(result == 0);
+		if (result != 0) {
+			debug_output("Failed to load mipmaps for image.");
+			glBindTexture(this->textureType, 0);
+			return false;
+		}
+	}
+	else {
+		glTexImage2D(this->textureType, 0, GL_RGBA, image.width, image.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image.pixels);
+	}
+
+	// Set texture wrap/clamp params
+	glTexParameteri(this->textureType, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(this->textureType, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+	// Set texture filtering
+	Texture::SetFilteringParams(texFilter, this->textureType);
+	glBindTexture(this->textureType, 0);
+
+	debug_opengl_state();
+	return this->texID != 0;
+}
+
 bool Texture::Load2DOr1DTextureFromImg(PHYSFS_File* fileHandle, TextureFilterType texFilter) {
 	assert(this->textureType == GL_TEXTURE_2D || this->textureType == GL_TEXTURE_1D);
 	
@@ -40,6 +40,25 @@ class Texture {
 public:
 	enum TextureFilterType { Nearest, Linear, NearestMipmap, Bilinear, Trilinear };
 
+	// RGBA pixels of an image file that has been decoded but not yet uploaded to the graphics card -
+	// decoding can happen on any thread, the upload must happen on the thread with the OpenGL context
+	struct DecodedImage {
+		int width, height;
+		unsigned char* pixels;
+
+		DecodedImage(int width, int height) : width(width), height(height), pixels(new unsigned char[4*width*height]) {}
+		~DecodedImage() { delete[] this->pixels; }
+
+	private:
+		DISALLOW_COPY_AND_ASSIGN(DecodedImage);
+	};
+
+	static void InitImageLibrary();
+	static void ShutdownImageLibrary();
+	static void LockImageLibrary();
+	static void UnlockImageLibrary();
+	static DecodedImage* DecodeImageFromBuffer(const unsigned char* fileBuffer, long fileBufferLength);
+
 protected:
 	TextureFilterType texFilter;
 	int textureType;
@@ -54,6 +73,7 @@ protected:
 	bool Load2DOr1DTextureFromBuffer(unsigned char* fileBuffer, long fileBufferLength, TextureFilterType texFilter = Nearest);
 	bool Load2DOr1DTextureFromImg(const std::string& filepath, TextureFilterType texFilter = Nearest);
 	bool Load2DOr1DTextureFromImg(PHYSFS_File* fileHandle, TextureFilterType texFilter = Nearest);
+	bool Load2DTextureFromDecodedImage(const DecodedImage& image, TextureFilterType texFilter = Nearest);
 
 public:
 	Texture(TextureFilterType texFilter, int textureType);
@@ -102,6 +122,10 @@ public:
 		glGenerateMipmapEXT(this->textureType);
 	}
 
+private:
+	// DevIL keeps its bound image as global state so only one thread may use it at a time
+	static SDL_mutex* imageLibraryMutex;
+
 };
 
 #endif
\ No newline at end of file
@@ -41,7 +41,11 @@ Texture1D* Texture1D::CreateTexture1DFromBuffer(unsigned char* fileBuffer, long
 	glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
 
 	Texture1D* newTex = new Texture1D(texFilter);
-	if (!newTex->Load2DOr1DTextureFromBuffer(fileBuffer, fileBufferLength, texFilter)) {
+	Texture::LockImageLibrary();
+	bool success = newTex->Load2DOr1DTextureFromBuffer(fileBuffer, fileBufferLength, texFilter);
+	Texture::UnlockImageLibrary();
+
+	if (!success) {
 		delete newTex;
 		newTex = NULL;
 	}
@@ -57,7 +61,11 @@ Texture1D* Texture1D::CreateTexture1DFromImgFile(const std::string& filepath, Te
 	glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
 
 	Texture1D* newTex = new Texture1D(texFilter);
-	if (!newTex->Load2DOr1DTextureFromImg(filepath, texFilter)) {
+	Texture::LockImageLibrary();
+	bool success = newTex->Load2DOr1DTextureFromImg(filepath, texFilter);
+	Texture::UnlockImageLibrary();
+
+	if (!success) {
 		delete newTex;
 		newTex = NULL;
 	}
@@ -70,7 +78,11 @@ Texture1D* Texture1D::CreateTexture1DFromImgFile(PHYSFS_File* fileHandle, Textur
 	glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
 
 	Texture1D* newTex = new Texture1D(texFilter);
-	if (!newTex->Load2DOr1DTextureFromImg(fileHandle, texFilter)) {
+	Texture::LockImageLibrary();
+	bool success = newTex->Load2DOr1DTextureFromImg(fileHandle, texFilter);
+	Texture::UnlockImageLibrary();
+
+	if (!success) {
 		delete newTex;
 		newTex = NULL;
 	}
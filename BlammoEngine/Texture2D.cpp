@@ -148,7 +148,11 @@ Texture2D* Texture2D::CreateTexture2DFromBuffer(unsigned char* fileBuffer, long
 	glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
 	
 	Texture2D* newTex = new Texture2D(texFilter);
-	if (!newTex->Load2DOr1DTextureFromBuffer(fileBuffer, fileBufferLength, texFilter)) {
+	Texture::LockImageLibrary();
+	bool success = newTex->Load2DOr1DTextureFromBuffer(fileBuffer, fileBufferLength, texFilter);
+	Texture::UnlockImageLibrary();
+
+	if (!success) {
 		delete newTex;
 		newTex = NULL;
 	}
@@ -167,7 +171,11 @@ Texture2D* Texture2D::CreateTexture2DFromImgFile(const std::string& filepath, Te
 	glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
 	
 	Texture2D* newTex = new Texture2D(texFilter);
-	if (!newTex->Load2DOr1DTextureFromImg(filepath, texFilter)) {
+	Texture::LockImageLibrary();
+	bool success = newTex->Load2DOr1DTextureFromImg(filepath, texFilter);
+	Texture::UnlockImageLibrary();
+
+	if (!success) {
 		delete newTex;
 		newTex = NULL;
 	}
@@ -186,7 +194,31 @@ Texture2D* Texture2D::CreateTexture2DFromImgFile(PHYSFS_File* fileHandle, Textur
 	glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
 	
 	Texture2D* newTex = new Texture2D(texFilter);
-	if (!newTex->Load2DOr1DTextureFromImg(fileHandle, texFilter)) {
+	Texture::LockImageLibrary();
+	bool success = newTex->Load2DOr1DTextureFromImg(fileHandle, texFilter);
+	Texture::UnlockImageLibrary();
+
+	if (!success) {
+		delete newTex;
+		newTex = NULL;
+	}
+
+	glPopAttrib();
+	debug_opengl_state();
+
+	return newTex;
+}
+
+/**
+ * Static creator for making a 2D texture from an image that was already decoded (e.g., on
+ * one of the asset streaming threads), this only does the upload to the graphics card.
+ * Returns: 2D Texture with given image, NULL otherwise.
+ */
+Texture2D* Texture2D::CreateTexture2DFromDecodedImage(const DecodedImage& image, TextureFilterType texFilter) {
+	glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
+
+	Texture2D* newTex = new Texture2D(texFilter);
+	if (!newTex->Load2DTextureFromDecodedImage(image, texFilter)) {
 		delete newTex;
 		newTex = NULL;
 	}
@@ -198,9 +230,11 @@ Texture2D* Texture2D::CreateTexture2DFromImgFile(PHYSFS_File* fileHandle, Textur
 }
 
 /**
- * Static creator, for making a 2D texture given a true font bitmap.
+ * Static creator, for making a 2D texture given the 8-bit coverage bitmap of a rasterized
+ * true type font glyph (tightly packed, glyphWidth bytes per row).
  */
-Texture2D* Texture2D::CreateTexture2DFromFTBMP(const FT_Bitmap& bmp, TextureFilterType texFilter) {
+Texture2D* Texture2D::CreateTexture2DFromGlyphBitmap(const unsigned char* glyphBitmap, int glyphWidth, int glyphRows,
+                                                     TextureFilterType texFilter) {
 
 	// First create the texture
 	Texture2D* newTex = new Texture2D(texFilter);
@@ -213,8 +247,8 @@ Texture2D* Texture2D::CreateTexture2DFromFTBMP(const FT_Bitmap& bmp, TextureFilt
 	glPushAttrib(GL_TEXTURE_BIT);
 	
 	// Obtain the proper power of two width/height of the font
-	int width = std::max<int>(2, NumberFuncs::NextPowerOfTwo(bmp.width));
-	int height = std::max<int>(2, NumberFuncs::NextPowerOfTwo(bmp.rows));
+	int width = std::max<int>(2, NumberFuncs::NextPowerOfTwo(glyphWidth));
+	int height = std::max<int>(2, NumberFuncs::NextPowerOfTwo(glyphRows));
 	newTex->width = width;
 	newTex->height = height;
 
@@ -228,7 +262,7 @@ Texture2D* Texture2D::CreateTexture2DFromFTBMP(const FT_Bitmap& bmp, TextureFilt
 			// That Value Which We Use Will Be 0 If We Are In The Padding Zone, And Whatever
 			// Is The FreeType Bitmap Otherwise.
             expandedData[2*(i+j*width)] = 255;
-            expandedData[2*(i+j*width)+1] = (i >= bmp.width || j >= bmp.rows) ? 0 : bmp.buffer[i + bmp.width*j];
+            expandedData[2*(i+j*width)+1] = (i >= glyphWidth || j >= glyphRows) ? 0 : glyphBitmap[i + glyphWidth*j];
 		}
 	}
 
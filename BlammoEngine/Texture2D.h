@@ -51,7 +51,8 @@ public:
 	static Texture2D* CreateTexture2DFromBuffer(unsigned char* fileBuffer, long fileBufferLength, TextureFilterType texFilter);
 	static Texture2D* CreateTexture2DFromImgFile(PHYSFS_File* fileHandle, TextureFilterType texFilter);
 	static Texture2D* CreateTexture2DFromImgFile(const std::string& filepath, TextureFilterType texFilter);
-	static Texture2D* CreateTexture2DFromFTBMP(const FT_Bitmap& bmp, TextureFilterType texFilter);
+	static Texture2D* CreateTexture2DFromDecodedImage(const DecodedImage& image, TextureFilterType texFilter);
+	static Texture2D* CreateTexture2DFromGlyphBitmap(const unsigned char* glyphBitmap, int glyphWidth, int glyphRows, TextureFilterType texFilter);
 	static Texture2D* CreateEmptyTextureRectangle(int width, int height, Texture::TextureFilterType filter);
     static Texture2D* CreateEmptyDepthTextureRectangle(int width, int height);
 };
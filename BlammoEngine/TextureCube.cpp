@@ -111,7 +111,12 @@ bool TextureCube::LoadCubeTextureFromImgs(const std::string filepaths[NUM_CUBE_F
 TextureCube* TextureCube::CreateCubeTextureFromImgFiles(const std::string filepaths[NUM_CUBE_FACES], 
 		                                                    TextureFilterType texFilter) {
 	TextureCube* newTex = new TextureCube(texFilter);
-	if (newTex->LoadCubeTextureFromImgs(filepaths, texFilter)) {
+
+	Texture::LockImageLibrary();
+	bool success = newTex->LoadCubeTextureFromImgs(filepaths, texFilter);
+	Texture::UnlockImageLibrary();
+
+	if (success) {
 		return newTex;
 	}
 	else {
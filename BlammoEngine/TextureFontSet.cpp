@@ -32,6 +32,7 @@
 #include "TextureFontSet.h"
 #include "Texture2D.h"
 #include "Camera.h"
+#include "GlyphAtlas.h"
 
 #include "BasicIncludes.h"
 #include "Algebra.h"
@@ -39,15 +40,22 @@
 //const unsigned char TextureFontSet::MAX_NUM_CHARS = 128;
 const float TextureFontSet::TEXT_3D_SCALE	= 0.04;
 
-TextureFontSet::TextureFontSet() : numGlyphs(0), heightInPixels(0) {
+int TextureFontSet::batchDepth = 0;
+std::vector<TextureFontSet::TextBatchGroup> TextureFontSet::batchGroups;
+
+TextureFontSet::TextureFontSet() : numGlyphs(0), heightInPixels(0), atlas(NULL), atlasTexture(NULL) {
 }
 
 TextureFontSet::~TextureFontSet() {
-	// Delete all the textures
-	for (int i = 0; i < static_cast<int>(this->charTextures.size()); i++) {
-		delete this->charTextures[i];
-	}
-	this->charTextures.clear();
+	// Any batched text would be drawn with a deleted texture
+	assert(!TextureFontSet::IsBatching());
+
+	this->ClearLayoutCache();
+
+	delete this->atlasTexture;
+	this->atlasTexture = NULL;
+	delete this->atlas;
+	this->atlas = NULL;
 }
 
 /**
@@ -142,17 +150,157 @@ std::vector<std::string> TextureFontSet::ParseTextToWidth(const std::string& s,
  * Returns: The length of the printed text.
  */
 void TextureFontSet::OrthoPrint(const Point3D& topLeftCorner, const std::string& s, bool depthTestOn, float scale) const {
+	this->OrthoPrintLayout(topLeftCorner, s, NULL, depthTestOn, 0.0f, scale);
+}
+
+void TextureFontSet::OrthoPrint(const Point3D& topLeftCorner, const std::string& s, 
+                                 float rotationInDegs, float scale) const {
+	this->OrthoPrintLayout(topLeftCorner, s, NULL, false, rotationInDegs, scale);
+}
+
+void TextureFontSet::OrthoPrint(const Point3D& topLeftCorner, const std::string& s, const ColourRGBA& colour,
+                                 bool depthTestOn, float scale) const {
+	const float colourArray[4] = { colour.R(), colour.G(), colour.B(), colour.A() };
+	this->OrthoPrintLayout(topLeftCorner, s, colourArray, depthTestOn, 0.0f, scale);
+}
+
+void TextureFontSet::OrthoPrint(const Point3D& topLeftCorner, const std::string& s, const ColourRGBA& colour,
+                                 float rotationInDegs, float scale) const {
+	const float colourArray[4] = { colour.R(), colour.G(), colour.B(), colour.A() };
+	this->OrthoPrintLayout(topLeftCorner, s, colourArray, false, rotationInDegs, scale);
+}
+
+/** 
+ * A 3D version of printing text - this will print the text to a billboard that 
+ * it initially centered at the origin and pointing in the direction of the z-axis,
+ * with an up vector in the direction of +y.
+ * Returns: text length in units.
+ */
+void TextureFontSet::Print(const std::string& s) const {
 	assert(s.find('\n') == std::string::npos);
 	assert(s.find('\r') == std::string::npos);
 
+	// Draw the text
+	glPushMatrix();
+	glScalef(TextureFontSet::TEXT_3D_SCALE, TextureFontSet::TEXT_3D_SCALE, TextureFontSet::TEXT_3D_SCALE);
+	this->DrawLayout(this->GetLayout(s));
+	glPopMatrix();
+}
+
+/**
+ * Draws the given string, in font pixels, with whatever transform and state is currently set.
+ */
+void TextureFontSet::BasicPrint(const std::string& s) const {
+	this->DrawLayout(this->GetLayout(s));
+}
+
+/**
+ * Obtain the layout (quads) of the given string in this font. Layouts are cached so that
+ * strings that are drawn over and over again (e.g., labels) are only ever laid out once,
+ * strings that change every frame (e.g., counters) only push out the least recently used ones.
+ */
+const TextLayout& TextureFontSet::GetLayout(const std::string& s) const {
+	if (this->atlas == NULL) {
+		// The font failed to build, there's nothing to draw
+		assert(false);
+		static const TextLayout EMPTY_LAYOUT;
+		return EMPTY_LAYOUT;
+	}
+
+	std::map<std::string, CachedLayout>::iterator findIter = this->layoutCache.find(s);
+	if (findIter != this->layoutCache.end()) {
+		this->layoutUsage.splice(this->layoutUsage.begin(), this->layoutUsage, findIter->second.usageIter);
+		return *findIter->second.layout;
+	}
+
+	if (this->layoutCache.size() >= MAX_NUM_CACHED_LAYOUTS) {
+		std::map<std::string, CachedLayout>::iterator evictIter = this->layoutCache.find(this->layoutUsage.back());
+		assert(evictIter != this->layoutCache.end());
+		delete evictIter->second.layout;
+		this->layoutCache.erase(evictIter);
+		this->layoutUsage.pop_back();
+	}
+
+	CachedLayout cachedLayout;
+	cachedLayout.layout = new TextLayout();
+	this->atlas->LayoutText(s, *cachedLayout.layout);
+	this->layoutUsage.push_front(s);
+	cachedLayout.usageIter = this->layoutUsage.begin();
+	this->layoutCache.insert(std::make_pair(s, cachedLayout));
+	return *cachedLayout.layout;
+}
+
+/**
+ * Start batching ortho text, nothing printed with OrthoPrint is drawn until the
+ * matching EndBatch. Only batch text that doesn't need to be drawn in order with
+ * anything else in between (e.g., a list of menu items or labels over a background).
+ */
+void TextureFontSet::BeginBatch() {
+	TextureFontSet::batchDepth++;
+}
+
+/**
+ * Ends a batch that was started with BeginBatch, the ortho text printed since the
+ * outer-most batch began is drawn.
+ */
+void TextureFontSet::EndBatch() {
+	assert(TextureFontSet::batchDepth > 0);
+	TextureFontSet::batchDepth--;
+	if (TextureFontSet::batchDepth == 0) {
+		TextureFontSet::FlushBatch();
+	}
+}
+
+// Prints the given string in the given colour, or the current colour if the given one is NULL
+void TextureFontSet::OrthoPrintLayout(const Point3D& topLeftCorner, const std::string& s, const float* colour,
+                                      bool depthTestOn, float rotationInDegs, float scale) const {
+	assert(s.find('\n') == std::string::npos);
+	assert(s.find('\r') == std::string::npos);
+
+	const TextLayout& layout = this->GetLayout(s);
+	if (layout.IsEmpty()) {
+		return;
+	}
+
+	if (TextureFontSet::IsBatching()) {
+		// Strings that share a font and depth testing are drawn together, in the order they were printed
+		TextBatchGroup* group = NULL;
+		for (std::vector<TextBatchGroup>::iterator iter = TextureFontSet::batchGroups.begin();
+			 iter != TextureFontSet::batchGroups.end(); ++iter) {
+			if (iter->texture == this->atlasTexture && iter->depthTestOn == depthTestOn) {
+				group = &(*iter);
+				break;
+			}
+		}
+		if (group == NULL) {
+			TextureFontSet::batchGroups.push_back(TextBatchGroup());
+			group = &TextureFontSet::batchGroups.back();
+			group->texture = this->atlasTexture;
+			group->depthTestOn = depthTestOn;
+		}
+
+		// Without a colour the text takes on the current one, just like it does when it's drawn right away
+		float currColour[4];
+		if (colour == NULL) {
+			glGetFloatv(GL_CURRENT_COLOR, currColour);
+			colour = currColour;
+		}
+		GlyphAtlas::AppendTransformedLayout(layout, topLeftCorner[0], topLeftCorner[1] - this->heightInPixels*scale,
+			topLeftCorner[2], rotationInDegs, scale, colour, group->vertices);
+		return;
+	}
+
 	// Make world coordinates equal window coordinates
 	Camera::PushWindowCoords();
 
 	// Prepare OGL for drawing the text
-	glPushAttrib(GL_LIST_BIT | GL_CURRENT_BIT | GL_ENABLE_BIT | GL_TRANSFORM_BIT | GL_COLOR_BUFFER_BIT); 
+	glPushAttrib(GL_CURRENT_BIT | GL_ENABLE_BIT | GL_TRANSFORM_BIT | GL_COLOR_BUFFER_BIT); 
 
 	glMatrixMode(GL_MODELVIEW);
 	glEnable(GL_TEXTURE_2D);
+	if (colour != NULL) {
+		glColor4fv(colour);
+	}
 
 	if (depthTestOn) {
 		glEnable(GL_DEPTH_TEST);
@@ -166,12 +314,13 @@ void TextureFontSet::OrthoPrint(const Point3D& topLeftCorner, const std::string&
 	glPushMatrix();
 	glLoadIdentity();
 	glTranslatef(topLeftCorner[0], topLeftCorner[1] - this->heightInPixels*scale, topLeftCorner[2]);
+	if (rotationInDegs != 0.0f) {
+		glRotatef(rotationInDegs, 0, 0, 1);
+	}
 	glScalef(scale, scale, 1.0f);
-	//glRasterPos2i(0, 0);
 
 	// Draw the text
-	glListBase(this->baseDisplayList);
-	glCallLists(s.length(), GL_UNSIGNED_BYTE, s.c_str());
+	this->DrawLayout(layout);
 
 	glPopMatrix();
 	glPopAttrib();  
@@ -180,62 +329,84 @@ void TextureFontSet::OrthoPrint(const Point3D& topLeftCorner, const std::string&
 	Camera::PopWindowCoords();
 	
 	debug_opengl_state();
+}
 
+// Draws all the quads of the given layout in one call with the atlas texture
+void TextureFontSet::DrawLayout(const TextLayout& layout) const {
+	if (layout.IsEmpty()) {
+		return;
+	}
+	assert(this->atlasTexture != NULL);
+	this->atlasTexture->BindTexture();
+
+	static const GLsizei STRIDE = TextLayout::NUM_FLOATS_PER_VERTEX * sizeof(float);
+	glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glVertexPointer(2, GL_FLOAT, STRIDE, &layout.vertices[0]);
+	glTexCoordPointer(2, GL_FLOAT, STRIDE, &layout.vertices[2]);
+	glDrawArrays(GL_QUADS, 0, static_cast<GLsizei>(layout.GetNumVertices()));
+	glPopClientAttrib();
 }
 
-void TextureFontSet::OrthoPrint(const Point3D& topLeftCorner, const std::string& s, 
-                                 float rotationInDegs, float scale) const {
-	assert(s.find('\n') == std::string::npos);
-	assert(s.find('\r') == std::string::npos);
+void TextureFontSet::ClearLayoutCache() const {
+	for (std::map<std::string, CachedLayout>::iterator iter = this->layoutCache.begin();
+		 iter != this->layoutCache.end(); ++iter) {
+		delete iter->second.layout;
+	}
+	this->layoutCache.clear();
+	this->layoutUsage.clear();
+}
+
+// Draws all the ortho text that was batched, one call per font and depth testing combination
+void TextureFontSet::FlushBatch() {
+	if (TextureFontSet::batchGroups.empty()) {
+		return;
+	}
 
 	// Make world coordinates equal window coordinates
 	Camera::PushWindowCoords();
 
-	// Prepare OGL for drawing the text
-	glPushAttrib(GL_LIST_BIT | GL_CURRENT_BIT | GL_ENABLE_BIT | GL_TRANSFORM_BIT | GL_COLOR_BUFFER_BIT); 
-
+	glPushAttrib(GL_CURRENT_BIT | GL_ENABLE_BIT | GL_TRANSFORM_BIT | GL_COLOR_BUFFER_BIT); 
 	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glLoadIdentity();
+
 	glEnable(GL_TEXTURE_2D);
-	glDisable(GL_DEPTH_TEST);
 	glEnable(GL_BLEND);
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);    
+	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+	static const GLsizei STRIDE = GlyphAtlas::NUM_FLOATS_PER_BATCH_VERTEX * sizeof(float);
+	glPushClientAttrib(GL_CLIENT_VERTEX_ARRAY_BIT);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+
+	for (std::vector<TextBatchGroup>::const_iterator iter = TextureFontSet::batchGroups.begin();
+		 iter != TextureFontSet::batchGroups.end(); ++iter) {
+		const TextBatchGroup& group = *iter;
+		if (group.depthTestOn) {
+			glEnable(GL_DEPTH_TEST);
+		}
+		else {
+			glDisable(GL_DEPTH_TEST);
+		}
+		group.texture->BindTexture();
 
-	glPushMatrix();
-	glLoadIdentity();
-	glTranslatef(topLeftCorner[0], topLeftCorner[1] - this->heightInPixels*scale, topLeftCorner[2]);
-	glRotatef(rotationInDegs, 0, 0, 1);
-    glScalef(scale, scale, 1.0f);
-	//glRasterPos2i(0, 0);
+		glVertexPointer(3, GL_FLOAT, STRIDE, &group.vertices[0]);
+		glTexCoordPointer(2, GL_FLOAT, STRIDE, &group.vertices[3]);
+		glColorPointer(4, GL_FLOAT, STRIDE, &group.vertices[5]);
+		glDrawArrays(GL_QUADS, 0, static_cast<GLsizei>(group.vertices.size() / GlyphAtlas::NUM_FLOATS_PER_BATCH_VERTEX));
+	}
 
-	// Draw the text
-	glListBase(this->baseDisplayList);
-	glCallLists(s.length(), GL_UNSIGNED_BYTE, s.c_str());
-	
+	glPopClientAttrib();
 	glPopMatrix();
-	glPopAttrib();  
+	glPopAttrib();
 
-	// Pop the projection matrix
 	Camera::PopWindowCoords();
-	
-	debug_opengl_state();
-}
+	TextureFontSet::batchGroups.clear();
 
-/** 
- * A 3D version of printing text - this will print the text to a billboard that 
- * it initially centered at the origin and pointing in the direction of the z-axis,
- * with an up vector in the direction of +y.
- * Returns: text length in units.
- */
-void TextureFontSet::Print(const std::string& s) const {
-	assert(s.find('\n') == std::string::npos);
-	assert(s.find('\r') == std::string::npos);
-
-	// Draw the text
-	glPushMatrix();
-	glScalef(TextureFontSet::TEXT_3D_SCALE, TextureFontSet::TEXT_3D_SCALE, TextureFontSet::TEXT_3D_SCALE);
-	glListBase(this->baseDisplayList);
-	glCallLists(s.length(), GL_UNSIGNED_BYTE, s.c_str());
-	glPopMatrix();
+	debug_opengl_state();
 }
 
 /**
@@ -368,46 +539,75 @@ std::map<unsigned int, TextureFontSet*> TextureFontSet::CreateTextureFontFromTTF
 std::map<unsigned int, TextureFontSet*> TextureFontSet::CreateTextureFontFromBuffer(unsigned char* buffer, long length,
                                                                                     const std::vector<unsigned int>& heightsInPixels,
                                                                                     Texture::TextureFilterType filterType) {
-	std::map<unsigned int, TextureFontSet*> newFontSets;
+	std::vector<BakedFont> bakedFonts;
+	if (!TextureFontSet::BakeFontFromBuffer(buffer, length, heightsInPixels, bakedFonts)) {
+		return std::map<unsigned int, TextureFontSet*>();
+	}
+	return TextureFontSet::CreateTextureFontFromBakedFonts(bakedFonts, filterType);
+}
+
+/**
+ * Rasterizes every glyph of the given in-memory true type font at each of the given heights. This only
+ * uses freetype (no OpenGL) so it can be done on any thread and the results can be stored for later.
+ * Returns: true on success, false otherwise.
+ */
+bool TextureFontSet::BakeFontFromBuffer(const unsigned char* buffer, long length,
+                                        const std::vector<unsigned int>& heightsInPixels,
+                                        std::vector<BakedFont>& bakedFonts) {
+	bakedFonts.clear();
 
 	// Create And Initilize A FreeType Font Library.
 	FT_Library library;
 	if (FT_Init_FreeType(&library)) {
 		debug_output("Could not initialize a freetype font library!");
 		FT_Done_FreeType(library);
-		return newFontSets;
+		return false;
 	}
 
 	// A Face Holds Information On A Given Font
 	FT_Face face;
-
-	// This Is Where We Load In The Font Information From The File.
-	// Of All The Places Where The Code Might Die, This Is The Most Likely,
-	// As FT_New_Face Will Fail If The Font File Does Not Exist Or Is Somehow Broken.
 	if (FT_New_Memory_Face(library, buffer, length, 0, &face)) {
 		debug_output("FT_New_Face failed - there is probably a problem with the physfs font.");
 		FT_Done_Face(face);
 		FT_Done_FreeType(library);
-		return newFontSets;
+		return false;
 	}
 
-	// Go through each height and load that font
-	for (unsigned int i = 0; i < heightsInPixels.size(); i++) {
-		TextureFontSet* newFontSet = new TextureFontSet();
-		unsigned int currHeight = heightsInPixels[i];
-		TextureFontSet::CreateTextureFromFontLib(newFontSet, face, currHeight, filterType);
-		
-		assert(newFontSet != NULL);
-		assert(newFontSets.find(currHeight) == newFontSets.end());
-		newFontSets[currHeight] = newFontSet;
+	bool success = true;
+	bakedFonts.resize(heightsInPixels.size());
+	for (size_t i = 0; i < heightsInPixels.size() && success; i++) {
+		success = TextureFontSet::BakeFontFromFace(face, heightsInPixels[i], bakedFonts[i]);
 	}
 
 	// Clean-up the ttf library stuff
 	FT_Done_Face(face);
 	FT_Done_FreeType(library);
 
+	if (!success) {
+		bakedFonts.clear();
+	}
+	return success;
+}
+
+/**
+ * Creates a Texture font set for each of the given baked fonts.
+ * Returns: A mapping of font heights to their newly created font sets.
+ */
+std::map<unsigned int, TextureFontSet*> TextureFontSet::CreateTextureFontFromBakedFonts(const std::vector<BakedFont>& bakedFonts,
+                                                                                        Texture::TextureFilterType filterType) {
+	std::map<unsigned int, TextureFontSet*> newFontSets;
+
+	for (std::vector<BakedFont>::const_iterator iter = bakedFonts.begin(); iter != bakedFonts.end(); ++iter) {
+		const BakedFont& currBakedFont = *iter;
+		TextureFontSet* newFontSet = new TextureFontSet();
+		TextureFontSet::CreateTextureFromBakedFont(newFontSet, currBakedFont, filterType);
+
+		assert(newFontSets.find(currBakedFont.heightInPixels) == newFontSets.end());
+		newFontSets[currBakedFont.heightInPixels] = newFontSet;
+	}
+
 	// Check to make sure creation went well
-	assert(newFontSets.size() == heightsInPixels.size());
+	assert(newFontSets.size() == bakedFonts.size());
 
 	return newFontSets;
 }
@@ -420,30 +620,38 @@ std::map<unsigned int, TextureFontSet*> TextureFontSet::CreateTextureFontFromBuf
 void TextureFontSet::CreateTextureFromFontLib(TextureFontSet* newFontSet,
                                               FT_Face face, unsigned int heightInPixels,
 											  Texture::TextureFilterType filterType) {
+	BakedFont bakedFont;
+	if (!TextureFontSet::BakeFontFromFace(face, heightInPixels, bakedFont)) {
+		return;
+	}
+	TextureFontSet::CreateTextureFromBakedFont(newFontSet, bakedFont, filterType);
+}
+
+/**
+ * Private helper function for rasterizing all the glyphs of a font from a library already setup.
+ * Returns: true on success, false otherwise.
+ */
+bool TextureFontSet::BakeFontFromFace(FT_Face face, unsigned int heightInPixels, BakedFont& bakedFont) {
 	assert(face != NULL);
 
 	// FreeType Measures Font Size In Terms Of 1/64ths Of Pixels.  
 	// Thus, To Make A Font h Pixels High, We Need To Request A Size Of h*64.
 	if (FT_Set_Char_Size(face, heightInPixels << 6, heightInPixels << 6, 96, 96)) {
 		debug_output("FT_Set_Char_Size failed - there is probably a problem with the font file.");
-		return;	
+		return false;
 	}
 
-	newFontSet->heightInPixels = heightInPixels;
 	long numGlyphs = std::max<long>(128, face->num_glyphs);
-	newFontSet->numGlyphs = numGlyphs;
-	newFontSet->charTextures.reserve(numGlyphs);
+	bakedFont.heightInPixels = heightInPixels;
+	bakedFont.glyphs.clear();
+	bakedFont.glyphs.resize(numGlyphs);
 
-	// Create the font set by making the texture and display list for
-	// each character in the font
-	newFontSet->baseDisplayList = glGenLists(numGlyphs);
-	glPushMatrix();
 	for (int i = 0; i < numGlyphs; i++) {	
 		// Render the current character into a bitmap
 		// Load the glyph for the character
 		if (FT_Load_Glyph(face, FT_Get_Char_Index(face, i), FT_LOAD_DEFAULT)) {
 			debug_output("Could not load the glyph for character: " << i << " in font set file.");
-			return;
+			return false;
 		}
 		
 		// Move The Face's Glyph Into A Glyph Object.
@@ -451,7 +659,7 @@ void TextureFontSet::CreateTextureFromFontLib(TextureFontSet* newFontSet,
 		if (FT_Get_Glyph(face->glyph, &glyph)) {
 			debug_output("Could not get glyph for character: " << i << " in font set file.");
 			FT_Done_Glyph(glyph);
-			return;			
+			return false;
 		}
 
 		// Convert The Glyph To A Bitmap.
@@ -459,70 +667,58 @@ void TextureFontSet::CreateTextureFromFontLib(TextureFontSet* newFontSet,
 		FT_BitmapGlyph bitmap_glyph = (FT_BitmapGlyph)glyph;
 
 		// This Reference Will Make Accessing The Bitmap Easier.
-		FT_Bitmap& bitmap = bitmap_glyph->bitmap;
-		Texture2D* newCharTexture = NULL;
-		
-		// Create a texture for the current character only if there's data in the buffer...
-		if (bitmap.width > 0 && bitmap.rows > 0 && bitmap.buffer != NULL) {
-			newCharTexture = Texture2D::CreateTexture2DFromFTBMP(bitmap, filterType);
+		const FT_Bitmap& bitmap = bitmap_glyph->bitmap;
 
-			if (newCharTexture == NULL) {
-				debug_output("Could not create texture from bitmap for character: " << i << " in font set file.");
-				FT_Done_Glyph(glyph);
-				return;
-			}
-			
-			newFontSet->charTextures.push_back(newCharTexture);
-		}
+		BakedGlyph& bakedGlyph = bakedFont.glyphs[i];
+		bakedGlyph.advance = face->glyph->advance.x >> 6;
 
-		// Create the display list for the character as well - in the case where there's no texture
-		// all we're interested in is advancing, via translation, the current display list
-		glNewList(newFontSet->baseDisplayList + i, GL_COMPILE);
-		if (newCharTexture != NULL) {
-			newCharTexture->BindTexture();
-			glPushMatrix();
-
-			// Move the character over so that it has the right
-			// amount of space between it and the one before
-			glTranslatef(bitmap_glyph->left, 0, 0);
-
-			// Now We Move Down A Little In The Case That The Bitmap Extends Past The Bottom Of The Line 
-			// This Is Only True For Characters Like 'g' Or 'y'.
-			glTranslatef(0, bitmap_glyph->top - bitmap.rows, 0);
-
-			// Textures Are Filled With Empty Padding Space. We Figure What Portion Of The Texture Is Used By 
-			// The Actual Character And Store That Information In The x And y Variables, Then When We Draw The
-			// Quad, We Will Only Reference The Parts Of The Texture That Contains The Character Itself.
-			int width		= NumberFuncs::NextPowerOfTwo(bitmap.width);
-			int height	= NumberFuncs::NextPowerOfTwo(bitmap.rows);
-			float x = static_cast<float>(bitmap.width) / static_cast<float>(width);
-			float y = static_cast<float>(bitmap.rows)  / static_cast<float>(height);
-
-			// Draw The Texturemapped Quads. The Bitmap That We Got From FreeType Was Not 
-			// Oriented Quite Like We Would Like It To Be, But We Link The Texture To The Quad
-			// In Such A Way That The Result Will Be Properly Aligned.
-			glBegin(GL_QUADS);
-			glTexCoord2d(0, 0); glVertex2f(0, bitmap.rows);
-			glTexCoord2d(0, y); glVertex2f(0, 0);
-			glTexCoord2d(x, y); glVertex2f(bitmap.width, 0);
-			glTexCoord2d(x, 0); glVertex2f(bitmap.width, bitmap.rows);
-			glEnd();
-			glPopMatrix();
+		// Only keep the bitmap when there's data in the buffer...
+		if (bitmap.width > 0 && bitmap.rows > 0 && bitmap.buffer != NULL) {
+			bakedGlyph.left   = bitmap_glyph->left;
+			bakedGlyph.top    = bitmap_glyph->top;
+			bakedGlyph.width  = bitmap.width;
+			bakedGlyph.rows   = bitmap.rows;
+			bakedGlyph.bitmap.assign(bitmap.buffer, bitmap.buffer + bitmap.width * bitmap.rows);
 		}
 
-		float charWidth = face->glyph->advance.x >> 6;
-		newFontSet->widthOfChars.push_back(charWidth);
-		glTranslatef(charWidth, 0, 0);
-		// Increment The Raster Position As If We Were A Bitmap Font.
-		// (Only Needed If You Want To Calculate Text Length)
-		glBitmap(0,0,0,0,face->glyph->advance.x >> 6, 0, NULL);
+		FT_Done_Glyph(glyph);
+	}
 
-		// Finish The Display List
-		glEndList();
+	return true;
+}
 
-		FT_Done_Glyph(glyph);
+/**
+ * Private helper function for building the atlas texture of a font set from its baked glyphs.
+ */
+void TextureFontSet::CreateTextureFromBakedFont(TextureFontSet* newFontSet, const BakedFont& bakedFont,
+                                                Texture::TextureFilterType filterType) {
+	assert(newFontSet != NULL);
+
+	long numGlyphs = static_cast<long>(bakedFont.glyphs.size());
+	newFontSet->heightInPixels = bakedFont.heightInPixels;
+	newFontSet->numGlyphs = numGlyphs;
+	newFontSet->widthOfChars.reserve(numGlyphs);
+	for (int i = 0; i < numGlyphs; i++) {
+		newFontSet->widthOfChars.push_back(static_cast<float>(bakedFont.glyphs[i].advance));
 	}
-	glPopMatrix();
+
+	// Pack every glyph into a single bitmap and make that the font's only texture
+	GlyphAtlas* atlas = new GlyphAtlas();
+	if (!atlas->Pack(bakedFont)) {
+		delete atlas;
+		return;
+	}
+
+	newFontSet->atlasTexture = Texture2D::CreateTexture2DFromGlyphBitmap(&atlas->GetPixels()[0], 
+		atlas->GetWidth(), atlas->GetHeight(), filterType);
+	if (newFontSet->atlasTexture == NULL) {
+		debug_output("Could not create the glyph atlas texture for font of height: " << bakedFont.heightInPixels);
+		delete atlas;
+		return;
+	}
+
+	atlas->ReleasePixels();
+	newFontSet->atlas = atlas;
 
 	glBindTexture(GL_TEXTURE_2D, 0);
 }
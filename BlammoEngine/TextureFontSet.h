@@ -36,13 +36,21 @@
 #include "BasicIncludes.h"
 #include "Texture.h"
 #include "Point.h"
+#include "Colour.h"
 
 class Texture2D;
+class GlyphAtlas;
+struct TextLayout;
 
 /**
- * A font represented as a set of display list textured quads,
+ * A font represented as a single texture atlas of all its glyphs,
  * this can be used to form sentences, words etc. using a particular
- * true type font.
+ * true type font. Each string is drawn as one batch of textured quads and
+ * the layouts of recently drawn strings are cached.
+ *
+ * Window-coordinate (ortho) text printed between BeginBatch and EndBatch
+ * isn't drawn right away, it's collected and then drawn with one call per
+ * font/depth-test combination when the batch ends.
  */
 class TextureFontSet {
 public:
@@ -51,6 +59,12 @@ public:
 	~TextureFontSet();
 	void OrthoPrint(const Point3D& topLeftCorner, const std::string& s, bool depthTestOn = false, float scale = 1.0f) const;
     void OrthoPrint(const Point3D& topLeftCorner, const std::string& s, float rotationInDegs, float scale = 1.0f) const;
+    // Same as above but in the given colour instead of the current one (this saves a colour read
+    // from GL for every string that's batched)
+	void OrthoPrint(const Point3D& topLeftCorner, const std::string& s, const ColourRGBA& colour,
+        bool depthTestOn = false, float scale = 1.0f) const;
+    void OrthoPrint(const Point3D& topLeftCorner, const std::string& s, const ColourRGBA& colour,
+        float rotationInDegs, float scale = 1.0f) const;
 	void Print(const std::string& s) const;
     void BasicPrint(const std::string& s) const;
 
@@ -62,8 +76,13 @@ public:
 		return this->heightInPixels;
 	}
 
-    GLuint GetBaseDisplayList() const {
-        return this->baseDisplayList;
+    const TextLayout& GetLayout(const std::string& s) const;
+
+    // Batching of ortho text, batches can be nested and are only drawn when the outer-most one ends
+    static void BeginBatch();
+    static void EndBatch();
+    static bool IsBatching() {
+        return TextureFontSet::batchDepth > 0;
     }
 
 	// Creator Functions
@@ -74,24 +93,70 @@ public:
 	static std::map<unsigned int, TextureFontSet*> CreateTextureFontFromBuffer(unsigned char* buffer, long length, 
 		const std::vector<unsigned int>& heightsInPixels, Texture::TextureFilterType filterType);
 
+	// A glyph as rasterized by freetype - fonts can be baked into these once and then built
+	// (on the render thread) without ever going through freetype again
+	struct BakedGlyph {
+		int left, top;                      // Offset of the bitmap from the pen position
+		int width, rows;                    // Size of the bitmap, both are zero for glyphs with nothing to draw (e.g., spaces)
+		int advance;                        // How far the pen moves in pixels after drawing the glyph
+		std::vector<unsigned char> bitmap;  // 8-bit coverage values, width bytes per row
+
+		BakedGlyph() : left(0), top(0), width(0), rows(0), advance(0) {}
+	};
+	struct BakedFont {
+		unsigned int heightInPixels;
+		std::vector<BakedGlyph> glyphs;     // Indexed by character
+
+		BakedFont() : heightInPixels(0) {}
+	};
+
+	static bool BakeFontFromBuffer(const unsigned char* buffer, long length,
+		const std::vector<unsigned int>& heightsInPixels, std::vector<BakedFont>& bakedFonts);
+	static std::map<unsigned int, TextureFontSet*> CreateTextureFontFromBakedFonts(const std::vector<BakedFont>& bakedFonts,
+		Texture::TextureFilterType filterType);
+
 private:
 	TextureFontSet();
 
+	// Strings drawn with the same font and depth testing are drawn together when batched,
+	// their vertices are in window coordinates
+	struct TextBatchGroup {
+		const Texture2D* texture;
+		bool depthTestOn;
+		std::vector<float> vertices;
+	};
+
+	// Once this many layouts are cached the least recently used one is evicted for each new one
+	static const size_t MAX_NUM_CACHED_LAYOUTS = 256;
+
+	struct CachedLayout {
+		TextLayout* layout;
+		std::list<std::string>::iterator usageIter;  // Where the string is in the usage order
+	};
+
+	static int batchDepth;
+	static std::vector<TextBatchGroup> batchGroups;
+
 	unsigned int numGlyphs;
 	unsigned int heightInPixels;            // Height of the font set in pixels
 	std::vector<float> widthOfChars;        // Width of each character in the font set
-	std::vector<Texture2D*> charTextures;   // Holds each character as a texture
-	GLuint baseDisplayList;
+	GlyphAtlas* atlas;                      // Where each glyph is in the atlas texture
+	Texture2D* atlasTexture;                // Holds every glyph of the font set
+
+	mutable std::map<std::string, CachedLayout> layoutCache;
+	mutable std::list<std::string> layoutUsage;    // Cached strings, most recently used first
+
+	void OrthoPrintLayout(const Point3D& topLeftCorner, const std::string& s, const float* colour,
+		bool depthTestOn, float rotationInDegs, float scale) const;
+	void DrawLayout(const TextLayout& layout) const;
+	void ClearLayoutCache() const;
+	static void FlushBatch();
 
 	static void CreateTextureFromFontLib(TextureFontSet* newFontSet, FT_Face face, unsigned int heightInPixels, Texture::TextureFilterType filterType);
+	static bool BakeFontFromFace(FT_Face face, unsigned int heightInPixels, BakedFont& bakedFont);
+	static void CreateTextureFromBakedFont(TextureFontSet* newFontSet, const BakedFont& bakedFont, Texture::TextureFilterType filterType);
 
     DISALLOW_COPY_AND_ASSIGN(TextureFontSet);
 };
 
-
-inline void TextureFontSet::BasicPrint(const std::string& s) const {
-	glListBase(this->baseDisplayList);
-	glCallLists(s.length(), GL_UNSIGNED_BYTE, s.c_str());
-}
-
 #endif
\ No newline at end of file
@@ -183,6 +183,21 @@ void Blammopedia::ClearProgressData() {
 }
 
 Blammopedia* Blammopedia::BuildFromBlammopediaFile(const std::string &filepath) {
+    Blammopedia* blammopedia = Blammopedia::ReadFromBlammopediaFile(filepath);
+    if (blammopedia == NULL) {
+        return NULL;
+    }
+    if (!blammopedia->LoadTextures()) {
+        assert(false);
+        delete blammopedia;
+        blammopedia = NULL;
+    }
+    return blammopedia;
+}
+
+// Reads the entry status file and every entry's file without loading any textures, this
+// doesn't touch OpenGL so it can be done on a worker thread while the game is loading.
+Blammopedia* Blammopedia::ReadFromBlammopediaFile(const std::string &filepath) {
     bool success = true;
     
     std::map<GameItem::ItemType, std::pair<bool, bool> > itemStatusMap;
@@ -241,8 +256,8 @@ Blammopedia* Blammopedia::BuildFromBlammopediaFile(const std::string &filepath)
 	//	statusEntry->SetIsLocked(iter->second);
 	//}
 	
-	// Go through all entries in the blammopedia an initialize them
-	success = blammopedia->InitializeEntries();
+	// Go through all entries in the blammopedia and read them in
+	success = blammopedia->ReadEntries();
 	if (!success) {
 		assert(false);
 		delete blammopedia;
@@ -306,18 +321,34 @@ bool Blammopedia::WriteAsEntryStatusFile() const {
 	return true;
 }
 
-// Goes through every entry in the blammopedia and initializes it from file - this includes loading
-// the textures of various entries, etc.
-bool Blammopedia::InitializeEntries() {
+// Goes through every entry in the blammopedia and reads it from file - textures are loaded
+// afterwards by LoadTextures.
+bool Blammopedia::ReadEntries() {
 
-	bool success = true;
 	bool allSuccess = true;
 
-	// Load the item entries
 	for (std::map<GameItem::ItemType, ItemEntry*>::iterator iter = this->itemEntries.begin(); iter != this->itemEntries.end(); ++iter) {
-		ItemEntry* itemEntry = iter->second;
-		success = itemEntry->PopulateFromFile();
-		if (!success) { allSuccess = false; }
+		if (!iter->second->ReadFromFile()) { allSuccess = false; }
+	}
+	for (std::map<LevelPiece::LevelPieceType,
+		AbstractBlockEntry*>::iterator iter = this->blockEntries.begin(); iter != this->blockEntries.end(); ++iter) {
+		if (!iter->second->ReadFromFile()) { allSuccess = false; }
+	}
+	for (std::map<LevelPiece::PieceStatus, MiscEntry*>::iterator iter = this->miscEntries.begin();
+			 iter != this->miscEntries.end(); ++iter) {
+		if (!iter->second->ReadFromFile()) { allSuccess = false; }
+	}
+
+	return allSuccess;
+}
+
+// Loads the textures of every entry in the blammopedia, must be called on the main (OpenGL) thread.
+bool Blammopedia::LoadTextures() {
+
+	bool allSuccess = true;
+
+	for (std::map<GameItem::ItemType, ItemEntry*>::iterator iter = this->itemEntries.begin(); iter != this->itemEntries.end(); ++iter) {
+		if (!iter->second->LoadTextures()) { allSuccess = false; }
 	}
 
 	// Load the locked item texture...
@@ -328,25 +359,33 @@ bool Blammopedia::InitializeEntries() {
 		allSuccess = false;
 	}
 
-    // Load level piece (block) entries
 	for (std::map<LevelPiece::LevelPieceType,
 		AbstractBlockEntry*>::iterator iter = this->blockEntries.begin(); iter != this->blockEntries.end(); ++iter) {
-		AbstractBlockEntry* blockEntry = iter->second;
-		success = blockEntry->PopulateFromFile();
-		if (!success) { allSuccess = false; }
+		if (!iter->second->LoadTextures()) { allSuccess = false; }
 	}
-
 	for (std::map<LevelPiece::PieceStatus, MiscEntry*>::iterator iter = this->miscEntries.begin();
 			 iter != this->miscEntries.end(); ++iter) {
-
-		MiscEntry* miscEntry = iter->second;
-		success = miscEntry->PopulateFromFile();
-		if (!success) { allSuccess = false; }
+		if (!iter->second->LoadTextures()) { allSuccess = false; }
 	}
 
 	return allSuccess;
 }
 
+// Gathers the filepaths of every texture that LoadTextures will load, so that they can be
+// prefetched (read and decoded) in the background beforehand.
+void Blammopedia::GetTextureFilepaths(std::vector<std::string>& filepaths) const {
+	for (ItemEntryMapConstIter iter = this->itemEntries.begin(); iter != this->itemEntries.end(); ++iter) {
+		iter->second->GetTextureFilepaths(filepaths);
+	}
+	filepaths.push_back(GameViewConstants::GetInstance()->TEXTURE_LOCKED_BLAMMOPEDIA_ENTRY);
+	for (BlockEntryMapConstIter iter = this->blockEntries.begin(); iter != this->blockEntries.end(); ++iter) {
+		iter->second->GetTextureFilepaths(filepaths);
+	}
+	for (MiscEntryMapConstIter iter = this->miscEntries.begin(); iter != this->miscEntries.end(); ++iter) {
+		iter->second->GetTextureFilepaths(filepaths);
+	}
+}
+
 bool Blammopedia::ReadItemEntires(std::istream& inStream, std::map<GameItem::ItemType, std::pair<bool, bool> >& itemStatusMap) {
     char tempReadChar;
     if (!inStream.read(&tempReadChar, 1)) {
@@ -485,9 +524,33 @@ bool Blammopedia::Entry::PopulateBaseValuesFromStream(std::istream& inStream) {
 	return success;
 }
 
+// Loads a texture named by a blammopedia entry, the HUD textures are also clamped to their edges
+static Texture2D* LoadEntryTexture(const std::string& filepath, bool clampToEdge) {
+	Texture2D* texture = static_cast<Texture2D*>(ResourceManager::GetInstance()->GetImgTextureResource(filepath, Texture::Trilinear, GL_TEXTURE_2D));
+	if (texture != NULL && clampToEdge) {
+		glBindTexture(GL_TEXTURE_2D, texture->GetTextureID());
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	}
+	return texture;
+}
+
+// Reads the texture filename that follows a texture keyword in an entry file
+static bool ReadEntryTextureFilename(std::istream& inStream, std::string& textureFilename) {
+	std::string tempReadStr;
+	if (!std::getline(inStream, tempReadStr)) {
+		return false;
+	}
+	textureFilename = ResourceManager::GetTextureResourceDir() + stringhelper::trim(tempReadStr);
+	return true;
+}
+
 Blammopedia::ItemEntry::~ItemEntry() {
-	bool success = ResourceManager::GetInstance()->ReleaseTextureResource(this->itemTexture);
-	assert(success);
+	bool success = true;
+	if (this->itemTexture != NULL) {
+		success = ResourceManager::GetInstance()->ReleaseTextureResource(this->itemTexture);
+		assert(success);
+	}
 	if (this->hudOutlineTexture != NULL) {
 		success = ResourceManager::GetInstance()->ReleaseTextureResource(this->hudOutlineTexture);
 		assert(success);
@@ -496,15 +559,16 @@ Blammopedia::ItemEntry::~ItemEntry() {
 		success = ResourceManager::GetInstance()->ReleaseTextureResource(this->hudFillTexture);
 		assert(success);
 	}
+    UNUSED_VARIABLE(success);
 }
 
 // Populates this blammopedia item entry from its known resource file name
-bool Blammopedia::ItemEntry::PopulateFromFile() {
+bool Blammopedia::ItemEntry::ReadFromFile() {
 	long fileLength;
 	char* fileBuffer = ResourceManager::GetInstance()->FilepathToMemoryBuffer(this->filename, fileLength);
 	if (fileBuffer == NULL || fileLength <= 0) {
 		assert(false);
-		return NULL;
+		return false;
 	}
 	std::istringstream strStream(std::string(fileBuffer), std::ios_base::in | std::ios_base::binary);
 	delete[] fileBuffer;
@@ -515,106 +579,96 @@ bool Blammopedia::ItemEntry::PopulateFromFile() {
 		return false;
 	}
 
-	glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
-
 	strStream.clear();
 	strStream.seekg(0, std::ios::beg);
 
 	std::string tempReadStr;
 	while (success && strStream >> tempReadStr) {
 		if (tempReadStr.compare(ITEM_TEXTURE_KEYWORD) == 0) {
-			if (std::getline(strStream, tempReadStr)) {
-				tempReadStr = stringhelper::trim(tempReadStr);
-				this->itemTextureFilename = ResourceManager::GetTextureResourceDir() + tempReadStr;
-
-				// Read the texture from the resource manager...
-				this->itemTexture = static_cast<Texture2D*>(ResourceManager::GetInstance()->GetImgTextureResource(this->itemTextureFilename, Texture::Trilinear, GL_TEXTURE_2D));
-				if (this->itemTexture == NULL) {
-					assert(false);
-					success = false;
-					debug_output("Failed to load the item texture for blammopedia item entry: " << this->filename);
-					break;
-				}
-
-			}
-			else {
+			if (!ReadEntryTextureFilename(strStream, this->itemTextureFilename)) {
 				success = false;
 				debug_output("Failed to read the item texture for blammopedia item entry: " << this->filename);
-				break;
 			}
 		}
 		else if (tempReadStr.compare(HUD_OUTLINE_TEXTURE_KEYWORD) == 0) {
-			if (std::getline(strStream, tempReadStr)) {
-				tempReadStr = stringhelper::trim(tempReadStr);
-				this->hudOutlineTextureFilename = ResourceManager::GetTextureResourceDir() + tempReadStr;
-			
-				// Read the texture from the resource manager...
-				this->hudOutlineTexture = static_cast<Texture2D*>(ResourceManager::GetInstance()->GetImgTextureResource(this->hudOutlineTextureFilename, 
-																													 Texture::Trilinear, GL_TEXTURE_2D));
-				if (this->hudOutlineTexture == NULL) {
-					assert(false);
-					success = false;
-					debug_output("Failed to load the item HUD outline texture for blammopedia item entry: " << this->filename);
-					break;
-				}
-				else {
-					glBindTexture(GL_TEXTURE_2D, this->hudOutlineTexture->GetTextureID());
-					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-				}
-
-			}
-			else {
+			if (!ReadEntryTextureFilename(strStream, this->hudOutlineTextureFilename)) {
 				success = false;
 				debug_output("Failed to read the item HUD outline texture for blammopedia item entry: " << this->filename);
-				break;
 			}
 		}
 		else if (tempReadStr.compare(HUD_FILL_TEXTURE_KEYWORD) == 0) {
-			if (std::getline(strStream, tempReadStr)) {
-				tempReadStr = stringhelper::trim(tempReadStr);
-				this->hudFillTextureFilename = ResourceManager::GetTextureResourceDir() + tempReadStr;
-
-				// Read the texture from the resource manager...
-				this->hudFillTexture = static_cast<Texture2D*>(ResourceManager::GetInstance()->GetImgTextureResource(this->hudFillTextureFilename, 
-																												Texture::Trilinear, GL_TEXTURE_2D));
-				if (this->hudFillTexture == NULL) {
-					assert(false);
-					success = false;
-					debug_output("Failed to load the item HUD fill texture for blammopedia item entry: " << this->filename);
-					break;
-				}
-				else {
-					glBindTexture(GL_TEXTURE_2D, this->hudFillTexture->GetTextureID());
-					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-				}
-			}
-			else {
+			if (!ReadEntryTextureFilename(strStream, this->hudFillTextureFilename)) {
 				success = false;
 				debug_output("Failed to read the item HUD fill texture for blammopedia item entry: " << this->filename);
-				break;
 			}
 		}
 	}
 
+	return success;
+}
+
+bool Blammopedia::ItemEntry::LoadTextures() {
+	assert(this->itemTexture == NULL && this->hudOutlineTexture == NULL && this->hudFillTexture == NULL);
+	bool success = true;
+
+	glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
+
+	if (!this->itemTextureFilename.empty()) {
+		this->itemTexture = LoadEntryTexture(this->itemTextureFilename, false);
+		if (this->itemTexture == NULL) {
+			assert(false);
+			success = false;
+			debug_output("Failed to load the item texture for blammopedia item entry: " << this->filename);
+		}
+	}
+	if (!this->hudOutlineTextureFilename.empty()) {
+		this->hudOutlineTexture = LoadEntryTexture(this->hudOutlineTextureFilename, true);
+		if (this->hudOutlineTexture == NULL) {
+			assert(false);
+			success = false;
+			debug_output("Failed to load the item HUD outline texture for blammopedia item entry: " << this->filename);
+		}
+	}
+	if (!this->hudFillTextureFilename.empty()) {
+		this->hudFillTexture = LoadEntryTexture(this->hudFillTextureFilename, true);
+		if (this->hudFillTexture == NULL) {
+			assert(false);
+			success = false;
+			debug_output("Failed to load the item HUD fill texture for blammopedia item entry: " << this->filename);
+		}
+	}
+
 	glPopAttrib();
 
 	return success;
 }
 
+void Blammopedia::ItemEntry::GetTextureFilepaths(std::vector<std::string>& filepaths) const {
+	if (!this->itemTextureFilename.empty()) {
+		filepaths.push_back(this->itemTextureFilename);
+	}
+	if (!this->hudOutlineTextureFilename.empty()) {
+		filepaths.push_back(this->hudOutlineTextureFilename);
+	}
+	if (!this->hudFillTextureFilename.empty()) {
+		filepaths.push_back(this->hudFillTextureFilename);
+	}
+}
+
 Blammopedia::BlockEntry::~BlockEntry() {
-    bool success = ResourceManager::GetInstance()->ReleaseTextureResource(this->blockTexture);
-    UNUSED_VARIABLE(success);
-	assert(success);
+	if (this->blockTexture != NULL) {
+		bool success = ResourceManager::GetInstance()->ReleaseTextureResource(this->blockTexture);
+		UNUSED_VARIABLE(success);
+		assert(success);
+	}
 }
 
-bool Blammopedia::BlockEntry::PopulateFromFile() {
+bool Blammopedia::BlockEntry::ReadFromFile() {
 	long fileLength;
 	char* fileBuffer = ResourceManager::GetInstance()->FilepathToMemoryBuffer(this->filename, fileLength);
 	if (fileBuffer == NULL || fileLength <= 0) {
 		assert(false);
-		return NULL;
+		return false;
 	}
 	std::istringstream strStream(std::string(fileBuffer), std::ios_base::in | std::ios_base::binary);
 	delete[] fileBuffer;
@@ -625,39 +679,46 @@ bool Blammopedia::BlockEntry::PopulateFromFile() {
 		return false;
 	}
 
-	glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
-
 	strStream.clear();
 	strStream.seekg(0, std::ios::beg);
 
     std::string tempReadStr;
 	while (success && strStream >> tempReadStr) {
 		if (tempReadStr.compare(DISPLAY_TEXTURE_KEYWORD) == 0) {
-			if (std::getline(strStream, tempReadStr)) {
-				tempReadStr = stringhelper::trim(tempReadStr);
-                this->blockTextureFilename = ResourceManager::GetTextureResourceDir() + tempReadStr;
-
-				// Read the texture from the resource manager...
-				this->blockTexture = static_cast<Texture2D*>(ResourceManager::GetInstance()->GetImgTextureResource(this->blockTextureFilename, Texture::Trilinear, GL_TEXTURE_2D));
-				if (this->blockTexture == NULL) {
-					assert(false);
-					success = false;
-					debug_output("Failed to load the block display texture for blammopedia item entry: " << this->filename);
-					break;
-				}
-			}
-			else {
+			if (!ReadEntryTextureFilename(strStream, this->blockTextureFilename)) {
 				success = false;
-				debug_output("Failed to read the item texture for blammopedia item entry: " << this->filename);
-				break;
+				debug_output("Failed to read the block display texture for blammopedia block entry: " << this->filename);
 			}
 		}
 	}
-	glPopAttrib();
 
 	return success;
 }
 
+bool Blammopedia::BlockEntry::LoadTextures() {
+	assert(this->blockTexture == NULL);
+	if (this->blockTextureFilename.empty()) {
+		return true;
+	}
+
+	glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
+	this->blockTexture = LoadEntryTexture(this->blockTextureFilename, false);
+	glPopAttrib();
+
+	if (this->blockTexture == NULL) {
+		assert(false);
+		debug_output("Failed to load the block display texture for blammopedia block entry: " << this->filename);
+		return false;
+	}
+	return true;
+}
+
+void Blammopedia::BlockEntry::GetTextureFilepaths(std::vector<std::string>& filepaths) const {
+	if (!this->blockTextureFilename.empty()) {
+		filepaths.push_back(this->blockTextureFilename);
+	}
+}
+
 Blammopedia::SolidBlockEntry::SolidBlockEntry(const std::string& filename) : AbstractBlockEntry(filename) {
 
 }
@@ -679,7 +740,7 @@ Blammopedia::SolidBlockEntry::~SolidBlockEntry() {
 Texture2D* Blammopedia::SolidBlockEntry::GetBlockTexture(int furthestWorldIdx) const {
     assert(furthestWorldIdx+1 <= static_cast<int>(this->blockTextureMap.size()));
 
-    int randomIdx = Randomizer::GetInstance()->RandomUnsignedInt() % (furthestWorldIdx+1);
+    int randomIdx = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % (furthestWorldIdx+1);
     assert(randomIdx >= 0 && randomIdx <= furthestWorldIdx);
 
     std::map<GameWorld::WorldStyle, Texture2D*>::const_iterator findIter =
@@ -688,13 +749,13 @@ Texture2D* Blammopedia::SolidBlockEntry::GetBlockTexture(int furthestWorldIdx) c
     return findIter->second;
 };
 
-bool Blammopedia::SolidBlockEntry::PopulateFromFile() {
+bool Blammopedia::SolidBlockEntry::ReadFromFile() {
     
     long fileLength;
     char* fileBuffer = ResourceManager::GetInstance()->FilepathToMemoryBuffer(this->filename, fileLength);
     if (fileBuffer == NULL || fileLength <= 0) {
         assert(false);
-        return NULL;
+        return false;
     }
 
     std::istringstream strStream(std::string(fileBuffer), std::ios_base::in | std::ios_base::binary);
@@ -705,18 +766,27 @@ bool Blammopedia::SolidBlockEntry::PopulateFromFile() {
         return false;
     }
 
-    glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
-
     GameViewConstants::GetInstance()->GetWorldTypeBlockTextureNameMap(this->blockTextureFilenameMap);
+    return true;
+}
+
+bool Blammopedia::SolidBlockEntry::LoadTextures() {
+    assert(this->blockTextureMap.empty());
+
+    glPushAttrib(GL_TEXTURE_BIT | GL_ENABLE_BIT);
     for (std::map<GameWorld::WorldStyle, const char*>::const_iterator iter = this->blockTextureFilenameMap.begin();
         iter != this->blockTextureFilenameMap.end(); ++iter) {
 
-        this->blockTextureMap.insert(std::make_pair(iter->first, 
-            static_cast<Texture2D*>(ResourceManager::GetInstance()->GetImgTextureResource(
-            iter->second, Texture::Trilinear, GL_TEXTURE_2D))));
+        this->blockTextureMap.insert(std::make_pair(iter->first, LoadEntryTexture(iter->second, false)));
     }
-
     glPopAttrib();
 
     return true;
 }
+
+void Blammopedia::SolidBlockEntry::GetTextureFilepaths(std::vector<std::string>& filepaths) const {
+    for (std::map<GameWorld::WorldStyle, const char*>::const_iterator iter = this->blockTextureFilenameMap.begin();
+        iter != this->blockTextureFilenameMap.end(); ++iter) {
+        filepaths.push_back(iter->second);
+    }
+}
@@ -39,6 +39,7 @@
 #include "GameModel/GameWorld.h"
 
 #include <string>
+#include <vector>
 #include <map>
 
 class Texture2D;
@@ -80,7 +81,10 @@ public:
 		std::string description;
         std::string finePrint;
 
-		virtual bool PopulateFromFile() = 0;
+		// Reading an entry's file doesn't touch OpenGL, loading its textures does
+		virtual bool ReadFromFile() = 0;
+		virtual bool LoadTextures() = 0;
+		virtual void GetTextureFilepaths(std::vector<std::string>& filepaths) const = 0;
 		bool PopulateBaseValuesFromStream(std::istream& inStream);
 	};
 
@@ -96,7 +100,9 @@ public:
 		Texture2D* GetHUDFillTexture() const { return this->hudFillTexture; }
 
 	protected:
-		bool PopulateFromFile();
+		bool ReadFromFile();
+		bool LoadTextures();
+		void GetTextureFilepaths(std::vector<std::string>& filepaths) const;
 
 	private:
 		std::string itemTextureFilename;
@@ -126,7 +132,9 @@ public:
         Texture2D* GetBlockTexture(int) const { return this->blockTexture; }
 
     private:
-        bool PopulateFromFile();
+        bool ReadFromFile();
+        bool LoadTextures();
+        void GetTextureFilepaths(std::vector<std::string>& filepaths) const;
 
         std::string blockTextureFilename;
         Texture2D* blockTexture;
@@ -142,7 +150,9 @@ public:
         Texture2D* GetBlockTexture(int furthestWorldIdx) const;
 
     private:
-        bool PopulateFromFile();
+        bool ReadFromFile();
+        bool LoadTextures();
+        void GetTextureFilepaths(std::vector<std::string>& filepaths) const;
 
         std::map<GameWorld::WorldStyle, const char*> blockTextureFilenameMap;
         std::map<GameWorld::WorldStyle, Texture2D*> blockTextureMap;
@@ -187,6 +197,13 @@ public:
     void ClearProgressData();
 
     static Blammopedia* BuildFromBlammopediaFile(const std::string &filepath);
+
+    // Building is split in two so that the file reading can happen off the main thread:
+    // ReadFromBlammopediaFile doesn't touch OpenGL, LoadTextures must be called on the main thread
+    static Blammopedia* ReadFromBlammopediaFile(const std::string &filepath);
+    bool LoadTextures();
+    void GetTextureFilepaths(std::vector<std::string>& filepaths) const;
+
 	bool WriteAsEntryStatusFile() const;
 
 	const Texture2D* GetLockedItemTexture() const;
@@ -201,7 +218,7 @@ private:
 	Texture2D* lockedItemTexture;
 
 	Blammopedia();
-	bool InitializeEntries();
+	bool ReadEntries();
 
 	static bool ReadItemEntires(std::istream& inStream, std::map<GameItem::ItemType, std::pair<bool, bool> >& itemStatusMap);
 	static bool ReadBlockEntries(std::istream& inStream, std::map<LevelPiece::LevelPieceType, std::pair<bool, bool> >& blockStatusMap);
@@ -0,0 +1,524 @@
+/**
+ * DecodedAssetCache.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "DecodedAssetCache.h"
+
+#include "BlammoEngine/BlammoTime.h"
+#include "BlammoEngine/ObjReader.h"
+
+#ifdef WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+
+const char* DecodedAssetCache::CACHE_DIRECTORY = "cache";
+
+// Bump this whenever the layout of any of the cache entries (or the way they're decoded) changes
+const unsigned int DecodedAssetCache::FORMAT_VERSION = 1;
+const char* DecodedAssetCache::LOAD_TIMES_FILENAME = "load_times.txt";
+
+static const char ENTRY_MAGIC[4] = { 'B', 'B', 'B', 'C' };
+
+// Sanity limits on sizes read out of cache entries so a corrupt entry can't cause a huge allocation
+static const unsigned int MAX_IMAGE_DIMENSION = 16384;
+static const unsigned int MAX_NUM_ELEMENTS    = 16777216;
+
+template <typename T> static void WriteValue(std::ostream& out, const T& value) {
+	out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T> static bool ReadValue(std::istream& in, T& value) {
+	in.read(reinterpret_cast<char*>(&value), sizeof(T));
+	return in.good();
+}
+
+static void WriteString(std::ostream& out, const std::string& str) {
+	WriteValue<unsigned int>(out, static_cast<unsigned int>(str.size()));
+	out.write(str.data(), str.size());
+}
+
+static bool ReadString(std::istream& in, std::string& str) {
+	unsigned int length;
+	if (!ReadValue(in, length) || length > MAX_NUM_ELEMENTS) {
+		return false;
+	}
+	str.resize(length);
+	if (length > 0) {
+		in.read(&str[0], length);
+	}
+	return in.good();
+}
+
+// Writes/reads the float components of a vector of points or vectors
+template <typename T> static void WriteComponents(std::ostream& out, const std::vector<T>& values, int numComponents) {
+	WriteValue<unsigned int>(out, static_cast<unsigned int>(values.size()));
+	for (typename std::vector<T>::const_iterator iter = values.begin(); iter != values.end(); ++iter) {
+		for (int i = 0; i < numComponents; i++) {
+			WriteValue<float>(out, (*iter)[i]);
+		}
+	}
+}
+
+template <typename T> static bool ReadComponents(std::istream& in, std::vector<T>& values, int numComponents) {
+	unsigned int numValues;
+	if (!ReadValue(in, numValues) || numValues > MAX_NUM_ELEMENTS) {
+		return false;
+	}
+	values.resize(numValues);
+	for (unsigned int j = 0; j < numValues; j++) {
+		for (int i = 0; i < numComponents; i++) {
+			float component;
+			if (!ReadValue(in, component)) {
+				return false;
+			}
+			values[j][i] = component;
+		}
+	}
+	return true;
+}
+
+template <typename T> static void WriteArray(std::ostream& out, const std::vector<T>& values) {
+	WriteValue<unsigned int>(out, static_cast<unsigned int>(values.size()));
+	if (!values.empty()) {
+		out.write(reinterpret_cast<const char*>(&values[0]), values.size() * sizeof(T));
+	}
+}
+
+template <typename T> static bool ReadArray(std::istream& in, std::vector<T>& values) {
+	unsigned int numValues;
+	if (!ReadValue(in, numValues) || numValues > MAX_NUM_ELEMENTS) {
+		return false;
+	}
+	values.resize(numValues);
+	if (numValues > 0) {
+		in.read(reinterpret_cast<char*>(&values[0]), numValues * sizeof(T));
+	}
+	return in.good();
+}
+
+DecodedAssetCache::DecodedAssetCache(const std::string& cacheDir) : cacheDir(cacheDir), statsMutex(NULL),
+numHits(0), numMisses(0), numPruned(0), cacheReadTimeInSecs(0.0), decodeTimeInSecs(0.0) {
+
+	if (!this->cacheDir.empty() && this->cacheDir[this->cacheDir.size()-1] != '/' && this->cacheDir[this->cacheDir.size()-1] != '\\') {
+		this->cacheDir += "/";
+	}
+
+	// Make sure the cache directory exists (if it already does this just fails, if it can't be
+	// made then every lookup will miss and every write will fail - the game will still load fine)
+#ifdef WIN32
+	_mkdir(this->cacheDir.c_str());
+#else
+	mkdir(this->cacheDir.c_str(), 0755);
+#endif
+
+	this->statsMutex = SDL_CreateMutex();
+	assert(this->statsMutex != NULL);
+}
+
+DecodedAssetCache::~DecodedAssetCache() {
+	SDL_DestroyMutex(this->statsMutex);
+	this->statsMutex = NULL;
+}
+
+/**
+ * Get the decoded RGBA texels of the given in-memory image file.
+ * Returns: The decoded image (the caller takes ownership), NULL if the image couldn't be decoded.
+ */
+Texture::DecodedImage* DecodedAssetCache::GetDecodedImage(const std::string& filepath, const unsigned char* fileBuffer,
+                                                          long fileBufferLength) {
+	assert(fileBuffer != NULL);
+
+	double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+	unsigned long hash = DecodedAssetCache::HashBytes(fileBuffer, fileBufferLength, 2166136261UL);
+	std::string entryFilepath = this->GetEntryFilepath("img", hash, fileBufferLength);
+
+	std::ifstream inFile;
+	if (this->OpenEntry(entryFilepath, inFile)) {
+		unsigned int width, height;
+		if (ReadValue(inFile, width) && ReadValue(inFile, height) &&
+			width > 0 && width <= MAX_IMAGE_DIMENSION && height > 0 && height <= MAX_IMAGE_DIMENSION) {
+
+			Texture::DecodedImage* image = new Texture::DecodedImage(width, height);
+			inFile.read(reinterpret_cast<char*>(image->pixels), 4*width*height);
+			if (inFile.good()) {
+				this->RecordLookup(true, BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+				return image;
+			}
+			delete image;
+			image = NULL;
+		}
+		debug_output("Corrupt decoded asset cache entry, rebuilding: " << entryFilepath);
+	}
+	inFile.close();
+
+	// Not in the cache, decode it and store the texels for next time
+	Texture::DecodedImage* image = Texture::DecodeImageFromBuffer(fileBuffer, fileBufferLength);
+	if (image != NULL) {
+		std::ostringstream entryData(std::ios_base::out | std::ios_base::binary);
+		WriteValue<unsigned int>(entryData, image->width);
+		WriteValue<unsigned int>(entryData, image->height);
+		entryData.write(reinterpret_cast<const char*>(image->pixels), 4*image->width*image->height);
+		if (this->CommitEntry(entryFilepath, entryData.str())) {
+			this->ReplaceSourceEntry("img", filepath, entryFilepath);
+		}
+	}
+
+	this->RecordLookup(false, BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+	return image;
+}
+
+/**
+ * Get the parsed contents of the given in-memory obj file - the filepath is part of the key since
+ * the path of the mesh's material file is relative to it.
+ * Returns: true on success, false if the obj file couldn't be parsed.
+ */
+bool DecodedAssetCache::GetObjMeshData(const std::string& filepath, const char* fileBuffer, long fileBufferLength,
+                                       ObjMeshData& meshData) {
+	assert(fileBuffer != NULL);
+
+	double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+	unsigned long hash = DecodedAssetCache::HashBytes(reinterpret_cast<const unsigned char*>(filepath.c_str()), filepath.size(), 2166136261UL);
+	hash = DecodedAssetCache::HashBytes(reinterpret_cast<const unsigned char*>(fileBuffer), fileBufferLength, hash);
+	std::string entryFilepath = this->GetEntryFilepath("obj", hash, fileBufferLength);
+
+	std::ifstream inFile;
+	if (this->OpenEntry(entryFilepath, inFile)) {
+		bool success = ReadString(inFile, meshData.mtlFilepath) &&
+			ReadComponents(inFile, meshData.vertices, 3) && ReadComponents(inFile, meshData.normals, 3) &&
+			ReadComponents(inFile, meshData.texCoords, 2);
+
+		unsigned int numMaterials = 0;
+		success = success && ReadValue(inFile, numMaterials) && numMaterials <= MAX_NUM_ELEMENTS;
+		meshData.materialNames.clear();
+		meshData.polyGrps.clear();
+		for (unsigned int i = 0; i < numMaterials && success; i++) {
+			std::string materialName;
+			success = ReadString(inFile, materialName);
+			if (!success) {
+				break;
+			}
+			meshData.materialNames.push_back(materialName);
+
+			PolyGrpIndexer& polyGrp = meshData.polyGrps[materialName];
+			unsigned int polyType;
+			success = ReadValue(inFile, polyType) && ReadArray(inFile, polyGrp.vertexIndices) &&
+				ReadArray(inFile, polyGrp.normalIndices) && ReadArray(inFile, polyGrp.texCoordIndices);
+			polyGrp.polyType = static_cast<GLenum>(polyType);
+		}
+
+		if (success) {
+			this->RecordLookup(true, BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+			return true;
+		}
+		debug_output("Corrupt decoded asset cache entry, rebuilding: " << entryFilepath);
+		meshData = ObjMeshData();
+	}
+	inFile.close();
+
+	// Not in the cache, parse it and store the result for next time
+	std::istringstream inStream(std::string(fileBuffer, fileBufferLength), std::ios_base::in | std::ios_base::binary);
+	bool success = ObjReader::ParseMeshFromStream(filepath, inStream, meshData);
+	if (success) {
+		std::ostringstream entryData(std::ios_base::out | std::ios_base::binary);
+		WriteString(entryData, meshData.mtlFilepath);
+		WriteComponents(entryData, meshData.vertices, 3);
+		WriteComponents(entryData, meshData.normals, 3);
+		WriteComponents(entryData, meshData.texCoords, 2);
+
+		// Every material group name is written in order along with its polygons
+		WriteValue<unsigned int>(entryData, static_cast<unsigned int>(meshData.materialNames.size()));
+		for (std::vector<std::string>::const_iterator iter = meshData.materialNames.begin(); iter != meshData.materialNames.end(); ++iter) {
+			const PolyGrpIndexer& polyGrp = meshData.polyGrps[*iter];
+			WriteString(entryData, *iter);
+			WriteValue<unsigned int>(entryData, static_cast<unsigned int>(polyGrp.polyType));
+			WriteArray(entryData, polyGrp.vertexIndices);
+			WriteArray(entryData, polyGrp.normalIndices);
+			WriteArray(entryData, polyGrp.texCoordIndices);
+		}
+		if (this->CommitEntry(entryFilepath, entryData.str())) {
+			this->ReplaceSourceEntry("obj", filepath, entryFilepath);
+		}
+	}
+
+	this->RecordLookup(false, BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+	return success;
+}
+
+/**
+ * Get the rasterized glyphs of the given in-memory true type font at each of the given heights.
+ * Returns: true on success, false if the font couldn't be rasterized.
+ */
+bool DecodedAssetCache::GetBakedFonts(const std::string& filepath, const unsigned char* fileBuffer, long fileBufferLength,
+                                      const std::vector<unsigned int>& heightsInPixels,
+                                      std::vector<TextureFontSet::BakedFont>& bakedFonts) {
+	assert(fileBuffer != NULL);
+
+	double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+	unsigned long hash = DecodedAssetCache::HashBytes(fileBuffer, fileBufferLength, 2166136261UL);
+	if (!heightsInPixels.empty()) {
+		hash = DecodedAssetCache::HashBytes(reinterpret_cast<const unsigned char*>(&heightsInPixels[0]),
+			heightsInPixels.size() * sizeof(unsigned int), hash);
+	}
+	std::string entryFilepath = this->GetEntryFilepath("ttf", hash, fileBufferLength);
+
+	std::ifstream inFile;
+	if (this->OpenEntry(entryFilepath, inFile)) {
+		unsigned int numFonts = 0;
+		bool success = ReadValue(inFile, numFonts) && numFonts == heightsInPixels.size();
+		bakedFonts.clear();
+		bakedFonts.resize(numFonts);
+		for (unsigned int i = 0; i < numFonts && success; i++) {
+			TextureFontSet::BakedFont& bakedFont = bakedFonts[i];
+
+			unsigned int numGlyphs = 0;
+			success = ReadValue(inFile, bakedFont.heightInPixels) && ReadValue(inFile, numGlyphs) && numGlyphs <= MAX_NUM_ELEMENTS;
+			if (!success) {
+				break;
+			}
+			bakedFont.glyphs.resize(numGlyphs);
+			for (unsigned int j = 0; j < numGlyphs && success; j++) {
+				TextureFontSet::BakedGlyph& glyph = bakedFont.glyphs[j];
+				success = ReadValue(inFile, glyph.left) && ReadValue(inFile, glyph.top) &&
+					ReadValue(inFile, glyph.width) && ReadValue(inFile, glyph.rows) &&
+					ReadValue(inFile, glyph.advance) && ReadArray(inFile, glyph.bitmap) &&
+					static_cast<int>(glyph.bitmap.size()) == glyph.width * glyph.rows;
+			}
+		}
+
+		if (success) {
+			this->RecordLookup(true, BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+			return true;
+		}
+		debug_output("Corrupt decoded asset cache entry, rebuilding: " << entryFilepath);
+	}
+	inFile.close();
+
+	// Not in the cache, rasterize it and store the glyphs for next time
+	bool success = TextureFontSet::BakeFontFromBuffer(fileBuffer, fileBufferLength, heightsInPixels, bakedFonts);
+	if (success) {
+		std::ostringstream entryData(std::ios_base::out | std::ios_base::binary);
+		WriteValue<unsigned int>(entryData, static_cast<unsigned int>(bakedFonts.size()));
+		for (std::vector<TextureFontSet::BakedFont>::const_iterator iter = bakedFonts.begin(); iter != bakedFonts.end(); ++iter) {
+			const TextureFontSet::BakedFont& bakedFont = *iter;
+			WriteValue<unsigned int>(entryData, bakedFont.heightInPixels);
+			WriteValue<unsigned int>(entryData, static_cast<unsigned int>(bakedFont.glyphs.size()));
+			for (std::vector<TextureFontSet::BakedGlyph>::const_iterator glyphIter = bakedFont.glyphs.begin();
+				 glyphIter != bakedFont.glyphs.end(); ++glyphIter) {
+
+				const TextureFontSet::BakedGlyph& glyph = *glyphIter;
+				WriteValue<int>(entryData, glyph.left);
+				WriteValue<int>(entryData, glyph.top);
+				WriteValue<int>(entryData, glyph.width);
+				WriteValue<int>(entryData, glyph.rows);
+				WriteValue<int>(entryData, glyph.advance);
+				WriteArray(entryData, glyph.bitmap);
+			}
+		}
+		if (this->CommitEntry(entryFilepath, entryData.str())) {
+			// The same font gets baked at different sets of heights, each of those is its own source
+			std::ostringstream sourceName;
+			sourceName << filepath;
+			for (std::vector<unsigned int>::const_iterator iter = heightsInPixels.begin(); iter != heightsInPixels.end(); ++iter) {
+				sourceName << "_" << *iter;
+			}
+			this->ReplaceSourceEntry("ttf", sourceName.str(), entryFilepath);
+		}
+	}
+
+	this->RecordLookup(false, BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+	return success;
+}
+
+/**
+ * Writes out how long loading took along with how the cache did while loading, this compares the load time against
+ * the last load of the other kind (i.e., a warm start is compared against the last cold start and vice versa) and
+ * then records the load time for future comparisons.
+ */
+void DecodedAssetCache::WriteLoadTimeReport(double loadTimeInSecs, std::ostream& out) {
+	SDL_mutexP(this->statsMutex);
+	int hits = this->numHits;
+	int misses = this->numMisses;
+	int pruned = this->numPruned;
+	double readTime = this->cacheReadTimeInSecs;
+	double decodeTime = this->decodeTimeInSecs;
+	SDL_mutexV(this->statsMutex);
+
+	// A start is only warm if nothing at all had to be decoded
+	const std::string startType = (misses == 0 && hits > 0) ? "warm" : "cold";
+
+	out << "Loading took " << loadTimeInSecs << "s with a " << startType << " decoded asset cache (" 
+	    << hits << " hits, " << misses << " misses, " << readTime << "s reading from the cache, "
+	    << decodeTime << "s decoding, " << pruned << " stale entries removed)" << std::endl;
+
+	// Look for the most recent load of the other kind to compare against
+	const std::string loadTimesFilepath = this->cacheDir + std::string(LOAD_TIMES_FILENAME);
+	const std::string otherStartType = (startType == "warm") ? "cold" : "warm";
+	double otherLoadTimeInSecs = -1.0;
+	std::ifstream inFile(loadTimesFilepath.c_str());
+	std::string currStartType;
+	double currLoadTimeInSecs;
+	while (inFile >> currStartType >> currLoadTimeInSecs) {
+		if (currStartType == otherStartType) {
+			otherLoadTimeInSecs = currLoadTimeInSecs;
+		}
+	}
+	inFile.close();
+
+	if (otherLoadTimeInSecs > 0.0 && loadTimeInSecs > 0.0) {
+		out << "Last " << otherStartType << " load took " << otherLoadTimeInSecs << "s (";
+		if (startType == "warm") {
+			out << otherLoadTimeInSecs / loadTimeInSecs << "x slower)" << std::endl;
+		}
+		else {
+			out << loadTimeInSecs / otherLoadTimeInSecs << "x faster)" << std::endl;
+		}
+	}
+
+	std::ofstream outFile(loadTimesFilepath.c_str(), std::ios::out | std::ios::app);
+	if (outFile.is_open()) {
+		outFile << startType << " " << loadTimeInSecs << std::endl;
+	}
+}
+
+std::string DecodedAssetCache::GetEntryFilepath(const char* entryType, unsigned long hash, long sourceLength) const {
+	std::ostringstream filepath;
+	filepath << this->cacheDir << entryType << "_" << std::hex << std::setw(8) << std::setfill('0') << hash 
+	         << "_" << std::dec << sourceLength << ".bin";
+	return filepath.str();
+}
+
+/**
+ * Opens the given cache entry and reads past its header.
+ * Returns: true if the entry exists and was written with the current format, false otherwise.
+ */
+bool DecodedAssetCache::OpenEntry(const std::string& entryFilepath, std::ifstream& inFile) const {
+	inFile.open(entryFilepath.c_str(), std::ios::in | std::ios::binary);
+	if (!inFile.is_open()) {
+		return false;
+	}
+
+	char magic[4];
+	unsigned int version;
+	inFile.read(magic, sizeof(magic));
+	if (!inFile.good() || memcmp(magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) != 0 ||
+		!ReadValue(inFile, version) || version != FORMAT_VERSION) {
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Writes the given cache entry - this goes through a temporary file (named for the writing thread) that is
+ * then renamed so that no other thread, or a crash, can ever leave a half-written entry behind.
+ * Returns: true on success, false otherwise.
+ */
+bool DecodedAssetCache::CommitEntry(const std::string& entryFilepath, const std::string& entryData) const {
+	std::ostringstream tempFilepath;
+	tempFilepath << entryFilepath << "." << SDL_ThreadID() << ".tmp";
+
+	std::ofstream outFile(tempFilepath.str().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!outFile.is_open()) {
+		return false;
+	}
+	outFile.write(ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+	WriteValue<unsigned int>(outFile, FORMAT_VERSION);
+	outFile.write(entryData.data(), entryData.size());
+	bool success = outFile.good();
+	outFile.close();
+
+	// Renaming fails on some platforms when the entry already exists (e.g., another thread just wrote
+	// the same entry), either way there's a complete entry in place so just drop the temporary file
+	if (!success || std::rename(tempFilepath.str().c_str(), entryFilepath.c_str()) != 0) {
+		std::remove(tempFilepath.str().c_str());
+		return false;
+	}
+	return true;
+}
+
+/**
+ * Records the given (just committed) entry as the current one for the given source and removes whatever entry
+ * was current for that source before, since that one was decoded from contents the source no longer has and would
+ * otherwise sit in the cache forever. Each source's current entry is named in a small text file keyed on a hash
+ * of the source name.
+ */
+void DecodedAssetCache::ReplaceSourceEntry(const char* entryType, const std::string& sourceName, const std::string& entryFilepath) {
+	unsigned long sourceHash = DecodedAssetCache::HashBytes(reinterpret_cast<const unsigned char*>(sourceName.c_str()),
+		sourceName.size(), 2166136261UL);
+	std::ostringstream recordFilepath;
+	recordFilepath << this->cacheDir << entryType << "_src_" << std::hex << std::setw(8) << std::setfill('0') << sourceHash << ".txt";
+
+	std::string prevEntryFilepath;
+	std::ifstream inFile(recordFilepath.str().c_str());
+	std::getline(inFile, prevEntryFilepath);
+	inFile.close();
+
+	if (prevEntryFilepath == entryFilepath) {
+		return;
+	}
+	if (!prevEntryFilepath.empty() && std::remove(prevEntryFilepath.c_str()) == 0) {
+		SDL_mutexP(this->statsMutex);
+		this->numPruned++;
+		SDL_mutexV(this->statsMutex);
+	}
+
+	std::ofstream outFile(recordFilepath.str().c_str(), std::ios::out | std::ios::trunc);
+	if (outFile.is_open()) {
+		outFile << entryFilepath << std::endl;
+	}
+}
+
+void DecodedAssetCache::RecordLookup(bool wasHit, double timeInSecs) {
+	SDL_mutexP(this->statsMutex);
+	if (wasHit) {
+		this->numHits++;
+		this->cacheReadTimeInSecs += timeInSecs;
+	}
+	else {
+		this->numMisses++;
+		this->decodeTimeInSecs += timeInSecs;
+	}
+	SDL_mutexV(this->statsMutex);
+}
+
+// 32-bit FNV-1a hash of the given bytes, continuing on from the given hash
+unsigned long DecodedAssetCache::HashBytes(const unsigned char* bytes, long length, unsigned long hash) {
+	for (long i = 0; i < length; i++) {
+		hash ^= static_cast<unsigned long>(bytes[i]);
+		hash = (hash * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	return hash;
+}
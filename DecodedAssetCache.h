@@ -0,0 +1,89 @@
+/**
+ * DecodedAssetCache.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DECODEDASSETCACHE_H__
+#define __DECODEDASSETCACHE_H__
+
+#include "BlammoEngine/BasicIncludes.h"
+#include "BlammoEngine/Texture.h"
+#include "BlammoEngine/TextureFontSet.h"
+
+struct ObjMeshData;
+
+/**
+ * An on-disk cache of decoded resources (image texels, rasterized font glyphs and parsed obj meshes) that
+ * sits in a directory next to the game. Entries are keyed on a hash of the source file's bytes (along with any
+ * parameters the decoding depends on) so whenever the resource zip changes the affected entries simply stop being
+ * found and get rebuilt, the entries they replace are removed as that happens. Everything here is safe to call from
+ * any thread.
+ */
+class DecodedAssetCache {
+public:
+	static const char* CACHE_DIRECTORY;
+
+	explicit DecodedAssetCache(const std::string& cacheDir);
+	~DecodedAssetCache();
+
+	// These give the decoded form of the given source file bytes - it's read out of the cache when it's there,
+	// otherwise the source is decoded and the result is written to the cache for next time (replacing the
+	// entry last written for the same source file, if its contents have changed since)
+	Texture::DecodedImage* GetDecodedImage(const std::string& filepath, const unsigned char* fileBuffer, long fileBufferLength);
+	bool GetObjMeshData(const std::string& filepath, const char* fileBuffer, long fileBufferLength, ObjMeshData& meshData);
+	bool GetBakedFonts(const std::string& filepath, const unsigned char* fileBuffer, long fileBufferLength,
+		const std::vector<unsigned int>& heightsInPixels, std::vector<TextureFontSet::BakedFont>& bakedFonts);
+
+	void WriteLoadTimeReport(double loadTimeInSecs, std::ostream& out);
+
+private:
+	static const unsigned int FORMAT_VERSION;
+	static const char* LOAD_TIMES_FILENAME;
+
+	std::string cacheDir;
+
+	SDL_mutex* statsMutex;          // Guards everything below
+	int numHits;
+	int numMisses;
+	int numPruned;                  // Number of stale entries removed
+	double cacheReadTimeInSecs;     // Time spent reading entries out of the cache
+	double decodeTimeInSecs;        // Time spent decoding sources that weren't in the cache (including writing them to it)
+
+	std::string GetEntryFilepath(const char* entryType, unsigned long hash, long sourceLength) const;
+	bool OpenEntry(const std::string& entryFilepath, std::ifstream& inFile) const;
+	bool CommitEntry(const std::string& entryFilepath, const std::string& entryData) const;
+	void ReplaceSourceEntry(const char* entryType, const std::string& sourceName, const std::string& entryFilepath);
+	void RecordLookup(bool wasHit, double timeInSecs);
+
+	static unsigned long HashBytes(const unsigned char* bytes, long length, unsigned long hash);
+
+	DISALLOW_COPY_AND_ASSIGN(DecodedAssetCache);
+};
+
+#endif // __DECODEDASSETCACHE_H__
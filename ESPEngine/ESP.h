@@ -62,3 +62,6 @@
 #include "ESPRandomTextureParticle.h"
 #include "ESPAnimatedCurveParticle.h"
 #include "ESPMeshParticle.h"
+
+// Ticking emitters in parallel
+#include "ESPParallelTicker.h"
@@ -42,6 +42,9 @@ public:
     virtual void Draw(const Camera& camera) = 0;
     virtual bool IsDead() const = 0;
 
+    // Whether Tick can be called on another thread at the same time as other emitters are ticked
+    virtual bool CanTickInParallel() const { return false; }
+
 protected:
     ESPAbstractEmitter() {};
 
@@ -57,6 +57,9 @@ public:
     void AffectBeamOnTick(double dT, ESPBeam* beam);
 
     ESPEffector* Clone() const;
+
+    // The animations are ticked by every particle that gets affected
+    bool IsThreadSafeOnTick() const { return false; }
     
 private:
     AnimationMultiLerp<float> alphaAnimation0;
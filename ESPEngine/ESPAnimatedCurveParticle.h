@@ -62,7 +62,7 @@ private:
 };
 
 inline void ESPAnimatedCurveParticle::SelectRandomCurve() {
-    this->currSelectedCurveIdx = Randomizer::GetInstance()->RandomUnsignedInt() % this->possibleCurves.size();
+    this->currSelectedCurveIdx = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->possibleCurves.size();
     
     this->currLineThickness = 
         lineThickness.LerpInterval(1.0f, 20.0f, std::min<float>(20.0f, std::max<float>(1.0f, std::max<float>(this->size[0], this->size[1]))));
@@ -52,7 +52,7 @@ void ESPBeamSegment::Tick(double dT, const ESPBeam& parentBeam) {
 	if (timeCounter >= ANIMATION_TIME && this->childSegments.size() != 0 && this->parentSegment != NULL) {
 
 		Vector3D randomVec = Matrix4x4::rotationMatrix(
-            static_cast<float>(2*M_PI*Randomizer::GetInstance()->RandomNumNegOneToOne()), parentBeam.GetBeamLineVec()) * 
+            static_cast<float>(2*M_PI*Randomizer::GetPresentationInstance()->RandomNumNegOneToOne()), parentBeam.GetBeamLineVec()) * 
 			parentBeam.GetOrthoBeamLineVec();
 
         this->startPt = this->endPt;
@@ -33,6 +33,7 @@
 #define __ESPEFFECTOR_H__
 
 class ESPParticle;
+class ESPParticleSoA;
 class ESPBeam;
 
 /**
@@ -46,8 +47,16 @@ public:
 	virtual ~ESPEffector(){};
 
 	virtual void AffectParticleOnTick(double dT, ESPParticle* particle) = 0;
+    // Batched version of AffectParticleOnTick for all the alive particles of a batched emitter.
+    // Returns false if the effector has no batched implementation, in which case the emitter
+    // falls back to calling AffectParticleOnTick for each particle.
+    virtual bool AffectParticlesOnTick(double, ESPParticleSoA&) { return false; }
     virtual void AffectBeamOnTick(double dT, ESPBeam* beam) = 0;
     virtual ESPEffector* Clone() const = 0;
 
+    // Whether this effector can be used by several emitters that are ticking at the same time
+    // (on different threads), i.e., it doesn't change itself when it affects particles
+    virtual bool IsThreadSafeOnTick() const { return true; }
+
 };
 #endif // __ESPEFFECTOR_H__
\ No newline at end of file
@@ -41,15 +41,21 @@
 #include "ESPAnimatedCurveParticle.h"
 #include "ESPEmitterEventHandler.h"
 #include "ESPTextureShaderParticle.h"
+#include "ESPParticleSoA.h"
 
 #include "../BlammoEngine/TextLabel.h"
 
 ESPEmitter::ESPEmitter() : ESPAbstractEmitter(), timeSinceLastSpawn(0.0f), particleTexture(NULL),
+batchedParticles(NULL), batchedProxyParticle(NULL),
 particleAlignment(ESP::ScreenPlaneAligned), particleRed(1), particleGreen(1), particleBlue(1), particleAlpha(1),
 particleRotation(0), makeSizeConstraintsEqual(true), numParticleLives(ESPParticle::INFINITE_PARTICLE_LIVES),
 cutoffLifetimeInSecs(NO_CUTOFF_LIFETIME), currCutoffLifetimeCountdown(NO_CUTOFF_LIFETIME),
 isReversed(false), particleDeathPlane(Vector3D(1, 0, 0), Point3D(-FLT_MAX, 0, 0)),
-radiusDeviationFromPtX(0.0), radiusDeviationFromPtY(0.0), radiusDeviationFromPtZ(0.0) {
+radiusDeviationFromPtX(0.0), radiusDeviationFromPtY(0.0), radiusDeviationFromPtZ(0.0),
+randomStream(Randomizer::GetPresentationInstance()->RandomUnsignedInt()) {
+	// NOTE: Emitters are created on the main thread, so seeding each stream from the presentation
+	// randomizer keeps the streams reproducible for a given presentation seed
+
 	// NOTE: The death plane has been setup so that it's impossible to be in the 'death-zone' of it
 	this->particleSize[0] = ESPInterval(1,1);
 	this->particleSize[1] = ESPInterval(1,1);
@@ -89,6 +95,17 @@ void ESPEmitter::Flush() {
 	// Clear other relevant particle information
 	this->particleLivesLeft.clear();
 
+    // Clean up any batched particles
+    if (this->batchedParticles != NULL) {
+        delete this->batchedParticles;
+        this->batchedParticles = NULL;
+    }
+    if (this->batchedProxyParticle != NULL) {
+        delete this->batchedProxyParticle;
+        this->batchedProxyParticle = NULL;
+    }
+    this->batchedTextures.clear();
+
 	// Reset appropriate variables
 	this->timeSinceLastSpawn = 0.0f;
 	this->particleTexture = NULL;
@@ -96,6 +113,11 @@ void ESPEmitter::Flush() {
 
 void ESPEmitter::Kill() {
     // Convert all alive particles to dead particles, make the number of lives of all particles zero
+    if (this->batchedParticles != NULL) {
+        this->batchedParticles->KillAll();
+        this->batchedParticles->ZeroLives();
+    }
+
     for (std::list<ESPParticle*>::iterator iter = this->aliveParticles.begin(); iter != this->aliveParticles.end(); iter++) {
         ESPParticle* currParticle = *iter;
         currParticle->Kill();
@@ -121,17 +143,26 @@ void ESPEmitter::Kill() {
  */
 void ESPEmitter::ReviveParticle() {
 	// Let's spawn a particle!
-	// Remove a dead particle from the set of dead particles...
-	ESPParticle* zombie = this->deadParticles.front();
-	assert(zombie != NULL);
+	ESPParticle* zombie = NULL;
+    if (this->batchedParticles != NULL) {
+        if (!this->batchedParticles->HasRevivableParticle()) {
+            // No particles with lives left, therefore there's no respawn.
+            return;
+        }
+    }
+    else {
+	    // Remove a dead particle from the set of dead particles...
+	    zombie = this->deadParticles.front();
+	    assert(zombie != NULL);
 	
-	// Check to see if the particle has any lives left
-	if (this->particleLivesLeft[zombie] == 0) {
-		// No lives left for the particle, therefore it gets no respawn.
-		return;
-	}
+	    // Check to see if the particle has any lives left
+	    if (this->particleLivesLeft[zombie] == 0) {
+		    // No lives left for the particle, therefore it gets no respawn.
+		    return;
+	    }
 	
-	this->deadParticles.pop_front();
+	    this->deadParticles.pop_front();
+    }
 
 	// Figure out the properties we need to impart on the newly born particle...
 	Vector3D initialParticleVel(0,0,0);
@@ -158,12 +189,14 @@ void ESPEmitter::ReviveParticle() {
 		
 		// Reverse its velocity
 		initialParticleVel = -initialParticleVel;
+    }
 
-		zombie->Revive(initialPt, initialParticleVel, randomSizing, randomRotation, randomLifetime); 
-	}
-	else {
-		zombie->Revive(initialPt, initialParticleVel, randomSizing, randomRotation, randomLifetime); 
-	}
+    if (this->batchedParticles != NULL) {
+        this->ReviveBatchedParticle(initialPt, initialParticleVel, randomSizing, randomRotation, randomLifetime);
+        return;
+    }
+
+	zombie->Revive(initialPt, initialParticleVel, randomSizing, randomRotation, randomLifetime); 
 	
     // Depending on whether there's a colour pallet or not, assign a random colour value to the particle that we're reviving
     if (this->particleColourPalette.empty()) {
@@ -171,7 +204,7 @@ void ESPEmitter::ReviveParticle() {
 		    this->particleBlue.RandomValueInInterval()), this->particleAlpha.RandomValueInInterval());
     }
     else {
-        const Colour& randomColour = this->particleColourPalette[Randomizer::GetInstance()->RandomUnsignedInt() % this->particleColourPalette.size()];
+        const Colour& randomColour = this->particleColourPalette[Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->particleColourPalette.size()];
         zombie->SetColour(randomColour, 1.0f);
     }
 	this->aliveParticles.push_back(zombie);
@@ -191,6 +224,32 @@ void ESPEmitter::ReviveParticle() {
 	}
 }
 
+/**
+ * Private helper function for reviving a batched particle with the given properties.
+ */
+void ESPEmitter::ReviveBatchedParticle(const Point3D& pos, const Vector3D& vel, const Vector2D& size, 
+                                       float rot, float lifetime) {
+
+    assert(this->batchedParticles != NULL);
+    int idx = this->batchedParticles->Revive(pos, vel, size, rot, lifetime);
+    assert(idx >= 0);
+
+    if (this->particleColourPalette.empty()) {
+        this->batchedParticles->SetColour(idx, this->particleRed.RandomValueInInterval(), this->particleGreen.RandomValueInInterval(), 
+            this->particleBlue.RandomValueInInterval(), this->particleAlpha.RandomValueInInterval());
+    }
+    else {
+        const Colour& randomColour = this->particleColourPalette[Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->particleColourPalette.size()];
+        this->batchedParticles->SetColour(idx, randomColour.R(), randomColour.G(), randomColour.B(), 1.0f);
+    }
+
+    if (this->batchedTextures.size() > 1) {
+        this->batchedParticles->textureIdx[idx] = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->batchedTextures.size();
+    }
+
+    this->timeSinceLastSpawn = 0.0f;
+}
+
 /**
  * Determines whether the given particle is past the death plane (and thus should be killed).
  * Returns: true if past the death plane, false otherwise.
@@ -205,6 +264,10 @@ bool ESPEmitter::IsParticlePastDeathPlane(const ESPParticle& p) {
  * the movement between alive and dead particles.
  */
 void ESPEmitter::TickParticles(double dT) {
+    if (this->batchedParticles != NULL) {
+        this->TickBatchedParticles(dT);
+        return;
+    }
 
     std::list<ESPParticle*>::iterator tempIter;
     ESPParticle* currParticle;
@@ -241,11 +304,49 @@ void ESPEmitter::TickParticles(double dT) {
 	}
 }
 
+/**
+ * Private helper function for ticking the particles of a batched emitter, this does the same
+ * work as TickParticles but as a series of loops over all of the alive particles.
+ */
+void ESPEmitter::TickBatchedParticles(double dT) {
+    ESPParticleSoA& particles = *this->batchedParticles;
+
+    // Move any particles that have died among the dead
+    for (unsigned int i = 0; i < particles.GetNumAlive(); ) {
+        if (particles.IsDead(i) || particles.IsPastDeathPlane(i, this->particleDeathPlane)) {
+            particles.Kill(i);
+            continue;
+        }
+        ++i;
+    }
+
+    particles.Integrate(static_cast<float>(dT));
+
+    // Have each of the effectors in this emitter affect the particles, effectors without
+    // a batched implementation are run on each particle through the proxy particle
+    for (std::list<std::pair<ESPEffector*, bool> >::iterator effIter = this->effectors.begin(); 
+         effIter != this->effectors.end(); ++effIter) {
+
+        ESPEffector* effector = effIter->first;
+        if (effector->AffectParticlesOnTick(dT, particles)) {
+            continue;
+        }
+
+        for (unsigned int i = 0; i < particles.GetNumAlive(); i++) {
+            particles.LoadParticle(i, *this->batchedProxyParticle);
+            effector->AffectParticleOnTick(dT, this->batchedProxyParticle);
+            particles.StoreParticle(i, *this->batchedProxyParticle);
+        }
+    }
+}
+
 /**
  * Call this function in order to simulate the functionality equivalent to having
  * called Tick at all the dT over the interval of the given time.
  */
 void ESPEmitter::SimulateTicking(double time) {
+    Randomizer::PresentationStreamScope streamScope(this->randomStream);
+
 	double spawnInterval = time;
 	// Figure out how many particles should currently be spawned
 	if (this->particleLifetime.MeanValueInInterval() != ESPParticle::INFINITE_PARTICLE_LIFETIME) {
@@ -276,18 +377,23 @@ void ESPEmitter::SimulateTicking(double time) {
 	}
 
 	// Spawn the number of particles given and set all their proper values...
-	numberOfSpawns       = std::min<unsigned int>(numberOfSpawns, this->deadParticles.size());
+	numberOfSpawns       = std::min<unsigned int>(numberOfSpawns, this->GetNumDeadParticles());
 	double ticksPerSpawn = spawnInterval / static_cast<double>(numberOfSpawns);
 	double tickCounter   = numberOfSpawns * ticksPerSpawn;
 	for (unsigned int i = 0; i < numberOfSpawns; i++) {
-		assert(this->aliveParticles.size() == i);
+		assert(this->GetNumAliveParticles() == i);
 
 		this->ReviveParticle();
-		ESPParticle* newParticle = this->aliveParticles.back();
-		newParticle->Tick(tickCounter);
+        if (this->batchedParticles != NULL) {
+            this->batchedParticles->Integrate(i, static_cast<float>(tickCounter));
+        }
+        else {
+		    ESPParticle* newParticle = this->aliveParticles.back();
+		    newParticle->Tick(tickCounter);
+        }
 		tickCounter -= ticksPerSpawn;
 		
-		assert(this->aliveParticles.size() == (i + 1));
+		assert(this->GetNumAliveParticles() == (i + 1));
 	}
 
 	double tickTimeLeft = spawnInterval - (numberOfSpawns * this->particleSpawnDelta.minValue);
@@ -299,6 +405,7 @@ void ESPEmitter::SimulateTicking(double time) {
  * Public function, called each frame to execute the emitter.
  */
 void ESPEmitter::Tick(const double dT) {
+    Randomizer::PresentationStreamScope streamScope(this->randomStream);
 
     // Check for cutoff lifetime
     if (this->cutoffLifetimeInSecs != NO_CUTOFF_LIFETIME) {
@@ -314,7 +421,7 @@ void ESPEmitter::Tick(const double dT) {
 		
 		// We initialize all particles to living on the first run though
 		if (timeSinceLastSpawn == 0.0f) {
-			while(this->deadParticles.size() > 0 && this->numParticleLives != 0) {
+			while(this->GetNumDeadParticles() > 0 && this->numParticleLives != 0) {
 				this->ReviveParticle();
 			}
 		}
@@ -326,7 +433,7 @@ void ESPEmitter::Tick(const double dT) {
 
 		// Figure out if we can spawn a particle by bring it back from the dead (zombie particle... of doom)
 		float allowableTimeToSpawn = this->particleSpawnDelta.RandomValueInInterval();
-		if (this->timeSinceLastSpawn >= allowableTimeToSpawn && this->deadParticles.size() > 0) {
+		if (this->timeSinceLastSpawn >= allowableTimeToSpawn && this->GetNumDeadParticles() > 0) {
 			// Let's spawn a particle!
 			this->ReviveParticle();
 		}
@@ -337,6 +444,26 @@ void ESPEmitter::Tick(const double dT) {
 	}
 }
 
+/**
+ * Emitters only touch their own particles while ticking, except for event handlers (which call
+ * back into whoever is listening) and effectors that are shared with other emitters and change
+ * themselves while affecting particles.
+ */
+bool ESPEmitter::CanTickInParallel() const {
+    if (!this->eventHandlers.empty()) {
+        return false;
+    }
+    for (std::list<std::pair<ESPEffector*, bool> >::const_iterator effIter = this->effectors.begin(); 
+         effIter != this->effectors.end(); ++effIter) {
+        
+        bool isOwnedByThis = effIter->second;
+        if (!isOwnedByThis && !effIter->first->IsThreadSafeOnTick()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void ESPEmitter::DrawWithAddedTransform(const Camera& camera, const Matrix4x4& t) {
     // Setup OpenGL for drawing the particles in this emitter...
     glPushAttrib(GL_TEXTURE_BIT | GL_CURRENT_BIT | GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); 	
@@ -369,10 +496,7 @@ void ESPEmitter::DrawWithAddedTransform(const Camera& camera, const Matrix4x4& t
     glPushMatrix();
     glMultMatrixf(t.begin());
 
-    for (std::list<ESPParticle*>::iterator iter = this->aliveParticles.begin(); iter != this->aliveParticles.end(); ++iter) {
-        ESPParticle* currParticle = *iter;
-        currParticle->Draw(modelMat, modelInvMat, modelInvTMat, camera, this->particleAlignment);
-    }
+    this->DrawParticles(modelMat, modelInvMat, modelInvTMat, camera);
 
     glPopMatrix();
 
@@ -411,10 +535,7 @@ void ESPEmitter::Draw(const Camera& camera) {
     modelInvT.transposeInPlace();
     Matrix4x4 modelInvTMat(modelInvT.data());
 
-	for (std::list<ESPParticle*>::iterator iter = this->aliveParticles.begin(); iter != this->aliveParticles.end(); ++iter) {
-		ESPParticle* currParticle = *iter;
-		currParticle->Draw(modelMat, modelInvMat, modelInvTMat, camera, this->particleAlignment);
-	}
+	this->DrawParticles(modelMat, modelInvMat, modelInvTMat, camera);
 
 	glPopAttrib();
 }
@@ -447,14 +568,38 @@ void ESPEmitter::DrawWithDepth(const Camera& camera) {
     modelInvT.transposeInPlace();
     Matrix4x4 modelInvTMat(modelInvT.data());
 
-    for (std::list<ESPParticle*>::iterator iter = this->aliveParticles.begin(); iter != this->aliveParticles.end(); ++iter) {
-        ESPParticle* currParticle = *iter;
-        currParticle->Draw(modelMat, modelInvMat, modelInvTMat, camera, this->particleAlignment);
-    }
+    this->DrawParticles(modelMat, modelInvMat, modelInvTMat, camera);
 
     glPopAttrib();
 }
 
+/**
+ * Private helper function for drawing all the alive particles of this emitter.
+ */
+void ESPEmitter::DrawParticles(const Matrix4x4& modelMat, const Matrix4x4& modelMatInv, 
+                               const Matrix4x4& modelInvTMat, const Camera& camera) {
+
+    if (this->batchedParticles != NULL) {
+        // Batched particles are drawn through the proxy particle, binding textures only as they change
+        const Texture2D* currTexture = this->particleTexture;
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            const Texture2D* texture = this->batchedTextures[this->batchedParticles->textureIdx[i]];
+            if (texture != currTexture) {
+                texture->BindTexture();
+                currTexture = texture;
+            }
+            this->batchedParticles->LoadParticle(i, *this->batchedProxyParticle);
+            this->batchedProxyParticle->Draw(modelMat, modelMatInv, modelInvTMat, camera, this->particleAlignment);
+        }
+        return;
+    }
+
+	for (std::list<ESPParticle*>::iterator iter = this->aliveParticles.begin(); iter != this->aliveParticles.end(); ++iter) {
+		ESPParticle* currParticle = *iter;
+		currParticle->Draw(modelMat, modelMatInv, modelInvTMat, camera, this->particleAlignment);
+	}
+}
+
 /**
  * Public function for setting the particles for this emitter.
  * Returns: true on success, false otherwise.
@@ -479,6 +624,40 @@ bool ESPEmitter::SetParticles(unsigned int numParticles, Texture2D* texture) {
 	return true;
 }
 
+/**
+ * Public function for setting batched particles (see ESPParticleSoA) for this emitter, all
+ * of the particles will use the given texture (or be untextured if it's NULL).
+ * Returns: true on success, false otherwise.
+ */
+bool ESPEmitter::SetBatchedParticles(unsigned int numParticles, Texture2D* texture) {
+    std::vector<Texture2D*> textures(1, texture);
+    return this->SetBatchedRandomTextureParticles(numParticles, textures);
+}
+
+/**
+ * Public function for setting batched particles (see ESPParticleSoA) for this emitter, each
+ * particle will use a random texture from the given textures every time it's revived.
+ * Returns: true on success, false otherwise.
+ */
+bool ESPEmitter::SetBatchedRandomTextureParticles(unsigned int numParticles, const std::vector<Texture2D*>& textures) {
+	assert(numParticles > 0);
+    assert(!textures.empty());
+    // Batched particles don't exist as objects, so they can't be handed to event handlers
+    assert(this->eventHandlers.empty());
+
+	// Clean up all previous emitter data
+	this->Flush();
+
+    this->batchedTextures = textures;
+    this->particleTexture = textures.front();
+
+    this->batchedParticles = new ESPParticleSoA();
+    this->batchedParticles->Allocate(numParticles, this->numParticleLives);
+    this->batchedProxyParticle = new ESPParticle();
+
+	return true;
+}
+
 /**
  * Public function for setting particles for this emitter such that they are
  * all shader particles of the given effect.
@@ -657,6 +836,12 @@ void ESPEmitter::SetParticleAlignment(const ESP::ESPAlignment alignment) {
 void ESPEmitter::SetAliveParticleAlignmentAsVelocityBased(const Vector3D& velocityDir) {
     this->particleAlignment = ESP::ScreenAlignedFollowVelocity;
 
+    if (this->batchedParticles != NULL) {
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            this->batchedParticles->SetVelocityDir(i, velocityDir[0], velocityDir[1], velocityDir[2]);
+        }
+    }
+
     for (std::list<ESPParticle*>::iterator iter = this->aliveParticles.begin();
         iter != this->aliveParticles.end(); ++iter) {
 
@@ -668,6 +853,12 @@ void ESPEmitter::SetAliveParticleAlignmentAsVelocityBased(const Vector3D& veloci
 void ESPEmitter::SetAliveParticleAlignmentAsVelocityBased(const Vector2D& velocityDir) {
     this->particleAlignment = ESP::ScreenAlignedFollowVelocity;
 
+    if (this->batchedParticles != NULL) {
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            this->batchedParticles->SetVelocityDir(i, velocityDir[0], velocityDir[1], 0.0f);
+        }
+    }
+
     for (std::list<ESPParticle*>::iterator iter = this->aliveParticles.begin();
         iter != this->aliveParticles.end(); ++iter) {
 
@@ -708,6 +899,12 @@ void ESPEmitter::SetParticleLife(const ESPInterval& particleLife, bool affectLiv
 		    ESPParticle* currParticle = *iter;
 		    currParticle->ResetLifespanLength(particleLife.RandomValueInInterval());
 	    }
+        if (this->batchedParticles != NULL) {
+            for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+                this->batchedParticles->lifespan[i] = particleLife.RandomValueInInterval();
+                this->batchedParticles->age[i] = 0.0f;
+            }
+        }
     }
 }
 
@@ -732,6 +929,7 @@ void ESPEmitter::SetParticleSize(const ESPInterval& particleSizeX, const ESPInte
             currParticle->SetNewInitSizeScale(sX, sY);
         }
     }
+    this->SetBatchedAliveParticleSize(sX, sY, setInitSize);
 }
 void ESPEmitter::SetParticleSize(const ESPInterval& particleSize, bool setInitSize) {
 	this->SetParticleSpawnSize(particleSize);
@@ -747,6 +945,23 @@ void ESPEmitter::SetParticleSize(const ESPInterval& particleSize, bool setInitSi
             currParticle->SetNewInitSizeScale(s, s);
         }
     }
+    this->SetBatchedAliveParticleSize(s, s, setInitSize);
+}
+
+void ESPEmitter::SetBatchedAliveParticleSize(float sX, float sY, bool setInitSize) {
+    if (this->batchedParticles == NULL) {
+        return;
+    }
+    for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+        this->batchedParticles->sizeX[i] = sX;
+        this->batchedParticles->sizeY[i] = sY;
+    }
+    if (setInitSize) {
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            this->batchedParticles->initSizeX[i] = sX;
+            this->batchedParticles->initSizeY[i] = sY;
+        }
+    }
 }
 
 void ESPEmitter::SetParticleSpawnSize(const ESPInterval& particleSize) {
@@ -767,6 +982,11 @@ void ESPEmitter::SetParticleRotation(const ESPInterval& particleRot) {
 		ESPParticle* currParticle = *iter;
 		currParticle->SetRotation(particleRot.RandomValueInInterval());
 	}
+    if (this->batchedParticles != NULL) {
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            this->batchedParticles->rotation[i] = particleRot.RandomValueInInterval();
+        }
+    }
 }
 
 /**
@@ -784,6 +1004,12 @@ void ESPEmitter::SetParticleColour(const ESPInterval& red, const ESPInterval& gr
 		currParticle->SetColour(red.RandomValueInInterval(), green.RandomValueInInterval(), 
             blue.RandomValueInInterval(), alpha.RandomValueInInterval());
 	}
+    if (this->batchedParticles != NULL) {
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            this->batchedParticles->SetColour(i, red.RandomValueInInterval(), green.RandomValueInInterval(), 
+                blue.RandomValueInInterval(), alpha.RandomValueInInterval());
+        }
+    }
 }
 
 void ESPEmitter::SetParticleColourPalette(const std::vector<Colour>& colours) {
@@ -796,9 +1022,15 @@ void ESPEmitter::SetParticleColourPalette(const std::vector<Colour>& colours) {
         // Go through any already assigned particles and set the colour...
         for (std::list<ESPParticle*>::iterator iter = this->aliveParticles.begin(); iter != this->aliveParticles.end(); ++iter) {
             ESPParticle* currParticle = *iter;
-            const Colour& randomColour = this->particleColourPalette[Randomizer::GetInstance()->RandomUnsignedInt() % colours.size()];
+            const Colour& randomColour = this->particleColourPalette[Randomizer::GetPresentationInstance()->RandomUnsignedInt() % colours.size()];
             currParticle->SetColour(randomColour, 1.0f);
         }
+        if (this->batchedParticles != NULL) {
+            for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+                const Colour& randomColour = this->particleColourPalette[Randomizer::GetPresentationInstance()->RandomUnsignedInt() % colours.size()];
+                this->batchedParticles->SetColour(i, randomColour.R(), randomColour.G(), randomColour.B(), 1.0f);
+            }
+        }
     }
 }
 
@@ -811,6 +1043,11 @@ void ESPEmitter::SetParticleAlpha(const ESPInterval& alpha) {
 		ESPParticle* currParticle = *iter;
 		currParticle->SetAlpha(alpha.RandomValueInInterval());
 	}
+    if (this->batchedParticles != NULL) {
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            this->batchedParticles->alpha[i] = alpha.RandomValueInInterval();
+        }
+    }
 }
 
 void ESPEmitter::SetAliveParticleAlphaMax(float alpha) {
@@ -825,6 +1062,17 @@ void ESPEmitter::SetAliveParticleAlphaMax(float alpha) {
             currParticle->SetAlpha(std::min<float>(alpha, this->particleAlpha.RandomValueInInterval()));
         }
     }
+    if (this->batchedParticles != NULL) {
+        ESPParticleSoA& particles = *this->batchedParticles;
+        for (unsigned int i = 0; i < particles.GetNumAlive(); i++) {
+            if (alpha < particles.alpha[i]) {
+                particles.alpha[i] = alpha;
+            }
+            else if (particles.lifespan[i] == ESPParticle::INFINITE_PARTICLE_LIFETIME) {
+                particles.alpha[i] = std::min<float>(alpha, this->particleAlpha.RandomValueInInterval());
+            }
+        }
+    }
 }
 
 void ESPEmitter::SetAliveParticlePosition(float x, float y, float z) {
@@ -834,6 +1082,13 @@ void ESPEmitter::SetAliveParticlePosition(float x, float y, float z) {
         ESPParticle* currParticle = *iter;
         currParticle->SetPosition(x, y, z);
     }
+    if (this->batchedParticles != NULL) {
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            this->batchedParticles->posX[i] = x;
+            this->batchedParticles->posY[i] = y;
+            this->batchedParticles->posZ[i] = z;
+        }
+    }
 }
 
 void ESPEmitter::TranslateAliveParticlePosition(const Vector3D& t) {
@@ -843,6 +1098,13 @@ void ESPEmitter::TranslateAliveParticlePosition(const Vector3D& t) {
         ESPParticle* currParticle = *iter;
         currParticle->SetPosition(currParticle->GetPosition() + t);
     }
+    if (this->batchedParticles != NULL) {
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            this->batchedParticles->posX[i] += t[0];
+            this->batchedParticles->posY[i] += t[1];
+            this->batchedParticles->posZ[i] += t[2];
+        }
+    }
 }
 
 void ESPEmitter::SetAliveParticleScale(const ESPInterval& sX, const ESPInterval& sY) {
@@ -852,6 +1114,12 @@ void ESPEmitter::SetAliveParticleScale(const ESPInterval& sX, const ESPInterval&
             ESPParticle* currParticle = *iter;
             currParticle->SetScale(sX.RandomValueInInterval(), sY.RandomValueInInterval());
     }
+    if (this->batchedParticles != NULL) {
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            this->batchedParticles->sizeX[i] = sX.RandomValueInInterval();
+            this->batchedParticles->sizeY[i] = sY.RandomValueInInterval();
+        }
+    }
 }
 
 void ESPEmitter::SetAliveParticleScale(const ESPInterval& size) {
@@ -862,6 +1130,13 @@ void ESPEmitter::SetAliveParticleScale(const ESPInterval& size) {
             float scale = size.RandomValueInInterval();
             currParticle->SetScale(scale, scale);
     }
+    if (this->batchedParticles != NULL) {
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            float scale = size.RandomValueInInterval();
+            this->batchedParticles->sizeX[i] = scale;
+            this->batchedParticles->sizeY[i] = scale;
+        }
+    }
 }
 
 void ESPEmitter::SetNumParticleLives(int lives) {
@@ -878,6 +1153,9 @@ void ESPEmitter::SetNumParticleLives(int lives) {
 		ESPParticle* currParticle = *iter;
 		this->particleLivesLeft[currParticle] = lives;
 	}
+    if (this->batchedParticles != NULL) {
+        this->batchedParticles->SetLives(lives);
+    }
 }
 
 /**
@@ -932,6 +1210,7 @@ void ESPEmitter::AddCopiedEffector(const ESPEffector& effector) {
 // TODO: Get rid of this function, replace with set particle for onomatopiea effects!!!
 void ESPEmitter::AddParticle(ESPParticle* particle) {
 	assert(particle != NULL);
+    assert(this->batchedParticles == NULL);
 	this->deadParticles.push_back(particle);
 	
 	// Assign the number of lives...
@@ -956,6 +1235,7 @@ void ESPEmitter::ClearEffectors() {
  */
 void ESPEmitter::AddEventHandler(ESPEmitterEventHandler* eventHandler) {
 	assert(eventHandler != NULL);
+    assert(this->batchedParticles == NULL);
 	this->eventHandlers.push_back(eventHandler);
 }
 
@@ -976,6 +1256,11 @@ void ESPEmitter::Reset() {
         iter->second = this->numParticleLives;
     }
 
+    if (this->batchedParticles != NULL) {
+        this->batchedParticles->KillAll();
+        this->batchedParticles->SetLives(this->numParticleLives);
+    }
+
 	// Reset time...
 	this->timeSinceLastSpawn = 0.0f;
     if (this->cutoffLifetimeInSecs != NO_CUTOFF_LIFETIME) {
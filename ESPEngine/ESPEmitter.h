@@ -39,6 +39,7 @@
 
 #include "ESPAbstractEmitter.h"
 #include "ESPParticle.h"
+#include "ESPParticleSoA.h"
 #include "ESPUtil.h"
 #include "ESPEffector.h"
 #include "ESPParticleBatchMesh.h"
@@ -67,6 +68,9 @@ public:
 
 	bool ParticlesHaveNoLivesLeft() const {
 		if (this->numParticleLives != ESPParticle::INFINITE_PARTICLE_LIVES) {
+            if (this->batchedParticles != NULL) {
+                return this->batchedParticles->HasNoLivesLeft();
+            }
 			for (std::map<const ESPParticle*, int>::const_iterator iter = this->particleLivesLeft.begin(); iter != this->particleLivesLeft.end(); ++iter) {
 				if (iter->second != 0) {
 					return false;
@@ -78,7 +82,7 @@ public:
 	}
 
 	bool IsDead() const {
-		return (this->aliveParticles.size() == 0) && 
+		return (this->GetNumAliveParticles() == 0) && 
             (this->timeSinceLastSpawn > this->particleLifetime.maxValue || this->ParticlesHaveNoLivesLeft());
 	}
 
@@ -99,6 +103,14 @@ public:
     bool SetRandomCurveParticles(unsigned int numParticles, const ESPInterval& lineThickness, 
         const std::vector<Bezier*>& curves, const ESPInterval& animateTimeInSecs);
 
+    // Batched particles are plain textured particles stored as a structure-of-arrays (see ESPParticleSoA),
+    // they tick much faster than the particle objects set up by the functions above, which makes them the
+    // better choice for effects with lots of simple particles (e.g., debris, smoke). Batched emitters
+    // do not raise per-particle events to event handlers.
+    bool SetBatchedParticles(unsigned int numParticles, Texture2D* texture);
+    bool SetBatchedRandomTextureParticles(unsigned int numParticles, const std::vector<Texture2D*>& textures);
+    bool IsBatched() const { return this->batchedParticles != NULL; }
+
 	void SetParticleAlignment(const ESP::ESPAlignment alignment);
     void SetAliveParticleAlignmentAsVelocityBased(const Vector3D& velocityDir);
     void SetAliveParticleAlignmentAsVelocityBased(const Vector2D& velocityDir);
@@ -146,6 +158,7 @@ public:
 	void SimulateTicking(double time);
 
 	void Tick(double dT);
+    bool CanTickInParallel() const;
     void DrawWithAddedTransform(const Camera& camera, const Matrix4x4& t);
 	void Draw(const Camera& camera);
     void DrawWithDepth(const Camera& camera);
@@ -158,6 +171,11 @@ protected:
 	std::map<const ESPParticle*, int> particleLivesLeft;  // Number of lives left for each particle
 	std::list<ESPParticle*> aliveParticles;               // All the alive particles in this emitter
 	std::list<ESPParticle*> deadParticles;                // All the dead particles in this emitter
+
+    // When not NULL this emitter is batched: all of its particles live in this structure instead of the lists above
+    ESPParticleSoA* batchedParticles;
+    std::vector<Texture2D*> batchedTextures; // Possible textures of batched particles (indexed by the particles' textureIdx)
+    ESPParticle* batchedProxyParticle;       // Scratch particle for running per-particle code on batched particles
 	
     // If not NO_CUTOFF_LIFETIME, then this will kill the particle once it expires
     double cutoffLifetimeInSecs;
@@ -196,6 +214,10 @@ protected:
 	ESPInterval radiusDeviationFromPtY;
 	ESPInterval radiusDeviationFromPtZ;
 
+    // This emitter's own stream of random numbers, used in place of the presentation randomizer while
+    // ticking so that the emitter's particles come out the same no matter which thread ticks it
+    Randomizer randomStream;
+
 	void Flush();
     void Kill();
 
@@ -203,17 +225,41 @@ protected:
 	virtual Point3D  CalculateRandomInitParticlePos() const = 0;
 	void ReviveParticle();
 
+    unsigned int GetNumAliveParticles() const;
+    unsigned int GetNumDeadParticles() const;
+
 	bool IsParticlePastDeathPlane(const ESPParticle& p);
 
 private:
 	void TickParticles(double dT);
+    void TickBatchedParticles(double dT);
+    void ReviveBatchedParticle(const Point3D& pos, const Vector3D& vel, const Vector2D& size, float rot, float lifetime);
+    void SetBatchedAliveParticleSize(float sX, float sY, bool setInitSize);
+    void DrawParticles(const Matrix4x4& modelMat, const Matrix4x4& modelMatInv, const Matrix4x4& modelInvTMat, const Camera& camera);
     DISALLOW_COPY_AND_ASSIGN(ESPEmitter);
 };
 
 inline bool ESPEmitter::GetHasParticles() const {
+    if (this->batchedParticles != NULL) {
+        return this->batchedParticles->GetCapacity() > 0;
+    }
 	return !(this->aliveParticles.empty() && this->deadParticles.empty());
 }
 
+inline unsigned int ESPEmitter::GetNumAliveParticles() const {
+    if (this->batchedParticles != NULL) {
+        return this->batchedParticles->GetNumAlive();
+    }
+    return static_cast<unsigned int>(this->aliveParticles.size());
+}
+
+inline unsigned int ESPEmitter::GetNumDeadParticles() const {
+    if (this->batchedParticles != NULL) {
+        return this->batchedParticles->GetNumDead();
+    }
+    return static_cast<unsigned int>(this->deadParticles.size());
+}
+
 inline void ESPEmitter::SetParticleColour(const Colour& c) {
     this->SetParticleColour(ESPInterval(c.R()), ESPInterval(c.G()), ESPInterval(c.B()), ESPInterval(1.0f));
 }
@@ -69,7 +69,7 @@ void ESPLineEmitter::SetEmitAngle(float angleInDegrees) {
 Vector3D ESPLineEmitter::CalculateRandomInitParticleDir() const {
 	// Rotate the current emit direction along the line some random number of degrees between
 	// zero and the emitAngle
-	float randomAngleInDegs = Randomizer::GetInstance()->RandomNumNegOneToOne() * this->emitAngle;
+	float randomAngleInDegs = Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * this->emitAngle;
 	float randomAngleInRads = Trig::degreesToRadians(randomAngleInDegs);
 	Matrix4x4 rotMat = Matrix4x4::rotationMatrix(randomAngleInRads, this->emitLine.GetUnitDirection());
 
@@ -83,12 +83,12 @@ Point3D  ESPLineEmitter::CalculateRandomInitParticlePos() const {
 	Point3D  startPt = this->emitLine.P1();
 	Point3D  endPt   = this->emitLine.P2();
 	Vector3D endToEndVec = endPt - startPt;
-	Point3D randomPointOnLine = startPt + Randomizer::GetInstance()->RandomNumZeroToOne() * endToEndVec;
+	Point3D randomPointOnLine = startPt + Randomizer::GetPresentationInstance()->RandomNumZeroToOne() * endToEndVec;
 	
 	// Now vary that point by the random offset of the emitter...
-	float randomPtX = this->radiusDeviationFromPtX.RandomValueInInterval() * Randomizer::GetInstance()->RandomNegativeOrPositive();
-	float randomPtY = this->radiusDeviationFromPtY.RandomValueInInterval() * Randomizer::GetInstance()->RandomNegativeOrPositive();
-	float randomPtZ = this->radiusDeviationFromPtZ.RandomValueInInterval() * Randomizer::GetInstance()->RandomNegativeOrPositive();
+	float randomPtX = this->radiusDeviationFromPtX.RandomValueInInterval() * Randomizer::GetPresentationInstance()->RandomNegativeOrPositive();
+	float randomPtY = this->radiusDeviationFromPtY.RandomValueInInterval() * Randomizer::GetPresentationInstance()->RandomNegativeOrPositive();
+	float randomPtZ = this->radiusDeviationFromPtZ.RandomValueInInterval() * Randomizer::GetPresentationInstance()->RandomNegativeOrPositive();
 	Vector3D randomDisplacement(randomPtX, randomPtY, randomPtZ);
 
 	return randomPointOnLine + randomDisplacement;
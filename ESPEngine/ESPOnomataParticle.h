@@ -97,12 +97,12 @@ inline void ESPOnomataParticle::GenerateNewString() {
 }
 inline void ESPOnomataParticle::SetRandomSoundType() {
 	assert(!this->useGivenString);
-	unsigned int soundTypeRnd		= Randomizer::GetInstance()->RandomUnsignedInt() % Onomatoplex::NumSoundTypes;
+	unsigned int soundTypeRnd		= Randomizer::GetPresentationInstance()->RandomUnsignedInt() % Onomatoplex::NumSoundTypes;
 	this->soundType		= static_cast<Onomatoplex::SoundType>(soundTypeRnd);
 }
 inline void ESPOnomataParticle::SetRandomExtremeness() {
 	assert(!this->useGivenString);
-	unsigned int extremenessRnd	= Randomizer::GetInstance()->RandomUnsignedInt() % Onomatoplex::NumExtremenessTypes;
+	unsigned int extremenessRnd	= Randomizer::GetPresentationInstance()->RandomUnsignedInt() % Onomatoplex::NumExtremenessTypes;
 	this->extremeness	= static_cast<Onomatoplex::Extremeness>(extremenessRnd);
 }
 
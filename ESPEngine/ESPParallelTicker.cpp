@@ -0,0 +1,64 @@
+/**
+ * ESPParallelTicker.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ESPParallelTicker.h"
+
+#include "../BlammoEngine/JobSystem.h"
+#include "../BlammoEngine/FrameProfiler.h"
+
+void ESPParallelTicker::TickEmitterRange(void* context, size_t begin, size_t end) {
+    PROFILE_SCOPE("ESPParallelTicker::TickEmitterRange");
+    ESPParallelTicker* ticker = static_cast<ESPParallelTicker*>(context);
+    for (size_t i = begin; i < end; i++) {
+        ticker->parallelEmitters[i]->Tick(ticker->currDT);
+    }
+}
+
+void ESPParallelTicker::Tick(double dT) {
+    PROFILE_SCOPE("ESPParallelTicker::Tick");
+
+    for (std::vector<ESPAbstractEmitter*>::iterator iter = this->serialEmitters.begin();
+         iter != this->serialEmitters.end(); ++iter) {
+        (*iter)->Tick(dT);
+    }
+
+    this->currDT = dT;
+    if (this->parallelEmitters.size() < MIN_NUM_EMITTERS_FOR_PARALLEL) {
+        ESPParallelTicker::TickEmitterRange(this, 0, this->parallelEmitters.size());
+    }
+    else {
+        JobSystem::GetInstance()->ParallelFor(this->parallelEmitters.size(), 0, 
+            &ESPParallelTicker::TickEmitterRange, this);
+    }
+
+    this->serialEmitters.clear();
+    this->parallelEmitters.clear();
+}
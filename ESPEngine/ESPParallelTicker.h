@@ -0,0 +1,79 @@
+/**
+ * ESPParallelTicker.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ESPPARALLELTICKER_H__
+#define __ESPPARALLELTICKER_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+#include "ESPAbstractEmitter.h"
+
+/**
+ * Ticks a collection of independent emitters, the ones that can tick in parallel (see
+ * ESPAbstractEmitter::CanTickInParallel) are spread over the threads of the JobSystem and the
+ * rest are ticked on the calling thread. Only ticking is done here, the emitters still have to
+ * be drawn afterwards on the GL thread.
+ *
+ * Emitters are gathered up with AddEmitter each frame, Tick then ticks them all and clears the
+ * collection (keeping its memory around for the next frame).
+ */
+class ESPParallelTicker {
+public:
+    // With fewer emitters than this it isn't worth waking up the worker threads
+    static const size_t MIN_NUM_EMITTERS_FOR_PARALLEL = 8;
+
+    ESPParallelTicker() : currDT(0.0) {}
+    ~ESPParallelTicker() {}
+
+    void AddEmitter(ESPAbstractEmitter* emitter);
+    void Tick(double dT);
+
+private:
+    std::vector<ESPAbstractEmitter*> parallelEmitters;
+    std::vector<ESPAbstractEmitter*> serialEmitters;
+    double currDT;
+
+    static void TickEmitterRange(void* context, size_t begin, size_t end);
+
+    DISALLOW_COPY_AND_ASSIGN(ESPParallelTicker);
+};
+
+inline void ESPParallelTicker::AddEmitter(ESPAbstractEmitter* emitter) {
+    assert(emitter != NULL);
+    if (emitter->CanTickInParallel()) {
+        this->parallelEmitters.push_back(emitter);
+    }
+    else {
+        this->serialEmitters.push_back(emitter);
+    }
+}
+
+#endif // __ESPPARALLELTICKER_H__
@@ -44,6 +44,7 @@
 class Camera;
 
 class ESPParticle : public IPositionObject {
+    friend class ESPParticleSoA;
 public: 
 	static const int INFINITE_PARTICLE_LIFETIME = -1;
 	static const int INFINITE_PARTICLE_LIVES		= -1;
@@ -211,8 +212,6 @@ protected:
 	
     Vector3D velocityDir;   // Direction (normalized) of the velocity
     float speed;            // Always positive
-
-	static float minMaxPtSize[2];
 	
 
 private:
@@ -31,6 +31,7 @@
 
 #include "ESPParticleAccelEffector.h"
 #include "ESPParticle.h"
+#include "ESPParticleSoA.h"
 
 ESPParticleAccelEffector::ESPParticleAccelEffector(const Vector3D& accelAmount) :
 accelAmount(accelAmount) {
@@ -49,6 +50,26 @@ void ESPParticleAccelEffector::AffectParticleOnTick(double dT, ESPParticle* part
 	particle->SetVelocity(particle->GetVelocity() + (dT * this->accelAmount));
 }
 
+bool ESPParticleAccelEffector::AffectParticlesOnTick(double dT, ESPParticleSoA& particles) {
+    const unsigned int count = particles.GetNumAlive();
+    const float aX = static_cast<float>(dT) * this->accelAmount[0];
+    const float aY = static_cast<float>(dT) * this->accelAmount[1];
+    const float aZ = static_cast<float>(dT) * this->accelAmount[2];
+    const float INFINITE_LIFETIME = static_cast<float>(ESPParticle::INFINITE_PARTICLE_LIFETIME);
+
+    for (unsigned int i = 0; i < count; i++) {
+        // Particles that expired during this tick are left alone, same as the non-batched version
+        if (particles.lifespan[i] != INFINITE_LIFETIME && particles.age[i] >= particles.lifespan[i]) {
+            continue;
+        }
+        particles.velX[i] += aX;
+        particles.velY[i] += aY;
+        particles.velZ[i] += aZ;
+    }
+
+    return true;
+}
+
 void ESPParticleAccelEffector::AffectBeamOnTick(double, ESPBeam*) {
     assert(false);
     // NOT IMPLEMENTED YET
@@ -42,6 +42,7 @@ public:
 	~ESPParticleAccelEffector();
 
 	void AffectParticleOnTick(double dT, ESPParticle* particle);
+    bool AffectParticlesOnTick(double dT, ESPParticleSoA& particles);
     void AffectBeamOnTick(double dT, ESPBeam* beam);
 
 	void SetAcceleration(const Vector3D& a) {
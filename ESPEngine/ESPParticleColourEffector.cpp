@@ -1,5 +1,6 @@
 #include "ESPParticleColourEffector.h"
 #include "ESPParticle.h"
+#include "ESPParticleSoA.h"
 
 ESPParticleColourEffector::ESPParticleColourEffector() : 
 startAlpha(1), endAlpha(1), startColour(1,1,1), endColour(1,1,1), useStartColour(false) {
@@ -56,6 +57,38 @@ void ESPParticleColourEffector::AffectParticleOnTick(double dT, ESPParticle* par
 	particle->SetColour(currColour, currAlpha);
 }
 
+bool ESPParticleColourEffector::AffectParticlesOnTick(double dT, ESPParticleSoA& particles) {
+    UNUSED_PARAMETER(dT);
+
+    const unsigned int count = particles.GetNumAlive();
+    const float INFINITE_LIFETIME = static_cast<float>(ESPParticle::INFINITE_PARTICLE_LIFETIME);
+    const float diffR = this->endColour.R() - this->startColour.R();
+    const float diffG = this->endColour.G() - this->startColour.G();
+    const float diffB = this->endColour.B() - this->startColour.B();
+    const float diffA = this->endAlpha - this->startAlpha;
+
+    for (unsigned int i = 0; i < count; i++) {
+        const float lifespan = particles.lifespan[i];
+        if (lifespan != INFINITE_LIFETIME) {
+            // Linear interpolation based on the particle's lifetime
+            const float t = particles.age[i] / lifespan;
+            if (this->useStartColour) {
+                particles.red[i]   = this->startColour.R() + t * diffR;
+                particles.green[i] = this->startColour.G() + t * diffG;
+                particles.blue[i]  = this->startColour.B() + t * diffB;
+            }
+            particles.alpha[i] = this->startAlpha + t * diffA;
+        }
+        else if (this->useStartColour) {
+            particles.red[i]   = this->startColour.R();
+            particles.green[i] = this->startColour.G();
+            particles.blue[i]  = this->startColour.B();
+        }
+    }
+
+    return true;
+}
+
 void ESPParticleColourEffector::AffectBeamOnTick(double, ESPBeam*) {
     assert(false);
     // NOT IMPLEMENTED YET
@@ -46,6 +46,7 @@ public:
 	~ESPParticleColourEffector();
 
 	void AffectParticleOnTick(double dT, ESPParticle* particle);
+    bool AffectParticlesOnTick(double dT, ESPParticleSoA& particles);
     void AffectBeamOnTick(double dT, ESPBeam* beam);
 
 	float GetStartAlpha() const;
@@ -41,7 +41,7 @@ class ESPParticleRotateEffector : public ESPEffector {
 public:
 	enum RotationDirection { CLOCKWISE = 1, COUNTER_CLOCKWISE = -1 };
     static RotationDirection RandomDirection() {
-        return Randomizer::GetInstance()->RandomTrueOrFalse() ? CLOCKWISE : COUNTER_CLOCKWISE;
+        return Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? CLOCKWISE : COUNTER_CLOCKWISE;
     }
 
     ESPParticleRotateEffector(float rotationSpd, RotationDirection dir);
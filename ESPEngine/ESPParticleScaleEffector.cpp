@@ -31,6 +31,7 @@
 
 #include "ESPParticleScaleEffector.h"
 #include "ESPParticle.h"
+#include "ESPParticleSoA.h"
 
 ESPParticleScaleEffector::ESPParticleScaleEffector(const Vector2D& startScale, const Vector2D& endScale) :
 startScale(startScale), endScale(endScale) {
@@ -90,6 +91,49 @@ void ESPParticleScaleEffector::AffectParticleOnTick(double dT, ESPParticle* part
 	}
 }
 
+bool ESPParticleScaleEffector::AffectParticlesOnTick(double dT, ESPParticleSoA& particles) {
+    UNUSED_PARAMETER(dT);
+
+    const unsigned int count = particles.GetNumAlive();
+
+    if (this->effect.isInit) {
+        // Pulse effect (see AffectParticleOnTick)...
+        const double growthScale = this->effect.pulseGrowthScale;
+        for (unsigned int i = 0; i < count; i++) {
+            double pulseAmt = this->effect.pulseRate * particles.age[i];
+            pulseAmt = pulseAmt - floor(pulseAmt);
+
+            double amtOfScaling;
+            if (pulseAmt < 0.5) {
+                amtOfScaling = 2 * (growthScale - 1.0) * pulseAmt + 1.0;
+            }
+            else {
+                amtOfScaling = (-2 * growthScale + 2) * pulseAmt + 2 * growthScale - 1;
+            }
+            particles.sizeX[i] = static_cast<float>(amtOfScaling) * particles.initSizeX[i];
+            particles.sizeY[i] = static_cast<float>(amtOfScaling) * particles.initSizeY[i];
+        }
+        return true;
+    }
+
+    const float INFINITE_LIFETIME = static_cast<float>(ESPParticle::INFINITE_PARTICLE_LIFETIME);
+    const float diffX = this->endScale[0] - this->startScale[0];
+    const float diffY = this->endScale[1] - this->startScale[1];
+
+    for (unsigned int i = 0; i < count; i++) {
+        const float lifespan = particles.lifespan[i];
+        if (lifespan == INFINITE_LIFETIME) {
+            continue;
+        }
+        // Linear interpolation on the scale based on the particle's lifetime
+        const float t = particles.age[i] / lifespan;
+        particles.sizeX[i] = (this->startScale[0] + t * diffX) * particles.initSizeX[i];
+        particles.sizeY[i] = (this->startScale[1] + t * diffY) * particles.initSizeY[i];
+    }
+
+    return true;
+}
+
 void ESPParticleScaleEffector::AffectBeamOnTick(double, ESPBeam*) {
     assert(false);
     // NOT IMPLEMENTED YET
@@ -79,6 +79,7 @@ public:
     }
 
     void AffectParticleOnTick(double dT, ESPParticle* particle);
+    bool AffectParticlesOnTick(double dT, ESPParticleSoA& particles);
     void AffectBeamOnTick(double dT, ESPBeam* beam);
 
     ESPEffector* Clone() const;
@@ -0,0 +1,287 @@
+/**
+ * ESPParticleSoA.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ESPParticleSoA.h"
+
+ESPParticleSoA::ESPParticleSoA() : capacity(0), numAlive(0) {
+}
+
+ESPParticleSoA::~ESPParticleSoA() {
+}
+
+/**
+ * (Re)allocate storage for the given number of particles, all of which start out dead
+ * with the given number of lives.
+ */
+void ESPParticleSoA::Allocate(unsigned int numParticles, int numLives) {
+    this->capacity = numParticles;
+    this->numAlive = 0;
+
+    this->posX.assign(numParticles, 0.0f);
+    this->posY.assign(numParticles, 0.0f);
+    this->posZ.assign(numParticles, 0.0f);
+    this->velX.assign(numParticles, 0.0f);
+    this->velY.assign(numParticles, 0.0f);
+    this->velZ.assign(numParticles, 0.0f);
+    this->initSizeX.assign(numParticles, 1.0f);
+    this->initSizeY.assign(numParticles, 1.0f);
+    this->sizeX.assign(numParticles, 1.0f);
+    this->sizeY.assign(numParticles, 1.0f);
+    this->rotation.assign(numParticles, 0.0f);
+    this->red.assign(numParticles, 1.0f);
+    this->green.assign(numParticles, 1.0f);
+    this->blue.assign(numParticles, 1.0f);
+    this->alpha.assign(numParticles, 1.0f);
+    this->age.assign(numParticles, 0.0f);
+    this->lifespan.assign(numParticles, 0.0f);
+    this->livesLeft.assign(numParticles, numLives);
+    this->textureIdx.assign(numParticles, 0);
+}
+
+void ESPParticleSoA::Clear() {
+    this->Allocate(0, 0);
+}
+
+/**
+ * Returns: true if every particle (alive or dead) has no lives left.
+ */
+bool ESPParticleSoA::HasNoLivesLeft() const {
+    for (unsigned int i = 0; i < this->capacity; i++) {
+        if (this->livesLeft[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ESPParticleSoA::SetLives(int lives) {
+    std::fill(this->livesLeft.begin(), this->livesLeft.end(), lives);
+}
+
+void ESPParticleSoA::ZeroLives() {
+    this->SetLives(0);
+}
+
+/**
+ * Returns: true if there's a dead particle that still has lives left to be revived with.
+ */
+bool ESPParticleSoA::HasRevivableParticle() const {
+    for (unsigned int i = this->numAlive; i < this->capacity; i++) {
+        if (this->livesLeft[i] != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Revive a dead particle with the given properties. The particle that gets revived is the
+ * first dead one that still has lives left.
+ * Returns: The index of the revived particle, -1 if no dead particle could be revived.
+ */
+int ESPParticleSoA::Revive(const Point3D& pos, const Vector3D& vel, const Vector2D& size, 
+                           float rot, float lifespan) {
+
+    unsigned int zombieIdx = this->numAlive;
+    while (zombieIdx < this->capacity && this->livesLeft[zombieIdx] == 0) {
+        zombieIdx++;
+    }
+    if (zombieIdx >= this->capacity) {
+        return -1;
+    }
+    if (zombieIdx != this->numAlive) {
+        this->Swap(zombieIdx, this->numAlive);
+        zombieIdx = this->numAlive;
+    }
+
+    this->posX[zombieIdx] = pos[0];
+    this->posY[zombieIdx] = pos[1];
+    this->posZ[zombieIdx] = pos[2];
+    this->velX[zombieIdx] = vel[0];
+    this->velY[zombieIdx] = vel[1];
+    this->velZ[zombieIdx] = vel[2];
+    this->initSizeX[zombieIdx] = this->sizeX[zombieIdx] = size[0];
+    this->initSizeY[zombieIdx] = this->sizeY[zombieIdx] = size[1];
+    this->rotation[zombieIdx] = rot;
+    this->age[zombieIdx]      = 0.0f;
+    this->lifespan[zombieIdx] = lifespan;
+
+    // Subtract a life from the particle if the lives are not infinite
+    int& lives = this->livesLeft[zombieIdx];
+    if (lives != ESPParticle::INFINITE_PARTICLE_LIVES) {
+        assert(lives > 0);
+        lives--;
+    }
+
+    this->numAlive++;
+    return static_cast<int>(zombieIdx);
+}
+
+/**
+ * Kill the alive particle at the given index, the last alive particle is moved into its place.
+ */
+void ESPParticleSoA::Kill(unsigned int idx) {
+    assert(idx < this->numAlive);
+    this->numAlive--;
+    if (idx != this->numAlive) {
+        this->Swap(idx, this->numAlive);
+    }
+    this->age[this->numAlive] = this->lifespan[this->numAlive];
+}
+
+void ESPParticleSoA::KillAll() {
+    for (unsigned int i = 0; i < this->numAlive; i++) {
+        this->age[i] = this->lifespan[i];
+    }
+    this->numAlive = 0;
+}
+
+/**
+ * Move all the alive particles along their velocities and age them by the given delta time,
+ * this is the batched equivalent of ESPParticle::Tick.
+ */
+void ESPParticleSoA::Integrate(float dT) {
+    const unsigned int count = this->numAlive;
+    if (count == 0) {
+        return;
+    }
+
+    float* px = &this->posX[0];
+    float* py = &this->posY[0];
+    float* pz = &this->posZ[0];
+    const float* vx = &this->velX[0];
+    const float* vy = &this->velY[0];
+    const float* vz = &this->velZ[0];
+    for (unsigned int i = 0; i < count; i++) {
+        px[i] += dT * vx[i];
+        py[i] += dT * vy[i];
+        pz[i] += dT * vz[i];
+    }
+
+    float* a = &this->age[0];
+    for (unsigned int i = 0; i < count; i++) {
+        a[i] += dT;
+    }
+}
+
+void ESPParticleSoA::Integrate(unsigned int idx, float dT) {
+    assert(idx < this->numAlive);
+    this->posX[idx] += dT * this->velX[idx];
+    this->posY[idx] += dT * this->velY[idx];
+    this->posZ[idx] += dT * this->velZ[idx];
+    this->age[idx]  += dT;
+}
+
+/**
+ * Point the velocity of the given particle along the given direction, keeping its speed.
+ */
+void ESPParticleSoA::SetVelocityDir(unsigned int idx, float x, float y, float z) {
+    assert(idx < this->capacity);
+    float spd = sqrtf(this->velX[idx]*this->velX[idx] + this->velY[idx]*this->velY[idx] + this->velZ[idx]*this->velZ[idx]);
+    this->velX[idx] = spd * x;
+    this->velY[idx] = spd * y;
+    this->velZ[idx] = spd * z;
+}
+
+/**
+ * Copy the state of the particle at the given index into the given particle object, used
+ * to run per-particle code (e.g., non-batched effectors, drawing) against the batch.
+ */
+void ESPParticleSoA::LoadParticle(unsigned int idx, ESPParticle& particle) const {
+    assert(idx < this->capacity);
+
+    particle.totalLifespan   = this->lifespan[idx];
+    particle.currLifeElapsed = this->age[idx];
+    particle.initSize[0]     = this->initSizeX[idx];
+    particle.initSize[1]     = this->initSizeY[idx];
+    particle.size[0]         = this->sizeX[idx];
+    particle.size[1]         = this->sizeY[idx];
+    particle.rotation        = this->rotation[idx];
+    particle.colour          = Colour(this->red[idx], this->green[idx], this->blue[idx]);
+    particle.alpha           = this->alpha[idx];
+    particle.SetPosition(this->posX[idx], this->posY[idx], this->posZ[idx]);
+
+    Vector3D vel(this->velX[idx], this->velY[idx], this->velZ[idx]);
+    if (vel.IsZero()) {
+        particle.speed = 0.0f;
+        particle.velocityDir = Vector3D(0, 0, 0);
+    }
+    else {
+        particle.SetVelocity(vel);
+    }
+}
+
+/**
+ * Copy the state of the given particle object back into the particle at the given index.
+ */
+void ESPParticleSoA::StoreParticle(unsigned int idx, const ESPParticle& particle) {
+    assert(idx < this->capacity);
+
+    this->lifespan[idx]  = static_cast<float>(particle.totalLifespan);
+    this->age[idx]       = static_cast<float>(particle.currLifeElapsed);
+    this->initSizeX[idx] = particle.initSize[0];
+    this->initSizeY[idx] = particle.initSize[1];
+    this->sizeX[idx]     = particle.size[0];
+    this->sizeY[idx]     = particle.size[1];
+    this->rotation[idx]  = particle.rotation;
+    this->red[idx]       = particle.colour.R();
+    this->green[idx]     = particle.colour.G();
+    this->blue[idx]      = particle.colour.B();
+    this->alpha[idx]     = particle.alpha;
+    this->posX[idx]      = particle.position[0];
+    this->posY[idx]      = particle.position[1];
+    this->posZ[idx]      = particle.position[2];
+    this->velX[idx]      = particle.speed * particle.velocityDir[0];
+    this->velY[idx]      = particle.speed * particle.velocityDir[1];
+    this->velZ[idx]      = particle.speed * particle.velocityDir[2];
+}
+
+void ESPParticleSoA::Swap(unsigned int idxA, unsigned int idxB) {
+    std::swap(this->posX[idxA], this->posX[idxB]);
+    std::swap(this->posY[idxA], this->posY[idxB]);
+    std::swap(this->posZ[idxA], this->posZ[idxB]);
+    std::swap(this->velX[idxA], this->velX[idxB]);
+    std::swap(this->velY[idxA], this->velY[idxB]);
+    std::swap(this->velZ[idxA], this->velZ[idxB]);
+    std::swap(this->initSizeX[idxA], this->initSizeX[idxB]);
+    std::swap(this->initSizeY[idxA], this->initSizeY[idxB]);
+    std::swap(this->sizeX[idxA], this->sizeX[idxB]);
+    std::swap(this->sizeY[idxA], this->sizeY[idxB]);
+    std::swap(this->rotation[idxA], this->rotation[idxB]);
+    std::swap(this->red[idxA], this->red[idxB]);
+    std::swap(this->green[idxA], this->green[idxB]);
+    std::swap(this->blue[idxA], this->blue[idxB]);
+    std::swap(this->alpha[idxA], this->alpha[idxB]);
+    std::swap(this->age[idxA], this->age[idxB]);
+    std::swap(this->lifespan[idxA], this->lifespan[idxB]);
+    std::swap(this->livesLeft[idxA], this->livesLeft[idxB]);
+    std::swap(this->textureIdx[idxA], this->textureIdx[idxB]);
+}
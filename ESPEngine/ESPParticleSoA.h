@@ -0,0 +1,126 @@
+/**
+ * ESPParticleSoA.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ESPPARTICLESOA_H__
+#define __ESPPARTICLESOA_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+#include "../BlammoEngine/Point.h"
+#include "../BlammoEngine/Vector.h"
+#include "../BlammoEngine/Plane.h"
+
+#include "ESPParticle.h"
+
+/**
+ * ESPParticleSoA.h
+ * Structure-of-arrays storage for a pool of plain (textured quad) particles. Used by
+ * emitters in batched mode so that the particles can be ticked and affected as tight loops
+ * over contiguous arrays instead of a list of individually allocated ESPParticle objects.
+ * Alive particles always occupy the indices [0, GetNumAlive()), dead ones occupy the rest.
+ */
+class ESPParticleSoA {
+public:
+    ESPParticleSoA();
+    ~ESPParticleSoA();
+
+    void Allocate(unsigned int numParticles, int numLives);
+    void Clear();
+
+    unsigned int GetCapacity() const { return this->capacity; }
+    unsigned int GetNumAlive() const { return this->numAlive; }
+    unsigned int GetNumDead() const { return this->capacity - this->numAlive; }
+
+    bool IsDead(unsigned int idx) const;
+    bool IsPastDeathPlane(unsigned int idx, const Plane& deathPlane) const;
+    bool HasNoLivesLeft() const;
+
+    void SetLives(int lives);
+    void ZeroLives();
+
+    bool HasRevivableParticle() const;
+    int Revive(const Point3D& pos, const Vector3D& vel, const Vector2D& size, float rot, float lifespan);
+    void Kill(unsigned int idx);
+    void KillAll();
+
+    void Integrate(float dT);
+    void Integrate(unsigned int idx, float dT);
+
+    void SetColour(unsigned int idx, float r, float g, float b, float a);
+    void SetVelocityDir(unsigned int idx, float x, float y, float z);
+
+    void LoadParticle(unsigned int idx, ESPParticle& particle) const;
+    void StoreParticle(unsigned int idx, const ESPParticle& particle);
+
+    // Per-particle attributes, these are exposed directly so that effectors can run
+    // their batched updates over them. Only the first GetNumAlive() entries are meaningful.
+    std::vector<float> posX, posY, posZ;
+    std::vector<float> velX, velY, velZ;
+    std::vector<float> initSizeX, initSizeY;
+    std::vector<float> sizeX, sizeY;
+    std::vector<float> rotation;
+    std::vector<float> red, green, blue, alpha;
+    std::vector<float> age;       // Time in seconds since the particle was revived
+    std::vector<float> lifespan;  // Total lifespan in seconds (or ESPParticle::INFINITE_PARTICLE_LIFETIME)
+    std::vector<int> livesLeft;
+    std::vector<unsigned int> textureIdx;
+
+private:
+    unsigned int capacity;
+    unsigned int numAlive;
+
+    void Swap(unsigned int idxA, unsigned int idxB);
+
+    DISALLOW_COPY_AND_ASSIGN(ESPParticleSoA);
+};
+
+inline bool ESPParticleSoA::IsDead(unsigned int idx) const {
+    assert(idx < this->capacity);
+    return this->lifespan[idx] != static_cast<float>(ESPParticle::INFINITE_PARTICLE_LIFETIME) && 
+        this->age[idx] >= this->lifespan[idx];
+}
+
+inline bool ESPParticleSoA::IsPastDeathPlane(unsigned int idx, const Plane& deathPlane) const {
+    assert(idx < this->capacity);
+    const Point3D& ptOnPlane = deathPlane.GetPointOnPlane();
+    const Vector3D& n = deathPlane.GetUnitNormal();
+    return ((this->posX[idx] - ptOnPlane[0]) * n[0] + (this->posY[idx] - ptOnPlane[1]) * n[1] + 
+        (this->posZ[idx] - ptOnPlane[2]) * n[2]) <= 0;
+}
+
+inline void ESPParticleSoA::SetColour(unsigned int idx, float r, float g, float b, float a) {
+    assert(idx < this->capacity);
+    this->red[idx]   = r;
+    this->green[idx] = g;
+    this->blue[idx]  = b;
+    this->alpha[idx] = a;
+}
+
+#endif // __ESPPARTICLESOA_H__
@@ -49,7 +49,7 @@ Vector3D ESPPointEmitter::CalculateRandomInitParticleDir() const {
 	if (this->emitOnPlane) {
 
 		// Calculate a rotation matrix based on a random angle to emit at
-		double randomAngleInRads = static_cast<double>(this->emitAngleInRads) * Randomizer::GetInstance()->RandomNumNegOneToOne();
+		double randomAngleInRads = static_cast<double>(this->emitAngleInRads) * Randomizer::GetPresentationInstance()->RandomNumNegOneToOne();
 		Matrix4x4 rotationMatrix = Matrix4x4::rotationMatrix(randomAngleInRads, this->planeNormal);
 
 		Vector3D randomEmitDir = Vector3D::Normalize(rotationMatrix * this->emitDir);
@@ -60,8 +60,8 @@ Vector3D ESPPointEmitter::CalculateRandomInitParticleDir() const {
 		Vector3D sphCoordEmitDir = Vector3D::ToSphericalFromCartesian(this->emitDir);
 		
 		// Now just manipulate the theta and phi values based on the range (cone) of the emitter...
-		double thetaVariation = this->emitAngleInRads * Randomizer::GetInstance()->RandomNumNegOneToOne();
-		double phiVariation   = this->emitAngleInRads * Randomizer::GetInstance()->RandomNumNegOneToOne();
+		double thetaVariation = this->emitAngleInRads * Randomizer::GetPresentationInstance()->RandomNumNegOneToOne();
+		double phiVariation   = this->emitAngleInRads * Randomizer::GetPresentationInstance()->RandomNumNegOneToOne();
 		sphCoordEmitDir[1] += thetaVariation;
 		sphCoordEmitDir[2] += phiVariation;
 
@@ -98,9 +98,9 @@ Vector3D ESPPointEmitter::CalculateRandomInitParticleDir() const {
  * Returns: Initial position for particle spawn.
  */
 Point3D ESPPointEmitter::CalculateRandomInitParticlePos() const {
-	float randomPtX = this->radiusDeviationFromPtX.RandomValueInInterval() * Randomizer::GetInstance()->RandomNegativeOrPositive();
-	float randomPtY = this->radiusDeviationFromPtY.RandomValueInInterval() * Randomizer::GetInstance()->RandomNegativeOrPositive();
-	float randomPtZ = this->radiusDeviationFromPtZ.RandomValueInInterval() * Randomizer::GetInstance()->RandomNegativeOrPositive();
+	float randomPtX = this->radiusDeviationFromPtX.RandomValueInInterval() * Randomizer::GetPresentationInstance()->RandomNegativeOrPositive();
+	float randomPtY = this->radiusDeviationFromPtY.RandomValueInInterval() * Randomizer::GetPresentationInstance()->RandomNegativeOrPositive();
+	float randomPtZ = this->radiusDeviationFromPtZ.RandomValueInInterval() * Randomizer::GetPresentationInstance()->RandomNegativeOrPositive();
 	Point3D initialPt = this->emitPt + Vector3D(randomPtX, randomPtY, randomPtZ);
 
 	return initialPt;
@@ -113,6 +113,13 @@ void ESPPointEmitter::OverwriteEmittedPosition(const Point3D& pt) {
 		ESPParticle* currParticle = *iter;
         currParticle->SetPosition(pt);
 	}
+    if (this->batchedParticles != NULL) {
+        for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+            this->batchedParticles->posX[i] = pt[0];
+            this->batchedParticles->posY[i] = pt[1];
+            this->batchedParticles->posZ[i] = pt[2];
+        }
+    }
 }
 
 /**
@@ -58,7 +58,7 @@ inline void ESPRandomTextureParticle::Revive(const Point3D& pos, const Vector3D&
 }
 
 inline void ESPRandomTextureParticle::SelectRandomTexture() {
-    this->currSelectedTexIdx = Randomizer::GetInstance()->RandomUnsignedInt() % this->textures.size();
+    this->currSelectedTexIdx = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->textures.size();
 }
 
 #endif // __ESPRANDOMTEXTUREPARTICLE_H__
\ No newline at end of file
@@ -74,7 +74,7 @@ inline void ESPTextureShaderParticle::Draw(const Matrix4x4& modelMat, const Matr
 }
 
 inline void ESPTextureShaderParticle::SelectRandomTexture() {
-    this->currSelectedTexIdx = Randomizer::GetInstance()->RandomUnsignedInt() % this->textures.size();
+    this->currSelectedTexIdx = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->textures.size();
 }
 
 #endif //__ESPTEXTURESHADERPARTICLE_H__
\ No newline at end of file
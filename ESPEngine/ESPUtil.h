@@ -64,7 +64,7 @@ struct ESPInterval {
 	}
 
 	float RandomValueInInterval() const {
-		return static_cast<float>(minValue + Randomizer::GetInstance()->RandomNumZeroToOne()*(maxValue - minValue));
+		return static_cast<float>(minValue + Randomizer::GetPresentationInstance()->RandomNumZeroToOne()*(maxValue - minValue));
 	}
 
 	float MeanValueInInterval() const {
@@ -293,8 +293,8 @@ void ACEL::GameModelUpdated() {
             DO_MARQUEE_COLOUR_BLEND_MULT(newMarqueeColour, GameViewConstants::GetInstance()->POISON_LIGHT_LIGHT_COLOUR);
 
             transitionType = ArcadeSerialComm::MediumTransition;
-            this->serialComm.SetMarqueeFlash(Colour(0.0f, 0.3f + Randomizer::GetInstance()->RandomNumZeroToOne()*0.7f, 
-                Randomizer::GetInstance()->RandomNumZeroToOne()*0.2f),
+            this->serialComm.SetMarqueeFlash(Colour(0.0f, 0.3f + Randomizer::GetPresentationInstance()->RandomNumZeroToOne()*0.7f, 
+                Randomizer::GetPresentationInstance()->RandomNumZeroToOne()*0.2f),
                 ArcadeSerialComm::RandomMarqueeFlashType(), ArcadeSerialComm::RandomNumMarqueeFlashes(), false);
         }
 
@@ -24,9 +24,9 @@ public:
     void SetMarqueeColour(const Colour& c, TransitionTimeType timeType);
 
     enum MarqueeFlashType { VerySlowMarqueeFlash = 0, SlowMarqueeFlash, MediumMarqueeFlash, FastMarqueeFlash, VeryFastMarqueeFlash };
-    static MarqueeFlashType RandomMarqueeFlashType() { return static_cast<MarqueeFlashType>(Randomizer::GetInstance()->RandomUnsignedInt() % 5); };
+    static MarqueeFlashType RandomMarqueeFlashType() { return static_cast<MarqueeFlashType>(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 5); };
     enum NumMarqueeFlashes { OneFlash = 1, TwoFlashes, ThreeFlashes };
-    static NumMarqueeFlashes RandomNumMarqueeFlashes() { return static_cast<NumMarqueeFlashes>(1 + (Randomizer::GetInstance()->RandomUnsignedInt() % 3)); };
+    static NumMarqueeFlashes RandomNumMarqueeFlashes() { return static_cast<NumMarqueeFlashes>(1 + (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 3)); };
     void SetMarqueeFlash(const Colour& c, MarqueeFlashType flashType, NumMarqueeFlashes numFlashes = OneFlash, bool overridePrevFlashes = false);
 
 private:
@@ -144,6 +144,9 @@ void KeyboardSDLController::KeyDown(SDLKey key) {
 	if (key == SDLK_SPACE || key == SDLK_UP || key == SDLK_w) {
 		this->model->ShootActionReleaseUse();
 	}
+	else if (key == SDLK_F3) {
+		GameDisplay::ToggleDrawProfilerOverlay();
+	}
 
 	// Execute any debug functionality for when a key is pressed down...
 	this->DebugKeyDownActions(key);
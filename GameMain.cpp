@@ -37,6 +37,10 @@
 #include "BlammoEngine/FBObj.h"
 #include "BlammoEngine/Noise.h"
 #include "BlammoEngine/GeometryMaker.h"
+#include "BlammoEngine/FrameProfiler.h"
+#include "BlammoEngine/JobSystem.h"
+#include "BlammoEngine/AsyncFileWriter.h"
+#include "BlammoEngine/TaskGraph.h"
 
 #include "GameView/GameDisplay.h"
 #include "GameView/GameViewConstants.h"
@@ -52,18 +56,28 @@
 #include "GameModel/GameModelConstants.h"
 #include "GameModel/Onomatoplex.h"
 #include "GameModel/ArcadeLeaderboard.h"
+#include "GameModel/GameItemFactory.h"
 
 #include "GameControl/GameControllerManager.h"
 
 #include "ResourceManager.h"
 #include "WindowManager.h"
 #include "ConfigOptions.h"
+#include "Blammopedia.h"
 
 static GameSound* sound     = NULL;
 static GameModel* model     = NULL;
 static GameDisplay* display = NULL;
 
 static bool arcadeMode = false;
+static bool threadedModel = false;
+static bool deferredGameEvents = false;
+static std::string inputRecordingFilepath;
+static std::string profileFilepath;
+static bool serialStartup = false;
+
+// Number of times the GameAssets update the loading screen while the display is being created
+static const unsigned int NUM_GAME_ASSETS_LOADING_UPDATES = 5;
 
 /**
  * Clean up the ModelViewController classes that run the game.
@@ -93,6 +107,166 @@ static void CleanUpMVC() {
     }
 }
 
+// Everything the startup tasks need to know to build the game
+struct StartupInfo {
+    const ConfigOptions* cfgOptions;
+    std::string serialPort;
+    bool soundInitialized;
+};
+
+// Moves the loading screen along every time one of the startup tasks finishes
+class LoadingScreenTaskListener : public TaskGraph::Listener {
+public:
+    void TaskFinished(const TaskGraph& graph, TaskGraph::TaskID task, bool succeeded) {
+        UNUSED_PARAMETER(graph);
+        UNUSED_PARAMETER(task);
+        UNUSED_PARAMETER(succeeded);
+        LoadingScreen::GetInstance()->UpdateLoadingScreenWithRandomLoadStr();
+    }
+};
+
+// Reads the blammopedia without its textures (any thread). It's handed to the resource manager
+// right away since loading the worlds needs to know which items have been unlocked.
+static bool ReadBlammopediaTask(void* context) {
+    UNUSED_PARAMETER(context);
+    Blammopedia* blammopedia = Blammopedia::ReadFromBlammopediaFile(ResourceManager::GetLoadDir() +
+        std::string(ResourceManager::BLAMMOPEDIA_FILE));
+    if (blammopedia == NULL) {
+        debug_output("Could not load blammopedia!!!");
+        return false;
+    }
+    ResourceManager::GetInstance()->SetBlammopedia(blammopedia);
+    return true;
+}
+
+// Loads the blammopedia's textures (main thread)
+static bool LoadBlammopediaTexturesTask(void* context) {
+    UNUSED_PARAMETER(context);
+    Blammopedia* blammopedia = ResourceManager::GetInstance()->GetBlammopedia();
+    assert(blammopedia != NULL);
+
+    // Have every texture read and decoded in the background so that this thread only has to upload them
+    std::vector<std::string> textureFilepaths;
+    blammopedia->GetTextureFilepaths(textureFilepaths);
+    for (std::vector<std::string>::const_iterator iter = textureFilepaths.begin(); iter != textureFilepaths.end(); ++iter) {
+        ResourceManager::GetInstance()->PrefetchImgTextureResource(*iter);
+    }
+
+    return blammopedia->LoadTextures();
+}
+
+// Reads the sound definitions and starts streaming in the global sound files (main thread, since
+// irrKlang's device isn't safe to use from any other thread)
+static bool InitSoundTask(void* context) {
+    StartupInfo* info = static_cast<StartupInfo*>(context);
+    info->soundInitialized = sound->Init(arcadeMode);
+    if (info->soundInitialized) {
+        sound->SetSFXVolume(static_cast<float>(info->cfgOptions->GetSFXVolume()) / 100.0f);
+        sound->SetMusicVolume(static_cast<float>(info->cfgOptions->GetMusicVolume()) / 100.0f);
+        sound->PrefetchGlobalSounds();
+    }
+    else {
+        // The game still runs without sound
+        debug_output("Failed to load game sound.");
+    }
+    return true;
+}
+
+// Hands the streamed in global sound files to irrKlang (main thread)
+static bool LoadSoundsTask(void* context) {
+    const StartupInfo* info = static_cast<const StartupInfo*>(context);
+    if (info->soundInitialized) {
+        sound->LoadGlobalSounds();
+        debug_output("Sound initialized successfully.");
+    }
+    return true;
+}
+
+// Loads the worlds, their levels and the player's progress through them (any thread)
+static bool LoadModelTask(void* context) {
+    const StartupInfo* info = static_cast<const StartupInfo*>(context);
+    model = new GameModel(sound, info->cfgOptions->GetDifficulty(), info->cfgOptions->GetInvertBallBoost(), 
+        info->cfgOptions->GetBallBoostMode());
+    return true;
+}
+
+// Creates the display and controllers for the loaded model (main thread)
+static bool CreateDisplayTask(void* context) {
+    const StartupInfo* info = static_cast<const StartupInfo*>(context);
+
+    if (!inputRecordingFilepath.empty()) {
+        // Only the first model is recorded, the recording ends if the game gets reinitialized
+        if (model->StartInputRecording(inputRecordingFilepath, static_cast<unsigned long>(time(NULL)))) {
+            debug_output("Recording game input to " << inputRecordingFilepath);
+        }
+        inputRecordingFilepath.clear();
+    }
+    if (arcadeMode) {
+        ResourceManager::ReadLeaderboard(true, *model);
+    }
+    display = new GameDisplay(model, sound, info->cfgOptions->GetWindowWidth(), info->cfgOptions->GetWindowHeight(), arcadeMode);
+    if (threadedModel) {
+        display->SetModelUpdateMode(GameDisplay::ThreadedModelUpdates);
+    }
+
+    // Initialize all controllers that we can...
+    GameControllerManager::GetInstance()->InitAllControllers(model, display, arcadeMode);
+    GameControllerManager::GetInstance()->SetArcadeSerialPort(info->serialPort);
+    return true;
+}
+
+/**
+ * Build the game's model, view and sound while the loading screen is up. Reading the blammopedia
+ * and the worlds and levels is done on worker threads (along with the sound files, through the
+ * resource manager's streaming threads) while the main thread does whatever needs OpenGL or
+ * irrKlang, in order, as soon as what it depends on is ready. Returns false if the game couldn't
+ * be loaded.
+ */
+static bool LoadGame(const ConfigOptions& cfgOptions, const std::string& serialPort) {
+    // Singletons are created here, before any of the tasks can race to create them
+    GameModelConstants::GetInstance();
+    GameViewConstants::GetInstance();
+    GameItemFactory::GetInstance();
+    GameEventManager::Instance();
+    Randomizer::GetInstance();
+    AsyncFileWriter::GetInstance();
+
+    // The sound engine is created and used only on the main thread, workers just read its files
+    sound = new GameSound();
+
+    StartupInfo info;
+    info.cfgOptions = &cfgOptions;
+    info.serialPort = serialPort;
+    info.soundInitialized = false;
+
+    TaskGraph startupTasks;
+    TaskGraph::TaskID initSound = startupTasks.AddTask("Init sound", &InitSoundTask, &info, TaskGraph::MainThread);
+    TaskGraph::TaskID readBlammopedia = startupTasks.AddTask("Read blammopedia", &ReadBlammopediaTask, &info, TaskGraph::AnyThread);
+    TaskGraph::TaskID loadBlammopediaTextures = startupTasks.AddTask("Load blammopedia textures", &LoadBlammopediaTexturesTask, &info, TaskGraph::MainThread);
+    TaskGraph::TaskID loadSounds = startupTasks.AddTask("Load sounds", &LoadSoundsTask, &info, TaskGraph::MainThread);
+    TaskGraph::TaskID loadModel = startupTasks.AddTask("Load worlds", &LoadModelTask, &info, TaskGraph::AnyThread);
+    TaskGraph::TaskID createDisplay = startupTasks.AddTask("Create display", &CreateDisplayTask, &info, TaskGraph::MainThread);
+
+    startupTasks.AddDependency(loadBlammopediaTextures, readBlammopedia);
+    startupTasks.AddDependency(loadSounds, initSound);
+    startupTasks.AddDependency(loadModel, readBlammopedia);
+    startupTasks.AddDependency(createDisplay, loadBlammopediaTextures);
+    startupTasks.AddDependency(createDisplay, loadSounds);
+    startupTasks.AddDependency(createDisplay, loadModel);
+
+    LoadingScreen::GetInstance()->StartShowLoadingScreen(cfgOptions.GetWindowWidth(), cfgOptions.GetWindowHeight(),
+        startupTasks.GetNumTasks() + NUM_GAME_ASSETS_LOADING_UPDATES);
+
+    LoadingScreenTaskListener listener;
+    bool success = startupTasks.Run(serialStartup ? 0 : JobSystem::GetNumProcessors(), &listener);
+
+    std::ostringstream timingReport;
+    startupTasks.WriteTimingReport(timingReport);
+    debug_output("Game startup tasks (" << (serialStartup ? "serial" : "parallel") << "):" << std::endl << timingReport.str());
+
+    return success;
+}
+
 /**
  * Run the main game loop - this will continuously draw the game until
  * either the game is quit or reinitialization (e.g., to switch video size) occurs.
@@ -106,6 +280,9 @@ static void GameRenderLoop() {
 	while (!display->HasGameExited() && !display->ShouldGameReinitialize()) {
 		Uint32 startOfFrameTime = SDL_GetTicks();
 
+		// The model can't be stepped (on its own thread) while it's being read and drawn
+		display->LockModel();
+
 		// Synchronize the controller state with the current game loop
 		GameControllerManager::GetInstance()->SyncControllers(frameTimeDelta);
 
@@ -114,12 +291,16 @@ static void GameRenderLoop() {
 
 		// Render what's currently being displayed by the game
 		display->Render(frameTimeDelta);
+		display->UnlockModel();
 		SDL_GL_SwapBuffers();
+		FrameProfiler::EndFrame();
 
 		SDL_Delay(GameDisplay::FRAME_SLEEP_MS);
 
 		// Process controller events
+		display->LockModel();
 		quitGame = GameControllerManager::GetInstance()->ProcessControllers(frameTimeDelta);
+		display->UnlockModel();
 		if (quitGame) {
 			display->QuitGame();
 		}
@@ -177,11 +358,42 @@ int main(int argc, char *argv[]) {
     if (argc > 1) {
         if (std::string(argv[1]) == std::string("-a")) {
             arcadeMode = true;
-            if (argc > 2) {
+            if (argc > 2 && argv[2][0] != '-') {
                 serialPort = std::string(argv[2]);
             }
         }
     }
+    // Stepping the model at a fixed rate on its own thread, deferring game events, recording the session's input
+    // (for replaying with the HeadlessModelRunner), profiling (written out as a Chrome trace,
+    // or as CSV if the file ends in .csv) and loading everything serially on the main thread (to
+    // compare load times against the default parallel startup) can be turned on anywhere in the arguments
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == std::string("-modelthread")) {
+            threadedModel = true;
+        }
+        else if (std::string(argv[i]) == std::string("-deferredevents")) {
+            deferredGameEvents = true;
+        }
+        else if (std::string(argv[i]) == std::string("-record") && i + 1 < argc) {
+            inputRecordingFilepath = std::string(argv[++i]);
+        }
+        else if (std::string(argv[i]) == std::string("-profile") && i + 1 < argc) {
+            profileFilepath = std::string(argv[++i]);
+        }
+        else if (std::string(argv[i]) == std::string("-serialstartup")) {
+            serialStartup = true;
+        }
+    }
+    if (deferredGameEvents) {
+        GameEventManager::Instance()->SetDispatchMode(GameEventManager::DeferredDispatch);
+    }
+    if (deferredGameEvents || threadedModel) {
+        // The event stats are written out on exit
+        GameEventManager::Instance()->SetDispatchTimingEnabled(true);
+    }
+    if (!profileFilepath.empty()) {
+        FrameProfiler::SetEnabled(true);
+    }
 
 	// Set the default config options - these will be read from and written to
 	// the .ini file as we need them
@@ -232,46 +444,23 @@ int main(int argc, char *argv[]) {
         Camera::SetWindowDimensions(initCfgOptions.GetWindowWidth(), initCfgOptions.GetWindowHeight());
 
 		// Create the MVC while showing the loading screen...
-		LoadingScreen::GetInstance()->StartShowLoadingScreen(initCfgOptions.GetWindowWidth(), initCfgOptions.GetWindowHeight(), 7);
+		double loadStartTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs();
 		
         // Set the controller sensitivity from the initial configuration options
         //GameControllerManager::GetInstance()->SetControllerSensitivity(initCfgOptions.GetControllerSensitivity());
 
-		// Load the blammopedia...
-		LoadingScreen::GetInstance()->UpdateLoadingScreenWithRandomLoadStr();
-        if (!ResourceManager::GetInstance()->LoadBlammopedia(ResourceManager::GetLoadDir() + 
-            std::string(ResourceManager::BLAMMOPEDIA_FILE))) {
-
+        if (!LoadGame(initCfgOptions, serialPort)) {
 			quitGame = true;
 			break;
 		}
 
-        // Load basic default in-memory sounds
-        LoadingScreen::GetInstance()->UpdateLoadingScreenWithRandomLoadStr();
-        sound = new GameSound();
-        if (sound->Init(arcadeMode)) {
-            sound->LoadGlobalSounds();
-            sound->SetSFXVolume(static_cast<float>(initCfgOptions.GetSFXVolume()) / 100.0f);
-            sound->SetMusicVolume(static_cast<float>(initCfgOptions.GetMusicVolume()) / 100.0f);
-            std::cout << "Sound initialized successfully." << std::endl;
-        }
-        else {
-            std::cerr << "Failed to load game sound." << std::endl;
-        }
-
-        model = new GameModel(sound, initCfgOptions.GetDifficulty(), initCfgOptions.GetInvertBallBoost(), initCfgOptions.GetBallBoostMode());
-        if (arcadeMode) {
-            ResourceManager::ReadLeaderboard(true, *model);
-        }
-		display = new GameDisplay(model, sound, initCfgOptions.GetWindowWidth(), initCfgOptions.GetWindowHeight(), arcadeMode);
-
-		// Initialize all controllers that we can...
-		GameControllerManager::GetInstance()->InitAllControllers(model, display, arcadeMode);
-        GameControllerManager::GetInstance()->SetArcadeSerialPort(serialPort);
-
 		LoadingScreen::GetInstance()->EndShowingLoadingScreen();
 		debug_opengl_state();
 
+		std::ostringstream loadTimeReport;
+		ResourceManager::GetInstance()->ReportLoadTime(BlammoTime::GetHighResolutionTimeInSecs() - loadStartTimeInSecs, loadTimeReport);
+		debug_output(loadTimeReport.str());
+
 		// This will run the game until quit or reinitialization
 		GameRenderLoop();
 
@@ -283,12 +472,24 @@ int main(int argc, char *argv[]) {
 		KillGraphicsAndWindow(quitGame);
 	}
 
+	if (deferredGameEvents || threadedModel) {
+		std::ostringstream eventStatsReport;
+		GameEventManager::Instance()->WriteEventStats(eventStatsReport);
+		debug_output(eventStatsReport.str());
+	}
+	if (!profileFilepath.empty() && FrameProfiler::WriteToFile(profileFilepath)) {
+		debug_output("Wrote frame profile to " << profileFilepath);
+	}
+
 	GameModelConstants::DeleteInstance();
 	GameViewConstants::DeleteInstance();
 	GameEventManager::DeleteInstance();
     GameViewEventManager::DeleteInstance();
 	Onomatoplex::Generator::DeleteInstance();
 	Randomizer::DeleteInstance();
+	JobSystem::DeleteInstance();
+	// Blocks until any queued progress/leaderboard writes are on disk
+	AsyncFileWriter::DeleteInstance();
 
 	// One-Time Deletion Stuff (only on exit) *****************************
 
@@ -56,6 +56,10 @@ public:
 
     virtual AbstractBossBodyPart::Type GetType() const = 0;
 
+    // Lets go of anything attached to the part, done when the part is destroyed or earlier when its
+    // deletion is put off (see GameEventManager::DeleteAfterDispatch)
+    virtual void PrepareForDeletion() {}
+
     virtual void Tick(double dT);
 
     virtual BossBodyPart* CollisionCheck(const GameBall& ball, double dT, Vector2D& n,
@@ -63,7 +63,7 @@ LevelPiece* AlwaysDropBlock::Destroy(GameModel* gameModel, const LevelPiece::Des
 
 	// Obliterate all that is left of this block...
 	LevelPiece* tempThis = this;
-	delete tempThis;
+	GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
 	tempThis = NULL;
 
     // Add to the ball boost meter...
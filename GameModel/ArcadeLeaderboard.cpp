@@ -2,6 +2,8 @@
 #include "GameModel.h"
 #include "GameLevel.h"
 
+#include "../BlammoEngine/AsyncFileWriter.h"
+
 const char* ArcadeLeaderboard::FILEPATH = "leaderboard.txt";
 const int ArcadeLeaderboard::NUM_ENTRIES = 5;
 
@@ -20,8 +22,8 @@ bool LeaderboardEntry::ReadFromFile(std::ifstream& inFile, LeaderboardEntry& ent
     return true;
 }
 
-bool LeaderboardEntry::WriteToFile(std::ofstream& outFile) const {
-#define WRITE_OUT_FILE_FAIL(outFile, valueToWrite) if (!(outFile << valueToWrite)) { try { outFile.close(); } catch(...) {} return false; }
+bool LeaderboardEntry::WriteToFile(std::ostream& outFile) const {
+#define WRITE_OUT_FILE_FAIL(outFile, valueToWrite) if (!(outFile << valueToWrite)) { return false; }
     WRITE_OUT_FILE_FAIL(outFile, this->playerName << " ");
     WRITE_OUT_FILE_FAIL(outFile, this->score << std::endl);
 #undef WRITE_OUT_FILE_FAIL
@@ -67,6 +69,9 @@ ArcadeLeaderboard::~ArcadeLeaderboard() {
 }
 
 ArcadeLeaderboard* ArcadeLeaderboard::ReadFromFile(const GameModel& model) {
+    // Make sure any queued write of the leaderboard has landed before reading it back
+    AsyncFileWriter::GetInstance()->Flush();
+
     // Open the file off disk
     std::ifstream inFile;
     inFile.open((ResourceManager::GetLoadDir() + std::string(ArcadeLeaderboard::FILEPATH)).c_str());
@@ -110,15 +115,8 @@ ArcadeLeaderboard* ArcadeLeaderboard::ReadFromFile(const GameModel& model) {
 }
 
 bool ArcadeLeaderboard::WriteToFile() const {
-
-    // Open or create the file for writing
-    std::ofstream outFile;
-    outFile.open((ResourceManager::GetLoadDir() + std::string(ArcadeLeaderboard::FILEPATH)).c_str());
-    if (!outFile.is_open()) {
-        // Couldn't open for writing...
-        outFile.close();
-        return false;
-    }
+    // Build the file contents in memory, the file itself is written in the background
+    std::ostringstream outFile;
 
     bool success = true;
     // Write the leaderboard entries to file
@@ -136,6 +134,11 @@ bool ArcadeLeaderboard::WriteToFile() const {
         }
     }
 
+    if (success) {
+        AsyncFileWriter::GetInstance()->Write(
+            ResourceManager::GetLoadDir() + std::string(ArcadeLeaderboard::FILEPATH), outFile.str());
+    }
+
     return success;
 }
 
@@ -149,8 +152,8 @@ bool ArcadeLeaderboard::ReadLevelHighscoreFromFile(std::ifstream& inFile, std::p
     return true;
 }
 
-bool ArcadeLeaderboard::WriteLevelHighscoreToFile(std::ofstream& outFile, const std::pair<int,int>& worldLevelIdxPair, long levelHighscore) {
-#define WRITE_OUT_FILE_FAIL(outFile, valueToWrite) if (!(outFile << valueToWrite)) { try { outFile.close(); } catch(...) {} return false; }
+bool ArcadeLeaderboard::WriteLevelHighscoreToFile(std::ostream& outFile, const std::pair<int,int>& worldLevelIdxPair, long levelHighscore) {
+#define WRITE_OUT_FILE_FAIL(outFile, valueToWrite) if (!(outFile << valueToWrite)) { return false; }
     WRITE_OUT_FILE_FAIL(outFile, worldLevelIdxPair.first << " ");
     WRITE_OUT_FILE_FAIL(outFile, worldLevelIdxPair.second << " ");
     WRITE_OUT_FILE_FAIL(outFile, levelHighscore << std::endl);
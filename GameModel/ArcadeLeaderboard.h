@@ -25,7 +25,7 @@ public:
     long score;
 
     static bool ReadFromFile(std::ifstream& inFile, LeaderboardEntry& entry);
-    bool WriteToFile(std::ofstream& outFile) const;
+    bool WriteToFile(std::ostream& outFile) const;
 
     //std::map<std::pair<GameWorld::WorldStyle, int>, uint32_t> levelScores;
 };
@@ -62,7 +62,7 @@ private:
 
 
     static bool ReadLevelHighscoreFromFile(std::ifstream& inFile, std::pair<int,int>& worldLevelIdxPair, long& levelHighscore);
-    static bool WriteLevelHighscoreToFile(std::ofstream& outFile, const std::pair<int,int>& worldLevelIdxPair, long levelHighscore);
+    static bool WriteLevelHighscoreToFile(std::ostream& outFile, const std::pair<int,int>& worldLevelIdxPair, long levelHighscore);
 };
 
 #endif // __ARCADELEADERBOARD_H__
\ No newline at end of file
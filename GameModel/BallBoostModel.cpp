@@ -62,7 +62,7 @@ BallBoostModel::BallBoostModel(GameModel* gameModel) :
 ballBoostDir(0,0), numAvailableBoosts(0), gameModel(gameModel),
 currState(NotInBulletTime), timeDialationAnim(1.0f), totalBulletTimeElapsed(0.0), elapsedBoostChargeTime(0.0),
 isBallBoostInverted(gameModel->GetIsBallBoostInverted()),
-boostChargeTime(BallBoostModel::DEFAULT_BOOST_CHARGE_TIME_SECONDS) {
+boostChargeTime(BallBoostModel::DEFAULT_BOOST_CHARGE_TIME_SECONDS), isPreparedForDeletion(false) {
 
     // Setup the initial states for the various animations...
     timeDialationAnim.SetInterpolantValue(1.0f);
@@ -79,9 +79,18 @@ boostChargeTime(BallBoostModel::DEFAULT_BOOST_CHARGE_TIME_SECONDS) {
 }
 
 BallBoostModel::~BallBoostModel() {
+    this->PrepareForDeletion();
+}
+
+void BallBoostModel::PrepareForDeletion() {
+    if (this->isPreparedForDeletion) {
+        return;
+    }
+
     this->gameModel->GetTransformInfo()->SetBulletTimeCamera(false);
     // EVENT: Ball Boost lost
     GameEventManager::Instance()->ActionBallBoostLost(true);
+    this->isPreparedForDeletion = true;
 }
 
 void BallBoostModel::Tick(const GameModel& gameModel, double dT) {
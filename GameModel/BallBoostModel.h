@@ -67,6 +67,10 @@ public:
     BallBoostModel(GameModel* gameModel);
     ~BallBoostModel();
 
+    // Takes the camera out of bullet time and lets everyone know the boosts are gone, done when the
+    // boost model is destroyed or earlier when its deletion is put off (see GameEventManager::DeleteAfterDispatch)
+    void PrepareForDeletion();
+
     void Tick(const GameModel& gameModel, double dT);
 
     // Events that indicate changes to the boost model's state - based on input from the player
@@ -123,6 +127,7 @@ private:
     double boostChargeTime;         // Currently set amount of time it takes for a boost to be gained
 
     bool isBallBoostInverted;  // Whether ball boosting controls are inverted or not
+    bool isPreparedForDeletion;
 
 
     //std::list<std::pair<unsigned long, float> > boostDirMagnitudeCache; // Keeps a cache of the current boost's direction magnitude values
@@ -36,6 +36,8 @@
 
 #include "../BlammoEngine/BasicIncludes.h"
 
+DEFINE_POOLED_ALLOCATION(BallCamItem, 4)
+
 const char*  BallCamItem::BALL_CAM_ITEM_NAME	    = "BallCam";
 const double BallCamItem::BALL_CAM_TIMER_IN_SECS	= 15.0;
 
@@ -56,7 +58,7 @@ double BallCamItem::Activate() {
 		GameItemTimer* currTimer = *iter;
 		if (currTimer->GetTimerItemType() == GameItem::BallCamItem || currTimer->GetTimerItemType() == GameItem::PaddleCamItem) {
 			iter = activeTimers.erase(iter);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 		}
 		else {
@@ -40,6 +40,8 @@
  */
 class BallCamItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* BALL_CAM_ITEM_NAME;
 	static const double BALL_CAM_TIMER_IN_SECS;
 
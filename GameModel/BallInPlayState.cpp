@@ -44,6 +44,7 @@
 #include "PaddleRemoteControlRocketProjectile.h"
 #include "CannonBlock.h"
 #include "GameTransformMgr.h"
+#include "../BlammoEngine/FrameProfiler.h"
 
 struct BallCollisionChangeInfo {
 public:
@@ -85,7 +86,7 @@ GameState(gm), timeSinceGhost(DBL_MAX) {
 BallInPlayState::~BallInPlayState() {
     assert(this->gameModel->boostModel != NULL);
     // Clean up the boost model - it's only allowed to exist while the ball is in play
-    delete this->gameModel->boostModel;
+    GameEventManager::Instance()->DeleteAfterDispatch(this->gameModel->boostModel);
     this->gameModel->boostModel = NULL;
 }
 
@@ -250,6 +251,7 @@ void BallInPlayState::BallBoostReleasedForBall(const GameBall& ball) {
  * - ... TBA
  */
 void BallInPlayState::Tick(double seconds) {
+	PROFILE_SCOPE("BallInPlayState::Tick");
 	if (this->timeSinceGhost < GameModelConstants::GetInstance()->LENGTH_OF_GHOSTMODE) {
 		this->timeSinceGhost += seconds;
 	}	
@@ -282,7 +284,6 @@ void BallInPlayState::Tick(double seconds) {
 	bool didCollideWithPaddle = false;
 	bool didCollideWithBlock = false;
 	bool didCollideWithTeslaLightning = false;
-    std::vector<LevelPiece*> collisionPieces(12, NULL);
 	
     // The last ball to hit the paddle is the one with priority for item effects
 	GameBall* ballToMoveToFront = NULL;
@@ -353,7 +354,7 @@ void BallInPlayState::Tick(double seconds) {
                     this->gameModel->RemoveActiveGameItemsForThisBallOnly(currBall);
 
 		            iter = gameBalls.erase(iter);
-		            delete currBall;
+		            GameEventManager::Instance()->DeleteAfterDispatch(currBall);
 		            currBall = NULL;
                     continue;
 			    }
@@ -508,15 +509,14 @@ void BallInPlayState::Tick(double seconds) {
 
 			    // Check for ball collision with level pieces
 			    // Get the small set of level pieces based on the position of the ball...
-			    collisionPieces.clear();
                 currLevel->GetLevelPieceCollisionCandidates(seconds, currBall->GetBounds().Center(),
-                    currBall->GetBounds().Radius(), currBall->GetSpeed(), collisionPieces);
+                    currBall->GetBounds().Radius(), currBall->GetSpeed(), this->collisionCandidates);
 
                 // Start by finding the best candidate out of the possible collisions...
                 LevelPiece* bestPiece = NULL;
                 bestTimeUntilCollision = std::numeric_limits<double>::max();
-                for (std::vector<LevelPiece*>::iterator pieceIter = collisionPieces.begin(); 
-                    pieceIter != collisionPieces.end(); ++pieceIter) {
+                for (LevelPieceCandidateBuffer::const_iterator pieceIter = this->collisionCandidates.begin(); 
+                    pieceIter != this->collisionCandidates.end(); ++pieceIter) {
 
                     LevelPiece *currPiece = *pieceIter;
                     didCollideWithBlock = currPiece->CollisionCheck(*currBall, seconds,
@@ -870,10 +870,18 @@ void BallInPlayState::DoItemCollision() {
 
 	std::list<GameItemTimer*>& activeTimers = this->gameModel->GetActiveTimers();
 	std::list<GameItem*>& currLiveItems     = this->gameModel->GetLiveItems();
+    if (currLiveItems.empty()) {
+        return;
+    }
+
+    // There's only ever one paddle, so the item AABB test against it is already as cheap as a
+    // broad phase test would be - just make sure the paddle's AABB is only built once
+    const Collision::AABB2D paddleAABB = GameItem::BuildPaddleCollisionAABB(*paddle);
+
 	for (std::list<GameItem*>::iterator iter = currLiveItems.begin(); iter != currLiveItems.end();) {
 		GameItem *currItem = *iter;
 		
-		if (currItem->CollisionCheck(*paddle)) {
+		if (currItem->CollisionCheck(paddleAABB)) {
 
 			// EVENT: Item was obtained by the player paddle
 			GameEventManager::Instance()->ActionItemPaddleCollision(*currItem, *paddle);
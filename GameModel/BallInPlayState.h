@@ -36,6 +36,7 @@
 #include "../BlammoEngine/Vector.h"
 
 #include "GameState.h"
+#include "LevelPieceCandidateBuffer.h"
 
 class GameBall;
 class Vector2D;
@@ -73,6 +74,7 @@ public:
 
 private:
 	double timeSinceGhost;		// The time since the ball stopped colliding with blocks
+    LevelPieceCandidateBuffer collisionCandidates; // Reused every tick for looking up the level pieces near each ball
 
 	void DoBallCollision(GameBall& b, const Vector2D& n, double dT, double timeUntilCollision, 
         float minAngleInDegs, float& ballNewtonsThirdLawImpulse, const Vector2D& lineVelocity = Vector2D(0,0));
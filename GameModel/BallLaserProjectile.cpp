@@ -31,6 +31,8 @@
 
 #include "BallLaserProjectile.h"
 
+DEFINE_POOLED_ALLOCATION(BallLaserProjectile, 64)
+
 BallLaserProjectile::BallLaserProjectile(const Point2D& spawnLoc) :
 LaserBulletProjectile(spawnLoc, 1, 1, 6.0f, Vector2D(0, 1)) {
 }
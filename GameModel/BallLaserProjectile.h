@@ -36,6 +36,8 @@
 
 class BallLaserProjectile : public LaserBulletProjectile {
 public:
+    DECLARE_POOLED_ALLOCATION();
+
     BallLaserProjectile(const Point2D& spawnLoc);
     BallLaserProjectile(const BallLaserProjectile& copy);
     ~BallLaserProjectile();
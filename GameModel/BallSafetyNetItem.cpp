@@ -33,6 +33,8 @@
 #include "GameLevel.h"
 #include "GameEventManager.h"
 
+DEFINE_POOLED_ALLOCATION(BallSafetyNetItem, 4)
+
 const char* BallSafetyNetItem::BALL_SAFETY_NET_ITEM_NAME	  = "BallSafetyNet";
 const double BallSafetyNetItem::BALL_SAFETY_NET_TIMER_IN_SECS = 0.0;
 
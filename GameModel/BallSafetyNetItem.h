@@ -42,6 +42,8 @@
 class BallSafetyNetItem : public GameItem {
 
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* BALL_SAFETY_NET_ITEM_NAME;
 	static const double BALL_SAFETY_NET_TIMER_IN_SECS;
 
@@ -33,6 +33,8 @@
 #include "GameModel.h"
 #include "GameBall.h"
 
+DEFINE_POOLED_ALLOCATION(BallSizeItem, 4)
+
 const double BallSizeItem::BALL_SIZE_TIMER_IN_SECS	= 0.0;
 
 const char* BallSizeItem::BALL_GROW_ITEM_NAME		= "BallGrow";
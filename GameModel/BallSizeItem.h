@@ -41,6 +41,8 @@ class Point2D;
 
 class BallSizeItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	enum BallSizeChangeType { ShrinkBall, GrowBall };
 
 	static const char* BALL_GROW_ITEM_NAME;
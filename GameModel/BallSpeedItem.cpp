@@ -34,6 +34,8 @@
 #include "GameModel.h"
 #include "GameItemTimer.h"
 
+DEFINE_POOLED_ALLOCATION(BallSpeedItem, 4)
+
 const double BallSpeedItem::BALL_SPEED_TIMER_IN_SECS	= 20.0;
 const char* BallSpeedItem::SLOW_BALL_ITEM_NAME        = "SlowBall";
 const char* BallSpeedItem::FAST_BALL_ITEM_NAME        = "FastBall";
@@ -94,7 +96,7 @@ double BallSpeedItem::Activate() {
 	for (unsigned int i = 0; i < removeTimers.size(); i++) {
 		GameItemTimer* currTimer = removeTimers[i];
 		activeTimers.remove(currTimer);
-		delete currTimer;
+		GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 		currTimer = NULL;
 	}
 
@@ -42,6 +42,8 @@
  */
 class BallSpeedItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	enum BallSpeedType { FastBall, SlowBall };
 
 	static const double BALL_SPEED_TIMER_IN_SECS;
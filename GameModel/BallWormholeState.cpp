@@ -63,7 +63,7 @@ BallWormholeState::~BallWormholeState() {
 
 	// Clean up the wormhole ball
 	assert(this->wormholeBall != NULL);
-	delete this->wormholeBall;
+	GameEventManager::Instance()->DeleteAfterDispatch(this->wormholeBall);
 	this->wormholeBall = NULL;
 }
 
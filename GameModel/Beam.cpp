@@ -42,6 +42,9 @@
 const double Beam::MIN_ALLOWED_LIFETIME_IN_SECS = 0.75;
 const float Beam::MIN_BEAM_RADIUS = 0.05f;
 const int   Beam::MIN_DMG_PER_SEC = 25;
+const size_t Beam::MAX_POOLED_SEGMENTS = 32;
+
+const float BeamSegment::CAST_REUSE_EPSILON = 1e-4f;
 
 Beam::Beam(int dmgPerSec, double lifeTimeInSec) : 
 baseDamagePerSecond(dmgPerSec), currTimeElapsed(0.0), totalLifeTime(lifeTimeInSec), 
@@ -51,6 +54,27 @@ beamAlpha(1), zOffset(0), beamAlphaDirty(true) {
 
 Beam::~Beam() {
 	this->CleanUpBeam(this->beamParts);
+
+    for (std::vector<BeamSegment*>::iterator iter = this->segmentPool.begin(); iter != this->segmentPool.end(); ++iter) {
+        delete *iter;
+    }
+    this->segmentPool.clear();
+}
+
+/**
+ * Get a beam segment for this beam set up with the given values, segments that were released
+ * by this beam are reused before any new ones are made. The beam owns the returned segment.
+ */
+BeamSegment* Beam::AcquireBeamSegment(const Collision::Ray2D& beamRay, float beamRadius, 
+                                      int beamDmgPerSec, const void* ignoreThing) {
+    if (this->segmentPool.empty()) {
+        return new BeamSegment(beamRay, beamRadius, beamDmgPerSec, ignoreThing);
+    }
+
+    BeamSegment* seg = this->segmentPool.back();
+    this->segmentPool.pop_back();
+    seg->Reset(beamRay, beamRadius, beamDmgPerSec, ignoreThing);
+    return seg;
 }
 
 // Deletes any beam segments currently associated with this beam
@@ -63,6 +87,19 @@ void Beam::CleanUpBeam(std::list<BeamSegment*>& beamSegs) {
 	beamSegs.clear();
 }
 
+// Hands the given beam segments back to this beam for reuse by AcquireBeamSegment
+void Beam::ReleaseBeamSegments(std::list<BeamSegment*>& beamSegs) {
+	for (std::list<BeamSegment*>::iterator iter = beamSegs.begin(); iter != beamSegs.end(); ++iter) {
+        if (this->segmentPool.size() < MAX_POOLED_SEGMENTS) {
+            this->segmentPool.push_back(*iter);
+        }
+        else {
+            delete *iter;
+        }
+	}
+	beamSegs.clear();
+}
+
 /**
  * Check to see if the given lists of beam segments are different...
  * Returns: true if they are different, false otherwise.
@@ -97,9 +134,10 @@ void Beam::BuildAndUpdateCollisionsForBeamParts(const std::list<BeamSegment*>& i
     std::list<BeamSegment*> newBeamSegs;
     newBeamSegs.insert(newBeamSegs.begin(), initialBeamSegs.begin(), initialBeamSegs.end());
 
-    // Keep a copy of the old beam segments (for comparison afterwards)
-    std::list<BeamSegment*> oldBeamSegments = this->beamParts;
-    this->beamParts.clear();
+    // Keep the old beam segments (for comparison afterwards)
+    std::list<BeamSegment*> oldBeamSegments;
+    oldBeamSegments.swap(this->beamParts);
+    std::list<BeamSegment*>::const_iterator oldSegIter = oldBeamSegments.begin();
 
     // Keep track of the pieces collided with to watch out for bad loops (e.g., infinite loops of beams through prisms)
     std::set<const void*> thingsCollidedWith;
@@ -116,9 +154,16 @@ void Beam::BuildAndUpdateCollisionsForBeamParts(const std::list<BeamSegment*>& i
         // Also, if the beam has faded-out past a certain point then paddle collisions no longer happen
         bool cannotCollideWithPaddle = (this->GetType() == Beam::PaddleBeam && this->beamParts.size() < initialBeamSegs.size() || this->beamAlpha < 0.33f);
 
+        // The segment in the same place of the old beam may have already cast the current segment's ray through
+        // the level pieces - when the level hasn't changed since then the cast doesn't need to be done again
+        const BeamSegment* previousSeg = NULL;
+        if (oldSegIter != oldBeamSegments.end()) {
+            previousSeg = *oldSegIter;
+            ++oldSegIter;
+        }
+
         // Fire the current beam segment into the level in order to figure out what piece it hit
-        
-        BeamColliderStrategy* collisionStrategy = currBeamSegment->FireBeamSegmentIntoLevel(*gameModel, cannotCollideWithPaddle);
+        BeamColliderStrategy* collisionStrategy = currBeamSegment->FireBeamSegmentIntoLevel(*gameModel, cannotCollideWithPaddle, previousSeg);
         if (collisionStrategy != NULL) {
             
             // The beam collided with something:
@@ -151,11 +196,17 @@ void Beam::BuildAndUpdateCollisionsForBeamParts(const std::list<BeamSegment*>& i
         GameEventManager::Instance()->ActionBeamChanged(*this);
 
         // Clean up the old beam
-        this->CleanUpBeam(oldBeamSegments);
+        this->ReleaseBeamSegments(oldBeamSegments);
     }
     else {
-        this->CleanUpBeam(this->beamParts);
-        this->beamParts = oldBeamSegments;
+        // Keep the old segments (so their animations carry on) but hold onto the newest level casts
+        std::list<BeamSegment*>::iterator newIter = this->beamParts.begin();
+        for (std::list<BeamSegment*>::iterator iter = oldBeamSegments.begin(); iter != oldBeamSegments.end(); ++iter, ++newIter) {
+            (*iter)->CopyLevelCast(**newIter);
+        }
+
+        this->ReleaseBeamSegments(this->beamParts);
+        this->beamParts.swap(oldBeamSegments);
     }
 
     this->beamAlphaDirty = false;
@@ -245,10 +296,40 @@ void Beam::UpdateOriginBeamSegment(const GameModel* gameModel, const Collision::
 BeamSegment::BeamSegment(const Collision::Ray2D& beamRay, float beamRadius, 
                          int beamDmgPerSec, const void* ignoreThing) :
 timeSinceFired(0.0), ray(beamRay), collidingPiece(NULL), collidingProjectile(NULL), endT(0.0f),
-ignoreThing(ignoreThing), damagePerSecond(beamDmgPerSec), initialRadius(beamRadius) {
+ignoreThing(ignoreThing), damagePerSecond(beamDmgPerSec), initialRadius(beamRadius),
+castLevel(NULL), castLevelChangeCount(0), castPiece(NULL), castRayT(0.0f) {
 
 	this->SetRadius(beamRadius);
 }
+
+// Sets this segment up as if it had just been constructed with the given values
+void BeamSegment::Reset(const Collision::Ray2D& beamRay, float beamRadius, int beamDmgPerSec, const void* ignoreThing) {
+    this->timeSinceFired      = 0.0;
+    this->ray                 = beamRay;
+    this->collidingPiece      = NULL;
+    this->collidingProjectile = NULL;
+    this->endT                = 0.0f;
+    this->ignoreThing         = ignoreThing;
+    this->damagePerSecond     = beamDmgPerSec;
+    this->initialRadius       = beamRadius;
+    this->castLevel           = NULL;
+    this->castPiece           = NULL;
+
+    this->SetRadius(beamRadius);
+}
+
+// A copy of this segment as it is right now (without any cached level cast), used where the
+// segment has to outlive the beam's next update (e.g., recorded events), the caller owns the copy
+BeamSegment* BeamSegment::Clone() const {
+    BeamSegment* copy = new BeamSegment(this->ray, this->initialRadius, this->damagePerSecond, this->ignoreThing);
+    copy->timeSinceFired      = this->timeSinceFired;
+    copy->collidingPiece      = this->collidingPiece;
+    copy->collidingProjectile = this->collidingProjectile;
+    copy->endT                = this->endT;
+    copy->SetRadius(this->radius);
+    return copy;
+}
+
 void BeamSegment::SetRadius(float radius) {
 	this->radius = radius;  
 
@@ -284,16 +365,13 @@ void BeamSegment::Tick(double dT) {
 	this->radiusPulseAnim.Tick(dT);
 }
 
-bool SmallestToLargestRayTStratSorter(const std::pair<float, BeamColliderStrategy*>& a, const std::pair<float, BeamColliderStrategy*>& b) {
-    return (a.first < b.first);
-}
-
 /**
  * Fire this beam segment into the given level.
  * Returns: The level piece that this beam segment collided with when shot - NULL if no collisions.
  */
 BeamColliderStrategy* BeamSegment::FireBeamSegmentIntoLevel(const GameModel& gameModel, 
-                                                            bool cannotCollideWithPaddle) {
+                                                            bool cannotCollideWithPaddle,
+                                                            const BeamSegment* previousSeg) {
 
 	const GameLevel* level = gameModel.GetCurrentLevel();
     assert(level != NULL);
@@ -303,14 +381,27 @@ BeamColliderStrategy* BeamSegment::FireBeamSegmentIntoLevel(const GameModel& gam
 	std::set<const void*> ignoreThings;
 	ignoreThings.insert(this->ignoreThing);
 
-    std::vector<std::pair<float, BeamColliderStrategy*> > strategies;
-    strategies.reserve(3);
+    // Keep track of the closest thing hit, only the strategy for it gets made
+    float closestT = std::numeric_limits<float>::max();
+    LevelPiece* closestPiece = NULL;
+    PlayerPaddle* closestPaddle = NULL;
+    Projectile* closestProjectile = NULL;
 
-    // Check for colliding pieces...
+    // Check for colliding pieces, reusing the previous segment's cast through the level if it's still good...
     float tempT = std::numeric_limits<float>::max();
-    this->collidingPiece = level->GetLevelPieceFirstCollider(this->ray, ignoreThings, tempT);
-    if (this->collidingPiece != NULL) {
-        strategies.push_back(std::make_pair(std::max<float>(0,tempT), new LevelPieceBeamColliderStrategy(tempT, this->collidingPiece)));
+    if (previousSeg != NULL && this->CanReuseLevelCastOf(*previousSeg, *level)) {
+        this->CopyLevelCast(*previousSeg);
+    }
+    else {
+        this->castPiece = level->GetLevelPieceFirstCollider(this->ray, ignoreThings, tempT);
+        this->castRayT  = tempT;
+        this->castRay   = this->ray;
+        this->castLevel = level;
+        this->castLevelChangeCount = level->GetPieceChangeCount();
+    }
+    if (this->castPiece != NULL) {
+        closestT = std::max<float>(0, this->castRayT);
+        closestPiece = this->castPiece;
     }
 
     // Check for colliding paddle...
@@ -334,37 +425,66 @@ BeamColliderStrategy* BeamSegment::FireBeamSegmentIntoLevel(const GameModel& gam
         isCollision |= playerPaddle->CollisionCheck(beamSegRayOuter2, tempT);
         minRayT = std::min<float>(minRayT, tempT);
         
-        if (isCollision) {
-            strategies.push_back(std::make_pair(std::max<float>(0,minRayT), new PaddleBeamColliderStrategy(maxRayT, playerPaddle)));
+        if (isCollision && std::max<float>(0, minRayT) < closestT) {
+            closestT = std::max<float>(0, minRayT);
+            closestPiece  = NULL;
+            closestPaddle = playerPaddle;
         }
     }
     
-    // Check for colliding projectiles...
+    // Check for colliding projectiles (these move, so they're always checked)...
     tempT = std::numeric_limits<float>::max();
-    this->collidingProjectile = gameModel.GetFirstBeamProjectileCollider(this->ray, ignoreThings, tempT);
-    if (this->collidingProjectile != NULL) {
-        strategies.push_back(std::make_pair(std::max<float>(0,tempT), new ProjectileBeamColliderStrategy(tempT, this->collidingProjectile)));
+    Projectile* projectile = gameModel.GetFirstBeamProjectileCollider(this->ray, ignoreThings, tempT);
+    if (projectile != NULL && std::max<float>(0, tempT) < closestT) {
+        closestT = std::max<float>(0, tempT);
+        closestPiece  = NULL;
+        closestPaddle = NULL;
+        closestProjectile = projectile;
     }
 
-    if (strategies.empty()) {
-        this->endT = maxRayT;
-        return NULL;
+    this->collidingPiece = closestPiece;
+    this->collidingProjectile = closestProjectile;
+
+    if (closestPiece != NULL) {
+        this->endT = closestT;
+        return new LevelPieceBeamColliderStrategy(this->castRayT, closestPiece);
+    }
+    if (closestPaddle != NULL) {
+        this->endT = closestT;
+        return new PaddleBeamColliderStrategy(maxRayT, closestPaddle);
+    }
+    if (closestProjectile != NULL) {
+        this->endT = closestT;
+        return new ProjectileBeamColliderStrategy(tempT, closestProjectile);
     }
 
-    std::sort(strategies.begin(), strategies.end(), SmallestToLargestRayTStratSorter);
+    this->endT = maxRayT;
+    return NULL;
+}
 
-    // Delete all the failures...
-    for (int i = 1; i < static_cast<int>(strategies.size()); i++) {
-        delete strategies[i].second;
+/**
+ * Whether the given segment's last cast through the level pieces can stand in for one of this segment's,
+ * i.e., it was cast along (within a small epsilon) the same ray, ignoring the same thing, in the level as it is now.
+ */
+bool BeamSegment::CanReuseLevelCastOf(const BeamSegment& previousSeg, const GameLevel& level) const {
+    if (previousSeg.castLevel != &level || previousSeg.castLevelChangeCount != level.GetPieceChangeCount()) {
+        return false;
+    }
+    if (previousSeg.ignoreThing != this->ignoreThing) {
+        return false;
     }
 
-    BeamColliderStrategy* strategy = strategies.front().second;
-    assert(strategy != NULL);
-    this->endT = strategies.front().first;
-    this->collidingPiece = strategy->GetCollidingPiece();
-    this->collidingProjectile = strategy->GetCollidingProjectile();
+    const Collision::Ray2D& prevRay = previousSeg.castRay;
+    return Point2D::SqDistance(prevRay.GetOrigin(), this->ray.GetOrigin()) <= CAST_REUSE_EPSILON * CAST_REUSE_EPSILON &&
+        (prevRay.GetUnitDirection() - this->ray.GetUnitDirection()).SqrMagnitude() <= CAST_REUSE_EPSILON * CAST_REUSE_EPSILON;
+}
 
-    return strategy;
+void BeamSegment::CopyLevelCast(const BeamSegment& beamSeg) {
+    this->castLevel = beamSeg.castLevel;
+    this->castLevelChangeCount = beamSeg.castLevelChangeCount;
+    this->castRay   = beamSeg.castRay;
+    this->castPiece = beamSeg.castPiece;
+    this->castRayT  = beamSeg.castRayT;
 }
 
 /**
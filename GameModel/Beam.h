@@ -51,7 +51,11 @@ public:
 	BeamSegment(const Collision::Ray2D& beamRay, float beamRadius, int beamDmgPerSec, const void* ignoreThing);
 	~BeamSegment();
 
-	BeamColliderStrategy* FireBeamSegmentIntoLevel(const GameModel& gameModel, bool cannotCollideWithPaddle);
+	void Reset(const Collision::Ray2D& beamRay, float beamRadius, int beamDmgPerSec, const void* ignoreThing);
+    BeamSegment* Clone() const;
+
+	BeamColliderStrategy* FireBeamSegmentIntoLevel(const GameModel& gameModel, bool cannotCollideWithPaddle, 
+        const BeamSegment* previousSeg);
 	const Collision::Ray2D& GetBeamSegmentRay() const { return this->ray; }
     void SetBeamSegmentRay(const Collision::Ray2D& r) { this->ray = r; }
 	
@@ -63,6 +67,7 @@ public:
 	
 	float GetRadius() const { return this->radius; }
 	void SetRadius(float radius);
+    float GetInitialRadius() const { return this->initialRadius; }
 
 	float GetLength() const { 
 		assert(this->endT >= 0);
@@ -80,8 +85,11 @@ public:
     float GetCurrentRadiusFraction() const { return this->initialRadius == 0 ? 0.0f : (this->radius / this->initialRadius); }
 
 	static bool Equals(const BeamSegment& beamSeg1, const BeamSegment& beamSeg2);
+    void CopyLevelCast(const BeamSegment& beamSeg);
 
 private:
+    static const float CAST_REUSE_EPSILON;
+
 	const void* ignoreThing;    // If a beam is originating inside a particular object then we want it to ignore all collisions with that object...
 
     Projectile* collidingProjectile;
@@ -94,12 +102,22 @@ private:
 
 	double timeSinceFired;	// Time in seconds since this part of the beam was fired/shot
 	Collision::Ray2D ray;   // The ray defining this part of the beam
-	const float initialRadius;    // Initial half-width of the beam segment
+	float initialRadius;    // Initial half-width of the beam segment
     float radius;           // Half-width of the beam segment
 	float endT;             // The value that when fed into the ray equation will give where this beam segment ends
 
+    // The result of the last time this segment's ray was cast through the level pieces, it stays good
+    // for as long as the level's piece change count doesn't move (see GameLevel::GetPieceChangeCount)
+    const GameLevel* castLevel;         // The level the cast was made in, NULL if there is no cached cast
+    unsigned int castLevelChangeCount;  // The level's piece change count at the time of the cast
+    Collision::Ray2D castRay;           // The ray that was cast
+    LevelPiece* castPiece;              // The first piece hit by the cast, NULL if it left the level
+    float castRayT;                     // Where along the ray the cast hit castPiece
+
 	AnimationMultiLerp<float> radiusPulseAnim;
 
+    bool CanReuseLevelCastOf(const BeamSegment& previousSeg, const GameLevel& level) const;
+
     DISALLOW_COPY_AND_ASSIGN(BeamSegment);
 };
 
@@ -112,6 +130,10 @@ public:
 
 	virtual ~Beam();
     virtual Beam::BeamType GetType() const = 0;
+
+    // Undoes anything firing the beam did to the rest of the model, done when the beam is destroyed
+    // or earlier when its deletion is put off (see GameEventManager::DeleteAfterDispatch)
+    virtual void PrepareForDeletion() {}
     virtual bool CanDestroyLevelPieces() const = 0;
 
 	virtual void UpdateCollisions(const GameModel* gameModel) = 0;
@@ -123,6 +145,8 @@ public:
 
     float GetBeamAlpha() const { return this->beamAlpha; }
 
+    BeamSegment* AcquireBeamSegment(const Collision::Ray2D& beamRay, float beamRadius, int beamDmgPerSec, const void* ignoreThing);
+
 	void ResetTimeElapsed();
 
 	std::list<BeamSegment*>& GetBeamParts() { return this->beamParts; }
@@ -144,8 +168,10 @@ public:
 
 protected:
     static const double MIN_ALLOWED_LIFETIME_IN_SECS;
+    static const size_t MAX_POOLED_SEGMENTS;
 
 	std::list<BeamSegment*> beamParts;  // The beam's parts that make up this entire beam
+    std::vector<BeamSegment*> segmentPool; // Segments no longer in use, handed back out by AcquireBeamSegment
 	int baseDamagePerSecond;            // Amount of damage the beam does per second to damagable blocks it hits
                                         // NOTE: typical life of a block is 100
 
@@ -157,6 +183,7 @@ protected:
     float zOffset;
 
 	void CleanUpBeam(std::list<BeamSegment*>& beamSegs);
+    void ReleaseBeamSegments(std::list<BeamSegment*>& beamSegs);
 	bool BeamHasChanged(const std::list<BeamSegment*>& oldBeamSegs, const std::list<BeamSegment*>& newBeamSegs);
     void BuildAndUpdateCollisionsForBeamParts(const std::list<BeamSegment*>& initialBeamSegs, const GameModel* gameModel);
 
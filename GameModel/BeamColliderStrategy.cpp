@@ -35,7 +35,7 @@
 #include "PortalBlock.h"
 #include "PortalProjectile.h"
 
-void LevelPieceBeamColliderStrategy::UpdateBeam(const Beam& beam, BeamSegment* currBeamSegment, 
+void LevelPieceBeamColliderStrategy::UpdateBeam(Beam& beam, BeamSegment* currBeamSegment, 
                                                 std::set<const void*>& thingsCollidedWith, 
                                                 std::list<BeamSegment*>& newBeamSegs) {
 
@@ -75,13 +75,13 @@ void LevelPieceBeamColliderStrategy::UpdateBeam(const Beam& beam, BeamSegment* c
             // Now add the new beams to the list of beams we need to fire into the level and repeat this whole process with
             std::list<BeamSegment*> spawnedBeamSegs;
             for (std::list<Collision::Ray2D>::iterator iter = spawnedRays.begin(); iter != spawnedRays.end(); ++iter) {
-                newBeamSegs.push_back(new BeamSegment(*iter, NEW_BEAM_SEGMENT_RADIUS, NEW_BEAM_DMG_PER_SECOND, ignorePiece));
+                newBeamSegs.push_back(beam.AcquireBeamSegment(*iter, NEW_BEAM_SEGMENT_RADIUS, NEW_BEAM_DMG_PER_SECOND, ignorePiece));
             }
         }
     }
 }
 
-void PaddleBeamColliderStrategy::UpdateBeam(const Beam& beam, BeamSegment* currBeamSegment, 
+void PaddleBeamColliderStrategy::UpdateBeam(Beam& beam, BeamSegment* currBeamSegment, 
                                             std::set<const void*>& thingsCollidedWith, std::list<BeamSegment*>& newBeamSegs) {
     UNUSED_PARAMETER(newBeamSegs);
 
@@ -101,7 +101,7 @@ void PaddleBeamColliderStrategy::UpdateBeam(const Beam& beam, BeamSegment* currB
     // No need to spawn any new beams.
 }
 
-void ProjectileBeamColliderStrategy::UpdateBeam(const Beam& beam, BeamSegment* currBeamSegment, 
+void ProjectileBeamColliderStrategy::UpdateBeam(Beam& beam, BeamSegment* currBeamSegment, 
                                                 std::set<const void*>& thingsCollidedWith, 
                                                 std::list<BeamSegment*>& newBeamSegs) {
 
@@ -141,7 +141,7 @@ void ProjectileBeamColliderStrategy::UpdateBeam(const Beam& beam, BeamSegment* c
             // Now add the new beams to the list of beams we need to fire into the level and repeat this whole process with
             std::list<BeamSegment*> spawnedBeamSegs;
             for (std::list<Collision::Ray2D>::iterator iter = spawnedRays.begin(); iter != spawnedRays.end(); ++iter) {
-                newBeamSegs.push_back(new BeamSegment(*iter, NEW_BEAM_SEGMENT_RADIUS, NEW_BEAM_DMG_PER_SECOND, ignoreProjectile));
+                newBeamSegs.push_back(beam.AcquireBeamSegment(*iter, NEW_BEAM_SEGMENT_RADIUS, NEW_BEAM_DMG_PER_SECOND, ignoreProjectile));
             }
         }
     }
@@ -47,7 +47,7 @@ public:
 
     float GetRayT() const { return this->rayT; }
 
-    virtual void UpdateBeam(const Beam& beam, BeamSegment* currBeamSegment, 
+    virtual void UpdateBeam(Beam& beam, BeamSegment* currBeamSegment, 
         std::set<const void*>& thingsCollidedWith, std::list<BeamSegment*>& newBeamSegs) = 0;
 
     virtual LevelPiece* GetCollidingPiece() const { return NULL; }
@@ -67,7 +67,7 @@ public:
     LevelPieceBeamColliderStrategy(float rayT, LevelPiece* collider) : BeamColliderStrategy(rayT), colliderPiece(collider) {}
     ~LevelPieceBeamColliderStrategy() {}
 
-    void UpdateBeam(const Beam& beam, BeamSegment* currBeamSegment, 
+    void UpdateBeam(Beam& beam, BeamSegment* currBeamSegment, 
         std::set<const void*>& thingsCollidedWith, std::list<BeamSegment*>& newBeamSegs);
     LevelPiece* GetCollidingPiece() const { return this->colliderPiece; }
 
@@ -82,7 +82,7 @@ public:
     PaddleBeamColliderStrategy(float rayT, PlayerPaddle* collider) : BeamColliderStrategy(rayT), colliderPaddle(collider) {}
     ~PaddleBeamColliderStrategy() {}
 
-    void UpdateBeam(const Beam& beam, BeamSegment* currBeamSegment, 
+    void UpdateBeam(Beam& beam, BeamSegment* currBeamSegment, 
         std::set<const void*>& thingsCollidedWith, std::list<BeamSegment*>& newBeamSegs);
 private:
     PlayerPaddle* colliderPaddle;
@@ -95,7 +95,7 @@ public:
     ProjectileBeamColliderStrategy(float rayT, Projectile* collider) : BeamColliderStrategy(rayT), colliderProjectile(collider) {}
     ~ProjectileBeamColliderStrategy() {}
 
-    void UpdateBeam(const Beam& beam, BeamSegment* currBeamSegment, 
+    void UpdateBeam(Beam& beam, BeamSegment* currBeamSegment, 
         std::set<const void*>& thingsCollidedWith, std::list<BeamSegment*>& newBeamSegs);
 
     Projectile* GetCollidingProjectile() const { return this->colliderProjectile; }
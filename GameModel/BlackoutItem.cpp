@@ -31,6 +31,8 @@
 
 #include "BlackoutItem.h"
 
+DEFINE_POOLED_ALLOCATION(BlackoutItem, 4)
+
 const char* BlackoutItem::BLACKOUT_ITEM_NAME	      = "Blackout";
 const double BlackoutItem::BLACKOUT_TIMER_IN_SECS		= 20.0;
 
@@ -58,7 +60,7 @@ double BlackoutItem::Activate() {
 	for (unsigned int i = 0; i < removeTimers.size(); i++) {
 			GameItemTimer* currTimer = removeTimers[i];
 			activeTimers.remove(currTimer);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 	}
 
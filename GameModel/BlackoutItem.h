@@ -41,6 +41,8 @@
  */
 class BlackoutItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* BLACKOUT_ITEM_NAME;
 	static const double BLACKOUT_TIMER_IN_SECS;
 
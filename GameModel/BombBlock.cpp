@@ -153,7 +153,7 @@ LevelPiece* BombBlock::Destroy(GameModel* gameModel, const LevelPiece::Destructi
                 new EmptySpaceBlock(currDestroyedBomb->GetWidthIndex(), currDestroyedBomb->GetHeightIndex()),
                 LevelPiece::BombDestruction);
 
-			delete currDestroyedBomb;
+			GameEventManager::Instance()->DeleteAfterDispatch(currDestroyedBomb);
 			currDestroyedBomb = NULL;
 		}
 
@@ -171,7 +171,7 @@ LevelPiece* BombBlock::Destroy(GameModel* gameModel, const LevelPiece::Destructi
 	LevelPiece* emptyPieceForBomb = new EmptySpaceBlock(this->wIndex, this->hIndex);
 	level->PieceChanged(gameModel, this, emptyPieceForBomb, method);
 	LevelPiece* tempThis = this;
-	delete tempThis;
+	GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
 	tempThis = NULL;
     
 	return emptyPieceForBomb;
@@ -76,6 +76,13 @@ Boss::~Boss() {
     }
 }
 
+void Boss::PrepareForDeletion() {
+    for (std::vector<AbstractBossBodyPart*>::iterator iter = this->bodyParts.begin();
+         iter != this->bodyParts.end(); ++iter) {
+        (*iter)->PrepareForDeletion();
+    }
+}
+
 /**
  * Static factory function for building boss types based on a given world style.
  */
@@ -553,7 +560,7 @@ void Boss::ConvertAliveBodyPartToWeakpoint(size_t index, float lifePoints, float
         compositeParentPart->AddBodyPart(weakpointBodyPart);
     }
 
-    delete bodyPart;
+    GameEventManager::Instance()->DeleteAfterDispatch(bodyPart);
     bodyPart = NULL;
 
     this->bodyParts[index] = weakpointBodyPart;
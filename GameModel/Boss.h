@@ -54,6 +54,10 @@ public:
     static const double TOTAL_DEATH_ANIM_TIME;
 
     virtual ~Boss();
+
+    // Lets go of anything attached to the boss' body parts, done when they are destroyed or earlier
+    // when the boss' deletion is put off (see GameEventManager::DeleteAfterDispatch)
+    void PrepareForDeletion();
     
     static Boss* BuildStyleBoss(GameModel* gameModel, const GameWorld::WorldStyle& style);
     virtual void Init(float startingX, float startingY, const std::vector<std::vector<LevelPiece*> >& levelPieces) = 0;
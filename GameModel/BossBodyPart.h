@@ -53,6 +53,7 @@ public:
     const BoundingLines& GetWorldBounds() const;
 
     virtual AbstractBossBodyPart::Type GetType() const { return AbstractBossBodyPart::BasicBodyPart; }
+    void PrepareForDeletion() { this->RemoveAllAttachedProjectiles(); }
     virtual void Tick(double dT);
 
 	BossBodyPart* CollisionCheck(const GameBall& ball, double dT, Vector2D& n,
@@ -45,6 +45,10 @@ public:
 
     virtual BossEffectEventInfo::Type GetType() const = 0;
 
+    // A copy of this effect that can outlive the event it was actioned with (e.g., for events
+    // that are recorded and dispatched later), the caller owns the copy
+    virtual BossEffectEventInfo* Clone() const = 0;
+
 private:
     DISALLOW_COPY_AND_ASSIGN(BossEffectEventInfo);
 };
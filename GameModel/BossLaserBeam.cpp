@@ -49,7 +49,7 @@ void BossLaserBeam::UpdateCollisions(const GameModel* gameModel) {
     assert(gameModel != NULL);
 
     std::list<BeamSegment*> initialBeamSegs;
-    initialBeamSegs.push_back(new BeamSegment(this->initialBeamRay, this->beamAlpha * this->initialBeamRadius, 
+    initialBeamSegs.push_back(this->AcquireBeamSegment(this->initialBeamRay, this->beamAlpha * this->initialBeamRadius, 
         this->beamAlpha * BASE_DAMAGE_PER_SECOND, NULL));
 
     this->BuildAndUpdateCollisionsForBeamParts(initialBeamSegs, gameModel);
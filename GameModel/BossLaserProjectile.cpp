@@ -31,6 +31,8 @@
 
 #include "BossLaserProjectile.h"
 
+DEFINE_POOLED_ALLOCATION(BossLaserProjectile, 64)
+
 const float BossLaserProjectile::HEIGHT_DEFAULT	= 1.2f;  // Height of a laser projectile in game units
 const float BossLaserProjectile::WIDTH_DEFAULT	= 0.5f;  // Width of a laser projectile in game units 
 const float BossLaserProjectile::SPD_DEFAULT = 13.0f;
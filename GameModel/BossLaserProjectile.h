@@ -36,6 +36,8 @@
 
 class BossLaserProjectile : public LaserBulletProjectile {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const float HEIGHT_DEFAULT;
 	static const float WIDTH_DEFAULT;
     static const float SPD_DEFAULT;
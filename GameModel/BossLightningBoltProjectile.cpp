@@ -31,6 +31,8 @@
 
 #include "BossLightningBoltProjectile.h"
 
+DEFINE_POOLED_ALLOCATION(BossLightningBoltProjectile, 16)
+
 const float BossLightningBoltProjectile::HEIGHT_DEFAULT	= 1.8f;  // Height of a bolt in game units
 const float BossLightningBoltProjectile::WIDTH_DEFAULT	= 0.9f;  // Width of a bolt in game units 
 const float BossLightningBoltProjectile::SPD_DEFAULT    = 14.0f;
@@ -31,6 +31,8 @@
 
 #include "BossOrbProjectile.h"
 
+DEFINE_POOLED_ALLOCATION(BossOrbProjectile, 64)
+
 const float BossOrbProjectile::RADIUS_DEFAULT = 0.45f;
 const float BossOrbProjectile::SPD_DEFAULT    = 13.0f;
 
@@ -39,6 +39,8 @@
  */
 class BossOrbProjectile : public OrbProjectile {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const float RADIUS_DEFAULT;
     static const float SPD_DEFAULT;
 
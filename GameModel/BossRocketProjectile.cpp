@@ -31,6 +31,8 @@
 
 #include "BossRocketProjectile.h"
 
+DEFINE_POOLED_ALLOCATION(BossRocketProjectile, 16)
+
 const float BossRocketProjectile::BOSS_ROCKET_WIDTH_DEFAULT  = 0.75f;
 const float BossRocketProjectile::BOSS_ROCKET_HEIGHT_DEFAULT = 1.4f;
 
@@ -37,6 +37,8 @@
 
 class BossRocketProjectile : public RocketProjectile {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const float BOSS_ROCKET_HEIGHT_DEFAULT;
 	static const float BOSS_ROCKET_WIDTH_DEFAULT;
 
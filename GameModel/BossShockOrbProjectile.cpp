@@ -31,6 +31,8 @@
 
 #include "BossShockOrbProjectile.h"
 
+DEFINE_POOLED_ALLOCATION(BossShockOrbProjectile, 16)
+
 const float BossShockOrbProjectile::RADIUS_DEFAULT = 1.0f;
 const float BossShockOrbProjectile::SPD_DEFAULT    = 10.0f;
 
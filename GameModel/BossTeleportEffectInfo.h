@@ -43,6 +43,9 @@ public:
     ~BossTeleportEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::TeleportInfo; }
+    BossEffectEventInfo* Clone() const {
+        return new BossTeleportEffectInfo(this->teleportType, this->position, this->timeInSecs, this->size);
+    }
     
     TeleportType GetTeleportType() const { return this->teleportType; }
     const Point2D& GetPosition() const { return this->position; }
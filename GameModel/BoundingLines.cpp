@@ -32,6 +32,8 @@
 #include "BoundingLines.h"
 #include "LevelPiece.h"
 
+#include "../BlammoEngine/BatchMath.h"
+
 const float BoundingLines::BALL_INSIDE_OUTSIDE_DIST_DIVISOR = 7.0f;
 const float BoundingLines::BALL_COLLISION_SAMPLING_INV_AMT  = 0.1f;
 
@@ -39,6 +41,7 @@ BoundingLines::BoundingLines(const std::vector<Collision::LineSeg2D>& lines,
                              const std::vector<Vector2D>& norms) : lines(lines), normals(norms) {
 	assert(lines.size() == norms.size());
     this->onInside.resize(lines.size(), false);
+    this->packedLines.Set(this->lines, this->normals);
 }
 
 BoundingLines::BoundingLines(const std::vector<Collision::LineSeg2D>& lines,
@@ -47,6 +50,7 @@ BoundingLines::BoundingLines(const std::vector<Collision::LineSeg2D>& lines,
 lines(lines), normals(norms), onInside(onInside) {
     assert(lines.size() == norms.size());
     assert(lines.size() == onInside.size());
+    this->packedLines.Set(this->lines, this->normals);
 }
 
 BoundingLines::BoundingLines(int numLines, const Collision::LineSeg2D lineArray[], 
@@ -54,12 +58,14 @@ BoundingLines::BoundingLines(int numLines, const Collision::LineSeg2D lineArray[
 lines(lineArray, lineArray + numLines), 
 normals(normArray, normArray + numLines), 
 onInside(onInsideArray, onInsideArray + numLines) {
+    this->packedLines.Set(this->lines, this->normals);
 }
 
 BoundingLines::BoundingLines(int numLines, const Collision::LineSeg2D lineArray[], const Vector2D normArray[]) :
 lines(lineArray, lineArray + numLines), 
 normals(normArray, normArray + numLines), 
 onInside(numLines, false) {
+    this->packedLines.Set(this->lines, this->normals);
 }
 
 BoundingLines::BoundingLines(const Collision::AABB2D& aabb) {
@@ -83,10 +89,11 @@ BoundingLines::BoundingLines(const Collision::AABB2D& aabb) {
     this->normals.push_back(Vector2D(0, -1));
 
     this->onInside.resize(4, false);
+    this->packedLines.Set(this->lines, this->normals);
 }
 
 BoundingLines::BoundingLines(const BoundingLines& copy) :
-lines(copy.lines), normals(copy.normals), onInside(copy.onInside) {
+lines(copy.lines), normals(copy.normals), onInside(copy.onInside), packedLines(copy.packedLines) {
 }
 
 BoundingLines::~BoundingLines() {
@@ -97,12 +104,18 @@ void BoundingLines::AddBound(const Collision::LineSeg2D& line, const Vector2D& n
     this->normals.push_back(norm);
     this->normals.back().Normalize();
     this->onInside.push_back(onInside);
+    this->packedLines.Push(line, this->normals.back());
 }
 
 void BoundingLines::AddBounds(const BoundingLines& bounds) {
     this->lines.insert(this->lines.end(), bounds.lines.begin(), bounds.lines.end());
     this->normals.insert(this->normals.end(), bounds.normals.begin(), bounds.normals.end());
     this->onInside.insert(this->onInside.end(), bounds.onInside.begin(), bounds.onInside.end());
+
+    this->packedLines.Reserve(this->lines.size());
+    for (size_t i = 0; i < bounds.lines.size(); i++) {
+        this->packedLines.Push(bounds.lines[i], bounds.normals[i]);
+    }
 }
 
 void BoundingLines::RemoveBound(const Collision::LineSeg2D& line) {
@@ -111,6 +124,7 @@ void BoundingLines::RemoveBound(const Collision::LineSeg2D& line) {
             this->lines.erase(this->lines.begin()+i);
             this->normals.erase(this->normals.begin()+i);
             this->onInside.erase(this->onInside.begin()+i);
+            this->packedLines.Erase(i);
             return;
         }
     }
@@ -235,9 +249,24 @@ bool BoundingLines::Collide(double dT, const Collision::Circle2D& circle, const
     int closestLineIdx = -1;
     double minTimeUntilCollision = std::numeric_limits<double>::max();
 
+    // Every line that the moving circle can touch overlaps the box around its swept path (padded a little
+    // so that rounding can't cull a touching line), so the lines are culled against that box four at a time
+    const float cullDist = 1.01f * circle.Radius() + EPSILON;
+    Collision::AABB2D sweptCircleAABB(circleVelLine.P1());
+    sweptCircleAABB.AddPoint(circleVelLine.P2());
+    sweptCircleAABB = Collision::AABB2D(sweptCircleAABB.GetMin() - Vector2D(cullDist, cullDist),
+        sweptCircleAABB.GetMax() + Vector2D(cullDist, cullDist));
+    unsigned int cullMask = 0;
+
     // Solution for moving circle to static-line collision, found here:
     // http://ericleong.me/research/circle-line
     for (int lineIdx = 0; lineIdx < static_cast<int>(this->lines.size()); ++lineIdx) {
+        if ((lineIdx & 3) == 0) {
+            cullMask = this->packedLines.GetAABBOverlapMask(lineIdx, sweptCircleAABB);
+        }
+        if ((cullMask & (1 << (lineIdx & 3))) == 0) {
+            continue;
+        }
         
         const Collision::LineSeg2D& currBoundsLine = this->lines[lineIdx];
         
@@ -648,38 +677,15 @@ bool BoundingLines::ClosestPointAndNormal(const Point2D& pt, float toleranceRadi
  * Determine whether the given point is inside this set of bounding lines or not.
  */
 bool BoundingLines::IsInside(const Point2D& pt) const {
-	// Go through each line and do a half plane test using that line on the point
-	// based on the line's normal
-	for (size_t i = 0; i < this->lines.size(); i++) {
-		Vector2D fromLineToPt = pt - this->lines[i].P1();
-		if (fromLineToPt == Vector2D(0, 0)) {
-			fromLineToPt = pt - this->lines[i].P2();
-			assert(fromLineToPt != Vector2D(0, 0));
-		}
-
-		Vector2D normal = this->normals[i];
-		// If the dot product is negative then the point is inside...
-		float dotResult = Vector2D::Dot(fromLineToPt, normal);
-		if (dotResult >= 0.0f) {
-			return false;
-		}
-	}
-
-	return true;
+	// Do a half plane test using each line on the point based on the line's normal,
+	// if the point is behind every line then it's inside
+	return this->packedLines.IsBehindAllLines(pt);
 }
 
 
 bool BoundingLines::CollisionCheck(const Collision::Circle2D& c, float& sqrDist) const {
     const float sqrRadius = c.Radius() * c.Radius();
-    for (size_t i = 0; i < this->lines.size(); i++) {
-        Point2D closestPt = Collision::ClosestPoint(c.Center(), this->lines[i]);
-        sqrDist = Point2D::SqDistance(closestPt, c.Center());
-        if (sqrDist <= sqrRadius) {
-            return true;
-        }
-    }
-
-    return false;
+    return this->packedLines.FindFirstWithinSqrDist(c.Center(), sqrRadius, sqrDist) != -1;
 }
 
 bool BoundingLines::CollisionCheck(const Collision::AABB2D& aabb) const {
@@ -799,17 +805,11 @@ std::vector<int> BoundingLines::CollisionCheckIndices(const BoundingLines& other
 
 std::vector<int> BoundingLines::CollisionCheckIndices(const Collision::Ray2D& ray) const {
     std::vector<int> indicesCollidedWith;
-    indicesCollidedWith.reserve(this->lines.size());
-    float temp;
-
-    // Do a line-line collision with every line in this verses every line in the given set of BoundingLines
-    for (size_t i = 0; i < this->lines.size(); ++i) {
-        const Collision::LineSeg2D& currThisLine = this->lines[i];
 
-        if (Collision::IsCollision(ray, currThisLine, temp)) {
-            indicesCollidedWith.push_back(i);
-            break;
-        }
+    // Only the first line that the ray hits is reported
+    int firstHitIdx = this->packedLines.FindFirstRayHit(ray);
+    if (firstHitIdx != -1) {
+        indicesCollidedWith.push_back(firstHitIdx);
     }
 
     return indicesCollidedWith;
@@ -926,19 +926,34 @@ bool BoundingLines::GetCollisionPoints(const Collision::AABB2D& aabb, std::list<
  */
 bool BoundingLines::CollisionCheck(const Collision::Ray2D& ray, float& rayT) const {
 	rayT = FLT_MAX;
-	bool collisionFound = false;
+	return this->packedLines.RayCast(ray, rayT);
+}
 
-	for (size_t i = 0; i < this->lines.size(); ++i) {
-		float currentT;
-		if (Collision::IsCollision(ray, this->lines[i], currentT)) {
-			collisionFound = true;
-			if (currentT < rayT) {
-				rayT = currentT;
-			}
-		}
+// Copies the end points of numLines lines starting at firstIdx (p1, p2 of the first line, then the next, ...)
+// into the given packed array, which must have room for 2*numLines points
+void BoundingLines::GatherLineEndPoints(size_t firstIdx, size_t numLines, Point2D* endPts) const {
+	assert(firstIdx + numLines <= this->lines.size());
+	for (size_t i = 0; i < numLines; i++) {
+		endPts[2*i]   = this->lines[firstIdx + i].P1();
+		endPts[2*i+1] = this->lines[firstIdx + i].P2();
+	}
+}
+
+// Inverse of GatherLineEndPoints
+void BoundingLines::ScatterLineEndPoints(size_t firstIdx, size_t numLines, const Point2D* endPts) {
+	assert(firstIdx + numLines <= this->lines.size());
+	for (size_t i = 0; i < numLines; i++) {
+		this->lines[firstIdx + i].SetP1(endPts[2*i]);
+		this->lines[firstIdx + i].SetP2(endPts[2*i+1]);
 	}
+}
 
-	return collisionFound;
+// Overwrites the packed copy of every line in place, for when all the lines and normals have changed
+void BoundingLines::UpdatePackedLines() {
+	assert(this->packedLines.GetNumLines() == this->lines.size());
+	for (size_t i = 0; i < this->lines.size(); i++) {
+		this->packedLines.SetLine(i, this->lines[i], this->normals[i]);
+	}
 }
 
 /**
@@ -946,17 +961,26 @@ bool BoundingLines::CollisionCheck(const Collision::Ray2D& ray, float& rayT) con
  */
 void BoundingLines::RotateLinesAndNormals(float angleInDegs, const Point2D& rotationCenter) {
 	
-	// Rotate each line...
-	for (std::vector<Collision::LineSeg2D>::iterator iter = this->lines.begin(); iter != this->lines.end(); ++iter) {
-		Collision::LineSeg2D& currLineSeg = *iter;
-		currLineSeg.Rotate(angleInDegs, rotationCenter);
+	if (this->lines.empty()) {
+		return;
 	}
 
-	// Rotate each normal...
-	for (std::vector<Vector2D>::iterator iter = this->normals.begin(); iter != this->normals.end(); ++iter) {
-		Vector2D& currNormal = *iter;
-		currNormal = Vector2D::Rotate(angleInDegs, currNormal);
+	// Rotate the line end points in fixed size batches so that no scratch memory gets allocated...
+	Point2D endPts[2 * END_POINT_BATCH_NUM_LINES];
+	for (size_t i = 0; i < this->lines.size(); i += END_POINT_BATCH_NUM_LINES) {
+		size_t numLines = this->lines.size() - i;
+		if (numLines > END_POINT_BATCH_NUM_LINES) {
+			numLines = END_POINT_BATCH_NUM_LINES;
+		}
+		this->GatherLineEndPoints(i, numLines, endPts);
+		BatchMath::RotatePoints(angleInDegs, rotationCenter, endPts, 2 * numLines);
+		this->ScatterLineEndPoints(i, numLines, endPts);
 	}
+
+	// Rotate each normal...
+	BatchMath::RotateVectors(angleInDegs, &this->normals[0], this->normals.size());
+
+	this->UpdatePackedLines();
 }
 
 /**
@@ -964,38 +988,48 @@ void BoundingLines::RotateLinesAndNormals(float angleInDegs, const Point2D& rota
  */
 void BoundingLines::TranslateBounds(const Vector2D& translation) {
 	// Translate each line...
-	for (std::vector<Collision::LineSeg2D>::iterator iter = this->lines.begin(); iter != this->lines.end(); ++iter) {
-		Collision::LineSeg2D& currLineSeg = *iter;
+	for (size_t i = 0; i < this->lines.size(); i++) {
+		Collision::LineSeg2D& currLineSeg = this->lines[i];
 		currLineSeg.Translate(translation);
+		this->packedLines.SetLine(i, currLineSeg, this->normals[i]);
 	}
 }
 
 void BoundingLines::ReflectX() {
-    for (std::vector<Collision::LineSeg2D>::iterator iter = this->lines.begin(); iter != this->lines.end(); ++iter) {
-        Collision::LineSeg2D& currLineSeg = *iter;
+    for (size_t i = 0; i < this->lines.size(); i++) {
+        Collision::LineSeg2D& currLineSeg = this->lines[i];
+        Vector2D& currNormal = this->normals[i];
         currLineSeg.ReflectX();
-    }
-    for (std::vector<Vector2D>::iterator iter = this->normals.begin(); iter != this->normals.end(); ++iter) {
-        Vector2D& currNormal = *iter;
         currNormal[0] *= -1.0f;
+        this->packedLines.SetLine(i, currLineSeg, currNormal);
     }
 }
 
 void BoundingLines::Transform(const Matrix4x4& transform) {
 
-    // Transform each line...
-	for (std::vector<Collision::LineSeg2D>::iterator iter = this->lines.begin(); iter != this->lines.end(); ++iter) {
-		Collision::LineSeg2D& currLineSeg = *iter;
-		currLineSeg.Transform(transform);
-	}
+    if (this->lines.empty()) {
+        return;
+    }
+
+    // Transform the line end points in fixed size batches so that no scratch memory gets allocated...
+    Point2D endPts[2 * END_POINT_BATCH_NUM_LINES];
+    for (size_t i = 0; i < this->lines.size(); i += END_POINT_BATCH_NUM_LINES) {
+        size_t numLines = this->lines.size() - i;
+        if (numLines > END_POINT_BATCH_NUM_LINES) {
+            numLines = END_POINT_BATCH_NUM_LINES;
+        }
+        this->GatherLineEndPoints(i, numLines, endPts);
+        BatchMath::TransformPoints(transform, endPts, 2 * numLines);
+        this->ScatterLineEndPoints(i, numLines, endPts);
+    }
 
     // Transform each normal...
+    BatchMath::TransformVectors(transform, &this->normals[0], this->normals.size());
 	for (std::vector<Vector2D>::iterator iter = this->normals.begin(); iter != this->normals.end(); ++iter) {
-		Vector2D& currNormal = *iter;
-        Vector3D temp = transform * Vector3D(currNormal[0], currNormal[1], 0.0f);
-        currNormal = Vector2D(temp[0], temp[1]);
-        currNormal.Normalize();
+        iter->Normalize();
 	}
+
+    this->UpdatePackedLines();
 }
 
 void BoundingLines::SetAllBoundsInside(bool inside) {
@@ -1017,6 +1051,7 @@ BoundingLines& BoundingLines::operator=(const BoundingLines& copy) {
     this->lines = copy.lines;
     this->normals = copy.normals;
     this->onInside = copy.onInside;
+    this->packedLines = copy.packedLines;
 
     return (*this);
 }
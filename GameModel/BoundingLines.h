@@ -36,6 +36,7 @@
 #include "../BlammoEngine/Point.h"
 #include "../BlammoEngine/Vector.h"
 #include "../BlammoEngine/Collision.h"
+#include "../BlammoEngine/PackedLineSegs2D.h"
 
 class BoundingLines {
 public:
@@ -134,16 +135,19 @@ public:
 		this->lines.clear();
 		this->normals.clear();
         this->onInside.clear();
+        this->packedLines.Clear();
 	}
     void PopLast() {
         this->lines.pop_back();
         this->normals.pop_back();
         this->onInside.pop_back();
+        this->packedLines.PopLast();
     }
     void Push(const Collision::LineSeg2D& line, const Vector2D& normal, bool inside = false) {
         this->lines.push_back(line);
         this->normals.push_back(normal);
         this->onInside.push_back(inside);
+        this->packedLines.Push(line, normal);
     }
 
     BoundingLines& operator=(const BoundingLines& copy);
@@ -156,10 +160,20 @@ public:
 private:
     static const float BALL_INSIDE_OUTSIDE_DIST_DIVISOR;
     static const float BALL_COLLISION_SAMPLING_INV_AMT;
+    static const size_t END_POINT_BATCH_NUM_LINES = 32;   // Lines per batch when rotating/transforming end points
 
 	std::vector<Collision::LineSeg2D> lines;
 	std::vector<Vector2D> normals;
     std::vector<bool> onInside;
+
+    // Packed copy of the lines and normals above for the vectorized collision tests, it has to be
+    // kept in sync whenever the lines or normals change (only the changed entries get rewritten)
+    PackedLineSegs2D packedLines;
+
+    void UpdatePackedLines();
+
+    void GatherLineEndPoints(size_t firstIdx, size_t numLines, Point2D* endPts) const;
+    void ScatterLineEndPoints(size_t firstIdx, size_t numLines, const Point2D* endPts);
 };
 
 inline bool BoundingLines::Collide(double dT, const Collision::Circle2D& c, const Vector2D& velocity, Vector2D& n, 
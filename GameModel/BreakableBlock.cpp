@@ -37,6 +37,7 @@
 #include "GameBall.h"
 #include "GameEventManager.h"
 #include "FireGlobProjectile.h"
+#include "SimulationClock.h"
 
 const double BreakableBlock::ALLOWABLE_TIME_BETWEEN_BALL_COLLISIONS_IN_MS = 17;
 
@@ -88,7 +89,7 @@ LevelPiece* BreakableBlock::Destroy(GameModel* gameModel, const LevelPiece::Dest
 
 	// Obliterate all that is left of this block...
 	LevelPiece* tempThis = this;
-	delete tempThis;
+	GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
 	tempThis = NULL;
 
     // Add to the ball boost meter...
@@ -191,7 +192,7 @@ LevelPiece* BreakableBlock::EatAwayAtPiece(double dT, int dmgPerSec, GameModel*
 LevelPiece* BreakableBlock::CollisionOccurred(GameModel* gameModel, GameBall& ball) {
 	assert(gameModel != NULL);
     
-    long currSystemTime = BlammoTime::GetSystemTimeInMillisecs();
+    long currTime = SimulationClock::GetTimeInMillisecs();
 
     // Make sure we don't do a double collision - check to make sure the ball hasn't already
     // collided with this block and also that we're not in the same game time tick since the last
@@ -199,18 +200,18 @@ LevelPiece* BreakableBlock::CollisionOccurred(GameModel* gameModel, GameBall& ba
     if (ball.IsLastPieceCollidedWith(this) && ball.GetTimeSinceLastCollision() < 
         (BreakableBlock::ALLOWABLE_TIME_BETWEEN_BALL_COLLISIONS_IN_MS/1000.0)) {
 
-        this->timeOfLastBallCollision = currSystemTime;
+        this->timeOfLastBallCollision = currTime;
         return this;
     }
     
-    if ((currSystemTime - this->timeOfLastBallCollision) < 
+    if ((currTime - this->timeOfLastBallCollision) < 
          BreakableBlock::ALLOWABLE_TIME_BETWEEN_BALL_COLLISIONS_IN_MS) {
 
-        this->timeOfLastBallCollision = currSystemTime;
+        this->timeOfLastBallCollision = currTime;
         return this;
     }
 
-    this->timeOfLastBallCollision = currSystemTime;
+    this->timeOfLastBallCollision = currTime;
 
 	LevelPiece* newPiece = this;
 	
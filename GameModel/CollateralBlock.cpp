@@ -32,7 +32,8 @@
 #include "CollateralBlock.h"
 #include "GameModel.h"
 #include "GameLevel.h"
-#include "EmptySpaceBlock.h"
+#include "EmptySpaceBlock.h"
+#include "GameEventManager.h"
 #include "CollateralBlockProjectile.h"
 #include "Beam.h"
 
@@ -105,7 +106,7 @@ LevelPiece* CollateralBlock::Destroy(GameModel* gameModel, const LevelPiece::Des
 
 	// Obliterate all that is left of this block...
 	LevelPiece* tempThis = this;
-	delete tempThis;
+	GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
 	tempThis = NULL;
 
 	return emptyPiece;
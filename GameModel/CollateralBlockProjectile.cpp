@@ -35,6 +35,8 @@
 #include "GameEventManager.h"
 #include "GameModel.h"
 
+DEFINE_POOLED_ALLOCATION(CollateralBlockProjectile, 16)
+
 const double CollateralBlockProjectile::PORTAL_COLLISION_RESET_TIME = LevelPiece::PIECE_HEIGHT / CollateralBlock::COLLATERAL_FALL_SPEED;
 
 // NOTE: We don't make the collateral block projectile have the exact width of a LevelPiece because we don't want
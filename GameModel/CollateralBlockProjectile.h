@@ -43,6 +43,8 @@ class PortalBlock;
  */
 class CollateralBlockProjectile : public Projectile {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	CollateralBlockProjectile(CollateralBlock* collateralBlock);
 	~CollateralBlockProjectile();
 
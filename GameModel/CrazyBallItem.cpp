@@ -31,6 +31,8 @@
 
 #include "CrazyBallItem.h"
 
+DEFINE_POOLED_ALLOCATION(CrazyBallItem, 4)
+
 const char* CrazyBallItem::CRAZY_BALL_ITEM_NAME       = "CrazyBall";
 const double CrazyBallItem::CRAZY_BALL_TIMER_IN_SECS  = 28.0;
 
@@ -50,7 +52,7 @@ double CrazyBallItem::Activate() {
         GameItemTimer* currTimer = *iter;
         if (currTimer->GetTimerItemType() == GameItem::CrazyBallItem) {
             iter = activeTimers.erase(iter);
-            delete currTimer;
+            GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
             currTimer = NULL;
         }
         else {
@@ -39,6 +39,8 @@
 
 class CrazyBallItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* CRAZY_BALL_ITEM_NAME;
 	static const double CRAZY_BALL_TIMER_IN_SECS;
 
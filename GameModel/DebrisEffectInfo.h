@@ -51,6 +51,14 @@ public:
     ~DebrisEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::DebrisInfo; }
+    BossEffectEventInfo* Clone() const {
+        DebrisEffectInfo* copy = new DebrisEffectInfo(this->part, this->explosionCenter, this->colour,
+            this->minLifeOfDebrisInSecs, this->maxLifeOfDebrisInSecs, this->numDebrisBits,
+            this->sizeMultiplier, this->forceMultiplier);
+        copy->overrideDirection = this->overrideDirection;
+        copy->overridenDir = this->overridenDir;
+        return copy;
+    }
 
     const BossBodyPart* GetPart() const { return this->part; }
     const Point2D& GetExplosionCenter() const { return this->explosionCenter; }
@@ -75,7 +83,7 @@ public:
 private:
     const BossBodyPart* part;
     const Point2D explosionCenter;
-    const Colour& colour;
+    const Colour colour;
     double minLifeOfDebrisInSecs;
     double maxLifeOfDebrisInSecs;
     const int numDebrisBits;
@@ -41,6 +41,9 @@ public:
     ~ElectricitySpasmEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::ElectricitySpasmInfo; }
+    BossEffectEventInfo* Clone() const {
+        return new ElectricitySpasmEffectInfo(this->part, this->timeInSecs, this->colour);
+    }
 
     const BossBodyPart* GetPart() const { return this->part; }
     double GetTimeInSecs() const { return this->timeInSecs; }
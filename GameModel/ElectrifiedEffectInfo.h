@@ -41,6 +41,9 @@ public:
       ~ElectrifiedEffectInfo() {}
 
       BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::ElectrifiedInfo; }
+      BossEffectEventInfo* Clone() const {
+          return new ElectrifiedEffectInfo(this->position, this->size, this->timeInSecs, this->colour);
+      }
 
       const Point3D& GetPosition() const { return this->position; }
       float GetSize() const { return this->size; }
@@ -55,6 +55,15 @@ public:
     ~EnumBossEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::EnumInfo; }
+    BossEffectEventInfo* Clone() const {
+        EnumBossEffectInfo* copy = new EnumBossEffectInfo(this->specificType);
+        copy->bodyPart   = this->bodyPart;
+        copy->offset     = this->offset;
+        copy->size       = this->size;
+        copy->direction  = this->direction;
+        copy->timeInSecs = this->timeInSecs;
+        return copy;
+    }
     SpecificEffectType GetSpecificType() const { return this->specificType; }
 
     void SetBodyPart(const BossBodyPart* bodyPart) { this->bodyPart = bodyPart; }
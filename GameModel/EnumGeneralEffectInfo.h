@@ -43,6 +43,15 @@ public:
     virtual ~EnumGeneralEffectInfo() {}
 
     GeneralEffectEventInfo::Type GetType() const { return GeneralEffectEventInfo::EnumEffect; }
+    GeneralEffectEventInfo* Clone() const {
+        EnumGeneralEffectInfo* copy = new EnumGeneralEffectInfo(this->specificType);
+        copy->position   = this->position;
+        copy->size       = this->size;
+        copy->direction  = this->direction;
+        copy->colour     = this->colour;
+        copy->timeInSecs = this->timeInSecs;
+        return copy;
+    }
     EnumGeneralEffectInfo::SpecificEffectType GetSpecificType() const { return this->specificType; }
 
     void SetPosition(const Point3D& pos) { this->position = pos; }
@@ -43,6 +43,9 @@ public:
     ~ExpandingHaloEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::ExpandingHaloInfo; }
+    BossEffectEventInfo* Clone() const {
+        return new ExpandingHaloEffectInfo(this->part, this->timeInSecs, this->colour, this->sizeMultiplier, this->offset);
+    }
 
     const BossBodyPart* GetPart() const { return this->part; }
     double GetTimeInSecs() const { return this->timeInSecs; }
@@ -34,6 +34,8 @@
 #include "GameModel.h"
 #include "GameItemTimer.h"
 
+DEFINE_POOLED_ALLOCATION(FireBallItem, 4)
+
 const double FireBallItem::FIRE_BALL_TIMER_IN_SECS	= 22.0;
 const char* FireBallItem::FIRE_BALL_ITEM_NAME			  = "FireBall";
 
@@ -55,7 +57,7 @@ double FireBallItem::Activate() {
 		// Remove the fire ball timers from the list of active timers
 		if (currTimer->GetTimerItemType() == GameItem::FireBallItem) {
 			iter = activeTimers.erase(iter);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 		}
 		else if (currTimer->GetTimerItemType() == GameItem::IceBallItem) {
@@ -72,7 +74,7 @@ double FireBallItem::Activate() {
 
 			// If there's an ice ball item going right now then the effects just cancel each other out
 			iter = activeTimers.erase(iter);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 			return 0.0;
 		}
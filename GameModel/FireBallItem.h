@@ -41,6 +41,8 @@ class Point2D;
 
 class FireBallItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* FIRE_BALL_ITEM_NAME;
 	static const double FIRE_BALL_TIMER_IN_SECS;
 
@@ -33,6 +33,8 @@
 #include "LevelPiece.h"
 #include "GameModel.h"
 
+DEFINE_POOLED_ALLOCATION(FireGlobProjectile, 16)
+
 const float FireGlobProjectile::FIRE_GLOB_MIN_VELOCITY			= 2.5f;
 const float FireGlobProjectile::FIRE_GLOB_MAX_ADD_VELOCITY	= 1.25f;
 
@@ -36,6 +36,8 @@
 
 class FireGlobProjectile : public Projectile {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	FireGlobProjectile(const Point2D& spawnLoc, float size, const Vector2D& gravityDir);
 	~FireGlobProjectile();
 
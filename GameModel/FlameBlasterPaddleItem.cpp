@@ -33,6 +33,8 @@
 #include "GameModel.h"
 #include "GameItemTimer.h"
 
+DEFINE_POOLED_ALLOCATION(FlameBlasterPaddleItem, 4)
+
 const char* FlameBlasterPaddleItem::FLAME_BLASTER_PADDLE_ITEM_NAME      = "FlameBlasterPaddle";
 const double FlameBlasterPaddleItem::FLAME_BLASTER_PADDLE_TIMER_IN_SECS = 17.0f;
 
@@ -57,7 +59,7 @@ double FlameBlasterPaddleItem::Activate() {
         // Remove the fire blaster timers from the list of active timers
         if (currTimer->GetTimerItemType() == GameItem::FlameBlasterPaddleItem) {
             iter = activeTimers.erase(iter);
-            delete currTimer;
+            GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
             currTimer = NULL;
         }
         else if (currTimer->GetTimerItemType() == GameItem::IceBlasterPaddleItem) {
@@ -67,7 +69,7 @@ double FlameBlasterPaddleItem::Activate() {
 
             // If there's an ice blaster item going right now then the effects just cancel each other out
             iter = activeTimers.erase(iter);
-            delete currTimer;
+            GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
             currTimer = NULL;
 
             return 0.0;
@@ -36,6 +36,8 @@
 
 class FlameBlasterPaddleItem : public GameItem {
 public:
+    DECLARE_POOLED_ALLOCATION();
+
     static const char* FLAME_BLASTER_PADDLE_ITEM_NAME;
     static const double FLAME_BLASTER_PADDLE_TIMER_IN_SECS;
 
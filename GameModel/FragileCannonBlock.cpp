@@ -67,7 +67,7 @@ LevelPiece* FragileCannonBlock::Destroy(GameModel* gameModel, const LevelPiece::
 
     // Obliterate all that is left of this block...
     LevelPiece* tempThis = this;
-    delete tempThis;
+    GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
     tempThis = NULL;
 
     return emptyPiece;
@@ -41,6 +41,9 @@ public:
     ~FullscreenFlashEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::FullscreenFlashInfo; }
+    BossEffectEventInfo* Clone() const {
+        return new FullscreenFlashEffectInfo(this->timeInSecs, this->shakeMultiplier);
+    }
 
     double GetTime() const { return this->timeInSecs; }
     float GetShakeMultiplier() const { return this->shakeMultiplier; }
@@ -71,6 +71,7 @@ const float GameBall::GRAVITY_ACCELERATION  = 7.5f;
 const float GameBall::BOOST_DECCELERATION   = BOOST_TEMP_SPD_INCREASE_AMT;
 
 GameBall* GameBall::currBallCamBall = NULL;
+unsigned int GameBall::nextObjectID = 0;
 
 void GameBall::SetNormalSpeed(float speed) {
     NormalSpeed            = speed;
@@ -81,7 +82,7 @@ void GameBall::SetNormalSpeed(float speed) {
     FastestSpeedWithBoost  = GameBall::NormalSpeed + 14.0f;
 }
 
-GameBall::GameBall() : bounds(Point2D(0.0f, 0.0f), DEFAULT_BALL_RADIUS), currDir(Vector2D(0.0f, 0.0f)), currSpeed(GameBall::ZeroSpeed),
+GameBall::GameBall() : objectID(GameBall::nextObjectID++), bounds(Point2D(0.0f, 0.0f), DEFAULT_BALL_RADIUS), currDir(Vector2D(0.0f, 0.0f)), currSpeed(GameBall::ZeroSpeed),
 currType(GameBall::NormalBall), rotationInDegs(0.0f, 0.0f, 0.0f), currScaleFactor(1), currSize(NormalSize), ballballCollisionsDisabledTimer(0.0),
 lastThingCollidedWith(NULL), zCenterPos(0.0), currState(NULL), timeSinceLastCollision(0.0f), 
 boostSpdDecreaseCounter(BOOST_TEMP_SPD_INCREASE_AMT), impulseAmount(0), 
@@ -89,7 +90,7 @@ impulseDeceleration(0), impulseSpdDecreaseCounter(0)  {
 	this->ResetBallAttributes();
 }
 
-GameBall::GameBall(const GameBall& gameBall) : bounds(gameBall.bounds), currDir(gameBall.currDir), currSpeed(gameBall.currSpeed), 
+GameBall::GameBall(const GameBall& gameBall) : objectID(GameBall::nextObjectID++), bounds(gameBall.bounds), currDir(gameBall.currDir), currSpeed(gameBall.currSpeed), 
 currType(gameBall.currType), currSize(gameBall.currSize), currScaleFactor(gameBall.currScaleFactor), 
 rotationInDegs(gameBall.rotationInDegs), ballballCollisionsDisabledTimer(0.0), lastThingCollidedWith(NULL),
 zCenterPos(gameBall.zCenterPos), contributingGravityColour(gameBall.contributingGravityColour), 
@@ -125,7 +126,10 @@ currState(NULL) {
 GameBall::~GameBall() {
 	// Delete the ball state...
 	this->SetBallState(NULL, true);
+    this->PrepareForDeletion();
+}
 
+void GameBall::PrepareForDeletion() {
 	// If the ball camera ball dies then we better set it to NULL since it will no longer exist after this
 	if (this == GameBall::currBallCamBall) {
 		GameBall::currBallCamBall = NULL;
@@ -212,10 +216,10 @@ bool GameBall::CanShootBallCamOutOfCannon(const CannonBlock& cannon, const GameL
         (CannonBlock::HALF_CANNON_BARREL_LENGTH + this->GetBounds().Radius()) * cannonDir,
         this->GetBounds().Radius());
 
-    std::vector<LevelPiece*> collisionPieces;
+    LevelPieceCandidateBuffer collisionPieces;
     currLevel.GetLevelPieceCollisionCandidates(0.0, testBallBounds.Center(), testBallBounds.Radius(), 0.0, collisionPieces);
 
-    for (std::vector<LevelPiece*>::iterator pieceIter = collisionPieces.begin(); 
+    for (LevelPieceCandidateBuffer::const_iterator pieceIter = collisionPieces.begin(); 
          pieceIter != collisionPieces.end(); ++pieceIter) {
 
         const LevelPiece *currPiece = *pieceIter;
@@ -86,6 +86,9 @@ public:
 	GameBall(const GameBall& gameBall);
 	~GameBall();
 
+    // Unique to this ball for the life of the game (a copied ball gets its own)
+    unsigned int GetObjectID() const { return this->objectID; }
+
 	void ResetBallAttributes();
 
 	static void SetBallCamera(GameBall* ballCamBall, const GameLevel* currLevel);
@@ -93,6 +96,10 @@ public:
 	static const GameBall* GetBallCameraBall() { return GameBall::currBallCamBall; }
     bool HasBallCameraActive() const { return this == GameBall::currBallCamBall; }
 
+    // Lets go of the ball camera if this ball has it, done when the ball is destroyed or earlier
+    // when its deletion is put off (see GameEventManager::DeleteAfterDispatch)
+    void PrepareForDeletion();
+
     bool CanShootBallCamOutOfCannon(const CannonBlock& cannon, const GameLevel& currLevel) const;
 
 	// Ball colour set/get functions
@@ -381,6 +388,9 @@ private:
     static float FastestSpeedWithBoost;
 
     static GameBall* currBallCamBall;	// The current ball that has the ball camera active on it, if none then NULL
+    static unsigned int nextObjectID;   // The object ID given to the next ball that gets created
+
+    unsigned int objectID;
 	BallState* currState;
     AnimationLerp<ColourRGBA> colourAnimation;	// Animations associated with the colour
 
@@ -32,10 +32,72 @@
 #include "GameEventManager.h"
 #include "GameEvents.h"
 #include "GameModel.h"
+#include "GameBall.h"
+#include "GameItem.h"
+#include "GameItemTimer.h"
+#include "Beam.h"
+#include "SafetyNet.h"
+#include "BallBoostModel.h"
+#include "Boss.h"
+#include "PointAward.h"
+
+#include "../BlammoEngine/BlammoTime.h"
 
 GameEventManager* GameEventManager::instance = NULL;
 
-GameEventManager::GameEventManager() {
+// Enough room for a few frames' worth of model steps in a busy level, the queue is dispatched
+// early if it ever fills up (or, on the model thread, what doesn't fit waits in the overflow)
+const size_t GameEventManager::DEFERRED_EVENT_QUEUE_SIZE = 4096;
+
+// Names of each EventType, in the same order as the enumeration
+static const char* EVENT_TYPE_NAMES[GameEventManager::NumEventTypes] = {
+    "PaddleHitWall", "PaddlePortalBlockTeleport", "PaddleHitByProjectile", "PaddleShieldHitByProjectile",
+    "ProjectileDeflectedByPaddleShield", "PaddleHitByBeam", "PaddleShieldHitByBeam", "PaddleHitByBoss",
+    "PaddleStatusUpdate", "FrozenPaddleCanceledByFire", "OnFirePaddleCanceledByIce", "PaddleFlipped",
+    "BallDied", "LastBallAboutToDie", "LastBallExploded", "AllBallsDead", "BallSpawn", "BallShot",
+    "PaddleWeaponFired", "ProjectileBlockCollision", "ProjectileSafetyNetCollision",
+    "ProjectileBossCollision", "ProjectileBallCollision", "BallBlockCollision", "BallPortalBlockTeleport",
+    "BallPortalProjectileTeleport", "ProjectilePortalProjectileTeleport", "ProjectilePortalBlockTeleport",
+    "ItemPortalBlockTeleport", "BallEnteredCannon", "BallFiredFromCannon", "ProjectileEnteredCannon",
+    "ProjectileFiredFromCannon", "BallHitTeslaLightningArc", "GamePauseStateChanged",
+    "FireBallCanceledByIceBall", "IceBallCanceledByFireBall", "PaddleIceBlasterCanceledByFireBlaster",
+    "PaddleFireBlasterCanceledByIceBlaster", "BallPaddleCollision", "BallBallCollision", "BallBossCollision",
+    "BlockDestroyed", "BallSafetyNetCreated", "BallSafetyNetDestroyed", "LevelPieceChanged",
+    "LevelPieceStatusAdded", "LevelPieceStatusRemoved", "LevelPieceAllStatusRemoved",
+    "CollateralBlockChangedState", "ItemSpawned", "ItemRemoved", "ItemPaddleCollision", "ItemActivated",
+    "ItemDeactivated", "RandomItemActivated", "ItemTimerStarted", "ItemTimerStopped",
+    "ItemDropBlockItemChange", "ItemDropBlockLocked", "SwitchBlockActivated", "BulletTimeStateChanged",
+    "BallBoostExecuted", "BallBoostGained", "BallBoostLost", "BallBoostUsed",
+    "BoostFailedDueToNoBallsAvailable", "BallCameraSetOrUnset", "BallCameraCannonRotation",
+    "CantFireBallCamFromCannon", "PaddleCameraSetOrUnset", "ReleaseTimerStarted", "ProjectileSpawned",
+    "ProjectileRemoved", "RocketExploded", "MineExploded", "MineLanded", "RemoteControlRocketFuelWarning",
+    "RemoteControlRocketThrustApplied", "BeamSpawned", "BeamChanged", "BeamRemoved",
+    "TeslaLightningBarrierSpawned", "TeslaLightningBarrierRemoved", "GameCompleted", "WorldStarted",
+    "WorldCompleted", "LevelStarted", "LevelAlmostComplete", "LevelCompleted", "LevelResetting",
+    "LivesChanged", "BlockIceShattered", "BlockIceCancelledWithFire", "BlockFireCancelledWithIce",
+    "PointNotification", "ScoreChanged", "ScoreMultiplierCounterChanged", "ScoreMultiplierChanged",
+    "NumStarsChanged", "DifficultyChanged", "LaserTurretAIStateChanged", "LaserFiredByTurret",
+    "RocketTurretAIStateChanged", "RocketFiredByTurret", "MineTurretAIStateChanged", "MineFiredByTurret",
+    "RegenBlockLifeChanged", "RegenBlockPreturbed", "BossHurt", "BossAngry", "ClearActiveBossEffects",
+    "GeneralEffect", "BossEffect"
+};
+
+// Recovers a model object that was recorded in a deferred event
+template <typename T>
+static inline const T& DeferredObject(const void* object) {
+    assert(object != NULL);
+    return *static_cast<const T*>(object);
+}
+
+// Deletes a model object whose deletion was recorded by DeleteAfterDispatch
+template <typename T>
+static void DeleteDeferredObject(const void* object) {
+    delete static_cast<const T*>(object);
+}
+
+GameEventManager::GameEventManager() : dispatchMode(ImmediateDispatch), isDispatchingDeferred(false),
+isTimingDispatches(false), deferredEvents(DEFERRED_EVENT_QUEUE_SIZE), modelThreadID(0) {
+    assert(EVENT_TYPE_NAMES[NumEventTypes-1] != NULL);
 }
 
 /**
@@ -68,8 +130,662 @@ void GameEventManager::UnregisterGameEventListener(GameEvents* listener) {
 	this->eventListeners.remove(listener);
 }
 
+/**
+ * Sets whether events are sent to the listeners as they happen or (where it's safe to do so) 
+ * recorded and sent out together on the next call to DispatchDeferredEvents. Anything recorded
+ * is sent out immediately when switching back to immediate dispatch. Threaded dispatch must only
+ * be switched on or off while the model thread (see SetModelThread) isn't running.
+ */
+void GameEventManager::SetDispatchMode(DispatchMode mode) {
+    bool wasThreaded = (this->dispatchMode == ThreadedDispatch);
+    this->dispatchMode = mode;
+    if (mode == ImmediateDispatch || wasThreaded) {
+        this->DispatchDeferredEvents();
+    }
+}
+
+/**
+ * Sends all recorded events to the listeners in the order they happened (and deletes anything
+ * that was waiting on them, see DeleteAfterDispatch). This must be called at least once per frame
+ * when in deferred or threaded dispatch mode. In threaded dispatch this is only done by the view's
+ * thread, with the model locked so the listeners see the model between steps; on the model
+ * thread it does nothing.
+ */
+void GameEventManager::DispatchDeferredEvents() {
+    if (this->isDispatchingDeferred || this->IsDeferringAll()) {
+        return;
+    }
+
+    this->isDispatchingDeferred = true;
+    DeferredEvent event;
+    for (;;) {
+        if (!this->deferredEvents.Pop(event)) {
+            // Anything that overflowed was recorded after everything in the queue
+            if (this->overflowEvents.empty()) {
+                break;
+            }
+            event = this->overflowEvents.front();
+            this->overflowEvents.pop_front();
+        }
+
+        if (event.deleter != NULL) {
+            event.deleter(event.objects[0]);
+        }
+        else {
+            this->DispatchDeferredEvent(event);
+        }
+    }
+    this->isDispatchingDeferred = false;
+}
+
+/**
+ * The model objects that recorded events can refer to are deleted with these: on the model thread
+ * (in threaded dispatch) the deletion is recorded behind the events so the object stays alive until
+ * they have been dispatched, anywhere else the recorded events are dispatched and the object is
+ * deleted right away. Whatever the object's destruction does to the rest of the model (see the
+ * PrepareForDeletion functions) always happens right away.
+ */
+void GameEventManager::DeleteAfterDispatch(LevelPiece* piece) {
+    piece->PrepareForDeletion();
+    this->DeferDeletion(piece);
+}
+void GameEventManager::DeleteAfterDispatch(GameBall* ball) {
+    ball->PrepareForDeletion();
+    this->DeferDeletion(ball);
+}
+void GameEventManager::DeleteAfterDispatch(Projectile* projectile) {
+    // Projectiles are let go of by the model with Projectile::Teardown before they're deleted
+    this->DeferDeletion(projectile);
+}
+void GameEventManager::DeleteAfterDispatch(GameItem* item) {
+    this->DeferDeletion(item);
+}
+void GameEventManager::DeleteAfterDispatch(GameItemTimer* timer) {
+    timer->PrepareForDeletion();
+    this->DeferDeletion(timer);
+}
+void GameEventManager::DeleteAfterDispatch(Beam* beam) {
+    beam->PrepareForDeletion();
+    this->DeferDeletion(beam);
+}
+void GameEventManager::DeleteAfterDispatch(SafetyNet* safetyNet) {
+    safetyNet->PrepareForDeletion();
+    this->DeferDeletion(safetyNet);
+}
+void GameEventManager::DeleteAfterDispatch(BallBoostModel* boostModel) {
+    boostModel->PrepareForDeletion();
+    this->DeferDeletion(boostModel);
+}
+void GameEventManager::DeleteAfterDispatch(AbstractBossBodyPart* bossPart) {
+    bossPart->PrepareForDeletion();
+    this->DeferDeletion(bossPart);
+}
+void GameEventManager::DeleteAfterDispatch(Boss* boss) {
+    boss->PrepareForDeletion();
+    this->DeferDeletion(boss);
+}
+void GameEventManager::DeleteAfterDispatch(GameLevel* level) {
+    this->DeferDeletion(level);
+}
+void GameEventManager::DeleteAfterDispatch(GameWorld* world) {
+    this->DeferDeletion(world);
+}
+
+template <typename T>
+void GameEventManager::DeferDeletion(T* object) {
+    assert(object != NULL);
+    if (this->IsDeferringAll()) {
+        this->PushDeferredEvent(DeferredEvent(&DeleteDeferredObject<T>, object));
+        return;
+    }
+
+    // Nothing recorded can refer to the object once everything has been dispatched
+    this->DispatchDeferredEvents();
+    delete object;
+}
+
+/**
+ * Get the readable name of the given event type (e.g., for profiling output).
+ */
+const char* GameEventManager::GetEventTypeName(EventType type) {
+    assert(type >= 0 && type < NumEventTypes);
+    return EVENT_TYPE_NAMES[type];
+}
+
+const GameEventManager::EventTypeStats& GameEventManager::GetEventTypeStats(EventType type) const {
+    assert(type >= 0 && type < NumEventTypes);
+    return this->eventStats[type];
+}
+
+void GameEventManager::ResetEventStats() {
+    for (int i = 0; i < NumEventTypes; i++) {
+        this->eventStats[i] = EventTypeStats();
+    }
+}
+
+/**
+ * Writes a line of statistics for every event type that has been actioned, the
+ * events that took the most time in their listeners are listed first.
+ */
+void GameEventManager::WriteEventStats(std::ostream& out) const {
+    static const double SECS_TO_MICROSECS = 1000000.0;
+
+    std::vector<std::pair<double, int> > sortedTypes;
+    sortedTypes.reserve(NumEventTypes);
+    for (int i = 0; i < NumEventTypes; i++) {
+        const EventTypeStats& stats = this->eventStats[i];
+        if (stats.numDispatched > 0 || stats.numDeferred > 0) {
+            sortedTypes.push_back(std::make_pair(-stats.totalDispatchTimeInSecs, i));
+        }
+    }
+    std::sort(sortedTypes.begin(), sortedTypes.end());
+
+    for (size_t i = 0; i < sortedTypes.size(); i++) {
+        const EventTypeStats& stats = this->eventStats[sortedTypes[i].second];
+        out << EVENT_TYPE_NAMES[sortedTypes[i].second] << ": "
+            << "dispatched="    << stats.numDispatched
+            << ", deferred="    << stats.numDeferred
+            << ", total(us)="   << stats.totalDispatchTimeInSecs * SECS_TO_MICROSECS
+            << ", mean(us)="    << (stats.numDispatched > 0 ? 
+                                    stats.totalDispatchTimeInSecs * SECS_TO_MICROSECS / stats.numDispatched : 0.0)
+            << std::endl;
+    }
+}
+
+void GameEventManager::DeferEvent(const DeferredEvent& event) {
+    assert(this->IsDeferring());
+    this->eventStats[event.type].numDeferred++;
+    this->PushDeferredEvent(event);
+}
+
+void GameEventManager::PushDeferredEvent(const DeferredEvent& event) {
+    if (this->IsDeferringAll()) {
+        // Only the view's thread can make room in the queue, anything that doesn't fit waits in the
+        // overflow (which is only touched with the model locked) until the next dispatch
+        if (!this->overflowEvents.empty() || !this->deferredEvents.Push(event)) {
+            this->overflowEvents.push_back(event);
+        }
+        return;
+    }
+
+    if (!this->deferredEvents.Push(event)) {
+        // The queue is full, send out everything recorded so far to make room
+        this->DispatchDeferredEvents();
+        bool success = this->deferredEvents.Push(event);
+        UNUSED_VARIABLE(success);
+        assert(success);
+    }
+}
+
+// Re-actions a recorded event, this is only ever called while dispatching
+// deferred events so the event goes straight to the listeners
+void GameEventManager::DispatchDeferredEvent(const DeferredEvent& event) {
+    assert(this->isDispatchingDeferred);
+
+    switch (event.type) {
+        case PaddleHitWallEventType:
+            this->ActionPaddleHitWall(DeferredObject<PlayerPaddle>(event.objects[0]),
+                Point2D(event.coords[0], event.coords[1]));
+            break;
+        case PaddlePortalBlockTeleportEventType:
+            this->ActionPaddlePortalBlockTeleport(DeferredObject<PlayerPaddle>(event.objects[0]),
+                DeferredObject<PortalBlock>(event.objects[1]));
+            break;
+        case PaddleHitByProjectileEventType:
+            this->ActionPaddleHitByProjectile(DeferredObject<PlayerPaddle>(event.objects[0]),
+                DeferredObject<Projectile>(event.objects[1]));
+            break;
+        case PaddleShieldHitByProjectileEventType:
+            this->ActionPaddleShieldHitByProjectile(DeferredObject<PlayerPaddle>(event.objects[0]),
+                DeferredObject<Projectile>(event.objects[1]));
+            break;
+        case ProjectileDeflectedByPaddleShieldEventType:
+            this->ActionProjectileDeflectedByPaddleShield(DeferredObject<Projectile>(event.objects[0]),
+                DeferredObject<PlayerPaddle>(event.objects[1]));
+            break;
+        case PaddleHitByBeamEventType: {
+            const BeamSegment* beamSegment = static_cast<const BeamSegment*>(event.objects[2]);
+            this->ActionPaddleHitByBeam(DeferredObject<PlayerPaddle>(event.objects[0]),
+                DeferredObject<Beam>(event.objects[1]), *beamSegment);
+            delete beamSegment;
+            break;
+        }
+        case PaddleShieldHitByBeamEventType: {
+            const BeamSegment* beamSegment = static_cast<const BeamSegment*>(event.objects[2]);
+            this->ActionPaddleShieldHitByBeam(DeferredObject<PlayerPaddle>(event.objects[0]),
+                DeferredObject<Beam>(event.objects[1]), *beamSegment);
+            delete beamSegment;
+            break;
+        }
+        case PaddleHitByBossEventType:
+            this->ActionPaddleHitByBoss(DeferredObject<PlayerPaddle>(event.objects[0]),
+                DeferredObject<BossBodyPart>(event.objects[1]));
+            break;
+        case PaddleStatusUpdateEventType:
+            this->ActionPaddleStatusUpdate(DeferredObject<PlayerPaddle>(event.objects[0]),
+                static_cast<PlayerPaddle::PaddleSpecialStatus>(event.values[0]), event.values[1] != 0);
+            break;
+        case FrozenPaddleCanceledByFireEventType:
+            this->ActionFrozenPaddleCanceledByFire(DeferredObject<PlayerPaddle>(event.objects[0]));
+            break;
+        case OnFirePaddleCanceledByIceEventType:
+            this->ActionOnFirePaddleCanceledByIce(DeferredObject<PlayerPaddle>(event.objects[0]));
+            break;
+        case PaddleFlippedEventType:
+            this->ActionPaddleFlipped(DeferredObject<PlayerPaddle>(event.objects[0]), event.values[0] != 0);
+            break;
+        case BallDiedEventType:
+            this->ActionBallDied(DeferredObject<GameBall>(event.objects[0]));
+            break;
+        case LastBallAboutToDieEventType:
+            this->ActionLastBallAboutToDie(DeferredObject<GameBall>(event.objects[0]));
+            break;
+        case LastBallExplodedEventType:
+            this->ActionLastBallExploded(DeferredObject<GameBall>(event.objects[0]), event.values[0] != 0);
+            break;
+        case AllBallsDeadEventType:
+            this->ActionAllBallsDead(event.values[0]);
+            break;
+        case BallSpawnEventType:
+            this->ActionBallSpawn(DeferredObject<GameBall>(event.objects[0]));
+            break;
+        case BallShotEventType:
+            this->ActionBallShot(DeferredObject<GameBall>(event.objects[0]));
+            break;
+        case PaddleWeaponFiredEventType:
+            this->ActionPaddleWeaponFired(static_cast<PlayerPaddle::PaddleType>(event.values[0]));
+            break;
+        case ProjectileBlockCollisionEventType:
+            this->ActionProjectileBlockCollision(DeferredObject<Projectile>(event.objects[0]),
+                DeferredObject<LevelPiece>(event.objects[1]));
+            break;
+        case ProjectileSafetyNetCollisionEventType:
+            this->ActionProjectileSafetyNetCollision(DeferredObject<Projectile>(event.objects[0]),
+                DeferredObject<SafetyNet>(event.objects[1]));
+            break;
+        case ProjectileBossCollisionEventType:
+            this->ActionProjectileBossCollision(DeferredObject<Projectile>(event.objects[0]),
+                DeferredObject<Boss>(event.objects[1]), DeferredObject<BossBodyPart>(event.objects[2]));
+            break;
+        case ProjectileBallCollisionEventType:
+            this->ActionProjectileBallCollision(DeferredObject<Projectile>(event.objects[0]),
+                DeferredObject<GameBall>(event.objects[1]));
+            break;
+        case BallBlockCollisionEventType:
+            this->ActionBallBlockCollision(DeferredObject<GameBall>(event.objects[0]),
+                DeferredObject<LevelPiece>(event.objects[1]));
+            break;
+        case BallPortalBlockTeleportEventType:
+            this->ActionBallPortalBlockTeleport(DeferredObject<GameBall>(event.objects[0]),
+                DeferredObject<PortalBlock>(event.objects[1]));
+            break;
+        case BallPortalProjectileTeleportEventType:
+            this->ActionBallPortalProjectileTeleport(DeferredObject<GameBall>(event.objects[0]),
+                DeferredObject<PortalProjectile>(event.objects[1]));
+            break;
+        case ProjectilePortalProjectileTeleportEventType:
+            this->ActionProjectilePortalProjectileTeleport(DeferredObject<Projectile>(event.objects[0]),
+                DeferredObject<PortalProjectile>(event.objects[1]));
+            break;
+        case ProjectilePortalBlockTeleportEventType:
+            this->ActionProjectilePortalBlockTeleport(DeferredObject<Projectile>(event.objects[0]),
+                DeferredObject<PortalBlock>(event.objects[1]));
+            break;
+        case ItemPortalBlockTeleportEventType:
+            this->ActionItemPortalBlockTeleport(DeferredObject<GameItem>(event.objects[0]),
+                DeferredObject<PortalBlock>(event.objects[1]));
+            break;
+        case BallEnteredCannonEventType:
+            this->ActionBallEnteredCannon(DeferredObject<GameBall>(event.objects[0]),
+                DeferredObject<CannonBlock>(event.objects[1]), event.values[0] != 0);
+            break;
+        case BallFiredFromCannonEventType:
+            this->ActionBallFiredFromCannon(DeferredObject<GameBall>(event.objects[0]),
+                DeferredObject<CannonBlock>(event.objects[1]));
+            break;
+        case ProjectileEnteredCannonEventType:
+            this->ActionProjectileEnteredCannon(DeferredObject<Projectile>(event.objects[0]),
+                DeferredObject<CannonBlock>(event.objects[1]));
+            break;
+        case ProjectileFiredFromCannonEventType:
+            this->ActionProjectileFiredFromCannon(DeferredObject<Projectile>(event.objects[0]),
+                DeferredObject<CannonBlock>(event.objects[1]));
+            break;
+        case BallHitTeslaLightningArcEventType:
+            this->ActionBallHitTeslaLightningArc(DeferredObject<GameBall>(event.objects[0]));
+            break;
+        case GamePauseStateChangedEventType:
+            this->ActionGamePauseStateChanged(event.values[0], event.values[1]);
+            break;
+        case FireBallCanceledByIceBallEventType:
+            this->ActionFireBallCanceledByIceBall(DeferredObject<GameBall>(event.objects[0]));
+            break;
+        case IceBallCanceledByFireBallEventType:
+            this->ActionIceBallCanceledByFireBall(DeferredObject<GameBall>(event.objects[0]));
+            break;
+        case PaddleIceBlasterCanceledByFireBlasterEventType:
+            this->ActionPaddleIceBlasterCanceledByFireBlaster(DeferredObject<PlayerPaddle>(event.objects[0]));
+            break;
+        case PaddleFireBlasterCanceledByIceBlasterEventType:
+            this->ActionPaddleFireBlasterCanceledByIceBlaster(DeferredObject<PlayerPaddle>(event.objects[0]));
+            break;
+        case BallPaddleCollisionEventType:
+            this->ActionBallPaddleCollision(DeferredObject<GameBall>(event.objects[0]),
+                DeferredObject<PlayerPaddle>(event.objects[1]), event.values[0] != 0);
+            break;
+        case BallBallCollisionEventType:
+            this->ActionBallBallCollision(DeferredObject<GameBall>(event.objects[0]),
+                DeferredObject<GameBall>(event.objects[1]));
+            break;
+        case BallBossCollisionEventType:
+            this->ActionBallBossCollision(const_cast<GameBall&>(DeferredObject<GameBall>(event.objects[0])),
+                DeferredObject<Boss>(event.objects[1]), DeferredObject<BossBodyPart>(event.objects[2]));
+            break;
+        case BlockDestroyedEventType:
+            this->ActionBlockDestroyed(DeferredObject<LevelPiece>(event.objects[0]),
+                static_cast<LevelPiece::DestructionMethod>(event.values[0]));
+            break;
+        case BallSafetyNetCreatedEventType:
+            this->ActionBallSafetyNetCreated(event.values[0] != 0);
+            break;
+        case BallSafetyNetDestroyedEventType:
+            // The second value says what destroyed the safety net: a ball, the paddle or a projectile
+            if (event.values[1] == 0) {
+                this->ActionBallSafetyNetDestroyed(DeferredObject<GameBall>(event.objects[0]), event.values[0] != 0);
+            }
+            else if (event.values[1] == 1) {
+                this->ActionBallSafetyNetDestroyed(DeferredObject<PlayerPaddle>(event.objects[0]), event.values[0] != 0);
+            }
+            else {
+                this->ActionBallSafetyNetDestroyed(DeferredObject<Projectile>(event.objects[0]), event.values[0] != 0);
+            }
+            break;
+        case LevelPieceChangedEventType:
+            this->ActionLevelPieceChanged(DeferredObject<LevelPiece>(event.objects[0]),
+                DeferredObject<LevelPiece>(event.objects[1]));
+            break;
+        case LevelPieceStatusAddedEventType:
+            this->ActionLevelPieceStatusAdded(DeferredObject<LevelPiece>(event.objects[0]),
+                static_cast<LevelPiece::PieceStatus>(event.values[0]));
+            break;
+        case LevelPieceStatusRemovedEventType:
+            this->ActionLevelPieceStatusRemoved(DeferredObject<LevelPiece>(event.objects[0]),
+                static_cast<LevelPiece::PieceStatus>(event.values[0]));
+            break;
+        case LevelPieceAllStatusRemovedEventType:
+            this->ActionLevelPieceAllStatusRemoved(DeferredObject<LevelPiece>(event.objects[0]));
+            break;
+        case CollateralBlockChangedStateEventType:
+            this->ActionCollateralBlockChangedState(DeferredObject<CollateralBlock>(event.objects[0]),
+                DeferredObject<CollateralBlockProjectile>(event.objects[1]),
+                static_cast<CollateralBlock::CollateralBlockState>(event.values[0]),
+                static_cast<CollateralBlock::CollateralBlockState>(event.values[1]));
+            break;
+        case ItemSpawnedEventType:
+            this->ActionItemSpawned(DeferredObject<GameItem>(event.objects[0]));
+            break;
+        case ItemRemovedEventType:
+            this->ActionItemRemoved(DeferredObject<GameItem>(event.objects[0]));
+            break;
+        case ItemPaddleCollisionEventType:
+            this->ActionItemPaddleCollision(DeferredObject<GameItem>(event.objects[0]),
+                DeferredObject<PlayerPaddle>(event.objects[1]));
+            break;
+        case ItemActivatedEventType:
+            this->ActionItemActivated(DeferredObject<GameItem>(event.objects[0]));
+            break;
+        case ItemDeactivatedEventType:
+            this->ActionItemDeactivated(DeferredObject<GameItem>(event.objects[0]));
+            break;
+        case RandomItemActivatedEventType:
+            this->ActionRandomItemActivated(DeferredObject<RandomItem>(event.objects[0]),
+                DeferredObject<GameItem>(event.objects[1]));
+            break;
+        case ItemTimerStartedEventType:
+            this->ActionItemTimerStarted(DeferredObject<GameItemTimer>(event.objects[0]));
+            break;
+        case ItemTimerStoppedEventType:
+            this->ActionItemTimerStopped(DeferredObject<GameItemTimer>(event.objects[0]),
+                event.values[0] != 0);
+            break;
+        case ItemDropBlockItemChangeEventType:
+            this->ActionItemDropBlockItemChange(DeferredObject<ItemDropBlock>(event.objects[0]));
+            break;
+        case ItemDropBlockLockedEventType:
+            this->ActionItemDropBlockLocked(DeferredObject<ItemDropBlock>(event.objects[0]));
+            break;
+        case SwitchBlockActivatedEventType:
+            this->ActionSwitchBlockActivated(DeferredObject<SwitchBlock>(event.objects[0]));
+            break;
+        case BulletTimeStateChangedEventType:
+            this->ActionBulletTimeStateChanged(DeferredObject<BallBoostModel>(event.objects[0]));
+            break;
+        case BallBoostExecutedEventType:
+            this->ActionBallBoostExecuted(DeferredObject<BallBoostModel>(event.objects[0]));
+            break;
+        case BallBoostGainedEventType:
+            this->ActionBallBoostGained();
+            break;
+        case BallBoostLostEventType:
+            this->ActionBallBoostLost(event.values[0] != 0);
+            break;
+        case BallBoostUsedEventType:
+            this->ActionBallBoostUsed();
+            break;
+        case BoostFailedDueToNoBallsAvailableEventType:
+            this->ActionBoostFailedDueToNoBallsAvailable();
+            break;
+        case BallCameraSetOrUnsetEventType:
+            this->ActionBallCameraSetOrUnset(static_cast<const GameBall*>(event.objects[0]),
+                event.values[0] != 0, event.values[1] != 0);
+            break;
+        case BallCameraCannonRotationEventType:
+            this->ActionBallCameraCannonRotation(DeferredObject<GameBall>(event.objects[0]),
+                DeferredObject<CannonBlock>(event.objects[1]), event.values[0] != 0);
+            break;
+        case CantFireBallCamFromCannonEventType:
+            this->ActionCantFireBallCamFromCannon();
+            break;
+        case PaddleCameraSetOrUnsetEventType:
+            this->ActionPaddleCameraSetOrUnset(DeferredObject<PlayerPaddle>(event.objects[0]),
+                event.values[0] != 0);
+            break;
+        case ReleaseTimerStartedEventType:
+            this->ActionReleaseTimerStarted();
+            break;
+        case ProjectileSpawnedEventType:
+            this->ActionProjectileSpawned(DeferredObject<Projectile>(event.objects[0]));
+            break;
+        case ProjectileRemovedEventType:
+            this->ActionProjectileRemoved(DeferredObject<Projectile>(event.objects[0]));
+            break;
+        case RocketExplodedEventType:
+            this->ActionRocketExploded(DeferredObject<RocketProjectile>(event.objects[0]));
+            break;
+        case MineExplodedEventType:
+            this->ActionMineExploded(DeferredObject<MineProjectile>(event.objects[0]));
+            break;
+        case MineLandedEventType:
+            this->ActionMineLanded(DeferredObject<MineProjectile>(event.objects[0]));
+            break;
+        case RemoteControlRocketFuelWarningEventType:
+            this->ActionRemoteControlRocketFuelWarning(DeferredObject<PaddleRemoteControlRocketProjectile>(event.objects[0]));
+            break;
+        case RemoteControlRocketThrustAppliedEventType:
+            this->ActionRemoteControlRocketThrustApplied(DeferredObject<PaddleRemoteControlRocketProjectile>(event.objects[0]));
+            break;
+        case BeamSpawnedEventType:
+            this->ActionBeamSpawned(DeferredObject<Beam>(event.objects[0]));
+            break;
+        case BeamChangedEventType:
+            this->ActionBeamChanged(DeferredObject<Beam>(event.objects[0]));
+            break;
+        case BeamRemovedEventType:
+            this->ActionBeamRemoved(DeferredObject<Beam>(event.objects[0]));
+            break;
+        case TeslaLightningBarrierSpawnedEventType:
+            this->ActionTeslaLightningBarrierSpawned(DeferredObject<TeslaBlock>(event.objects[0]),
+                DeferredObject<TeslaBlock>(event.objects[1]));
+            break;
+        case TeslaLightningBarrierRemovedEventType:
+            this->ActionTeslaLightningBarrierRemoved(DeferredObject<TeslaBlock>(event.objects[0]),
+                DeferredObject<TeslaBlock>(event.objects[1]));
+            break;
+        case GameCompletedEventType:
+            this->ActionGameCompleted();
+            break;
+        case WorldStartedEventType:
+            this->ActionWorldStarted(DeferredObject<GameWorld>(event.objects[0]));
+            break;
+        case WorldCompletedEventType:
+            this->ActionWorldCompleted(DeferredObject<GameWorld>(event.objects[0]));
+            break;
+        case LevelStartedEventType:
+            this->ActionLevelStarted(DeferredObject<GameWorld>(event.objects[0]),
+                DeferredObject<GameLevel>(event.objects[1]));
+            break;
+        case LevelAlmostCompleteEventType:
+            this->ActionLevelAlmostComplete(DeferredObject<GameLevel>(event.objects[0]));
+            break;
+        case LevelCompletedEventType:
+            this->ActionLevelCompleted(DeferredObject<GameWorld>(event.objects[0]),
+                DeferredObject<GameLevel>(event.objects[1]), event.values[0], event.values[1]);
+            break;
+        case LevelResettingEventType:
+            this->ActionLevelResetting();
+            break;
+        case LivesChangedEventType:
+            this->ActionLivesChanged(event.values[0], event.values[1]);
+            break;
+        case BlockIceShatteredEventType:
+            this->ActionBlockIceShattered(DeferredObject<LevelPiece>(event.objects[0]));
+            break;
+        case BlockIceCancelledWithFireEventType:
+            this->ActionBlockIceCancelledWithFire(DeferredObject<LevelPiece>(event.objects[0]));
+            break;
+        case BlockFireCancelledWithIceEventType:
+            this->ActionBlockFireCancelledWithIce(DeferredObject<LevelPiece>(event.objects[0]));
+            break;
+        case PointNotificationEventType: {
+            const PointAward* pointAward = static_cast<const PointAward*>(event.objects[0]);
+            this->ActionPointNotification(*pointAward);
+            delete pointAward;
+            break;
+        }
+        case ScoreChangedEventType:
+            this->ActionScoreChanged(event.values[0]);
+            break;
+        case ScoreMultiplierCounterChangedEventType:
+            this->ActionScoreMultiplierCounterChanged(event.values[0], event.values[1]);
+            break;
+        case ScoreMultiplierChangedEventType:
+            this->ActionScoreMultiplierChanged(event.values[0], event.values[1],
+                Point2D(event.coords[0], event.coords[1]));
+            break;
+        case NumStarsChangedEventType: {
+            const PointAward* pointAward = static_cast<const PointAward*>(event.objects[0]);
+            this->ActionNumStarsChanged(pointAward, event.values[0], event.values[1]);
+            delete pointAward;
+            break;
+        }
+        case DifficultyChangedEventType:
+            this->ActionDifficultyChanged(event.values[0]);
+            break;
+        case LaserTurretAIStateChangedEventType:
+            this->ActionLaserTurretAIStateChanged(DeferredObject<LaserTurretBlock>(event.objects[0]),
+                static_cast<LaserTurretBlock::TurretAIState>(event.values[0]),
+                static_cast<LaserTurretBlock::TurretAIState>(event.values[1]));
+            break;
+        case LaserFiredByTurretEventType:
+            this->ActionLaserFiredByTurret(DeferredObject<LaserTurretBlock>(event.objects[0]));
+            break;
+        case RocketTurretAIStateChangedEventType:
+            this->ActionRocketTurretAIStateChanged(DeferredObject<RocketTurretBlock>(event.objects[0]),
+                static_cast<RocketTurretBlock::TurretAIState>(event.values[0]),
+                static_cast<RocketTurretBlock::TurretAIState>(event.values[1]));
+            break;
+        case RocketFiredByTurretEventType:
+            this->ActionRocketFiredByTurret(DeferredObject<RocketTurretBlock>(event.objects[0]));
+            break;
+        case MineTurretAIStateChangedEventType:
+            this->ActionMineTurretAIStateChanged(DeferredObject<MineTurretBlock>(event.objects[0]),
+                static_cast<MineTurretBlock::TurretAIState>(event.values[0]),
+                static_cast<MineTurretBlock::TurretAIState>(event.values[1]));
+            break;
+        case MineFiredByTurretEventType:
+            this->ActionMineFiredByTurret(DeferredObject<MineTurretBlock>(event.objects[0]));
+            break;
+        case RegenBlockLifeChangedEventType:
+            this->ActionRegenBlockLifeChanged(DeferredObject<RegenBlock>(event.objects[0]), event.coords[0]);
+            break;
+        case RegenBlockPreturbedEventType:
+            this->ActionRegenBlockPreturbed(DeferredObject<RegenBlock>(event.objects[0]));
+            break;
+        case BossHurtEventType:
+            this->ActionBossHurt(static_cast<const BossWeakpoint*>(event.objects[0]));
+            break;
+        case BossAngryEventType:
+            // The value says whether the angry part was recorded as a body part or as its location and size
+            if (event.values[0] == 0) {
+                this->ActionBossAngry(static_cast<const Boss*>(event.objects[0]),
+                    static_cast<const BossBodyPart*>(event.objects[1]));
+            }
+            else {
+                this->ActionBossAngry(static_cast<const Boss*>(event.objects[0]),
+                    Point2D(event.coords[0], event.coords[1]), event.coords[2], event.coords[3]);
+            }
+            break;
+        case ClearActiveBossEffectsEventType:
+            this->ActionClearActiveBossEffects();
+            break;
+        case GeneralEffectEventType: {
+            const GeneralEffectEventInfo* effectEvent = static_cast<const GeneralEffectEventInfo*>(event.objects[0]);
+            this->ActionGeneralEffect(*effectEvent);
+            delete effectEvent;
+            break;
+        }
+        case BossEffectEventType: {
+            const BossEffectEventInfo* effectEvent = static_cast<const BossEffectEventInfo*>(event.objects[0]);
+            this->ActionBossEffect(*effectEvent);
+            delete effectEvent;
+            break;
+        }
+        default:
+            assert(false);
+            break;
+    }
+}
+
+GameEventManager::EventDispatchScope::EventDispatchScope(GameEventManager* manager, EventType type) :
+stats(manager->eventStats[type]), isTimed(manager->isTimingDispatches), startTimeInSecs(0.0) {
+    // Anything recorded happened before this event, it needs to be heard about first
+    if (!manager->isDispatchingDeferred && manager->HasDeferredEvents()) {
+        manager->DispatchDeferredEvents();
+    }
+    this->stats.numDispatched++;
+    if (this->isTimed) {
+        this->startTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs();
+    }
+}
+
+GameEventManager::EventDispatchScope::~EventDispatchScope() {
+    if (this->isTimed) {
+        this->stats.totalDispatchTimeInSecs += BlammoTime::GetHighResolutionTimeInSecs() - this->startTimeInSecs;
+    }
+}
+
 // Action for when the player paddle hits a wall
 void GameEventManager::ActionPaddleHitWall(const PlayerPaddle& paddle, const Point2D& hitLoc) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(PaddleHitWallEventType);
+		event.objects[0] = &paddle;
+		event.coords[0] = hitLoc[0];
+		event.coords[1] = hitLoc[1];
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, PaddleHitWallEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->PaddleHitWallEvent(paddle, hitLoc);
@@ -77,6 +793,15 @@ void GameEventManager::ActionPaddleHitWall(const PlayerPaddle& paddle, const Poi
 }
 
 void GameEventManager::ActionPaddlePortalBlockTeleport(const PlayerPaddle& paddle, const PortalBlock& enterPortal) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(PaddlePortalBlockTeleportEventType);
+        event.objects[0] = &paddle;
+        event.objects[1] = &enterPortal;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, PaddlePortalBlockTeleportEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->PaddlePortalBlockTeleportEvent(paddle, enterPortal);
@@ -85,6 +810,15 @@ void GameEventManager::ActionPaddlePortalBlockTeleport(const PlayerPaddle& paddl
 
 // Action for when the player paddle is hit by a projectile
 void GameEventManager::ActionPaddleHitByProjectile(const PlayerPaddle& paddle, const Projectile& projectile) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(PaddleHitByProjectileEventType);
+		event.objects[0] = &paddle;
+		event.objects[1] = &projectile;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, PaddleHitByProjectileEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->PaddleHitByProjectileEvent(paddle, projectile);
@@ -93,6 +827,15 @@ void GameEventManager::ActionPaddleHitByProjectile(const PlayerPaddle& paddle, c
 
 // Action for when the player paddle shield is hit by a projectile
 void GameEventManager::ActionPaddleShieldHitByProjectile(const PlayerPaddle& paddle, const Projectile& projectile) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(PaddleShieldHitByProjectileEventType);
+		event.objects[0] = &paddle;
+		event.objects[1] = &projectile;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, PaddleShieldHitByProjectileEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->PaddleShieldHitByProjectileEvent(paddle, projectile);
@@ -101,6 +844,15 @@ void GameEventManager::ActionPaddleShieldHitByProjectile(const PlayerPaddle& pad
 
 // Action for when the player paddle shield deflects a projectile
 void GameEventManager::ActionProjectileDeflectedByPaddleShield(const Projectile& projectile, const PlayerPaddle& paddle) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(ProjectileDeflectedByPaddleShieldEventType);
+		event.objects[0] = &projectile;
+		event.objects[1] = &paddle;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ProjectileDeflectedByPaddleShieldEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ProjectileDeflectedByPaddleShieldEvent(projectile, paddle);
@@ -108,6 +860,16 @@ void GameEventManager::ActionProjectileDeflectedByPaddleShield(const Projectile&
 }
 
 void GameEventManager::ActionPaddleHitByBeam(const PlayerPaddle& paddle, const Beam& beam, const BeamSegment& beamSegment) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(PaddleHitByBeamEventType);
+        event.objects[0] = &paddle;
+        event.objects[1] = &beam;
+        event.objects[2] = beamSegment.Clone();
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, PaddleHitByBeamEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->PaddleHitByBeamEvent(paddle, beam, beamSegment);
@@ -115,6 +877,16 @@ void GameEventManager::ActionPaddleHitByBeam(const PlayerPaddle& paddle, const B
 }
 
 void GameEventManager::ActionPaddleShieldHitByBeam(const PlayerPaddle& paddle, const Beam& beam, const BeamSegment& beamSegment) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(PaddleShieldHitByBeamEventType);
+        event.objects[0] = &paddle;
+        event.objects[1] = &beam;
+        event.objects[2] = beamSegment.Clone();
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, PaddleShieldHitByBeamEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->PaddleShieldHitByBeamEvent(paddle, beam, beamSegment);
@@ -122,6 +894,15 @@ void GameEventManager::ActionPaddleShieldHitByBeam(const PlayerPaddle& paddle, c
 }
 
 void GameEventManager::ActionPaddleHitByBoss(const PlayerPaddle& paddle, const BossBodyPart& bossPart) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(PaddleHitByBossEventType);
+        event.objects[0] = &paddle;
+        event.objects[1] = &bossPart;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, PaddleHitByBossEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->PaddleHitByBossEvent(paddle, bossPart);
@@ -131,6 +912,16 @@ void GameEventManager::ActionPaddleHitByBoss(const PlayerPaddle& paddle, const B
 void GameEventManager::ActionPaddleStatusUpdate(const PlayerPaddle& paddle, 
                                                 PlayerPaddle::PaddleSpecialStatus status, bool isActive) {
 
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(PaddleStatusUpdateEventType);
+        event.objects[0] = &paddle;
+        event.values[0] = status;
+        event.values[1] = isActive ? 1 : 0;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, PaddleStatusUpdateEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->PaddleStatusUpdateEvent(paddle, status, isActive);
@@ -138,6 +929,14 @@ void GameEventManager::ActionPaddleStatusUpdate(const PlayerPaddle& paddle,
 }
 
 void GameEventManager::ActionFrozenPaddleCanceledByFire(const PlayerPaddle& paddle) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(FrozenPaddleCanceledByFireEventType);
+        event.objects[0] = &paddle;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, FrozenPaddleCanceledByFireEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->FrozenPaddleCanceledByFireEvent(paddle);
@@ -145,6 +944,14 @@ void GameEventManager::ActionFrozenPaddleCanceledByFire(const PlayerPaddle& padd
 }
 
 void GameEventManager::ActionOnFirePaddleCanceledByIce(const PlayerPaddle& paddle) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(OnFirePaddleCanceledByIceEventType);
+        event.objects[0] = &paddle;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, OnFirePaddleCanceledByIceEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->OnFirePaddleCanceledByIceEvent(paddle);
@@ -152,6 +959,15 @@ void GameEventManager::ActionOnFirePaddleCanceledByIce(const PlayerPaddle& paddl
 }
 
 void GameEventManager::ActionPaddleFlipped(const PlayerPaddle& paddle, bool isUpsideDown) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(PaddleFlippedEventType);
+        event.objects[0] = &paddle;
+        event.values[0] = isUpsideDown ? 1 : 0;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, PaddleFlippedEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->PaddleFlippedEvent(paddle, isUpsideDown);
@@ -160,6 +976,14 @@ void GameEventManager::ActionPaddleFlipped(const PlayerPaddle& paddle, bool isUp
 
 // Action for when a ball has died (gone out of bounds)
 void GameEventManager::ActionBallDied(const GameBall& deadBall) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallDiedEventType);
+		event.objects[0] = &deadBall;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallDiedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallDiedEvent(deadBall);
@@ -168,6 +992,14 @@ void GameEventManager::ActionBallDied(const GameBall& deadBall) {
 
 // Action for when the last ball left is about to die - (before its spiraling death animations and explosion)
 void GameEventManager::ActionLastBallAboutToDie(const GameBall& ballAboutToDie) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(LastBallAboutToDieEventType);
+		event.objects[0] = &ballAboutToDie;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LastBallAboutToDieEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LastBallAboutToDieEvent(ballAboutToDie);
@@ -176,6 +1008,15 @@ void GameEventManager::ActionLastBallAboutToDie(const GameBall& ballAboutToDie)
 
 // Action for when the last ball is exploding
 void GameEventManager::ActionLastBallExploded(const GameBall& explodedBall, bool wasSkipped) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(LastBallExplodedEventType);
+		event.objects[0] = &explodedBall;
+		event.values[0] = wasSkipped ? 1 : 0;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LastBallExplodedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LastBallExplodedEvent(explodedBall, wasSkipped);
@@ -184,6 +1025,14 @@ void GameEventManager::ActionLastBallExploded(const GameBall& explodedBall, bool
 
 // Action for when the all balls have died (gone out of bounds)
 void GameEventManager::ActionAllBallsDead(int livesLeft) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(AllBallsDeadEventType);
+		event.values[0] = livesLeft;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, AllBallsDeadEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->AllBallsDeadEvent(livesLeft);
@@ -192,6 +1041,14 @@ void GameEventManager::ActionAllBallsDead(int livesLeft) {
 
 // Action for when the ball respawns on the player paddle
 void GameEventManager::ActionBallSpawn(const GameBall& spawnBall) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallSpawnEventType);
+		event.objects[0] = &spawnBall;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallSpawnEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallSpawnEvent(spawnBall);
@@ -200,6 +1057,14 @@ void GameEventManager::ActionBallSpawn(const GameBall& spawnBall) {
 
 // Action for when the ball is being shot off the player paddle
 void GameEventManager::ActionBallShot(const GameBall& shotBall) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallShotEventType);
+		event.objects[0] = &shotBall;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallShotEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallShotEvent(shotBall);
@@ -208,6 +1073,14 @@ void GameEventManager::ActionBallShot(const GameBall& shotBall) {
 
 // Action for when a weapon is fired from the paddle
 void GameEventManager::ActionPaddleWeaponFired(PlayerPaddle::PaddleType weaponType) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(PaddleWeaponFiredEventType);
+		event.values[0] = static_cast<int>(weaponType);
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, PaddleWeaponFiredEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->PaddleWeaponFiredEvent(weaponType);
@@ -216,6 +1089,15 @@ void GameEventManager::ActionPaddleWeaponFired(PlayerPaddle::PaddleType weaponTy
 
 // Action for when a projectile collides with a block in the level
 void GameEventManager::ActionProjectileBlockCollision(const Projectile& projectile, const LevelPiece& block) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(ProjectileBlockCollisionEventType);
+		event.objects[0] = &projectile;
+		event.objects[1] = &block;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ProjectileBlockCollisionEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ProjectileBlockCollisionEvent(projectile, block);
@@ -223,6 +1105,15 @@ void GameEventManager::ActionProjectileBlockCollision(const Projectile& projecti
 }
 
 void GameEventManager::ActionProjectileSafetyNetCollision(const Projectile& projectile, const SafetyNet& safetyNet) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ProjectileSafetyNetCollisionEventType);
+		event.objects[0] = &projectile;
+		event.objects[1] = &safetyNet;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ProjectileSafetyNetCollisionEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ProjectileSafetyNetCollisionEvent(projectile, safetyNet);
@@ -231,6 +1122,16 @@ void GameEventManager::ActionProjectileSafetyNetCollision(const Projectile& proj
 
 void GameEventManager::ActionProjectileBossCollision(const Projectile& projectile, const Boss& boss,
                                                      const BossBodyPart& collisionPart) {
+     if (this->IsDeferringAll()) {
+         DeferredEvent event(ProjectileBossCollisionEventType);
+         event.objects[0] = &projectile;
+         event.objects[1] = &boss;
+         event.objects[2] = &collisionPart;
+         this->DeferEvent(event);
+         return;
+     }
+
+     EventDispatchScope dispatchScope(this, ProjectileBossCollisionEventType);
      std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
      for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
          (*listenerIter)->ProjectileBossCollisionEvent(projectile, boss, collisionPart);
@@ -238,6 +1139,15 @@ void GameEventManager::ActionProjectileBossCollision(const Projectile& projectil
 }
 
 void GameEventManager::ActionProjectileBallCollision(const Projectile& projectile, const GameBall& ball) {
+    if (this->IsDeferring()) {
+        DeferredEvent event(ProjectileBallCollisionEventType);
+        event.objects[0] = &projectile;
+        event.objects[1] = &ball;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, ProjectileBallCollisionEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->ProjectileBallCollisionEvent(projectile, ball);
@@ -246,6 +1156,15 @@ void GameEventManager::ActionProjectileBallCollision(const Projectile& projectil
 
 // Action for when the ball collides with a block in the level
 void GameEventManager::ActionBallBlockCollision(const GameBall& ball, const LevelPiece& block) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(BallBlockCollisionEventType);
+		event.objects[0] = &ball;
+		event.objects[1] = &block;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallBlockCollisionEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallBlockCollisionEvent(ball, block);
@@ -254,6 +1173,15 @@ void GameEventManager::ActionBallBlockCollision(const GameBall& ball, const Leve
 
 // Action for when the ball enters a portal block
 void GameEventManager::ActionBallPortalBlockTeleport(const GameBall& ball, const PortalBlock& enterPortal) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallPortalBlockTeleportEventType);
+		event.objects[0] = &ball;
+		event.objects[1] = &enterPortal;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallPortalBlockTeleportEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallPortalBlockTeleportEvent(ball, enterPortal);
@@ -261,6 +1189,15 @@ void GameEventManager::ActionBallPortalBlockTeleport(const GameBall& ball, const
 }
 
 void GameEventManager::ActionBallPortalProjectileTeleport(const GameBall& ball, const PortalProjectile& enterPortalProjectile) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(BallPortalProjectileTeleportEventType);
+        event.objects[0] = &ball;
+        event.objects[1] = &enterPortalProjectile;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, BallPortalProjectileTeleportEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->BallPortalProjectileTeleportEvent(ball, enterPortalProjectile);
@@ -270,6 +1207,15 @@ void GameEventManager::ActionBallPortalProjectileTeleport(const GameBall& ball,
 void GameEventManager::ActionProjectilePortalProjectileTeleport(const Projectile& projectile, 
                                                                 const PortalProjectile& enterPortalProjectile) {
 
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(ProjectilePortalProjectileTeleportEventType);
+        event.objects[0] = &projectile;
+        event.objects[1] = &enterPortalProjectile;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, ProjectilePortalProjectileTeleportEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->ProjectilePortalProjectileTeleportEvent(projectile, enterPortalProjectile);
@@ -277,6 +1223,15 @@ void GameEventManager::ActionProjectilePortalProjectileTeleport(const Projectile
 }
 
 void GameEventManager::ActionProjectilePortalBlockTeleport(const Projectile& projectile, const PortalBlock& enterPortal) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ProjectilePortalBlockTeleportEventType);
+		event.objects[0] = &projectile;
+		event.objects[1] = &enterPortal;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ProjectilePortalBlockTeleportEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ProjectilePortalBlockTeleportEvent(projectile, enterPortal);
@@ -284,6 +1239,15 @@ void GameEventManager::ActionProjectilePortalBlockTeleport(const Projectile& pro
 }
 
 void GameEventManager::ActionItemPortalBlockTeleport(const GameItem& item, const PortalBlock& enterPortal) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(ItemPortalBlockTeleportEventType);
+        event.objects[0] = &item;
+        event.objects[1] = &enterPortal;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, ItemPortalBlockTeleportEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->ItemPortalBlockTeleportEvent(item, enterPortal);
@@ -293,6 +1257,16 @@ void GameEventManager::ActionItemPortalBlockTeleport(const GameItem& item, const
 // Action when a ball enters a cannon block
 void GameEventManager::ActionBallEnteredCannon(const GameBall& ball, const CannonBlock& cannonBlock, 
                                                bool canShootWithoutObstruction) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallEnteredCannonEventType);
+		event.objects[0] = &ball;
+		event.objects[1] = &cannonBlock;
+		event.values[0] = canShootWithoutObstruction ? 1 : 0;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallEnteredCannonEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallEnteredCannonEvent(ball, cannonBlock, canShootWithoutObstruction);
@@ -301,6 +1275,15 @@ void GameEventManager::ActionBallEnteredCannon(const GameBall& ball, const Canno
 
 // Action for when the ball is fired from a cannon block
 void GameEventManager::ActionBallFiredFromCannon(const GameBall& ball, const CannonBlock& cannonBlock) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallFiredFromCannonEventType);
+		event.objects[0] = &ball;
+		event.objects[1] = &cannonBlock;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallFiredFromCannonEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallFiredFromCannonEvent(ball, cannonBlock);
@@ -309,6 +1292,15 @@ void GameEventManager::ActionBallFiredFromCannon(const GameBall& ball, const Can
 
 // Action for when a rocket enters/is loaded into a cannon block
 void GameEventManager::ActionProjectileEnteredCannon(const Projectile& projectile, const CannonBlock& cannonBlock) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ProjectileEnteredCannonEventType);
+		event.objects[0] = &projectile;
+		event.objects[1] = &cannonBlock;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ProjectileEnteredCannonEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ProjectileEnteredCannonEvent(projectile, cannonBlock);
@@ -317,6 +1309,15 @@ void GameEventManager::ActionProjectileEnteredCannon(const Projectile& projectil
 
 // Action for when the rocket is fired from a cannon block
 void GameEventManager::ActionProjectileFiredFromCannon(const Projectile& projectile, const CannonBlock& cannonBlock) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ProjectileFiredFromCannonEventType);
+		event.objects[0] = &projectile;
+		event.objects[1] = &cannonBlock;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ProjectileFiredFromCannonEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ProjectileFiredFromCannonEvent(projectile, cannonBlock);
@@ -325,6 +1326,14 @@ void GameEventManager::ActionProjectileFiredFromCannon(const Projectile& project
 
 // Action for when the ball hits a lightning arc between two tesla blocks
 void GameEventManager::ActionBallHitTeslaLightningArc(const GameBall& ball) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(BallHitTeslaLightningArcEventType);
+		event.objects[0] = &ball;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallHitTeslaLightningArcEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallHitTeslaLightningArcEvent(ball);
@@ -332,6 +1341,15 @@ void GameEventManager::ActionBallHitTeslaLightningArc(const GameBall& ball) {
 }
 
 void GameEventManager::ActionGamePauseStateChanged(int32_t oldPauseState, int32_t newPauseState) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(GamePauseStateChangedEventType);
+        event.values[0] = oldPauseState;
+        event.values[1] = newPauseState;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, GamePauseStateChangedEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->GamePauseStateChangedEvent(oldPauseState, newPauseState);
@@ -340,6 +1358,14 @@ void GameEventManager::ActionGamePauseStateChanged(int32_t oldPauseState, int32_
 
 // Action for when a fireball is canceled by the player acquiring an iceball item
 void GameEventManager::ActionFireBallCanceledByIceBall(const GameBall& ball) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(FireBallCanceledByIceBallEventType);
+		event.objects[0] = &ball;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, FireBallCanceledByIceBallEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->FireBallCanceledByIceBallEvent(ball);
@@ -348,6 +1374,14 @@ void GameEventManager::ActionFireBallCanceledByIceBall(const GameBall& ball) {
 
 // Action for when an iceball is canceled by the player acquiring a fireball item
 void GameEventManager::ActionIceBallCanceledByFireBall(const GameBall& ball) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(IceBallCanceledByFireBallEventType);
+		event.objects[0] = &ball;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, IceBallCanceledByFireBallEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->IceBallCanceledByFireBallEvent(ball);
@@ -355,6 +1389,14 @@ void GameEventManager::ActionIceBallCanceledByFireBall(const GameBall& ball) {
 }
 
 void GameEventManager::ActionPaddleIceBlasterCanceledByFireBlaster(const PlayerPaddle& paddle) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(PaddleIceBlasterCanceledByFireBlasterEventType);
+        event.objects[0] = &paddle;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, PaddleIceBlasterCanceledByFireBlasterEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->PaddleIceBlasterCanceledByFireBlasterEvent(paddle);
@@ -362,6 +1404,14 @@ void GameEventManager::ActionPaddleIceBlasterCanceledByFireBlaster(const PlayerP
 }
 
 void GameEventManager::ActionPaddleFireBlasterCanceledByIceBlaster(const PlayerPaddle& paddle) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(PaddleFireBlasterCanceledByIceBlasterEventType);
+        event.objects[0] = &paddle;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, PaddleFireBlasterCanceledByIceBlasterEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->PaddleFireBlasterCanceledByIceBlasterEvent(paddle);
@@ -370,6 +1420,16 @@ void GameEventManager::ActionPaddleFireBlasterCanceledByIceBlaster(const PlayerP
 
 // Action for when the ball collides with the player paddle
 void GameEventManager::ActionBallPaddleCollision(const GameBall& ball, const PlayerPaddle& paddle, bool hitPaddleUnderside) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(BallPaddleCollisionEventType);
+		event.objects[0] = &ball;
+		event.objects[1] = &paddle;
+		event.values[0] = hitPaddleUnderside ? 1 : 0;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallPaddleCollisionEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallPaddleCollisionEvent(ball, paddle, hitPaddleUnderside);
@@ -378,6 +1438,15 @@ void GameEventManager::ActionBallPaddleCollision(const GameBall& ball, const Pla
 
 // Action for when a ball collides with another ball
 void GameEventManager::ActionBallBallCollision(const GameBall& ball1, const GameBall& ball2) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(BallBallCollisionEventType);
+		event.objects[0] = &ball1;
+		event.objects[1] = &ball2;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallBallCollisionEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallBallCollisionEvent(ball1, ball2);
@@ -385,6 +1454,16 @@ void GameEventManager::ActionBallBallCollision(const GameBall& ball1, const Game
 }
 
 void GameEventManager::ActionBallBossCollision(GameBall& ball, const Boss& boss, const BossBodyPart& bossPart) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(BallBossCollisionEventType);
+        event.objects[0] = &ball;
+        event.objects[1] = &boss;
+        event.objects[2] = &bossPart;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, BallBossCollisionEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->BallBossCollisionEvent(ball, boss, bossPart);
@@ -393,6 +1472,15 @@ void GameEventManager::ActionBallBossCollision(GameBall& ball, const Boss& boss,
 
 // Action for when a block is destroyed
 void GameEventManager::ActionBlockDestroyed(const LevelPiece& block, const LevelPiece::DestructionMethod& method) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(BlockDestroyedEventType);
+		event.objects[0] = &block;
+		event.values[0] = static_cast<int>(method);
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BlockDestroyedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BlockDestroyedEvent(block, method);
@@ -400,6 +1488,14 @@ void GameEventManager::ActionBlockDestroyed(const LevelPiece& block, const Level
 }
 
 void GameEventManager::ActionBallSafetyNetCreated(bool bottomSafetyNet) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallSafetyNetCreatedEventType);
+		event.values[0] = bottomSafetyNet ? 1 : 0;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallSafetyNetCreatedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallSafetyNetCreatedEvent(bottomSafetyNet);
@@ -408,18 +1504,48 @@ void GameEventManager::ActionBallSafetyNetCreated(bool bottomSafetyNet) {
 
 // Action for when the ball safety net is destroyed
 void GameEventManager::ActionBallSafetyNetDestroyed(const GameBall& ball, bool bottomSafetyNet) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallSafetyNetDestroyedEventType);
+		event.objects[0] = &ball;
+		event.values[0] = bottomSafetyNet ? 1 : 0;
+		event.values[1] = 0;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallSafetyNetDestroyedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallSafetyNetDestroyedEvent(ball, bottomSafetyNet);
 	}	
 }
 void GameEventManager::ActionBallSafetyNetDestroyed(const PlayerPaddle& paddle, bool bottomSafetyNet) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallSafetyNetDestroyedEventType);
+		event.objects[0] = &paddle;
+		event.values[0] = bottomSafetyNet ? 1 : 0;
+		event.values[1] = 1;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallSafetyNetDestroyedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallSafetyNetDestroyedEvent(paddle, bottomSafetyNet);
 	}	
 }
 void GameEventManager::ActionBallSafetyNetDestroyed(const Projectile& projectile, bool bottomSafetyNet) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallSafetyNetDestroyedEventType);
+		event.objects[0] = &projectile;
+		event.values[0] = bottomSafetyNet ? 1 : 0;
+		event.values[1] = 2;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallSafetyNetDestroyedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallSafetyNetDestroyedEvent(projectile, bottomSafetyNet);
@@ -428,6 +1554,15 @@ void GameEventManager::ActionBallSafetyNetDestroyed(const Projectile& projectile
 
 // Action for when a level piece changes
 void GameEventManager::ActionLevelPieceChanged(const LevelPiece& pieceBefore, const LevelPiece& pieceAfter) {
+	if ((this->IsDeferring() && &pieceBefore == &pieceAfter) || this->IsDeferringAll()) {
+		DeferredEvent event(LevelPieceChangedEventType);
+		event.objects[0] = &pieceBefore;
+		event.objects[1] = &pieceAfter;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LevelPieceChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LevelPieceChangedEvent(pieceBefore, pieceAfter);
@@ -436,6 +1571,15 @@ void GameEventManager::ActionLevelPieceChanged(const LevelPiece& pieceBefore, co
 
 // Action for when a level piece has a status added to it
 void GameEventManager::ActionLevelPieceStatusAdded(const LevelPiece& piece, const LevelPiece::PieceStatus& addedStatus) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(LevelPieceStatusAddedEventType);
+		event.objects[0] = &piece;
+		event.values[0] = static_cast<int>(addedStatus);
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LevelPieceStatusAddedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LevelPieceStatusAddedEvent(piece, addedStatus);
@@ -444,6 +1588,15 @@ void GameEventManager::ActionLevelPieceStatusAdded(const LevelPiece& piece, cons
 
 // Action for when a level piece has a status removed from it
 void GameEventManager::ActionLevelPieceStatusRemoved(const LevelPiece& piece, const LevelPiece::PieceStatus& removedStatus) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(LevelPieceStatusRemovedEventType);
+		event.objects[0] = &piece;
+		event.values[0] = static_cast<int>(removedStatus);
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LevelPieceStatusRemovedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LevelPieceStatusRemovedEvent(piece, removedStatus);
@@ -452,6 +1605,14 @@ void GameEventManager::ActionLevelPieceStatusRemoved(const LevelPiece& piece, co
 
 // Action for when a level piece has all its status removed from it
 void GameEventManager::ActionLevelPieceAllStatusRemoved(const LevelPiece& piece) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(LevelPieceAllStatusRemovedEventType);
+		event.objects[0] = &piece;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LevelPieceAllStatusRemovedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LevelPieceAllStatusRemovedEvent(piece);
@@ -463,6 +1624,17 @@ void GameEventManager::ActionCollateralBlockChangedState(const CollateralBlock&
                                                          CollateralBlock::CollateralBlockState oldState, 
                                                          CollateralBlock::CollateralBlockState newState) {
 
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(CollateralBlockChangedStateEventType);
+        event.objects[0] = &collateralBlock;
+        event.objects[1] = &projectile;
+        event.values[0] = oldState;
+        event.values[1] = newState;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, CollateralBlockChangedStateEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->CollateralBlockChangedStateEvent(collateralBlock, projectile, oldState, newState);
@@ -471,6 +1643,14 @@ void GameEventManager::ActionCollateralBlockChangedState(const CollateralBlock&
 
 // Action for when a new item is spawned in the game
 void GameEventManager::ActionItemSpawned(const GameItem& item) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ItemSpawnedEventType);
+		event.objects[0] = &item;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ItemSpawnedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ItemSpawnedEvent(item);
@@ -479,6 +1659,14 @@ void GameEventManager::ActionItemSpawned(const GameItem& item) {
 
 // Action for when an item is removed from dropping
 void GameEventManager::ActionItemRemoved(const GameItem& item) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ItemRemovedEventType);
+		event.objects[0] = &item;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ItemRemovedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ItemRemovedEvent(item);
@@ -487,6 +1675,15 @@ void GameEventManager::ActionItemRemoved(const GameItem& item) {
 
 // Action for when an item and the player paddle collide
 void GameEventManager::ActionItemPaddleCollision(const GameItem& item, const PlayerPaddle& paddle) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ItemPaddleCollisionEventType);
+		event.objects[0] = &item;
+		event.objects[1] = &paddle;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ItemPaddleCollisionEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ItemPaddleCollsionEvent(item, paddle);
@@ -495,6 +1692,14 @@ void GameEventManager::ActionItemPaddleCollision(const GameItem& item, const Pla
 
 // Action for whan an item is activated (i.e, collected by the player paddle)
 void GameEventManager::ActionItemActivated(const GameItem& item) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ItemActivatedEventType);
+		event.objects[0] = &item;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ItemActivatedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ItemActivatedEvent(item);
@@ -503,6 +1708,14 @@ void GameEventManager::ActionItemActivated(const GameItem& item) {
 
 // Action for when an item deactivates (runs out of time or effect is spent)
 void GameEventManager::ActionItemDeactivated(const GameItem& item) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ItemDeactivatedEventType);
+		event.objects[0] = &item;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ItemDeactivatedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ItemDeactivatedEvent(item);
@@ -511,6 +1724,15 @@ void GameEventManager::ActionItemDeactivated(const GameItem& item) {
 
 // Action for when a random item is activated
 void GameEventManager::ActionRandomItemActivated(const RandomItem& randomItem, const GameItem& actualItem) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(RandomItemActivatedEventType);
+		event.objects[0] = &randomItem;
+		event.objects[1] = &actualItem;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, RandomItemActivatedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->RandomItemActivatedEvent(randomItem, actualItem);
@@ -519,6 +1741,14 @@ void GameEventManager::ActionRandomItemActivated(const RandomItem& randomItem, c
 
 // Action for when an item timer starts
 void GameEventManager::ActionItemTimerStarted(const GameItemTimer& itemTimer) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ItemTimerStartedEventType);
+		event.objects[0] = &itemTimer;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ItemTimerStartedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ItemTimerStartedEvent(itemTimer);
@@ -527,6 +1757,15 @@ void GameEventManager::ActionItemTimerStarted(const GameItemTimer& itemTimer) {
 
 // Action for when an item timer stops/expires
 void GameEventManager::ActionItemTimerStopped(const GameItemTimer& itemTimer, bool didExpire) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ItemTimerStoppedEventType);
+		event.objects[0] = &itemTimer;
+		event.values[0] = didExpire ? 1 : 0;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ItemTimerStoppedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ItemTimerStoppedEvent(itemTimer, didExpire);
@@ -535,6 +1774,14 @@ void GameEventManager::ActionItemTimerStopped(const GameItemTimer& itemTimer, bo
 
 // Action for when the item drop block's drop item type changes
 void GameEventManager::ActionItemDropBlockItemChange(const ItemDropBlock& dropBlock) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ItemDropBlockItemChangeEventType);
+		event.objects[0] = &dropBlock;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ItemDropBlockItemChangeEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ItemDropBlockItemChangeEvent(dropBlock);
@@ -542,6 +1789,14 @@ void GameEventManager::ActionItemDropBlockItemChange(const ItemDropBlock& dropBl
 }
 
 void GameEventManager::ActionItemDropBlockLocked(const ItemDropBlock& dropBlock) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(ItemDropBlockLockedEventType);
+        event.objects[0] = &dropBlock;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, ItemDropBlockLockedEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->ItemDropBlockLockedEvent(dropBlock);
@@ -550,6 +1805,14 @@ void GameEventManager::ActionItemDropBlockLocked(const ItemDropBlock& dropBlock)
 
 // Action for when a switch block is initially turned on
 void GameEventManager::ActionSwitchBlockActivated(const SwitchBlock& switchBlock) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(SwitchBlockActivatedEventType);
+		event.objects[0] = &switchBlock;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, SwitchBlockActivatedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->SwitchBlockActivatedEvent(switchBlock);
@@ -558,6 +1821,14 @@ void GameEventManager::ActionSwitchBlockActivated(const SwitchBlock& switchBlock
 
 // Action for when the bullet time state changes
 void GameEventManager::ActionBulletTimeStateChanged(const BallBoostModel& boostModel) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BulletTimeStateChangedEventType);
+		event.objects[0] = &boostModel;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BulletTimeStateChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BulletTimeStateChangedEvent(boostModel);
@@ -566,6 +1837,14 @@ void GameEventManager::ActionBulletTimeStateChanged(const BallBoostModel& boostM
 
 // Action for when the ball is boosted
 void GameEventManager::ActionBallBoostExecuted(const BallBoostModel& boostModel) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallBoostExecutedEventType);
+		event.objects[0] = &boostModel;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallBoostExecutedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallBoostExecutedEvent(boostModel);
@@ -574,6 +1853,13 @@ void GameEventManager::ActionBallBoostExecuted(const BallBoostModel& boostModel)
 
 // Action for when a boost is gained
 void GameEventManager::ActionBallBoostGained() {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallBoostGainedEventType);
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallBoostGainedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallBoostGainedEvent();
@@ -582,6 +1868,14 @@ void GameEventManager::ActionBallBoostGained() {
 
 // Action for when a boost is lost
 void GameEventManager::ActionBallBoostLost(bool allBoostsLost) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallBoostLostEventType);
+		event.values[0] = allBoostsLost ? 1 : 0;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallBoostLostEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallBoostLostEvent(allBoostsLost);
@@ -589,6 +1883,13 @@ void GameEventManager::ActionBallBoostLost(bool allBoostsLost) {
 }
 
 void GameEventManager::ActionBallBoostUsed() {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BallBoostUsedEventType);
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BallBoostUsedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BallBoostUsedEvent();
@@ -596,6 +1897,13 @@ void GameEventManager::ActionBallBoostUsed() {
 }
 
 void GameEventManager::ActionBoostFailedDueToNoBallsAvailable() {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(BoostFailedDueToNoBallsAvailableEventType);
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, BoostFailedDueToNoBallsAvailableEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->BoostFailedDueToNoBallsAvailableEvent();
@@ -603,6 +1911,16 @@ void GameEventManager::ActionBoostFailedDueToNoBallsAvailable() {
 }
 
 void GameEventManager::ActionBallCameraSetOrUnset(const GameBall* ball, bool isSet, bool canShootWithoutObstruction) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(BallCameraSetOrUnsetEventType);
+        event.objects[0] = ball;
+        event.values[0] = isSet ? 1 : 0;
+        event.values[1] = canShootWithoutObstruction ? 1 : 0;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, BallCameraSetOrUnsetEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->BallCameraSetOrUnsetEvent(ball, isSet, canShootWithoutObstruction);
@@ -610,6 +1928,16 @@ void GameEventManager::ActionBallCameraSetOrUnset(const GameBall* ball, bool isS
 }
 
 void GameEventManager::ActionBallCameraCannonRotation(const GameBall& ball, const CannonBlock& cannon, bool canShootWithoutObstruction) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(BallCameraCannonRotationEventType);
+        event.objects[0] = &ball;
+        event.objects[1] = &cannon;
+        event.values[0] = canShootWithoutObstruction ? 1 : 0;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, BallCameraCannonRotationEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->BallCameraCannonRotationEvent(ball, cannon, canShootWithoutObstruction);
@@ -617,6 +1945,13 @@ void GameEventManager::ActionBallCameraCannonRotation(const GameBall& ball, cons
 }
 
 void GameEventManager::ActionCantFireBallCamFromCannon() {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(CantFireBallCamFromCannonEventType);
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, CantFireBallCamFromCannonEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->CantFireBallCamFromCannonEvent();
@@ -624,6 +1959,15 @@ void GameEventManager::ActionCantFireBallCamFromCannon() {
 }
 
 void GameEventManager::ActionPaddleCameraSetOrUnset(const PlayerPaddle& paddle, bool isSet) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(PaddleCameraSetOrUnsetEventType);
+        event.objects[0] = &paddle;
+        event.values[0] = isSet ? 1 : 0;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, PaddleCameraSetOrUnsetEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->PaddleCameraSetOrUnsetEvent(paddle, isSet);
@@ -632,6 +1976,13 @@ void GameEventManager::ActionPaddleCameraSetOrUnset(const PlayerPaddle& paddle,
 
 // Action for when the release timer starts up
 void GameEventManager::ActionReleaseTimerStarted() {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ReleaseTimerStartedEventType);
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ReleaseTimerStartedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ReleaseTimerStartedEvent();
@@ -640,6 +1991,14 @@ void GameEventManager::ActionReleaseTimerStarted() {
 
 // Action for when a projectile is fired/spawned
 void GameEventManager::ActionProjectileSpawned(const Projectile& projectile) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(ProjectileSpawnedEventType);
+		event.objects[0] = &projectile;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ProjectileSpawnedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ProjectileSpawnedEvent(projectile);
@@ -648,6 +2007,14 @@ void GameEventManager::ActionProjectileSpawned(const Projectile& projectile) {
 
 // Action for when a projectile is removed from the game
 void GameEventManager::ActionProjectileRemoved(const Projectile& projectile) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(ProjectileRemovedEventType);
+		event.objects[0] = &projectile;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ProjectileRemovedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ProjectileRemovedEvent(projectile);
@@ -656,6 +2023,14 @@ void GameEventManager::ActionProjectileRemoved(const Projectile& projectile) {
 
 // Action for when a rocket explodes
 void GameEventManager::ActionRocketExploded(const RocketProjectile& rocket) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(RocketExplodedEventType);
+		event.objects[0] = &rocket;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, RocketExplodedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->RocketExplodedEvent(rocket);
@@ -664,6 +2039,14 @@ void GameEventManager::ActionRocketExploded(const RocketProjectile& rocket) {
 
 // Action for when an armed mine explodes
 void GameEventManager::ActionMineExploded(const MineProjectile& mine) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(MineExplodedEventType);
+		event.objects[0] = &mine;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, MineExplodedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->MineExplodedEvent(mine);
@@ -671,6 +2054,14 @@ void GameEventManager::ActionMineExploded(const MineProjectile& mine) {
 }
 
 void GameEventManager::ActionMineLanded(const MineProjectile& mine) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(MineLandedEventType);
+        event.objects[0] = &mine;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, MineLandedEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->MineLandedEvent(mine);
@@ -678,6 +2069,14 @@ void GameEventManager::ActionMineLanded(const MineProjectile& mine) {
 }
 
 void GameEventManager::ActionRemoteControlRocketFuelWarning(const PaddleRemoteControlRocketProjectile& rocket) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(RemoteControlRocketFuelWarningEventType);
+        event.objects[0] = &rocket;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, RemoteControlRocketFuelWarningEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->RemoteControlRocketFuelWarningEvent(rocket);
@@ -685,6 +2084,14 @@ void GameEventManager::ActionRemoteControlRocketFuelWarning(const PaddleRemoteCo
 }
 
 void GameEventManager::ActionRemoteControlRocketThrustApplied(const PaddleRemoteControlRocketProjectile& rocket) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(RemoteControlRocketThrustAppliedEventType);
+        event.objects[0] = &rocket;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, RemoteControlRocketThrustAppliedEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->RemoteControlRocketThrustAppliedEvent(rocket);
@@ -693,6 +2100,14 @@ void GameEventManager::ActionRemoteControlRocketThrustApplied(const PaddleRemote
 
 // Action for when a beam is fired/spawned
 void GameEventManager::ActionBeamSpawned(const Beam& beam) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BeamSpawnedEventType);
+		event.objects[0] = &beam;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BeamSpawnedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BeamSpawnedEvent(beam);
@@ -701,6 +2116,14 @@ void GameEventManager::ActionBeamSpawned(const Beam& beam) {
 
 // Action for when a beam changes shape/position
 void GameEventManager::ActionBeamChanged(const Beam& beam) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BeamChangedEventType);
+		event.objects[0] = &beam;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BeamChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BeamChangedEvent(beam);
@@ -709,6 +2132,14 @@ void GameEventManager::ActionBeamChanged(const Beam& beam) {
 
 // Action for when a beam is removed from the game
 void GameEventManager::ActionBeamRemoved(const Beam& beam) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BeamRemovedEventType);
+		event.objects[0] = &beam;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BeamRemovedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BeamRemovedEvent(beam);
@@ -717,6 +2148,15 @@ void GameEventManager::ActionBeamRemoved(const Beam& beam) {
 
 // Action for when a tesla lightning barrier is newly spawned between two tesla blocks
 void GameEventManager::ActionTeslaLightningBarrierSpawned(const TeslaBlock& newlyOnTeslaBlock, const TeslaBlock& previouslyOnTeslaBlock) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(TeslaLightningBarrierSpawnedEventType);
+		event.objects[0] = &newlyOnTeslaBlock;
+		event.objects[1] = &previouslyOnTeslaBlock;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, TeslaLightningBarrierSpawnedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->TeslaLightningBarrierSpawnedEvent(newlyOnTeslaBlock, previouslyOnTeslaBlock);
@@ -725,6 +2165,15 @@ void GameEventManager::ActionTeslaLightningBarrierSpawned(const TeslaBlock& newl
 
 // Action for when an existing tesla lightning barrier is removed from between two tesla blocks
 void GameEventManager::ActionTeslaLightningBarrierRemoved(const TeslaBlock& newlyOffTeslaBlock, const TeslaBlock& stillOnTeslaBlock) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(TeslaLightningBarrierRemovedEventType);
+		event.objects[0] = &newlyOffTeslaBlock;
+		event.objects[1] = &stillOnTeslaBlock;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, TeslaLightningBarrierRemovedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->TeslaLightningBarrierRemovedEvent(newlyOffTeslaBlock, stillOnTeslaBlock);
@@ -733,6 +2182,13 @@ void GameEventManager::ActionTeslaLightningBarrierRemoved(const TeslaBlock& newl
 
 // Action for when the game is completed
 void GameEventManager::ActionGameCompleted() {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(GameCompletedEventType);
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, GameCompletedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->GameCompletedEvent();
@@ -741,6 +2197,14 @@ void GameEventManager::ActionGameCompleted() {
 
 // Action for when a world starts in-game
 void GameEventManager::ActionWorldStarted(const GameWorld& world) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(WorldStartedEventType);
+		event.objects[0] = &world;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, WorldStartedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->WorldStartedEvent(world);
@@ -749,6 +2213,14 @@ void GameEventManager::ActionWorldStarted(const GameWorld& world) {
 
 // Action for when a world completes in-game
 void GameEventManager::ActionWorldCompleted(const GameWorld& world) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(WorldCompletedEventType);
+		event.objects[0] = &world;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, WorldCompletedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->WorldCompletedEvent(world);
@@ -757,6 +2229,15 @@ void GameEventManager::ActionWorldCompleted(const GameWorld& world) {
 
 // Action for when a level starts in-game
 void GameEventManager::ActionLevelStarted(const GameWorld& world, const GameLevel& level) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(LevelStartedEventType);
+		event.objects[0] = &world;
+		event.objects[1] = &level;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LevelStartedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LevelStartedEvent(world, level);
@@ -764,6 +2245,14 @@ void GameEventManager::ActionLevelStarted(const GameWorld& world, const GameLeve
 }
 
 void GameEventManager::ActionLevelAlmostComplete(const GameLevel& level) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(LevelAlmostCompleteEventType);
+		event.objects[0] = &level;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LevelAlmostCompleteEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LevelAlmostCompleteEvent(level);
@@ -773,6 +2262,17 @@ void GameEventManager::ActionLevelAlmostComplete(const GameLevel& level) {
 // Action for when a level completes in-game
 void GameEventManager::ActionLevelCompleted(const GameWorld& world, const GameLevel& level,
                                             int furthestLevelIdxBefore, int furthestLevelIdxAfter) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(LevelCompletedEventType);
+		event.objects[0] = &world;
+		event.objects[1] = &level;
+		event.values[0] = furthestLevelIdxBefore;
+		event.values[1] = furthestLevelIdxAfter;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LevelCompletedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LevelCompletedEvent(world, level, furthestLevelIdxBefore, furthestLevelIdxAfter);
@@ -780,6 +2280,13 @@ void GameEventManager::ActionLevelCompleted(const GameWorld& world, const GameLe
 }
 
 void GameEventManager::ActionLevelResetting() {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(LevelResettingEventType);
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, LevelResettingEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->LevelResettingEvent();
@@ -789,6 +2296,15 @@ void GameEventManager::ActionLevelResetting() {
 // Action for when the number of player lives changes
 void GameEventManager::ActionLivesChanged(int livesLeftBefore, int livesLeftAfter) {
 	assert(livesLeftBefore != livesLeftAfter);
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(LivesChangedEventType);
+		event.values[0] = livesLeftBefore;
+		event.values[1] = livesLeftAfter;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LivesChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LivesChangedEvent(livesLeftBefore, livesLeftAfter);
@@ -797,6 +2313,14 @@ void GameEventManager::ActionLivesChanged(int livesLeftBefore, int livesLeftAfte
 
 // Action for when ice shatters on a block
 void GameEventManager::ActionBlockIceShattered(const LevelPiece& block) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(BlockIceShatteredEventType);
+		event.objects[0] = &block;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BlockIceShatteredEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BlockIceShatteredEvent(block);
@@ -805,6 +2329,14 @@ void GameEventManager::ActionBlockIceShattered(const LevelPiece& block) {
 
 // Action for when a block that is frozen is canceled-out by something firey hitting it
 void GameEventManager::ActionBlockIceCancelledWithFire(const LevelPiece& block) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(BlockIceCancelledWithFireEventType);
+		event.objects[0] = &block;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BlockIceCancelledWithFireEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BlockIceCancelledWithFireEvent(block);
@@ -813,6 +2345,14 @@ void GameEventManager::ActionBlockIceCancelledWithFire(const LevelPiece& block)
 
 // Action for when a block that is on fire is canceled-out by something icy hitting it
 void GameEventManager::ActionBlockFireCancelledWithIce(const LevelPiece& block) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(BlockFireCancelledWithIceEventType);
+		event.objects[0] = &block;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BlockFireCancelledWithIceEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BlockFireCancelledWithIceEvent(block);
@@ -821,6 +2361,14 @@ void GameEventManager::ActionBlockFireCancelledWithIce(const LevelPiece& block)
 
 // Action for when points are awarded and the GUI needs to be notified
 void GameEventManager::ActionPointNotification(const PointAward& pointAward) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(PointNotificationEventType);
+		event.objects[0] = new PointAward(pointAward);
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, PointNotificationEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->PointNotificationEvent(pointAward);
@@ -829,6 +2377,14 @@ void GameEventManager::ActionPointNotification(const PointAward& pointAward) {
 
 // Action for when the player's score changes
 void GameEventManager::ActionScoreChanged(int newScore) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(ScoreChangedEventType);
+		event.values[0] = newScore;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ScoreChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ScoreChangedEvent(newScore);
@@ -837,6 +2393,15 @@ void GameEventManager::ActionScoreChanged(int newScore) {
 
 // Action for when the multiplier counter changes
 void GameEventManager::ActionScoreMultiplierCounterChanged(int oldCounterValue, int newCounterValue) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(ScoreMultiplierCounterChangedEventType);
+		event.values[0] = oldCounterValue;
+		event.values[1] = newCounterValue;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ScoreMultiplierCounterChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ScoreMultiplierCounterChangedEvent(oldCounterValue, newCounterValue);
@@ -845,6 +2410,17 @@ void GameEventManager::ActionScoreMultiplierCounterChanged(int oldCounterValue,
 
 // Action for when the score multiplier changes
 void GameEventManager::ActionScoreMultiplierChanged(int oldMultiplier, int newMultiplier, const Point2D& position) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(ScoreMultiplierChangedEventType);
+		event.values[0] = oldMultiplier;
+		event.values[1] = newMultiplier;
+		event.coords[0] = position[0];
+		event.coords[1] = position[1];
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, ScoreMultiplierChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->ScoreMultiplierChangedEvent(oldMultiplier, newMultiplier, position);
@@ -853,6 +2429,16 @@ void GameEventManager::ActionScoreMultiplierChanged(int oldMultiplier, int newMu
 
 // Action for when the number of awarded stars changes
 void GameEventManager::ActionNumStarsChanged(const PointAward* pointAward, int oldNumStars, int newNumStars) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(NumStarsChangedEventType);
+		event.objects[0] = pointAward != NULL ? new PointAward(*pointAward) : NULL;
+		event.values[0] = oldNumStars;
+		event.values[1] = newNumStars;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, NumStarsChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->NumStarsChangedEvent(pointAward, oldNumStars, newNumStars);
@@ -860,6 +2446,14 @@ void GameEventManager::ActionNumStarsChanged(const PointAward* pointAward, int o
 }
 
 void GameEventManager::ActionDifficultyChanged(int newDifficulty) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(DifficultyChangedEventType);
+		event.values[0] = newDifficulty;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, DifficultyChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->DifficultyChangedEvent(static_cast<GameModel::Difficulty>(newDifficulty));
@@ -869,6 +2463,16 @@ void GameEventManager::ActionDifficultyChanged(int newDifficulty) {
 void GameEventManager::ActionLaserTurretAIStateChanged(const LaserTurretBlock& block,
                                                        LaserTurretBlock::TurretAIState oldState,
                                                        LaserTurretBlock::TurretAIState newState) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(LaserTurretAIStateChangedEventType);
+		event.objects[0] = &block;
+		event.values[0] = oldState;
+		event.values[1] = newState;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LaserTurretAIStateChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LaserTurretAIStateChangedEvent(block, oldState, newState);
@@ -876,6 +2480,14 @@ void GameEventManager::ActionLaserTurretAIStateChanged(const LaserTurretBlock& b
 }
 
 void GameEventManager::ActionLaserFiredByTurret(const LaserTurretBlock& block) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(LaserFiredByTurretEventType);
+		event.objects[0] = &block;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, LaserFiredByTurretEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->LaserFiredByTurretEvent(block);
@@ -885,6 +2497,16 @@ void GameEventManager::ActionLaserFiredByTurret(const LaserTurretBlock& block) {
 void GameEventManager::ActionRocketTurretAIStateChanged(const RocketTurretBlock& block,
                                                         RocketTurretBlock::TurretAIState oldState,
                                                         RocketTurretBlock::TurretAIState newState) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(RocketTurretAIStateChangedEventType);
+		event.objects[0] = &block;
+		event.values[0] = oldState;
+		event.values[1] = newState;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, RocketTurretAIStateChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->RocketTurretAIStateChangedEvent(block, oldState, newState);
@@ -892,6 +2514,14 @@ void GameEventManager::ActionRocketTurretAIStateChanged(const RocketTurretBlock&
 }
 
 void GameEventManager::ActionRocketFiredByTurret(const RocketTurretBlock& block) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(RocketFiredByTurretEventType);
+		event.objects[0] = &block;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, RocketFiredByTurretEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->RocketFiredByTurretEvent(block);
@@ -902,6 +2532,16 @@ void GameEventManager::ActionMineTurretAIStateChanged(const MineTurretBlock& blo
                                                       MineTurretBlock::TurretAIState oldState,
                                                       MineTurretBlock::TurretAIState newState) {
 
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(MineTurretAIStateChangedEventType);
+        event.objects[0] = &block;
+        event.values[0] = oldState;
+        event.values[1] = newState;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, MineTurretAIStateChangedEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->MineTurretAIStateChangedEvent(block, oldState, newState);
@@ -909,6 +2549,14 @@ void GameEventManager::ActionMineTurretAIStateChanged(const MineTurretBlock& blo
 }
 
 void GameEventManager::ActionMineFiredByTurret(const MineTurretBlock& block) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(MineFiredByTurretEventType);
+		event.objects[0] = &block;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, MineFiredByTurretEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->MineFiredByTurretEvent(block);
@@ -916,6 +2564,15 @@ void GameEventManager::ActionMineFiredByTurret(const MineTurretBlock& block) {
 }
 
 void GameEventManager::ActionRegenBlockLifeChanged(const RegenBlock& block, float lifePercentBefore) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(RegenBlockLifeChangedEventType);
+		event.objects[0] = &block;
+		event.coords[0] = lifePercentBefore;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, RegenBlockLifeChangedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->RegenBlockLifeChangedEvent(block, lifePercentBefore);
@@ -923,6 +2580,14 @@ void GameEventManager::ActionRegenBlockLifeChanged(const RegenBlock& block, floa
 }
 
 void GameEventManager::ActionRegenBlockPreturbed(const RegenBlock& block) {
+	if (this->IsDeferring()) {
+		DeferredEvent event(RegenBlockPreturbedEventType);
+		event.objects[0] = &block;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, RegenBlockPreturbedEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->RegenBlockPreturbedEvent(block);
@@ -930,6 +2595,14 @@ void GameEventManager::ActionRegenBlockPreturbed(const RegenBlock& block) {
 }
 
 void GameEventManager::ActionBossHurt(const BossWeakpoint* hurtPart) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BossHurtEventType);
+		event.objects[0] = hurtPart;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BossHurtEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BossHurtEvent(hurtPart);
@@ -937,6 +2610,16 @@ void GameEventManager::ActionBossHurt(const BossWeakpoint* hurtPart) {
 }
 
 void GameEventManager::ActionBossAngry(const Boss* boss, const BossBodyPart* angryPart) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BossAngryEventType);
+		event.objects[0] = boss;
+		event.objects[1] = angryPart;
+		event.values[0] = 0;
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BossAngryEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BossAngryEvent(boss, angryPart);
@@ -944,6 +2627,19 @@ void GameEventManager::ActionBossAngry(const Boss* boss, const BossBodyPart* ang
 }
 
 void GameEventManager::ActionBossAngry(const Boss* boss, const Point2D& angryPartLoc, float angryPartWidth, float angryPartHeight) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(BossAngryEventType);
+        event.objects[0] = boss;
+        event.coords[0] = angryPartLoc[0];
+        event.coords[1] = angryPartLoc[1];
+        event.coords[2] = angryPartWidth;
+        event.coords[3] = angryPartHeight;
+        event.values[0] = 1;
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, BossAngryEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->BossAngryEvent(boss, angryPartLoc, angryPartWidth, angryPartHeight);
@@ -951,6 +2647,13 @@ void GameEventManager::ActionBossAngry(const Boss* boss, const Point2D& angryPar
 }
 
 void GameEventManager::ActionClearActiveBossEffects() {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(ClearActiveBossEffectsEventType);
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, ClearActiveBossEffectsEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->ClearActiveBossEffectsEvent();
@@ -958,6 +2661,14 @@ void GameEventManager::ActionClearActiveBossEffects() {
 }
 
 void GameEventManager::ActionGeneralEffect(const GeneralEffectEventInfo& effectEvent) {
+    if (this->IsDeferringAll()) {
+        DeferredEvent event(GeneralEffectEventType);
+        event.objects[0] = effectEvent.Clone();
+        this->DeferEvent(event);
+        return;
+    }
+
+    EventDispatchScope dispatchScope(this, GeneralEffectEventType);
     std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
     for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
         (*listenerIter)->GeneralEffectEvent(effectEvent);
@@ -965,6 +2676,14 @@ void GameEventManager::ActionGeneralEffect(const GeneralEffectEventInfo& effectE
 }
 
 void GameEventManager::ActionBossEffect(const BossEffectEventInfo& effectEvent) {
+	if (this->IsDeferringAll()) {
+		DeferredEvent event(BossEffectEventType);
+		event.objects[0] = effectEvent.Clone();
+		this->DeferEvent(event);
+		return;
+	}
+
+	EventDispatchScope dispatchScope(this, BossEffectEventType);
 	std::list<GameEvents*>::iterator listenerIter = this->eventListeners.begin();
 	for (; listenerIter != this->eventListeners.end(); ++listenerIter) {
 		(*listenerIter)->BossEffectEvent(effectEvent);
@@ -33,6 +33,8 @@
 #define __GAMEEVENTMANAGER_H__
 
 #include "../BlammoEngine/BasicIncludes.h"
+#include "../BlammoEngine/SPSCQueue.h"
+
 #include "LevelPiece.h"
 #include "LaserTurretBlock.h"
 #include "RocketTurretBlock.h"
@@ -74,10 +76,76 @@ class PortalProjectile;
  * about any types of events that are occurring within the game model.
  * This class will receive occurrences of those events and tell all registered
  * listeners about them.
+ *
+ * Events can optionally be deferred (see SetDispatchMode): events that only reference objects
+ * that are sure to outlive the frame are recorded in a preallocated queue and sent out in one
+ * batch, all other events still go out immediately (after any recorded events, to keep the order).
+ *
+ * When the model runs on its own thread (ThreadedDispatch) every event actioned on that thread is
+ * recorded and the view's thread sends them out. Model objects that such an event could refer to
+ * must then be deleted with DeleteAfterDispatch so they outlive the recorded events.
  */
 class GameEventManager {
 
 public:
+    // Every type of event that can be actioned (overloaded actions share a type), used to
+    // look up the per-event-type statistics
+    enum EventType {
+        PaddleHitWallEventType, PaddlePortalBlockTeleportEventType, PaddleHitByProjectileEventType,
+        PaddleShieldHitByProjectileEventType, ProjectileDeflectedByPaddleShieldEventType,
+        PaddleHitByBeamEventType, PaddleShieldHitByBeamEventType, PaddleHitByBossEventType,
+        PaddleStatusUpdateEventType, FrozenPaddleCanceledByFireEventType, OnFirePaddleCanceledByIceEventType,
+        PaddleFlippedEventType, BallDiedEventType, LastBallAboutToDieEventType, LastBallExplodedEventType,
+        AllBallsDeadEventType, BallSpawnEventType, BallShotEventType, PaddleWeaponFiredEventType,
+        ProjectileBlockCollisionEventType, ProjectileSafetyNetCollisionEventType,
+        ProjectileBossCollisionEventType, ProjectileBallCollisionEventType, BallBlockCollisionEventType,
+        BallPortalBlockTeleportEventType, BallPortalProjectileTeleportEventType,
+        ProjectilePortalProjectileTeleportEventType, ProjectilePortalBlockTeleportEventType,
+        ItemPortalBlockTeleportEventType, BallEnteredCannonEventType, BallFiredFromCannonEventType,
+        ProjectileEnteredCannonEventType, ProjectileFiredFromCannonEventType,
+        BallHitTeslaLightningArcEventType, GamePauseStateChangedEventType, FireBallCanceledByIceBallEventType,
+        IceBallCanceledByFireBallEventType, PaddleIceBlasterCanceledByFireBlasterEventType,
+        PaddleFireBlasterCanceledByIceBlasterEventType, BallPaddleCollisionEventType,
+        BallBallCollisionEventType, BallBossCollisionEventType, BlockDestroyedEventType,
+        BallSafetyNetCreatedEventType, BallSafetyNetDestroyedEventType, LevelPieceChangedEventType,
+        LevelPieceStatusAddedEventType, LevelPieceStatusRemovedEventType, LevelPieceAllStatusRemovedEventType,
+        CollateralBlockChangedStateEventType, ItemSpawnedEventType, ItemRemovedEventType,
+        ItemPaddleCollisionEventType, ItemActivatedEventType, ItemDeactivatedEventType,
+        RandomItemActivatedEventType, ItemTimerStartedEventType, ItemTimerStoppedEventType,
+        ItemDropBlockItemChangeEventType, ItemDropBlockLockedEventType, SwitchBlockActivatedEventType,
+        BulletTimeStateChangedEventType, BallBoostExecutedEventType, BallBoostGainedEventType,
+        BallBoostLostEventType, BallBoostUsedEventType, BoostFailedDueToNoBallsAvailableEventType,
+        BallCameraSetOrUnsetEventType, BallCameraCannonRotationEventType, CantFireBallCamFromCannonEventType,
+        PaddleCameraSetOrUnsetEventType, ReleaseTimerStartedEventType, ProjectileSpawnedEventType,
+        ProjectileRemovedEventType, RocketExplodedEventType, MineExplodedEventType, MineLandedEventType,
+        RemoteControlRocketFuelWarningEventType, RemoteControlRocketThrustAppliedEventType,
+        BeamSpawnedEventType, BeamChangedEventType, BeamRemovedEventType,
+        TeslaLightningBarrierSpawnedEventType, TeslaLightningBarrierRemovedEventType, GameCompletedEventType,
+        WorldStartedEventType, WorldCompletedEventType, LevelStartedEventType, LevelAlmostCompleteEventType,
+        LevelCompletedEventType, LevelResettingEventType, LivesChangedEventType, BlockIceShatteredEventType,
+        BlockIceCancelledWithFireEventType, BlockFireCancelledWithIceEventType, PointNotificationEventType,
+        ScoreChangedEventType, ScoreMultiplierCounterChangedEventType, ScoreMultiplierChangedEventType,
+        NumStarsChangedEventType, DifficultyChangedEventType, LaserTurretAIStateChangedEventType,
+        LaserFiredByTurretEventType, RocketTurretAIStateChangedEventType, RocketFiredByTurretEventType,
+        MineTurretAIStateChangedEventType, MineFiredByTurretEventType, RegenBlockLifeChangedEventType,
+        RegenBlockPreturbedEventType, BossHurtEventType, BossAngryEventType, ClearActiveBossEffectsEventType,
+        GeneralEffectEventType, BossEffectEventType, NumEventTypes
+    };
+
+    // How actioned events reach the listeners: immediately, as each event happens, or recorded
+    // and dispatched in one batch when DispatchDeferredEvents is called. In threaded dispatch all
+    // events actioned on the model thread (see SetModelThread) are recorded, the events from any
+    // other thread go out immediately.
+    enum DispatchMode { ImmediateDispatch, DeferredDispatch, ThreadedDispatch };
+
+    struct EventTypeStats {
+        EventTypeStats() : numDispatched(0), numDeferred(0), totalDispatchTimeInSecs(0.0) {}
+        unsigned long numDispatched;        // Number of times the event was sent to the listeners
+        unsigned long numDeferred;          // Number of times the event was recorded for later dispatch
+        double totalDispatchTimeInSecs;     // Time spent in the listeners (includes any events they action),
+                                            // only gathered while dispatch timing is on
+    };
+
 	static GameEventManager* Instance();
 	static void DeleteInstance();
 	
@@ -85,6 +153,34 @@ public:
 	void RegisterGameEventListener(GameEvents* listener);
 	void UnregisterGameEventListener(GameEvents* listener);
 
+    void SetDispatchMode(DispatchMode mode);
+    DispatchMode GetDispatchMode() const { return this->dispatchMode; }
+    void SetModelThread(Uint32 threadID) { this->modelThreadID = threadID; }
+    void DispatchDeferredEvents();
+
+    // Deletes the given model object once all the events recorded before now have been dispatched,
+    // anything the object's destruction does to the rest of the model still happens right away
+    void DeleteAfterDispatch(LevelPiece* piece);
+    void DeleteAfterDispatch(GameBall* ball);
+    void DeleteAfterDispatch(Projectile* projectile);
+    void DeleteAfterDispatch(GameItem* item);
+    void DeleteAfterDispatch(GameItemTimer* timer);
+    void DeleteAfterDispatch(Beam* beam);
+    void DeleteAfterDispatch(SafetyNet* safetyNet);
+    void DeleteAfterDispatch(BallBoostModel* boostModel);
+    void DeleteAfterDispatch(AbstractBossBodyPart* bossPart);
+    void DeleteAfterDispatch(Boss* boss);
+    void DeleteAfterDispatch(GameLevel* level);
+    void DeleteAfterDispatch(GameWorld* world);
+
+    // Per-event-type counters and timing, the counters are always kept but timing each dispatch
+    // is off unless turned on
+    void SetDispatchTimingEnabled(bool enabled) { this->isTimingDispatches = enabled; }
+    static const char* GetEventTypeName(EventType type);
+    const EventTypeStats& GetEventTypeStats(EventType type) const;
+    void ResetEventStats();
+    void WriteEventStats(std::ostream& out) const;
+
 	// Action functions (when events happen, call these)
 	void ActionPaddleHitWall(const PlayerPaddle& paddle, const Point2D& hitLoc);
     void ActionPaddlePortalBlockTeleport(const PlayerPaddle& paddle, const PortalBlock& enterPortal);
@@ -231,11 +327,66 @@ public:
     void ActionBossEffect(const BossEffectEventInfo& effectEvent);
 
 private:
+    static const size_t DEFERRED_EVENT_QUEUE_SIZE;
+
+    typedef void (*ObjectDeleter)(const void* object);
+
+    // A recorded event, holds just enough to re-action the event when the queue is dispatched:
+    // references to model objects (these must still be alive at dispatch time), copies of any
+    // temporaries the event was actioned with (owned by the record) and plain values. A record with
+    // a deleter is a deletion of objects[0] instead of an event.
+    struct DeferredEvent {
+        DeferredEvent() : type(NumEventTypes), deleter(NULL) {}
+        explicit DeferredEvent(EventType type) : type(type), deleter(NULL) {}
+        DeferredEvent(ObjectDeleter deleter, const void* object) : type(NumEventTypes), deleter(deleter) {
+            this->objects[0] = object;
+        }
+
+        EventType type;
+        ObjectDeleter deleter;
+        const void* objects[3];
+        int values[2];
+        float coords[4];
+    };
+
+    // Counts and times a single dispatch of an event to the listeners, any deferred events are
+    // dispatched first so that listeners always see events in the order they happened
+    class EventDispatchScope {
+    public:
+        EventDispatchScope(GameEventManager* manager, EventType type);
+        ~EventDispatchScope();
+    private:
+        EventTypeStats& stats;
+        bool isTimed;
+        double startTimeInSecs;
+        DISALLOW_COPY_AND_ASSIGN(EventDispatchScope);
+    };
+
 	GameEventManager();
 	
 	std::list<GameEvents*> eventListeners;
 
+    DispatchMode dispatchMode;
+    bool isDispatchingDeferred;
+    bool isTimingDispatches;
+    SPSCQueue<DeferredEvent> deferredEvents;
+    std::deque<DeferredEvent> overflowEvents;   // Recorded on the model thread while the queue was full
+    Uint32 modelThreadID;
+    EventTypeStats eventStats[NumEventTypes];
+
 	static GameEventManager* instance;
+
+    bool IsDeferringAll() const { return this->dispatchMode == ThreadedDispatch && SDL_ThreadID() == this->modelThreadID; }
+    bool IsDeferring() const {
+        return (this->dispatchMode == DeferredDispatch && !this->isDispatchingDeferred) || this->IsDeferringAll();
+    }
+    bool HasDeferredEvents() const { return !this->deferredEvents.IsEmpty() || !this->overflowEvents.empty(); }
+    void DeferEvent(const DeferredEvent& event);
+    void PushDeferredEvent(const DeferredEvent& event);
+    template <typename T> void DeferDeletion(T* object);
+    void DispatchDeferredEvent(const DeferredEvent& event);
+
+    DISALLOW_COPY_AND_ASSIGN(GameEventManager);
 };
 
 #endif
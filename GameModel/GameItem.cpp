@@ -127,12 +127,21 @@ void GameItem::Tick(double seconds, const GameModel& model) {
  * Returns: true on collision, false otherwise.
  */
 bool GameItem::CollisionCheck(const PlayerPaddle &paddle) {
+	return this->CollisionCheck(GameItem::BuildPaddleCollisionAABB(paddle));
+}
 
-	// Create basic AABB for both paddle and item and then
-	// check for a collision in 2D.	
-	Collision::AABB2D paddleAABB(paddle.GetCenterPosition() - Vector2D(paddle.GetHalfWidthTotal(), paddle.GetHalfHeight()), 
-		                           paddle.GetCenterPosition() + Vector2D(paddle.GetHalfWidthTotal(), paddle.GetHalfHeight()));
+/**
+ * Check for a collision with a paddle AABB built by BuildPaddleCollisionAABB - when checking
+ * many items against the paddle the paddle's AABB only needs to be built once.
+ */
+bool GameItem::CollisionCheck(const Collision::AABB2D& paddleAABB) const {
+	// Create basic AABB for the item and then check for a collision in 2D.	
 	Collision::AABB2D itemAABB(this->GetCenter() - Vector2D(HALF_ITEM_WIDTH, HALF_ITEM_HEIGHT), 
 														 this->GetCenter() + Vector2D(HALF_ITEM_WIDTH, HALF_ITEM_HEIGHT));
 	return Collision::IsCollision(paddleAABB, itemAABB);
 }
+
+Collision::AABB2D GameItem::BuildPaddleCollisionAABB(const PlayerPaddle& paddle) {
+	return Collision::AABB2D(paddle.GetCenterPosition() - Vector2D(paddle.GetHalfWidthTotal(), paddle.GetHalfHeight()), 
+		                     paddle.GetCenterPosition() + Vector2D(paddle.GetHalfWidthTotal(), paddle.GetHalfHeight()));
+}
@@ -35,6 +35,7 @@
 #include "../BlammoEngine/IPositionObject.h"
 #include "../BlammoEngine/Colour.h"
 #include "../BlammoEngine/Animation.h"
+#include "../BlammoEngine/FreeListPool.h"
 
 #include "GameEventManager.h"
 
@@ -135,8 +136,10 @@ public:
 	}
 	void AnimateItemFade(float endAlpha, double duration);
 
-	void Tick(double seconds, const GameModel& model);
+	virtual void Tick(double seconds, const GameModel& model);
 	bool CollisionCheck(const PlayerPaddle &paddle);
+    bool CollisionCheck(const Collision::AABB2D& paddleAABB) const;
+    static Collision::AABB2D BuildPaddleCollisionAABB(const PlayerPaddle& paddle);
 
     Vector2D GetUpVector() const { return -this->currVelocityDir; }
     bool GetIsFlipped() const { return (this->currVelocityDir[1] > 0); }
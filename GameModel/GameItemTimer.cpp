@@ -50,9 +50,7 @@ GameItemTimer::~GameItemTimer() {
 	//if (!this->wasStopped && (this->timeLengthInSecs - GameItemTimer::ZERO_TIME_TIMER_IN_SECS) > EPSILON) {
 	//	GameEventManager::Instance()->ActionItemTimerStopped(*this);
 	//}
-	if (!this->wasStopped) {
-		this->StopTimer(false);
-	}
+	this->PrepareForDeletion();
 
 	if (this->assocGameItem != NULL) {
 		delete this->assocGameItem;
@@ -60,6 +58,12 @@ GameItemTimer::~GameItemTimer() {
 	}
 }
 
+void GameItemTimer::PrepareForDeletion() {
+	if (!this->wasStopped) {
+		this->StopTimer(false);
+	}
+}
+
 /**
  * This will update the timer, i.e., make it tick away until all
  * its time has elapsed.
@@ -51,6 +51,10 @@ public:
 	GameItemTimer(GameItem* gameItem);
 	~GameItemTimer();
 
+	// Stops the timer (and its item effect) if it's still going, done when the timer is destroyed or
+	// earlier when its deletion is put off (see GameEventManager::DeleteAfterDispatch)
+	void PrepareForDeletion();
+
 	void Tick(double seconds);
 
 	/**
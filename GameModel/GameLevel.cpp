@@ -63,6 +63,7 @@
 #include "PaddleMineProjectile.h"
 #include "Boss.h"
 #include "WarpPortal.h"
+#include "LevelPack.h"
 
 #include "../BlammoEngine/StringHelper.h"
 
@@ -117,64 +118,45 @@ const char* GameLevel::POWERDOWN_ITEM_TYPES_KEYWORD    = "powerdowns";
 const char* GameLevel::STAR_POINT_MILESTONE_KEYWORD    = "STARS:";
 const char* GameLevel::PADDLE_STARTING_X_POS_KEYWORD   = "PADDLESTARTXPOS:";
 
-// Private constructor, requires all the pieces that make up the level
-GameLevel::GameLevel(size_t levelIdx, const std::string& filepath, const std::string& levelName, 
-                     unsigned int numBlocks, const std::vector<std::vector<LevelPiece*> >& pieces, 
-                     int numStarsToUnlock, const std::vector<GameItem::ItemType>& allowedDropTypes, 
-                     size_t randomItemProbabilityNum, long* starAwardScores, float paddleStartXPos,
-                     WarpPortal* warpPortal) :
+// Private constructor, only the level's metadata is set up, the pieces are built by LoadPieces
+GameLevel::GameLevel(size_t levelIdx, const CompiledLevel* level, bool ownsLevel, int numStarsToUnlock) :
+levelIdx(levelIdx), randomItemProbabilityNum(0), piecesLeft(0), width(level->width), height(level->height),
+filepath(level->levelFilepath), levelName(level->levelName), prevHighScore(0), highScore(0), hasNewHighScore(false),
+levelAlmostCompleteSignaled(false), hasBoss(level->hasBoss), boss(NULL), numStarsRequiredToUnlock(numStarsToUnlock), 
+areUnlockStarsPaidFor(false), paddleStartXPos(-1), warpPortal(NULL), pieceChangeCount(0), pristineLevel(level),
+ownsPristineLevel(ownsLevel) {
 
-levelIdx(levelIdx), currentLevelPieces(pieces), allowedDropTypes(allowedDropTypes), 
-randomItemProbabilityNum(randomItemProbabilityNum), piecesLeft(numBlocks),
-filepath(filepath), levelName(levelName), prevHighScore(0), highScore(0),
-levelAlmostCompleteSignaled(false), boss(NULL), numStarsRequiredToUnlock(numStarsToUnlock), 
-areUnlockStarsPaidFor(false), paddleStartXPos(-1), warpPortal(warpPortal) {
+	assert(!this->filepath.empty());
+    assert(static_cast<int>(level->starAwardScores.size()) == GameLevel::MAX_STARS_PER_LEVEL);
 
-	assert(!filepath.empty());
-	
-    this->InitPieces(paddleStartXPos, pieces);
+    float unitWidth  = this->GetLevelUnitWidth();
+    float unitHeight = this->GetLevelUnitHeight();
+    this->levelHypotenuse = sqrt(unitWidth * unitWidth + unitHeight * unitHeight);
 
-    // Set all of the star reward milestone scores
+    // Set all of the star reward milestone scores, they aren't used in boss fight levels
     for (int i = 0; i < GameLevel::MAX_STARS_PER_LEVEL; i++) {
-        this->starAwardScores[i] = starAwardScores[i];
+        this->starAwardScores[i] = this->hasBoss ? 0 : level->starAwardScores[i];
     }
-
-    this->SetPaddleStartXPos(paddleStartXPos);
 }
 
-GameLevel::GameLevel(size_t levelIdx, const std::string& filepath, const std::string& levelName,
-                     const std::vector<std::vector<LevelPiece*> >& pieces, int numStarsToUnlock, Boss* boss,
-                     const std::vector<GameItem::ItemType>& allowedDropTypes, size_t randomItemProbabilityNum,
-                     float paddleStartXPos) :
-
-levelIdx(levelIdx), currentLevelPieces(pieces), allowedDropTypes(allowedDropTypes), 
-randomItemProbabilityNum(randomItemProbabilityNum),
-piecesLeft(0), filepath(filepath), levelName(levelName), highScore(0),
-levelAlmostCompleteSignaled(false), boss(boss), numStarsRequiredToUnlock(numStarsToUnlock), 
-areUnlockStarsPaidFor(false), paddleStartXPos(-1), warpPortal(NULL) {
-
-    assert(!filepath.empty());
-	assert(boss != NULL);
-
-    this->InitPieces(paddleStartXPos, pieces);
-    
-    // Place the boss at the center of the level...
-    this->boss->Init(this->GetLevelUnitWidth() / 2.0f, this->GetLevelUnitHeight() / 2.0f, pieces);
-
-    // Set all of the star reward milestone scores to zero, they aren't used in boss fight levels
-    for (int i = 0; i < GameLevel::MAX_STARS_PER_LEVEL; i++) {
-        this->starAwardScores[i] = 0;
+// Destructor, clean up heap stuffs
+GameLevel::~GameLevel() {
+    this->UnloadPieces();
+    if (this->ownsPristineLevel) {
+        delete this->pristineLevel;
     }
-
-    this->SetPaddleStartXPos(paddleStartXPos);
+    this->pristineLevel = NULL;
 }
 
-// Destructor, clean up heap stuffs
-GameLevel::~GameLevel() {
-	// Clean up level pieces
+/**
+ * Deletes all of the pieces (and the boss/warp portal) of this level along with any state from playing it,
+ * the level's metadata and progress are kept. The pieces can be rebuilt with LoadPieces.
+ */
+void GameLevel::UnloadPieces() {
+	// Clean up level pieces (recorded events may still refer to them)
 	for (size_t i = 0; i < this->currentLevelPieces.size(); i++) {
 		for (size_t j = 0; j < this->currentLevelPieces[i].size(); j++) {
-			delete this->currentLevelPieces[i][j];
+			GameEventManager::Instance()->DeleteAfterDispatch(this->currentLevelPieces[i][j]);
 			this->currentLevelPieces[i][j] = NULL;
 		}
 		this->currentLevelPieces[i].clear();
@@ -182,13 +164,24 @@ GameLevel::~GameLevel() {
 	this->currentLevelPieces.clear();
 
     if (this->boss != NULL) {
-        delete this->boss;
+        GameEventManager::Instance()->DeleteAfterDispatch(this->boss);
         this->boss = NULL;
     }
     if (this->warpPortal != NULL) {
         delete this->warpPortal;
         this->warpPortal = NULL;
     }
+
+    this->triggerablePieces.clear();
+    this->aiEntities.clear();
+    this->teslaLightning.clear();
+    this->teslaLightningBounds.Clear();
+
+    this->allowedDropTypes.clear();
+    this->randomItemProbabilityNum = 0;
+    this->piecesLeft = 0;
+    this->levelAlmostCompleteSignaled = false;
+    this->pieceChangeCount++;
 }
 
 void GameLevel::InitPieces(float paddleStartXPos, const std::vector<std::vector<LevelPiece*> >& pieces) {
@@ -347,104 +340,272 @@ void GameLevel::SetPaddleStartXPos(float xPos) {
     }
 }
 
-GameLevel* GameLevel::CreateGameLevelFromFile(GameModel* gameModel, const GameWorld::WorldStyle& style, size_t levelIdx, 
-                                              int milestoneStarAmt, std::string filepath) {
+// The state that's built up while reading in the pieces of a level
+struct GameLevel::LevelPieceReadData {
+    LevelPieceReadData() : numVitalPieces(0) {}
+
+	std::vector<std::vector<LevelPiece*> > levelPieces;
+	unsigned int numVitalPieces;
+
+	// Keep track of named portal blocks...
+	std::map<char, PortalBlock*> portalBlocks;
+	// Keep track of named Tesla blocks...
+	std::map<char, TeslaBlock*> teslaBlocks;
+    // If there's a warp portal we need to track its information
+    WarpPortal::WarpPortalInfo warpPortalInfo;
+};
+
+/**
+ * Creates the level at the given file path. Only the level's metadata (name, size, star milestones, etc.) is
+ * read, the level's pieces aren't built until LoadPieces is called for it.
+ */
+GameLevel* GameLevel::CreateGameLevelFromFile(GameModel* gameModel, size_t levelIdx, int milestoneStarAmt, 
+                                              const std::string& filepath) {
+
+    // Levels in the game's level pack are used in place (unless the level's file has changed since the pack
+    // was built), otherwise the level's text file is read
+    const LevelPack* levelPack = gameModel->GetLevelPack();
+    const CompiledLevel* packedLevel = (levelPack != NULL) ? levelPack->GetCurrentLevel(filepath) : NULL;
+    if (packedLevel != NULL) {
+        return GameLevel::CreateGameLevelFromCompiled(levelIdx, milestoneStarAmt, *packedLevel);
+    }
+
+    CompiledLevel* textLevel = GameLevel::ReadCompiledLevel(filepath);
+    if (textLevel == NULL) {
+        return NULL;
+    }
+    if (static_cast<int>(textLevel->starAwardScores.size()) != GameLevel::MAX_STARS_PER_LEVEL) {
+        debug_output("ERROR: Incorrect number of star point milestones for level: " << filepath);
+        delete textLevel;
+        return NULL;
+    }
+    return new GameLevel(levelIdx, textLevel, true, milestoneStarAmt);
+}
+
+GameLevel* GameLevel::CreateGameLevelFromCompiled(size_t levelIdx, int milestoneStarAmt, const CompiledLevel& level) {
+    if (static_cast<int>(level.starAwardScores.size()) != GameLevel::MAX_STARS_PER_LEVEL) {
+        debug_output("ERROR: Incorrect number of star point milestones for level: " << level.levelFilepath);
+        return NULL;
+    }
+    return new GameLevel(levelIdx, &level, false, milestoneStarAmt);
+}
 
-	std::stringstream* inFile = ResourceManager::GetInstance()->FilepathToInOutStream(filepath);
+/**
+ * Reads the compiled form of the level from the level's text file.
+ * Returns: The compiled level (owned by the caller), NULL if the level couldn't be read.
+ */
+CompiledLevel* GameLevel::ReadCompiledLevel(const std::string& filepath) {
+	std::istringstream* inFile = ResourceManager::GetInstance()->FilepathToInStream(filepath);
 	if (inFile == NULL) {
 		assert(false);
 		return NULL;
 	}
 
-    std::string levelName("");
-
-    // Attempt to read in the boss keyword (it may or may not be there, if it isn't then the
-    // level is not a boss level by default).
-    bool levelHasBoss = false;
-    std::string bossKeyword("");
-    while (bossKeyword.empty()) {
-		if (!std::getline(*inFile, bossKeyword)) {
-			debug_output("ERROR: Error reading the start of the level file: " << filepath);
-			delete inFile;
-			inFile = NULL;
-			return NULL;
+    CompiledLevel* level = new CompiledLevel();
+    bool success = CompiledLevel::ReadFromText(*inFile, filepath, *level);
+	delete inFile;
+	inFile = NULL;
+
+    if (!success) {
+        delete level;
+        return NULL;
+    }
+    return level;
+}
+
+/**
+ * Builds all of the pieces of this level (along with its boss or warp portal) from the level's pristine
+ * template, i.e., the parsed cells of the level's file. Any previously loaded pieces are deleted first - pieces
+ * are always rebuilt since playing the level changes them, but nothing is parsed again so this is cheap
+ * enough to do on every restart of the level.
+ * Returns: true on success, false if the level's pieces couldn't be built (the level is left without pieces).
+ */
+bool GameLevel::LoadPieces(GameModel* gameModel, const GameWorld::WorldStyle& style) {
+    this->UnloadPieces();
+
+    const CompiledLevel* level = this->pristineLevel;
+    assert(level != NULL);
+    assert(level->width == static_cast<int>(this->width) && level->height == static_cast<int>(this->height));
+
+	// Reset the colours for the portal blocks
+	PortalBlock::ResetPortalColourGenerator();
+
+    // Build all of the pieces from the level's grid
+    LevelPieceReadData readData;
+    std::vector<std::vector<LevelPiece*> >& levelPieces = readData.levelPieces;
+    if (!GameLevel::BuildLevelPieces(*level, readData)) {
+        debug_output("ERROR: Invalid level piece found in level: " << this->filepath);
+        GameLevel::CleanUpFileReadData(levelPieces);
+        return false;
+    }
+
+	// Figure out the allowed item drops and their probabilities...
+	size_t randomItemProbabilityNum = 0;
+	std::vector<GameItem::ItemType> allowedDropTypes;
+    for (std::vector<CompiledLevel::ItemDropEntry>::const_iterator iter = level->itemDrops.begin(); 
+         iter != level->itemDrops.end(); ++iter) {
+
+        const CompiledLevel::ItemDropEntry& dropEntry = *iter;
+		if (!GameItemFactory::GetInstance()->IsValidItemTypeName(dropEntry.itemTypeName)) {
+			debug_output("ERROR: Invalid item type name found in allowable item drop probability list: '" << dropEntry.itemTypeName << "'");
+			GameLevel::CleanUpFileReadData(levelPieces);
+			return false;
+		}
+		GameItem::ItemType currItemType = GameItemFactory::GetInstance()->GetItemTypeFromName(dropEntry.itemTypeName);
+
+        // Items that are only available if unlocked are left out of the level while they're still locked
+        if (dropEntry.onlyIfUnlocked &&
+            ResourceManager::GetInstance()->GetBlammopedia()->GetItemEntry(currItemType)->GetIsLocked()) {
+            continue;
+        }
+
+		// Ignore random item types...
+		if (currItemType == GameItem::RandomItem) {
+			randomItemProbabilityNum = dropEntry.probabilityNum;
+			continue;
+		}
+		for (int i = 0; i < dropEntry.probabilityNum; i++) {
+			allowedDropTypes.push_back(currItemType);
 		}
-		bossKeyword = stringhelper::trim(bossKeyword);
 	}
-    if (bossKeyword.compare(BOSS_LEVEL_KEYWORD) == 0) {
-        levelHasBoss = true;
-
-	    // Read in the level name
-	    while (levelName.empty()) {
-		    if (!std::getline(*inFile, levelName)) {
-			    debug_output("ERROR: Error reading in level name for file: " << filepath);
-			    delete inFile;
-			    inFile = NULL;
-			    return NULL;
-		    }
-		    levelName = stringhelper::trim(levelName);
-	    }
 
-    }
-    else {
-        // Not the boss keyword... that means that the there is no boss keyword and instead we
-        // have just read in the level name
-        levelName = bossKeyword;
-    }
-
-	// Read in the file width and height
-	int width = 0;
-	int height = 0;
-	if (!(*inFile >> width && *inFile >> height)) {
-		debug_output("ERROR: Error reading in width/height for file: " << filepath);
-		delete inFile;
-		inFile = NULL;
-		return NULL;
+	// If there are no allowed drop types then there should be a zero random item drop probability
+	if (allowedDropTypes.empty()) {
+		randomItemProbabilityNum = 0;
 	}
-	
-	// Ensure width and height are valid
-	if (width <= 0 || height <= 0) {
-		debug_output("ERROR: Invalid width/height values for file: " << filepath);
-		delete inFile;
-		inFile = NULL;
-		return NULL;	
+
+	// Go through all of the portal blocks and make sure they loaded properly...
+	for (std::map<char, PortalBlock*>::iterator iter = readData.portalBlocks.begin(); iter != readData.portalBlocks.end(); ++iter) {
+		if (iter->second == NULL || iter->second->GetSiblingPortal() == NULL || iter->second->GetWidthIndex() < 0
+				|| iter->second->GetHeightIndex() < 0) {
+			debug_output("ERROR: Poorly formatted portal blocks.");
+			GameLevel::CleanUpFileReadData(levelPieces);
+			return false;
+		}
 	}
 
-	std::vector<std::vector<LevelPiece*> > levelPieces;
-	unsigned int numVitalPieces = 0;
+	// Go through all the pieces and initialize their bounding values appropriately
+	for (size_t h = 0; h < levelPieces.size(); h++) {
+		for (size_t w = 0; w < levelPieces[h].size(); w++) {
+			GameLevel::UpdatePiece(levelPieces, h, w);
+		}
+	}
 
-	// Keep track of named portal blocks...
-	std::map<char, PortalBlock*> portalBlocks;
-	// Reset the colours for the portal blocks
-	PortalBlock::ResetPortalColourGenerator();
+    // Build the boss for boss levels, otherwise the level may have a warp portal
+    Boss* boss = NULL;
+    if (this->hasBoss) {
+        boss = Boss::BuildStyleBoss(gameModel, style);
+        if (boss == NULL) {
+            assert(false);
+            GameLevel::CleanUpFileReadData(levelPieces);
+            return false;
+        }
+    }
 
-	// Keep track of named Tesla blocks...
-	std::map<char, TeslaBlock*> teslaBlocks;
+    this->currentLevelPieces = levelPieces;
+    this->allowedDropTypes = allowedDropTypes;
+    this->randomItemProbabilityNum = randomItemProbabilityNum;
+    this->InitPieces(level->paddleStartXPos, levelPieces);
 
-    // If there's a warp portal we need to track its information
-    WarpPortal::WarpPortalInfo warpPortalInfo;
+    if (boss != NULL) {
+        // Place the boss at the center of the level...
+        this->boss = boss;
+        this->boss->Init(this->GetLevelUnitWidth() / 2.0f, this->GetLevelUnitHeight() / 2.0f, levelPieces);
+    }
+    else {
+        this->piecesLeft = readData.numVitalPieces;
+        this->warpPortal = readData.warpPortalInfo.BuildWarpPortal();
+    }
 
-	// Read in the values that make up the level
-	for (int h = 0; h < height; h++) {
-		std::vector<LevelPiece*> currentRowPieces;
-
-		for (int w = 0; w < width; w++) {
-			char currBlock;
-			
-			// Read in the current level piece / block
-			if (!(*inFile >> currBlock)) {
-					debug_output("ERROR: Could not properly read level interior value at width = " << w << ", height = " << h);
-					delete inFile;
-					inFile = NULL;
-					return NULL;	
-			}
+    this->SetPaddleStartXPos(level->paddleStartXPos);
+    return true;
+}
+
+/**
+ * Builds the items that an item drop or always drop block can drop from the cell's entries in the level's item
+ * lists, items that are only available when unlocked are left out while they're still locked.
+ * Returns: true on success, false if none of the items are available.
+ */
+static bool BuildItemList(const CompiledLevel& level, const CompiledLevel::Cell& cell, std::vector<GameItem::ItemType>& items) {
+    items.clear();
+    for (unsigned int i = cell.listStart; i < cell.listStart + cell.listCount; i++) {
+        const CompiledLevel::ItemListEntry& entry = level.itemLists[i];
+        GameItem::ItemType itemType = static_cast<GameItem::ItemType>(entry.itemType);
+        if (!entry.onlyIfUnlocked || !ResourceManager::GetInstance()->GetBlammopedia()->GetItemEntry(itemType)->GetIsLocked()) {
+            for (int j = 0; j < entry.likelihood; j++) {
+                items.push_back(itemType);
+            }
+        }
+    }
+
+    if (items.empty()) {
+        assert(false);
+        debug_output("Failed to find any valid items in item list.");
+        return false;
+    }
+
+    // Count the number of each item in the vector, if they're all the same 
+    // then we can reduce the size of the vector and avoid duplicates
+    std::map<GameItem::ItemType, int> countMap;  
+    for (std::vector<GameItem::ItemType>::iterator iter = items.begin(); iter != items.end(); ++iter) {
+        countMap[*iter]++;
+    }
+
+    assert(!countMap.empty());
+    std::map<GameItem::ItemType, int>::const_iterator mapIter = countMap.begin();
+    
+    bool countIsTheSame = true;
+    int lastCount = mapIter->second;
+    ++mapIter;
+
+    for (; mapIter != countMap.end(); ++mapIter) {
+        if (lastCount != mapIter->second) {
+            countIsTheSame = false;
+            break;
+        }
+    }
+
+    if (countIsTheSame && lastCount > 1) {
+        items.clear();
+        items.resize(countMap.size());
+        int count = 0;
+        // Simplify the items vector by having one of each item in it...
+        for (mapIter = countMap.begin(); mapIter != countMap.end(); ++mapIter, count++) {
+            items[count] = mapIter->first;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Builds the grid of level pieces from the compiled level's cells (one row after another, starting from the top
+ * row of the level). The rows are placed in the read data's levelPieces so that the bottom row is first.
+ * Returns: true on success, false if a piece couldn't be built - any pieces already built are left in the read data.
+ */
+bool GameLevel::BuildLevelPieces(const CompiledLevel& level, LevelPieceReadData& readData) {
+	std::vector<std::vector<LevelPiece*> >& levelPieces = readData.levelPieces;
+	unsigned int& numVitalPieces = readData.numVitalPieces;
+	std::map<char, PortalBlock*>& portalBlocks = readData.portalBlocks;
+	std::map<char, TeslaBlock*>& teslaBlocks = readData.teslaBlocks;
+    WarpPortal::WarpPortalInfo& warpPortalInfo = readData.warpPortalInfo;
+
+    assert(static_cast<int>(level.cells.size()) == level.width * level.height);
+    levelPieces.resize(level.height);
+
+    unsigned int cellIdx = 0;
+	for (int h = 0; h < level.height; h++) {
+        unsigned int pieceHLoc = static_cast<unsigned int>(level.height - 1 - h);
+		std::vector<LevelPiece*>& currentRowPieces = levelPieces[pieceHLoc];
+        currentRowPieces.reserve(level.width);
+
+		for (int w = 0; w < level.width; w++, cellIdx++) {
+            const CompiledLevel::Cell& cell = level.cells[cellIdx];
 
-			// Validate the block type and create teh appropriate object for that block type...
 			LevelPiece* newPiece = NULL;
 			unsigned int pieceWLoc = static_cast<unsigned int>(w);
-			unsigned int pieceHLoc = static_cast<unsigned int>(height - 1 - h);
 
-			switch (currBlock) {
+			switch (cell.pieceType) {
 				case EMPTY_SPACE_CHAR:
 					newPiece = new EmptySpaceBlock(pieceWLoc, pieceHLoc);
 					break;
@@ -455,7 +616,7 @@ GameLevel* GameLevel::CreateGameLevelFromFile(GameModel* gameModel, const GameWo
 				case YELLOW_BREAKABLE_CHAR:
 				case ORANGE_BREAKABLE_CHAR:
 				case RED_BREAKABLE_CHAR:
-					newPiece = new BreakableBlock(currBlock, pieceWLoc, pieceHLoc);
+					newPiece = new BreakableBlock(cell.pieceType, pieceWLoc, pieceHLoc);
 					break;
 				case BOMB_CHAR:
 					newPiece = new BombBlock(pieceWLoc, pieceHLoc);
@@ -470,193 +631,24 @@ GameLevel* GameLevel::CreateGameLevelFromFile(GameModel* gameModel, const GameWo
 					newPiece = new CollateralBlock(pieceWLoc, pieceHLoc);
 					break;
 
-				case CANNON_BLOCK_CHAR: {
-
-                    bool isOneShotCannon = false;
-                    char tempChar;
-                    *inFile >> tempChar;
-
-                    // This might be the one-shot cannon block...
-                    if (tempChar == ONE_SHOT_CANNON_BLOCK_QUALIFIER_CHAR) {
-                        isOneShotCannon = true;
-                        *inFile >> tempChar;
-                    }
-
-                    // C1(d[-e]) - One-shot cannon block
-					// C(d[-e])  - Cannon block
-                    // d: The direction to always fire the cannon block in (or specify random firing direction)
-                    //    the value can be any degree angle starting at 0 going to 359.
-                    // The angle starts by firing directly upwards and moves around the circle
-                    // of angles clockwise (e.g., 90 will always fire the ball perfectly to the right of the cannon, 180 will always
-                    // fire the ball downwards from the cannon, ...). 
-                    // [-e]: is optional - it allows the specification of a angle range from d to e, inclusive.
-					
-					// Beginning bracket
-					if (tempChar != '(') {
-						debug_output("ERROR: poorly formed cannon block syntax, missing the beginning '('");
-						break;
-					}
-
-					// Degree angle value (or random -1)
-					int rotationValue1 = 0;
-					int rotationValue2 = 0;
-                    *inFile >> rotationValue1;
-					if (rotationValue1 != -1 && (rotationValue1 < 0 || rotationValue1 > 720)) {
-						debug_output("ERROR: poorly formed cannon block syntax, first degree angle must either be -1 or in [0,720]");
-						break;
-					}
-
-                    if (rotationValue1 == -1) {
-                        rotationValue1 = 0;
-                        rotationValue2 = 359;
-
-					    // Closing bracket
-					    *inFile >> tempChar;
-					    if (tempChar != ')') {
-						    debug_output("ERROR: poorly formed cannon block syntax, missing the beginning '('");
-						    break;
-					    }
-                    }
-                    else {
-                        // Check for '-'
-					    *inFile >> tempChar;
-					    if (tempChar == '-') {
-                            *inFile >> rotationValue2;
-					        if (rotationValue2 != -1 && (rotationValue2 < 0 || rotationValue2 > 720)) {
-						        debug_output("ERROR: poorly formed cannon block syntax, second degree angle must either be -1 or in [0,720]");
-						        break;
-					        }
-
-                            *inFile >> tempChar;
-                            if (tempChar != ')') {
-						        debug_output("ERROR: poorly formed cannon block syntax, missing the beginning '('");
-						        break;
-                            }
-					    }
-                        else {
-                            if (tempChar != ')') {
-						        debug_output("ERROR: poorly formed cannon block syntax, missing the beginning '('");
-						        break;
-                            }
-                            else {
-                                rotationValue2 = rotationValue1;
-                            }
-                        }
-                    }
-
-                    if (isOneShotCannon) {
-                        newPiece = new FragileCannonBlock(pieceWLoc, pieceHLoc, std::make_pair(rotationValue1, rotationValue2));
+				case CANNON_BLOCK_CHAR:
+                    if ((cell.flags & CompiledLevel::ONE_SHOT_FLAG) != 0) {
+                        newPiece = new FragileCannonBlock(pieceWLoc, pieceHLoc, std::make_pair(cell.values[0], cell.values[1]));
                     }
                     else {
-                        newPiece = new CannonBlock(pieceWLoc, pieceHLoc, std::make_pair(rotationValue1, rotationValue2));
+                        newPiece = new CannonBlock(pieceWLoc, pieceHLoc, std::make_pair(cell.values[0], cell.values[1]));
                     }
                     break;
-				}
-				
 
 				case TESLA_BLOCK_CHAR: {
-                        // A([1|0], [1|0], a, b) - Tesla Block (When active with another tesla block, forms an arc of lightning between the two)
-                        // [1|0]: A '1' or a '0' to indicated whether it starts on (1) or off (0).
-                        // [1|0]: A '1' or a '0' to indicated whether it can be turned on/off (1) or is unchangable (0).
-                        // a : The single character name of this tesla block.
-                        // b : One or more other named tesla blocks seperated by commas.
-
-						char tempChar;
-
-						// Beginning bracket
-						*inFile >> tempChar;
-						if (tempChar != '(') {
-							debug_output("ERROR: poorly formed tesla block syntax, missing the beginning '('");
-							break;
-						}
-
-						// Read whether the block is on or off
-						*inFile >> tempChar;
-						if (tempChar != '1' && tempChar != '0') {
-							debug_output("ERROR: poorly formed tesla block syntax, missing the [1|0] to indicate whether the block starts on or off");
-							break;
-						}
-						bool startsOn = (tempChar == '1') ? true : false;
-
-
-						// Should be a comma after the on/off...
-						*inFile >> tempChar;
-						if (tempChar != ',') {
-							debug_output("ERROR: poorly formed tesla block syntax, missing ',' after the on/off option.");
-							break;
-						}
-
-						// Read whether the block is changable or not
-						*inFile >> tempChar;
-						if (tempChar != '1' && tempChar != '0') {
-							debug_output("ERROR: poorly formed tesla block syntax, missing the [1|0] to indicate whether the block is changable or not");
-							break;
-						}
-						bool isChangable = (tempChar == '1') ? true : false;
-
-						// Should be a comma after the changable...
-						*inFile >> tempChar;
-						if (tempChar != ',') {
-							debug_output("ERROR: poorly formed tesla block syntax, missing ',' after the changable option.");
-							break;
-						}
-
-						// Read the single character name of the tesla block
-						char teslaBlockName;
-						*inFile >> teslaBlockName;
-						if ((teslaBlockName < 'A' && teslaBlockName > 'z') || (teslaBlockName < '0' && teslaBlockName > '9')) {
-							debug_output("ERROR: tesla block name must be a character A-Z, a-z or 0-9");
-							break;
-						}
-
-						// Should be a comma after the name...
-						*inFile >> tempChar;
-						if (tempChar != ',') {
-							debug_output("ERROR: poorly formed tesla block syntax, missing ',' after the name.");
-							break;
-						}
-
-						// Read in all the names of the brother tesla blocks that this one can fire lightning to
-						std::string errorStr;
-						std::list<char> connectedNameList;
-						for (;;) {
-							if (*inFile >> tempChar) {
-								if ((tempChar >= 'A' && tempChar <= 'z') || (teslaBlockName < '0' && teslaBlockName > '9')) {
-									connectedNameList.push_back(tempChar);
-
-									*inFile >> tempChar;
-									// Check for the end bracket
-									if (tempChar == ')') {
-										break;
-									}
-									if (tempChar == ',') {
-										continue;
-									}
-
-									errorStr = "invalid connecting tesla block list formatting.";
-									break;
-								}
-								else {
-									errorStr = "invalid tesla block name in connecting tesla block list.";
-									break;						
-								}
-							}
-							else {
-								errorStr = "failed to read connecting tesla block list.";
-								break;
-							}
-						}
-
-						if (!errorStr.empty() || connectedNameList.empty()) {
-							debug_output("ERROR: poorly formed tesla block syntax, " << errorStr);
-							break;							
-						}
+                        bool startsOn    = (cell.flags & CompiledLevel::STARTS_ON_FLAG) != 0;
+                        bool isChangable = (cell.flags & CompiledLevel::IS_CHANGABLE_FLAG) != 0;
 
 						// Now we need to connect the tesla blocks...
 						TeslaBlock* currentTeslaBlock = NULL;
 						std::list<TeslaBlock*> siblingTeslaBlocks;
 
-						std::map<char, TeslaBlock*>::iterator findIter = teslaBlocks.find(teslaBlockName);
+						std::map<char, TeslaBlock*>::iterator findIter = teslaBlocks.find(cell.name);
 						std::pair<std::map<char, TeslaBlock*>::iterator, bool> insertResult;
 
 						if (findIter != teslaBlocks.end()) {
@@ -666,9 +658,9 @@ GameLevel* GameLevel::CreateGameLevelFromFile(GameModel* gameModel, const GameWo
 
 						// Go through each sibling and try to find it in the list of tesla blocks already created,
 						// if it does not exist then build a place holder for it
-						for (std::list<char>::const_iterator iter = connectedNameList.begin(); iter != connectedNameList.end(); ++iter) {
-							
-							const char& siblingName = *iter;
+                        std::string errorStr;
+						for (unsigned int i = cell.listStart; i < cell.listStart + cell.listCount; i++) {
+							const char& siblingName = level.teslaConnections[i];
 							findIter = teslaBlocks.find(siblingName);
 							TeslaBlock* siblingTeslaBlock = NULL;
 
@@ -679,7 +671,6 @@ GameLevel* GameLevel::CreateGameLevelFromFile(GameModel* gameModel, const GameWo
 								siblingTeslaBlocks.push_back(siblingTeslaBlock);
 							}
 							else {
-								assert(siblingTeslaBlock == NULL);
 								// No sibling tesla block with the current name exists yet, create one and add it to the list
 								siblingTeslaBlock = new TeslaBlock(false, false, 0, 0);
 								siblingTeslaBlocks.push_back(siblingTeslaBlock);
@@ -703,11 +694,11 @@ GameLevel* GameLevel::CreateGameLevelFromFile(GameModel* gameModel, const GameWo
 							// No tesla block has been created for the current name yet, create one.
 							currentTeslaBlock = new TeslaBlock(startsOn, isChangable, pieceWLoc, pieceHLoc);
 							currentTeslaBlock->SetConnectedTeslaBlockList(siblingTeslaBlocks);
-							insertResult = teslaBlocks.insert(std::make_pair(teslaBlockName, currentTeslaBlock));
+							insertResult = teslaBlocks.insert(std::make_pair(cell.name, currentTeslaBlock));
 							if (!insertResult.second) {
 								delete currentTeslaBlock;
 								currentTeslaBlock = NULL;
-								debug_output("ERROR: Poorly formed tesla block syntax, " << "Duplicate tesla block name: '" << teslaBlockName << "'");
+								debug_output("ERROR: Poorly formed tesla block syntax, " << "Duplicate tesla block name: '" << cell.name << "'");
 								break;
 							}
 						}
@@ -720,76 +711,23 @@ GameLevel* GameLevel::CreateGameLevelFromFile(GameModel* gameModel, const GameWo
 							currentTeslaBlock->SetElectricityIsActive(startsOn);
 							currentTeslaBlock->SetIsChangable(isChangable);
 						}
-						
-						// We need to inform the level about any initially 'on' tesla blocks!!!
-						// TODO
 
 						newPiece = currentTeslaBlock;
 					}
 					break;
 
 				case PORTAL_BLOCK_CHAR: {
-						// X(a,b) - Portal block:
-						// a: A single character name for this portal block
-						// b: The single character name of the sibling portal block that this portal block is
-						// the entrance and exit for.
-						char tempChar;
-						*inFile >> tempChar;
-						if (tempChar != '(') {
-							debug_output("ERROR: poorly formed portal block syntax, missing '('");
-							break;
-						}
-						
-						char portalName;
-						*inFile >> portalName;
-						if ((portalName < 'A' && portalName > 'z') || (portalName < '0' && portalName > '9')) {
-							debug_output("ERROR: Portal block name must be a character A-Z or a-z");
-							break;
-						}
-
-						*inFile >> tempChar;
-						if (tempChar != ',') {
-							debug_output("ERROR: poorly formed portal block syntax, missing ','");
-							break;
-						}				
-
-						char siblingName;
-						*inFile >> siblingName;
-						if ((portalName < 'A' && portalName > 'z') || (portalName < '0' && portalName > '9')) {
-							debug_output("ERROR: Portal block name must be a character A-Z or a-z");
-							break;
-						}
-
-                        bool flipsPaddle = false;
-
-                        // Check for the option that flips the paddle when it enters this portal...
-                        if (inFile->peek() == ',') {
-                            *inFile >> tempChar;
-                            *inFile >> tempChar;
-                            if (tempChar != 'f') {
-                                debug_output("ERROR: Portal block only allows 'f' option, currently.");
-                                break;
-                            }
-                            flipsPaddle = true;
-                        }
-
-						*inFile >> tempChar;
-						if (tempChar != ')') {
-							debug_output("ERROR: poorly formed portal block syntax, missing ')'");
-							break;
-						}
-
 						// First try to find either portal block in the current mapping
 						PortalBlock* currentPortalBlock = NULL;
 						PortalBlock* siblingPortalBlock = NULL;
-						std::map<char, PortalBlock*>::iterator findIter = portalBlocks.find(portalName);
+						std::map<char, PortalBlock*>::iterator findIter = portalBlocks.find(cell.name);
 						std::pair<std::map<char, PortalBlock*>::iterator, bool> insertResult;
 
 						if (findIter != portalBlocks.end()) {
 							currentPortalBlock = findIter->second;
 							assert(currentPortalBlock != NULL);
 						}
-						findIter = portalBlocks.find(siblingName);
+						findIter = portalBlocks.find(cell.siblingName);
 						if (findIter != portalBlocks.end()) {
 							siblingPortalBlock = findIter->second;
 						}
@@ -797,14 +735,14 @@ GameLevel* GameLevel::CreateGameLevelFromFile(GameModel* gameModel, const GameWo
 						if (siblingPortalBlock == NULL) {
 							// No sibling exists yet, create one
 							siblingPortalBlock = new PortalBlock(0, 0, NULL);
-							insertResult = portalBlocks.insert(std::make_pair(siblingName, siblingPortalBlock));
+							insertResult = portalBlocks.insert(std::make_pair(cell.siblingName, siblingPortalBlock));
 							assert(insertResult.second);
 						}
 
 						if (currentPortalBlock == NULL) {
 							// No portal block has been created for the current name yet, create one.
 							currentPortalBlock = new PortalBlock(pieceWLoc, pieceHLoc, siblingPortalBlock);
-							insertResult = portalBlocks.insert(std::make_pair(portalName, currentPortalBlock));
+							insertResult = portalBlocks.insert(std::make_pair(cell.name, currentPortalBlock));
 							assert(insertResult.second);
 						}
 						else {
@@ -820,686 +758,105 @@ GameLevel* GameLevel::CreateGameLevelFromFile(GameModel* gameModel, const GameWo
 							siblingPortalBlock->SetColour(ColourRGBA(portalBlockColour, 1.0f));
 						}
 
-                        currentPortalBlock->SetFlipsPaddleOnEntry(flipsPaddle);
+                        currentPortalBlock->SetFlipsPaddleOnEntry((cell.flags & CompiledLevel::FLIPS_PADDLE_FLAG) != 0);
 						newPiece = currentPortalBlock;
 					}
 					break;
 
 				case TRIANGLE_BLOCK_CHAR: {
-						// T(x,p) - Triangle block, 
-						// x: type of block from the above, can be any of the following: {R, O, Y, G, S}
-						// p: the orientation of the triangle (where the outer corner is located), can be any of the following: {ul, ur, ll, lr}
-						// i.e., upper-left = ul, lower-right = lr, etc.
-						char tempChar;
-						*inFile >> tempChar;
-						if (tempChar != '(') {
-							debug_output("ERROR: poorly formed triangle block syntax, missing '('");
-							break;
-						}
-
-						// Read in 'x'
-						char typeOfBlock;
-						*inFile >> typeOfBlock;
-						if (!BreakableBlock::IsValidBreakablePieceType(typeOfBlock) && typeOfBlock != SOLID_BLOCK_CHAR && typeOfBlock != PRISM_BLOCK_CHAR) {
-							debug_output("ERROR: Triangle block has invalid block type specified in descriptor: " << typeOfBlock);
-							break;
-						}
-
-						*inFile >> tempChar;
-						if (tempChar != ',') {
-							debug_output("ERROR: poorly formed triangle block syntax, missing ','");
-							break;
-						}
-
-						// Read in 'p'
-						char orient1, orient2;
-						*inFile >> orient1;
-						*inFile >> orient2;
-
-						TriangleBlock::Orientation orientation = TriangleBlock::UpperRight;
-						if (orient1 == TRI_UPPER_CORNER) {
-							if (orient2 == TRI_RIGHT_CORNER) {
-								// Upper-right
-								orientation = TriangleBlock::UpperRight;
-							}
-							else if (orient2 == TRI_LEFT_CORNER) {
-								// Upper-left
-								orientation = TriangleBlock::UpperLeft;
-							}
-						}
-						else if (orient1 == TRI_LOWER_CORNER) {
-							if (orient2 == TRI_RIGHT_CORNER) {
-								// Lower-right
-								orientation = TriangleBlock::LowerRight;
-							}
-							else if (orient2 == TRI_LEFT_CORNER) {
-								// Lower-left
-								orientation = TriangleBlock::LowerLeft;
-							}
-						}
-
-						// Read in the closing bracket
-						*inFile >> tempChar;
-						if (tempChar != ')') {
-							debug_output("ERROR: poorly formed triangle block syntax, missing ')'");
-							break;
-						}
-
 						// Create a new class for the triangle block based on its type...
-						if (typeOfBlock == SOLID_BLOCK_CHAR) {
+                        TriangleBlock::Orientation orientation = static_cast<TriangleBlock::Orientation>(cell.values[0]);
+						if (cell.blockType == SOLID_BLOCK_CHAR) {
 							newPiece = new SolidTriangleBlock(orientation, pieceWLoc, pieceHLoc);
 						}
-						else if (typeOfBlock == PRISM_BLOCK_CHAR) {
+						else if (cell.blockType == PRISM_BLOCK_CHAR) {
 							newPiece = new PrismTriangleBlock(orientation, pieceWLoc, pieceHLoc);
 						}
-						else {
-							newPiece = new BreakableTriangleBlock(typeOfBlock, orientation, pieceWLoc, pieceHLoc);
-						}
-
-					}
-					break;
-
-				case GameLevel::ITEM_DROP_BLOCK_CHAR: {
-						// D(i0, i1, i2, ...) - Item drop block:
-						// i0, i1, i2, ... : The names of all the item types that the block is allowed to drop, names can be 
-						//                   repeated in order to make higher probabilities of drops. Also, there are several special key
-						//                   words that can be used: (powerups, powerdowns, powerneutrals), which cause the block to drop 
-						//                   all items of those respective designations.
-						
-						std::vector<GameItem::ItemType> itemTypes;
-						if (!ReadItemList(*inFile, itemTypes)) {
-							break;
-						}
-
-						newPiece = new ItemDropBlock(itemTypes, pieceWLoc, pieceHLoc);
-					}
-					break;
-
-                case GameLevel::SWITCH_BLOCK_CHAR: {
-                        // W(a) - Switch block:
-                        // a : The trigger ID of the block that gets triggered by the switch 
-                        //     (switch is turned on when a ball/projectile hits it).
-
-                        char tempChar;
-                        *inFile >> tempChar;
-					    if (tempChar != '(') {
-					        debug_output("ERROR: poorly formed switch block syntax, missing '('");
-						    break;
-					    }
-                        
-                        // The next value will be a triggerID
-                        LevelPiece::TriggerID switchTriggerID = LevelPiece::NO_TRIGGER_ID;
-                        *inFile >> switchTriggerID;
-                        if (switchTriggerID < 0) {
-					        debug_output("ERROR: poorly formed switch block syntax, switch trigger ID was invalid.");
-						    break;
-                        }
-
-					    // Read in the closing bracket
-					    *inFile >> tempChar;
-					    if (tempChar != ')') {
-						    debug_output("ERROR: poorly formed switch block syntax, missing ')'");
-						    break;
-					    }
-                        
-                        newPiece = new SwitchBlock(switchTriggerID, pieceWLoc, pieceHLoc);
-                    }
-                    break;
-
-                case GameLevel::ONE_WAY_BLOCK_CHAR:
-                    {
-                        // F(a) - One-way block:
-                        // a : The direction that the block allows the ball to travel through it, allowable options are:
-                        //     {u, d, l, r} for up, down, left and right, respectively.
-                        
-                        char tempChar;
-                        *inFile >> tempChar;
-					    if (tempChar != '(') {
-					        debug_output("ERROR: poorly formed one-way block syntax, missing '('");
-						    break;
-					    }
-
-
-                        // The next value will be the direction of the one-way...
-                        char oneWayChar;
-                        OneWayBlock::OneWayDir oneWayEnum;
-                        *inFile >> oneWayChar;
-                        if (!OneWayBlock::ConvertCharToOneWayDir(oneWayChar, oneWayEnum)) {
-					        debug_output("ERROR: illegal character found in one-way block syntax, character must be one of 'u', 'd', 'l' or 'r'.");
-						    break;
-                        }
-
-					    // Read in the closing bracket
-					    *inFile >> tempChar;
-					    if (tempChar != ')') {
-						    debug_output("ERROR: poorly formed one-way block syntax, missing ')'");
-						    break;
-					    }
-
-                        newPiece = new OneWayBlock(oneWayEnum, pieceWLoc, pieceHLoc);
-                    }
-                    break;
-
-                case GameLevel::NO_ENTRY_BLOCK_CHAR:
-                    // N - No-entry block
-                    newPiece = new NoEntryBlock(pieceWLoc, pieceHLoc);
-                    break;
-
-                case GameLevel::LASER_TURRET_BLOCK_CHAR:
-                    // L - Laser Turret Block
-                    newPiece = new LaserTurretBlock(pieceWLoc, pieceHLoc);
-                    break;
-
-                case GameLevel::ROCKET_TURRET_BLOCK_CHAR:
-                    // J - Rocket Turret Block
-                    newPiece = new RocketTurretBlock(pieceWLoc, pieceHLoc);
-                    break;
-
-                case GameLevel::MINE_TURRET_BLOCK_CHAR:
-                    // M - Mine Turret Block
-                    newPiece = new MineTurretBlock(pieceWLoc, pieceHLoc);
-                    break;
-
-                case GameLevel::ALWAYS_DROP_BLOCK_CHAR: {
-                    // K(i0, i1, i2, ...) - Always drop block (similar to Item drop block, but is destroyed after 1 hit):
-                    // i0, i1, i2, ... : The names of all the item types that the block is allowed to drop, names can be 
-                    //                   repeated in order to make higher probabilities of drops.
-
-					std::vector<GameItem::ItemType> itemTypes;
-					if (!ReadItemList(*inFile, itemTypes)) {
-						break;
-					}
-
-					newPiece = new AlwaysDropBlock(itemTypes, pieceWLoc, pieceHLoc);
-                    break;
-                }
-
-                case GameLevel::REGEN_BLOCK_CHAR: {
-                    // Q([f|i]) - Regen block
-                    // [f|i] - 'f' means that the block has finite life, 'i' means that the block has infinite life
-
-                    char tempChar;
-
-                    // Read the opening bracket
-                    *inFile >> tempChar;
-				    if (tempChar != '(') {
-				        debug_output("ERROR: poorly formed regen block syntax, missing '('");
-					    break;
-				    }
-
-                    // Read whether it has infinite life or finite life
-                    *inFile >> tempChar;
-                    bool hasInfiniteLife = false;
-                    if (tempChar == GameLevel::FINITE_LIFE_CHAR) {
-                        hasInfiniteLife = false;
-                    }
-                    else if (tempChar == GameLevel::INFINITE_LIFE_CHAR) {
-                        hasInfiniteLife = true;
-                    }
-                    else {
-					    debug_output("ERROR: poorly formed regen block syntax '" << GameLevel::FINITE_LIFE_CHAR << "' or '" <<
-                            GameLevel::INFINITE_LIFE_CHAR << "' must be used an no other characters.");
-					    break;
-                    }
-
-                    // Read the closing bracket
-				    *inFile >> tempChar;
-				    if (tempChar != ')') {
-					    debug_output("ERROR: poorly formed regen block syntax, missing ')'");
-					    break;
-				    }
-
-                    newPiece = new RegenBlock(hasInfiniteLife, pieceWLoc, pieceHLoc);
-                    break;
-                }
-
-                case GameLevel::WARP_PORTAL_CHAR: {
-                    // Special -- this is NOT a block, it's an indicator that adds a warp portal to the level,
-                    // the piece will be treated as an empty space block, but a warp portal object will be added...
-                    
-                    char tempChar;
-
-                    *inFile >> tempChar;
-                    if (tempChar != '(') {
-                        debug_output("ERROR: poorly formed warp portal syntax, missing '('");
-                        break;
-                    }
-                    // Read in the start and end times for the portal
-                    double startTimeInSecs = 0;
-                    double endTimeInSecs = -1;
-                    
-                    if (!(*inFile >> startTimeInSecs)) {
-                        debug_output("ERROR: poorly formed warp portal syntax, missing/invalid start time.");
-                        break;
-                    }
-
-                    *inFile >> tempChar;
-                    if (tempChar != ',') {
-                        debug_output("ERROR: poorly formed warp portal syntax, missing ','");
-                        break;
-                    }
-
-                    if (!(*inFile >> endTimeInSecs)) {
-                        debug_output("ERROR: poorly formed warp portal syntax, missing/invalid end time.");
-                        break;
-                    }
-
-                    // Now read in the world name and level number that the portal warps to...
-                    std::string warpWorldName;
-                    int warpLevelNum;
-                    if (!(*inFile >> warpWorldName)) {
-                        debug_output("ERROR: poorly formed warp portal syntax, missing warp world.");
-                        break;
-                    }
-                    // Make sure the world name is valid
-                    GameWorld::WorldStyle warpWorldStyle = GameWorld::GetWorldStyleFromString(warpWorldName);
-                    if (warpWorldStyle == GameWorld::None) {
-                        debug_output("ERROR: poorly formed warp portal syntax, invalid warp world type.");
-                        break;
-                    }
-
-                    *inFile >> tempChar;
-                    if (tempChar != ',') {
-                        debug_output("ERROR: poorly formed warp portal syntax, missing ','");
-                        break;
-                    }
-
-                    if (!(*inFile >> warpLevelNum)) {
-                        debug_output("ERROR: poorly formed warp portal syntax, missing warp level number.");
-                        break;
-                    }
-                    if (warpLevelNum <= 0 || warpLevelNum > 20) {
-                        debug_output("ERROR: poorly formed warp portal syntax, invalid warp level number, must be in [1,20].");
-                        break;
-                    }
-
-                    *inFile >> tempChar;
-                    if (tempChar != ')') {
-                        debug_output("ERROR: poorly formed warp portal syntax, missing ')'");
-                        break;
-                    }
-                    
-                    warpPortalInfo.Init(pieceWLoc, pieceHLoc, startTimeInSecs, endTimeInSecs, warpWorldStyle, warpLevelNum);
-                    newPiece = new EmptySpaceBlock(pieceWLoc, pieceHLoc);
-                    break;
-                }
-
-				default:
-					debug_output("ERROR: Invalid level interior value: " << currBlock << " at width = " << pieceWLoc << ", height = " << pieceHLoc);
-					delete inFile;
-					inFile = NULL;
-					GameLevel::CleanUpFileReadData(levelPieces);
-					return NULL;
-			}
-
-            // Check to see if there's a trigger ID for the block...
-            if (newPiece != NULL) {
-                char nextChar = inFile->peek();
-                if (nextChar == '{') {
-                    // There's a trigger ID available, read it!
-                    std::string triggerIDWithBraces;
-                    if (!(*inFile >> triggerIDWithBraces)) {
-                        debug_output("ERROR: Trigger ID could not be properly read from file.");
-                        delete newPiece;
-                        newPiece = NULL;
-                    }
-                    else {
-                        std::string triggerIDStr = triggerIDWithBraces.substr(1, triggerIDWithBraces.size()-2);
-                        if (triggerIDStr.empty()) {
-                            debug_output("ERROR: Invalid (empty) trigger ID found in level file.");
-                            delete newPiece;
-                            newPiece = NULL;
-                        }
-                        else {
-                            LevelPiece::TriggerID triggerID = atoi(triggerIDStr.c_str());
-                            if (triggerID < 0) {
-                                debug_output("ERROR: Invalid (< 0) trigger ID found in level file.");
-                                delete newPiece;
-                                newPiece = NULL;
-                            }
-                            else {
-                                newPiece->SetTriggerID(triggerID);
-                            }
-                        }
-                    }
-                }
-            }
-
-			if (newPiece == NULL) {
-				assert(false);
-				debug_output("ERROR: Invalid level piece found.");
-				delete inFile;
-				inFile = NULL;
-				GameLevel::CleanUpFileReadData(levelPieces);
-				return NULL;
-			}
-
-			currentRowPieces.push_back(newPiece);
-			if (newPiece->MustBeDestoryedToEndLevel()) {
-				numVitalPieces++;
-			}
-		}
-
-		levelPieces.insert(levelPieces.begin(), currentRowPieces);
-	}
-
-    // Get the star milestone totals
-    std::string tempReadStr;
-    long pointAmount;
-    long starAwardScores[GameLevel::MAX_STARS_PER_LEVEL];
-    if ((*inFile >> tempReadStr) && tempReadStr.compare(GameLevel::STAR_POINT_MILESTONE_KEYWORD) == 0) {
-        for (int i = 0; i < GameLevel::MAX_STARS_PER_LEVEL; i++) {
-            if (*inFile >> pointAmount) {
-                starAwardScores[i] = pointAmount;
-            }
-            else {
-                debug_output("ERROR: No star point milestone for star #" << i << " was found.");
-	            GameLevel::CleanUpFileReadData(levelPieces);
-	            delete inFile;
-	            inFile = NULL;
-	            return NULL;
-            }
-        }
-    }
-    else {
-        debug_output("ERROR: No '" << GameLevel::STAR_POINT_MILESTONE_KEYWORD << "' keyword was found.");
-	    GameLevel::CleanUpFileReadData(levelPieces);
-	    delete inFile;
-	    inFile = NULL;
-	    return NULL;
-    }
-
-	// Finished reading in all the blocks for the level, now read in the allowed item drops and their probabilities...
-	std::string itemTypeName;
-	int probabilityNum = 0;
-	size_t randomItemProbabilityNum = 0;
-	std::vector<GameItem::ItemType> allowedDropTypes;
-	while (*inFile >> itemTypeName) {
-        if (itemTypeName.compare(GameLevel::PADDLE_STARTING_X_POS_KEYWORD) == 0) {
-            for (int i = 0; i < static_cast<int>(itemTypeName.size()); i++) {
-                inFile->unget();
-            }
-            break;
-        }
-
-		// There are some special keywords that we need to check for first...
-		if (itemTypeName.compare(ALL_ITEM_TYPES_KEYWORD) == 0 ||
-            itemTypeName.compare(POWERUP_ITEM_TYPES_KEYWORD) == 0 ||
-            itemTypeName.compare(POWERNEUTRAL_ITEM_TYPES_KEYWORD) == 0 ||
-            itemTypeName.compare(POWERDOWN_ITEM_TYPES_KEYWORD) == 0) {
-
-			assert(false);
-            debug_output("ERROR: Item collection keywords no longer supported");
-            GameLevel::CleanUpFileReadData(levelPieces);
-            delete inFile;
-            inFile = NULL;
-            return NULL;
-		}
-		else {
-            // There's a special case to look for: if the string read in was the ITEM_AVAILABLE_ONLY_IF_UNLOCKED_CHAR
-            // then we will only include the item in the level if it's unlocked!
-            bool onlyIncludeIfAvailable = false;
-            if (itemTypeName.size() == 1 && itemTypeName[0] == ITEM_AVAILABLE_ONLY_IF_UNLOCKED_CHAR) {
-                onlyIncludeIfAvailable = true;
-                if (!(*inFile >> itemTypeName)) {
-                    GameLevel::CleanUpFileReadData(levelPieces);
-                    delete inFile;
-                    inFile = NULL;
-                    return NULL;
-                }
-            }
-
-			if (!GameItemFactory::GetInstance()->IsValidItemTypeName(itemTypeName)) {
-				debug_output("ERROR: Invalid item type name found in allowable item drop probability list: '" << itemTypeName << "'");
-				GameLevel::CleanUpFileReadData(levelPieces);
-				delete inFile;
-				inFile = NULL;
-				return NULL;
-			}
-
-			if (*inFile >> probabilityNum) {
-				if (probabilityNum < 0) {
-					debug_output("ERROR: Poorly formated item drop probability number - must be >= 0.");
-					GameLevel::CleanUpFileReadData(levelPieces);
-					delete inFile;
-					inFile = NULL;
-					return NULL;
-				}
-				else {
-                    
-					GameItem::ItemType currItemType = GameItemFactory::GetInstance()->GetItemTypeFromName(itemTypeName);
-
-                    if (!onlyIncludeIfAvailable ||
-                        !ResourceManager::GetInstance()->GetBlammopedia()->GetItemEntry(currItemType)->GetIsLocked()) {
-
-					    // Ignore random item types...
-					    if (currItemType == GameItem::RandomItem) {
-						    randomItemProbabilityNum = probabilityNum;
-						    continue;
-					    }
-					    for (int i = 0; i < probabilityNum; i++) {
-						    allowedDropTypes.push_back(currItemType);
-					    }
-                    }
-				}
-			}
-			else {
-				debug_output("ERROR: Poorly formated item drop probability list - missing probability number.");
-				GameLevel::CleanUpFileReadData(levelPieces);
-				delete inFile;
-				inFile = NULL;
-				return NULL;
-			}	
-		}
-	}
-
-	// If there are no allowed drop types then there should be a zero random item drop probability
-	if (allowedDropTypes.empty()) {
-		randomItemProbabilityNum = 0;
-	}
-
-    // Get the x-coordinate where the paddle starts the level (and goes to when the ball dies), 
-    // if this is missing then the default (center of the entire level) will be used
-    float paddleStartXPos = GameLevel::DEFAULT_PADDLE_START_IDX;
-    if ((*inFile >> tempReadStr) && tempReadStr.compare(GameLevel::PADDLE_STARTING_X_POS_KEYWORD) == 0) {
-        if (!(*inFile >> paddleStartXPos)) {
-            debug_output("ERROR: No paddle starting block index value was provided with keyword!");
-            GameLevel::CleanUpFileReadData(levelPieces);
-            delete inFile;
-            inFile = NULL;
-            return NULL;
-        }
-    }
-
-	delete inFile;
-	inFile = NULL;
-
-	// Go through all of the portal blocks and make sure they loaded properly...
-	for (std::map<char, PortalBlock*>::iterator iter = portalBlocks.begin(); iter != portalBlocks.end(); ++iter) {
-		if (iter->second == NULL || iter->second->GetSiblingPortal() == NULL || iter->second->GetWidthIndex() < 0
-				|| iter->second->GetHeightIndex() < 0) {
-			debug_output("ERROR: Poorly formatted portal blocks.");
-			GameLevel::CleanUpFileReadData(levelPieces);
-			return NULL;
-		}
-	}
-
-	// Go through all the pieces and initialize their bounding values appropriately
-	for (size_t h = 0; h < levelPieces.size(); h++) {
-		for (size_t w = 0; w < levelPieces[h].size(); w++) {
-			GameLevel::UpdatePiece(levelPieces, h, w);
-		}
-	}
-
-    // Build the level based on whether it has a boss or not
-    if (levelHasBoss) {
-        Boss* boss = Boss::BuildStyleBoss(gameModel, style);
-        if (boss == NULL) {
-            assert(false);
-            GameLevel::CleanUpFileReadData(levelPieces);
-            return NULL;
-        }
-    
-        return new GameLevel(levelIdx, filepath, levelName, levelPieces, milestoneStarAmt, boss, 
-            allowedDropTypes, randomItemProbabilityNum, paddleStartXPos);
-
-    }
-    else {
-	    return new GameLevel(levelIdx, filepath, levelName, numVitalPieces, levelPieces, milestoneStarAmt, 
-            allowedDropTypes, randomItemProbabilityNum, starAwardScores, paddleStartXPos, 
-            warpPortalInfo.BuildWarpPortal());
-    }
-}
-
-/**
- * Reads a list of items from a level file. The list has the following format:
- * "(i0,i1,i2,...)"
- * Where ... means the list can continue indefinitely. There are also possible keywords in 
- * the list for allpowerups, allpowerdowns, allpowerneutrals, and all.
- */
-bool GameLevel::ReadItemList(std::stringstream& inFile, std::vector<GameItem::ItemType>& items) {
-    
-    char tempChar;
-    inFile >> tempChar;
-    if (tempChar != '(') {
-	    debug_output("ERROR: poorly formed item drop block syntax, missing '('");
-	    return false;
-    }		
-
-    // Read each of the item type names and set the proper possible item drops for the item drop block...
-    std::string tempStr;
-    inFile >> tempStr;
-
-    // If the temporary string doesn't contain a closing bracket, we need to keep reading...
-    std::string anotherTempStr = tempStr;
-    while (anotherTempStr.find(")") == std::string::npos && inFile >> anotherTempStr) {
-        tempStr = tempStr + " " + anotherTempStr;
-    }
-
-    std::vector<std::string> itemNames;
-
-    // Careful of the case where there's a curly bracket - we want to get rid of the curly bracket in that case
-    size_t curlyBracketPos = tempStr.find_first_of("{");
-    if (curlyBracketPos != std::string::npos) {
-        stringhelper::Tokenize(tempStr, itemNames, "{");
-        std::string putBackIntoStream = tempStr.substr(curlyBracketPos);
-        inFile.seekg(-static_cast<int>(putBackIntoStream.size()), std::ios_base::cur);
-        tempStr = itemNames.front();
-        itemNames.clear();
-    }
-    stringhelper::Tokenize(tempStr, itemNames, ",) \t\r\n"); 
+						else {
+							newPiece = new BreakableTriangleBlock(cell.blockType, orientation, pieceWLoc, pieceHLoc);
+						}
+					}
+					break;
 
-    // Make sure there's at least one item defined
-    if (itemNames.empty()) {
-	    debug_output("ERROR: poorly formed item list syntax, no item types defined");
-	    return false;
-    }
+				case GameLevel::ITEM_DROP_BLOCK_CHAR: {
+						std::vector<GameItem::ItemType> itemTypes;
+						if (!BuildItemList(level, cell, itemTypes)) {
+							break;
+						}
+						newPiece = new ItemDropBlock(itemTypes, pieceWLoc, pieceHLoc);
+					}
+					break;
 
-    items.clear();
+                case GameLevel::SWITCH_BLOCK_CHAR:
+                    newPiece = new SwitchBlock(cell.values[0], pieceWLoc, pieceHLoc);
+                    break;
 
-    // Figure out the item types from the names...
-    bool onlyAvailableIfUnlocked = false;
-    for (int i = 0; i < static_cast<int>(itemNames.size()); i++) {
-	    std::string currItemName = stringhelper::trim(itemNames[i]);
+                case GameLevel::ONE_WAY_BLOCK_CHAR:
+                    newPiece = new OneWayBlock(static_cast<OneWayBlock::OneWayDir>(cell.values[0]), pieceWLoc, pieceHLoc);
+                    break;
 
-	    // There are some special keywords that we need to check for first...
-	    if (currItemName.compare(ALL_ITEM_TYPES_KEYWORD) == 0 || 
-            currItemName.compare(POWERUP_ITEM_TYPES_KEYWORD) == 0 || 
-            currItemName.compare(POWERNEUTRAL_ITEM_TYPES_KEYWORD) == 0 ||
-            currItemName.compare(POWERDOWN_ITEM_TYPES_KEYWORD) == 0) {
+                case GameLevel::NO_ENTRY_BLOCK_CHAR:
+                    newPiece = new NoEntryBlock(pieceWLoc, pieceHLoc);
+                    break;
 
-		    assert(false);
-            debug_output("ERROR: Item collection keywords no longer supported!");
-            return false;
-	    }
-	    else {
+                case GameLevel::LASER_TURRET_BLOCK_CHAR:
+                    newPiece = new LaserTurretBlock(pieceWLoc, pieceHLoc);
+                    break;
 
-            // Check to see if the name is actually a star, if it is then that signals that the
-            // item should only drop if it has been unlocked...
-            if (currItemName.size() == 1 && currItemName[0] == ITEM_AVAILABLE_ONLY_IF_UNLOCKED_CHAR) {
-                onlyAvailableIfUnlocked = true;
-                continue;
-            }
+                case GameLevel::ROCKET_TURRET_BLOCK_CHAR:
+                    newPiece = new RocketTurretBlock(pieceWLoc, pieceHLoc);
+                    break;
 
-		    // Check for manual entry of a specific item type name...
-		    bool isValid = GameItemFactory::GetInstance()->IsValidItemTypeName(currItemName);
-		    if (!isValid) {
-			    debug_output("ERROR: poorly formed item list syntax, no item drop type found for item \"" + currItemName + "\"");
-			    return false;
-		    }
-            GameItem::ItemType itemType = GameItemFactory::GetInstance()->GetItemTypeFromName(currItemName);
-
-            // Check to see if the next string is actually a likelihood number
-            int likelihoodNumber = 1;
-            if (i < static_cast<int>(itemNames.size())-1) {
-                std::string likelihoodStr = itemNames[i+1];
-
-                if (stringhelper::IsPositiveNumber(likelihoodStr)) {
-                    std::stringstream tempStrStream(likelihoodStr);
-                    tempStrStream >> likelihoodNumber;
-                    if (likelihoodNumber > 3 || likelihoodNumber < 0) {
-                        debug_output("ERROR: Invalid likelihood number found");
-                        return false;
-                    }
-                    i++;
-                }
-            }
+                case GameLevel::MINE_TURRET_BLOCK_CHAR:
+                    newPiece = new MineTurretBlock(pieceWLoc, pieceHLoc);
+                    break;
 
-            if (!onlyAvailableIfUnlocked || !ResourceManager::GetInstance()->GetBlammopedia()->GetItemEntry(itemType)->GetIsLocked()) {
-                for (int i = 0; i < likelihoodNumber; i++) {
-		            items.push_back(itemType);
+                case GameLevel::ALWAYS_DROP_BLOCK_CHAR: {
+					std::vector<GameItem::ItemType> itemTypes;
+					if (!BuildItemList(level, cell, itemTypes)) {
+						break;
+					}
+					newPiece = new AlwaysDropBlock(itemTypes, pieceWLoc, pieceHLoc);
+                    break;
                 }
-            }
-	    }
 
-        onlyAvailableIfUnlocked = false;
-    }
+                case GameLevel::REGEN_BLOCK_CHAR:
+                    newPiece = new RegenBlock((cell.flags & CompiledLevel::INFINITE_LIFE_FLAG) != 0, pieceWLoc, pieceHLoc);
+                    break;
 
-    if (items.empty()) {
-        assert(false);
-        debug_output("Failed to find any valid items in item list.");
-        return false;
-    }
+                case GameLevel::WARP_PORTAL_CHAR: {
+                    // Special -- this is NOT a block, it's an indicator that adds a warp portal to the level,
+                    // the piece will be treated as an empty space block, but a warp portal object will be added...
+                    const CompiledLevel::WarpPortalEntry& warpPortal = level.warpPortals[cell.listStart];
+                    warpPortalInfo.Init(pieceWLoc, pieceHLoc, warpPortal.startTimeInSecs, warpPortal.endTimeInSecs, 
+                        static_cast<GameWorld::WorldStyle>(warpPortal.worldStyle), warpPortal.levelNum);
+                    newPiece = new EmptySpaceBlock(pieceWLoc, pieceHLoc);
+                    break;
+                }
 
-    // Count the number of each item in the vector, if they're all the same 
-    // then we can reduce the size of the vector and avoid duplicates
-    
-    std::map<GameItem::ItemType, int> countMap;  
-    for (std::vector<GameItem::ItemType>::iterator iter = items.begin(); iter != items.end(); ++iter) {
-        std::map<GameItem::ItemType, int>::iterator findIter = countMap.find(*iter);
-        if (findIter == countMap.end()) {
-            countMap[*iter] = 1;
-        }
-        else {
-            findIter->second++;
-        }
-    }
+				default:
+					debug_output("ERROR: Invalid level interior value: " << cell.pieceType << " at width = " << pieceWLoc << ", height = " << pieceHLoc);
+					return false;
+			}
 
-    assert(!countMap.empty());
-    std::map<GameItem::ItemType, int>::const_iterator mapIter = countMap.begin();
-    
-    bool countIsTheSame = true;
-    int lastCount = mapIter->second;
-    ++mapIter;
+			if (newPiece == NULL) {
+				assert(false);
+				debug_output("ERROR: Invalid level piece found.");
+				return false;
+			}
 
-    for (; mapIter != countMap.end(); ++mapIter) {
-        if (lastCount != mapIter->second) {
-            countIsTheSame = false;
-            break;
-        }
-    }
+            if (cell.triggerID != LevelPiece::NO_TRIGGER_ID) {
+                newPiece->SetTriggerID(cell.triggerID);
+            }
 
-    if (countIsTheSame && lastCount > 1) {
-        items.clear();
-        items.resize(countMap.size());
-        int count = 0;
-        // Simplify the items vector by having one of each item in it...
-        for (mapIter = countMap.begin(); mapIter != countMap.end(); ++mapIter, count++) {
-            items[count] = mapIter->first;
-        }
-    }
+			currentRowPieces.push_back(newPiece);
+			if (newPiece->MustBeDestoryedToEndLevel()) {
+				numVitalPieces++;
+			}
+		}
+	}
 
-    return true;
+	return true;
 }
 
 void GameLevel::CleanUpFileReadData(std::vector<std::vector<LevelPiece*> >& levelPieces) {
@@ -1596,6 +953,8 @@ void GameLevel::PieceChanged(GameModel* gameModel, LevelPiece* pieceBefore,
 	assert(pieceBefore != NULL);
 	assert(pieceAfter != NULL);
 
+    this->pieceChangeCount++;
+
     // Add whatever number of points are acquired for the piece change to the player's score
     // NOTE: Make sure this is done before incrementing the number of interim
     // blocks destroyed - otherwise the multiplier will be applied before the incremented score!
@@ -1670,6 +1029,8 @@ void GameLevel::UpdateBoundsOnPieceAndSurroundingPieces(LevelPiece* piece) {
 	unsigned int hIndex = piece->GetHeightIndex();
 	unsigned int wIndex = piece->GetWidthIndex();
 
+    this->pieceChangeCount++;
+
 	// Update the neighbour's bounds...
     GameLevel::UpdatePiece(this->currentLevelPieces, hIndex, wIndex);     // center
 	GameLevel::UpdatePiece(this->currentLevelPieces, hIndex, wIndex-1);   // left
@@ -1897,13 +1258,13 @@ void GameLevel::MineExplosion(GameModel* gameModel, const MineProjectile* mine)
     }
 
     // Do block testing for collisions with the mine explosion
-    std::vector<LevelPiece*> closestPieces;
+    LevelPieceCandidateBuffer closestPieces;
     this->GetLevelPieceCollisionCandidatesNotMoving(minePosition, mine->GetWidth(), closestPieces);
-    if (closestPieces.empty()) {
+    if (closestPieces.IsEmpty()) {
         return;
     }
 
-    LevelPiece* centerPieceAfterDestruction = closestPieces.front()->Destroy(gameModel, LevelPiece::MineDestruction);
+    LevelPiece* centerPieceAfterDestruction = closestPieces.GetFirst()->Destroy(gameModel, LevelPiece::MineDestruction);
     
     std::set<LevelPiece*> affectedPieces =
         this->GetExplosionAffectedLevelPieces(mine, mineSizeFactor, centerPieceAfterDestruction);
@@ -2038,17 +1399,17 @@ void GameLevel::RebuildTeslaLightningBoundingLines() {
 }
 
 /**
- * Private helper function for finding a set of level pieces within the given range of values
- * indexing along the x and y axis.
- * Return: Set of level pieces included in the given bounds.
+ * Private helper function for clamping a range of values indexing along the x and y axis
+ * of the level grid so that they lie within the level.
+ * Return: false if the range lies completely outside of the level, true otherwise.
  */
-void GameLevel::IndexCollisionCandidates(float xIndexMin, float xIndexMax, 
-                                         float yIndexMin, float yIndexMax, std::set<LevelPiece*>& candidates) const {
+bool GameLevel::ClampCollisionIndices(float& xIndexMin, float& xIndexMax, 
+                                      float& yIndexMin, float& yIndexMax) const {
 
 	// Check to see if we're completely out of bounds first...
 	if (xIndexMin >= static_cast<float>(this->width) || yIndexMin >= static_cast<float>(this->height) ||
 		  xIndexMax < 0.0f || yIndexMax < 0.0f) {
-		return;
+		return false;
 	}
 
 	xIndexMin = std::max<float>(0.0f, xIndexMin);
@@ -2058,33 +1419,56 @@ void GameLevel::IndexCollisionCandidates(float xIndexMin, float xIndexMax,
 
 	assert(xIndexMin <= xIndexMax);
 	assert(yIndexMin <= yIndexMax);
-	
-	for (int x = xIndexMin; x <= xIndexMax; x++) {
-		for (int y = yIndexMin; y <= yIndexMax; y++) {
-			candidates.insert(this->currentLevelPieces[y][x]);
+    return true;
+}
+
+/**
+ * Private helper function for finding the level pieces within the given range of values
+ * indexing along the x and y axis. The buffer is cleared first, pieces are added in the 
+ * row-major order of the level grid.
+ */
+void GameLevel::IndexCollisionCandidates(float xIndexMin, float xIndexMax, float yIndexMin, float yIndexMax, 
+                                         LevelPieceCandidateBuffer& candidates) const {
+    candidates.Clear();
+    if (!this->ClampCollisionIndices(xIndexMin, xIndexMax, yIndexMin, yIndexMax)) {
+        return;
+    }
+
+	for (int y = yIndexMin; y <= yIndexMax; y++) {
+        const std::vector<LevelPiece*>& currRow = this->currentLevelPieces[y];
+		for (int x = xIndexMin; x <= xIndexMax; x++) {
+			candidates.Add(currRow[x]);
 		}
 	}
 }
 
-// Used for sorting (using STL)...
-struct PieceAndSqrDist {
-    LevelPiece* piece;
-    float sqrDist;
-    PieceAndSqrDist(LevelPiece* piece, float sqrDist) : piece(piece), sqrDist(sqrDist) {}
-
-};
+/**
+ * Private helper function for finding a set of level pieces within the given range of values
+ * indexing along the x and y axis.
+ * Return: Set of level pieces included in the given bounds (added to the given set).
+ */
+void GameLevel::IndexCollisionCandidates(float xIndexMin, float xIndexMax, 
+                                         float yIndexMin, float yIndexMax, std::set<LevelPiece*>& candidates) const {
 
-bool ComparePieceAndSqrDist(const PieceAndSqrDist& e1, const PieceAndSqrDist& e2) {
-  return e1.sqrDist < e2.sqrDist;
+    if (!this->ClampCollisionIndices(xIndexMin, xIndexMax, yIndexMin, yIndexMax)) {
+        return;
+    }
+	
+	for (int y = yIndexMin; y <= yIndexMax; y++) {
+        const std::vector<LevelPiece*>& currRow = this->currentLevelPieces[y];
+		for (int x = xIndexMin; x <= xIndexMax; x++) {
+			candidates.insert(currRow[x]);
+		}
+	}
 }
 
 bool GameLevel::IsCollidingWithLevelPieces(const Point2D& center, float radius) const {
 
-    std::set<LevelPiece*> candidates;
+    LevelPieceCandidateBuffer candidates;
     this->GetLevelPieceCollisionCandidatesNoSort(center, radius, candidates);
     
     Collision::Circle2D circle(center, radius);
-    for (std::set<LevelPiece*>::const_iterator iter = candidates.begin(); iter != candidates.end(); ++iter) {
+    for (LevelPieceCandidateBuffer::const_iterator iter = candidates.begin(); iter != candidates.end(); ++iter) {
         LevelPiece* currPiece = *iter;
         assert(currPiece != NULL);
         if (!currPiece->IsNoBoundsPieceType() && Collision::IsCollision(currPiece->GetAABB(), circle)) {
@@ -2094,8 +1478,12 @@ bool GameLevel::IsCollidingWithLevelPieces(const Point2D& center, float radius)
     return false;
 }
 
+/**
+ * Obtain the level pieces with bounds that are around the given stationary circle, 
+ * sorted from closest to furthest.
+ */
 void GameLevel::GetLevelPieceCollisionCandidatesNotMoving(const Point2D& center, float radius,
-                                                          std::vector<LevelPiece*>& candidates) const {
+                                                          LevelPieceCandidateBuffer& candidates) const {
 
 	float xNonAdjustedIndex = center[0] / LevelPiece::PIECE_WIDTH;
 	float xIndexMax = floorf(xNonAdjustedIndex + radius); 
@@ -2105,35 +1493,32 @@ void GameLevel::GetLevelPieceCollisionCandidatesNotMoving(const Point2D& center,
 	float yIndexMax = floorf(yNonAdjustedIndex + radius);
 	float yIndexMin = floorf(yNonAdjustedIndex - radius);
 
-    std::set<LevelPiece*> candidateSet;
-    this->IndexCollisionCandidates(xIndexMin, xIndexMax, yIndexMin, yIndexMax, candidateSet);
+    candidates.Clear();
+    if (!this->ClampCollisionIndices(xIndexMin, xIndexMax, yIndexMin, yIndexMax)) {
+        return;
+    }
 
-    std::vector<PieceAndSqrDist> tempSortVec;
-    tempSortVec.reserve(candidateSet.size());
+	for (int y = yIndexMin; y <= yIndexMax; y++) {
+        const std::vector<LevelPiece*>& currRow = this->currentLevelPieces[y];
+		for (int x = xIndexMin; x <= xIndexMax; x++) {
+            LevelPiece* currPiece = currRow[x];
+            if (!currPiece->IsNoBoundsPieceType()) {
+			    candidates.Add(currPiece);
+            }
+		}
+	}
 
-    for (std::set<LevelPiece*>::const_iterator iter = candidateSet.begin(); iter != candidateSet.end(); ++iter) {
-        LevelPiece* currPiece = *iter;
-        if (!currPiece->IsNoBoundsPieceType()) {
-            tempSortVec.push_back(PieceAndSqrDist(currPiece, Point2D::SqDistance(center, currPiece->GetBounds().ClosestPoint(center))));
-        }
-    }
-    
-    std::sort(tempSortVec.begin(), tempSortVec.end(), ComparePieceAndSqrDist);
-    
-    candidates.reserve(tempSortVec.size());
-    for (std::vector<PieceAndSqrDist>::const_iterator iter = tempSortVec.begin(); iter != tempSortVec.end(); ++iter) {
-        candidates.push_back(iter->piece);
-    }
+    candidates.SortByDistanceTo(center);
 }
 
 /** 
  * Public function for obtaining the level pieces that may currently be
  * in collision with the given gameball. Note: dT is the time delta that the ball has yet-to-travel in this tick.
- * Returns: array of unique LevelPieces that are possibly colliding with b.
+ * Returns: unique LevelPieces that are possibly colliding with b, closest first when sortByDistance is true.
  */
 void GameLevel::GetLevelPieceCollisionCandidates(double dT, const Point2D& center, 
                                                  float radius, float velocityMagnitude, 
-                                                 std::vector<LevelPiece*>& candidates) const {
+                                                 LevelPieceCandidateBuffer& candidates, bool sortByDistance) const {
 
     radius += dT * velocityMagnitude;
 
@@ -2145,22 +1530,9 @@ void GameLevel::GetLevelPieceCollisionCandidates(double dT, const Point2D& cente
 	float yIndexMax = floorf(yNonAdjustedIndex + radius);
 	float yIndexMin = floorf(yNonAdjustedIndex - radius);
 
-    std::set<LevelPiece*> candidateSet;
-    this->IndexCollisionCandidates(xIndexMin, xIndexMax, yIndexMin, yIndexMax, candidateSet);
-
-    std::vector<PieceAndSqrDist> tempSortVec;
-    tempSortVec.reserve(candidateSet.size());
-
-    for (std::set<LevelPiece*>::const_iterator iter = candidateSet.begin(); iter != candidateSet.end(); ++iter) {
-        LevelPiece* currPiece = *iter;
-        tempSortVec.push_back(PieceAndSqrDist(currPiece, Point2D::SqDistance(center, currPiece->GetBounds().ClosestPoint(center))));
-    }
-    
-    std::sort(tempSortVec.begin(), tempSortVec.end(), ComparePieceAndSqrDist);
-    
-    candidates.reserve(tempSortVec.size());
-    for (std::vector<PieceAndSqrDist>::const_iterator iter = tempSortVec.begin(); iter != tempSortVec.end(); ++iter) {
-        candidates.push_back(iter->piece);
+    this->IndexCollisionCandidates(xIndexMin, xIndexMax, yIndexMin, yIndexMax, candidates);
+    if (sortByDistance) {
+        candidates.SortByDistanceTo(center);
     }
 }
 
@@ -2175,7 +1547,7 @@ void GameLevel::GetLevelPieceCollisionCandidates(const Collision::AABB2D& aabb,
 }
 
 void GameLevel::GetLevelPieceCollisionCandidatesNoSort(const Point2D& center, float radius,
-                                                       std::set<LevelPiece*>& candidates) const {
+                                                       LevelPieceCandidateBuffer& candidates) const {
 
 	// Get the ball boundary and use it to figure out what level pieces are relevant
 	// Find the non-rounded max and min indices to look at along the x and y axis
@@ -2193,11 +1565,12 @@ void GameLevel::GetLevelPieceCollisionCandidatesNoSort(const Point2D& center, fl
 /** 
  * Public function for obtaining the level pieces that may currently be
  * in collision with the given projectile.
- * Returns: array of unique LevelPieces that are possibly colliding with p.
+ * Returns: unique LevelPieces that are possibly colliding with p.
  */
 void GameLevel::GetLevelPieceCollisionCandidates(double dT, const Point2D& center, const BoundingLines& bounds, 
-                                                 float velocityMagnitude, std::set<LevelPiece*>& candidates) const {
+                                                 float velocityMagnitude, LevelPieceCandidateBuffer& candidates) const {
     if (bounds.IsEmpty()) {
+        candidates.Clear();
         return;
     }
 
@@ -2217,10 +1590,10 @@ void GameLevel::GetLevelPieceCollisionCandidates(double dT, const Point2D& cente
 
 /**
  * Obtain the level pieces that may currently be colliding with the given paddle.
- * Returns: array of unique LevelPieces that are possibly colliding with p.
+ * Returns: unique LevelPieces that are possibly colliding with p.
  */
 void GameLevel::GetLevelPieceCollisionCandidates(const PlayerPaddle& p, bool includeAttachedBall, 
-                                                 std::set<LevelPiece*>& candidates) const {
+                                                 LevelPieceCandidateBuffer& candidates) const {
 
 	Collision::AABB2D paddleAABB = p.GetPaddleAABB(includeAttachedBall);
 	const Point2D& maxPt = paddleAABB.GetMax();
@@ -2281,50 +1654,224 @@ LevelPiece* GameLevel::GetLevelPieceAt(const Point2D& p) const {
     return this->currentLevelPieces[yIndex][xIndex];
 }
 
-LevelPiece* GameLevel::GetLevelPieceColliderFast(const Collision::Ray2D& ray,  
-                                                 float toleranceRadius) const {
+// Checks whether the given piece is within the tolerance radius of the given ray, gives the distance along the ray
+// of the first point on it that's within the tolerance radius of the piece
+static bool ToleranceCollisionCheck(const LevelPiece& piece, const Collision::Ray2D& ray, float toleranceRadius, float& rayT) {
+    assert(toleranceRadius > 0.0f);
+    static const int NUM_SEARCH_ITERATIONS = 24;
+
+    // Find the part of the ray that's inside the piece's bounding box grown by the tolerance radius
+    Collision::AABB2D pieceAABB = piece.GetAABB();
+    Vector2D toleranceVec(toleranceRadius, toleranceRadius);
+    float tStart, tEnd;
+    if (!Collision::IsCollision(ray, Collision::AABB2D(pieceAABB.GetMin() - toleranceVec, pieceAABB.GetMax() + toleranceVec), tStart, tEnd)) {
+        return false;
+    }
+
+    // The distance from the ray to the box is convex along the ray, so the closest approach can be found with a
+    // ternary search and the first point within the tolerance radius can then be found with a bisection before it
+    float lowT  = tStart;
+    float highT = tEnd;
+    for (int i = 0; i < NUM_SEARCH_ITERATIONS; i++) {
+        float t1 = lowT + (highT - lowT) / 3.0f;
+        float t2 = highT - (highT - lowT) / 3.0f;
+        if (Collision::SqDistFromPtToAABB(pieceAABB, ray.GetPointAlongRayFromOrigin(t1)) <= 
+            Collision::SqDistFromPtToAABB(pieceAABB, ray.GetPointAlongRayFromOrigin(t2))) {
+            highT = t2;
+        }
+        else {
+            lowT = t1;
+        }
+    }
+    const float closestT = 0.5f * (lowT + highT);
+    const float sqToleranceRadius = toleranceRadius * toleranceRadius;
+    if (Collision::SqDistFromPtToAABB(pieceAABB, ray.GetPointAlongRayFromOrigin(closestT)) > sqToleranceRadius) {
+        return false;
+    }
 
-    // Step along the ray - not a perfect algorithm but will result in something very reasonable
-    // NOTE: if the step size is too large then the ray might skip over entire sections of blocks - BECAREFUL!
-    const float STEP_SIZE = 0.5f * std::min<float>(LevelPiece::PIECE_WIDTH, LevelPiece::PIECE_HEIGHT);
-    int NUM_STEPS = static_cast<int>(this->levelHypotenuse / STEP_SIZE);
+    // Let the piece have the final say, some pieces only collide with circles in certain cases
+    if (!piece.CollisionCheck(Collision::Circle2D(ray.GetPointAlongRayFromOrigin(closestT), toleranceRadius), ray.GetUnitDirection())) {
+        return false;
+    }
 
-    Collision::Circle2D toleranceCircle(Point2D(0,0), toleranceRadius);
-    Point2D currSamplePoint;
-    float rayT;
-    std::set<LevelPiece*> collisionCandidates;
+    lowT  = tStart;
+    highT = closestT;
+    for (int i = 0; i < NUM_SEARCH_ITERATIONS; i++) {
+        float midT = 0.5f * (lowT + highT);
+        if (Collision::SqDistFromPtToAABB(pieceAABB, ray.GetPointAlongRayFromOrigin(midT)) <= sqToleranceRadius) {
+            highT = midT;
+        }
+        else {
+            lowT = midT;
+        }
+    }
+    rayT = highT;
+    return true;
+}
 
-    for (int i = 0; i < NUM_STEPS; i++) {
-        currSamplePoint = ray.GetPointAlongRayFromOrigin(i * STEP_SIZE);
+/**
+ * Private helper for the level piece ray queries: walks the cells of the level grid crossed by the given ray in order
+ * of their distance along it (Amanatides-Woo style), up to maxRayT. When there's a tolerance radius every cell within
+ * that radius of the ray is considered as well. Each piece is tested exactly once and the given visitor is told about
+ * the ones the ray collides with. The walk stops as soon as the next cell starts further along the ray than the
+ * visitor's GetStopRayT(), since no piece in it (or any later cell) could collide any sooner.
+ */
+template <typename RayHitVisitor> 
+void GameLevel::TraverseLevelPiecesAlongRay(const Collision::Ray2D& ray, float toleranceRadius,
+                                            float maxRayT, RayHitVisitor& visitor) const {
+
+    if (this->width == 0 || this->height == 0) {
+        return;
+    }
 
-        // Indices of the sampled level piece can be found using the point...
-        collisionCandidates.clear();
-        this->GetLevelPieceCollisionCandidatesNoSort(currSamplePoint, toleranceRadius, collisionCandidates);
+    // Clip the ray to the level grid (grown by the tolerance radius)
+    float tEnter, tExit;
+    if (!Collision::IsCollision(ray, Collision::AABB2D(-toleranceRadius, -toleranceRadius, 
+        this->GetLevelUnitWidth() + toleranceRadius, this->GetLevelUnitHeight() + toleranceRadius), tEnter, tExit) || tEnter > maxRayT) {
+        return;
+    }
+    maxRayT = std::min<float>(maxRayT, tExit);
+
+    const Point2D& origin = ray.GetOrigin();
+    const Vector2D& dir   = ray.GetUnitDirection();
+    const float cellSize[2] = { LevelPiece::PIECE_WIDTH, LevelPiece::PIECE_HEIGHT };
+    const int gridSize[2]   = { static_cast<int>(this->width), static_cast<int>(this->height) };
+
+    // How many neighbouring columns/rows are within the tolerance radius of a cell
+    const int reach[2] = { static_cast<int>(ceilf(toleranceRadius / cellSize[0])), static_cast<int>(ceilf(toleranceRadius / cellSize[1])) };
+
+    // Setup the cell that the ray enters the grid in along with the distances along the ray to the next
+    // cell boundary on each axis and between cell boundaries on each axis
+    Point2D entryPt = ray.GetPointAlongRayFromOrigin(tEnter);
+    int cell[2], step[2];
+    float tNext[2], tDelta[2];
+    for (int i = 0; i < 2; i++) {
+        cell[i] = static_cast<int>(floorf(entryPt[i] / cellSize[i]));
+        if (fabs(dir[i]) < EPSILON) {
+            step[i]   = 0;
+            tNext[i]  = FLT_MAX;
+            tDelta[i] = FLT_MAX;
+        }
+        else {
+            step[i]   = dir[i] > 0.0f ? 1 : -1;
+            tNext[i]  = ((cell[i] + (step[i] > 0 ? 1 : 0)) * cellSize[i] - origin[i]) / dir[i];
+            tDelta[i] = cellSize[i] / fabs(dir[i]);
+        }
+    }
 
-        for (std::set<LevelPiece*>::iterator iter = collisionCandidates.begin(); 
-            iter != collisionCandidates.end(); ++iter) {
+    // The first cell tests everything within reach of it, after that only the column/row of cells
+    // that each step brings within reach needs testing (the walk never goes backwards on either axis)
+    int minCell[2] = { cell[0] - reach[0], cell[1] - reach[1] };
+    int maxCell[2] = { cell[0] + reach[0], cell[1] + reach[1] };
+    float cellEnterT = tEnter;
+    float rayT;
 
-            LevelPiece* currSamplePiece = *iter;
-            assert(currSamplePiece != NULL);
-            if (currSamplePiece->IsNoBoundsPieceType()) {
-                continue;
-            }
+    for (;;) {
+        int xMin = std::max<int>(0, minCell[0]), xMax = std::min<int>(gridSize[0] - 1, maxCell[0]);
+        int yMin = std::max<int>(0, minCell[1]), yMax = std::min<int>(gridSize[1] - 1, maxCell[1]);
+        for (int y = yMin; y <= yMax; y++) {
+            const std::vector<LevelPiece*>& currRow = this->currentLevelPieces[y];
+            for (int x = xMin; x <= xMax; x++) {
+                LevelPiece* currPiece = currRow[x];
+                assert(currPiece != NULL);
+                if (!visitor.IsCandidate(currPiece)) {
+                    continue;
+                }
 
-            // Check to see if the piece can be collided with, if so try to collide the ray with
-            // the actual block bounds, if there's a collision we get out of here and just return the piece
-            if (currSamplePiece->CollisionCheck(ray, rayT)) {
-                return currSamplePiece;
-            }
-            else if (toleranceRadius != 0.0f) {
-                toleranceCircle.SetCenter(currSamplePoint);
-                if (currSamplePiece->CollisionCheck(toleranceCircle, ray.GetUnitDirection())) {
-                    return currSamplePiece;
+                if (currPiece->CollisionCheck(ray, rayT)) {
+                    if (rayT <= maxRayT) {
+                        visitor.Hit(currPiece, rayT);
+                    }
+                }
+                else if (toleranceRadius != 0.0f && ToleranceCollisionCheck(*currPiece, ray, toleranceRadius, rayT)) {
+                    if (rayT <= maxRayT) {
+                        visitor.Hit(currPiece, rayT);
+                    }
                 }
             }
         }
+
+        // Step to the next cell along the ray
+        int axis = (tNext[0] < tNext[1]) ? 0 : 1;
+        cellEnterT = tNext[axis];
+        if (cellEnterT > maxRayT || cellEnterT > visitor.GetStopRayT()) {
+            break;
+        }
+        cell[axis]  += step[axis];
+        tNext[axis] += tDelta[axis];
+
+        int otherAxis = 1 - axis;
+        minCell[otherAxis] = cell[otherAxis] - reach[otherAxis];
+        maxCell[otherAxis] = cell[otherAxis] + reach[otherAxis];
+        minCell[axis] = maxCell[axis] = cell[axis] + step[axis] * reach[axis];
+    }
+}
+
+// Ray visitor for GameLevel::GetLevelPieceColliderFast - stops on the first collision found
+class AnyRayHitVisitor {
+public:
+    AnyRayHitVisitor() : piece(NULL) {}
+    
+    bool IsCandidate(const LevelPiece* p) const { return this->piece == NULL && !p->IsNoBoundsPieceType(); }
+    void Hit(LevelPiece* p, float) { this->piece = p; }
+    float GetStopRayT() const { return this->piece == NULL ? FLT_MAX : -FLT_MAX; }
+
+    LevelPiece* piece;
+};
+
+// Ray visitor for GameLevel::GetLevelPieceFirstCollider - keeps the collision closest to the ray's origin
+class FirstRayHitVisitor {
+public:
+    FirstRayHitVisitor(const std::set<const void*>& ignoreThings) : ignoreThings(ignoreThings), piece(NULL), rayT(FLT_MAX) {}
+
+    bool IsCandidate(const LevelPiece* p) const { return this->ignoreThings.find(p) == this->ignoreThings.end(); }
+    void Hit(LevelPiece* p, float t) {
+        if (t < this->rayT) {
+            this->piece = p;
+            this->rayT  = t;
+        }
+    }
+    float GetStopRayT() const { return this->rayT; }
+
+    const std::set<const void*>& ignoreThings;
+    LevelPiece* piece;
+    float rayT;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(FirstRayHitVisitor);
+};
+
+// Ray visitor for GameLevel::GetLevelPieceColliders - keeps every collision
+class AllRayHitsVisitor {
+public:
+    AllRayHitsVisitor(const std::set<const void*>& ignoreThings, const std::set<LevelPiece::LevelPieceType>& ignorePieceTypes,
+        std::set<LevelPiece*>& result) : ignoreThings(ignoreThings), ignorePieceTypes(ignorePieceTypes), result(result) {}
+
+    bool IsCandidate(const LevelPiece* p) const {
+        return this->ignoreThings.find(p) == this->ignoreThings.end() &&
+            this->ignorePieceTypes.find(p->GetType()) == this->ignorePieceTypes.end();
     }
+    void Hit(LevelPiece* p, float) { this->result.insert(p); }
+    float GetStopRayT() const { return FLT_MAX; }
+
+    const std::set<const void*>& ignoreThings;
+    const std::set<LevelPiece::LevelPieceType>& ignorePieceTypes;
+    std::set<LevelPiece*>& result;
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(AllRayHitsVisitor);
+};
 
-    return NULL;
+/**
+ * Get any piece in the level that collides with the given ray (not necessarily the closest one),
+ * NULL if no collision was found.
+ */
+LevelPiece* GameLevel::GetLevelPieceColliderFast(const Collision::Ray2D& ray,  
+                                                 float toleranceRadius) const {
+
+    AnyRayHitVisitor visitor;
+    this->TraverseLevelPiecesAlongRay(ray, toleranceRadius, FLT_MAX, visitor);
+    return visitor.piece;
 }
 
 /**
@@ -2339,120 +1886,26 @@ LevelPiece* GameLevel::GetLevelPieceFirstCollider(const Collision::Ray2D& ray,
                                                   const std::set<const void*>& ignoreThings,
                                                   float& rayT, float toleranceRadius) const {
 
-	// Step along the ray - not a perfect algorithm but will result in something very reasonable
-	// NOTE: if the step size is too large then the ray might skip over entire sections of blocks - BECAREFUL!
-	const float STEP_SIZE = 0.5f * std::min<float>(LevelPiece::PIECE_WIDTH, LevelPiece::PIECE_HEIGHT);
-	int NUM_STEPS = static_cast<int>(this->levelHypotenuse / STEP_SIZE);
-
-	LevelPiece* returnPiece = NULL;
-	Collision::Circle2D toleranceCircle(Point2D(0,0), toleranceRadius);
-    Point2D currSamplePoint;
-    std::set<LevelPiece*> collisionCandidates;
-
-	for (int i = 0; i < NUM_STEPS; i++) {
-		currSamplePoint = ray.GetPointAlongRayFromOrigin(i * STEP_SIZE);
-		
-		// Indices of the sampled level piece can be found using the point...
-		collisionCandidates.clear();
-        this->GetLevelPieceCollisionCandidatesNoSort(currSamplePoint, toleranceRadius, collisionCandidates);
-		
-        float minRayT = FLT_MAX;
-		for (std::set<LevelPiece*>::iterator iter = collisionCandidates.begin(); iter != collisionCandidates.end(); ++iter) {
-			
-			LevelPiece* currSamplePiece = *iter;
-			assert(currSamplePiece != NULL);
-
-			// Check to see if the piece can be collided with, if so try to collide the ray with
-			// the actual block bounds, if there's a collision we get out of here and just return the piece
-			if (ignoreThings.find(currSamplePiece) == ignoreThings.end()) {
-				if (currSamplePiece->CollisionCheck(ray, rayT)) {
-					// Make sure the piece is along the direction of the ray and not behind it
-					if (rayT < minRayT) {
-						returnPiece = currSamplePiece;
-						minRayT = rayT;
-					}
-				}
-				else if (toleranceRadius != 0.0f) {
-					toleranceCircle.SetCenter(currSamplePoint);
-                    if (currSamplePiece->CollisionCheck(toleranceCircle, ray.GetUnitDirection())) {
-						// TODO: Project the center onto the ray...
-						minRayT = i * STEP_SIZE;
-						returnPiece = currSamplePiece;
-					}
-				}
-			}
-		}
-
-		// If we managed to find a suitable piece (with the lowest ray t), then return it
-		if (returnPiece != NULL) {
-			rayT = minRayT;
-			return returnPiece;
-		}
-	}
-
-	return NULL;
+    FirstRayHitVisitor visitor(ignoreThings);
+    this->TraverseLevelPiecesAlongRay(ray, toleranceRadius, FLT_MAX, visitor);
+    if (visitor.piece != NULL) {
+        rayT = visitor.rayT;
+    }
+    return visitor.piece;
 }
 
+/**
+ * Get all of the pieces in the level (other than the ignored ones) that collide with the given ray
+ * before the given cutoff distance along it. A tolerance radius may be given, this will allow for
+ * checking around the ray.
+ */
 void GameLevel::GetLevelPieceColliders(const Collision::Ray2D& ray, const std::set<const void*>& ignoreThings,
                                        const std::set<LevelPiece::LevelPieceType>& ignorePieceTypes,
                                        std::set<LevelPiece*>& result, float cutoffRayT, float toleranceRadius) const {
     result.clear();
 
-	// Step along the ray - not a perfect algorithm but will result in something very reasonable
-	const float LEVEL_WIDTH	 = this->GetLevelUnitWidth();
-	const float LEVEL_HEIGHT = this->GetLevelUnitHeight();
-	const float LONGEST_POSSIBLE_RAY = sqrt(LEVEL_WIDTH*LEVEL_WIDTH + LEVEL_HEIGHT*LEVEL_HEIGHT);
-
-	// NOTE: if the step size is too large then the ray might skip over entire sections of blocks - BECAREFUL!
-	const float STEP_SIZE = 0.5f * std::min<float>(LevelPiece::PIECE_WIDTH, LevelPiece::PIECE_HEIGHT);
-	int NUM_STEPS = static_cast<int>(LONGEST_POSSIBLE_RAY / STEP_SIZE);
-
-	Collision::Circle2D toleranceCircle(Point2D(0,0), toleranceRadius);
-    std::set<LevelPiece*> collisionCandidates;
-    Point2D currSamplePoint;
-    float rayT;
-	for (int i = 0; i < NUM_STEPS; i++) {
-
-        rayT = i * STEP_SIZE;
-        if (rayT >= cutoffRayT) {
-            break;
-        }
-
-		currSamplePoint = ray.GetPointAlongRayFromOrigin(rayT);
-
-        // Exit the loop if the ray is out of bounds of all level pieces
-        if (currSamplePoint[0] > this->GetLevelUnitWidth() || currSamplePoint[0] < 0.0f ||
-            currSamplePoint[1] > this->GetLevelUnitHeight() || currSamplePoint[1] < 0.0f) {
-            break;
-        }
-
-		// Indices of the sampled level piece can be found using the point...
-        collisionCandidates.clear();
-	    this->GetLevelPieceCollisionCandidatesNoSort(currSamplePoint, toleranceRadius, collisionCandidates);
-		for (std::set<LevelPiece*>::iterator iter = collisionCandidates.begin(); iter != collisionCandidates.end(); ++iter) {
-			
-			LevelPiece* currSamplePiece = *iter;
-			assert(currSamplePiece != NULL);
-
-			// Check to see if the piece can be collided with, if so try to collide the ray with
-			// the actual block bounds, if there's a collision we get out of here and just return the piece
-			if (ignoreThings.find(currSamplePiece) == ignoreThings.end() &&
-                ignorePieceTypes.find(currSamplePiece->GetType()) == ignorePieceTypes.end()) {
-
-				if (currSamplePiece->CollisionCheck(ray, rayT)) {
-					// Make sure the piece is along the direction of the ray and not behind it
-					result.insert(currSamplePiece);
-				}
-				else if (toleranceRadius != 0.0f) {
-					toleranceCircle.SetCenter(currSamplePoint);
-                    if (currSamplePiece->CollisionCheck(toleranceCircle, ray.GetUnitDirection())) {
-						result.insert(currSamplePiece);
-					}
-				}
-			}
-		}
-
-	}
+    AllRayHitsVisitor visitor(ignoreThings, ignorePieceTypes, result);
+    this->TraverseLevelPiecesAlongRay(ray, toleranceRadius, cutoffRayT, visitor);
 }
 
 // Add a newly activated lightning barrier for the Tesla block
@@ -33,6 +33,7 @@
 #define __GAMELEVEL_H__
 
 #include "LevelPiece.h"
+#include "LevelPieceCandidateBuffer.h"
 #include "Projectile.h"
 #include "GameItem.h"
 #include "GameWorld.h"
@@ -48,6 +49,7 @@ class QuadTree;
 class TeslaBlock;
 class PlayerPaddle;
 class WarpPortal;
+struct CompiledLevel;
 
 // Represents a game level, also deals with game level 'lvl' file reading.
 class GameLevel {
@@ -113,10 +115,11 @@ public:
 
 	~GameLevel();
 
-	// Used to create a level from file
-	static GameLevel* CreateGameLevelFromFile(GameModel* gameModel, const GameWorld::WorldStyle& style, 
-        size_t levelIdx, int milestoneStarAmt, std::string filepath);
-    static bool ReadItemList(std::stringstream& inFile, std::vector<GameItem::ItemType>& items);
+	// Used to create a level from file, only the level's metadata and template are loaded until LoadPieces is called
+	static GameLevel* CreateGameLevelFromFile(GameModel* gameModel, size_t levelIdx, int milestoneStarAmt, 
+        const std::string& filepath);
+    // The compiled level isn't copied, it must outlive the created level (e.g., it's in the game's level pack)
+    static GameLevel* CreateGameLevelFromCompiled(size_t levelIdx, int milestoneStarAmt, const CompiledLevel& level);
 
 	/**
 	 * Obtain the set of pieces making up the current state of the level.
@@ -125,6 +128,16 @@ public:
 	const std::vector<std::vector<LevelPiece*> >& GetCurrentLevelLayout() const {
 		return this->currentLevelPieces;
 	}
+    // The pieces that think for themselves (e.g., turrets), they're ticked with TickAIEntities
+    const std::set<LevelPiece*>& GetAIEntities() const {
+        return this->aiEntities;
+    }
+
+    bool LoadPieces(GameModel* gameModel, const GameWorld::WorldStyle& style);
+    void UnloadPieces();
+    bool GetArePiecesLoaded() const {
+        return !this->currentLevelPieces.empty();
+    }
 
 	const std::vector<GameItem::ItemType>& GetAllowableItemDropTypes() const {
 		return this->allowedDropTypes;
@@ -135,12 +148,17 @@ public:
 
     bool IsCollidingWithLevelPieces(const Point2D& center, float radius) const;
 
-    void GetLevelPieceCollisionCandidatesNotMoving(const Point2D& center, float radius, std::vector<LevelPiece*>& candidates) const;
-	void GetLevelPieceCollisionCandidates(double dT, const Point2D& center, float radius, float velocityMagnitude, std::vector<LevelPiece*>& candidates) const;
+    // Collision candidate queries: each of these clears the given (caller-owned, reusable) buffer and 
+    // fills it with the level pieces in the grid cells overlapped by the given query shape
+    void GetLevelPieceCollisionCandidatesNotMoving(const Point2D& center, float radius, LevelPieceCandidateBuffer& candidates) const;
+	void GetLevelPieceCollisionCandidates(double dT, const Point2D& center, float radius, float velocityMagnitude, 
+        LevelPieceCandidateBuffer& candidates, bool sortByDistance = true) const;
+    void GetLevelPieceCollisionCandidatesNoSort(const Point2D& center, float radius, LevelPieceCandidateBuffer& candidates) const;
+	void GetLevelPieceCollisionCandidates(double dT, const Point2D& center, const BoundingLines& bounds, float velocityMagnitude, LevelPieceCandidateBuffer& candidates) const;
+	void GetLevelPieceCollisionCandidates(const PlayerPaddle& p, bool includeAttachedBall, LevelPieceCandidateBuffer& candidates) const;
+
+    // These add to the given set (rather than replacing its contents) - useful for building up unions of pieces
     void GetLevelPieceCollisionCandidates(const Collision::AABB2D& aabb, std::set<LevelPiece*>& candidates) const;
-    void GetLevelPieceCollisionCandidatesNoSort(const Point2D& center, float radius, std::set<LevelPiece*>& candidates) const;
-	void GetLevelPieceCollisionCandidates(double dT, const Point2D& center, const BoundingLines& bounds, float velocityMagnitude, std::set<LevelPiece*>& candidates) const;
-	void GetLevelPieceCollisionCandidates(const PlayerPaddle& p, bool includeAttachedBall, std::set<LevelPiece*>& candidates) const;
     void GetLevelPieceCollisionCandidatesNotMoving(const Point2D& center, float width, float height, std::set<LevelPiece*>& candidates) const;
 
     static void BuildCollisionBoundsCombinationAndMap(const std::vector<LevelPiece*>& pieces,
@@ -231,6 +249,10 @@ public:
 	void PieceChanged(GameModel* gameModel, LevelPiece* pieceBefore, LevelPiece* pieceAfter,
                       const LevelPiece::DestructionMethod& method);
     void UpdateBoundsOnPieceAndSurroundingPieces(LevelPiece* piece);
+
+    // Goes up every time a piece is changed/replaced or has its bounds rebuilt - anything cached from
+    // ray casts through the level pieces is stale once this has moved
+    unsigned int GetPieceChangeCount() const { return this->pieceChangeCount; }
 	
     LevelPiece* RocketExplosion(GameModel* gameModel, const RocketProjectile* rocket, LevelPiece* hitPiece);
     void RocketExplosionNoPieces(const RocketProjectile* rocket);
@@ -265,7 +287,7 @@ public:
         return this->boss;
     }
     bool GetHasBoss() const {
-        return (this->boss != NULL);
+        return this->hasBoss;
     }
     bool CollideBossWithLevel(const Collision::AABB2D& bossAABB, Vector2D& correctionVec) const;
 
@@ -312,12 +334,19 @@ private:
     size_t randomItemProbabilityNum;    // A number >= 0 for random item probability in the level
     float paddleStartXPos;
     float levelHypotenuse;
+    unsigned int pieceChangeCount;      // See GetPieceChangeCount
+
+    // The immutable template that the pieces are (re)built from, it's the parsed form of the level's file: either
+    // the level in the game's level pack or one read from the level's file that's owned by this level
+    const CompiledLevel* pristineLevel;
+    bool ownsPristineLevel;
 
     bool levelAlmostCompleteSignaled; // Whether or not the event for the level being almost completed has already been signaled
 
     std::vector<GameItem::ItemType> allowedDropTypes;	// The random allowed drop types that come from destroyed blocks in this level
 
-    Boss* boss;             // If the current level has a boss, this is a pointer to it, otherwise it will be NULL
+    bool hasBoss;           // Whether this is a boss level, this is known even when the level's pieces aren't loaded
+    Boss* boss;             // If the current level has a boss (and is loaded), this is a pointer to it, otherwise it will be NULL
     WarpPortal* warpPortal; // If the current level has a warp portal, this is a pointer to it, otherwise it will be NULL
 
     // Persistent scoring variables - used to mark previously saved scores and calculate high scores
@@ -331,25 +360,24 @@ private:
     int numStarsRequiredToUnlock;
     bool areUnlockStarsPaidFor;
 
-    // Constructor for non-boss levels
-	GameLevel(size_t levelIdx, const std::string& filepath, const std::string& levelName, unsigned int numBlocks, 
-		const std::vector<std::vector<LevelPiece*> >& pieces, int numStarsToUnlock,
-        const std::vector<GameItem::ItemType>& allowedDropTypes,
-        size_t randomItemProbabilityNum, long* starAwardScores, float paddleStartXPos, 
-        WarpPortal* warpPortal);
-
-	// Constructor for boss levels
-    GameLevel(size_t levelIdx, const std::string& filepath, const std::string& levelName, 
-		const std::vector<std::vector<LevelPiece*> >& pieces, int numStarsToUnlock,
-        Boss* boss, const std::vector<GameItem::ItemType>& allowedDropTypes,
-        size_t randomItemProbabilityNum, float paddleStartXPos);
+    // Constructor for a level that hasn't had its pieces loaded yet
+    GameLevel(size_t levelIdx, const CompiledLevel* level, bool ownsLevel, int numStarsToUnlock);
 
     void InitPieces(float paddleStartXPos, const std::vector<std::vector<LevelPiece*> >& pieces);
     void SetPaddleStartXPos(float xPos);
 
 	static void UpdatePiece(const std::vector<std::vector<LevelPiece*> >& pieces, size_t hIndex, size_t wIndex);
+    bool ClampCollisionIndices(float& xIndexMin, float& xIndexMax, float& yIndexMin, float& yIndexMax) const;
+    void IndexCollisionCandidates(float xIndexMin, float xIndexMax, float yIndexMin, float yIndexMax, LevelPieceCandidateBuffer& candidates) const;
     void IndexCollisionCandidates(float xIndexMin, float xIndexMax, float yIndexMin, float yIndexMax, std::set<LevelPiece*>& candidates) const;
 
+    template <typename RayHitVisitor> void TraverseLevelPiecesAlongRay(const Collision::Ray2D& ray, float toleranceRadius,
+        float maxRayT, RayHitVisitor& visitor) const;
+
+    static CompiledLevel* ReadCompiledLevel(const std::string& filepath);
+
+    struct LevelPieceReadData;
+    static bool BuildLevelPieces(const CompiledLevel& level, LevelPieceReadData& readData);
 	static void CleanUpFileReadData(std::vector<std::vector<LevelPiece*> >& levelPieces);
 
     DISALLOW_COPY_AND_ASSIGN(GameLevel);
@@ -47,13 +47,17 @@
 #include "PaddleRemoteControlRocketProjectile.h"
 #include "GameTransformMgr.h"
 #include "CannonBlock.h"
+#include "LevelPack.h"
+#include "GameItemFactory.h"
 
 #include "../BlammoEngine/StringHelper.h"
+#include "../BlammoEngine/FrameProfiler.h"
 #include "../GameSound/GameSound.h"
 #include "../ResourceManager.h"
+#include "../Blammopedia.h"
 
 GameModel::GameModel(GameSound* sound, const GameModel::Difficulty& initDifficulty, bool ballBoostIsInverted,
-                     const BallBoostModel::BallBoostMode& ballBoostMode) : 
+                     const BallBoostModel::BallBoostMode& ballBoostMode, const std::string& worldDefinitionFilepath) : 
 currWorldNum(0), currState(NULL), currPlayerScore(0), numStarsAwarded(0), currLivesLeft(0),
 livesAtStartOfLevel(0), numLivesLostInLevel(0), maxNumLivesAllowed(0),
 pauseBitField(GameModel::NoPause), isBlackoutActive(false), 
@@ -62,10 +66,17 @@ nextState(NULL), boostModel(NULL), doingPieceStatusListIteration(false), progres
 droppedLifeForMaxMultiplier(false), bottomSafetyNet(NULL), topSafetyNet(NULL),
 ballBoostIsInverted(ballBoostIsInverted), difficulty(initDifficulty),
 ballBoostMode(ballBoostMode), sound(sound), numInterimBlocksDestroyed(0), maxInterimBlocksDestroyed(0),
-numGoodItemsAcquired(0), numNeutralItemsAcquired(0), numBadItemsAcquired(0), totalLevelTimeInSeconds(0.0) {
+numGoodItemsAcquired(0), numNeutralItemsAcquired(0), numBadItemsAcquired(0), totalLevelTimeInSeconds(0.0),
+worldDefinitionFilepath(worldDefinitionFilepath), levelPack(NULL), collisionBroadPhaseIsDirty(true), isCollisionBroadPhaseEnabled(true),
+inputRecorder(NULL), lastRecordedPauseState(GameModel::NoPause) {
 	
     assert(sound != NULL);
 
+    // If no world definition file was given then we use the game's default one
+    if (this->worldDefinitionFilepath.empty()) {
+        this->worldDefinitionFilepath = GameModelConstants::GetInstance()->GetWorldDefinitonFilePath();
+    }
+
 	// Initialize the worlds for the game - the set of worlds can be found in the world definition file
     this->LoadWorldsFromFile();
 
@@ -81,6 +92,11 @@ numGoodItemsAcquired(0), numNeutralItemsAcquired(0), numBadItemsAcquired(0), tot
 }
 
 GameModel::~GameModel() {
+    this->StopInputRecording();
+
+	// Send out any recorded events while everything they refer to still exists
+	GameEventManager::Instance()->DispatchDeferredEvents();
+
 	// Delete all items and timers - make sure we do this first since
 	// destroying some of these objects causes them to shutdown/use other objects
 	// in the game model
@@ -92,15 +108,18 @@ GameModel::~GameModel() {
 
 	// Delete all loaded worlds
 	for (size_t i = 0; i < this->worlds.size(); i++) {
-		delete this->worlds[i];
+		GameEventManager::Instance()->DeleteAfterDispatch(this->worlds[i]);
 		this->worlds[i] = NULL;
 	}
     this->worlds.clear();
 
+    delete this->levelPack;
+    this->levelPack = NULL;
+
 	// Delete balls and paddle
 	for (std::list<GameBall*>::iterator ballIter = this->balls.begin(); ballIter != this->balls.end(); ++ballIter) {
 		GameBall* currBall = *ballIter;
-		delete currBall;
+		GameEventManager::Instance()->DeleteAfterDispatch(currBall);
 		currBall = NULL;
 	}
 	delete this->playerPaddle;
@@ -241,7 +260,13 @@ void GameModel::ResetLevelValues(int numLives) {
 void GameModel::LoadWorldsFromFile() {
     assert(this->worlds.empty());
 
-    std::istringstream* inFile = ResourceManager::GetInstance()->FilepathToInStream(GameModelConstants::GetInstance()->GetWorldDefinitonFilePath());
+    // Use the precompiled level pack for the world definition file, if one was built for it
+    std::string levelPackFilepath = this->worldDefinitionFilepath + LevelPack::FILE_EXTENSION;
+    if (ResourceManager::GetInstance()->FilepathExists(levelPackFilepath)) {
+        this->SetLevelPack(LevelPack::LoadFromResource(levelPackFilepath));
+    }
+
+    std::istringstream* inFile = ResourceManager::GetInstance()->FilepathToInStream(this->worldDefinitionFilepath);
     std::string currWorldPath;
     bool success = true;
     while (std::getline(*inFile, currWorldPath)) {
@@ -265,6 +290,19 @@ void GameModel::LoadWorldsFromFile() {
     this->worlds.front()->SetHasBeenUnlocked(true);
 }
 
+/**
+ * Sets the level pack that worlds and levels are loaded from, any previous pack is deleted.
+ * Only worlds and levels loaded after this call are affected, levels that were loaded from the previous
+ * pack refer to its compiled levels so their worlds must be reloaded before those levels are used again.
+ */
+void GameModel::SetLevelPack(LevelPack* pack) {
+    if (this->levelPack == pack) {
+        return;
+    }
+    delete this->levelPack;
+    this->levelPack = pack;
+}
+
 void GameModel::PerformLevelCompletionChecks() {
     GameWorld* currWorld = this->GetCurrentWorld();
     GameLevel* currLevel = currWorld->GetCurrentLevel();
@@ -288,10 +326,17 @@ void GameModel::PerformLevelCompletionChecks() {
  * Cause the game model to execute over the given amount of time in seconds.
  */
 void GameModel::Tick(double seconds) {
+    PROFILE_SCOPE("GameModel::Tick");
+    InputRecordScope recordScope(this);
+    if (this->inputRecorder != NULL) {
+        this->inputRecorder->RecordTick(seconds);
+    }
+
 	// If the entire game has been paused then we exit immediately
 	if ((this->pauseBitField & GameModel::PauseGame) == GameModel::PauseGame) {
 		return;
 	}
+    SimulationClock::Advance(seconds);
 
 	if (currState != NULL) {
 		if ((this->pauseBitField & GameModel::PauseState) == 0x00000000) {
@@ -311,6 +356,11 @@ void GameModel::Tick(double seconds) {
  * given zero-based index world and level number.
  */
 void GameModel::StartGameAtWorldAndLevel(int worldIdx, int levelIdx) {
+    InputRecordScope recordScope(this);
+    if (this->inputRecorder != NULL) {
+        this->inputRecorder->RecordStartGame(worldIdx, levelIdx);
+    }
+
 	this->SetNextState(GameState::LevelStartStateType);
     
     // IMPORTANT: ORDER MATTERS HERE!! We need to reset the level values to clear out buffers of the current
@@ -322,6 +372,11 @@ void GameModel::StartGameAtWorldAndLevel(int worldIdx, int levelIdx) {
 }
 
 void GameModel::ResetCurrentLevel() {
+    InputRecordScope recordScope(this);
+    if (this->inputRecorder != NULL) {
+        this->inputRecorder->RecordResetLevel();
+    }
+
     // EVENT: Level is resetting
     GameEventManager::Instance()->ActionLevelResetting();
 
@@ -331,7 +386,79 @@ void GameModel::ResetCurrentLevel() {
     this->GetGameBalls().front()->ResetBallAttributes();
     
     this->ResetLevelValues(GameModelConstants::GetInstance()->INIT_LIVES_LEFT);
-    this->SetCurrentWorldAndLevel(this->currWorldNum, static_cast<int>(this->GetCurrentLevel()->GetLevelIndex()), false);
+    this->RestartCurrentLevel();
+}
+
+/**
+ * Rebuilds the current level as it was when it was first started. Unlike SetCurrentWorldAndLevel nothing
+ * is read from disk: the level's pieces are rebuilt from the level's in-memory template and the game progress
+ * is left as is (restarting a level can't change it).
+ */
+void GameModel::RestartCurrentLevel() {
+    GameWorld* world = this->GetCurrentWorld();
+    assert(world != NULL && world->GetIsLoaded());
+    int levelIdx = world->GetCurrentLevelNum();
+
+    if (!world->SetCurrentLevel(this, levelIdx)) {
+        debug_output("ERROR: Could not restart level " << levelIdx << " of world " << this->currWorldNum);
+        assert(false);
+        return;
+    }
+    GameLevel* currLevel = world->GetCurrentLevel();
+    assert(currLevel != NULL);
+    this->MarkLevelAsResident(this->currWorldNum, levelIdx);
+
+	// EVENT: New Level Started
+	GameEventManager::Instance()->ActionLevelStarted(*world, *currLevel);
+
+	// Tell the paddle what the boundaries of the level are and reset the paddle
+	this->playerPaddle->UpdateLevel(*currLevel);
+
+    this->PerformLevelCompletionChecks();
+}
+
+bool GameModel::StartInputRecording(const std::string& filepath, unsigned long seed) {
+    this->StopInputRecording();
+
+    // Which items the levels are allowed to drop depends on what's been unlocked in the blammopedia
+    std::vector<std::string> unlockedItemNames;
+    const Blammopedia* blammopedia = ResourceManager::GetInstance()->GetBlammopedia();
+    if (blammopedia != NULL) {
+        const std::map<std::string, GameItem::ItemType>& itemNameToTypeMap = GameItemFactory::GetInstance()->GetItemNameToTypeMap();
+        for (std::map<std::string, GameItem::ItemType>::const_iterator iter = itemNameToTypeMap.begin();
+             iter != itemNameToTypeMap.end(); ++iter) {
+
+            Blammopedia::ItemEntryMap::const_iterator findIter = blammopedia->GetItemEntries().find(iter->second);
+            if (findIter != blammopedia->GetItemEntries().end() && !findIter->second->GetIsLocked()) {
+                unlockedItemNames.push_back(iter->first);
+            }
+        }
+    }
+
+    InputRecorder* recorder = new InputRecorder();
+    if (!recorder->Begin(filepath, seed, static_cast<int>(this->difficulty), static_cast<int>(this->ballBoostMode),
+        this->ballBoostIsInverted, this->pauseBitField, unlockedItemNames)) {
+        delete recorder;
+        return false;
+    }
+
+    // Everything random or timed in the model starts over from a known state, a replay does the same
+    Randomizer::GetInstance()->SetSeed(seed);
+    SimulationClock::Reset();
+
+    this->inputRecorder = recorder;
+    this->lastRecordedPauseState = this->pauseBitField;
+    return true;
+}
+
+void GameModel::StopInputRecording() {
+    if (this->inputRecorder != NULL) {
+        const Point2D& paddlePos = this->playerPaddle->GetCenterPosition();
+        this->inputRecorder->RecordResult(this->currPlayerScore, this->currLivesLeft, 
+            static_cast<int>(this->balls.size()), paddlePos[0], paddlePos[1]);
+        delete this->inputRecorder;
+        this->inputRecorder = NULL;
+    }
 }
 
 // Called in order to make sure the game is no longer processing or generating anything
@@ -363,10 +490,11 @@ void GameModel::ClearGameState() {
 void GameModel::ClearAllGameProgress() {
     // Delete all of the loaded worlds...
 	for (int i = 0; i < static_cast<int>(this->worlds.size()); i++) {
-		delete this->worlds[i];
+		GameEventManager::Instance()->DeleteAfterDispatch(this->worlds[i]);
 		this->worlds[i] = NULL;
 	}
     this->worlds.clear();
+    this->residentLevels.clear();
 
     // Reload all of the worlds...
     this->LoadWorldsFromFile();
@@ -393,15 +521,15 @@ int GameModel::GetTotalStarsCollectedInGame() const {
 void GameModel::SetCurrentWorldAndLevel(int worldIdx, int levelIdx, bool sendNewWorldEvent) {
 	assert(worldIdx >= 0 && worldIdx < static_cast<int>(this->worlds.size()));
 	
-    // NOTE: We don't unload anything since it all gets loaded when the game model is initialized
-    // worlds don't take up too much memory so this is fine
+    // NOTE: Worlds only hold the metadata and parsed templates of their levels, the pieces of a level are (re)built
+    // when it's set as the current level and are unloaded once the level falls out of the most recently played levels
 
 	// Get the world we want to set as current
 	GameWorld* world = this->worlds[worldIdx];
 	assert(world != NULL);
 	
 	// Make sure the world loaded properly.
-	if (!world->Load(this)) {
+	if (!world->GetIsLoaded() && !world->Load(this)) {
 		debug_output("ERROR: Could not load world " << worldIdx);
 		assert(false);
 		return;
@@ -415,9 +543,14 @@ void GameModel::SetCurrentWorldAndLevel(int worldIdx, int levelIdx, bool sendNew
     // transforms all sounds that get made between now and the next time the sound module is updated
     this->sound->SetLevelTranslation(world->GetLevelByIndex(levelIdx)->GetTranslationToMiddle());
 
-	world->SetCurrentLevel(this, levelIdx);
+	if (!world->SetCurrentLevel(this, levelIdx)) {
+		debug_output("ERROR: Could not load level " << levelIdx << " of world " << worldIdx);
+		assert(false);
+		return;
+	}
 	GameLevel* currLevel = world->GetCurrentLevel();
 	assert(currLevel != NULL);
+    this->MarkLevelAsResident(worldIdx, levelIdx);
 
     if (sendNewWorldEvent) {
 	    // EVENT: World started...    
@@ -437,6 +570,28 @@ void GameModel::SetCurrentWorldAndLevel(int worldIdx, int levelIdx, bool sendNew
     this->PerformLevelCompletionChecks();
 }
 
+/**
+ * Moves the given level to the front of the most recently played levels, the pieces of any level
+ * that falls off the end of the list are unloaded.
+ */
+void GameModel::MarkLevelAsResident(int worldIdx, int levelIdx) {
+    std::pair<int, int> levelKey(worldIdx, levelIdx);
+    this->residentLevels.remove(levelKey);
+    this->residentLevels.push_front(levelKey);
+
+    while (this->residentLevels.size() > GameModelConstants::GetInstance()->MAX_RESIDENT_LEVELS) {
+        const std::pair<int, int>& evictKey = this->residentLevels.back();
+        GameWorld* world = this->GetWorldByIndex(evictKey.first);
+        if (world != NULL && world->GetIsLoaded()) {
+            GameLevel* level = world->GetLevelByIndex(evictKey.second);
+            if (level != NULL) {
+                level->UnloadPieces();
+            }
+        }
+        this->residentLevels.pop_back();
+    }
+}
+
 // Get the world with the given name in this model, NULL if no such world exists
 GameWorld* GameModel::GetWorldByName(const std::string& name) const {
     for (std::vector<GameWorld*>::const_iterator iter = this->worlds.begin(); iter != this->worlds.end(); ++iter) {
@@ -449,6 +604,11 @@ GameWorld* GameModel::GetWorldByName(const std::string& name) const {
 }
 
 void GameModel::SetDifficulty(const GameModel::Difficulty& difficulty) {
+    InputRecordScope recordScope(this);
+    if (this->inputRecorder != NULL) {
+        this->inputRecorder->RecordDifficulty(static_cast<int>(difficulty));
+    }
+
     static const float EASY_DIFFICULTY_BALL_SPEED_DELTA = -1.70f;
     static const float MED_DIFFICULTY_BALL_SPEED_DELTA  =  0.0f;
     static const float HARD_DIFFICULTY_BALL_SPEED_DELTA =  1.5f;
@@ -548,14 +708,14 @@ void GameModel::DestroySafetyNet(SafetyNet* netToDestroy) {
 
 void GameModel::DestroyBottomSafetyNet() {
     if (this->bottomSafetyNet != NULL) {
-        delete this->bottomSafetyNet;
+        GameEventManager::Instance()->DeleteAfterDispatch(this->bottomSafetyNet);
         this->bottomSafetyNet = NULL;
     }
 }
 
 void GameModel::DestroyTopSafetyNet() {
     if (this->topSafetyNet != NULL) {
-        delete this->topSafetyNet;
+        GameEventManager::Instance()->DeleteAfterDispatch(this->topSafetyNet);
         this->topSafetyNet = NULL;
     }
 }
@@ -705,6 +865,11 @@ void GameModel::CollisionOccurred(Projectile* projectile, Boss* boss, BossBodyPa
 }
 
 void GameModel::ToggleAllowPaddleBallLaunching(bool allow) {
+    InputRecordScope recordScope(this);
+    if (this->inputRecorder != NULL) {
+        this->inputRecorder->RecordAllowLaunch(allow);
+    }
+
     if (this->currState->GetType() == GameState::BallOnPaddleStateType) {
         BallOnPaddleState* onPaddleState = static_cast<BallOnPaddleState*>(this->currState);
         onPaddleState->ToggleAllowPaddleBallLaunching(allow);
@@ -712,11 +877,19 @@ void GameModel::ToggleAllowPaddleBallLaunching(bool allow) {
 }
 
 void GameModel::BallBoostDirectionPressed(float x, float y, bool allowLargeChangeInDirection) {
+    InputRecordScope recordScope(this);
+    if (this->inputRecorder != NULL) {
+        this->inputRecorder->RecordBoostPressed(x, y, allowLargeChangeInDirection);
+    }
 	if (this->currState != NULL) {
 		this->currState->BallBoostDirectionPressed(x, y, allowLargeChangeInDirection);
 	}
 }
 void GameModel::BallBoostDirectionReleased() {
+    InputRecordScope recordScope(this);
+    if (this->inputRecorder != NULL) {
+        this->inputRecorder->RecordBoostReleased();
+    }
 	if (this->currState != NULL) {
 		this->currState->BallBoostDirectionReleased();
 	}
@@ -741,6 +914,10 @@ float GameModel::GetTimeDialationFactor() const {
 }
 
 void GameModel::SetInvertBallBoostDir(bool isInverted) {
+    InputRecordScope recordScope(this);
+    if (this->inputRecorder != NULL) {
+        this->inputRecorder->RecordInvertBoost(isInverted);
+    }
     this->ballBoostIsInverted = isInverted;
     if (this->boostModel != NULL) {
         this->boostModel->SetInvertBallBoostDir(isInverted);
@@ -755,7 +932,7 @@ Projectile* GameModel::GetFirstBeamProjectileCollider(const Collision::Ray2D& ra
     rayT = std::numeric_limits<float>::max();
 
     for (ProjectileMapConstIter mapIter = this->projectiles.begin(); mapIter != this->projectiles.end(); ++mapIter) {
-        const ProjectileList& currProjectileList = mapIter->second;
+        const ProjectileList& currProjectileList = *mapIter->second;
 
         for (ProjectileListConstIter iter = currProjectileList.begin(); iter != currProjectileList.end(); ++iter) {
 
@@ -882,10 +1059,12 @@ void GameModel::DoPieceStatusUpdates(double dT) {
  * Execute projectile collisions on everything relevant that's in play in the GameModel.
  */
 void GameModel::DoProjectileCollisions(double dT) {
+    PROFILE_SCOPE("GameModel::DoProjectileCollisions");
 
 #define PROJECTILE_CLEANUP(p) p->Teardown(*this); \
                               GameEventManager::Instance()->ActionProjectileRemoved(*p); \
-                              delete p; \
+                              this->projectileBroadPhase.Remove(p); \
+                              GameEventManager::Instance()->DeleteAfterDispatch(p); \
                               p = NULL
 													 
 	// Grab a list of all paddle-related projectiles and test each one for collisions...
@@ -893,14 +1072,17 @@ void GameModel::DoProjectileCollisions(double dT) {
 	bool didCollide = false;
 	bool incIter = true;
 
-    std::set<LevelPiece*> collisionPieces;
-    std::set<LevelPiece*> alreadyCollidedWithPieces;
+    LevelPieceCandidateBuffer& collisionPieces = this->projectileCollisionCandidates;
+    LevelPieceCandidateBuffer& alreadyCollidedWithPieces = this->projectileAlreadyCollidedWithPieces;
 
     GameLevel* currLevel = this->GetCurrentLevel();
     Boss* boss = currLevel->GetBoss();
 
+    // Everything has moved since the last tick, the broad phase is rebuilt the first time it's needed
+    this->InvalidateCollisionBroadPhase();
+
 	for (ProjectileMapIter mapIter = this->projectiles.begin(); mapIter != this->projectiles.end(); ++mapIter) {
-        ProjectileList& currProjectileList = mapIter->second;
+        ProjectileList& currProjectileList = *mapIter->second;
 
         for (ProjectileListIter iter = currProjectileList.begin(); iter != currProjectileList.end();) {
 
@@ -932,14 +1114,27 @@ void GameModel::DoProjectileCollisions(double dT) {
 
             // Check for collisions with balls (NOTE: most projectiles don't collide with balls)
             if (currProjectile->CanCollideWithBall()) {
+                
+                // Only bother with the narrow phase for the balls that are near the projectile
+                if (this->isCollisionBroadPhaseEnabled) {
+                    this->UpdateCollisionBroadPhase(dT);
+                    this->ballBroadPhase.Query(GameModel::BuildSweptAABB(projectileBoundingLines.GenerateAABBFromLines(), 
+                        dT * currProjectile->GetVelocityMagnitude()), this->broadPhaseBalls);
+                }
+                else {
+                    this->broadPhaseBalls.assign(this->balls.begin(), this->balls.end());
+                }
 
-                for (std::list<GameBall*>::iterator ballIter = this->balls.begin(); ballIter != this->balls.end(); ++ballIter) {
+                destroyProjectile = false;
+                for (std::vector<GameBall*>::iterator ballIter = this->broadPhaseBalls.begin(); ballIter != this->broadPhaseBalls.end(); ++ballIter) {
                     GameBall* currBall = *ballIter;
                     
                     if (currBall->CollisionCheckWithProjectile(dT, *currProjectile, projectileBoundingLines)) {
                         
                         this->CollisionOccurred(currProjectile, currBall);
-                        
+                        // The collision may have moved the ball (e.g., portals)
+                        this->UpdateBallInBroadPhase(currBall, dT);
+
                         destroyProjectile = currBall->ProjectileIsDestroyedOnCollision(*currProjectile);
                         if (destroyProjectile) {
                             iter = currProjectileList.erase(iter);
@@ -951,27 +1146,42 @@ void GameModel::DoProjectileCollisions(double dT) {
                     }
                 }
                 if (destroyProjectile) {
-                    ++iter;
                     continue;
                 }
             }
 
             if (currProjectile->CanCollideWithProjectiles()) {
-                for (ProjectileMapIter mapIter2 = this->projectiles.begin(); mapIter2 != this->projectiles.end(); ++mapIter2) {
-                    ProjectileList& currProjectileList2 = mapIter2->second;
-
-                    for (ProjectileListIter iter2 = currProjectileList2.begin(); iter2 != currProjectileList2.end(); ++iter2) {
 
-                        Projectile* otherProjectile = *iter2;
-                        if (otherProjectile == currProjectile || otherProjectile->IsLastThingCollidedWith(currProjectile)) {
-                            // No self-collisions or repeated collisions
-                            continue;
-                        }
-                        if (projectileBoundingLines.CollisionCheck(otherProjectile->BuildBoundingLines(), dT, otherProjectile->GetVelocity())) {
-                            currProjectile->ProjectileCollisionOccurred(otherProjectile);
+                // Only bother with the narrow phase for the projectiles that are near this one
+                if (this->isCollisionBroadPhaseEnabled) {
+                    this->UpdateCollisionBroadPhase(dT);
+                    this->projectileBroadPhase.Query(GameModel::BuildSweptAABB(projectileBoundingLines.GenerateAABBFromLines(), 
+                        dT * currProjectile->GetVelocityMagnitude()), this->broadPhaseProjectiles);
+                }
+                else {
+                    this->broadPhaseProjectiles.clear();
+                    for (ProjectileMapConstIter otherMapIter = this->projectiles.begin(); otherMapIter != this->projectiles.end(); ++otherMapIter) {
+                        const ProjectileList& otherProjectileList = *otherMapIter->second;
+                        for (ProjectileListConstIter otherIter = otherProjectileList.begin(); otherIter != otherProjectileList.end(); ++otherIter) {
+                            this->broadPhaseProjectiles.push_back(*otherIter);
                         }
                     }
                 }
+
+                for (std::vector<Projectile*>::iterator iter2 = this->broadPhaseProjectiles.begin(); iter2 != this->broadPhaseProjectiles.end(); ++iter2) {
+
+                    Projectile* otherProjectile = *iter2;
+                    if (otherProjectile == currProjectile || otherProjectile->IsLastThingCollidedWith(currProjectile)) {
+                        // No self-collisions or repeated collisions
+                        continue;
+                    }
+                    if (projectileBoundingLines.CollisionCheck(otherProjectile->BuildBoundingLines(), dT, otherProjectile->GetVelocity())) {
+                        currProjectile->ProjectileCollisionOccurred(otherProjectile);
+                        // The collision may have moved either projectile (e.g., portals)
+                        this->UpdateProjectileInBroadPhase(currProjectile, dT);
+                        this->UpdateProjectileInBroadPhase(otherProjectile, dT);
+                    }
+                }
             }
 
 		    // Check to see if the projectile collided with a safety net (if one is active)
@@ -1046,11 +1256,10 @@ void GameModel::DoProjectileCollisions(double dT) {
                     
                     // In the special case of a rocket projectile we cause an explosion...
                     if (currProjectile->IsRocket()) {
-                        collisionPieces.clear();
                         currLevel->GetLevelPieceCollisionCandidatesNoSort(currProjectile->GetPosition(), EPSILON, collisionPieces);
-                        if (!collisionPieces.empty()) {
+                        if (!collisionPieces.IsEmpty()) {
                             assert(dynamic_cast<RocketProjectile*>(currProjectile) != NULL);
-                            currLevel->RocketExplosion(this, static_cast<RocketProjectile*>(currProjectile), *collisionPieces.begin());
+                            currLevel->RocketExplosion(this, static_cast<RocketProjectile*>(currProjectile), collisionPieces.GetFirst());
                         }
                     }
                     // In the other special case of a mine projectile we cause an explosion...
@@ -1076,11 +1285,10 @@ void GameModel::DoProjectileCollisions(double dT) {
                     
                     // In the special case of a rocket projectile we cause an explosion...
                     if (currProjectile->IsRocket()) {
-                        collisionPieces.clear();
                         currLevel->GetLevelPieceCollisionCandidatesNoSort(currProjectile->GetPosition(), EPSILON, collisionPieces);
-                        if (!collisionPieces.empty()) {
+                        if (!collisionPieces.IsEmpty()) {
                             assert(dynamic_cast<RocketProjectile*>(currProjectile) != NULL);
-                            currLevel->RocketExplosion(this, static_cast<RocketProjectile*>(currProjectile), *collisionPieces.begin());
+                            currLevel->RocketExplosion(this, static_cast<RocketProjectile*>(currProjectile), collisionPieces.GetFirst());
                         }
                     }
 
@@ -1098,18 +1306,17 @@ void GameModel::DoProjectileCollisions(double dT) {
             if (currProjectile->CanCollideWithBlocks()) {
 
                 // Find the any level pieces that the current projectile may have collided with and test for collision
-                collisionPieces.clear();
                 currLevel->GetLevelPieceCollisionCandidates(dT, currProjectile->GetPosition(), projectileBoundingLines, 
                     currProjectile->GetVelocityMagnitude(), collisionPieces);
-                alreadyCollidedWithPieces.clear();
+                alreadyCollidedWithPieces.Clear();
 
-		        for (std::set<LevelPiece*>::iterator pieceIter = collisionPieces.begin(); pieceIter != collisionPieces.end(); ++pieceIter) {
+		        for (LevelPieceCandidateBuffer::const_iterator pieceIter = collisionPieces.begin(); pieceIter != collisionPieces.end(); ++pieceIter) {
 
 			        LevelPiece *currPiece = *pieceIter;
         			
 			        // Test for a collision between the projectile and current level piece
 			        didCollide = currPiece->CollisionCheck(projectileBoundingLines, dT, currProjectileVel) && 
-                        alreadyCollidedWithPieces.find(currPiece) == alreadyCollidedWithPieces.end();
+                        !alreadyCollidedWithPieces.Contains(currPiece);
 			        if (didCollide) {
 
 				        // WARNING/IMPORTANT!!!! This needs to be before the call to CollisionOccurred or else the
@@ -1125,7 +1332,7 @@ void GameModel::DoProjectileCollisions(double dT) {
                             // currPiece will still exist since cannons cannot be destroyed
 
                             if (static_cast<const CannonBlock*>(currPiece)->IsProjectileLoaded(currProjectile)) {
-                                alreadyCollidedWithPieces.insert(currPiece);
+                                alreadyCollidedWithPieces.Add(currPiece);
                                 break;
                             }
                         }
@@ -1143,17 +1350,19 @@ void GameModel::DoProjectileCollisions(double dT) {
                             break;
 				        }
                         else {
-
+                            // The piece may have moved or redirected the projectile (e.g., portals, cannons)
+                            this->UpdateProjectileInBroadPhase(currProjectile, dT);
 
                             // NOTE: We need to be careful since some blocks may no longer exist after a collision at this
                             // point so we re-populate the set of pieces to check and keep track of the ones we've already collided with
-                            collisionPieces.clear();
                             currLevel->GetLevelPieceCollisionCandidates(
                                 dT, currProjectile->GetPosition(), projectileBoundingLines, currProjectile->GetVelocityMagnitude(), collisionPieces);
                             pieceIter = collisionPieces.begin();
                         }
 			        }
-                    alreadyCollidedWithPieces.insert(currPiece);
+                    if (!alreadyCollidedWithPieces.Contains(currPiece)) {
+                        alreadyCollidedWithPieces.Add(currPiece);
+                    }
 		        }
             }
 
@@ -1174,10 +1383,87 @@ void GameModel::DoProjectileCollisions(double dT) {
 
 #undef PROJECTILE_CLEANUP
 
+    // Don't hold onto any pointers past this point, projectiles and balls may be deleted before the next tick
+    this->InvalidateCollisionBroadPhase();
+
 	// Check to see if the level is done
     this->PerformLevelCompletionChecks();
 }
 
+/**
+ * Rebuild the projectile and ball broad phase structures if anything has changed since they
+ * were last built. The AABBs are grown by the distance each object can travel over the given
+ * time so that swept narrow phase checks are never culled.
+ */
+void GameModel::UpdateCollisionBroadPhase(double dT) {
+    if (!this->collisionBroadPhaseIsDirty) {
+        return;
+    }
+
+    this->projectileBroadPhase.Clear();
+    for (ProjectileMapConstIter mapIter = this->projectiles.begin(); mapIter != this->projectiles.end(); ++mapIter) {
+        const ProjectileList& currProjectileList = *mapIter->second;
+        for (ProjectileListConstIter iter = currProjectileList.begin(); iter != currProjectileList.end(); ++iter) {
+            Projectile* currProjectile = *iter;
+            this->projectileBroadPhase.Insert(currProjectile, 
+                GameModel::BuildSweptAABB(currProjectile->BuildAABB(), dT * currProjectile->GetVelocityMagnitude()));
+        }
+    }
+    this->projectileBroadPhase.Finalize();
+
+    this->ballBroadPhase.Clear();
+    for (std::list<GameBall*>::const_iterator iter = this->balls.begin(); iter != this->balls.end(); ++iter) {
+        GameBall* currBall = *iter;
+        Collision::AABB2D ballAABB;
+        ballAABB.AddCircle(currBall->GetBounds());
+        this->ballBroadPhase.Insert(currBall, GameModel::BuildSweptAABB(ballAABB, dT * currBall->GetSpeed()));
+    }
+    this->ballBroadPhase.Finalize();
+
+    this->collisionBroadPhaseIsDirty = false;
+}
+
+void GameModel::InvalidateCollisionBroadPhase() {
+    this->projectileBroadPhase.Clear();
+    this->ballBroadPhase.Clear();
+    this->collisionBroadPhaseIsDirty = true;
+}
+
+/**
+ * Move just the given projectile's entry in the broad phase after it has been moved during
+ * collisions (e.g., teleported by a portal), instead of rebuilding the whole thing.
+ */
+void GameModel::UpdateProjectileInBroadPhase(const Projectile* projectile, double dT) {
+    if (this->collisionBroadPhaseIsDirty) {
+        // Everything gets reinserted on the next rebuild anyway
+        return;
+    }
+    if (!this->projectileBroadPhase.Update(projectile, 
+        GameModel::BuildSweptAABB(projectile->BuildAABB(), dT * projectile->GetVelocityMagnitude()))) {
+        this->collisionBroadPhaseIsDirty = true;
+    }
+}
+
+/**
+ * Move just the given ball's entry in the broad phase after it has been moved during
+ * collisions (e.g., teleported by a portal), instead of rebuilding the whole thing.
+ */
+void GameModel::UpdateBallInBroadPhase(const GameBall* ball, double dT) {
+    if (this->collisionBroadPhaseIsDirty) {
+        return;
+    }
+    Collision::AABB2D ballAABB;
+    ballAABB.AddCircle(ball->GetBounds());
+    if (!this->ballBroadPhase.Update(ball, GameModel::BuildSweptAABB(ballAABB, dT * ball->GetSpeed()))) {
+        this->collisionBroadPhaseIsDirty = true;
+    }
+}
+
+Collision::AABB2D GameModel::BuildSweptAABB(const Collision::AABB2D& aabb, float sweepDist) {
+    Vector2D sweepVec(sweepDist, sweepDist);
+    return Collision::AABB2D(aabb.GetMin() - sweepVec, aabb.GetMax() + sweepVec);
+}
+
 bool GameModel::IsOutOfPaddedLevelBounds(const Point2D& pos, float minXPadding, float minYPadding, float maxXPadding, float maxYPadding) const {
     const GameLevel* currLevel = this->GetCurrentLevel();
     float levelWidthBounds	= currLevel->GetLevelUnitWidth()  + maxXPadding;
@@ -1217,7 +1503,7 @@ void GameModel::UpdateActiveTimers(double seconds) {
 	for (unsigned int i = 0; i < removeTimers.size(); i++) {
 		GameItemTimer* currTimer = removeTimers[i];
 		activeTimers.remove(currTimer);
-		delete currTimer;
+		GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 		currTimer = NULL;
 	}
 }
@@ -1245,7 +1531,7 @@ void GameModel::UpdateActiveItemDrops(double seconds) {
 		GameItem *currItem = removeItems[i];
 		currLiveItems.remove(currItem);
 		GameEventManager::Instance()->ActionItemRemoved(*currItem);
-		delete currItem;
+		GameEventManager::Instance()->DeleteAfterDispatch(currItem);
 		currItem = NULL;
 	}
 }
@@ -1258,7 +1544,7 @@ void GameModel::UpdateActiveProjectiles(double seconds) {
 	// Tick all the active projectiles and check for ones which are out of bounds
 	for (ProjectileMapIter mapIter = this->projectiles.begin(); mapIter != this->projectiles.end(); ++mapIter) {
 		
-        ProjectileList& currProjectiles = mapIter->second;
+        ProjectileList& currProjectiles = *mapIter->second;
         for (ProjectileListIter iter = currProjectiles.begin(); iter != currProjectiles.end();) {
 
             Projectile* currProjectile = *iter;
@@ -1273,7 +1559,7 @@ void GameModel::UpdateActiveProjectiles(double seconds) {
 			    // EVENT: Projectile is being removed...
 			    GameEventManager::Instance()->ActionProjectileRemoved(*currProjectile);
 
-			    delete currProjectile;
+			    GameEventManager::Instance()->DeleteAfterDispatch(currProjectile);
 			    currProjectile = NULL;
 		    }
 		    else {
@@ -1289,6 +1575,7 @@ void GameModel::UpdateActiveProjectiles(double seconds) {
  * active beams (if any) in the game during the current tick.
  */
 void GameModel::UpdateActiveBeams(double seconds) {
+	PROFILE_SCOPE("GameModel::UpdateActiveBeams");
 
 	std::list<Beam*>& activeBeams = this->GetActiveBeams();
 	for (std::list<Beam*>::iterator beamIter = activeBeams.begin(); beamIter != activeBeams.end();) {
@@ -1333,7 +1620,7 @@ void GameModel::UpdateActiveBeams(double seconds) {
 			// EVENT: Beam removed...
 			GameEventManager::Instance()->ActionBeamRemoved(*currentBeam);
 
-			delete currentBeam;
+			GameEventManager::Instance()->DeleteAfterDispatch(currentBeam);
 			currentBeam = NULL;
 		}
 		else {
@@ -1462,20 +1749,25 @@ void GameModel::ClearProjectiles() {
     
 	for (ProjectileMapIter mapIter = this->projectiles.begin(); mapIter != this->projectiles.end(); ++mapIter) {
         
-        ProjectileList& currProjectiles = mapIter->second;
-        for (ProjectileListIter listIter = currProjectiles.begin(); listIter != currProjectiles.end(); ++listIter) {
+        ProjectileList& currProjectiles = *mapIter->second;
+        for (ProjectileListIter listIter = currProjectiles.begin(); listIter != currProjectiles.end();) {
 
+		    // The projectile holds the links of the list, unlink it before it's deleted
 		    Projectile* currProjectile = *listIter;
+		    listIter = currProjectiles.erase(listIter);
 		    currProjectile->Teardown(*this);
 
             // EVENT: Projectile removed from the game
 		    GameEventManager::Instance()->ActionProjectileRemoved(*currProjectile);
 
-		    delete currProjectile;
+		    GameEventManager::Instance()->DeleteAfterDispatch(currProjectile);
 		    currProjectile = NULL;
         }
+        delete mapIter->second;
+        mapIter->second = NULL;
 	}
 	this->projectiles.clear();
+    this->InvalidateCollisionBroadPhase();
 }
 
 /**
@@ -1490,7 +1782,7 @@ void GameModel::ClearBeams() {
 
 		// EVENT: Beam is removed from the game
 		GameEventManager::Instance()->ActionBeamRemoved(*currBeam);
-		delete currBeam;
+		GameEventManager::Instance()->DeleteAfterDispatch(currBeam);
 		currBeam = NULL;
 	}
 }
@@ -1504,7 +1796,7 @@ void GameModel::ClearLiveItems() {
 		GameItem* currItem = *iter;
 		// EVENT: Item removed from the game
 		GameEventManager::Instance()->ActionItemRemoved(*currItem);
-		delete currItem;
+		GameEventManager::Instance()->DeleteAfterDispatch(currItem);
 		currItem = NULL;
 	}
 	this->currLiveItems.clear();
@@ -1520,7 +1812,7 @@ void GameModel::ClearActiveTimers() {
 	for(std::list<GameItemTimer*>::iterator iter = this->activeTimers.begin(); iter != this->activeTimers.end(); ++iter) {
 		GameItemTimer* currTimer = *iter;
 		currTimer->StopTimer(false);
-		delete currTimer;
+		GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 		currTimer = NULL;
 	}
 	this->activeTimers.clear();
@@ -1540,7 +1832,7 @@ void GameModel::ClearBallsToOne() {
 	++ballIter;
 	for (; ballIter != this->balls.end(); ++ballIter) {
 		GameBall* ballToDestroy = *ballIter;
-		delete ballToDestroy;
+		GameEventManager::Instance()->DeleteAfterDispatch(ballToDestroy);
 		ballToDestroy = NULL;
 	}
 
@@ -1562,7 +1854,7 @@ bool GameModel::RemoveActiveGameItemsOfGivenType(const GameItem::ItemType& type)
 		GameItemTimer* currTimer = *iter;
 		if (currTimer->GetTimerItemType() == type) {
 			iter = this->activeTimers.erase(iter);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 			foundItemType = true;
 		}
@@ -1584,7 +1876,7 @@ void GameModel::RemoveActiveGameItemsForThisBallOnly(const GameBall* ball) {
 
             if (currTimer->GetAssociatedBalls().empty()) {
 		        iter = this->activeTimers.erase(iter);
-		        delete currTimer;
+		        GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 		        currTimer = NULL;
                 continue;
             }
@@ -1596,22 +1888,23 @@ void GameModel::RemoveActiveGameItemsForThisBallOnly(const GameBall* ball) {
 void GameModel::RemoveBallDeathMineProjectiles() {
     for (ProjectileMapIter mapIter = this->projectiles.begin(); mapIter != this->projectiles.end(); ++mapIter) {
 
-        ProjectileList& currProjectiles = mapIter->second;
+        ProjectileList& currProjectiles = *mapIter->second;
         for (ProjectileListIter listIter = currProjectiles.begin(); listIter != currProjectiles.end();) {
 
             Projectile* currProjectile = *listIter;
             if (currProjectile->IsMine()) {
                 MineProjectile* currMine = static_cast<MineProjectile*>(currProjectile);
                 if (currMine->GetIsAttachedToPaddle() || currMine->GetIsAttachedToSafetyNet()) {
+                    listIter = currProjectiles.erase(listIter);
                     currMine->Teardown(*this);
 
                     // EVENT: Projectile removed from the game
                     GameEventManager::Instance()->ActionProjectileRemoved(*currMine);
 
-                    delete currMine;
+                    GameEventManager::Instance()->DeleteAfterDispatch(currMine);
                     currMine = NULL;
 
-                    listIter = currProjectiles.erase(listIter);
+                    this->InvalidateCollisionBroadPhase();
                     continue;
                 }
             }
@@ -1760,7 +2053,12 @@ void GameModel::AddProjectile(Projectile* projectile) {
 	assert(projectile != NULL);
 
 	// Add it to the list of in-game projectiles
-    this->projectiles[projectile->GetType()].push_back(projectile);
+    ProjectileMapIter findIter = this->projectiles.find(projectile->GetType());
+    if (findIter == this->projectiles.end()) {
+        findIter = this->projectiles.insert(std::make_pair(projectile->GetType(), new ProjectileList())).first;
+    }
+    findIter->second->push_back(projectile);
+    this->collisionBroadPhaseIsDirty = true;
     
     // Call the setup function so the projectile can do some setup if need be
     projectile->Setup(*this);
@@ -1912,7 +2210,7 @@ void GameModel::ClearSpecificBeams(const Beam::BeamType& beamType) {
 
             // EVENT: Beam is removed from the game
             GameEventManager::Instance()->ActionBeamRemoved(*currBeam);
-            delete currBeam;
+            GameEventManager::Instance()->DeleteAfterDispatch(currBeam);
             currBeam = NULL;
         }
         else {
@@ -1927,19 +2225,22 @@ void GameModel::ClearSpecificProjectiles(const Projectile::ProjectileType& proje
         return;
     }
 
-    ProjectileList& projectileList = findIter->second;
-    for (ProjectileListIter iter = projectileList.begin(); iter != projectileList.end(); ++iter) {
+    ProjectileList& projectileList = *findIter->second;
+    for (ProjectileListIter iter = projectileList.begin(); iter != projectileList.end();) {
         
+        // The projectile holds the links of the list, unlink it before it's deleted
         Projectile* projectile = *iter;
+        iter = projectileList.erase(iter);
         projectile->Teardown(*this);
 
         // EVENT: Projectile removed from the game
         GameEventManager::Instance()->ActionProjectileRemoved(*projectile);
 
-        delete projectile;
+        GameEventManager::Instance()->DeleteAfterDispatch(projectile);
         projectile = NULL;
     }
-    projectileList.clear();
+    assert(projectileList.empty());
+    this->InvalidateCollisionBroadPhase();
 }
 
 bool GameModel::IsTimerTypeActive(const GameItem::ItemType& type) const {
@@ -2031,7 +2332,7 @@ PaddleRemoteControlRocketProjectile* GameModel::GetActiveRemoteControlRocket() c
     ProjectileMapConstIter findIter = this->projectiles.find(Projectile::PaddleRemoteCtrlRocketBulletProjectile);
 
     if (findIter != this->projectiles.end()) {
-        const GameModel::ProjectileList& remoteCtrlRocketList = findIter->second;
+        const GameModel::ProjectileList& remoteCtrlRocketList = *findIter->second;
         if (!remoteCtrlRocketList.empty()) {
             // A remote control rocket is active!
             assert(remoteCtrlRocketList.size() == 1); // There should only, at most, be one remote control rocket active at a time!
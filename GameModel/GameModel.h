@@ -33,6 +33,7 @@
 #define __GAMEMODEL_H__
 
 #include "../BlammoEngine/BasicIncludes.h"
+#include "../BlammoEngine/SweepAndPrune.h"
 
 #include "GameModelConstants.h"
 #include "LevelPiece.h"
@@ -50,6 +51,8 @@
 #include "Projectile.h"
 #include "BallBoostModel.h"
 #include "Beam.h"
+#include "InputRecorder.h"
+#include "SimulationClock.h"
 
 class GameSound;
 class BallInPlayState;
@@ -59,6 +62,7 @@ class PointAward;
 class SafetyNet;
 class PaddleRemoteControlRocketProjectile;
 class GameTransformMgr;
+class LevelPack;
 
 class GameModel {
 
@@ -73,10 +77,10 @@ class GameModel {
     friend class GameOverState;
 
 public:
-    typedef std::list<Projectile*> ProjectileList;
+    typedef IntrusiveList<Projectile> ProjectileList;
     typedef ProjectileList::const_iterator ProjectileListConstIter;
     typedef ProjectileList::iterator ProjectileListIter;
-    typedef std::map<Projectile::ProjectileType, ProjectileList> ProjectileMap;
+    typedef std::map<Projectile::ProjectileType, ProjectileList*> ProjectileMap;
     typedef ProjectileMap::const_iterator ProjectileMapConstIter;
     typedef ProjectileMap::iterator ProjectileMapIter;
 
@@ -100,7 +104,7 @@ public:
     enum Difficulty { EasyDifficulty = 0, MediumDifficulty = 1, HardDifficulty = 2};
     
     GameModel(GameSound* sound, const GameModel::Difficulty& initDifficulty, bool ballBoostIsInverted,
-        const BallBoostModel::BallBoostMode& ballBoostMode);
+        const BallBoostModel::BallBoostMode& ballBoostMode, const std::string& worldDefinitionFilepath = "");
 	~GameModel();
 
     bool IsOutOfGameBoundsForBall(const Point2D& pos) const;
@@ -209,6 +213,20 @@ public:
     const std::vector<GameWorld*>& GetGameWorlds() const {
         return this->worlds;
     }
+    const std::string& GetWorldDefinitionFilepath() const {
+        return this->worldDefinitionFilepath;
+    }
+
+    // The precompiled worlds and levels (NULL if there's no level pack, worlds and levels are then read from their text files)
+    const LevelPack* GetLevelPack() const {
+        return this->levelPack;
+    }
+    void SetLevelPack(LevelPack* pack);
+
+    // With the collision broad phase off, projectiles are tested against every ball and projectile
+    // in play - this is only for measuring what the broad phase saves
+    void SetCollisionBroadPhaseEnabled(bool enabled) { this->isCollisionBroadPhaseEnabled = enabled; }
+    bool IsCollisionBroadPhaseEnabled() const { return this->isCollisionBroadPhaseEnabled; }
 
 	GameLevel* GetCurrentLevel() const {
 		return this->worlds[this->currWorldNum]->GetCurrentLevel();
@@ -325,10 +343,13 @@ public:
     GameModel::ProjectileMap& GetActiveProjectiles() {
 		return this->projectiles;
 	}
+    const GameModel::ProjectileMap& GetActiveProjectiles() const {
+        return this->projectiles;
+    }
     const GameModel::ProjectileList* GetActiveProjectilesWithType(Projectile::ProjectileType type) const {
         GameModel::ProjectileMapConstIter findIter = this->projectiles.find(type);
         if (findIter == this->projectiles.end()) { return NULL; }
-        return &findIter->second;
+        return findIter->second;
     }
 
     Projectile* GetFirstBeamProjectileCollider(const Collision::Ray2D& ray, const std::set<const void*>& ignoreThings, float& rayT) const;
@@ -399,6 +420,10 @@ public:
 	// Move the paddle or some other interactive element in the game...
 	void MovePaddle(size_t frameID, int dir, float magnitudePercent = 1.0f) {
         assert(dir <= 1 && dir >= -1);
+        InputRecordScope recordScope(this);
+        if (this->inputRecorder != NULL) {
+            this->inputRecorder->RecordMovePaddle(frameID, dir, magnitudePercent);
+        }
 		
         // NOTE: The following code is used to 'clean-up' movements so that we don't over send
         // commands to the interactive elements of the game, instead we limit movement commands 
@@ -426,6 +451,10 @@ public:
 	}
     void MoveOther(size_t frameID, int dir, float magnitudePercent = 1.0f) {
         assert(dir <= 1 && dir >= -1);
+        InputRecordScope recordScope(this);
+        if (this->inputRecorder != NULL) {
+            this->inputRecorder->RecordMoveOther(frameID, dir, magnitudePercent);
+        }
 
         // NOTE: The following code is used to 'clean-up' movements so that we don't over send
         // commands to the interactive elements of the game, instead we limit movement commands 
@@ -454,6 +483,10 @@ public:
 
 	// Release the ball from the paddle, shoot lasers and activate other power ups
 	void ShootActionReleaseUse() {
+        InputRecordScope recordScope(this);
+        if (this->inputRecorder != NULL) {
+            this->inputRecorder->RecordShootRelease();
+        }
 		if (this->currState != NULL &&
 			(this->pauseBitField & GameModel::PauseState) == 0x0 &&
             (this->pauseBitField & GameModel::PauseGame) == 0x0) {
@@ -463,6 +496,10 @@ public:
 	}
 
     void ShootActionContinuousUse(double dT, float magnitudePercent = 1.0f) {
+        InputRecordScope recordScope(this);
+        if (this->inputRecorder != NULL) {
+            this->inputRecorder->RecordShootContinuous(dT, magnitudePercent);
+        }
         if (this->currState != NULL &&
             (this->pauseBitField & GameModel::PauseState) == 0x0 &&
             (this->pauseBitField & GameModel::PauseGame) == 0x0) {
@@ -474,7 +511,13 @@ public:
     void ToggleAllowPaddleBallLaunching(bool allow);
 
     const BallBoostModel::BallBoostMode& GetBallBoostMode() const { return this->ballBoostMode; }
-    void SetBallBoostMode(const BallBoostModel::BallBoostMode& mode) { this->ballBoostMode = mode; }
+    void SetBallBoostMode(const BallBoostModel::BallBoostMode& mode) {
+        InputRecordScope recordScope(this);
+        if (this->inputRecorder != NULL) {
+            this->inputRecorder->RecordBoostMode(static_cast<int>(mode));
+        }
+        this->ballBoostMode = mode;
+    }
 
     void BallBoostDirectionPressed(float x, float y, bool allowLargeChangeInDirection);
     void BallBoostDirectionReleased();
@@ -560,6 +603,12 @@ public:
 
     void PerformLevelCompletionChecks();
 
+    // Recording of everything that drives the model from outside of it (see InputRecorder), starting
+    // a recording reseeds the game's Randomizer and resets the simulation clock
+    bool StartInputRecording(const std::string& filepath, unsigned long seed);
+    void StopInputRecording();
+    bool GetIsRecordingInput() const { return this->inputRecorder != NULL; }
+
 	// Debug functions
 #ifdef _DEBUG
 	void DropItem(GameItem::ItemType itemType);
@@ -583,9 +632,26 @@ private:
 
     ProjectileMap projectiles;  // Projectiles spawned as the game is played
 
+    // Reused every tick by DoProjectileCollisions so that level piece lookups don't allocate
+    LevelPieceCandidateBuffer projectileCollisionCandidates;
+    LevelPieceCandidateBuffer projectileAlreadyCollidedWithPieces;
+
+    // Broad phase for projectile-projectile and projectile-ball collisions, only valid during DoProjectileCollisions
+    SweepAndPrune<Projectile> projectileBroadPhase;
+    SweepAndPrune<GameBall> ballBroadPhase;
+    std::vector<Projectile*> broadPhaseProjectiles;
+    std::vector<GameBall*> broadPhaseBalls;
+    bool collisionBroadPhaseIsDirty;
+    bool isCollisionBroadPhaseEnabled;
+
     // Current world and level information
     unsigned int currWorldNum;
     std::vector<GameWorld*> worlds;
+    std::string worldDefinitionFilepath; // The file listing all of the worlds (.wld files) in the game
+    LevelPack* levelPack;                // Precompiled form of the world definition file's worlds and levels, may be NULL
+
+    // The most recently played levels, as (world, level) indices, the first is the most recent - only these have their pieces loaded
+    std::list<std::pair<int, int> > residentLevels;
 
     // Difficulty setting of the game
     GameModel::Difficulty difficulty;
@@ -631,8 +697,30 @@ private:
     bool doingPieceStatusListIteration;
     bool progressLoadedSuccessfully;
 
+    InputRecorder* inputRecorder;  // Not NULL only while input is being recorded
+    int lastRecordedPauseState;    // Pause state as of the end of the last recorded call
+
+    // Wraps each of the calls that drive the model from outside of it: while input is being recorded
+    // any change to the pause state that was made from outside of the model since the previous call is
+    // recorded first, changes that the model makes to it during the call are its own and aren't recorded
+    class InputRecordScope {
+    public:
+        explicit InputRecordScope(GameModel* model) : model(model) {
+            if (model->inputRecorder != NULL && model->pauseBitField != model->lastRecordedPauseState) {
+                model->inputRecorder->RecordPauseState(model->pauseBitField);
+            }
+        }
+        ~InputRecordScope() {
+            this->model->lastRecordedPauseState = this->model->pauseBitField;
+        }
+    private:
+        GameModel* model;
+        DISALLOW_COPY_AND_ASSIGN(InputRecordScope);
+    };
+
     // Private getters and setters ****************************************
     void SetCurrentWorldAndLevel(int worldIdx, int levelIdx, bool sendNewWorldEvent);
+    void RestartCurrentLevel();
 
     void SetCurrentStateImmediately(GameState* newState) {
         assert(newState != NULL);
@@ -653,6 +741,11 @@ private:
     void BallDied(GameBall* deadBall, bool& stateChanged);
     void DoPieceStatusUpdates(double dT);
     void DoProjectileCollisions(double dT);
+    void UpdateCollisionBroadPhase(double dT);
+    void InvalidateCollisionBroadPhase();
+    void UpdateProjectileInBroadPhase(const Projectile* projectile, double dT);
+    void UpdateBallInBroadPhase(const GameBall* ball, double dT);
+    static Collision::AABB2D BuildSweptAABB(const Collision::AABB2D& aabb, float sweepDist);
 
     void UpdateActiveTimers(double seconds);
     void UpdateActiveItemDrops(double seconds);
@@ -689,6 +782,7 @@ private:
     void ResetLevelValues(int numLives);
 
     void LoadWorldsFromFile();
+    void MarkLevelAsResident(int worldIdx, int levelIdx);
 
     PaddleRemoteControlRocketProjectile* GetActiveRemoteControlRocket() const;
 };
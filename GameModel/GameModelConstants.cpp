@@ -43,6 +43,7 @@ MAX_LIVE_ITEMS(3),
 PROB_OF_GHOSTBALL_BLOCK_MISS(0.322222222),
 LENGTH_OF_GHOSTMODE(1.0),
 INITIAL_WORLD_NUM(0),
+MAX_RESIDENT_LEVELS(2),
 
 INIT_SCORE(0),
 INIT_LIVES_LEFT(3),
@@ -63,6 +63,7 @@ public:
 
 	// World path/file related constants
 	const int INITIAL_WORLD_NUM;
+    const unsigned int MAX_RESIDENT_LEVELS; // Number of most recently played levels that keep their pieces loaded
 	// -------------------------------------------------
 
 	// IN-GAME CONSTANTS -------------------------------
@@ -0,0 +1,327 @@
+/**
+ * GameModelSnapshot.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "GameModelSnapshot.h"
+#include "GameModel.h"
+#include "GameBall.h"
+#include "PlayerPaddle.h"
+#include "Projectile.h"
+#include "GameLevel.h"
+#include "LaserTurretBlock.h"
+#include "RocketTurretBlock.h"
+#include "MineTurretBlock.h"
+
+const float GameModelSnapshot::MAX_INTERPOLATION_DISTANCE = 1.0f;
+
+static bool SmallestToLargestObjectIDSorter(const std::pair<unsigned int, Point2D>& a, 
+                                            const std::pair<unsigned int, Point2D>& b) {
+    return a.first < b.first;
+}
+
+static Point2D InterpolatePosition(const Point2D& from, const Point2D& to, float alpha) {
+    return from + alpha * (to - from);
+}
+
+// Turns the short way round, e.g., from 350 to 10 degrees goes through 0
+static float InterpolateRotation(float fromInDegs, float toInDegs, float alpha) {
+    float diffInDegs = fmod(toInDegs - fromInDegs, 360.0f);
+    if (diffInDegs > 180.0f) {
+        diffInDegs -= 360.0f;
+    }
+    else if (diffInDegs < -180.0f) {
+        diffInDegs += 360.0f;
+    }
+    return fromInDegs + alpha * diffInDegs;
+}
+
+// The level whose turrets are recorded, NULL if there isn't one in play
+static const GameLevel* GetLevelInPlay(const GameModel& model) {
+    const GameLevel* level = model.GetCurrentLevel();
+    if (level == NULL || !level->GetArePiecesLoaded()) {
+        return NULL;
+    }
+    return level;
+}
+
+bool GameModelSnapshot::TurretState::operator==(const TurretState& other) const {
+    if (this->pieceKey != other.pieceKey || this->rotationInDegs != other.rotationInDegs) {
+        return false;
+    }
+    for (int i = 0; i < MAX_BARRELS; i++) {
+        if (this->barrelRecoil[i] != other.barrelRecoil[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+GameModelSnapshot::GameModelSnapshot() : hasPaddle(false) {
+}
+
+GameModelSnapshot::~GameModelSnapshot() {
+}
+
+/**
+ * Record where the paddle, all the balls and all the projectiles of the given model are right now,
+ * along with how the turrets of the current level are aimed.
+ */
+void GameModelSnapshot::Capture(const GameModel& model) {
+    this->Clear();
+
+    const PlayerPaddle* playerPaddle = model.GetPlayerPaddle();
+    if (playerPaddle != NULL) {
+        this->hasPaddle = true;
+        this->paddlePos = playerPaddle->GetCenterPosition();
+    }
+
+    const std::list<GameBall*>& gameBalls = model.GetGameBalls();
+    for (std::list<GameBall*>::const_iterator iter = gameBalls.begin(); iter != gameBalls.end(); ++iter) {
+        const GameBall* currBall = *iter;
+        this->balls.push_back(std::make_pair(currBall->GetObjectID(), currBall->GetCenterPosition2D()));
+    }
+    std::sort(this->balls.begin(), this->balls.end(), SmallestToLargestObjectIDSorter);
+
+    const GameModel::ProjectileMap& projectileMap = model.GetActiveProjectiles();
+    for (GameModel::ProjectileMapConstIter mapIter = projectileMap.begin(); mapIter != projectileMap.end(); ++mapIter) {
+        const GameModel::ProjectileList& currProjectileList = *mapIter->second;
+        for (GameModel::ProjectileListConstIter iter = currProjectileList.begin(); iter != currProjectileList.end(); ++iter) {
+            const Projectile* currProjectile = *iter;
+            this->projectiles.push_back(std::make_pair(currProjectile->GetObjectID(), currProjectile->GetPosition()));
+        }
+    }
+    std::sort(this->projectiles.begin(), this->projectiles.end(), SmallestToLargestObjectIDSorter);
+
+    const GameLevel* level = GetLevelInPlay(model);
+    if (level != NULL) {
+        const std::set<LevelPiece*>& aiPieces = level->GetAIEntities();
+        for (std::set<LevelPiece*>::const_iterator iter = aiPieces.begin(); iter != aiPieces.end(); ++iter) {
+            TurretState turretState;
+            if (ReadTurretState(**iter, turretState)) {
+                this->turrets.push_back(turretState);
+            }
+        }
+        std::sort(this->turrets.begin(), this->turrets.end());
+    }
+}
+
+/**
+ * Record where the paddle, balls, projectiles and turrets of the given model would be at the given fraction (in [0,1])
+ * of the way from the 'from' snapshot to the 'to' snapshot. Only the things that are still where the 'to'
+ * snapshot has them (i.e., nothing has touched them since) are recorded, everything else is left out so that
+ * it's found where it really is. The model itself is only ever read.
+ */
+void GameModelSnapshot::CaptureInterpolated(const GameModel& model, const GameModelSnapshot& from, 
+                                            const GameModelSnapshot& to, float alpha) {
+    assert(this != &from && this != &to);
+    assert(alpha >= 0.0f && alpha <= 1.0f);
+
+    this->Clear();
+
+    static const float MAX_SQ_DIST = MAX_INTERPOLATION_DISTANCE * MAX_INTERPOLATION_DISTANCE;
+
+    const PlayerPaddle* playerPaddle = model.GetPlayerPaddle();
+    if (playerPaddle != NULL && from.hasPaddle && to.hasPaddle &&
+        playerPaddle->GetCenterPosition() == to.paddlePos &&
+        Point2D::SqDistance(from.paddlePos, to.paddlePos) <= MAX_SQ_DIST) {
+
+        this->hasPaddle = true;
+        this->paddlePos = InterpolatePosition(from.paddlePos, to.paddlePos, alpha);
+    }
+
+    const std::list<GameBall*>& gameBalls = model.GetGameBalls();
+    for (std::list<GameBall*>::const_iterator iter = gameBalls.begin(); iter != gameBalls.end(); ++iter) {
+        const GameBall* currBall = *iter;
+        const Point2D* fromPos = FindPosition(from.balls, currBall->GetObjectID());
+        const Point2D* toPos   = FindPosition(to.balls, currBall->GetObjectID());
+
+        if (fromPos != NULL && toPos != NULL && currBall->GetCenterPosition2D() == *toPos &&
+            Point2D::SqDistance(*fromPos, *toPos) <= MAX_SQ_DIST) {
+
+            this->balls.push_back(std::make_pair(currBall->GetObjectID(), InterpolatePosition(*fromPos, *toPos, alpha)));
+        }
+    }
+    std::sort(this->balls.begin(), this->balls.end(), SmallestToLargestObjectIDSorter);
+
+    const GameModel::ProjectileMap& projectileMap = model.GetActiveProjectiles();
+    for (GameModel::ProjectileMapConstIter mapIter = projectileMap.begin(); mapIter != projectileMap.end(); ++mapIter) {
+        const GameModel::ProjectileList& currProjectileList = *mapIter->second;
+        for (GameModel::ProjectileListConstIter iter = currProjectileList.begin(); iter != currProjectileList.end(); ++iter) {
+            const Projectile* currProjectile = *iter;
+            const Point2D* fromPos = FindPosition(from.projectiles, currProjectile->GetObjectID());
+            const Point2D* toPos   = FindPosition(to.projectiles, currProjectile->GetObjectID());
+
+            if (fromPos != NULL && toPos != NULL && currProjectile->GetPosition() == *toPos &&
+                Point2D::SqDistance(*fromPos, *toPos) <= MAX_SQ_DIST) {
+
+                this->projectiles.push_back(std::make_pair(currProjectile->GetObjectID(), 
+                    InterpolatePosition(*fromPos, *toPos, alpha)));
+            }
+        }
+    }
+    std::sort(this->projectiles.begin(), this->projectiles.end(), SmallestToLargestObjectIDSorter);
+
+    // A piece that was swapped for another since the 'to' snapshot won't be aimed the same way
+    const GameLevel* level = GetLevelInPlay(model);
+    if (level != NULL) {
+        const std::set<LevelPiece*>& aiPieces = level->GetAIEntities();
+        for (std::set<LevelPiece*>::const_iterator iter = aiPieces.begin(); iter != aiPieces.end(); ++iter) {
+            TurretState liveState;
+            if (!ReadTurretState(**iter, liveState)) {
+                continue;
+            }
+            const TurretState* fromState = FindTurret(from.turrets, liveState.pieceKey);
+            const TurretState* toState   = FindTurret(to.turrets, liveState.pieceKey);
+            if (fromState == NULL || toState == NULL || !(liveState == *toState)) {
+                continue;
+            }
+
+            TurretState drawnState;
+            drawnState.pieceKey = liveState.pieceKey;
+            drawnState.rotationInDegs = InterpolateRotation(fromState->rotationInDegs, toState->rotationInDegs, alpha);
+            for (int i = 0; i < TurretState::MAX_BARRELS; i++) {
+                drawnState.barrelRecoil[i] = fromState->barrelRecoil[i] + 
+                    alpha * (toState->barrelRecoil[i] - fromState->barrelRecoil[i]);
+            }
+            this->turrets.push_back(drawnState);
+        }
+        std::sort(this->turrets.begin(), this->turrets.end());
+    }
+}
+
+void GameModelSnapshot::Clear() {
+    this->hasPaddle = false;
+    this->balls.clear();
+    this->projectiles.clear();
+    this->turrets.clear();
+}
+
+void GameModelSnapshot::Swap(GameModelSnapshot& other) {
+    std::swap(this->hasPaddle, other.hasPaddle);
+    std::swap(this->paddlePos, other.paddlePos);
+    this->balls.swap(other.balls);
+    this->projectiles.swap(other.projectiles);
+    this->turrets.swap(other.turrets);
+}
+
+Point2D GameModelSnapshot::GetPaddlePosition(const PlayerPaddle& paddle) const {
+    return this->hasPaddle ? this->paddlePos : paddle.GetCenterPosition();
+}
+
+Point2D GameModelSnapshot::GetBallPosition(const GameBall& ball) const {
+    const Point2D* position = FindPosition(this->balls, ball.GetObjectID());
+    return position != NULL ? *position : ball.GetCenterPosition2D();
+}
+
+Point2D GameModelSnapshot::GetProjectilePosition(const Projectile& projectile) const {
+    const Point2D* position = FindPosition(this->projectiles, projectile.GetObjectID());
+    return position != NULL ? *position : projectile.GetPosition();
+}
+
+float GameModelSnapshot::GetTurretRotation(const LevelPiece& turret) const {
+    const TurretState* state = FindTurret(this->turrets, GetPieceKey(turret));
+    if (state != NULL) {
+        return state->rotationInDegs;
+    }
+
+    TurretState liveState;
+    bool isTurret = ReadTurretState(turret, liveState);
+    UNUSED_VARIABLE(isTurret);
+    assert(isTurret);
+    return liveState.rotationInDegs;
+}
+
+float GameModelSnapshot::GetTurretBarrelRecoil(const LevelPiece& turret, int barrelIdx) const {
+    assert(barrelIdx >= 0 && barrelIdx < TurretState::MAX_BARRELS);
+    const TurretState* state = FindTurret(this->turrets, GetPieceKey(turret));
+    if (state != NULL) {
+        return state->barrelRecoil[barrelIdx];
+    }
+
+    TurretState liveState;
+    bool isTurret = ReadTurretState(turret, liveState);
+    UNUSED_VARIABLE(isTurret);
+    assert(isTurret);
+    return liveState.barrelRecoil[barrelIdx];
+}
+
+const Point2D* GameModelSnapshot::FindPosition(const std::vector<ObjectPosition>& positions, unsigned int objectID) {
+    std::vector<ObjectPosition>::const_iterator findIter = std::lower_bound(positions.begin(), positions.end(), 
+        std::make_pair(objectID, Point2D()), SmallestToLargestObjectIDSorter);
+    if (findIter == positions.end() || findIter->first != objectID) {
+        return NULL;
+    }
+    return &findIter->second;
+}
+
+const GameModelSnapshot::TurretState* GameModelSnapshot::FindTurret(const std::vector<TurretState>& turrets,
+                                                                    unsigned int pieceKey) {
+    TurretState key;
+    key.pieceKey = pieceKey;
+    std::vector<TurretState>::const_iterator findIter = std::lower_bound(turrets.begin(), turrets.end(), key);
+    if (findIter == turrets.end() || findIter->pieceKey != pieceKey) {
+        return NULL;
+    }
+    return &(*findIter);
+}
+
+unsigned int GameModelSnapshot::GetPieceKey(const LevelPiece& piece) {
+    return static_cast<unsigned int>((piece.GetHeightIndex() << 16) | piece.GetWidthIndex());
+}
+
+// Reads how the given piece is aimed right now, false if it isn't a turret
+bool GameModelSnapshot::ReadTurretState(const LevelPiece& piece, TurretState& state) {
+    state.pieceKey = GetPieceKey(piece);
+    switch (piece.GetType()) {
+        case LevelPiece::LaserTurret: {
+            const LaserTurretBlock& laserTurret = static_cast<const LaserTurretBlock&>(piece);
+            state.rotationInDegs  = laserTurret.GetRotationDegreesFromX();
+            state.barrelRecoil[0] = laserTurret.GetBarrel1RecoilAmount();
+            state.barrelRecoil[1] = laserTurret.GetBarrel2RecoilAmount();
+            return true;
+        }
+        case LevelPiece::RocketTurret: {
+            const RocketTurretBlock& rocketTurret = static_cast<const RocketTurretBlock&>(piece);
+            state.rotationInDegs  = rocketTurret.GetRotationDegreesFromX();
+            state.barrelRecoil[0] = rocketTurret.GetBarrelRecoilAmount();
+            state.barrelRecoil[1] = 0.0f;
+            return true;
+        }
+        case LevelPiece::MineTurret: {
+            const MineTurretBlock& mineTurret = static_cast<const MineTurretBlock&>(piece);
+            state.rotationInDegs  = mineTurret.GetRotationDegreesFromX();
+            state.barrelRecoil[0] = mineTurret.GetBarrelRecoilAmount();
+            state.barrelRecoil[1] = 0.0f;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * GameModelSnapshot.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __GAMEMODELSNAPSHOT_H__
+#define __GAMEMODELSNAPSHOT_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+#include "../BlammoEngine/Point.h"
+
+class GameModel;
+class GameBall;
+class PlayerPaddle;
+class Projectile;
+class LevelPiece;
+
+/**
+ * Positions of the moving parts of the game model (the paddle, balls, projectiles and the turrets
+ * of the current level) as they were at a particular point in time, typically the end of a fixed
+ * step of the model. Between two consecutive snapshots the view can draw the model part way through
+ * a step without the model itself ever being advanced by anything other than a whole step. Balls and
+ * projectiles are kept by their object IDs and level pieces by where they are in the level, so a
+ * snapshot never refers to the model's objects.
+ */
+class GameModelSnapshot {
+public:
+    GameModelSnapshot();
+    ~GameModelSnapshot();
+
+    void Capture(const GameModel& model);
+    void CaptureInterpolated(const GameModel& model, const GameModelSnapshot& from, const GameModelSnapshot& to, float alpha);
+    void Clear();
+    void Swap(GameModelSnapshot& other);
+    bool IsEmpty() const { 
+        return !this->hasPaddle && this->balls.empty() && this->projectiles.empty() && this->turrets.empty();
+    }
+
+    // Where the given object is in this snapshot, anything that isn't in it is where it really is
+    Point2D GetPaddlePosition(const PlayerPaddle& paddle) const;
+    Point2D GetBallPosition(const GameBall& ball) const;
+    Point2D GetProjectilePosition(const Projectile& projectile) const;
+    float GetTurretRotation(const LevelPiece& turret) const;
+    float GetTurretBarrelRecoil(const LevelPiece& turret, int barrelIdx) const;
+
+private:
+    // Anything that moved further than this between snapshots (e.g., through a portal) isn't interpolated
+    static const float MAX_INTERPOLATION_DISTANCE;
+
+    typedef std::pair<unsigned int, Point2D> ObjectPosition;
+
+    // How a turret block is aimed, kept by the turret's place in the level
+    struct TurretState {
+        static const int MAX_BARRELS = 2;
+
+        unsigned int pieceKey;
+        float rotationInDegs;
+        float barrelRecoil[MAX_BARRELS];
+
+        bool operator<(const TurretState& other) const { return this->pieceKey < other.pieceKey; }
+        bool operator==(const TurretState& other) const;
+    };
+
+    bool hasPaddle;
+    Point2D paddlePos;
+    std::vector<ObjectPosition> balls;        // Sorted by ball object ID
+    std::vector<ObjectPosition> projectiles;  // Sorted by projectile object ID
+    std::vector<TurretState> turrets;         // Sorted by piece key
+
+    static const Point2D* FindPosition(const std::vector<ObjectPosition>& positions, unsigned int objectID);
+    static const TurretState* FindTurret(const std::vector<TurretState>& turrets, unsigned int pieceKey);
+    static unsigned int GetPieceKey(const LevelPiece& piece);
+    static bool ReadTurretState(const LevelPiece& piece, TurretState& state);
+
+    DISALLOW_COPY_AND_ASSIGN(GameModelSnapshot);
+};
+
+#endif // __GAMEMODELSNAPSHOT_H__
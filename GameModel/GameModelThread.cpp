@@ -0,0 +1,212 @@
+/**
+ * GameModelThread.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "GameModelThread.h"
+#include "GameModel.h"
+#include "GameEventManager.h"
+
+#include "../BlammoEngine/BlammoTime.h"
+#include "../BlammoEngine/FrameProfiler.h"
+
+const double GameModelThread::STEP_IN_SECS = 1.0 / 120.0;
+
+// If the model is further behind than this (e.g., the machine was suspended) the rest is let go
+// rather than trying to catch up all at once
+const double GameModelThread::MAX_STEP_BACKLOG_IN_SECS = 0.25;
+
+GameModelThread::GameModelThread(GameModel* model) : model(model), thread(NULL), modelMutex(NULL),
+isStopping(false), prevDispatchMode(GameEventManager::ImmediateDispatch), isSteppingAllowed(false), timeScale(1.0), stepTimeAccumulator(0.0),
+lastUpdateTimeInSecs(0.0), numSnapshots(0), numSteps(0) {
+    assert(model != NULL);
+    this->modelMutex = SDL_CreateMutex();
+    assert(this->modelMutex != NULL);
+}
+
+GameModelThread::~GameModelThread() {
+    this->Stop();
+    SDL_DestroyMutex(this->modelMutex);
+    this->modelMutex = NULL;
+}
+
+/**
+ * Start ticking the model on its own thread, the model doesn't step until the view allows it
+ * with SetStepping. Must be called by the view's thread with the model unlocked.
+ * Returns: true if the thread is running, false if it couldn't be created.
+ */
+bool GameModelThread::Start() {
+    if (this->thread != NULL) {
+        return true;
+    }
+
+    this->Lock();
+    this->isStopping = false;
+    this->isSteppingAllowed = false;
+    this->numSnapshots = 0;
+    this->numSteps = 0;
+
+    this->thread = SDL_CreateThread(&GameModelThread::ModelThreadMain, this);
+    if (this->thread == NULL) {
+        debug_output("Failed to create the game model thread: " << SDL_GetError());
+        this->Unlock();
+        return false;
+    }
+
+    // Nothing can be raised on the new thread until the model is unlocked
+    this->prevDispatchMode = GameEventManager::Instance()->GetDispatchMode();
+    GameEventManager::Instance()->SetModelThread(SDL_GetThreadID(this->thread));
+    GameEventManager::Instance()->SetDispatchMode(GameEventManager::ThreadedDispatch);
+    this->Unlock();
+    return true;
+}
+
+/**
+ * Stop the thread after the step it's in the middle of (if any) and go back to dispatching events
+ * the way they were before the thread started, anything that was recorded is sent out. Must be
+ * called by the view's thread with the model unlocked.
+ */
+void GameModelThread::Stop() {
+    if (this->thread == NULL) {
+        return;
+    }
+
+    this->Lock();
+    this->isStopping = true;
+    this->Unlock();
+
+    SDL_WaitThread(this->thread, NULL);
+    this->thread = NULL;
+
+    GameEventManager::Instance()->SetDispatchMode(this->prevDispatchMode);
+    GameEventManager::Instance()->SetModelThread(0);
+}
+
+/**
+ * Set whether the model should be stepped (e.g., not while the game is paused in a menu) and how
+ * fast its time passes (e.g., with bullet time dilation). Called by the view every frame.
+ */
+void GameModelThread::SetStepping(bool isSteppingAllowed, double timeScale) {
+    assert(timeScale >= 0.0);
+    if (!isSteppingAllowed) {
+        this->numSnapshots = 0;
+    }
+    this->isSteppingAllowed = isSteppingAllowed;
+    this->timeScale = timeScale;
+}
+
+/**
+ * How far the view should draw the model between the previous and current snapshots (in [0,1]),
+ * based on how much time has built up towards the next step.
+ */
+float GameModelThread::GetInterpolationAlpha() const {
+    double elapsedInSecs = BlammoTime::GetHighResolutionTimeInSecs() - this->lastUpdateTimeInSecs;
+    double alpha = (this->stepTimeAccumulator + this->timeScale * elapsedInSecs) / STEP_IN_SECS;
+    return static_cast<float>(std::max<double>(0.0, std::min<double>(1.0, alpha)));
+}
+
+/**
+ * Bring the time built up for the model up to date and take a step if one is due, must be called
+ * with the model locked.
+ * Returns: false if the thread should stop, true otherwise.
+ */
+bool GameModelThread::UpdateAndStep() {
+    if (this->isStopping) {
+        return false;
+    }
+
+    double currTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs();
+    double elapsedInSecs  = currTimeInSecs - this->lastUpdateTimeInSecs;
+    this->lastUpdateTimeInSecs = currTimeInSecs;
+
+    if (!this->isSteppingAllowed) {
+        this->stepTimeAccumulator = 0.0;
+        return true;
+    }
+
+    this->stepTimeAccumulator = std::min<double>(MAX_STEP_BACKLOG_IN_SECS,
+        this->stepTimeAccumulator + this->timeScale * elapsedInSecs);
+    if (this->stepTimeAccumulator >= STEP_IN_SECS) {
+        this->Step();
+        this->stepTimeAccumulator -= STEP_IN_SECS;
+    }
+    return true;
+}
+
+void GameModelThread::Step() {
+    PROFILE_SCOPE("GameModelThread::Step");
+
+    // Remember the model from before and after this step so the view can be drawn between them
+    if (this->numSnapshots == 0) {
+        this->prevSnapshot.Capture(*this->model);
+    }
+    else {
+        this->prevSnapshot.Swap(this->currSnapshot);
+    }
+
+    this->model->Tick(STEP_IN_SECS);
+    this->model->UpdateState();
+
+    this->currSnapshot.Capture(*this->model);
+    this->numSnapshots = 2;
+    this->numSteps++;
+}
+
+int GameModelThread::ModelThreadMain(void* data) {
+    GameModelThread* modelThread = static_cast<GameModelThread*>(data);
+
+    modelThread->Lock();
+    modelThread->lastUpdateTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs();
+    modelThread->Unlock();
+
+    for (;;) {
+        modelThread->Lock();
+        if (!modelThread->UpdateAndStep()) {
+            modelThread->Unlock();
+            break;
+        }
+        // Sleep until the next step is due (there's no sleeping while the model is behind, but the
+        // model is unlocked between steps so the view always gets a look in)
+        double timeToNextStepInSecs = 0.0;
+        if (!modelThread->isSteppingAllowed || modelThread->timeScale <= 0.0) {
+            timeToNextStepInSecs = STEP_IN_SECS;
+        }
+        else if (modelThread->stepTimeAccumulator < STEP_IN_SECS) {
+            timeToNextStepInSecs = (STEP_IN_SECS - modelThread->stepTimeAccumulator) / modelThread->timeScale;
+        }
+        modelThread->Unlock();
+
+        if (timeToNextStepInSecs > 0.0) {
+            SDL_Delay(std::max<Uint32>(1, static_cast<Uint32>(timeToNextStepInSecs * 1000.0)));
+        }
+    }
+
+    FrameProfiler::ReleaseThreadBuffer();
+    return 0;
+}
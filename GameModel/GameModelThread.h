@@ -0,0 +1,111 @@
+/**
+ * GameModelThread.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __GAMEMODELTHREAD_H__
+#define __GAMEMODELTHREAD_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+#include "GameModelSnapshot.h"
+#include "GameEventManager.h"
+
+class GameModel;
+
+/**
+ * Ticks the game model on its own thread in fixed steps of STEP_IN_SECS, so the model keeps
+ * its pace no matter how long the view takes to draw a frame (e.g., on a stall in the graphics
+ * driver). After every step the thread records a snapshot of the model; the view draws the model
+ * part way between the last two of them.
+ *
+ * The model is only ever touched with it locked (see Lock/Unlock): the thread holds the lock for
+ * each step and the view holds it while it reads the model (drawing, input). While the thread is
+ * running the GameEventManager is in threaded dispatch, the events raised during the steps are
+ * recorded and sent out by the view's thread, and the model objects those events refer to are
+ * kept alive until they have been (see GameEventManager::DeleteAfterDispatch).
+ */
+class GameModelThread {
+public:
+    static const double STEP_IN_SECS;
+    static const double MAX_STEP_BACKLOG_IN_SECS;
+
+    GameModelThread(GameModel* model);
+    ~GameModelThread();
+
+    bool Start();
+    void Stop();
+    bool IsRunning() const { return this->thread != NULL; }
+
+    void Lock();
+    void Unlock();
+
+    // These must only be called with the model locked
+    void SetStepping(bool isSteppingAllowed, double timeScale);
+    void ResetSnapshots() { this->numSnapshots = 0; }
+    unsigned long GetNumSteps() const { return this->numSteps; }
+    bool HasSnapshots() const { return this->numSnapshots >= 2; }
+    const GameModelSnapshot& GetPreviousSnapshot() const { return this->prevSnapshot; }
+    const GameModelSnapshot& GetCurrentSnapshot() const { return this->currSnapshot; }
+    float GetInterpolationAlpha() const;
+
+private:
+    GameModel* model;
+    SDL_Thread* thread;
+    SDL_mutex* modelMutex;  // Held whenever the model is being ticked or read
+    bool isStopping;
+    GameEventManager::DispatchMode prevDispatchMode;    // How events were dispatched before the thread started
+
+    bool isSteppingAllowed;
+    double timeScale;               // How fast the model's time passes compared to real time
+    double stepTimeAccumulator;     // Model time that has yet to be stepped through
+    double lastUpdateTimeInSecs;    // When the accumulator was last brought up to date
+
+    int numSnapshots;                   // How many of the previous/current snapshots are from consecutive steps
+    unsigned long numSteps;             // Steps taken since the thread was started
+    GameModelSnapshot prevSnapshot;     // The model as it was before the last step
+    GameModelSnapshot currSnapshot;     // The model as it was after the last step
+
+    bool UpdateAndStep();
+    void Step();
+
+    static int ModelThreadMain(void* data);
+
+    DISALLOW_COPY_AND_ASSIGN(GameModelThread);
+};
+
+inline void GameModelThread::Lock() {
+    SDL_mutexP(this->modelMutex);
+}
+
+inline void GameModelThread::Unlock() {
+    SDL_mutexV(this->modelMutex);
+}
+
+#endif // __GAMEMODELTHREAD_H__
@@ -32,255 +32,416 @@
 #include "GameProgressIO.h"
 #include "GameModel.h"
 
+#include "../BlammoEngine/AsyncFileWriter.h"
+
 #include "../ResourceManager.h"
 
 const char* GameProgressIO::PROGRESS_FILENAME = "bbb_progress.dat";
+const unsigned int GameProgressIO::FILE_MAGIC   = 0x47504242; // "BBPG" when read as little-endian bytes
+const unsigned int GameProgressIO::FILE_VERSION = 1;
+
+std::vector<GameProgressIO::WorldProgress> GameProgressIO::progress;
+bool GameProgressIO::isProgressLoaded = false;
+bool GameProgressIO::isProgressDirty  = false;
+
+// Binary reading/writing helpers, all values are stored little-endian
+
+static void WriteUInt32(std::ostream& out, unsigned int value) {
+    char bytes[4];
+    bytes[0] = static_cast<char>(value & 0xFF);
+    bytes[1] = static_cast<char>((value >> 8) & 0xFF);
+    bytes[2] = static_cast<char>((value >> 16) & 0xFF);
+    bytes[3] = static_cast<char>((value >> 24) & 0xFF);
+    out.write(bytes, 4);
+}
+static void WriteString(std::ostream& out, const std::string& str) {
+    WriteUInt32(out, static_cast<unsigned int>(str.size()));
+    out.write(str.data(), str.size());
+}
 
-bool GameProgressIO::LoadGameProgress(GameModel* model) {
-#define ON_ERROR_CLEAN_UP_AND_EXIT(condition) if (!(condition)) { debug_output("ERROR WHILE LOADING GAME PROGRESS!"); try { inFile.close(); } catch(...) {} return false; }
+static bool ReadUInt32(const char*& curr, const char* end, unsigned int& value) {
+    if (end - curr < 4) {
+        return false;
+    }
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(curr);
+    value = static_cast<unsigned int>(bytes[0]) | (static_cast<unsigned int>(bytes[1]) << 8) |
+        (static_cast<unsigned int>(bytes[2]) << 16) | (static_cast<unsigned int>(bytes[3]) << 24);
+    curr += 4;
+    return true;
+}
+static bool ReadString(const char*& curr, const char* end, std::string& str) {
+    unsigned int length;
+    if (!ReadUInt32(curr, end, length) || static_cast<unsigned int>(end - curr) < length) {
+        return false;
+    }
+    str.assign(curr, length);
+    curr += length;
+    return true;
+}
 
+// FNV-1a checksum of the given bytes, it's stored at the end of the file to catch truncated or corrupted files
+static unsigned int ChecksumBytes(const char* bytes, size_t length) {
+    unsigned int hash = 2166136261U;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ static_cast<unsigned char>(bytes[i])) * 16777619U;
+    }
+    return hash;
+}
+
+/**
+ * Loads the game progress into the given model. The progress file is only read the first time this is
+ * called, after that the progress comes from memory.
+ * Returns: true on success, false if the progress file couldn't be read.
+ */
+bool GameProgressIO::LoadGameProgress(GameModel* model) {
     if (model == NULL) {
         assert(false);
         return false;
     }
 
-    std::ifstream inFile((ResourceManager::GetLoadDir() + std::string(PROGRESS_FILENAME)).c_str(),
-        std::ifstream::in | std::ifstream::binary);
-    bool success = inFile.is_open();
-
-	if (success) {
-
-        // Read in the progress file and set all the values across the model
-        std::string nameStr = "";
-        bool isUnlocked = false;
-        int numWorlds = 0;
-        long highScore = 0;
-        bool starCostPaidFor = false;
-
-        ON_ERROR_CLEAN_UP_AND_EXIT(inFile >> numWorlds);
-        std::getline(inFile, nameStr);  // finish reading the line
-        
-        for (int worldIdx = 0; worldIdx < numWorlds; worldIdx++) {
-
-            // Read the world name
-            ON_ERROR_CLEAN_UP_AND_EXIT(std::getline(inFile, nameStr));
-            
-            // Look up which world we're dealing with based on the read name
-            GameWorld* currWorld = model->GetWorldByName(nameStr);
-            if (currWorld == NULL) {
-                worldIdx = std::max<int>(0, worldIdx-1);
-                continue;
-            }
-            
-            // Read whether the world has been unlocked or not
-            ON_ERROR_CLEAN_UP_AND_EXIT(inFile >> isUnlocked);
-            currWorld->SetHasBeenUnlocked(isUnlocked);
-
-            int numLevels = 0;
-            ON_ERROR_CLEAN_UP_AND_EXIT(inFile >> numLevels);
-            std::getline(inFile, nameStr);  // finish reading the line
-            
-            for (int levelIdx = 0; levelIdx < numLevels; levelIdx++) {
-                // Read the level name
-                ON_ERROR_CLEAN_UP_AND_EXIT(std::getline(inFile, nameStr));
-                // Look up the level we're dealing with based on the read name
-                GameLevel* currLevel = currWorld->GetLevelByName(nameStr);
-                if (currLevel == NULL) {
-                    if (nameStr.empty()) {
-                        levelIdx = std::max<int>(0, levelIdx-1);
-                        continue;
-                    }
-                    else if (numLevels == static_cast<int>(currWorld->GetNumLevels())) {
-                        currLevel = currWorld->GetLevelByIndex(levelIdx);
-                        if (currLevel == NULL) {
-                            continue;
-                        }
-                    }
-                }
-
-                // Read the high-score for the level and set it
-                ON_ERROR_CLEAN_UP_AND_EXIT(inFile >> highScore);
-                std::getline(inFile, nameStr);  // finish reading the line
-                currLevel->SetHighScore(highScore, true);
+    if (!GameProgressIO::isProgressLoaded) {
+        GameProgressIO::isProgressLoaded = true;
 
-                // A flag is stored to indicate whether the unlock star cost of the level has
-                // been paid for (for levels that don't have a cost this will always be true)
-                ON_ERROR_CLEAN_UP_AND_EXIT(inFile >> starCostPaidFor);
-                currLevel->SetAreUnlockStarsPaidFor(starCostPaidFor);
+        bool fileExists = false;
+        if (!GameProgressIO::ReadProgressFile(GameProgressIO::progress, fileExists)) {
+            GameProgressIO::progress.clear();
+            if (fileExists) {
+                debug_output("ERROR WHILE LOADING GAME PROGRESS!");
+                return false;
             }
 
-            currWorld->UpdateLastLevelPassedIndex();
+            // There's no progress file yet, create a new one
+            return GameProgressIO::SaveGameProgress(model);
         }
-        
-        try { inFile.close(); } catch(...) {}
-    }
-    else {
-        // Failed to read from the progress file, create a new one
-        return GameProgressIO::SaveGameProgress(model);
     }
 
+    GameProgressIO::ApplyProgress(GameProgressIO::progress, model);
     return true;
-
-#undef ON_ERROR_CLEAN_UP_AND_EXIT
 }
 
+/**
+ * Saves the progress of the given model, the file is written in the background (and only if the
+ * progress actually changed).
+ */
 bool GameProgressIO::SaveGameProgress(const GameModel* model) {
     if (model == NULL) {
         assert(false);
         return false;
     }
 
-    std::ofstream outFile((ResourceManager::GetLoadDir() + std::string(PROGRESS_FILENAME)).c_str(), std::ios::out | std::ios::binary);
-    if (!outFile.is_open()) {
+    std::vector<WorldProgress> modelProgress;
+    GameProgressIO::CaptureProgress(model, modelProgress);
+    GameProgressIO::SetProgress(modelProgress);
+    return true;
+}
+
+bool GameProgressIO::WipeoutGameProgress(GameModel* model) {
+    GameProgressIO::isProgressLoaded = true;
+    GameProgressIO::SetProgress(std::vector<WorldProgress>());
+
+    model->ClearAllGameProgress();
+
+    return true;
+}
+
+#ifdef _DEBUG
+
+bool GameProgressIO::SaveFullProgressOfGame(const GameModel* model) {
+    if (model == NULL) {
+        assert(false);
         return false;
     }
 
-    // Number of worlds...
-    const std::vector<GameWorld*>& gameWorlds = model->GetGameWorlds();
-    outFile << gameWorlds.size() << std::endl;
-
-    for (size_t worldIdx = 0; worldIdx < gameWorlds.size(); worldIdx++) {
-        const GameWorld* currWorld = gameWorlds.at(worldIdx);
-        assert(currWorld != NULL);
+    std::vector<WorldProgress> fullProgress;
+    GameProgressIO::CaptureProgress(model, fullProgress);
 
-        // World and whether it's been unlocked
-        outFile << currWorld->GetName() << std::endl;
-        outFile << currWorld->GetHasBeenUnlocked() << std::endl;
+    for (size_t worldIdx = 0; worldIdx < fullProgress.size(); worldIdx++) {
+        WorldProgress& worldProgress = fullProgress[worldIdx];
+        worldProgress.isUnlocked = true;
 
-        // World's levels...
-        const std::vector<GameLevel*>& worldLevels = currWorld->GetAllLevelsInWorld();
-        size_t numLevels = currWorld->GetNumLevels();
-        
-        // Number of levels of progress
-        outFile << numLevels << std::endl;
-        for (size_t levelIdx = 0; levelIdx < numLevels; levelIdx++) {
-            const GameLevel* currLevel = worldLevels.at(levelIdx);
-            assert(currLevel != NULL);
-            
-            // Store each unlocked level's high-score
-            outFile << currLevel->GetName() << std::endl;
-            outFile << currLevel->GetHighScore() << std::endl;
-            outFile << currLevel->GetAreUnlockStarsPaidFor() << std::endl;
+        for (size_t levelIdx = 0; levelIdx < worldProgress.levels.size(); levelIdx++) {
+            LevelProgress& levelProgress = worldProgress.levels[levelIdx];
+            levelProgress.highScore = std::max<long>(1, levelProgress.highScore);
+            levelProgress.starCostPaidFor = true;
         }
     }
-    outFile.close();
- 
+
+    GameProgressIO::SetProgress(fullProgress);
     return true;
 }
 
-bool GameProgressIO::WipeoutGameProgress(GameModel* model) {
-    std::ofstream outFile((ResourceManager::GetLoadDir() + std::string(PROGRESS_FILENAME)).c_str(), std::ios::out | std::ios::binary);
-    if (!outFile.is_open()) {
+bool GameProgressIO::SaveFullProgressOfWorld(const GameModel* model, const GameWorld::WorldStyle& worldStyle) {
+    if (model == NULL) {
+        assert(false);
         return false;
     }
 
-    outFile << 0;
-    outFile.close();
+    std::vector<WorldProgress> fullProgress;
+    GameProgressIO::CaptureProgress(model, fullProgress);
 
-    model->ClearAllGameProgress();
+    const std::vector<GameWorld*>& gameWorlds = model->GetGameWorlds();
+    assert(gameWorlds.size() == fullProgress.size());
+
+    for (size_t worldIdx = 0; worldIdx < fullProgress.size(); worldIdx++) {
+        WorldProgress& worldProgress = fullProgress[worldIdx];
+        worldProgress.isUnlocked = true;
+        if (gameWorlds[worldIdx]->GetStyle() != worldStyle) {
+            continue;
+        }
+
+        // Beat all levels but the boss
+        const std::vector<GameLevel*>& worldLevels = gameWorlds[worldIdx]->GetAllLevelsInWorld();
+        for (size_t levelIdx = 0; levelIdx < worldProgress.levels.size(); levelIdx++) {
+            LevelProgress& levelProgress = worldProgress.levels[levelIdx];
+            if (!worldLevels[levelIdx]->GetHasBoss()) {
+                levelProgress.highScore = std::max<long>(1, levelProgress.highScore);
+            }
+            levelProgress.starCostPaidFor = true;
+        }
+    }
 
+    GameProgressIO::SetProgress(fullProgress);
     return true;
 }
 
-#ifdef _DEBUG
+#endif // _DEBUG
 
-bool GameProgressIO::SaveFullProgressOfGame(const GameModel* model) {
-    if (model == NULL) {
-        assert(false);
+std::string GameProgressIO::GetProgressFilepath() {
+    return ResourceManager::GetLoadDir() + std::string(PROGRESS_FILENAME);
+}
+
+/**
+ * Reads the progress file into the given progress. Both the binary format and the older text format
+ * of the file can be read, the file is always written back in the binary format.
+ * Returns: true on success, false if the file doesn't exist (fileExists is set to false) or couldn't be read.
+ */
+bool GameProgressIO::ReadProgressFile(std::vector<WorldProgress>& progress, bool& fileExists) {
+    progress.clear();
+
+    std::ifstream inFile(GameProgressIO::GetProgressFilepath().c_str(), std::ifstream::in | std::ifstream::binary);
+    fileExists = inFile.is_open();
+    if (!fileExists) {
         return false;
     }
 
-    std::ofstream outFile((ResourceManager::GetLoadDir() + std::string(PROGRESS_FILENAME)).c_str(), std::ios::out | std::ios::binary);
-    if (!outFile.is_open()) {
+    std::vector<char> fileBytes((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+    try { inFile.close(); } catch(...) {}
+
+    const char* curr = fileBytes.empty() ? NULL : &fileBytes[0];
+    const char* end  = curr + fileBytes.size();
+    unsigned int magic = 0;
+    if (ReadUInt32(curr, end, magic) && magic == GameProgressIO::FILE_MAGIC) {
+        return GameProgressIO::ReadBinaryProgress(fileBytes.empty() ? NULL : &fileBytes[0], fileBytes.size(), progress);
+    }
+
+    std::istringstream textStream(std::string(fileBytes.begin(), fileBytes.end()), std::ios_base::in | std::ios_base::binary);
+    return GameProgressIO::ReadTextProgress(textStream, progress);
+}
+
+bool GameProgressIO::ReadBinaryProgress(const char* buffer, size_t length, std::vector<WorldProgress>& progress) {
+    // The checksum covers everything before it
+    if (length < 4) {
+        return false;
+    }
+    const char* checksumPos = buffer + length - 4;
+    unsigned int checksum = 0;
+    if (!ReadUInt32(checksumPos, buffer + length, checksum) || checksum != ChecksumBytes(buffer, length - 4)) {
+        debug_output("ERROR: Game progress file is corrupt.");
         return false;
     }
 
-    // Number of worlds...
-    const std::vector<GameWorld*>& gameWorlds = model->GetGameWorlds();
-    outFile << gameWorlds.size() << std::endl;
+    const char* curr = buffer;
+    const char* end  = buffer + length - 4;
+    unsigned int magic, version, numWorlds;
+    if (!ReadUInt32(curr, end, magic) || magic != GameProgressIO::FILE_MAGIC ||
+        !ReadUInt32(curr, end, version) || version != GameProgressIO::FILE_VERSION ||
+        !ReadUInt32(curr, end, numWorlds)) {
+        return false;
+    }
 
-    for (size_t worldIdx = 0; worldIdx < gameWorlds.size(); worldIdx++) {
-        const GameWorld* currWorld = gameWorlds.at(worldIdx);
-        assert(currWorld != NULL);
+    progress.resize(numWorlds);
+    for (unsigned int worldIdx = 0; worldIdx < numWorlds; worldIdx++) {
+        WorldProgress& worldProgress = progress[worldIdx];
+        unsigned int isUnlocked, numLevels;
+        if (!ReadString(curr, end, worldProgress.name) || !ReadUInt32(curr, end, isUnlocked) || 
+            !ReadUInt32(curr, end, numLevels)) {
+            return false;
+        }
+        worldProgress.isUnlocked = (isUnlocked != 0);
+
+        worldProgress.levels.resize(numLevels);
+        for (unsigned int levelIdx = 0; levelIdx < numLevels; levelIdx++) {
+            LevelProgress& levelProgress = worldProgress.levels[levelIdx];
+            unsigned int highScore, starCostPaidFor;
+            if (!ReadString(curr, end, levelProgress.name) || !ReadUInt32(curr, end, highScore) ||
+                !ReadUInt32(curr, end, starCostPaidFor)) {
+                return false;
+            }
+            levelProgress.highScore = static_cast<long>(static_cast<int>(highScore));
+            levelProgress.starCostPaidFor = (starCostPaidFor != 0);
+        }
+    }
 
-        // World index followed by scope
-        outFile << currWorld->GetName() << std::endl;
-        outFile << true << std::endl; // (The world has been unlocked)
+    return curr == end;
+}
 
-        const std::vector<GameLevel*>& worldLevels = currWorld->GetAllLevelsInWorld();
-        size_t numLevels = currWorld->GetNumLevels();
-        
-        // Number of levels of progress
-        outFile << numLevels << std::endl;
-        for (size_t levelIdx = 0; levelIdx < numLevels; levelIdx++) {
-            const GameLevel* currLevel = worldLevels.at(levelIdx);
-            assert(currLevel != NULL);
-            
-            // Store each unlocked level's high-score
-            outFile << currLevel->GetName() << std::endl;
-            outFile << std::max<long>(1, currLevel->GetHighScore()) << std::endl;
-            outFile << true << std::endl; // Star cost to unlock is paid for
+// Reads the next non-empty line, the values in the text format aren't always followed by a line break
+static bool ReadNonEmptyLine(std::istream& inFile, std::string& line) {
+    while (std::getline(inFile, line)) {
+        if (!line.empty() && line != "\r") {
+            return true;
         }
     }
-    outFile.close();
- 
-    return true;
+    return false;
 }
 
-bool GameProgressIO::SaveFullProgressOfWorld(const GameModel* model, const GameWorld::WorldStyle& worldStyle) {
-    if (model == NULL) {
-        assert(false);
+// Reads the original text format of the progress file
+bool GameProgressIO::ReadTextProgress(std::istream& inFile, std::vector<WorldProgress>& progress) {
+    int numWorlds = 0;
+    if (!(inFile >> numWorlds) || numWorlds < 0) {
         return false;
     }
 
-    std::ofstream outFile((ResourceManager::GetLoadDir() + std::string(PROGRESS_FILENAME)).c_str(), std::ios::out | std::ios::binary);
-    if (!outFile.is_open()) {
-        return false;
+    progress.resize(numWorlds);
+    for (int worldIdx = 0; worldIdx < numWorlds; worldIdx++) {
+        WorldProgress& worldProgress = progress[worldIdx];
+        int numLevels = 0;
+        if (!ReadNonEmptyLine(inFile, worldProgress.name) || !(inFile >> worldProgress.isUnlocked) ||
+            !(inFile >> numLevels) || numLevels < 0) {
+            return false;
+        }
+
+        worldProgress.levels.resize(numLevels);
+        for (int levelIdx = 0; levelIdx < numLevels; levelIdx++) {
+            LevelProgress& levelProgress = worldProgress.levels[levelIdx];
+            if (!ReadNonEmptyLine(inFile, levelProgress.name) || !(inFile >> levelProgress.highScore) ||
+                !(inFile >> levelProgress.starCostPaidFor)) {
+                return false;
+            }
+        }
     }
 
-    // Number of worlds...
+    return true;
+}
+
+/**
+ * Queues the in-memory progress to be written to the progress file in the background.
+ */
+void GameProgressIO::WriteProgress() {
+    std::ostringstream outData(std::ios_base::out | std::ios_base::binary);
+    WriteUInt32(outData, GameProgressIO::FILE_MAGIC);
+    WriteUInt32(outData, GameProgressIO::FILE_VERSION);
+
+    WriteUInt32(outData, static_cast<unsigned int>(GameProgressIO::progress.size()));
+    for (size_t worldIdx = 0; worldIdx < GameProgressIO::progress.size(); worldIdx++) {
+        const WorldProgress& worldProgress = GameProgressIO::progress[worldIdx];
+        WriteString(outData, worldProgress.name);
+        WriteUInt32(outData, worldProgress.isUnlocked ? 1 : 0);
+
+        WriteUInt32(outData, static_cast<unsigned int>(worldProgress.levels.size()));
+        for (size_t levelIdx = 0; levelIdx < worldProgress.levels.size(); levelIdx++) {
+            const LevelProgress& levelProgress = worldProgress.levels[levelIdx];
+            WriteString(outData, levelProgress.name);
+            WriteUInt32(outData, static_cast<unsigned int>(levelProgress.highScore));
+            WriteUInt32(outData, levelProgress.starCostPaidFor ? 1 : 0);
+        }
+    }
+
+    std::string fileData = outData.str();
+    WriteUInt32(outData, ChecksumBytes(fileData.data(), fileData.size()));
+
+    AsyncFileWriter::GetInstance()->Write(GameProgressIO::GetProgressFilepath(), outData.str());
+    GameProgressIO::isProgressDirty = false;
+}
+
+// Copies the progress of every world and level in the given model, in the model's order
+void GameProgressIO::CaptureProgress(const GameModel* model, std::vector<WorldProgress>& progress) {
     const std::vector<GameWorld*>& gameWorlds = model->GetGameWorlds();
-    outFile << gameWorlds.size() << std::endl;
+    progress.resize(gameWorlds.size());
 
     for (size_t worldIdx = 0; worldIdx < gameWorlds.size(); worldIdx++) {
-        const GameWorld* currWorld = gameWorlds.at(worldIdx);
+        const GameWorld* currWorld = gameWorlds[worldIdx];
         assert(currWorld != NULL);
 
-        // World index followed by scope
-        outFile << currWorld->GetName() << std::endl;
-        outFile << true << std::endl; // (The world has been unlocked)
+        WorldProgress& worldProgress = progress[worldIdx];
+        worldProgress.name = currWorld->GetName();
+        worldProgress.isUnlocked = currWorld->GetHasBeenUnlocked();
 
         const std::vector<GameLevel*>& worldLevels = currWorld->GetAllLevelsInWorld();
-        size_t numLevels = currWorld->GetNumLevels();
-        
-        // Number of levels of progress
-        outFile << numLevels << std::endl;
-        for (size_t levelIdx = 0; levelIdx < numLevels; levelIdx++) {
-            const GameLevel* currLevel = worldLevels.at(levelIdx);
+        worldProgress.levels.resize(worldLevels.size());
+        for (size_t levelIdx = 0; levelIdx < worldLevels.size(); levelIdx++) {
+            const GameLevel* currLevel = worldLevels[levelIdx];
             assert(currLevel != NULL);
-            
-            // Store each unlocked level's high-score
-            outFile << currLevel->GetName() << std::endl;
-            if (currWorld->GetStyle() == worldStyle) {
-                // Beat all levels but the boss
-                if (currLevel->GetHasBoss()) {
-                    outFile << currLevel->GetHighScore() << std::endl;
-                }
-                else {
-                    outFile << std::max<long>(1, currLevel->GetHighScore()) << std::endl;
-                }
-                outFile << true << std::endl; // star cost is paid for
+
+            LevelProgress& levelProgress = worldProgress.levels[levelIdx];
+            levelProgress.name = currLevel->GetName();
+            levelProgress.highScore = currLevel->GetHighScore();
+            levelProgress.starCostPaidFor = currLevel->GetAreUnlockStarsPaidFor();
+        }
+    }
+}
+
+/**
+ * Sets the given progress on the model's worlds and levels. The progress is almost always in the same
+ * order as the model (it was captured from it) so worlds and levels are matched up by index, they're
+ * only looked up by name when that doesn't match (e.g., the progress came from a file for other worlds).
+ */
+void GameProgressIO::ApplyProgress(const std::vector<WorldProgress>& progress, GameModel* model) {
+    const std::vector<GameWorld*>& gameWorlds = model->GetGameWorlds();
+
+    for (size_t worldIdx = 0; worldIdx < progress.size(); worldIdx++) {
+        const WorldProgress& worldProgress = progress[worldIdx];
+
+        GameWorld* currWorld = NULL;
+        if (worldIdx < gameWorlds.size() && gameWorlds[worldIdx]->GetName() == worldProgress.name) {
+            currWorld = gameWorlds[worldIdx];
+        }
+        else {
+            currWorld = model->GetWorldByName(worldProgress.name);
+            if (currWorld == NULL) {
+                continue;
+            }
+        }
+        currWorld->SetHasBeenUnlocked(worldProgress.isUnlocked);
+
+        const std::vector<GameLevel*>& worldLevels = currWorld->GetAllLevelsInWorld();
+        for (size_t levelIdx = 0; levelIdx < worldProgress.levels.size(); levelIdx++) {
+            const LevelProgress& levelProgress = worldProgress.levels[levelIdx];
+
+            GameLevel* currLevel = NULL;
+            if (levelIdx < worldLevels.size() && worldLevels[levelIdx]->GetName() == levelProgress.name) {
+                currLevel = worldLevels[levelIdx];
             }
             else {
-                outFile << currLevel->GetHighScore() << std::endl;
-                outFile << currLevel->GetAreUnlockStarsPaidFor() << std::endl;
+                currLevel = currWorld->GetLevelByName(levelProgress.name);
+                if (currLevel == NULL) {
+                    // A renamed level keeps its progress as long as the world still has the same number of levels
+                    if (worldProgress.levels.size() != worldLevels.size()) {
+                        continue;
+                    }
+                    currLevel = worldLevels[levelIdx];
+                }
             }
 
+            currLevel->SetHighScore(levelProgress.highScore, true);
+            currLevel->SetAreUnlockStarsPaidFor(levelProgress.starCostPaidFor);
         }
+
+        currWorld->UpdateLastLevelPassedIndex();
     }
-    outFile.close();
- 
-    return true;
 }
 
-#endif // _DEBUG
\ No newline at end of file
+// Replaces the in-memory progress, it's queued for writing if it changed or if the last write of it failed
+void GameProgressIO::SetProgress(const std::vector<WorldProgress>& newProgress) {
+    if (AsyncFileWriter::GetInstance()->TakeFailedWrite(GameProgressIO::GetProgressFilepath())) {
+        debug_output("ERROR: The last game progress write failed, writing it again");
+        GameProgressIO::isProgressDirty = true;
+    }
+    if (!(newProgress == GameProgressIO::progress)) {
+        GameProgressIO::progress = newProgress;
+        GameProgressIO::isProgressDirty = true;
+    }
+    if (GameProgressIO::isProgressDirty) {
+        GameProgressIO::WriteProgress();
+    }
+}
@@ -39,7 +39,10 @@
 class GameModel;
 
 /** 
- * Static class for saving and loading game progress from file.
+ * Static class for saving and loading game progress. The progress is read from file once and then
+ * kept in memory (indexed the same way as the model's worlds and levels), loading the progress into a
+ * model never touches the disk after that. Saving updates the in-memory progress and, if anything changed,
+ * hands the file off to the AsyncFileWriter so that it's written in the background and atomically.
  */
 class GameProgressIO {
 public:
@@ -54,6 +57,41 @@ public:
 
 private:
     static const char* PROGRESS_FILENAME;
+    static const unsigned int FILE_MAGIC;
+    static const unsigned int FILE_VERSION;
+
+    struct LevelProgress {
+        std::string name;
+        long highScore;
+        bool starCostPaidFor;
+
+        bool operator==(const LevelProgress& other) const {
+            return this->highScore == other.highScore && this->starCostPaidFor == other.starCostPaidFor && this->name == other.name;
+        }
+    };
+    struct WorldProgress {
+        std::string name;
+        bool isUnlocked;
+        std::vector<LevelProgress> levels;
+
+        bool operator==(const WorldProgress& other) const {
+            return this->isUnlocked == other.isUnlocked && this->name == other.name && this->levels == other.levels;
+        }
+    };
+
+    static std::vector<WorldProgress> progress; // The in-memory copy of the progress file
+    static bool isProgressLoaded;               // Whether the progress file has been read yet
+    static bool isProgressDirty;                // Whether the in-memory progress has changes that haven't been queued for writing (or failed to write)
+
+    static std::string GetProgressFilepath();
+    static bool ReadProgressFile(std::vector<WorldProgress>& progress, bool& fileExists);
+    static bool ReadBinaryProgress(const char* buffer, size_t length, std::vector<WorldProgress>& progress);
+    static bool ReadTextProgress(std::istream& inFile, std::vector<WorldProgress>& progress);
+    static void WriteProgress();
+
+    static void CaptureProgress(const GameModel* model, std::vector<WorldProgress>& progress);
+    static void ApplyProgress(const std::vector<WorldProgress>& progress, GameModel* model);
+    static void SetProgress(const std::vector<WorldProgress>& newProgress);
 
     GameProgressIO() {};
     ~GameProgressIO() {};
@@ -113,10 +113,10 @@ bool GameState::DoUpdateToPaddleBoundriesAndCollisions(double dT, bool doAttache
 	bool didCollideWithCurrentPiece = false;
     bool didCollideWithAnyPiece = false;
 	
-    std::set<LevelPiece*> collisionCandidatePieces;
-    currentLevel->GetLevelPieceCollisionCandidates(*paddle, doAttachedBallCollision, collisionCandidatePieces);
+    currentLevel->GetLevelPieceCollisionCandidates(*paddle, doAttachedBallCollision, this->paddleCollisionCandidates);
 
-	for (std::set<LevelPiece*>::iterator iter = collisionCandidatePieces.begin(); iter != collisionCandidatePieces.end(); ++iter) {
+	for (LevelPieceCandidateBuffer::const_iterator iter = this->paddleCollisionCandidates.begin(); 
+         iter != this->paddleCollisionCandidates.end(); ++iter) {
 		LevelPiece* currPiece = *iter;
         if (currPiece->IsNoBoundsPieceType() && currPiece->GetType() != LevelPiece::Portal) {
 			continue;
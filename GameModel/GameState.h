@@ -34,6 +34,8 @@
 
 #include "../BlammoEngine/BasicIncludes.h"
 
+#include "LevelPieceCandidateBuffer.h"
+
 class GameModel;
 class GameBall;
 
@@ -67,6 +69,8 @@ protected:
 	GameModel* gameModel;
 
 private:
+    LevelPieceCandidateBuffer paddleCollisionCandidates; // Reused every tick for looking up the level pieces near the paddle
+
     DISALLOW_COPY_AND_ASSIGN(GameState);
 };
 
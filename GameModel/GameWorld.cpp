@@ -32,6 +32,8 @@
 #include "GameWorld.h"
 #include "GameLevel.h"
 #include "GameTransformMgr.h"
+#include "GameModel.h"
+#include "LevelPack.h"
 
 #include "../BlammoEngine/StringHelper.h"
 
@@ -80,113 +82,45 @@ bool GameWorld::Load(GameModel* gameModel) {
 		this->Unload();
 	}
 
-	std::istringstream* inFile = ResourceManager::GetInstance()->FilepathToInStream(this->worldFilepath);
-	if (inFile == NULL) {
-		assert(false);
-		this->Unload();
-		return false;
-	}
+    // Use the precompiled world if the game's level pack has it, otherwise read the world's text file
+    CompiledWorld textWorld;
+    const LevelPack* levelPack = gameModel->GetLevelPack();
+    const CompiledWorld* world = (levelPack != NULL) ? levelPack->GetCurrentWorld(this->worldFilepath) : NULL;
+    if (world == NULL) {
+	    std::istringstream* inFile = ResourceManager::GetInstance()->FilepathToInStream(this->worldFilepath);
+	    if (inFile == NULL) {
+		    assert(false);
+		    this->Unload();
+		    return false;
+	    }
+
+        bool success = CompiledWorld::ReadFromText(*inFile, this->worldFilepath, textWorld);
+	    delete inFile;
+	    inFile = NULL;
+        if (!success) {
+            return false;
+        }
+        world = &textWorld;
+    }
 
 	// Figure out the world style
-	std::string worldStyleStr("");
-	while (worldStyleStr.empty()) {
-		if (!std::getline(*inFile, worldStyleStr)) {
-			debug_output("ERROR: Could not find world style in world file: " << this->worldFilepath);
-			delete inFile;
-			inFile = NULL;
-			return false;		
-		}
-		worldStyleStr = stringhelper::trim(worldStyleStr);
-	}
-
-	this->style = GameWorld::GetWorldStyleFromString(worldStyleStr);
+	this->style = GameWorld::GetWorldStyleFromString(world->styleName);
 	if (this->style == None) {
 		debug_output("ERROR: 'None' is not a valid world style in world file: " << this->worldFilepath);
-		delete inFile;
-		inFile = NULL;
 		return false;	
 	}
 
-	// Read the name of the world
-	this->name.clear();
-	while (this->name.empty()) {
-		if (!std::getline(*inFile, this->name)) {
-			debug_output("ERROR: Could not find world name in world file: " << this->worldFilepath);
-			delete inFile;
-			inFile = NULL;
-			return false;		
-		}
-		this->name = stringhelper::trim(this->name);
-	}
-
-    // Read the image file path for the world
-    this->imageFilepath.clear();
-	while (this->imageFilepath.empty()) {
-		if (!std::getline(*inFile, this->imageFilepath)) {
-			debug_output("ERROR: Could not find world image filepath in world file: " << this->worldFilepath);
-			delete inFile;
-			inFile = NULL;
-			return false;		
-		}
-		this->imageFilepath = stringhelper::trim(this->imageFilepath);
-	}
+	this->name = world->name;
+    this->imageFilepath = world->imageFilepath;
 
-	// Read all the level file names
-	std::vector<std::string> levelFileList;
-    std::vector<int> levelUnlockStarAmts;
-	std::string currLineStr;
-
-    while (std::getline(*inFile, currLineStr)) {
-        currLineStr = stringhelper::trim(currLineStr);
-        if (!currLineStr.empty()) {
-
-            if (currLineStr[0] != '#') {
-                // Check to see if the level has a milestone star amount associated with it
-                std::vector<std::string> tokens;
-                stringhelper::Tokenize(currLineStr, tokens, ":");
-                
-                int numStarsRequiredForUnlock = 0;
-                std::string levelFilepathStr = currLineStr;
-                if (tokens.size() > 1) {
-                    // There's a milestone star amount...
-                    std::stringstream numStarsStrStream(stringhelper::trim(tokens.back()));
-                    if (!(numStarsStrStream >> numStarsRequiredForUnlock)) {
-                        debug_output("ERROR: Failed to read the number of milestone stars for level: " + levelFilepathStr + " in world " + this->worldFilepath);
-                        delete inFile;
-                        inFile = NULL;
-                        return false;
-                    }
-                    else {
-                        levelFilepathStr = stringhelper::trim(tokens.front());
-                        if (levelFilepathStr.empty()) {
-                            debug_output("ERROR: Failed to read file: " + levelFilepathStr + " from line " + currLineStr + " in world " + this->worldFilepath);
-                            delete inFile;
-                            inFile = NULL;
-                            return false;
-                        }
-                    }
-                }
+	const std::vector<std::string>& levelFileList = world->levelFilepaths;
+    const std::vector<int>& levelUnlockStarAmts = world->levelUnlockStarAmts;
 
-		        levelFileList.push_back(levelFilepathStr);
-                levelUnlockStarAmts.push_back(numStarsRequiredForUnlock);
-            }
-        }
-	}
-
-	if (levelFileList.size() == 0) {
-		debug_output("ERROR: There must be at least one level defined in world file: " << this->worldFilepath);
-		delete inFile;
-		inFile = NULL;
-		return false;			
-	}
-
-	delete inFile;
-	inFile = NULL;
-
-	// Load each of the levels
+	// Load each of the levels, only their metadata and parsed templates are loaded here - the pieces
+    // of a level get built when it's set as the current level
     assert(levelUnlockStarAmts.size() == levelFileList.size());
 	for (size_t i = 0; i < levelFileList.size(); i++) {
-        GameLevel* lvl = GameLevel::CreateGameLevelFromFile(gameModel, this->GetStyle(), i, levelUnlockStarAmts[i], levelFileList[i]);
+        GameLevel* lvl = GameLevel::CreateGameLevelFromFile(gameModel, i, levelUnlockStarAmts[i], levelFileList[i]);
 		if (lvl == NULL) {
 			// Clean up and exit on erroneous level read
 			this->Unload();
@@ -209,7 +143,7 @@ bool GameWorld::Load(GameModel* gameModel) {
  */
 bool GameWorld::Unload() {
 	for (size_t i = 0; i < this->loadedLevels.size(); i++) {
-		delete this->loadedLevels[i];
+		GameEventManager::Instance()->DeleteAfterDispatch(this->loadedLevels[i]);
 		this->loadedLevels[i] = NULL;
 	}
 	this->loadedLevels.clear();
@@ -376,7 +310,7 @@ int GameWorld::WorldBossArcadeScore(GameWorld::WorldStyle worldType) {
  * camera is properly transformed to view it and raising an event that the level has
  * been started.
  */
-void GameWorld::SetCurrentLevel(GameModel* model, int levelNum) {
+bool GameWorld::SetCurrentLevel(GameModel* model, int levelNum) {
 	assert(isLoaded);
 	assert(levelNum < static_cast<int>(this->loadedLevels.size()));
 	assert(levelNum >= 0);
@@ -384,10 +318,15 @@ void GameWorld::SetCurrentLevel(GameModel* model, int levelNum) {
 	this->currentLevelNum = levelNum;
     
 	GameLevel* currentLevel = this->GetCurrentLevel();
+    if (!currentLevel->LoadPieces(model, this->style)) {
+        debug_output("ERROR: Could not load the pieces of level: " << currentLevel->GetFilepath());
+        return false;
+    }
 	currentLevel->InitAfterLevelLoad(model);
 
 	// Setup the default transforms for the new level
 	this->transformMgr.SetupLevelCameraDefaultPosition(*this->GetCurrentLevel());
+    return true;
 }
 
 void GameWorld::UpdateLastLevelPassedIndex() {
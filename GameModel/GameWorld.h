@@ -76,6 +76,9 @@ public:
 
 	bool Load(GameModel* gameModel);
 	bool Unload();
+    bool GetIsLoaded() const {
+        return this->isLoaded;
+    }
 	
 	const std::vector<GameLevel*>& GetAllLevelsInWorld() const {
 		return this->loadedLevels;
@@ -131,7 +134,7 @@ public:
         return this->worldFilepath;
     }
 
-	void SetCurrentLevel(GameModel* model, int levelNum);
+	bool SetCurrentLevel(GameModel* model, int levelNum);
 
 	// Returns whether the current level is the last level in this world.
 	bool IsLastLevel() const {
@@ -50,6 +50,13 @@ public:
 
     GeneralEffectEventInfo::Type GetType() const { return GeneralEffectEventInfo::GenericEmitter; }
 
+    // The copy takes over all of the emitters (they can only be handed off to the GameView once)
+    GeneralEffectEventInfo* Clone() const {
+        GenericEmitterEffectInfo* copy = new GenericEmitterEffectInfo(this->emitters);
+        this->emitters.clear();
+        return copy;
+    }
+
     // Caller takes ownership of all the memory!
     void TakeEmitters(std::vector<ESPAbstractEmitter*>& emitters) const { 
         emitters = this->emitters;
@@ -34,6 +34,8 @@
 #include "GameModel.h"
 #include "GameItemTimer.h"
 
+DEFINE_POOLED_ALLOCATION(GhostBallItem, 4)
+
 const double GhostBallItem::GHOST_BALL_TIMER_IN_SECS	= 25.0;
 const char* GhostBallItem::GHOST_BALL_ITEM_NAME			  = "GhostBall";
 
@@ -61,7 +63,7 @@ double GhostBallItem::Activate() {
 	for (unsigned int i = 0; i < removeTimers.size(); i++) {
 			GameItemTimer* currTimer = removeTimers[i];
 			activeTimers.remove(currTimer);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 	}
 
@@ -41,6 +41,8 @@ class Point2D;
 
 class GhostBallItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* GHOST_BALL_ITEM_NAME;
 	static const double GHOST_BALL_TIMER_IN_SECS;
 
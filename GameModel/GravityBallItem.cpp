@@ -31,6 +31,8 @@
 
 #include "GravityBallItem.h"
 
+DEFINE_POOLED_ALLOCATION(GravityBallItem, 4)
+
 const char* GravityBallItem::GRAVITY_BALL_ITEM_NAME			= "GravityBall";
 const double GravityBallItem::GRAVITY_BALL_TIMER_IN_SECS	= 17.0;
 
@@ -52,7 +54,7 @@ double GravityBallItem::Activate() {
 		// Remove the gravity ball timers from the list of active timers
 		if (currTimer->GetTimerItemType() == GameItem::GravityBallItem) {
 			iter = activeTimers.erase(iter);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 		}
 		else {
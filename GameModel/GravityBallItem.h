@@ -41,6 +41,8 @@ class Point2D;
 
 class GravityBallItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* GRAVITY_BALL_ITEM_NAME;
 	static const double GRAVITY_BALL_TIMER_IN_SECS;
 
@@ -34,6 +34,8 @@
 #include "GameModel.h"
 #include "GameItemTimer.h"
 
+DEFINE_POOLED_ALLOCATION(IceBallItem, 4)
+
 const double IceBallItem::ICE_BALL_TIMER_IN_SECS	= 22.0;
 const char* IceBallItem::ICE_BALL_ITEM_NAME			  = "IceBall";
 
@@ -55,7 +57,7 @@ double IceBallItem::Activate() {
 		// Remove the gravity ball timers from the list of active timers
 		if (currTimer->GetTimerItemType() == GameItem::IceBallItem) {
 			iter = activeTimers.erase(iter);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 		}
 		else if (currTimer->GetTimerItemType() == GameItem::FireBallItem) {
@@ -72,7 +74,7 @@ double IceBallItem::Activate() {
             
             // If there's a fire ball item going right now then the effects just cancel each other out
 			iter = activeTimers.erase(iter);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 			return 0.0;
 		}
@@ -41,6 +41,8 @@ class Point2D;
 
 class IceBallItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* ICE_BALL_ITEM_NAME;
 	static const double ICE_BALL_TIMER_IN_SECS;
 
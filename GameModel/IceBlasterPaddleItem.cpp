@@ -33,6 +33,8 @@
 #include "GameModel.h"
 #include "GameItemTimer.h"
 
+DEFINE_POOLED_ALLOCATION(IceBlasterPaddleItem, 4)
+
 const char* IceBlasterPaddleItem::ICE_BLASTER_PADDLE_ITEM_NAME      = "IceBlasterPaddle";
 const double IceBlasterPaddleItem::ICE_BLASTER_PADDLE_TIMER_IN_SECS = 17.0f;
 
@@ -56,7 +58,7 @@ double IceBlasterPaddleItem::Activate() {
         // Remove the fire blaster timers from the list of active timers
         if (currTimer->GetTimerItemType() == GameItem::IceBlasterPaddleItem) {
             iter = activeTimers.erase(iter);
-            delete currTimer;
+            GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
             currTimer = NULL;
         }
         else if (currTimer->GetTimerItemType() == GameItem::FlameBlasterPaddleItem) {
@@ -66,7 +68,7 @@ double IceBlasterPaddleItem::Activate() {
 
             // If there's a fire blaster item going right now then the effects just cancel each other out
             iter = activeTimers.erase(iter);
-            delete currTimer;
+            GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
             currTimer = NULL;
 
             return 0.0;
@@ -36,6 +36,8 @@
 
 class IceBlasterPaddleItem : public GameItem {
 public:
+    DECLARE_POOLED_ALLOCATION();
+
     static const char* ICE_BLASTER_PADDLE_ITEM_NAME;
     static const double ICE_BLASTER_PADDLE_TIMER_IN_SECS;
 
@@ -150,7 +150,7 @@ LevelPiece* InkBlock::Destroy(GameModel* gameModel, const LevelPiece::Destructio
 
 	// Obliterate all that is left of this block...
 	LevelPiece* tempThis = this;
-	delete tempThis;
+	GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
 	tempThis = NULL;
 
     // Add to the boost meter
@@ -0,0 +1,156 @@
+/**
+ * InputRecorder.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "InputRecorder.h"
+
+const char* InputRecorder::RECORD_TYPE_NAMES[InputRecorder::NumRecordTypes] = {
+    "session", "unlockeditems", "start", "resetlevel", "tick", "move", "moveother", "shoot", "shootcontinuous",
+    "boost", "boostrelease", "allowlaunch", "pause", "difficulty", "boostmode", "invertboost", "result"
+};
+
+const char* InputRecorder::RecordTypeToString(const RecordType& type) {
+    assert(type >= 0 && type < InputRecorder::NumRecordTypes);
+    return InputRecorder::RECORD_TYPE_NAMES[type];
+}
+
+bool InputRecorder::StringToRecordType(const std::string& str, RecordType& type) {
+    for (int i = 0; i < InputRecorder::NumRecordTypes; i++) {
+        if (str == InputRecorder::RECORD_TYPE_NAMES[i]) {
+            type = static_cast<RecordType>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+InputRecorder::~InputRecorder() {
+    this->End();
+}
+
+bool InputRecorder::Begin(const std::string& filepath, unsigned long seed, int difficulty, int ballBoostMode, 
+                          bool ballBoostIsInverted, int pauseBitField, const std::vector<std::string>& unlockedItemNames) {
+    this->End();
+
+    this->outFile.open(filepath.c_str(), std::ios::out | std::ios::trunc);
+    if (!this->outFile.is_open()) {
+        debug_output("Failed to open input recording file: " << filepath);
+        return false;
+    }
+
+    // Enough digits that every float/double is read back as exactly the same value
+    this->outFile.precision(std::numeric_limits<double>::digits10 + 2);
+    this->numRecords = 0;
+
+    this->StartRecord(InputRecorder::SessionRecord) << " " << seed << " " << difficulty << " " 
+        << ballBoostMode << " " << (ballBoostIsInverted ? 1 : 0) << " " << pauseBitField << "\n";
+
+    std::ostream& unlockedItemsRecord = this->StartRecord(InputRecorder::UnlockedItemsRecord);
+    unlockedItemsRecord << " " << unlockedItemNames.size();
+    for (std::vector<std::string>::const_iterator iter = unlockedItemNames.begin(); iter != unlockedItemNames.end(); ++iter) {
+        unlockedItemsRecord << " " << *iter;
+    }
+    unlockedItemsRecord << "\n";
+    return true;
+}
+
+void InputRecorder::End() {
+    if (this->outFile.is_open()) {
+        this->outFile.close();
+    }
+}
+
+void InputRecorder::RecordStartGame(int worldIdx, int levelIdx) {
+    this->StartRecord(InputRecorder::StartGameRecord) << " " << worldIdx << " " << levelIdx << "\n";
+}
+
+void InputRecorder::RecordResetLevel() {
+    this->StartRecord(InputRecorder::ResetLevelRecord) << "\n";
+}
+
+void InputRecorder::RecordTick(double dT) {
+    this->StartRecord(InputRecorder::TickRecord) << " " << dT << "\n";
+}
+
+void InputRecorder::RecordMovePaddle(size_t frameID, int dir, float magnitudePercent) {
+    this->StartRecord(InputRecorder::MovePaddleRecord) << " " << frameID << " " << dir << " " << magnitudePercent << "\n";
+}
+
+void InputRecorder::RecordMoveOther(size_t frameID, int dir, float magnitudePercent) {
+    this->StartRecord(InputRecorder::MoveOtherRecord) << " " << frameID << " " << dir << " " << magnitudePercent << "\n";
+}
+
+void InputRecorder::RecordShootRelease() {
+    this->StartRecord(InputRecorder::ShootReleaseRecord) << "\n";
+}
+
+void InputRecorder::RecordShootContinuous(double dT, float magnitudePercent) {
+    this->StartRecord(InputRecorder::ShootContinuousRecord) << " " << dT << " " << magnitudePercent << "\n";
+}
+
+void InputRecorder::RecordBoostPressed(float x, float y, bool allowLargeChangeInDirection) {
+    this->StartRecord(InputRecorder::BoostPressedRecord) << " " << x << " " << y << " " 
+        << (allowLargeChangeInDirection ? 1 : 0) << "\n";
+}
+
+void InputRecorder::RecordBoostReleased() {
+    this->StartRecord(InputRecorder::BoostReleasedRecord) << "\n";
+}
+
+void InputRecorder::RecordAllowLaunch(bool allow) {
+    this->StartRecord(InputRecorder::AllowLaunchRecord) << " " << (allow ? 1 : 0) << "\n";
+}
+
+void InputRecorder::RecordPauseState(int pauseBitField) {
+    this->StartRecord(InputRecorder::PauseStateRecord) << " " << pauseBitField << "\n";
+}
+
+void InputRecorder::RecordDifficulty(int difficulty) {
+    this->StartRecord(InputRecorder::DifficultyRecord) << " " << difficulty << "\n";
+}
+
+void InputRecorder::RecordBoostMode(int ballBoostMode) {
+    this->StartRecord(InputRecorder::BoostModeRecord) << " " << ballBoostMode << "\n";
+}
+
+void InputRecorder::RecordInvertBoost(bool isInverted) {
+    this->StartRecord(InputRecorder::InvertBoostRecord) << " " << (isInverted ? 1 : 0) << "\n";
+}
+
+void InputRecorder::RecordResult(long score, int numLives, int numBalls, float paddleX, float paddleY) {
+    this->StartRecord(InputRecorder::ResultRecord) << " " << score << " " << numLives << " " << numBalls << " " 
+        << paddleX << " " << paddleY << "\n";
+}
+
+std::ostream& InputRecorder::StartRecord(const RecordType& type) {
+    assert(this->outFile.is_open());
+    this->numRecords++;
+    return this->outFile << InputRecorder::RECORD_TYPE_NAMES[type];
+}
@@ -0,0 +1,112 @@
+/**
+ * InputRecorder.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __INPUTRECORDER_H__
+#define __INPUTRECORDER_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+/**
+ * Records every call that drives the game model from outside of it (controller input, pausing,
+ * starting and restarting levels, settings changes) along with the time step of every tick of the
+ * model, in the order that they happen. The random seed and the simulation clock are both reset when
+ * a recording begins, so a recording is all that's needed to drive a fresh game model through exactly
+ * the same session again (see the HeadlessModelRunner's -replay option).
+ *
+ * Recordings are plain text with one record per line, the first two lines are always the session header:
+ *  session <seed> <difficulty> <boost mode> <boost inverted> <pause> - State of the model when recording began
+ *  unlockeditems <count> <item name>... - Items unlocked in the blammopedia when recording began (this decides
+ *                                        which items levels can drop)
+ *  start <world> <level>               - StartGameAtWorldAndLevel
+ *  resetlevel                          - ResetCurrentLevel
+ *  tick <dT>                           - Tick, followed by UpdateState
+ *  move <frame> <dir> <magnitude>      - MovePaddle
+ *  moveother <frame> <dir> <magnitude> - MoveOther
+ *  shoot                               - ShootActionReleaseUse
+ *  shootcontinuous <dT> <magnitude>    - ShootActionContinuousUse
+ *  boost <x> <y> <allow large change>  - BallBoostDirectionPressed
+ *  boostrelease                        - BallBoostDirectionReleased
+ *  allowlaunch <0|1>                   - ToggleAllowPaddleBallLaunching
+ *  pause <pause bit field>             - The pause state was changed from outside of the model
+ *  difficulty <difficulty>             - SetDifficulty
+ *  boostmode <mode>                    - SetBallBoostMode
+ *  invertboost <0|1>                   - SetInvertBallBoostDir
+ *  result <score> <lives> <balls> <paddle x> <paddle y> - Last line, state of the model when recording ended,
+ *                                        used to check that a replay ended up in exactly the same place
+ * Floating point values are written with enough precision that they are read back exactly.
+ */
+class InputRecorder {
+public:
+    enum RecordType { SessionRecord, UnlockedItemsRecord, StartGameRecord, ResetLevelRecord, TickRecord, MovePaddleRecord, 
+                      MoveOtherRecord, ShootReleaseRecord, ShootContinuousRecord, BoostPressedRecord, 
+                      BoostReleasedRecord, AllowLaunchRecord, PauseStateRecord, DifficultyRecord, 
+                      BoostModeRecord, InvertBoostRecord, ResultRecord, NumRecordTypes };
+
+    static const char* RecordTypeToString(const RecordType& type);
+    static bool StringToRecordType(const std::string& str, RecordType& type);
+
+    InputRecorder() : numRecords(0) {}
+    ~InputRecorder();
+
+    bool Begin(const std::string& filepath, unsigned long seed, int difficulty, int ballBoostMode, 
+        bool ballBoostIsInverted, int pauseBitField, const std::vector<std::string>& unlockedItemNames);
+    void End();
+
+    size_t GetNumRecords() const { return this->numRecords; }
+
+    void RecordStartGame(int worldIdx, int levelIdx);
+    void RecordResetLevel();
+    void RecordTick(double dT);
+    void RecordMovePaddle(size_t frameID, int dir, float magnitudePercent);
+    void RecordMoveOther(size_t frameID, int dir, float magnitudePercent);
+    void RecordShootRelease();
+    void RecordShootContinuous(double dT, float magnitudePercent);
+    void RecordBoostPressed(float x, float y, bool allowLargeChangeInDirection);
+    void RecordBoostReleased();
+    void RecordAllowLaunch(bool allow);
+    void RecordPauseState(int pauseBitField);
+    void RecordDifficulty(int difficulty);
+    void RecordBoostMode(int ballBoostMode);
+    void RecordInvertBoost(bool isInverted);
+    void RecordResult(long score, int numLives, int numBalls, float paddleX, float paddleY);
+
+private:
+    static const char* RECORD_TYPE_NAMES[NumRecordTypes];
+
+    std::ofstream outFile;
+    size_t numRecords;
+
+    std::ostream& StartRecord(const RecordType& type);
+
+    DISALLOW_COPY_AND_ASSIGN(InputRecorder);
+};
+
+#endif // __INPUTRECORDER_H__
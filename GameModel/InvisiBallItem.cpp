@@ -33,6 +33,8 @@
 #include "GameModel.h"
 #include "GameItemTimer.h"
 
+DEFINE_POOLED_ALLOCATION(InvisiBallItem, 4)
+
 const double InvisiBallItem::INVISI_BALL_TIMER_IN_SECS	= 20.0;
 const char* InvisiBallItem::INVISI_BALL_ITEM_NAME		= "InvisiBall";
 
@@ -61,7 +63,7 @@ double InvisiBallItem::Activate() {
         GameItemTimer* currTimer = removeTimers[i];
         currTimer->SetDeactivateItemOnStop(false);
         activeTimers.remove(currTimer);
-        delete currTimer;
+        GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
         currTimer = NULL;
 	}
 
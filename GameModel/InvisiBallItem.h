@@ -41,6 +41,8 @@ class Point2D;
 
 class InvisiBallItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* INVISI_BALL_ITEM_NAME;
 	static const double INVISI_BALL_TIMER_IN_SECS;
 
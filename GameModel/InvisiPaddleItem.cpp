@@ -32,6 +32,8 @@
 #include "InvisiPaddleItem.h"
 #include "GameModel.h"
 
+DEFINE_POOLED_ALLOCATION(InvisiPaddleItem, 4)
+
 const char* InvisiPaddleItem::INVISI_PADDLE_ITEM_NAME       = "InvisiPaddle";
 const double InvisiPaddleItem::INVISI_PADDLE_TIMER_IN_SECS  = 20.0;
 
@@ -60,7 +62,7 @@ double InvisiPaddleItem::Activate() {
         GameItemTimer* currTimer = removeTimers[i];
         currTimer->SetDeactivateItemOnStop(false);
         activeTimers.remove(currTimer);
-        delete currTimer;
+        GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
         currTimer = NULL;
 	}
 
@@ -40,6 +40,8 @@
  */
 class InvisiPaddleItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char*  INVISI_PADDLE_ITEM_NAME;
 	static const double INVISI_PADDLE_TIMER_IN_SECS;
 
@@ -33,6 +33,8 @@
 #include "PaddleLaserBeam.h"
 #include "GameItemFactory.h"
 #include "EmptySpaceBlock.h"
+#include "GameEventManager.h"
+#include "SimulationClock.h"
 
 // Amount of damage the block will take before dropping an item while being hit by a beam
 const float ItemDropBlock::DAMAGE_UNTIL_ITEM_DROP = 150.0f;
@@ -121,7 +123,7 @@ LevelPiece* ItemDropBlock::Destroy(GameModel* gameModel, const LevelPiece::Destr
 
     // Obliterate all that is left of this block...
     LevelPiece* tempThis = this;
-    delete tempThis;
+    GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
     tempThis = NULL;
 
     return emptyPiece;
@@ -332,7 +334,7 @@ void ItemDropBlock::ChangeToNextItemDropType(bool doEvent) {
     }
 	this->SetNextItemDropTypeIndex(randomIdx);
 	
-    this->timeOfLastDrop = BlammoTime::GetSystemTimeInMillisecs();
+    this->timeOfLastDrop = SimulationClock::GetTimeInMillisecs();
 
 	if (doEvent) {
 		// EVENT: Item drop type changed
@@ -342,7 +344,7 @@ void ItemDropBlock::ChangeToNextItemDropType(bool doEvent) {
 
 void ItemDropBlock::AttemptToDropAnItem(GameModel* gameModel) {
     // Drop an item if the item drop timer allows it...
-    if ((BlammoTime::GetSystemTimeInMillisecs() - this->timeOfLastDrop) >= ItemDropBlock::DISABLE_DROP_TIME) {
+    if ((SimulationClock::GetTimeInMillisecs() - this->timeOfLastDrop) >= ItemDropBlock::DISABLE_DROP_TIME) {
         gameModel->AddItemDrop(this->GetCenter(), this->GetNextItemDropType());
         this->ChangeToNextItemDropType(true);
     }
@@ -33,6 +33,8 @@
 #include "GameModel.h"
 #include "PaddleLaserBeam.h"
 
+DEFINE_POOLED_ALLOCATION(LaserBeamPaddleItem, 4)
+
 const double LaserBeamPaddleItem::LASER_BEAM_PADDLE_TIMER_IN_SECS	= 0.0; // The laser beam is not a timed power-up, it's activated when shot
 const char* LaserBeamPaddleItem::LASER_BEAM_PADDLE_ITEM_NAME      = "LaserBeamPaddle";
 
@@ -54,7 +56,7 @@ double LaserBeamPaddleItem::Activate() {
 	for (std::list<GameItemTimer*>::iterator iter = activeTimers.begin(); iter != activeTimers.end();) {
 		GameItemTimer* currTimer = *iter;
 		if (currTimer->GetTimerItemType() == GameItem::LaserBeamPaddleItem) {
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 			iter = activeTimers.erase(iter);
 		}
@@ -38,6 +38,8 @@
 
 class LaserBeamPaddleItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* LASER_BEAM_PADDLE_ITEM_NAME;
 	static const double LASER_BEAM_PADDLE_TIMER_IN_SECS;
 
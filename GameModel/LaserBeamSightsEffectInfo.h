@@ -41,6 +41,9 @@ public:
     ~LaserBeamSightsEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::LaserBeamSightsInfo; }
+    BossEffectEventInfo* Clone() const {
+        return new LaserBeamSightsEffectInfo(this->firingPt, this->targetPt, this->durationInSecs);
+    }
 
     const Point2D& GetFiringPoint() const { return this->firingPt; }
     const Point2D& GetTargetPoint() const { return this->targetPt; }
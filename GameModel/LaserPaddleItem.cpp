@@ -34,6 +34,8 @@
 #include "GameModel.h"
 #include "GameItemTimer.h"
 
+DEFINE_POOLED_ALLOCATION(LaserPaddleItem, 4)
+
 const double LaserPaddleItem::LASER_PADDLE_TIMER_IN_SECS = 15.0;
 const char* LaserPaddleItem::LASER_PADDLE_ITEM_NAME      = "LaserBulletPaddle";
 
@@ -63,7 +65,7 @@ double LaserPaddleItem::Activate() {
 	for (int i = 0; i < static_cast<int>(removeTimers.size()); i++) {
 	    GameItemTimer* currTimer = removeTimers[i];
 	    activeTimers.remove(currTimer);
-	    delete currTimer;
+	    GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 	    currTimer = NULL;
 	}
 
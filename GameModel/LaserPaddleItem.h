@@ -45,6 +45,8 @@ class Point2D;
  */
 class LaserPaddleItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* LASER_PADDLE_ITEM_NAME;
 	static const double LASER_PADDLE_TIMER_IN_SECS;
 
@@ -32,6 +32,8 @@
 #include "LaserTurretProjectile.h"
 #include "LaserTurretBlock.h"
 
+DEFINE_POOLED_ALLOCATION(LaserTurretProjectile, 64)
+
 const float LaserTurretProjectile::WIDTH_DEFAULT	= 0.3f;                                         // Width of a laser projectile in game units 
 const float LaserTurretProjectile::HEIGHT_DEFAULT	= 2.1f * LaserTurretProjectile::WIDTH_DEFAULT;  // Height of a laser projectile in game units
 
@@ -36,6 +36,8 @@
 
 class LaserTurretProjectile : public LaserBulletProjectile {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const float HEIGHT_DEFAULT;
 	static const float WIDTH_DEFAULT;
 
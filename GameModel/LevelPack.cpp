@@ -0,0 +1,1263 @@
+/**
+ * LevelPack.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "LevelPack.h"
+#include "GameLevel.h"
+#include "GameItemFactory.h"
+#include "BreakableBlock.h"
+#include "TriangleBlocks.h"
+#include "OneWayBlock.h"
+
+#include "../BlammoEngine/StringHelper.h"
+#include "../ResourceManager.h"
+
+const char* LevelPack::FILE_EXTENSION        = ".lvlpack";
+const unsigned int LevelPack::FILE_MAGIC     = 0x504C4242; // "BBLP" when read as little-endian bytes
+const unsigned int LevelPack::FILE_VERSION   = 3;
+
+/**
+ * Reads the header and level listing of a world file, this is the same format that
+ * GameWorld::Load has always read: the style, the name, the world image and then one level per line
+ * (optionally followed by ': <stars required to unlock>'), lines starting with '#' are comments.
+ */
+bool CompiledWorld::ReadFromText(std::istream& inFile, const std::string& worldFilepath, CompiledWorld& world) {
+    world.worldFilepath = worldFilepath;
+    world.styleName.clear();
+    world.name.clear();
+    world.imageFilepath.clear();
+    world.levelFilepaths.clear();
+    world.levelUnlockStarAmts.clear();
+
+	// Figure out the world style
+	while (world.styleName.empty()) {
+		if (!std::getline(inFile, world.styleName)) {
+			debug_output("ERROR: Could not find world style in world file: " << worldFilepath);
+			return false;		
+		}
+		world.styleName = stringhelper::trim(world.styleName);
+	}
+
+	// Read the name of the world
+	while (world.name.empty()) {
+		if (!std::getline(inFile, world.name)) {
+			debug_output("ERROR: Could not find world name in world file: " << worldFilepath);
+			return false;		
+		}
+		world.name = stringhelper::trim(world.name);
+	}
+
+    // Read the image file path for the world
+	while (world.imageFilepath.empty()) {
+		if (!std::getline(inFile, world.imageFilepath)) {
+			debug_output("ERROR: Could not find world image filepath in world file: " << worldFilepath);
+			return false;		
+		}
+		world.imageFilepath = stringhelper::trim(world.imageFilepath);
+	}
+
+	// Read all the level file names
+	std::string currLineStr;
+    while (std::getline(inFile, currLineStr)) {
+        currLineStr = stringhelper::trim(currLineStr);
+        if (currLineStr.empty() || currLineStr[0] == '#') {
+            continue;
+        }
+
+        // Check to see if the level has a milestone star amount associated with it
+        std::vector<std::string> tokens;
+        stringhelper::Tokenize(currLineStr, tokens, ":");
+        
+        int numStarsRequiredForUnlock = 0;
+        std::string levelFilepathStr = currLineStr;
+        if (tokens.size() > 1) {
+            // There's a milestone star amount...
+            std::stringstream numStarsStrStream(stringhelper::trim(tokens.back()));
+            if (!(numStarsStrStream >> numStarsRequiredForUnlock)) {
+                debug_output("ERROR: Failed to read the number of milestone stars for level: " + levelFilepathStr + " in world " + worldFilepath);
+                return false;
+            }
+
+            levelFilepathStr = stringhelper::trim(tokens.front());
+            if (levelFilepathStr.empty()) {
+                debug_output("ERROR: Failed to read file: " + levelFilepathStr + " from line " + currLineStr + " in world " + worldFilepath);
+                return false;
+            }
+        }
+
+        world.levelFilepaths.push_back(levelFilepathStr);
+        world.levelUnlockStarAmts.push_back(numStarsRequiredForUnlock);
+	}
+
+	if (world.levelFilepaths.empty()) {
+		debug_output("ERROR: There must be at least one level defined in world file: " << worldFilepath);
+		return false;			
+	}
+
+    return true;
+}
+
+/**
+ * Reads the level file format (see GameLevel::CreateGameLevelFromFile): an optional boss keyword, the level name,
+ * the width and height, the grid of pieces, the star milestones, the item drop list and the optional
+ * paddle starting position.
+ */
+bool CompiledLevel::ReadFromText(std::istream& inFile, const std::string& levelFilepath, CompiledLevel& level) {
+    level = CompiledLevel();
+    level.levelFilepath = levelFilepath;
+    level.paddleStartXPos = GameLevel::DEFAULT_PADDLE_START_IDX;
+
+    // Attempt to read in the boss keyword (it may or may not be there, if it isn't then the
+    // level is not a boss level by default).
+    std::string bossKeyword("");
+    while (bossKeyword.empty()) {
+		if (!std::getline(inFile, bossKeyword)) {
+			debug_output("ERROR: Error reading the start of the level file: " << levelFilepath);
+			return false;
+		}
+		bossKeyword = stringhelper::trim(bossKeyword);
+	}
+    if (bossKeyword.compare(GameLevel::BOSS_LEVEL_KEYWORD) == 0) {
+        level.hasBoss = true;
+
+	    // Read in the level name
+	    while (level.levelName.empty()) {
+		    if (!std::getline(inFile, level.levelName)) {
+			    debug_output("ERROR: Error reading in level name for file: " << levelFilepath);
+			    return false;
+		    }
+		    level.levelName = stringhelper::trim(level.levelName);
+	    }
+    }
+    else {
+        // Not the boss keyword... that means that the there is no boss keyword and instead we
+        // have just read in the level name
+        level.levelName = bossKeyword;
+    }
+
+	// Read in the file width and height
+	if (!(inFile >> level.width && inFile >> level.height)) {
+		debug_output("ERROR: Error reading in width/height for file: " << levelFilepath);
+		return false;
+	}
+	if (level.width <= 0 || level.height <= 0) {
+		debug_output("ERROR: Invalid width/height values for file: " << levelFilepath);
+		return false;	
+	}
+
+    // Read in the cells that make up the level
+    unsigned int numCells = static_cast<unsigned int>(level.width * level.height);
+    level.cells.resize(numCells);
+    for (unsigned int cellIdx = 0; cellIdx < numCells; cellIdx++) {
+        if (!CompiledLevel::ReadCell(inFile, level, level.cells[cellIdx])) {
+            debug_output("ERROR: Could not properly read level interior value at width = " << 
+                (cellIdx % level.width) << ", height = " << (cellIdx / level.width) << " in file: " << levelFilepath);
+            return false;
+        }
+    }
+    // Every portal must have a sibling...
+    std::set<char> portalNames;
+    for (std::vector<Cell>::const_iterator iter = level.cells.begin(); iter != level.cells.end(); ++iter) {
+        if (iter->pieceType == GameLevel::PORTAL_BLOCK_CHAR) {
+            portalNames.insert(iter->name);
+        }
+    }
+    for (std::vector<Cell>::const_iterator iter = level.cells.begin(); iter != level.cells.end(); ++iter) {
+        if (iter->pieceType == GameLevel::PORTAL_BLOCK_CHAR && portalNames.find(iter->siblingName) == portalNames.end()) {
+            debug_output("ERROR: Poorly formatted portal blocks.");
+            return false;
+        }
+    }
+
+    // Get the star milestone totals
+    std::string tempReadStr;
+    if (!(inFile >> tempReadStr) || tempReadStr.compare(GameLevel::STAR_POINT_MILESTONE_KEYWORD) != 0) {
+        debug_output("ERROR: No '" << GameLevel::STAR_POINT_MILESTONE_KEYWORD << "' keyword was found.");
+        return false;
+    }
+    level.starAwardScores.resize(GameLevel::MAX_STARS_PER_LEVEL, 0);
+    for (int i = 0; i < GameLevel::MAX_STARS_PER_LEVEL; i++) {
+        if (!(inFile >> level.starAwardScores[i])) {
+            debug_output("ERROR: No star point milestone for star #" << i << " was found.");
+            return false;
+        }
+    }
+
+	// Read in the allowed item drops and their probabilities...
+	std::string itemTypeName;
+	while (inFile >> itemTypeName) {
+        if (itemTypeName.compare(GameLevel::PADDLE_STARTING_X_POS_KEYWORD) == 0) {
+            // Get the x-coordinate where the paddle starts the level (and goes to when the ball dies)
+            if (!(inFile >> level.paddleStartXPos)) {
+                debug_output("ERROR: No paddle starting block index value was provided with keyword!");
+                return false;
+            }
+            break;
+        }
+
+		// There are some special keywords that are no longer supported...
+		if (itemTypeName.compare(GameLevel::ALL_ITEM_TYPES_KEYWORD) == 0 ||
+            itemTypeName.compare(GameLevel::POWERUP_ITEM_TYPES_KEYWORD) == 0 ||
+            itemTypeName.compare(GameLevel::POWERNEUTRAL_ITEM_TYPES_KEYWORD) == 0 ||
+            itemTypeName.compare(GameLevel::POWERDOWN_ITEM_TYPES_KEYWORD) == 0) {
+
+			assert(false);
+            debug_output("ERROR: Item collection keywords no longer supported");
+            return false;
+		}
+
+        ItemDropEntry dropEntry;
+        dropEntry.probabilityNum = 0;
+
+        // If the name is preceded by the ITEM_AVAILABLE_ONLY_IF_UNLOCKED_CHAR then the item is only 
+        // included in the level if it's unlocked
+        dropEntry.onlyIfUnlocked = false;
+        if (itemTypeName.size() == 1 && itemTypeName[0] == GameLevel::ITEM_AVAILABLE_ONLY_IF_UNLOCKED_CHAR) {
+            dropEntry.onlyIfUnlocked = true;
+            if (!(inFile >> itemTypeName)) {
+                return false;
+            }
+        }
+
+		if (!GameItemFactory::GetInstance()->IsValidItemTypeName(itemTypeName)) {
+			debug_output("ERROR: Invalid item type name found in allowable item drop probability list: '" << itemTypeName << "'");
+			return false;
+		}
+        dropEntry.itemTypeName = itemTypeName;
+
+		if (!(inFile >> dropEntry.probabilityNum)) {
+			debug_output("ERROR: Poorly formated item drop probability list - missing probability number.");
+			return false;
+		}
+		if (dropEntry.probabilityNum < 0) {
+			debug_output("ERROR: Poorly formated item drop probability number - must be >= 0.");
+			return false;
+		}
+
+        level.itemDrops.push_back(dropEntry);
+	}
+
+    return true;
+}
+
+/**
+ * Reads a single cell of the level's piece grid: the piece type character, its parameters (if the type of
+ * piece has any) and a trailing trigger ID (e.g., "A(1,0,a,b){3}"). The parameters are validated and stored in the cell.
+ */
+bool CompiledLevel::ReadCell(std::istream& inFile, CompiledLevel& level, Cell& cell) {
+    if (!(inFile >> cell.pieceType)) {
+        return false;
+    }
+
+    char tempChar = 0;
+    // The piece type characters aren't compile-time constants outside of GameLevel.cpp, so no switch here
+    if (cell.pieceType == GameLevel::EMPTY_SPACE_CHAR ||
+        cell.pieceType == GameLevel::SOLID_BLOCK_CHAR ||
+        cell.pieceType == GameLevel::GREEN_BREAKABLE_CHAR ||
+        cell.pieceType == GameLevel::YELLOW_BREAKABLE_CHAR ||
+        cell.pieceType == GameLevel::ORANGE_BREAKABLE_CHAR ||
+        cell.pieceType == GameLevel::RED_BREAKABLE_CHAR ||
+        cell.pieceType == GameLevel::BOMB_CHAR ||
+        cell.pieceType == GameLevel::INKBLOCK_CHAR ||
+        cell.pieceType == GameLevel::PRISM_BLOCK_CHAR ||
+        cell.pieceType == GameLevel::COLLATERAL_BLOCK_CHAR ||
+        cell.pieceType == GameLevel::NO_ENTRY_BLOCK_CHAR ||
+        cell.pieceType == GameLevel::LASER_TURRET_BLOCK_CHAR ||
+        cell.pieceType == GameLevel::ROCKET_TURRET_BLOCK_CHAR ||
+        cell.pieceType == GameLevel::MINE_TURRET_BLOCK_CHAR) {
+        // No parameters for these pieces
+    }
+    else if (cell.pieceType == GameLevel::CANNON_BLOCK_CHAR) {
+        // C1(d[-e]) - One-shot cannon block
+        // C(d[-e])  - Cannon block
+        // d: The direction to always fire the cannon block in, any degree angle in [0,720] starting by firing directly
+        //    upwards and moving clockwise, or -1 to fire in a random direction.
+        // [-e]: is optional - it allows the specification of a angle range from d to e, inclusive.
+        inFile >> tempChar;
+        if (tempChar == GameLevel::ONE_SHOT_CANNON_BLOCK_QUALIFIER_CHAR) {
+            cell.flags |= CompiledLevel::ONE_SHOT_FLAG;
+            inFile >> tempChar;
+        }
+        if (tempChar != '(') {
+            debug_output("ERROR: poorly formed cannon block syntax, missing the beginning '('");
+            return false;
+        }
+
+        int& rotationValue1 = cell.values[0];
+        int& rotationValue2 = cell.values[1];
+        inFile >> rotationValue1;
+        if (rotationValue1 != -1 && (rotationValue1 < 0 || rotationValue1 > 720)) {
+            debug_output("ERROR: poorly formed cannon block syntax, first degree angle must either be -1 or in [0,720]");
+            return false;
+        }
+
+        inFile >> tempChar;
+        if (rotationValue1 == -1) {
+            rotationValue1 = 0;
+            rotationValue2 = 359;
+        }
+        else if (tempChar == '-') {
+            inFile >> rotationValue2;
+            if (rotationValue2 != -1 && (rotationValue2 < 0 || rotationValue2 > 720)) {
+                debug_output("ERROR: poorly formed cannon block syntax, second degree angle must either be -1 or in [0,720]");
+                return false;
+            }
+            inFile >> tempChar;
+        }
+        else {
+            rotationValue2 = rotationValue1;
+        }
+
+        if (tempChar != ')') {
+            debug_output("ERROR: poorly formed cannon block syntax, missing the closing ')'");
+            return false;
+        }
+    }
+    else if (cell.pieceType == GameLevel::TESLA_BLOCK_CHAR) {
+        // A([1|0], [1|0], a, b) - Tesla Block (When active with another tesla block, forms an arc of lightning between the two)
+        // [1|0]: A '1' or a '0' to indicated whether it starts on (1) or off (0).
+        // [1|0]: A '1' or a '0' to indicated whether it can be turned on/off (1) or is unchangable (0).
+        // a : The single character name of this tesla block.
+        // b : One or more other named tesla blocks seperated by commas.
+        inFile >> tempChar;
+        if (tempChar != '(') {
+            debug_output("ERROR: poorly formed tesla block syntax, missing the beginning '('");
+            return false;
+        }
+
+        inFile >> tempChar;
+        if (tempChar != '1' && tempChar != '0') {
+            debug_output("ERROR: poorly formed tesla block syntax, missing the [1|0] to indicate whether the block starts on or off");
+            return false;
+        }
+        if (tempChar == '1') {
+            cell.flags |= CompiledLevel::STARTS_ON_FLAG;
+        }
+        inFile >> tempChar;
+        if (tempChar != ',') {
+            debug_output("ERROR: poorly formed tesla block syntax, missing ',' after the on/off option.");
+            return false;
+        }
+
+        inFile >> tempChar;
+        if (tempChar != '1' && tempChar != '0') {
+            debug_output("ERROR: poorly formed tesla block syntax, missing the [1|0] to indicate whether the block is changable or not");
+            return false;
+        }
+        if (tempChar == '1') {
+            cell.flags |= CompiledLevel::IS_CHANGABLE_FLAG;
+        }
+        inFile >> tempChar;
+        if (tempChar != ',') {
+            debug_output("ERROR: poorly formed tesla block syntax, missing ',' after the changable option.");
+            return false;
+        }
+
+        inFile >> cell.name;
+        if ((cell.name < 'A' && cell.name > 'z') || (cell.name < '0' && cell.name > '9')) {
+            debug_output("ERROR: tesla block name must be a character A-Z, a-z or 0-9");
+            return false;
+        }
+        inFile >> tempChar;
+        if (tempChar != ',') {
+            debug_output("ERROR: poorly formed tesla block syntax, missing ',' after the name.");
+            return false;
+        }
+
+        // Read in all the names of the brother tesla blocks that this one can fire lightning to
+        cell.listStart = static_cast<unsigned int>(level.teslaConnections.size());
+        for (;;) {
+            if (!(inFile >> tempChar)) {
+                debug_output("ERROR: poorly formed tesla block syntax, failed to read connecting tesla block list.");
+                return false;
+            }
+            if (tempChar < 'A' || tempChar > 'z') {
+                debug_output("ERROR: poorly formed tesla block syntax, invalid tesla block name in connecting tesla block list.");
+                return false;
+            }
+            level.teslaConnections.push_back(tempChar);
+
+            inFile >> tempChar;
+            if (tempChar == ')') {
+                break;
+            }
+            if (tempChar != ',') {
+                debug_output("ERROR: poorly formed tesla block syntax, invalid connecting tesla block list formatting.");
+                return false;
+            }
+        }
+        cell.listCount = static_cast<unsigned int>(level.teslaConnections.size()) - cell.listStart;
+    }
+    else if (cell.pieceType == GameLevel::PORTAL_BLOCK_CHAR) {
+        // X(a,b[,f]) - Portal block:
+        // a: A single character name for this portal block
+        // b: The single character name of the sibling portal block that this portal block is
+        // the entrance and exit for.
+        // f: Optional, the paddle is flipped when it enters the portal.
+        inFile >> tempChar;
+        if (tempChar != '(') {
+            debug_output("ERROR: poorly formed portal block syntax, missing '('");
+            return false;
+        }
+        inFile >> cell.name;
+        inFile >> tempChar;
+        if (tempChar != ',') {
+            debug_output("ERROR: poorly formed portal block syntax, missing ','");
+            return false;
+        }
+        inFile >> cell.siblingName;
+
+        inFile >> tempChar;
+        if (tempChar == ',') {
+            inFile >> tempChar;
+            if (tempChar != 'f') {
+                debug_output("ERROR: Portal block only allows 'f' option, currently.");
+                return false;
+            }
+            cell.flags |= CompiledLevel::FLIPS_PADDLE_FLAG;
+            inFile >> tempChar;
+        }
+        if (tempChar != ')') {
+            debug_output("ERROR: poorly formed portal block syntax, missing ')'");
+            return false;
+        }
+    }
+    else if (cell.pieceType == GameLevel::TRIANGLE_BLOCK_CHAR) {
+        // T(x,p) - Triangle block, 
+        // x: type of block, can be any of the breakable blocks, solid or prism
+        // p: the orientation of the triangle (where the outer corner is located), can be any of the following: {ul, ur, ll, lr}
+        inFile >> tempChar;
+        if (tempChar != '(') {
+            debug_output("ERROR: poorly formed triangle block syntax, missing '('");
+            return false;
+        }
+
+        inFile >> cell.blockType;
+        if (!BreakableBlock::IsValidBreakablePieceType(cell.blockType) && 
+            cell.blockType != GameLevel::SOLID_BLOCK_CHAR && cell.blockType != GameLevel::PRISM_BLOCK_CHAR) {
+            debug_output("ERROR: Triangle block has invalid block type specified in descriptor: " << cell.blockType);
+            return false;
+        }
+        inFile >> tempChar;
+        if (tempChar != ',') {
+            debug_output("ERROR: poorly formed triangle block syntax, missing ','");
+            return false;
+        }
+
+        char orient1, orient2;
+        inFile >> orient1;
+        inFile >> orient2;
+
+        TriangleBlock::Orientation orientation = TriangleBlock::UpperRight;
+        if (orient1 == GameLevel::TRI_UPPER_CORNER) {
+            if (orient2 == GameLevel::TRI_LEFT_CORNER) {
+                orientation = TriangleBlock::UpperLeft;
+            }
+        }
+        else if (orient1 == GameLevel::TRI_LOWER_CORNER) {
+            if (orient2 == GameLevel::TRI_RIGHT_CORNER) {
+                orientation = TriangleBlock::LowerRight;
+            }
+            else if (orient2 == GameLevel::TRI_LEFT_CORNER) {
+                orientation = TriangleBlock::LowerLeft;
+            }
+        }
+        cell.values[0] = orientation;
+
+        inFile >> tempChar;
+        if (tempChar != ')') {
+            debug_output("ERROR: poorly formed triangle block syntax, missing ')'");
+            return false;
+        }
+    }
+    else if (cell.pieceType == GameLevel::ITEM_DROP_BLOCK_CHAR ||
+             cell.pieceType == GameLevel::ALWAYS_DROP_BLOCK_CHAR) {
+        // D(i0, i1, i2, ...) - Item drop block, K(i0, i1, i2, ...) - Always drop block:
+        // i0, i1, i2, ... : The names of all the item types that the block is allowed to drop
+        if (!CompiledLevel::ReadItemList(inFile, level, cell)) {
+            return false;
+        }
+    }
+    else if (cell.pieceType == GameLevel::SWITCH_BLOCK_CHAR) {
+        // W(a) - Switch block:
+        // a : The trigger ID of the block that gets triggered by the switch 
+        //     (switch is turned on when a ball/projectile hits it).
+        inFile >> tempChar;
+        if (tempChar != '(') {
+            debug_output("ERROR: poorly formed switch block syntax, missing '('");
+            return false;
+        }
+        cell.values[0] = LevelPiece::NO_TRIGGER_ID;
+        inFile >> cell.values[0];
+        if (cell.values[0] < 0) {
+            debug_output("ERROR: poorly formed switch block syntax, switch trigger ID was invalid.");
+            return false;
+        }
+        inFile >> tempChar;
+        if (tempChar != ')') {
+            debug_output("ERROR: poorly formed switch block syntax, missing ')'");
+            return false;
+        }
+    }
+    else if (cell.pieceType == GameLevel::ONE_WAY_BLOCK_CHAR) {
+        // F(a) - One-way block:
+        // a : The direction that the block allows the ball to travel through it, allowable options are:
+        //     {u, d, l, r} for up, down, left and right, respectively.
+        inFile >> tempChar;
+        if (tempChar != '(') {
+            debug_output("ERROR: poorly formed one-way block syntax, missing '('");
+            return false;
+        }
+        char oneWayChar = 0;
+        OneWayBlock::OneWayDir oneWayEnum;
+        inFile >> oneWayChar;
+        if (!OneWayBlock::ConvertCharToOneWayDir(oneWayChar, oneWayEnum)) {
+            debug_output("ERROR: illegal character found in one-way block syntax, character must be one of 'u', 'd', 'l' or 'r'.");
+            return false;
+        }
+        cell.values[0] = oneWayEnum;
+        inFile >> tempChar;
+        if (tempChar != ')') {
+            debug_output("ERROR: poorly formed one-way block syntax, missing ')'");
+            return false;
+        }
+    }
+    else if (cell.pieceType == GameLevel::REGEN_BLOCK_CHAR) {
+        // Q([f|i]) - Regen block
+        // [f|i] - 'f' means that the block has finite life, 'i' means that the block has infinite life
+        inFile >> tempChar;
+        if (tempChar != '(') {
+            debug_output("ERROR: poorly formed regen block syntax, missing '('");
+            return false;
+        }
+        inFile >> tempChar;
+        if (tempChar == GameLevel::INFINITE_LIFE_CHAR) {
+            cell.flags |= CompiledLevel::INFINITE_LIFE_FLAG;
+        }
+        else if (tempChar != GameLevel::FINITE_LIFE_CHAR) {
+            debug_output("ERROR: poorly formed regen block syntax '" << GameLevel::FINITE_LIFE_CHAR << "' or '" <<
+                GameLevel::INFINITE_LIFE_CHAR << "' must be used an no other characters.");
+            return false;
+        }
+        inFile >> tempChar;
+        if (tempChar != ')') {
+            debug_output("ERROR: poorly formed regen block syntax, missing ')'");
+            return false;
+        }
+    }
+    else if (cell.pieceType == GameLevel::WARP_PORTAL_CHAR) {
+        // V(s,e w,n) - Not a block, the cell is empty space with a warp portal to level n of world w that's
+        // open from s to e seconds into the level
+        inFile >> tempChar;
+        if (tempChar != '(') {
+            debug_output("ERROR: poorly formed warp portal syntax, missing '('");
+            return false;
+        }
+
+        double startTimeInSecs = 0;
+        double endTimeInSecs = -1;
+        if (!(inFile >> startTimeInSecs)) {
+            debug_output("ERROR: poorly formed warp portal syntax, missing/invalid start time.");
+            return false;
+        }
+        inFile >> tempChar;
+        if (tempChar != ',') {
+            debug_output("ERROR: poorly formed warp portal syntax, missing ','");
+            return false;
+        }
+        if (!(inFile >> endTimeInSecs)) {
+            debug_output("ERROR: poorly formed warp portal syntax, missing/invalid end time.");
+            return false;
+        }
+
+        WarpPortalEntry warpPortal;
+        warpPortal.startTimeInSecs = static_cast<float>(startTimeInSecs);
+        warpPortal.endTimeInSecs   = static_cast<float>(endTimeInSecs);
+        if (!(inFile >> warpPortal.worldName)) {
+            debug_output("ERROR: poorly formed warp portal syntax, missing warp world.");
+            return false;
+        }
+        warpPortal.worldStyle = GameWorld::GetWorldStyleFromString(warpPortal.worldName);
+        if (warpPortal.worldStyle == GameWorld::None) {
+            debug_output("ERROR: poorly formed warp portal syntax, invalid warp world type.");
+            return false;
+        }
+        inFile >> tempChar;
+        if (tempChar != ',') {
+            debug_output("ERROR: poorly formed warp portal syntax, missing ','");
+            return false;
+        }
+        if (!(inFile >> warpPortal.levelNum)) {
+            debug_output("ERROR: poorly formed warp portal syntax, missing warp level number.");
+            return false;
+        }
+        if (warpPortal.levelNum <= 0 || warpPortal.levelNum > 20) {
+            debug_output("ERROR: poorly formed warp portal syntax, invalid warp level number, must be in [1,20].");
+            return false;
+        }
+        inFile >> tempChar;
+        if (tempChar != ')') {
+            debug_output("ERROR: poorly formed warp portal syntax, missing ')'");
+            return false;
+        }
+
+        cell.listStart = static_cast<unsigned int>(level.warpPortals.size());
+        cell.listCount = 1;
+        level.warpPortals.push_back(warpPortal);
+    }
+    else {
+        debug_output("ERROR: Invalid level interior value: " << cell.pieceType);
+        return false;
+    }
+
+    // Check to see if there's a trigger ID directly after the cell: "{id}"
+    cell.triggerID = LevelPiece::NO_TRIGGER_ID;
+    if (inFile.peek() == '{') {
+        inFile.get();
+
+        std::string triggerIDStr;
+        int currChar = inFile.get();
+        while (currChar != EOF && currChar != '}') {
+            triggerIDStr.push_back(static_cast<char>(currChar));
+            currChar = inFile.get();
+        }
+        triggerIDStr = stringhelper::trim(triggerIDStr);
+        if (currChar != '}' || triggerIDStr.empty()) {
+            debug_output("ERROR: Invalid (empty) trigger ID found in level file.");
+            return false;
+        }
+
+        cell.triggerID = atoi(triggerIDStr.c_str());
+        if (cell.triggerID < 0) {
+            debug_output("ERROR: Invalid (< 0) trigger ID found in level file.");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Reads the item list of an item drop or always drop block: "(i0,i1,i2,...)" where each item type name may be
+ * preceded by ITEM_AVAILABLE_ONLY_IF_UNLOCKED_CHAR and followed by a likelihood number in [0,3]. Whether
+ * locked items are left out is decided when the level's pieces are built, not here.
+ */
+bool CompiledLevel::ReadItemList(std::istream& inFile, CompiledLevel& level, Cell& cell) {
+    char tempChar = 0;
+    inFile >> tempChar;
+    if (tempChar != '(') {
+        debug_output("ERROR: poorly formed item drop block syntax, missing '('");
+        return false;
+    }
+
+    std::string listStr;
+    int currChar = inFile.get();
+    while (currChar != EOF && currChar != ')') {
+        listStr.push_back(static_cast<char>(currChar));
+        currChar = inFile.get();
+    }
+    if (currChar != ')') {
+        debug_output("ERROR: poorly formed item drop block syntax, missing ')'");
+        return false;
+    }
+
+    std::vector<std::string> itemNames;
+    stringhelper::Tokenize(listStr, itemNames, ", \t\r\n");
+    if (itemNames.empty()) {
+        debug_output("ERROR: poorly formed item list syntax, no item types defined");
+        return false;
+    }
+
+    cell.listStart = static_cast<unsigned int>(level.itemLists.size());
+    bool onlyAvailableIfUnlocked = false;
+    for (size_t i = 0; i < itemNames.size(); i++) {
+        const std::string& currItemName = itemNames[i];
+
+        // There are some special keywords that are no longer supported...
+        if (currItemName.compare(GameLevel::ALL_ITEM_TYPES_KEYWORD) == 0 || 
+            currItemName.compare(GameLevel::POWERUP_ITEM_TYPES_KEYWORD) == 0 || 
+            currItemName.compare(GameLevel::POWERNEUTRAL_ITEM_TYPES_KEYWORD) == 0 ||
+            currItemName.compare(GameLevel::POWERDOWN_ITEM_TYPES_KEYWORD) == 0) {
+
+            assert(false);
+            debug_output("ERROR: Item collection keywords no longer supported!");
+            return false;
+        }
+
+        // A star signals that the next item should only drop if it has been unlocked...
+        if (currItemName.size() == 1 && currItemName[0] == GameLevel::ITEM_AVAILABLE_ONLY_IF_UNLOCKED_CHAR) {
+            onlyAvailableIfUnlocked = true;
+            continue;
+        }
+
+        if (!GameItemFactory::GetInstance()->IsValidItemTypeName(currItemName)) {
+            debug_output("ERROR: poorly formed item list syntax, no item drop type found for item \"" + currItemName + "\"");
+            return false;
+        }
+
+        ItemListEntry entry;
+        entry.itemTypeName   = currItemName;
+        entry.itemType       = GameItemFactory::GetInstance()->GetItemTypeFromName(currItemName);
+        entry.likelihood     = 1;
+        entry.onlyIfUnlocked = onlyAvailableIfUnlocked;
+
+        // Check to see if the next string is actually a likelihood number
+        if (i+1 < itemNames.size() && stringhelper::IsPositiveNumber(itemNames[i+1])) {
+            entry.likelihood = atoi(itemNames[i+1].c_str());
+            if (entry.likelihood > 3 || entry.likelihood < 0) {
+                debug_output("ERROR: Invalid likelihood number found");
+                return false;
+            }
+            i++;
+        }
+
+        level.itemLists.push_back(entry);
+        onlyAvailableIfUnlocked = false;
+    }
+
+    cell.listCount = static_cast<unsigned int>(level.itemLists.size()) - cell.listStart;
+    if (cell.listCount == 0) {
+        debug_output("ERROR: poorly formed item list syntax, no item types defined");
+        return false;
+    }
+    return true;
+}
+
+// Binary reading/writing helpers, all values are stored little-endian
+
+static void WriteUInt32(std::ostream& out, unsigned int value) {
+    char bytes[4];
+    bytes[0] = static_cast<char>(value & 0xFF);
+    bytes[1] = static_cast<char>((value >> 8) & 0xFF);
+    bytes[2] = static_cast<char>((value >> 16) & 0xFF);
+    bytes[3] = static_cast<char>((value >> 24) & 0xFF);
+    out.write(bytes, 4);
+}
+static void WriteInt32(std::ostream& out, int value) {
+    WriteUInt32(out, static_cast<unsigned int>(value));
+}
+static void WriteFloat(std::ostream& out, float value) {
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(bits));
+    WriteUInt32(out, bits);
+}
+static void WriteString(std::ostream& out, const std::string& str) {
+    WriteUInt32(out, static_cast<unsigned int>(str.size()));
+    out.write(str.data(), str.size());
+}
+
+static bool ReadUInt32(const char*& curr, const char* end, unsigned int& value) {
+    if (end - curr < 4) {
+        return false;
+    }
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(curr);
+    value = static_cast<unsigned int>(bytes[0]) | (static_cast<unsigned int>(bytes[1]) << 8) |
+        (static_cast<unsigned int>(bytes[2]) << 16) | (static_cast<unsigned int>(bytes[3]) << 24);
+    curr += 4;
+    return true;
+}
+static bool ReadInt32(const char*& curr, const char* end, int& value) {
+    unsigned int bits;
+    if (!ReadUInt32(curr, end, bits)) {
+        return false;
+    }
+    value = static_cast<int>(bits);
+    return true;
+}
+static bool ReadFloat(const char*& curr, const char* end, float& value) {
+    unsigned int bits;
+    if (!ReadUInt32(curr, end, bits)) {
+        return false;
+    }
+    memcpy(&value, &bits, sizeof(value));
+    return true;
+}
+static bool ReadString(const char*& curr, const char* end, std::string& str) {
+    unsigned int length;
+    if (!ReadUInt32(curr, end, length) || static_cast<unsigned int>(end - curr) < length) {
+        return false;
+    }
+    str.assign(curr, length);
+    curr += length;
+    return true;
+}
+
+// The number of bytes that each cell of a level's piece grid takes up in the file
+static const size_t NUM_CELL_BYTES = 5 + 5 * 4;
+// The fewest bytes that each entry in the file can take up (i.e., with empty strings and lists), any count
+// that couldn't fit in what's left of the file is treated as a corrupt file
+static const size_t MIN_NUM_WORLD_BYTES             = 28; // Four strings, the source size and hash and the level count
+static const size_t MIN_NUM_WORLD_LEVEL_BYTES       = 8;  // A level file path and its unlock star amount
+static const size_t MIN_NUM_LEVEL_BYTES             = 52 + NUM_CELL_BYTES; // Everything but the strings, lists and all but one cell
+static const size_t MIN_NUM_ITEM_LIST_ENTRY_BYTES   = 12;
+static const size_t MIN_NUM_WARP_PORTAL_BYTES       = 16;
+static const size_t MIN_NUM_STAR_BYTES              = 4;
+static const size_t MIN_NUM_ITEM_DROP_BYTES         = 12;
+
+// Whether the range of the given cell's table (if it has one) is inside of the table
+static bool IsCellListValid(const CompiledLevel& level, const CompiledLevel::Cell& cell) {
+    size_t tableSize = 0;
+    if (cell.pieceType == GameLevel::TESLA_BLOCK_CHAR) {
+        tableSize = level.teslaConnections.size();
+    }
+    else if (cell.pieceType == GameLevel::ITEM_DROP_BLOCK_CHAR || cell.pieceType == GameLevel::ALWAYS_DROP_BLOCK_CHAR) {
+        tableSize = level.itemLists.size();
+    }
+    else if (cell.pieceType == GameLevel::WARP_PORTAL_CHAR) {
+        tableSize = level.warpPortals.size();
+    }
+    else {
+        return true;
+    }
+    return cell.listCount > 0 && cell.listCount <= tableSize && cell.listStart <= tableSize - cell.listCount;
+}
+
+/**
+ * Loads the level pack at the given resource path with a single read of the file.
+ * Returns: The loaded pack on success, NULL if the file doesn't exist or isn't a valid pack.
+ */
+LevelPack* LevelPack::LoadFromResource(const std::string& filepath) {
+    long length = 0;
+    char* buffer = ResourceManager::GetInstance()->FilepathToMemoryBuffer(filepath, length);
+    if (buffer == NULL) {
+        return NULL;
+    }
+
+    LevelPack* pack = new LevelPack();
+    bool success = pack->ReadFromMemory(buffer, static_cast<size_t>(length));
+    delete[] buffer;
+    buffer = NULL;
+
+    if (!success) {
+        debug_output("ERROR: Invalid level pack file: " << filepath);
+        delete pack;
+        return NULL;
+    }
+    return pack;
+}
+
+/**
+ * Parses every world listed in the given world definition file, along with all of their levels,
+ * from their text files into a new level pack.
+ * Returns: The compiled pack on success, NULL if any of the files failed to parse.
+ */
+LevelPack* LevelPack::CompileFromText(const std::string& worldDefinitionFilepath, const std::string& worldDir) {
+    std::istringstream* defFile = ResourceManager::GetInstance()->FilepathToInStream(worldDefinitionFilepath);
+    if (defFile == NULL) {
+        return NULL;
+    }
+
+    LevelPack* pack = new LevelPack();
+    bool success = true;
+
+    std::string currWorldPath;
+    while (success && std::getline(*defFile, currWorldPath)) {
+        currWorldPath = stringhelper::trim(currWorldPath);
+        if (currWorldPath.empty()) {
+            continue;
+        }
+        currWorldPath = worldDir + std::string("/") + currWorldPath;
+
+        std::istringstream* worldFile = ResourceManager::GetInstance()->FilepathToInStream(currWorldPath);
+        if (worldFile == NULL) {
+            success = false;
+            break;
+        }
+        CompiledWorld world;
+        success = CompiledWorld::ReadFromText(*worldFile, currWorldPath, world);
+        const std::string worldText = worldFile->str();
+        world.sourceFileSize = static_cast<unsigned int>(worldText.size());
+        world.sourceFileHash = LevelPack::HashSourceFile(worldText.data(), worldText.size());
+        delete worldFile;
+        worldFile = NULL;
+        if (!success) {
+            break;
+        }
+        pack->AddWorld(world);
+
+        for (size_t i = 0; i < world.levelFilepaths.size() && success; i++) {
+            std::istringstream* levelFile = ResourceManager::GetInstance()->FilepathToInStream(world.levelFilepaths[i]);
+            if (levelFile == NULL) {
+                success = false;
+                break;
+            }
+            CompiledLevel level;
+            success = CompiledLevel::ReadFromText(*levelFile, world.levelFilepaths[i], level);
+            const std::string levelText = levelFile->str();
+            level.sourceFileSize = static_cast<unsigned int>(levelText.size());
+            level.sourceFileHash = LevelPack::HashSourceFile(levelText.data(), levelText.size());
+            delete levelFile;
+            levelFile = NULL;
+            if (success) {
+                pack->AddLevel(level);
+            }
+            else {
+                debug_output("ERROR: Failed to compile level file: " << world.levelFilepaths[i]);
+            }
+        }
+    }
+
+    delete defFile;
+    defFile = NULL;
+
+    if (!success) {
+        delete pack;
+        return NULL;
+    }
+    return pack;
+}
+
+/**
+ * Reads the binary level pack format:
+ * magic, version, world count, level count, then each world followed by each level.
+ */
+bool LevelPack::ReadFromMemory(const char* buffer, size_t length) {
+    this->worlds.clear();
+    this->levels.clear();
+    this->worldIndices.clear();
+    this->levelIndices.clear();
+
+    const char* curr = buffer;
+    const char* end  = buffer + length;
+
+    unsigned int magic, version, numWorlds, numLevels;
+    if (!ReadUInt32(curr, end, magic) || magic != LevelPack::FILE_MAGIC ||
+        !ReadUInt32(curr, end, version) || version != LevelPack::FILE_VERSION ||
+        !ReadUInt32(curr, end, numWorlds) || !ReadUInt32(curr, end, numLevels) ||
+        numWorlds > length / MIN_NUM_WORLD_BYTES || numLevels > length / MIN_NUM_LEVEL_BYTES) {
+        return false;
+    }
+
+    for (unsigned int i = 0; i < numWorlds; i++) {
+        CompiledWorld world;
+        unsigned int numWorldLevels;
+        if (!ReadString(curr, end, world.worldFilepath) || !ReadUInt32(curr, end, world.sourceFileSize) ||
+            !ReadUInt32(curr, end, world.sourceFileHash) || !ReadString(curr, end, world.styleName) ||
+            !ReadString(curr, end, world.name) || !ReadString(curr, end, world.imageFilepath) ||
+            !ReadUInt32(curr, end, numWorldLevels) || 
+            numWorldLevels > static_cast<size_t>(end - curr) / MIN_NUM_WORLD_LEVEL_BYTES) {
+            return false;
+        }
+
+        world.levelFilepaths.resize(numWorldLevels);
+        world.levelUnlockStarAmts.resize(numWorldLevels);
+        for (unsigned int j = 0; j < numWorldLevels; j++) {
+            if (!ReadString(curr, end, world.levelFilepaths[j]) || !ReadInt32(curr, end, world.levelUnlockStarAmts[j])) {
+                return false;
+            }
+        }
+        this->AddWorld(world);
+    }
+
+    for (unsigned int i = 0; i < numLevels; i++) {
+        CompiledLevel level;
+        unsigned int hasBoss, numItemListEntries, numWarpPortals, numStars, numItemDrops;
+
+        if (!ReadString(curr, end, level.levelFilepath) || !ReadUInt32(curr, end, level.sourceFileSize) ||
+            !ReadUInt32(curr, end, level.sourceFileHash) || !ReadString(curr, end, level.levelName) ||
+            !ReadUInt32(curr, end, hasBoss) || !ReadInt32(curr, end, level.width) || !ReadInt32(curr, end, level.height) ||
+            level.width <= 0 || level.height <= 0) {
+            return false;
+        }
+        level.hasBoss = (hasBoss != 0);
+
+        // Piece grid, every cell takes up the same number of bytes (the division keeps width * height from overflowing)
+        if (static_cast<size_t>(end - curr) / NUM_CELL_BYTES / static_cast<size_t>(level.height) < static_cast<size_t>(level.width)) {
+            return false;
+        }
+        size_t numCells = static_cast<size_t>(level.width) * static_cast<size_t>(level.height);
+        level.cells.resize(numCells);
+        for (size_t j = 0; j < numCells; j++) {
+            CompiledLevel::Cell& cell = level.cells[j];
+            cell.pieceType   = *curr++;
+            cell.blockType   = *curr++;
+            cell.name        = *curr++;
+            cell.siblingName = *curr++;
+            cell.flags       = static_cast<unsigned char>(*curr++);
+            if (!ReadInt32(curr, end, cell.values[0]) || !ReadInt32(curr, end, cell.values[1]) ||
+                !ReadUInt32(curr, end, cell.listStart) || !ReadUInt32(curr, end, cell.listCount) ||
+                !ReadInt32(curr, end, cell.triggerID)) {
+                return false;
+            }
+        }
+
+        // Tables that the cells index into
+        if (!ReadString(curr, end, level.teslaConnections) || !ReadUInt32(curr, end, numItemListEntries) ||
+            static_cast<size_t>(end - curr) / MIN_NUM_ITEM_LIST_ENTRY_BYTES < numItemListEntries) {
+            return false;
+        }
+        level.itemLists.resize(numItemListEntries);
+        for (unsigned int j = 0; j < numItemListEntries; j++) {
+            CompiledLevel::ItemListEntry& entry = level.itemLists[j];
+            unsigned int onlyIfUnlocked;
+            if (!ReadString(curr, end, entry.itemTypeName) || !ReadInt32(curr, end, entry.likelihood) ||
+                !ReadUInt32(curr, end, onlyIfUnlocked) || !GameItemFactory::GetInstance()->IsValidItemTypeName(entry.itemTypeName)) {
+                return false;
+            }
+            entry.itemType = GameItemFactory::GetInstance()->GetItemTypeFromName(entry.itemTypeName);
+            entry.onlyIfUnlocked = (onlyIfUnlocked != 0);
+        }
+        if (!ReadUInt32(curr, end, numWarpPortals) || 
+            static_cast<size_t>(end - curr) / MIN_NUM_WARP_PORTAL_BYTES < numWarpPortals) {
+            return false;
+        }
+        level.warpPortals.resize(numWarpPortals);
+        for (unsigned int j = 0; j < numWarpPortals; j++) {
+            CompiledLevel::WarpPortalEntry& warpPortal = level.warpPortals[j];
+            if (!ReadFloat(curr, end, warpPortal.startTimeInSecs) || !ReadFloat(curr, end, warpPortal.endTimeInSecs) ||
+                !ReadString(curr, end, warpPortal.worldName) || !ReadInt32(curr, end, warpPortal.levelNum)) {
+                return false;
+            }
+            warpPortal.worldStyle = GameWorld::GetWorldStyleFromString(warpPortal.worldName);
+            if (warpPortal.worldStyle == GameWorld::None) {
+                return false;
+            }
+        }
+        for (size_t j = 0; j < numCells; j++) {
+            if (!IsCellListValid(level, level.cells[j])) {
+                return false;
+            }
+        }
+
+        // Star milestones, item drops and the paddle start position
+        if (!ReadUInt32(curr, end, numStars) || numStars > static_cast<size_t>(end - curr) / MIN_NUM_STAR_BYTES) {
+            return false;
+        }
+        level.starAwardScores.resize(numStars);
+        for (unsigned int j = 0; j < numStars; j++) {
+            int score;
+            if (!ReadInt32(curr, end, score)) {
+                return false;
+            }
+            level.starAwardScores[j] = score;
+        }
+        if (!ReadUInt32(curr, end, numItemDrops) || numItemDrops > static_cast<size_t>(end - curr) / MIN_NUM_ITEM_DROP_BYTES) {
+            return false;
+        }
+        level.itemDrops.resize(numItemDrops);
+        for (unsigned int j = 0; j < numItemDrops; j++) {
+            unsigned int onlyIfUnlocked;
+            if (!ReadString(curr, end, level.itemDrops[j].itemTypeName) || !ReadInt32(curr, end, level.itemDrops[j].probabilityNum) ||
+                !ReadUInt32(curr, end, onlyIfUnlocked)) {
+                return false;
+            }
+            level.itemDrops[j].onlyIfUnlocked = (onlyIfUnlocked != 0);
+        }
+        if (!ReadFloat(curr, end, level.paddleStartXPos)) {
+            return false;
+        }
+
+        this->AddLevel(level);
+    }
+
+    return (curr == end);
+}
+
+bool LevelPack::WriteToFile(const std::string& filepath) const {
+    std::ofstream outFile(filepath.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!outFile.is_open()) {
+        debug_output("ERROR: Could not open level pack file for writing: " << filepath);
+        return false;
+    }
+
+    WriteUInt32(outFile, LevelPack::FILE_MAGIC);
+    WriteUInt32(outFile, LevelPack::FILE_VERSION);
+    WriteUInt32(outFile, static_cast<unsigned int>(this->worlds.size()));
+    WriteUInt32(outFile, static_cast<unsigned int>(this->levels.size()));
+
+    for (std::vector<CompiledWorld>::const_iterator iter = this->worlds.begin(); iter != this->worlds.end(); ++iter) {
+        const CompiledWorld& world = *iter;
+        WriteString(outFile, world.worldFilepath);
+        WriteUInt32(outFile, world.sourceFileSize);
+        WriteUInt32(outFile, world.sourceFileHash);
+        WriteString(outFile, world.styleName);
+        WriteString(outFile, world.name);
+        WriteString(outFile, world.imageFilepath);
+        WriteUInt32(outFile, static_cast<unsigned int>(world.levelFilepaths.size()));
+        for (size_t i = 0; i < world.levelFilepaths.size(); i++) {
+            WriteString(outFile, world.levelFilepaths[i]);
+            WriteInt32(outFile, world.levelUnlockStarAmts[i]);
+        }
+    }
+
+    for (std::vector<CompiledLevel>::const_iterator iter = this->levels.begin(); iter != this->levels.end(); ++iter) {
+        const CompiledLevel& level = *iter;
+        WriteString(outFile, level.levelFilepath);
+        WriteUInt32(outFile, level.sourceFileSize);
+        WriteUInt32(outFile, level.sourceFileHash);
+        WriteString(outFile, level.levelName);
+        WriteUInt32(outFile, level.hasBoss ? 1 : 0);
+        WriteInt32(outFile, level.width);
+        WriteInt32(outFile, level.height);
+
+        for (std::vector<CompiledLevel::Cell>::const_iterator cellIter = level.cells.begin(); cellIter != level.cells.end(); ++cellIter) {
+            const CompiledLevel::Cell& cell = *cellIter;
+            outFile.put(cell.pieceType);
+            outFile.put(cell.blockType);
+            outFile.put(cell.name);
+            outFile.put(cell.siblingName);
+            outFile.put(static_cast<char>(cell.flags));
+            WriteInt32(outFile, cell.values[0]);
+            WriteInt32(outFile, cell.values[1]);
+            WriteUInt32(outFile, cell.listStart);
+            WriteUInt32(outFile, cell.listCount);
+            WriteInt32(outFile, cell.triggerID);
+        }
+
+        WriteString(outFile, level.teslaConnections);
+        WriteUInt32(outFile, static_cast<unsigned int>(level.itemLists.size()));
+        for (size_t i = 0; i < level.itemLists.size(); i++) {
+            WriteString(outFile, level.itemLists[i].itemTypeName);
+            WriteInt32(outFile, level.itemLists[i].likelihood);
+            WriteUInt32(outFile, level.itemLists[i].onlyIfUnlocked ? 1 : 0);
+        }
+        WriteUInt32(outFile, static_cast<unsigned int>(level.warpPortals.size()));
+        for (size_t i = 0; i < level.warpPortals.size(); i++) {
+            WriteFloat(outFile, level.warpPortals[i].startTimeInSecs);
+            WriteFloat(outFile, level.warpPortals[i].endTimeInSecs);
+            WriteString(outFile, level.warpPortals[i].worldName);
+            WriteInt32(outFile, level.warpPortals[i].levelNum);
+        }
+
+        WriteUInt32(outFile, static_cast<unsigned int>(level.starAwardScores.size()));
+        for (size_t i = 0; i < level.starAwardScores.size(); i++) {
+            WriteInt32(outFile, static_cast<int>(level.starAwardScores[i]));
+        }
+        WriteUInt32(outFile, static_cast<unsigned int>(level.itemDrops.size()));
+        for (size_t i = 0; i < level.itemDrops.size(); i++) {
+            WriteString(outFile, level.itemDrops[i].itemTypeName);
+            WriteInt32(outFile, level.itemDrops[i].probabilityNum);
+            WriteUInt32(outFile, level.itemDrops[i].onlyIfUnlocked ? 1 : 0);
+        }
+        WriteFloat(outFile, level.paddleStartXPos);
+    }
+
+    bool success = outFile.good();
+    outFile.close();
+    return success;
+}
+
+const CompiledWorld* LevelPack::GetWorld(const std::string& worldFilepath) const {
+    std::map<std::string, size_t>::const_iterator findIter = this->worldIndices.find(worldFilepath);
+    if (findIter == this->worldIndices.end()) {
+        return NULL;
+    }
+    return &this->worlds[findIter->second];
+}
+
+const CompiledLevel* LevelPack::GetLevel(const std::string& levelFilepath) const {
+    std::map<std::string, size_t>::const_iterator findIter = this->levelIndices.find(levelFilepath);
+    if (findIter == this->levelIndices.end()) {
+        return NULL;
+    }
+    return &this->levels[findIter->second];
+}
+
+/**
+ * Same as GetWorld/GetLevel, except that a world or level whose text file is overridden in the modifications
+ * directory (debug only) or has changed since the pack was built is treated as if it weren't in the pack.
+ */
+const CompiledWorld* LevelPack::GetCurrentWorld(const std::string& worldFilepath) const {
+    const CompiledWorld* world = this->GetWorld(worldFilepath);
+    if (world == NULL || !LevelPack::IsSourceFileCurrent(worldFilepath, world->sourceFileSize, world->sourceFileHash)) {
+        return NULL;
+    }
+    return world;
+}
+
+const CompiledLevel* LevelPack::GetCurrentLevel(const std::string& levelFilepath) const {
+    const CompiledLevel* level = this->GetLevel(levelFilepath);
+    if (level == NULL || !LevelPack::IsSourceFileCurrent(levelFilepath, level->sourceFileSize, level->sourceFileHash)) {
+        return NULL;
+    }
+    return level;
+}
+
+// FNV-1a hash of a world or level file's bytes
+unsigned int LevelPack::HashSourceFile(const char* buffer, size_t length) {
+    unsigned int hash = 2166136261U;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= static_cast<unsigned char>(buffer[i]);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/**
+ * Whether the text file that a world or level was compiled from is the same as when the pack was built. The size
+ * of the file is always checked, only debug builds (where the levels get edited) read the whole file to check its hash.
+ */
+bool LevelPack::IsSourceFileCurrent(const std::string& filepath, unsigned int sourceFileSize, unsigned int sourceFileHash) {
+    if (ResourceManager::IsFilepathOverriddenByMod(filepath)) {
+        return false;
+    }
+
+    PHYSFS_File* fileHandle = PHYSFS_openRead(filepath.c_str());
+    if (fileHandle == NULL) {
+        return false;
+    }
+    PHYSFS_sint64 fileLength = PHYSFS_fileLength(fileHandle);
+    PHYSFS_close(fileHandle);
+    fileHandle = NULL;
+
+    bool isCurrent = (fileLength == static_cast<PHYSFS_sint64>(sourceFileSize));
+#ifdef _DEBUG
+    if (isCurrent) {
+        long length = 0;
+        char* buffer = ResourceManager::ReadFileToMemoryBuffer(filepath, length);
+        isCurrent = (buffer != NULL && LevelPack::HashSourceFile(buffer, static_cast<size_t>(length)) == sourceFileHash);
+        delete[] buffer;
+        buffer = NULL;
+    }
+#else
+    UNUSED_PARAMETER(sourceFileHash);
+#endif
+
+    if (!isCurrent) {
+        debug_output("Level pack is out of date for " << filepath << ", loading its text file instead");
+    }
+    return isCurrent;
+}
+
+void LevelPack::AddWorld(const CompiledWorld& world) {
+    std::pair<std::map<std::string, size_t>::iterator, bool> insertResult = 
+        this->worldIndices.insert(std::make_pair(world.worldFilepath, this->worlds.size()));
+    if (insertResult.second) {
+        this->worlds.push_back(world);
+    }
+}
+
+void LevelPack::AddLevel(const CompiledLevel& level) {
+    std::pair<std::map<std::string, size_t>::iterator, bool> insertResult = 
+        this->levelIndices.insert(std::make_pair(level.levelFilepath, this->levels.size()));
+    if (insertResult.second) {
+        this->levels.push_back(level);
+    }
+}
@@ -0,0 +1,178 @@
+/**
+ * LevelPack.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LEVELPACK_H__
+#define __LEVELPACK_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+/**
+ * The parsed contents of a .wld world file.
+ */
+struct CompiledWorld {
+    std::string worldFilepath;
+    std::string styleName;
+    std::string name;
+    std::string imageFilepath;
+    std::vector<std::string> levelFilepaths;
+    std::vector<int> levelUnlockStarAmts;
+    unsigned int sourceFileSize;    // Size and hash of the .wld file the world was compiled from
+    unsigned int sourceFileHash;
+
+    CompiledWorld() : sourceFileSize(0), sourceFileHash(0) {}
+
+    static bool ReadFromText(std::istream& inFile, const std::string& worldFilepath, CompiledWorld& world);
+};
+
+/**
+ * The parsed contents of a .lvl level file. Every cell of the piece grid is parsed and validated when the
+ * level is compiled so that GameLevel can build the level's pieces straight from the cells each time the
+ * level is (re)started. Tesla block connections, item lists and warp portals are kept in tables that
+ * the cells index into.
+ */
+struct CompiledLevel {
+    // Flags for Cell::flags
+    static const unsigned char ONE_SHOT_FLAG      = 0x01; // Cannon blocks: the cannon is a one-shot cannon
+    static const unsigned char STARTS_ON_FLAG     = 0x02; // Tesla blocks: the block starts on
+    static const unsigned char IS_CHANGABLE_FLAG  = 0x04; // Tesla blocks: the block can be turned on/off
+    static const unsigned char FLIPS_PADDLE_FLAG  = 0x08; // Portal blocks: the paddle is flipped when it enters
+    static const unsigned char INFINITE_LIFE_FLAG = 0x10; // Regen blocks: the block has infinite life
+
+    // A single cell of the piece grid, which of the parameters are used depends on the type of piece
+    struct Cell {
+        char pieceType;
+        char blockType;         // Triangle blocks: the type of block the triangle is made of
+        char name;              // Portal and tesla blocks: the single character name of the block
+        char siblingName;       // Portal blocks: the name of the sibling portal block
+        unsigned char flags;    // Some combination of the *_FLAG values
+        int values[2];          // Cannon blocks: the firing angle range, switch blocks: the trigger ID that gets switched,
+                                // one-way blocks: the OneWayBlock::OneWayDir, triangle blocks: the TriangleBlock::Orientation
+        unsigned int listStart; // Tesla blocks: the connected names in teslaConnections, item drop and always drop blocks: 
+        unsigned int listCount; // the entries in itemLists, warp portals: the entry in warpPortals
+        int triggerID;          // LevelPiece::NO_TRIGGER_ID if the cell doesn't have a trigger ID
+
+        Cell() : pieceType(0), blockType(0), name(0), siblingName(0), flags(0), listStart(0), listCount(0), triggerID(-1) {
+            values[0] = values[1] = 0;
+        }
+    };
+    struct ItemListEntry {
+        std::string itemTypeName;
+        int itemType;           // The GameItem::ItemType for the name
+        int likelihood;
+        bool onlyIfUnlocked;
+    };
+    struct WarpPortalEntry {
+        float startTimeInSecs;
+        float endTimeInSecs;
+        std::string worldName;
+        int worldStyle;         // The GameWorld::WorldStyle for the name
+        int levelNum;
+    };
+    struct ItemDropEntry {
+        std::string itemTypeName;
+        int probabilityNum;
+        bool onlyIfUnlocked;
+    };
+
+    std::string levelFilepath;
+    std::string levelName;
+    unsigned int sourceFileSize;    // Size and hash of the .lvl file the level was compiled from
+    unsigned int sourceFileHash;
+    bool hasBoss;
+    int width;
+    int height;
+
+    // Cells are in file order: row major, starting at the top row of the level
+    std::vector<Cell> cells;
+    std::string teslaConnections;
+    std::vector<ItemListEntry> itemLists;
+    std::vector<WarpPortalEntry> warpPortals;
+
+    std::vector<long> starAwardScores;
+    std::vector<ItemDropEntry> itemDrops;
+    float paddleStartXPos;
+
+    CompiledLevel() : sourceFileSize(0), sourceFileHash(0), hasBoss(false), width(0), height(0), paddleStartXPos(0.0f) {}
+
+    static bool ReadFromText(std::istream& inFile, const std::string& levelFilepath, CompiledLevel& level);
+
+private:
+    static bool ReadCell(std::istream& inFile, CompiledLevel& level, Cell& cell);
+    static bool ReadItemList(std::istream& inFile, CompiledLevel& level, Cell& cell);
+};
+
+/**
+ * A versioned binary file holding the compiled form of every world and level in the game. It's built
+ * offline from the .wld and .lvl text files (see the HeadlessModelRunner's -compilelevels option) and
+ * is loaded with a single read, after which worlds and levels are looked up by their file paths. Any
+ * world or level missing from the pack is loaded from its text file instead, as is any world or level
+ * whose text file has changed since the pack was built (see GetCurrentWorld and GetCurrentLevel).
+ */
+class LevelPack {
+public:
+    static const char* FILE_EXTENSION;
+    static const unsigned int FILE_MAGIC;
+    static const unsigned int FILE_VERSION;
+
+    LevelPack() {}
+    ~LevelPack() {}
+
+    static LevelPack* LoadFromResource(const std::string& filepath);
+    static LevelPack* CompileFromText(const std::string& worldDefinitionFilepath, const std::string& worldDir);
+    static unsigned int HashSourceFile(const char* buffer, size_t length);
+
+    bool ReadFromMemory(const char* buffer, size_t length);
+    bool WriteToFile(const std::string& filepath) const;
+
+    const CompiledWorld* GetWorld(const std::string& worldFilepath) const;
+    const CompiledLevel* GetLevel(const std::string& levelFilepath) const;
+    const CompiledWorld* GetCurrentWorld(const std::string& worldFilepath) const;
+    const CompiledLevel* GetCurrentLevel(const std::string& levelFilepath) const;
+
+    size_t GetNumWorlds() const { return this->worlds.size(); }
+    size_t GetNumLevels() const { return this->levels.size(); }
+
+private:
+    std::vector<CompiledWorld> worlds;
+    std::vector<CompiledLevel> levels;
+
+    std::map<std::string, size_t> worldIndices;
+    std::map<std::string, size_t> levelIndices;
+
+    void AddWorld(const CompiledWorld& world);
+    void AddLevel(const CompiledLevel& level);
+
+    static bool IsSourceFileCurrent(const std::string& filepath, unsigned int sourceFileSize, unsigned int sourceFileHash);
+
+    DISALLOW_COPY_AND_ASSIGN(LevelPack);
+};
+
+#endif // __LEVELPACK_H__
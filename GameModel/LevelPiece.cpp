@@ -62,6 +62,10 @@ triggerID(LevelPiece::NO_TRIGGER_ID) {
 }
 
 LevelPiece::~LevelPiece() {
+    this->PrepareForDeletion();
+}
+
+void LevelPiece::PrepareForDeletion() {
 	// We need to be sure to obliterate any status effects that might be lingering on the level piece -
 	// this emits an important event to any model listeners to remove those effects as well!
 	this->RemoveAllStatus(NULL);
@@ -170,6 +170,11 @@ public:
     void DetachProjectile(MineProjectile* p);
     void DetachAllProjectiles();
 
+    // Lets go of everything the rest of the model has to do with this piece (its status effects and
+    // attached projectiles), done when the piece is destroyed or earlier when its deletion is put off
+    // (see GameEventManager::DeleteAfterDispatch). Safe to call more than once.
+    void PrepareForDeletion();
+
     virtual void DrawWireframe() const;
 
 	// Debug Stuffs
@@ -0,0 +1,112 @@
+/**
+ * LevelPieceCandidateBuffer.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LEVELPIECECANDIDATEBUFFER_H__
+#define __LEVELPIECECANDIDATEBUFFER_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+#include "../BlammoEngine/Point.h"
+
+#include "LevelPiece.h"
+
+/**
+ * Caller-owned, reusable storage for the results of level piece collision candidate queries
+ * (see GameLevel::GetLevelPieceCollisionCandidates). Clearing the buffer keeps its capacity, so
+ * holding onto one across ticks means that, once warmed up, collision lookups make no heap allocations.
+ * Since every cell of the level grid holds a unique piece the contents are always duplicate-free.
+ */
+class LevelPieceCandidateBuffer {
+public:
+    typedef std::vector<LevelPiece*>::const_iterator const_iterator;
+
+    static const size_t DEFAULT_CAPACITY = 32;
+
+    explicit LevelPieceCandidateBuffer(size_t initialCapacity = DEFAULT_CAPACITY) {
+        this->pieces.reserve(initialCapacity);
+        this->sortScratch.reserve(initialCapacity);
+    }
+    ~LevelPieceCandidateBuffer() {}
+
+    void Clear() { this->pieces.clear(); }
+    void Add(LevelPiece* piece) { assert(piece != NULL); this->pieces.push_back(piece); }
+
+    bool IsEmpty() const { return this->pieces.empty(); }
+    size_t GetSize() const { return this->pieces.size(); }
+    LevelPiece* operator[](size_t idx) const { return this->pieces[idx]; }
+    LevelPiece* GetFirst() const { assert(!this->pieces.empty()); return this->pieces.front(); }
+
+    const_iterator begin() const { return this->pieces.begin(); }
+    const_iterator end() const { return this->pieces.end(); }
+
+    bool Contains(const LevelPiece* piece) const;
+    void SortByDistanceTo(const Point2D& pt);
+
+private:
+    struct PieceAndSqrDist {
+        LevelPiece* piece;
+        float sqrDist;
+        PieceAndSqrDist(LevelPiece* piece, float sqrDist) : piece(piece), sqrDist(sqrDist) {}
+        bool operator<(const PieceAndSqrDist& other) const { return this->sqrDist < other.sqrDist; }
+    };
+
+    std::vector<LevelPiece*> pieces;
+    std::vector<PieceAndSqrDist> sortScratch; // Kept around so that sorting doesn't allocate
+
+    DISALLOW_COPY_AND_ASSIGN(LevelPieceCandidateBuffer);
+};
+
+/**
+ * Linear search for the given piece - candidate sets are small (a handful of grid cells)
+ * so this beats any kind of tree or hash lookup.
+ */
+inline bool LevelPieceCandidateBuffer::Contains(const LevelPiece* piece) const {
+    return std::find(this->pieces.begin(), this->pieces.end(), piece) != this->pieces.end();
+}
+
+/**
+ * Order the candidates from closest to furthest from the given point (distance to the 
+ * closest point on each piece's bounds).
+ */
+inline void LevelPieceCandidateBuffer::SortByDistanceTo(const Point2D& pt) {
+    this->sortScratch.clear();
+    for (std::vector<LevelPiece*>::const_iterator iter = this->pieces.begin(); iter != this->pieces.end(); ++iter) {
+        LevelPiece* currPiece = *iter;
+        this->sortScratch.push_back(PieceAndSqrDist(currPiece, Point2D::SqDistance(pt, currPiece->GetBounds().ClosestPoint(pt))));
+    }
+
+    std::sort(this->sortScratch.begin(), this->sortScratch.end());
+    
+    for (size_t i = 0; i < this->sortScratch.size(); i++) {
+        this->pieces[i] = this->sortScratch[i].piece;
+    }
+}
+
+#endif // __LEVELPIECECANDIDATEBUFFER_H__
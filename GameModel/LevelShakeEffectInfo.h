@@ -40,6 +40,9 @@ public:
       timeInSecs(timeInSecs), shakeVec(shakeVec), shakeSpd(shakeSpd) {}
 
     GeneralEffectEventInfo::Type GetType() const { return GeneralEffectEventInfo::LevelShake; }
+    GeneralEffectEventInfo* Clone() const {
+        return new LevelShakeEffectInfo(this->timeInSecs, this->shakeVec, this->shakeSpd);
+    }
 
     double GetTimeInSeconds() const { return this->timeInSecs; }
     const Vector3D& GetShakeVector() const { return this->shakeVec; }
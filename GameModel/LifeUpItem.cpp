@@ -31,6 +31,8 @@
 
 #include "LifeUpItem.h"
 
+DEFINE_POOLED_ALLOCATION(LifeUpItem, 4)
+
 const char* LifeUpItem::LIFE_UP_ITEM_NAME	    = "LifeUp";
 const double LifeUpItem::LIFE_UP_TIMER_IN_SECS	= 0.0;
 
@@ -40,6 +40,8 @@
  */
 class LifeUpItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char*  LIFE_UP_ITEM_NAME;
 	static const double LIFE_UP_TIMER_IN_SECS;
 
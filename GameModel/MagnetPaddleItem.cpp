@@ -32,6 +32,8 @@
 #include "MagnetPaddleItem.h"
 #include "GameModel.h"
 
+DEFINE_POOLED_ALLOCATION(MagnetPaddleItem, 4)
+
 const char* MagnetPaddleItem::MAGNET_PADDLE_ITEM_NAME       = "MagnetPaddle";
 const double MagnetPaddleItem::MAGNET_PADDLE_TIMER_IN_SECS  = 38.0;
 
@@ -60,7 +62,7 @@ double MagnetPaddleItem::Activate() {
         GameItemTimer* currTimer = removeTimers[i];
         currTimer->SetDeactivateItemOnStop(false);
         activeTimers.remove(currTimer);
-        delete currTimer;
+        GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
         currTimer = NULL;
 	}
 
@@ -39,6 +39,8 @@
 
 class MagnetPaddleItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* MAGNET_PADDLE_ITEM_NAME;
 	static const double MAGNET_PADDLE_TIMER_IN_SECS;
 
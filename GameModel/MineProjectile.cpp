@@ -314,7 +314,7 @@ bool MineProjectile::ModifyLevelUpdate(double dT, GameModel& model) {
         const GameModel::ProjectileMap& projectileMap = model.GetActiveProjectiles();
         for (GameModel::ProjectileMapConstIter mapIter = projectileMap.begin(); mapIter != projectileMap.end(); ++mapIter) {
             
-            const GameModel::ProjectileList& currProjectiles = mapIter->second;
+            const GameModel::ProjectileList& currProjectiles = *mapIter->second;
             for (GameModel::ProjectileListConstIter iter = currProjectiles.begin(); iter != currProjectiles.end(); ++iter) {
 
                 const Projectile* projectile = *iter;
@@ -57,6 +57,8 @@ public:
 	MineProjectile(const Point2D& spawnLoc, const Vector2D& velDir, float width, float height);
 	MineProjectile(const MineProjectile& copy);
     virtual ~MineProjectile();
+
+    void Teardown(GameModel&) { this->DetachFromAnyAttachedObject(); }
     
     void Land(const Point2D& landingPt);
 
@@ -31,6 +31,8 @@
 
 #include "MineTurretProjectile.h"
 
+DEFINE_POOLED_ALLOCATION(MineTurretProjectile, 16)
+
 const float MineTurretProjectile::TURRET_MINE_HEIGHT = 0.65f;
 const float MineTurretProjectile::TURRET_MINE_WIDTH  = 0.65f;
 
@@ -37,6 +37,8 @@
 class MineTurretProjectile : public MineProjectile {
 
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const float TURRET_MINE_HEIGHT;
 	static const float TURRET_MINE_WIDTH;
 
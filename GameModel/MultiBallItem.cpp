@@ -32,6 +32,8 @@
 #include "MultiBallItem.h"
 #include "GameModel.h"
 
+DEFINE_POOLED_ALLOCATION(MultiBallItem, 4)
+
 const char* MultiBallItem::MULTI3_BALL_ITEM_NAME	= "MultiBall3";
 const char* MultiBallItem::MULTI5_BALL_ITEM_NAME	= "MultiBall5";
 
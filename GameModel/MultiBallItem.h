@@ -40,6 +40,8 @@ class Point2D;
 
 class MultiBallItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	enum NumMultiBalls { ThreeMultiBalls = 3, FiveMultiBalls = 5 };
 	
 	static const char* MULTI3_BALL_ITEM_NAME;
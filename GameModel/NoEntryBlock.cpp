@@ -86,7 +86,7 @@ LevelPiece* NoEntryBlock::Destroy(GameModel* gameModel, const LevelPiece::Destru
 
 	// Obliterate all that is left of this block...
 	LevelPiece* tempThis = this;
-	delete tempThis;
+	GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
 	tempThis = NULL;
 
 	return emptyPiece;
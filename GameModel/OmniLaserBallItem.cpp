@@ -34,6 +34,8 @@
 #include "GameModel.h"
 #include "GameItemTimer.h"
 
+DEFINE_POOLED_ALLOCATION(OmniLaserBallItem, 4)
+
 const char* OmniLaserBallItem::OMNI_LASER_BALL_ITEM_NAME      = "OmniLaserBall";
 const double OmniLaserBallItem::OMNI_LASER_BALL_TIMER_IN_SECS = 16.0;
 
@@ -53,7 +55,7 @@ double OmniLaserBallItem::Activate() {
 		GameItemTimer* currTimer = *iter;
 		if (currTimer->GetTimerItemType() == GameItem::OmniLaserBallItem) {
             iter = activeTimers.erase(iter);
-            delete currTimer;
+            GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
             currTimer = NULL;
 		}
         else {
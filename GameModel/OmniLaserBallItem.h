@@ -45,6 +45,8 @@ class Point2D;
  */
 class OmniLaserBallItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* OMNI_LASER_BALL_ITEM_NAME;
 	static const double OMNI_LASER_BALL_TIMER_IN_SECS;
 
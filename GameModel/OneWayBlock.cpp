@@ -158,7 +158,7 @@ LevelPiece* OneWayBlock::Destroy(GameModel* gameModel, const LevelPiece::Destruc
 
 	// Obliterate all that is left of this block...
 	LevelPiece* tempThis = this;
-	delete tempThis;
+	GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
 	tempThis = NULL;
 
 	return emptyPiece;
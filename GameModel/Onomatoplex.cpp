@@ -870,7 +870,7 @@ std::string Generator::Generate(SoundType type, Extremeness amt) {
 }
 
 std::string Generator::GenerateVictoryDescriptor() const {
-    return this->victoryDescriptors[Randomizer::GetInstance()->RandomUnsignedInt() % this->victoryDescriptors.size()];
+    return this->victoryDescriptors[Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->victoryDescriptors.size()];
 }
 
 // Private helper functions -----------------------------------------------
@@ -923,7 +923,7 @@ bool Generator::IsVowel(const char c) {
  */
 std::string Generator::GenerateAbsurdPunctuation(SoundType type, Extremeness ex) {
 	unsigned int amount = static_cast<unsigned int>(abs(ex));
-	unsigned int randomAmt =  Randomizer::GetInstance()->RandomUnsignedInt() % (amount + 1);
+	unsigned int randomAmt =  Randomizer::GetPresentationInstance()->RandomUnsignedInt() % (amount + 1);
 
 	if (randomAmt > 3) {
 		randomAmt = 3;
@@ -942,7 +942,7 @@ std::string Generator::GenerateAbsurdPunctuation(SoundType type, Extremeness ex)
 
 		if (randomAmt > 1) {
 			for (unsigned int i = 0; i < randomAmt - 1; i++) {
-				size_t randomIndex =  Randomizer::GetInstance()->RandomUnsignedInt() % Generator::endPunctuation.size();
+				size_t randomIndex =  Randomizer::GetPresentationInstance()->RandomUnsignedInt() % Generator::endPunctuation.size();
 				punctuation = punctuation + Generator::endPunctuation[randomIndex];
 			}
 		}
@@ -951,7 +951,7 @@ std::string Generator::GenerateAbsurdPunctuation(SoundType type, Extremeness ex)
 	switch(type) {
 		case ELECTRIC:
 		case BOUNCE:
-			if (punctuation.size() > 1 && (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 1)) {
+			if (punctuation.size() > 1 && (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 1)) {
 				punctuation = Generator::DEFAULT_END_PUNCTUATION;
 			}
 			else {
@@ -970,7 +970,7 @@ std::string Generator::GenerateAbsurdPunctuation(SoundType type, Extremeness ex)
  * Returns: Weak/simple crazy word text.
  */
 std::string Generator::GenerateWeakSoundText(SoundType type) {
-	unsigned int randomIndex =  Randomizer::GetInstance()->RandomUnsignedInt() % this->simpleSingleWords[type].size();
+	unsigned int randomIndex =  Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->simpleSingleWords[type].size();
 	return this->simpleSingleWords[type][randomIndex];
 }
 
@@ -992,7 +992,7 @@ std::string Generator::GenerateNormalSoundText(SoundType type) {
  */
 std::string Generator::GeneratePrettyGoodSoundText(SoundType type) {
 	std::vector<std::string> &fullSimpleWords = this->goodSingleWords[type];
-	unsigned int randomIndex =  Randomizer::GetInstance()->RandomUnsignedInt() % fullSimpleWords.size();
+	unsigned int randomIndex =  Randomizer::GetPresentationInstance()->RandomUnsignedInt() % fullSimpleWords.size();
 	std::string result = fullSimpleWords[randomIndex];
 	return result + this->GenerateAbsurdPunctuation(type, PRETTY_GOOD);
 }
@@ -1005,7 +1005,7 @@ std::string Generator::GeneratePrettyGoodSoundText(SoundType type) {
 std::string Generator::GenerateGoodSoundText(SoundType type) {
 
 	std::vector<std::string> &fullSimpleWords = this->goodSingleWords[type];
-	unsigned int randomIndex =  Randomizer::GetInstance()->RandomUnsignedInt() % fullSimpleWords.size();
+	unsigned int randomIndex =  Randomizer::GetPresentationInstance()->RandomUnsignedInt() % fullSimpleWords.size();
 	std::string result = fullSimpleWords[randomIndex];
 	return result + this->GenerateAbsurdPunctuation(type, GOOD);
 }
@@ -1017,7 +1017,7 @@ std::string Generator::GenerateGoodSoundText(SoundType type) {
  */
 std::string Generator::GenerateAwesomeSoundText(SoundType type) {
 	std::vector<std::string> &fullSimpleWords = this->awesomeSingleWords[type];
-	unsigned int randomIndex =  Randomizer::GetInstance()->RandomUnsignedInt() % fullSimpleWords.size();
+	unsigned int randomIndex =  Randomizer::GetPresentationInstance()->RandomUnsignedInt() % fullSimpleWords.size();
 	std::string result = fullSimpleWords[randomIndex];
 	return result + this->GenerateAbsurdPunctuation(type, AWESOME);
 }
@@ -1029,7 +1029,7 @@ std::string Generator::GenerateAwesomeSoundText(SoundType type) {
  */
 std::string Generator::GenerateSuperAwesomeSoundText(SoundType type) {
 	std::vector<std::string> &fullSimpleWords = this->awesomeSingleWords[type];
-	unsigned int randomIndex =  Randomizer::GetInstance()->RandomUnsignedInt() % fullSimpleWords.size();
+	unsigned int randomIndex =  Randomizer::GetPresentationInstance()->RandomUnsignedInt() % fullSimpleWords.size();
 	std::string result = fullSimpleWords[randomIndex];
 	return result + this->GenerateAbsurdPunctuation(type, SUPER_AWESOME);
 }
@@ -1041,7 +1041,7 @@ std::string Generator::GenerateSuperAwesomeSoundText(SoundType type) {
  */
 std::string Generator::GenerateUberSoundText(SoundType type) {
 	std::vector<std::string> &fullSimpleWords = this->uberSingleWords[type];
-	unsigned int randomIndex =  Randomizer::GetInstance()->RandomUnsignedInt() % fullSimpleWords.size();
+	unsigned int randomIndex =  Randomizer::GetPresentationInstance()->RandomUnsignedInt() % fullSimpleWords.size();
 	std::string result = fullSimpleWords[randomIndex];
 	return result + this->GenerateAbsurdPunctuation(type, UBER);
 }
@@ -88,7 +88,7 @@ public:
 	 */
 	static inline Extremeness Generator::GetRandomExtremeness(Extremeness min, Extremeness max) {
 		assert(min < max);
-		return static_cast<Extremeness>(min + (Randomizer::GetInstance()->RandomUnsignedInt() % (max - min + 1)));
+		return static_cast<Extremeness>(min + (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % (max - min + 1)));
 	}
 
 private:
@@ -33,6 +33,8 @@
 #include "GameModel.h"
 #include "GameTransformMgr.h"
 
+DEFINE_POOLED_ALLOCATION(PaddleCamItem, 4)
+
 const char* PaddleCamItem::PADDLE_CAM_ITEM_NAME			  = "PaddleCam";
 const double PaddleCamItem::PADDLE_CAM_TIMER_IN_SECS	= 17.0;
 
@@ -53,7 +55,7 @@ double PaddleCamItem::Activate() {
 		GameItemTimer* currTimer = *iter;
 		if (currTimer->GetTimerItemType() == GameItem::PaddleCamItem || currTimer->GetTimerItemType() == GameItem::BallCamItem) {
 			iter = activeTimers.erase(iter);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 		}
 		else {
@@ -42,6 +42,8 @@
  */
 class PaddleCamItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* PADDLE_CAM_ITEM_NAME;
 	static const double PADDLE_CAM_TIMER_IN_SECS;
 
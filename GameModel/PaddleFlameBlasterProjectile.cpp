@@ -32,6 +32,8 @@
 #include "PaddleFlameBlasterProjectile.h"
 #include "LevelPiece.h"
 
+DEFINE_POOLED_ALLOCATION(PaddleFlameBlasterProjectile, 16)
+
 const float PaddleFlameBlasterProjectile::DEFAULT_VELOCITY_MAG = 8.0f;
 const float PaddleFlameBlasterProjectile::DEFAULT_SIZE         = 0.6f * LevelPiece::PIECE_WIDTH;
 
@@ -39,6 +39,8 @@ class CannonBlock;
 
 class PaddleFlameBlasterProjectile : public PaddleBlasterProjectile {
 public:
+    DECLARE_POOLED_ALLOCATION();
+
     static const float DEFAULT_SIZE;
     static const float DEFAULT_VELOCITY_MAG;
 
@@ -32,6 +32,8 @@
 #include "PaddleIceBlasterProjectile.h"
 #include "LevelPiece.h"
 
+DEFINE_POOLED_ALLOCATION(PaddleIceBlasterProjectile, 16)
+
 const float PaddleIceBlasterProjectile::DEFAULT_VELOCITY_MAG = 8.0f;
 const float PaddleIceBlasterProjectile::DEFAULT_SIZE         = 0.6f * LevelPiece::PIECE_WIDTH;
 
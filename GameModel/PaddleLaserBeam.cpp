@@ -50,11 +50,20 @@ Beam(PaddleLaserBeam::BASE_DAMAGE_PER_SECOND, PaddleLaserBeam::BEAM_EXPIRE_TIME_
 }
 
 PaddleLaserBeam::~PaddleLaserBeam() {
+    this->PrepareForDeletion();
+}
+
+void PaddleLaserBeam::PrepareForDeletion() {
+    if (this->paddle == NULL) {
+        return;
+    }
+
     StickyPaddleBeamDirGenerator::ReinitializeBeams();
 
 	// Remove the paddle laser beam...
 	this->paddle->RemovePaddleType(PlayerPaddle::LaserBeamPaddle);
 	this->paddle->SetIsLaserBeamFiring(false);
+    this->paddle = NULL;
 }
 
 /**
@@ -144,19 +153,19 @@ void PaddleLaserBeam::UpdateCollisions(const GameModel* gameModel) {
             rightOrigin = BEAM_ORIGIN - adjustBeamOriginAmt;
         }
 
-	    firstBeamSeg = new BeamSegment(Collision::Ray2D(BEAM_ORIGIN, centerVec), 
+	    firstBeamSeg = this->AcquireBeamSegment(Collision::Ray2D(BEAM_ORIGIN, centerVec), 
 	        centerSize * INITIAL_BEAM_RADIUS, centerSize * this->baseDamagePerSecond, NULL);
 
-        BeamSegment* refractSeg1 = new BeamSegment(Collision::Ray2D(leftOrigin, leftVec), 
+        BeamSegment* refractSeg1 = this->AcquireBeamSegment(Collision::Ray2D(leftOrigin, leftVec), 
 	        leftSize * INITIAL_BEAM_RADIUS, leftSize * this->baseDamagePerSecond, NULL);
 	    initialBeamSegs.push_back(refractSeg1);
 	    
-        BeamSegment* refractSeg2 = new BeamSegment(Collision::Ray2D(rightOrigin, rightVec), 
+        BeamSegment* refractSeg2 = this->AcquireBeamSegment(Collision::Ray2D(rightOrigin, rightVec), 
 	        rightSize * INITIAL_BEAM_RADIUS, rightSize * this->baseDamagePerSecond, NULL);
 	    initialBeamSegs.push_back(refractSeg2);
     }
     else {
-	    firstBeamSeg = new BeamSegment(Collision::Ray2D(BEAM_ORIGIN, BEAM_UNIT_DIR), INITIAL_BEAM_RADIUS, this->baseDamagePerSecond, NULL);
+	    firstBeamSeg = this->AcquireBeamSegment(Collision::Ray2D(BEAM_ORIGIN, BEAM_UNIT_DIR), INITIAL_BEAM_RADIUS, this->baseDamagePerSecond, NULL);
         StickyPaddleBeamDirGenerator::ReinitializeBeams();
     }
 
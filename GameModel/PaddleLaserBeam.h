@@ -41,6 +41,8 @@ public:
 
 	PaddleLaserBeam(PlayerPaddle* paddle, const GameModel* gameModel);
 	~PaddleLaserBeam();
+
+    void PrepareForDeletion();
 	
     bool Tick(double dT, const GameModel* gameModel);
     void TickAlpha();
@@ -60,7 +62,7 @@ public:
 private:
 	static const int BASE_DAMAGE_PER_SECOND;
 
-	PlayerPaddle* paddle;
+	PlayerPaddle* paddle;   // NULL once the paddle has stopped firing this beam
 
     DISALLOW_COPY_AND_ASSIGN(PaddleLaserBeam);
 };
@@ -31,6 +31,8 @@
 
 #include "PaddleLaserProjectile.h"
 
+DEFINE_POOLED_ALLOCATION(PaddleLaserProjectile, 64)
+
 const float PaddleLaserProjectile::HEIGHT_DEFAULT	= 1.2f;  // Height of a laser projectile in game units
 const float PaddleLaserProjectile::WIDTH_DEFAULT	= 0.5f;  // Width of a laser projectile in game units 
 const float PaddleLaserProjectile::DAMAGE_DEFAULT   = 50.0f; // Damage the laser projectile does by default
@@ -32,6 +32,8 @@
 #include "PaddleMineLauncherItem.h"
 #include "GameModel.h"
 
+DEFINE_POOLED_ALLOCATION(PaddleMineLauncherItem, 4)
+
 const double PaddleMineLauncherItem::MINE_LAUNCHER_PADDLE_TIMER_IN_SECS	= 17.0;
 const char* PaddleMineLauncherItem::MINE_LAUNCHER_PADDLE_ITEM_NAME	    = "MineLauncherPaddle";
 
@@ -53,7 +55,7 @@ double PaddleMineLauncherItem::Activate() {
 	for (std::list<GameItemTimer*>::iterator iter = activeTimers.begin(); iter != activeTimers.end();) {
 		GameItemTimer* currTimer = *iter;
 		if (currTimer->GetTimerItemType() == GameItem::MineLauncherPaddleItem) {
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 			iter = activeTimers.erase(iter);
 		}
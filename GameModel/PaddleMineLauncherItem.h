@@ -45,6 +45,8 @@ class Point2D;
  */
 class PaddleMineLauncherItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* MINE_LAUNCHER_PADDLE_ITEM_NAME;
 	static const double MINE_LAUNCHER_PADDLE_TIMER_IN_SECS;
 
@@ -35,6 +35,8 @@
 #include "LevelPiece.h"
 #include "GameModel.h"
 
+DEFINE_POOLED_ALLOCATION(PaddleMineProjectile, 16)
+
 PaddleMineProjectile::PaddleMineProjectile(const Point2D& spawnLoc, const Vector2D& velDir,
                                            float width, float height) :
 MineProjectile(spawnLoc, velDir, width, height) {
@@ -40,6 +40,8 @@
 class PaddleMineProjectile : public MineProjectile {
 
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	PaddleMineProjectile(const Point2D& spawnLoc, const Vector2D& velDir, float width, float height);
 	PaddleMineProjectile(const PaddleMineProjectile& copy);
     ~PaddleMineProjectile();
@@ -34,6 +34,8 @@
 #include "GameTransformMgr.h"
 #include "PortalBlock.h"
 
+DEFINE_POOLED_ALLOCATION(PaddleRemoteControlRocketProjectile, 16)
+
 const float PaddleRemoteControlRocketProjectile::PADDLE_REMOTE_CONTROL_ROCKET_HEIGHT_DEFAULT = 1.5f;
 const float PaddleRemoteControlRocketProjectile::PADDLE_REMOTE_CONTROL_ROCKET_WIDTH_DEFAULT  = 0.69f;
 
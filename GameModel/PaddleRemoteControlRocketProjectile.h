@@ -41,6 +41,8 @@ class PortalBlock;
  */
 class PaddleRemoteControlRocketProjectile : public RocketProjectile {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const float PADDLE_REMOTE_CONTROL_ROCKET_HEIGHT_DEFAULT;
 	static const float PADDLE_REMOTE_CONTROL_ROCKET_WIDTH_DEFAULT;
 
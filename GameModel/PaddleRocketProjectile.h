@@ -39,6 +39,8 @@
  */
 class PaddleRocketProjectile : public RocketProjectile {
 public:
+    DECLARE_POOLED_ALLOCATION();
+
     static const float DEFAULT_ROCKET_DMG;
 	static const float PADDLEROCKET_HEIGHT_DEFAULT;
 	static const float PADDLEROCKET_WIDTH_DEFAULT;
@@ -33,6 +33,8 @@
 #include "GameModel.h"
 #include "PlayerPaddle.h"
 
+DEFINE_POOLED_ALLOCATION(PaddleSizeItem, 4)
+
 const double PaddleSizeItem::PADDLE_SIZE_TIMER_IN_SECS	= 0.0;
 
 const char* PaddleSizeItem::PADDLE_GROW_ITEM_NAME		= "PaddleGrow";
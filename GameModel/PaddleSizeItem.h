@@ -39,6 +39,8 @@
 
 class PaddleSizeItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	enum PaddleSizeChangeType { ShrinkPaddle, GrowPaddle };
 
 	static const char* PADDLE_GROW_ITEM_NAME;
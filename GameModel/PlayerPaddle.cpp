@@ -44,6 +44,7 @@
 #include "PaddleLaserBeam.h"
 #include "BossBodyPart.h"
 #include "OneWayBlock.h"
+#include "SimulationClock.h"
 
 // Default values for the size of the paddle
 const float PlayerPaddle::PADDLE_WIDTH_TOTAL = 3.5f;
@@ -105,7 +106,8 @@ timeSinceLastBlastShot(PADDLE_FLAME_BLAST_DELAY + PADDLE_ICE_BLAST_DELAY), timeS
 moveButtonDown(false), hitWall(false), currType(NormalPaddle), currSize(PlayerPaddle::NormalSize), currSpecialStatus(PlayerPaddle::NoStatus),
 attachedBall(NULL), isPaddleCamActive(false), colour(1,1,1,1), isFiringBeam(false), impulse(0.0f), reorientZRotInRads(0.0f),
 impulseDeceleration(0.0f), impulseSpdDecreaseCounter(0.0f), lastEntityThatHurtHitPaddle(NULL), lastThingCollidedWith(NULL),
-levelBoundsCheckingOn(true), startingXPos(0.0), defaultYPos(0.0), frozenCountdown(0.0), onFireCountdown(0.0), electrocutedCountdown(0.0) {
+levelBoundsCheckingOn(true), startingXPos(0.0), defaultYPos(0.0), frozenCountdown(0.0), onFireCountdown(0.0), electrocutedCountdown(0.0),
+lastBeamHitTimeInMS(0) {
 	this->ResetPaddle();
 }
 
@@ -121,6 +123,7 @@ void PlayerPaddle::ResetPaddle() {
     this->frozenCountdown = 0.0;
     this->onFireCountdown = 0.0;
     this->electrocutedCountdown = 0.0;
+    this->lastBeamHitTimeInMS = 0;
     this->reorientZRotInRads = 0.0f;
 	this->currSize = PlayerPaddle::NormalSize;
     this->SetDefaultYPosition(PlayerPaddle::PADDLE_HALF_HEIGHT);
@@ -951,11 +954,11 @@ void PlayerPaddle::DiscreteShoot(GameModel* gameModel) {
         bool foundPiece = false;
         const GameLevel* currLevel = gameModel->GetCurrentLevel();
 
-        std::set<LevelPiece*> levelPieces;
+        LevelPieceCandidateBuffer levelPieces;
         currLevel->GetLevelPieceCollisionCandidates(0.0, rocketProjectile->GetPosition(), 
             rocketProjectile->BuildBoundingLines(), 0.0, levelPieces);
 
-        for (std::set<LevelPiece*>::const_iterator iter = levelPieces.begin(); iter != levelPieces.end(); ++iter) {
+        for (LevelPieceCandidateBuffer::const_iterator iter = levelPieces.begin(); iter != levelPieces.end(); ++iter) {
             const LevelPiece* currPiece = *iter;
             if (!currPiece->ProjectilePassesThrough(rocketProjectile)) {
                 rocketProjectile->SetLastThingCollidedWith(currPiece);
@@ -1379,13 +1382,12 @@ void PlayerPaddle::HitByBeam(const Beam& beam, const BeamSegment& beamSegment) {
     }
 
     static const long IMMUNITY_TO_BEAMS_TIME_IN_MS = 2000;
-    static long lastBeamHitTimeInMS = 0;
 
-    long currSysTime = BlammoTime::GetSystemTimeInMillisecs();
-    if (currSysTime - lastBeamHitTimeInMS <= IMMUNITY_TO_BEAMS_TIME_IN_MS) {
+    long currTime = static_cast<long>(SimulationClock::GetTimeInMillisecs());
+    if (currTime - this->lastBeamHitTimeInMS <= IMMUNITY_TO_BEAMS_TIME_IN_MS) {
         return;
     }
-    lastBeamHitTimeInMS = currSysTime;
+    this->lastBeamHitTimeInMS = currTime;
 
     this->BeamCollision(beam, beamSegment);
 
@@ -1822,10 +1824,10 @@ void PlayerPaddle::RocketProjectileCollision(GameModel* gameModel, const RocketP
 	assert(currentLevel != NULL);
 
 	// Figure out the position in space where the rocket hit and find what block is at that position...
-	std::set<LevelPiece*> levelPieces;
+	LevelPieceCandidateBuffer levelPieces;
     currentLevel->GetLevelPieceCollisionCandidatesNoSort(projectile.GetPosition(), EPSILON, levelPieces);
-	if (!levelPieces.empty()) {
-		currentLevel->RocketExplosion(gameModel, &projectile, *levelPieces.begin());
+	if (!levelPieces.IsEmpty()) {
+		currentLevel->RocketExplosion(gameModel, &projectile, levelPieces.GetFirst());
 	}
 	else {
 		currentLevel->RocketExplosionNoPieces(&projectile);
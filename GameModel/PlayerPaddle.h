@@ -447,6 +447,7 @@ private:
     double frozenCountdown;         // Keeps track of time that the paddle is frozen
     double onFireCountdown;         // Keeps track of time that the paddle is on fire
     double electrocutedCountdown;   // Keeps track of time that the paddle is electrocuted
+    long lastBeamHitTimeInMS;       // Simulation time of the last beam hit, the paddle is briefly immune to beams after being hit
 
 	GameBall* attachedBall;	// When a ball is resting on the paddle it will occupy this variable
 
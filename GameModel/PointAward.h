@@ -53,8 +53,10 @@ public:
     void SetMultiplierAmount(float amt);
 
     PointAward& operator=(const PointAward& copy) {
+        this->destructionMethod = copy.destructionMethod;
         this->type = copy.type;
         this->amount = copy.amount;
+        this->multiplier = copy.multiplier;
         this->location = copy.location;
         return (*this);
     }
@@ -31,6 +31,8 @@
 
 #include "PoisonPaddleItem.h"
 
+DEFINE_POOLED_ALLOCATION(PoisonPaddleItem, 4)
+
 const char* PoisonPaddleItem::POISON_PADDLE_ITEM_NAME       = "PoisonPaddle";
 const double PoisonPaddleItem::POISON_PADDLE_TIMER_IN_SECS	= 18.0f;
 
@@ -63,7 +65,7 @@ double PoisonPaddleItem::Activate() {
 	for (unsigned int i = 0; i < removeTimers.size(); i++) {
 	    GameItemTimer* currTimer = removeTimers[i];
 	    activeTimers.remove(currTimer);
-	    delete currTimer;
+	    GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 	    currTimer = NULL;
 	}
 
@@ -43,6 +43,8 @@
  */
 class PoisonPaddleItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* POISON_PADDLE_ITEM_NAME;
 	static const double POISON_PADDLE_TIMER_IN_SECS;
 
@@ -34,6 +34,7 @@
 #include "GameBall.h"
 #include "GameEventManager.h"
 #include "GameModel.h"
+#include "SimulationClock.h"
 
 const unsigned long PortalBlock::TIME_BETWEEN_BALL_USES_IN_MILLISECONDS = 650;
 
@@ -58,7 +59,7 @@ bool PortalBlock::SecondaryCollisionCheck(double dT, const GameBall& ball) const
     // No collision if the ball has just previously collided with this portal block OR
     // if the timer on this portal block for ball collisions is not past a certain time
 	if (ball.IsLastPieceCollidedWith(this) ||
-        (BlammoTime::GetSystemTimeInMillisecs() - this->timeOfLastBallCollision) < TIME_BETWEEN_BALL_USES_IN_MILLISECONDS) {
+        (SimulationClock::GetTimeInMillisecs() - this->timeOfLastBallCollision) < TIME_BETWEEN_BALL_USES_IN_MILLISECONDS) {
 		return false;
 	}
 
@@ -156,7 +157,7 @@ LevelPiece* PortalBlock::CollisionOccurred(GameModel* gameModel, GameBall& ball)
 	ball.SetCenterPosition(this->sibling->GetCenter());
 
     // Tell the sibling that it's last ball collision is now
-    this->sibling->timeOfLastBallCollision = BlammoTime::GetSystemTimeInMillisecs();
+    this->sibling->timeOfLastBallCollision = SimulationClock::GetTimeInMillisecs();
 
 	return this;
 }
@@ -33,6 +33,8 @@
 #include "GameBall.h"
 #include "GameEventManager.h"
 
+DEFINE_POOLED_ALLOCATION(PortalProjectile, 16)
+
 const float PortalProjectile::BOUNDS_COEFF = 0.7f;
 
 // Fraction of the base termination time where this portal is considered to be "close to" terminating
@@ -37,6 +37,8 @@
 
 class PortalProjectile : public Projectile {
 public:
+    DECLARE_POOLED_ALLOCATION();
+
     static std::pair<PortalProjectile*, PortalProjectile*> BuildSiblingPortalProjectiles(
         const Point2D& portal1Pos, const Point2D& portal2Pos, float width, float height, 
         const Colour& colour, double baseTerminationTimeInSecs);
@@ -42,6 +42,9 @@ public:
       width(width), height(height) {}
 
     GeneralEffectEventInfo::Type GetType() const { return GeneralEffectEventInfo::PortalSpawn; }
+    GeneralEffectEventInfo* Clone() const {
+        return new PortalSpawnEffectInfo(this->effectTimeInSecs, this->spawnPosition, this->colour, this->width, this->height);
+    }
 
     double GetEffectTimeInSeconds() const { return this->effectTimeInSecs; }
     const Point2D& GetSpawnPosition() const { return this->spawnPosition; }
@@ -49,6 +49,9 @@ public:
     ~PowerChargeEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::PowerChargeInfo; }
+    BossEffectEventInfo* Clone() const {
+        return new PowerChargeEffectInfo(this->chargingPart, this->chargeTimeInSecs, this->colour, this->sizeMultiplier, this->posOffset);
+    }
 
     const BossBodyPart* GetChargingPart() const { return this->chargingPart; }
     double GetChargeTimeInSecs() const { return this->chargeTimeInSecs; }
@@ -30,7 +30,8 @@
  */
 
 #include "PrismBlock.h"
-#include "EmptySpaceBlock.h"
+#include "EmptySpaceBlock.h"
+#include "GameEventManager.h"
 #include "PaddleLaserProjectile.h"
 #include "GameModel.h"
 
@@ -59,7 +60,7 @@ LevelPiece* PrismBlock::Destroy(GameModel* gameModel, const LevelPiece::Destruct
 
 	// Obliterate all that is left of this block...
 	LevelPiece* tempThis = this;
-	delete tempThis;
+	GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
 	tempThis = NULL;
 
 	return emptyPiece;
@@ -49,11 +49,13 @@
 
 // Projectile ====================================================================================================================
 
+unsigned int Projectile::nextObjectID = 0;
+
 Projectile::Projectile(const Point2D& spawnLoc, float width, float height) : 
-position(spawnLoc), lastThingCollidedWith(NULL), currWidth(width), currHeight(height), isInvisible(false) {
+objectID(Projectile::nextObjectID++), position(spawnLoc), lastThingCollidedWith(NULL), currWidth(width), currHeight(height), isInvisible(false) {
 }
 
-Projectile::Projectile(const Projectile& copy) : position(copy.position),
+Projectile::Projectile(const Projectile& copy) : objectID(Projectile::nextObjectID++), position(copy.position),
 lastThingCollidedWith(copy.lastThingCollidedWith), currWidth(copy.currWidth), currHeight(copy.currHeight),
 velocityDir(copy.velocityDir), velocityMag(copy.velocityMag), rightVec(copy.rightVec), isInvisible(copy.isInvisible) {
 }
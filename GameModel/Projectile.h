@@ -36,6 +36,8 @@
 #include "../BlammoEngine/Collision.h"
 #include "../BlammoEngine/Point.h"
 #include "../BlammoEngine/Vector.h"
+#include "../BlammoEngine/FreeListPool.h"
+#include "../BlammoEngine/IntrusiveList.h"
 
 #include "BoundingLines.h"
 
@@ -49,9 +51,11 @@ class Boss;
 class BossBodyPart;
 
 /**
- * An 'abstract class' for representing in-game projectiles.
+ * An 'abstract class' for representing in-game projectiles. Each concrete type of projectile
+ * is allocated from a pool of its own (see DECLARE_POOLED_ALLOCATION) and projectiles link
+ * themselves into the game model's lists (see IntrusiveList).
  */
-class Projectile : public IPositionObject {
+class Projectile : public IPositionObject, public IntrusiveListNode {
 public:
 	enum ProjectileType { PaddleLaserBulletProjectile, BallLaserBulletProjectile, LaserTurretBulletProjectile,
                           CollateralBlockProjectile, PaddleRocketBulletProjectile, PaddleRemoteCtrlRocketBulletProjectile,
@@ -123,6 +127,9 @@ public:
 
 	const Point2D& GetPosition() const { return this->position; }
 
+    // Unique to this projectile for the life of the game (a copied projectile gets its own)
+    unsigned int GetObjectID() const { return this->objectID; }
+
 	const Vector2D& GetVelocityDirection() const { return this->velocityDir; }
 	float GetVelocityMagnitude() const { return this->velocityMag; }
     Vector2D GetVelocity() const { return this->GetVelocityMagnitude() * this->GetVelocityDirection(); }
@@ -169,6 +176,7 @@ protected:
 	Projectile(const Point2D& spawnLoc, float width, float height);
 	Projectile(const Projectile& copy);
 	
+	unsigned int objectID;
 	float currWidth;
 	float currHeight;
 	Point2D position;	    // Position of the projectile in game units
@@ -179,6 +187,9 @@ protected:
 
     bool isInvisible;
 
+private:
+    static unsigned int nextObjectID;   // The object ID given to the next projectile that gets created
+
 };
 
 inline float Projectile::GetProjectileSplitScaleFactor(int numSplits) {
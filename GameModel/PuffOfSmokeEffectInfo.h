@@ -41,6 +41,9 @@ public:
     ~PuffOfSmokeEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::PuffOfSmokeInfo; }
+    BossEffectEventInfo* Clone() const {
+        return new PuffOfSmokeEffectInfo(this->pos, this->size, this->colour);
+    }
 
     const Point2D& GetPosition() const { return this->pos; }
     float GetSize() const { return this->size; }
@@ -31,6 +31,9 @@
 
 #include "RandomItem.h"
 #include "GameItemFactory.h"
+#include "SimulationClock.h"
+
+DEFINE_POOLED_ALLOCATION(RandomItem, 4)
 
 const char*  RandomItem::RANDOM_ITEM_NAME = "Random";
 const long RandomItem::TIME_BETWEEN_BLINKS_IN_MS = 100;
@@ -51,7 +54,7 @@ currRandomIdx(-1), lastBlinkTime(0) {
     }
 
     this->currRandomIdx = Randomizer::GetInstance()->RandomUnsignedInt() % static_cast<int>(this->possibleItemDropTypes.size());
-    this->lastBlinkTime = BlammoTime::GetSystemTimeInMillisecs();
+    this->lastBlinkTime = SimulationClock::GetTimeInMillisecs();
 }
 
 RandomItem::~RandomItem() {
@@ -86,14 +89,16 @@ GameItem::ItemType RandomItem::GetItemType() const {
     return GameItem::RandomItem;
 }
 
-GameItem::ItemType RandomItem::GetBlinkingRandomItemType() const {
-    unsigned long currTime = BlammoTime::GetSystemTimeInMillisecs();
+// The blinking (i.e., which item the random item will become when it's caught) is advanced
+// here, with the model, rather than when it's drawn so that it doesn't depend on the frame rate
+void RandomItem::Tick(double seconds, const GameModel& model) {
+    GameItem::Tick(seconds, model);
+
+    unsigned long currTime = SimulationClock::GetTimeInMillisecs();
     if (labs(static_cast<long>(currTime) - static_cast<long>(this->lastBlinkTime)) >= TIME_BETWEEN_BLINKS_IN_MS) {
         // Choose a new random item to show...
         this->currRandomIdx = (this->currRandomIdx + 1 + (Randomizer::GetInstance()->RandomUnsignedInt() % 
             static_cast<int>(this->possibleItemDropTypes.size())-1)) % static_cast<int>(this->possibleItemDropTypes.size());
         this->lastBlinkTime = currTime;
     }
-
-    return this->possibleItemDropTypes[this->currRandomIdx];
 }
\ No newline at end of file
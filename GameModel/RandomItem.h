@@ -42,6 +42,8 @@
 // that it drops as an entirely separate type of item.
 class RandomItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* RANDOM_ITEM_NAME;
 
 	RandomItem(const Point2D &spawnOrigin, const Vector2D& dropDir, GameModel *gameModel);
@@ -52,6 +54,8 @@ public:
 	void Deactivate();
 	GameItem::ItemType GetItemType() const;
 
+    void Tick(double seconds, const GameModel& model);
+
     GameItem::ItemType GetBlinkingRandomItemType() const;
 
 private:
@@ -60,8 +64,8 @@ private:
 	GameItem* randomItem;
     std::vector<GameItem::ItemType> possibleItemDropTypes;
     
-    mutable int currRandomIdx;
-    mutable unsigned long lastBlinkTime;
+    int currRandomIdx;
+    unsigned long lastBlinkTime;
 
     DISALLOW_COPY_AND_ASSIGN(RandomItem);
 };
@@ -74,4 +78,8 @@ inline void RandomItem::Deactivate() {
 	this->randomItem->Deactivate();
 }
 
+inline GameItem::ItemType RandomItem::GetBlinkingRandomItemType() const {
+    return this->possibleItemDropTypes[this->currRandomIdx];
+}
+
 #endif
\ No newline at end of file
@@ -154,7 +154,7 @@ LevelPiece* RegenBlock::Destroy(GameModel* gameModel, const LevelPiece::Destruct
 
 	// Obliterate all that is left of this block...
 	LevelPiece* tempThis = this;
-	delete tempThis;
+	GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
 	tempThis = NULL;
 
     // Add to the ball boost meter...
@@ -33,6 +33,8 @@
 #include "GameModel.h"
 #include "PlayerPaddle.h"
 
+DEFINE_POOLED_ALLOCATION(RemoteControlRocketItem, 4)
+
 const char* RemoteControlRocketItem::REMOTE_CONTROL_ROCKET_ITEM_NAME      = "RemoteControlRocket";
 const double RemoteControlRocketItem::REMOTE_CONTROL_ROCKET_TIMER_IN_SECS = 0.0; // The rocket is not a timed power-up, it's activated when shot
 
@@ -45,6 +45,8 @@ class Point2D;
  */
 class RemoteControlRocketItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* REMOTE_CONTROL_ROCKET_ITEM_NAME;
 	static const double REMOTE_CONTROL_ROCKET_TIMER_IN_SECS;
 
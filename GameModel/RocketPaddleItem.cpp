@@ -32,6 +32,8 @@
 #include "RocketPaddleItem.h"
 #include "GameModel.h"
 
+DEFINE_POOLED_ALLOCATION(RocketPaddleItem, 4)
+
 const double RocketPaddleItem::ROCKET_PADDLE_TIMER_IN_SECS	= 0.0;  // The rocket is not a timed power-up, it's activated when shot
 const char* RocketPaddleItem::ROCKET_PADDLE_ITEM_NAME       = "RocketPaddle";
 
@@ -46,6 +46,8 @@ class Point2D;
  */
 class RocketPaddleItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* ROCKET_PADDLE_ITEM_NAME;
 	static const double ROCKET_PADDLE_TIMER_IN_SECS;
 
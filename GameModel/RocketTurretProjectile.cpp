@@ -32,6 +32,8 @@
 #include "RocketTurretProjectile.h"
 #include "RocketTurretBlock.h"
 
+DEFINE_POOLED_ALLOCATION(RocketTurretProjectile, 16)
+
 const float RocketTurretProjectile::TURRETROCKET_WIDTH_DEFAULT  = 0.41f;
 const float RocketTurretProjectile::TURRETROCKET_HEIGHT_DEFAULT = 0.72f;
 
@@ -37,6 +37,8 @@
 
 class RocketTurretProjectile : public RocketProjectile {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const float TURRETROCKET_HEIGHT_DEFAULT;
 	static const float TURRETROCKET_WIDTH_DEFAULT;
 
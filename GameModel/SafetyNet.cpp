@@ -70,6 +70,10 @@ SafetyNet::SafetyNet(const GameLevel& currLevel, bool isBottomSafetyNet) {
 }
 
 SafetyNet::~SafetyNet() {
+    this->PrepareForDeletion();
+}
+
+void SafetyNet::PrepareForDeletion() {
     // Make sure we remove all attached projectiles as well
     // NOTE: DO NOT USE ITERATORS HERE SINCE THE MINE PROJECTILE DETACHES ITSELF IN THE SetAsFalling call
     while (!this->attachedProjectiles.empty()) {
@@ -68,6 +68,10 @@ public:
 
     void AttachProjectile(MineProjectile* p);
     void DetachProjectile(MineProjectile* p);
+
+    // Drops anything attached to the net, done when the net is destroyed or earlier when its
+    // deletion is put off (see GameEventManager::DeleteAfterDispatch)
+    void PrepareForDeletion();
     
 private:
     BoundingLines bounds;
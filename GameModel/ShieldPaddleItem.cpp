@@ -32,6 +32,8 @@
 #include "ShieldPaddleItem.h"
 #include "GameModel.h"
 
+DEFINE_POOLED_ALLOCATION(ShieldPaddleItem, 4)
+
 const char* ShieldPaddleItem::SHIELD_PADDLE_ITEM_NAME	   = "ShieldPaddle";
 const double ShieldPaddleItem::SHIELD_PADDLE_TIMER_IN_SECS = 25.0;
 
@@ -59,7 +61,7 @@ double ShieldPaddleItem::Activate() {
 	for (unsigned int i = 0; i < removeTimers.size(); i++) {
 			GameItemTimer* currTimer = removeTimers[i];
 			activeTimers.remove(currTimer);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 	}
 
@@ -36,6 +36,8 @@
 
 class ShieldPaddleItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char* SHIELD_PADDLE_ITEM_NAME;
 	static const double SHIELD_PADDLE_TIMER_IN_SECS;
 
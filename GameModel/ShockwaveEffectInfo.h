@@ -41,6 +41,9 @@ public:
     ~ShockwaveEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::ShockwaveInfo; }
+    BossEffectEventInfo* Clone() const {
+        return new ShockwaveEffectInfo(this->pos, this->size, this->timeInSecs);
+    }
 
     const Point2D& GetPosition() const { return this->pos; }
     float GetSize() const { return this->size; }
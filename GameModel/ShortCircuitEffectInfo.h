@@ -51,6 +51,9 @@ public:
     double GetTimeInSecs() const { return this->timeInSecs; }
 
     GeneralEffectEventInfo::Type GetType() const { return GeneralEffectEventInfo::ShortCircuit; }
+    GeneralEffectEventInfo* Clone() const {
+        return new ShortCircuitEffectInfo(this->position, this->brightColour, this->medColour, this->darkColour, this->size, this->timeInSecs);
+    }
 
 private:
     const Point2D position;     // Position in level space where the effect should occur
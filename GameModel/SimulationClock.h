@@ -0,0 +1,68 @@
+/**
+ * SimulationClock.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIMULATIONCLOCK_H__
+#define __SIMULATIONCLOCK_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+/**
+ * The game model's clock: it only moves forward when the model is ticked. Anything in the model
+ * that needs to know the current time (e.g., cooldowns between switch presses or portal uses) must
+ * use this instead of the system time so that the model behaves identically regardless of how fast
+ * or when it gets ticked (e.g., when replaying a recorded session or running headless).
+ */
+class SimulationClock {
+public:
+    // Time that the clock starts at, this is offset from zero so that any cooldowns
+    // that start out at zero are already expired at the start of a session
+    static const unsigned long START_TIME_IN_MILLISECS = 60000;
+
+    static void Reset() {
+        SimulationClock::currTimeInSecs = START_TIME_IN_MILLISECS / 1000.0;
+    }
+    static void Advance(double seconds) {
+        assert(seconds >= 0.0);
+        SimulationClock::currTimeInSecs += seconds;
+    }
+
+    static unsigned long GetTimeInMillisecs() {
+        return static_cast<unsigned long>(SimulationClock::currTimeInSecs * 1000.0);
+    }
+
+private:
+    static double currTimeInSecs;
+
+    SimulationClock() {}
+    ~SimulationClock() {}
+};
+
+#endif // __SIMULATIONCLOCK_H__
@@ -41,6 +41,9 @@ public:
     ~SparkBurstEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::SparkBurstInfo; }
+    BossEffectEventInfo* Clone() const {
+        return new SparkBurstEffectInfo(this->part, this->timeInSecs, this->colour, this->offset);
+    }
 
     const BossBodyPart* GetPart() const { return this->part; }
     double GetTimeInSecs() const { return this->timeInSecs; }
@@ -50,6 +50,9 @@ public:
     Onomatoplex::Extremeness GetExtremeness() const { return this->extremeness; }
 
     GeneralEffectEventInfo::Type GetType() const { return GeneralEffectEventInfo::StarSmash; }
+    GeneralEffectEventInfo* Clone() const {
+        return new StarSmashEffectInfo(this->position, this->direction, this->size, this->timeInSecs, this->extremeness);
+    }
 
 private:
     const Point2D position;     // Position in level space where the effect should occur
@@ -32,6 +32,8 @@
 #include "StickyPaddleItem.h"
 #include "GameModel.h"
 
+DEFINE_POOLED_ALLOCATION(StickyPaddleItem, 4)
+
 const char* StickyPaddleItem::STICKY_PADDLE_ITEM_NAME	    = "StickyPaddle";
 const double StickyPaddleItem::STICKY_PADDLE_TIMER_IN_SECS  = 20.0;
 
@@ -66,7 +68,7 @@ double StickyPaddleItem::Activate() {
 			currTimer->SetDeactivateItemOnStop(false);	// Make sure we don't call deactivate on teh sticky paddle item that's active
 																									// or else the ball will fly off the paddle
 			activeTimers.remove(currTimer);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 	}
 
@@ -41,6 +41,8 @@
  */
 class StickyPaddleItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char*  STICKY_PADDLE_ITEM_NAME;
 	static const double STICKY_PADDLE_TIMER_IN_SECS;
 
@@ -45,6 +45,10 @@ public:
     ~SummonPortalsEffectInfo() {}
 
     BossEffectEventInfo::Type GetType() const { return BossEffectEventInfo::SummonPortalsInfo; }
+    BossEffectEventInfo* Clone() const {
+        return new SummonPortalsEffectInfo(this->bodyPart, this->size, this->timeInSecs, this->portal1Pos, this->portal2Pos,
+            this->portalColour, this->offset);
+    }
 
     const BossBodyPart* GetBodyPart() const { return this->bodyPart; }
     double GetTimeInSecs() const { return this->timeInSecs; }
@@ -34,6 +34,7 @@
 #include "GameLevel.h"
 #include "Beam.h"
 #include "GameEventManager.h"
+#include "SimulationClock.h"
 
 // Constant for the amount of time it takes for the switch to become activatable again, after
 // being turned on
@@ -324,8 +325,8 @@ LevelPiece* SwitchBlock::TickBeamCollision(double dT, const BeamSegment* beamSeg
 void SwitchBlock::SwitchPressed(GameModel* gameModel) {
     // The timer makes sure that the player can't repeatedly trigger this block, it also prevents
     // infinite recursion when two switches are hooked up in a loop
-    unsigned long currSysTime = BlammoTime::GetSystemTimeInMillisecs();
-    if (currSysTime - this->timeOfLastSwitchPress < SwitchBlock::RESET_TIME_IN_MS) {
+    unsigned long currTime = SimulationClock::GetTimeInMillisecs();
+    if (currTime - this->timeOfLastSwitchPress < SwitchBlock::RESET_TIME_IN_MS) {
         // Do nothing, need to wait for the switch to reset
         return;
     }
@@ -338,5 +339,5 @@ void SwitchBlock::SwitchPressed(GameModel* gameModel) {
     GameEventManager::Instance()->ActionSwitchBlockActivated(*this);
 
     // Switch has now officially been activated, reset the timer.
-    this->timeOfLastSwitchPress = currSysTime;
+    this->timeOfLastSwitchPress = currTime;
 }
\ No newline at end of file
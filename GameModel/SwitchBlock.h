@@ -33,6 +33,7 @@
 #define __SWITCHBLOCK_H__
 
 #include "LevelPiece.h"
+#include "SimulationClock.h"
 
 class SwitchBlock : public LevelPiece {
 public:
@@ -153,8 +154,8 @@ inline bool SwitchBlock::CollisionCheck(const Collision::Ray2D& ray, float& rayT
 }
 
 inline bool SwitchBlock::GetIsSwitchOn() const {
-    unsigned long currSysTime = BlammoTime::GetSystemTimeInMillisecs();
-    if (currSysTime - this->timeOfLastSwitchPress < SwitchBlock::RESET_TIME_IN_MS) {
+    unsigned long currTime = SimulationClock::GetTimeInMillisecs();
+    if (currTime - this->timeOfLastSwitchPress < SwitchBlock::RESET_TIME_IN_MS) {
         // Do nothing, need to wait for the switch to reset
         return true;
     }
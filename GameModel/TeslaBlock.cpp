@@ -33,6 +33,7 @@
 #include "Projectile.h"
 #include "GameModel.h"
 #include "PaddleLaserBeam.h"
+#include "SimulationClock.h"
 
 const float TeslaBlock::LIGHTNING_ARC_RADIUS = LevelPiece::PIECE_HEIGHT * 0.25f;
 
@@ -270,7 +271,7 @@ void TeslaBlock::ToggleElectricity(GameModel& gameModel, GameLevel& level, bool
 	}
 
     // Make sure we've waited long enough since the last toggling
-    unsigned long currTime = BlammoTime::GetSystemTimeInMillisecs(); 
+    unsigned long currTime = SimulationClock::GetTimeInMillisecs(); 
     if (labs(static_cast<long>(currTime) - static_cast<long>(this->timeOfLastToggling)) < MIN_TIME_BETWEEN_TOGGLINGS_IN_MS) {
         return;
     }
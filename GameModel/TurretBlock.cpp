@@ -93,7 +93,7 @@ LevelPiece* TurretBlock::Destroy(GameModel* gameModel, const LevelPiece::Destruc
 
 	// Obliterate all that is left of this block...
 	LevelPiece* tempThis = this;
-	delete tempThis;
+	GameEventManager::Instance()->DeleteAfterDispatch(tempThis);
 	tempThis = NULL;
 
     // Add to the boost meter
@@ -34,6 +34,8 @@
 #include "GameModel.h"
 #include "GameItemTimer.h"
 
+DEFINE_POOLED_ALLOCATION(UberBallItem, 4)
+
 const double UberBallItem::UBER_BALL_TIMER_IN_SECS	= 10.0;
 const char* UberBallItem::UBER_BALL_ITEM_NAME       = "UberBall";
 
@@ -63,7 +65,7 @@ double UberBallItem::Activate() {
 	for (unsigned int i = 0; i < removeTimers.size(); i++) {
 	    GameItemTimer* currTimer = removeTimers[i];
 	    activeTimers.remove(currTimer);
-	    delete currTimer;
+	    GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 	    currTimer = NULL;
 	}
 
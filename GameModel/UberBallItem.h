@@ -40,6 +40,8 @@
 
 class UberBallItem : public GameItem {
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char*  UBER_BALL_ITEM_NAME;
 	static const double UBER_BALL_TIMER_IN_SECS;
 
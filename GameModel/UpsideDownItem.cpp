@@ -33,6 +33,8 @@
 #include "GameTransformMgr.h"
 #include "GameItemTimer.h"
 
+DEFINE_POOLED_ALLOCATION(UpsideDownItem, 4)
+
 const char* UpsideDownItem::UPSIDEDOWN_ITEM_NAME      = "UpsideDown";
 const double UpsideDownItem::UPSIDEDOWN_TIMER_IN_SECS = 22.0;
 
@@ -63,7 +65,7 @@ double UpsideDownItem::Activate() {
 	for (unsigned int i = 0; i < removeTimers.size(); i++) {
 			GameItemTimer* currTimer = removeTimers[i];
 			activeTimers.remove(currTimer);
-			delete currTimer;
+			GameEventManager::Instance()->DeleteAfterDispatch(currTimer);
 			currTimer = NULL;
 	}
 
@@ -45,6 +45,8 @@ class Point2D;
 class UpsideDownItem : public GameItem {
 
 public:
+	DECLARE_POOLED_ALLOCATION();
+
 	static const char*  UPSIDEDOWN_ITEM_NAME;
 	static const double UPSIDEDOWN_TIMER_IN_SECS;
 
@@ -55,6 +55,9 @@ public:
     virtual bool Load()   = 0;
     virtual void Unload() = 0;
 
+    // The sound files that Load will read in
+    virtual void GetSoundFilepaths(std::vector<std::string>& filepaths) const = 0;
+
     Sound* Spawn2DSound(bool isLooped, bool startPaused = false);
     Sound* Spawn3DSound(bool isLooped, const Point3D& position, bool startPaused = false);
 
@@ -41,6 +41,7 @@
 #include "../BlammoEngine/Camera.h"
 #include "../GameView/GameViewConstants.h"
 #include "../ConfigOptions.h"
+#include "../BlammoEngine/FrameProfiler.h"
 
 const float GameSound::DEFAULT_MIN_3D_SOUND_DIST       = 1000.0f;
 const float GameSound::DEFAULT_3D_SOUND_ROLLOFF_FACTOR = 0.1f;
@@ -48,9 +49,18 @@ const float GameSound::DEFAULT_MASTER_VOLUME = 1.0f;
 
 GameSound::IsMusicMap GameSound::musicSoundTypeMap;
 
-GameSound::GameSound() : soundEngine(NULL), currLoadedWorldStyle(GameWorld::None), 
-levelTranslation(0,0,0), gameFGTransform(), ignorePlaySounds(false), musicVolume(1.0f), sfxVolume(1.0f)
+/**
+ * Constructor for the game's sound module. When isSilent is true no sound device is created and
+ * every request to play a sound is ignored - this allows the game model to be run without any
+ * audio hardware (e.g., headless simulation runs).
+ */
+GameSound::GameSound(bool isSilent) : soundEngine(NULL), currLoadedWorldStyle(GameWorld::None), 
+levelTranslation(0,0,0), gameFGTransform(), ignorePlaySounds(isSilent), musicVolume(1.0f), sfxVolume(1.0f)
 {
+    if (isSilent) {
+        return;
+    }
+
     this->soundEngine = irrklang::createIrrKlangDevice();
     this->soundEngine->setRolloffFactor(DEFAULT_3D_SOUND_ROLLOFF_FACTOR);
     this->soundEngine->setDefault3DSoundMinDistance(DEFAULT_MIN_3D_SOUND_DIST);
@@ -90,6 +100,7 @@ bool GameSound::Init(bool arcadeMode) {
 }
 
 void GameSound::Tick(double dT) {
+    PROFILE_SCOPE("GameSound::Tick");
 
     // Go through all the currently playing sounds, tick them, and clean up any that have finished playing
 
@@ -191,6 +202,50 @@ void GameSound::LoadWorldSounds(const GameWorld::WorldStyle& world) {
     this->currLoadedWorldStyle = world;
 }
 
+/**
+ * Start reading the global sound files on the resource manager's background streaming threads so that
+ * a later call to LoadGlobalSounds doesn't have to wait on the file system.
+ */
+void GameSound::PrefetchGlobalSounds() {
+    if (this->soundEngine == NULL) {
+        return;
+    }
+    this->PrefetchSoundSources(this->globalSounds);
+}
+
+/**
+ * Start reading the given world's sound files on the resource manager's background streaming threads
+ * so that a later call to LoadWorldSounds doesn't have to wait on the file system. The sounds are
+ * still handed to irrKlang on this thread when they're loaded.
+ */
+void GameSound::PrefetchWorldSounds(const GameWorld::WorldStyle& world) {
+    if (this->soundEngine == NULL) {
+        return;
+    }
+
+    WorldSoundSourceMapIter findIter = this->worldSounds.find(world);
+    if (findIter == this->worldSounds.end()) {
+        return;
+    }
+    this->PrefetchSoundSources(findIter->second);
+}
+
+// Prefetches the files of every sound source in the given map that isn't loaded yet
+void GameSound::PrefetchSoundSources(const SoundSourceMap& soundSources) const {
+    std::vector<std::string> filepaths;
+    for (SoundSourceMapConstIter iter = soundSources.begin(); iter != soundSources.end(); ++iter) {
+        const AbstractSoundSource* currSoundSrc = iter->second;
+        assert(currSoundSrc != NULL);
+        if (!currSoundSrc->IsLoaded()) {
+            currSoundSrc->GetSoundFilepaths(filepaths);
+        }
+    }
+
+    for (std::vector<std::string>::const_iterator iter = filepaths.begin(); iter != filepaths.end(); ++iter) {
+        ResourceManager::GetInstance()->PrefetchFile(*iter);
+    }
+}
+
 /**
  * Reload every sound source from the game's MSF file.
  */
@@ -325,7 +325,7 @@ public:
     static const float DEFAULT_MIN_3D_SOUND_DIST;
     static const float DEFAULT_3D_SOUND_ROLLOFF_FACTOR;
 
-    GameSound();
+    GameSound(bool isSilent = false);
     ~GameSound();
 
     // Initialization function (MUST BE CALLED FIRST!)
@@ -337,6 +337,8 @@ public:
     // Sound loading functions
     void LoadGlobalSounds();
     void LoadWorldSounds(const GameWorld::WorldStyle& world);
+    void PrefetchGlobalSounds();
+    void PrefetchWorldSounds(const GameWorld::WorldStyle& world);
     void ReloadFromMSF();
 
     // Play/stop functions
@@ -456,6 +458,7 @@ private:
         const SoundEffect::EffectParameterMap& parameterMap);
 
     bool LoadFromMSF();
+    void PrefetchSoundSources(const SoundSourceMap& soundSources) const;
 
     bool PlaySoundWithID(const SoundID& id, const GameSound::SoundType& soundType, bool isLooped, bool startPaused = false);
     float GetSoundTypeMasterVolume(const Sound& sound) const;
@@ -86,7 +86,7 @@ Sound* RandomSoundSource::Spawn2DSoundWithID(const SoundID& id, bool isLooped, b
     }
     
     // Choose a random source to spawn...
-    irrklang::ISoundSource* randomSource = this->sources[Randomizer::GetInstance()->RandomUnsignedInt() % this->sources.size()];
+    irrklang::ISoundSource* randomSource = this->sources[Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->sources.size()];
     assert(randomSource != NULL);
     return this->Spawn2DSoundWithIDAndSource(id, randomSource, isLooped, startPaused);
 }
@@ -98,7 +98,7 @@ Sound* RandomSoundSource::Spawn3DSoundWithID(const SoundID& id, bool isLooped, c
     }
 
     // Choose a random source to spawn...
-    irrklang::ISoundSource* randomSource = this->sources[Randomizer::GetInstance()->RandomUnsignedInt() % this->sources.size()];
+    irrklang::ISoundSource* randomSource = this->sources[Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->sources.size()];
     assert(randomSource != NULL);
     return this->Spawn2DSoundWithIDAndSource(id, randomSource, isLooped, pos, startPaused);
 }
\ No newline at end of file
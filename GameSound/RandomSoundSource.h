@@ -44,6 +44,8 @@ public:
     bool Load();
     void Unload();
 
+    void GetSoundFilepaths(std::vector<std::string>& filepaths) const;
+
 private:
     RandomSoundSource(irrklang::ISoundEngine* soundEngine, const GameSound::SoundType& soundType,
         const std::string& soundName, const std::vector<std::string>& filePaths);
@@ -62,4 +64,8 @@ inline bool RandomSoundSource::IsLoaded() const {
     return this->isInit;
 }
 
+inline void RandomSoundSource::GetSoundFilepaths(std::vector<std::string>& filepaths) const {
+    filepaths.insert(filepaths.end(), this->soundFilePaths.begin(), this->soundFilePaths.end());
+}
+
 #endif // __RANDOMSOUNDSOURCE_H__
\ No newline at end of file
@@ -53,6 +53,8 @@ public:
     bool Load();
     void Unload();
 
+    void GetSoundFilepaths(std::vector<std::string>& filepaths) const;
+
 private:
     SingleSoundSource(irrklang::ISoundEngine* soundEngine, const GameSound::SoundType& soundType,
         const std::string& soundName, const std::string& filePath);
@@ -72,4 +74,8 @@ inline bool SingleSoundSource::IsLoaded() const {
     return (this->source != NULL);
 }
 
+inline void SingleSoundSource::GetSoundFilepaths(std::vector<std::string>& filepaths) const {
+    filepaths.push_back(this->soundFilePath);
+}
+
 #endif // __SINGLESOUNDSOURCE_H__
\ No newline at end of file
@@ -45,8 +45,8 @@ semiFaderEffector(1.0f, 0.1f),
 fullFaderEffector(1.0f, 0.0f),
 particleLargeGrowth(1.0f, 2.3f),
 particleMediumGrowth(1.0f, 1.85f),
-smokeRotatorCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
-smokeRotatorCCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
+smokeRotatorCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
+smokeRotatorCCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
 gritTexture(NULL),
 rectPrismTexture(NULL),
 frostTexture(NULL) {
@@ -338,7 +338,7 @@ ESPPointEmitter* BlockStatusEffectRenderer::BuildBlockOnFireFlameEffect(const Le
 	}
 	bool result = pulsingFlame->SetRandomTextureEffectParticles(4, &this->fireEffect, this->cloudTextures);
     UNUSED_VARIABLE(result);
-	pulsingFlame->SimulateTicking(Randomizer::GetInstance()->RandomNumZeroToOne() * 10);
+	pulsingFlame->SimulateTicking(Randomizer::GetPresentationInstance()->RandomNumZeroToOne() * 10);
 	assert(result);
 
 	return pulsingFlame;
@@ -363,7 +363,7 @@ ESPPointEmitter* BlockStatusEffectRenderer::BuildBlockOnFireSmokeEffect(const Le
 	smokeClouds->AddEffector(&this->fireColourEffector);
 
 	ESPParticleRotateEffector* rotateEffector;
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		rotateEffector = &this->smokeRotatorCW;
 	}
 	else {
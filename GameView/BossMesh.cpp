@@ -80,8 +80,8 @@ particleMediumShrink(1.0f, 0.25f),
 particleFader(1, 0),
 smokeColourFader(ColourRGBA(0.7f, 0.7f, 0.7f, 1.0f), ColourRGBA(0.1f, 0.1f, 0.1f, 0.1f)),
 particleFireColourFader(ColourRGBA(0.75f, 0.75f, 0.1f, 1.0f), ColourRGBA(0.75f, 0.2f, 0.2f, 0.0f)),
-rotateEffectorCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
-rotateEffectorCCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
+rotateEffectorCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
+rotateEffectorCCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
 laserSightBigToSmallSize(1.5f, 0.5f),
 laserSightTargetColourChanger(ColourRGBA(0.0f, 1.0f, 0.0f, 0.8f), ColourRGBA(1.0f, 0.0f, 0.0f, 1.0f)),
 laserSightTargetRotateEffector(100.0f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
@@ -955,7 +955,7 @@ void BossMesh::AddEnumEffect(const EnumBossEffectInfo& info) {
             briefSparkle->SetParticleColour(Colour(1,1,1));
             briefSparkle->AddCopiedEffector(ESPParticleScaleEffector(1.0f, 5.0f));
             briefSparkle->AddCopiedEffector(ESPParticleRotateEffector(
-                Randomizer::GetInstance()->RandomUnsignedInt() % 360, 1, ESPParticleRotateEffector::CLOCKWISE));
+                Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 1, ESPParticleRotateEffector::CLOCKWISE));
             briefSparkle->AddCopiedEffector(ESPMultiAlphaEffector(1.0f, 0.0, 1.0f, 0.8, 0.0f, 1.0));
             briefSparkle->SetParticles(1, PersistentTextureManager::GetInstance()->GetLoadedTexture(
                 GameViewConstants::GetInstance()->TEXTURE_SPARKLE));
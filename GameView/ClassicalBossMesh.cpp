@@ -52,7 +52,7 @@ rightArmFireEmitter(NULL), leftArmSmokeEmitter(NULL), rightArmSmokeEmitter(NULL)
 leftArmExplodingEmitter(NULL), rightArmExplodingEmitter(NULL), pedimentExplodingEmitter(NULL),
 eyeExplodingEmitter(NULL), eyeSmokeEmitter(NULL), eyeFireEmitter(NULL),
 particleGrowToSize(0.001f, 1.0f), particleFader(1.0f, 0.0f),
-particleTwirl(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 1, ESPParticleRotateEffector::CLOCKWISE),
+particleTwirl(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 1, ESPParticleRotateEffector::CLOCKWISE),
 eyeGlowPulser(ScaleEffect(1.0f, 1.5f)), sparkleSoundID(INVALID_SOUND_ID+1), glowSoundID(INVALID_SOUND_ID+1) {
 
     assert(boss != NULL);
@@ -96,11 +96,11 @@ inline void ClassicalWorldAssets::Tick(double dT, const GameModel& model) {
 	
     // Rotate the up direction by some random amount and then affect the fire particle's velocities
 	// by it, this gives the impression that the particles are flickering like fire
-	double randomDegrees = Randomizer::GetInstance()->RandomNumNegOneToOne() * CONE_SIZE_IN_DEGREES;
+	double randomDegrees = Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * CONE_SIZE_IN_DEGREES;
 	Vector2D accelVec = ACCEL_MAG * Vector2D::Rotate(static_cast<float>(randomDegrees), Vector2D(0, 1));
 	this->fireAccel1.SetAcceleration(Vector3D(accelVec, 0.0f));
 
-	randomDegrees = Randomizer::GetInstance()->RandomNumNegOneToOne() * CONE_SIZE_IN_DEGREES;
+	randomDegrees = Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * CONE_SIZE_IN_DEGREES;
 	accelVec = ACCEL_MAG * Vector2D::Rotate(static_cast<float>(randomDegrees), Vector2D(0, 1));
 	this->fireAccel2.SetAcceleration(Vector3D(accelVec, 0.0f));
 
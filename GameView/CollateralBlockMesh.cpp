@@ -87,14 +87,14 @@ void CollateralBlockMesh::Draw(double dT, const Camera& camera, const BasicPoint
         switch (collateralBlock->GetState()) {
             case CollateralBlock::WarningState:
 			    // Randomly shake the block around...
-			    shake[0] = Randomizer::GetInstance()->RandomNumNegOneToOne() * SHAKE_DIST;
-			    shake[1] = Randomizer::GetInstance()->RandomNumNegOneToOne() * SHAKE_DIST;
-			    shake[2] = Randomizer::GetInstance()->RandomNumNegOneToOne() * SHAKE_DIST;
+			    shake[0] = Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * SHAKE_DIST;
+			    shake[1] = Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * SHAKE_DIST;
+			    shake[2] = Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * SHAKE_DIST;
 			    glTranslatef(shake[0], shake[1], shake[2]);
 
 			    // Randomly flash colour on the block
-			    colour[0] = 0.5f + Randomizer::GetInstance()->RandomNumZeroToOne() * 0.5f;
-			    colour[1] = Randomizer::GetInstance()->RandomNumZeroToOne();
+			    colour[0] = 0.5f + Randomizer::GetPresentationInstance()->RandomNumZeroToOne() * 0.5f;
+			    colour[1] = Randomizer::GetPresentationInstance()->RandomNumZeroToOne();
 			    colour[2] = 0.0f;
     			
                 this->alphaFlashAnim.Tick(dT);
@@ -129,8 +129,8 @@ eyeGlowSoundID(INVALID_SOUND_ID), lightningRelaySoundID(INVALID_SOUND_ID) {
         timeVals.reserve(1 + 2*NUM_CYCLES);
         timeVals.push_back(0.0);
         for (int i = 0; i < NUM_CYCLES; i++) {
-            timeVals.push_back(timeVals.back() + 0.01 + 0.05*Randomizer::GetInstance()->RandomNumZeroToOne());
-            timeVals.push_back(timeVals.back() + 0.01 + 0.05*Randomizer::GetInstance()->RandomNumZeroToOne());
+            timeVals.push_back(timeVals.back() + 0.01 + 0.05*Randomizer::GetPresentationInstance()->RandomNumZeroToOne());
+            timeVals.push_back(timeVals.back() + 0.01 + 0.05*Randomizer::GetPresentationInstance()->RandomNumZeroToOne());
         }
 
         std::vector<float> alphaVals;
@@ -157,7 +157,7 @@ void DecoWorldAssets::InitializeEmitters() {
 	this->spiralEmitterSm.SetEmitDirection(Vector3D(0, 1, 0));
 	this->spiralEmitterSm.SetParticleAlignment(ESP::ScreenAlignedGlobalUpVec);
 	this->spiralEmitterSm.SetParticleColour(ESPInterval(spiralColour.R()), ESPInterval(spiralColour.G()), ESPInterval(spiralColour.B()), ESPInterval(1.0f));
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		this->spiralEmitterSm.AddEffector(&this->rotateEffectorCW);
 	}
 	else {
@@ -174,7 +174,7 @@ void DecoWorldAssets::InitializeEmitters() {
 	this->spiralEmitterMed.SetEmitDirection(Vector3D(0, 1, 0));
 	this->spiralEmitterMed.SetParticleAlignment(ESP::ScreenAlignedGlobalUpVec);
 	this->spiralEmitterMed.SetParticleColour(ESPInterval(spiralColour.R()), ESPInterval(spiralColour.G()), ESPInterval(spiralColour.B()), ESPInterval(1.0f));
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		this->spiralEmitterMed.AddEffector(&this->rotateEffectorCW);
 	}
 	else {
@@ -191,7 +191,7 @@ void DecoWorldAssets::InitializeEmitters() {
 	this->spiralEmitterLg.SetEmitDirection(Vector3D(0, 1, 0));
 	this->spiralEmitterLg.SetParticleAlignment(ESP::ScreenAlignedGlobalUpVec);
 	this->spiralEmitterLg.SetParticleColour(ESPInterval(spiralColour.R()), ESPInterval(spiralColour.G()), ESPInterval(spiralColour.B()), ESPInterval(1.0f));
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		this->spiralEmitterLg.AddEffector(&this->rotateEffectorCW);
 	}
 	else {
@@ -154,7 +154,7 @@ void DisplayState::DebugDrawBounds() {
     const GameModel::ProjectileMap& projectiles = model->GetActiveProjectiles();
     for (GameModel::ProjectileMapConstIter iter1 = projectiles.begin(); iter1 != projectiles.end(); ++iter1) {
 
-        const GameModel::ProjectileList& projectileList = iter1->second; 
+        const GameModel::ProjectileList& projectileList = *iter1->second; 
         for (GameModel::ProjectileListConstIter iter2 = projectileList.begin(); iter2 != projectileList.end(); ++iter2) {
             (*iter2)->DebugDraw();
         }
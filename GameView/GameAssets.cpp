@@ -89,13 +89,16 @@
 // ESP Engine includes
 #include "../ESPEngine/ESPEmitter.h"
 
+#include "../GameModel/GameModelSnapshot.h"
+
 // Basic Top Level Includes
 #include "../ResourceManager.h"
 
 // *****************************************************
 
-GameAssets::GameAssets(int screenWidth, int screenHeight, GameSound* sound): 
+GameAssets::GameAssets(int screenWidth, int screenHeight, GameSound* sound, const GameModelSnapshot& drawnModelState): 
 sound(sound),
+drawnModelState(drawnModelState),
 
 currentLevelMesh(NULL),
 worldAssets(NULL),
@@ -141,7 +144,7 @@ magnetPaddleEffect(NULL)
 {
 	// Load ESP assets
 	LoadingScreen::GetInstance()->UpdateLoadingScreenWithRandomLoadStr();
-	this->espAssets      = new GameESPAssets();
+	this->espAssets      = new GameESPAssets(this->drawnModelState);
     this->tutorialAssets = new GameTutorialAssets();
 
 	// Load FBO assets
@@ -328,7 +331,7 @@ void GameAssets::DrawGameBallsPreEffects(double dT, GameModel& gameModel, const
         Vector2D fullRadiusVec = 0.99f * currBall->GetBounds().Radius() * ballBoostRotated90;
         Vector2D halfRadiusVec = 0.5f  * fullRadiusVec;
 
-        const Point2D& ballPos = currBall->GetCenterPosition2D();
+        const Point2D ballPos = this->drawnModelState.GetBallPosition(*currBall);
         glPushMatrix();
         glTranslatef(ballPos[0], ballPos[1], 0);
         glMultMatrixf(screenAlignedMatrix.begin());
@@ -408,7 +411,7 @@ void GameAssets::DrawGameBalls(double dT, GameModel& gameModel, const Camera& ca
 		CgFxEffectBase* ballEffectTemp = NULL;
 		Vector3D currBallColourVec(0,0,0);
 
-		const Point2D& ballPos = currBall->GetCenterPosition2D();
+		const Point2D ballPos = this->drawnModelState.GetBallPosition(*currBall);
 
 		if (currBall->GetBallType() == GameBall::NormalBall) {
 			// Normal ball with a regular light
@@ -676,7 +679,7 @@ void GameAssets::Tick(double dT, const GameModel& gameModel) {
 void GameAssets::DrawPaddle(double dT, const GameModel& gameModel, const Camera& camera) {
 	
     const PlayerPaddle& p = *gameModel.GetPlayerPaddle();
-    const Point2D& paddleCenter = p.GetCenterPosition();	
+    const Point2D paddleCenter = this->drawnModelState.GetPaddlePosition(p);
 	float paddleScaleFactor     = p.GetPaddleScaleFactor();
 	float scaleHeightAdjustment = PlayerPaddle::PADDLE_HALF_HEIGHT * (paddleScaleFactor - 1);
 	
@@ -796,7 +799,7 @@ void GameAssets::DrawPaddlePostEffects(double dT, GameModel& gameModel, const Ca
 		return;
 	}
 	
-	const Point2D& paddleCenter = paddle->GetCenterPosition();
+	const Point2D paddleCenter  = this->drawnModelState.GetPaddlePosition(*paddle);
 	float paddleScaleFactor     = paddle->GetPaddleScaleFactor();
 	float scaleHeightAdjustment = PlayerPaddle::PADDLE_HALF_HEIGHT * (paddleScaleFactor - 1);
 
@@ -1345,7 +1348,7 @@ void GameAssets::DrawBeams(double dT, const GameModel& gameModel, const Camera&
         float invAvgRadiusFract = (1.0f / avgRadiusFraction);
         
         static double timeCounter = 0;
-        timeCounter += 7*dT + 5 * Randomizer::GetInstance()->RandomNumZeroToOne() * dT;
+        timeCounter += 7*dT + 5 * Randomizer::GetPresentationInstance()->RandomNumZeroToOne() * dT;
         Colour keyDiffuseColour = avgRadiusFraction*NumberFuncs::LerpOverFloat(-1.0, 1.0, avgBeamColour, 1.33f*(avgBeamColour + Colour(0.33,0.33,0.33)), sinf(timeCounter));
         Colour fillDiffuseColour = 0.5f*avgRadiusFraction*avgBeamColour;
 
@@ -1492,7 +1495,8 @@ void GameAssets::LoadNewLevelMesh(const GameLevel& currLevel) {
 		this->currentLevelMesh->LoadNewLevel(this->sound, *this->worldAssets, *this->itemAssets, currLevel);
 	}
 	else {
-		this->currentLevelMesh = new LevelMesh(this->sound, *this->worldAssets, *this->itemAssets, currLevel);
+		this->currentLevelMesh = new LevelMesh(this->sound, *this->worldAssets, *this->itemAssets, currLevel,
+            this->drawnModelState);
 	}
     
     // Setup the ball safety net for the new level...
@@ -1511,10 +1515,10 @@ void GameAssets::LoadRegularMeshAssets() {
 		this->spikeyBall = ResourceManager::GetInstance()->GetObjMeshResource(GameViewConstants::GetInstance()->SPIKEY_BALL_MESH);
 	}
 	if (this->rocketMesh == NULL) {
-		this->rocketMesh = new RocketMesh();
+		this->rocketMesh = new RocketMesh(this->drawnModelState);
 	}
     if (this->mineMeshMgr == NULL) {
-        this->mineMeshMgr = new MineMeshManager();
+        this->mineMeshMgr = new MineMeshManager(this->drawnModelState);
     }
 	if (this->paddleBeamAttachment == NULL) {
 		this->paddleBeamAttachment = new PaddleBeamAttachment();
@@ -2100,6 +2104,20 @@ void GameAssets::LoadWorldAssets(const GameWorld& world) {
     this->ReinitializeAssets();
 }
 
+/**
+ * Start streaming in the assets and sounds of the given world in the background (e.g., while the
+ * player is still in a menu) so that LoadWorldAssets and GameSound::LoadWorldSounds only have
+ * to do the work that needs this thread when the world is started.
+ */
+void GameAssets::PrefetchWorldAssets(const GameWorld& world) {
+	if (this->worldAssets != NULL && this->worldAssets->GetStyle() == world.GetStyle()) {
+		return;
+	}
+
+	GameWorldAssets::PrefetchWorldAssets(world.GetStyle());
+	this->sound->PrefetchWorldSounds(world.GetStyle());
+}
+
 void GameAssets::ReinitializeAssets() {
 	this->worldAssets->ResetToInitialState();
 
@@ -89,14 +89,16 @@ class GameFBOAssets;
 class PaddleMineLauncher;
 class PaddleBeamAttachment;
 class PaddleStatusEffectRenderer;
+class GameModelSnapshot;
 
 // Includes all the models, textures, etc. for the game.
 class GameAssets {
 public:
-	GameAssets(int screenWidth, int screenHeight, GameSound* sound);
+	GameAssets(int screenWidth, int screenHeight, GameSound* sound, const GameModelSnapshot& drawnModelState);
 	~GameAssets();
 
 	void LoadWorldAssets(const GameWorld& world);
+	void PrefetchWorldAssets(const GameWorld& world);
 	void Tick(double dT, const GameModel& gameModel);
 
 	// Draw functions ******************************************************************************
@@ -241,6 +243,7 @@ public:
 
 private:
     GameSound* sound; // Sound module for the game
+    const GameModelSnapshot& drawnModelState; // Where the moving parts of the model get drawn (see GameDisplay)
 
 	GameWorldAssets* worldAssets;	    // World-related assets
 	GameESPAssets* espAssets;           // Emitter/Sprite/Particle assets
@@ -44,6 +44,7 @@
 #include "MouseRenderer.h"
 #include "MenuBackgroundRenderer.h"
 #include "GameViewEventManager.h"
+#include "ProfilerOverlay.h"
 
 // Model includes
 #include "../GameModel/GameWorld.h"
@@ -60,18 +61,23 @@ const unsigned long GameDisplay::FRAME_SLEEP_MS	= 1000 / GameDisplay::MAX_FRAMER
 
 bool GameDisplay::arcadeMode = false;
 
+bool GameDisplay::drawProfilerOverlay      = false;
+bool GameDisplay::profilerEnabledByOverlay = false;
+
 GameDisplay::GameDisplay(GameModel* model, GameSound* sound, int initWidth, int initHeight, bool arcadeMode): 
-gameListener(NULL), currState(NULL), mouseRenderer(NULL), menuBGRenderer(NULL), model(model), 
-assets(NULL), sound(sound), gameExited(false), gameReinitialized(false), gameCamera() {
+gameListener(NULL), currState(NULL), mouseRenderer(NULL), menuBGRenderer(NULL), profilerOverlay(NULL), model(model), 
+assets(NULL), sound(sound), gameExited(false), gameReinitialized(false), gameCamera(),
+modelUpdateMode(VariableStepModelUpdates), modelThread(NULL), numModelStepsSeen(0) {
     
     GameDisplay::arcadeMode = arcadeMode;
 
 	assert(model != NULL);
     assert(sound != NULL);
 
-    this->assets = new GameAssets(initWidth, initHeight, this->sound);
+    this->assets = new GameAssets(initWidth, initHeight, this->sound, this->drawnModelSnapshot);
     this->mouseRenderer = new MouseRenderer();
     this->menuBGRenderer = new MenuBackgroundRenderer();
+    this->profilerOverlay = new ProfilerOverlay();
 
 	this->SetupActionListeners();
 	this->SetCurrentState(new MainMenuDisplayState(this));
@@ -82,6 +88,8 @@ assets(NULL), sound(sound), gameExited(false), gameReinitialized(false), gameCam
 }
 
 GameDisplay::~GameDisplay() {
+    // Nothing else can be cleaned up while the model is still being ticked
+    this->SetModelUpdateMode(VariableStepModelUpdates);
 
 	// Delete any current state
 	assert(this->currState != NULL);
@@ -106,6 +114,9 @@ GameDisplay::~GameDisplay() {
     delete this->menuBGRenderer;
     this->menuBGRenderer = NULL;
 
+    delete this->profilerOverlay;
+    this->profilerOverlay = NULL;
+
 	// Delete game assets LAST!! (If you don't do this last
 	// then all the other things being destroyed in this destructor
 	// will try to access the assets that no longer exist).
@@ -113,6 +124,71 @@ GameDisplay::~GameDisplay() {
 	this->assets = NULL;
 }
 
+/**
+ * Set how the game model gets advanced. In threaded mode the model is ticked in fixed steps on its own
+ * thread, so it keeps its pace no matter how long a frame takes (e.g., on a stall in the graphics driver),
+ * and the view draws it interpolated between the last two steps. Must be called with the model unlocked.
+ */
+void GameDisplay::SetModelUpdateMode(const ModelUpdateMode& mode) {
+    this->drawnModelSnapshot.Clear();
+
+    if (mode == ThreadedModelUpdates) {
+        if (this->modelThread == NULL) {
+            this->modelThread = new GameModelThread(this->model);
+        }
+        if (!this->modelThread->Start()) {
+            // The model is ticked by the frames instead
+            delete this->modelThread;
+            this->modelThread = NULL;
+            this->modelUpdateMode = VariableStepModelUpdates;
+            return;
+        }
+        this->numModelStepsSeen = 0;
+    }
+    else if (this->modelThread != NULL) {
+        // Anything that was recorded in the thread's last steps is sent out when it stops
+        this->modelThread->Stop();
+        delete this->modelThread;
+        this->modelThread = NULL;
+    }
+    this->modelUpdateMode = mode;
+}
+
+// Sends out the events raised by the model thread's steps (and deletes what they were waiting on),
+// must be called with the model locked
+void GameDisplay::DispatchModelThreadEvents() {
+    assert(this->modelThread != NULL);
+    PROFILE_SCOPE("GameDisplay::DispatchModelThreadEvents");
+
+    GameEventManager::Instance()->DispatchDeferredEvents();
+    if (this->modelThread->GetNumSteps() != this->numModelStepsSeen) {
+        this->numModelStepsSeen = this->modelThread->GetNumSteps();
+        GameViewEventManager::Instance()->ActionGameModelUpdated();
+    }
+}
+
+/**
+ * Show/hide the frame profiler overlay. Showing it turns on the FrameProfiler if it isn't
+ * already running (e.g., for writing out a profile when the game exits), hiding it only turns
+ * the profiler back off if the overlay was what turned it on.
+ */
+void GameDisplay::ToggleDrawProfilerOverlay() {
+    GameDisplay::drawProfilerOverlay = !GameDisplay::drawProfilerOverlay;
+    if (GameDisplay::drawProfilerOverlay) {
+        GameDisplay::profilerEnabledByOverlay = !FrameProfiler::IsEnabled();
+        FrameProfiler::SetEnabled(true);
+    }
+    else if (GameDisplay::profilerEnabledByOverlay) {
+        FrameProfiler::SetEnabled(false);
+        GameDisplay::profilerEnabledByOverlay = false;
+    }
+}
+
+void GameDisplay::DrawProfilerOverlay() {
+    assert(this->profilerOverlay != NULL);
+    this->profilerOverlay->Draw();
+}
+
 // RENDER FUNCTIONS ****************************************************
 
 void GameDisplay::SetInitialRenderOptions() {
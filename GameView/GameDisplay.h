@@ -34,7 +34,10 @@
 
 #include "../BlammoEngine/BasicIncludes.h"
 #include "../BlammoEngine/Camera.h"
+#include "../BlammoEngine/FrameProfiler.h"
 #include "../GameModel/GameModel.h"
+#include "../GameModel/GameModelSnapshot.h"
+#include "../GameModel/GameModelThread.h"
 #include "../GameSound/GameSound.h"
 
 #include "DisplayState.h"
@@ -46,6 +49,7 @@ class GameSound;
 class GameEventsListener;
 class MouseRenderer;
 class MenuBackgroundRenderer;
+class ProfilerOverlay;
 
 // The main display class, used to execute the main rendering loop
 // and adjust size, etc.
@@ -54,6 +58,13 @@ public:
 	static const int MAX_FRAMERATE;             // The maximum frame rate possible for the game				
 	static const unsigned long FRAME_SLEEP_MS;	// Time to sleep between frames (determined by MAX_FRAMERATE)
 
+    // How the game model is advanced
+    enum ModelUpdateMode {
+        VariableStepModelUpdates,   // The model is ticked once per frame with that frame's time
+        ThreadedModelUpdates        // The model is ticked in fixed steps on its own thread (see GameModelThread) and
+                                    // drawn interpolated between the last two of them
+    };
+
 	GameDisplay(GameModel* model, GameSound* sound, int initWidth, int initHeight, bool arcadeMode);
 	~GameDisplay();
 
@@ -84,6 +95,14 @@ public:
 	void Render(double dT);
     void UpdateModel(double dT);
 
+    void SetModelUpdateMode(const ModelUpdateMode& mode);
+    ModelUpdateMode GetModelUpdateMode() const { return this->modelUpdateMode; }
+
+    // Anything that touches the model (rendering, input) must be done with it locked, the locks do
+    // nothing unless the model is being updated on its own thread
+    void LockModel();
+    void UnlockModel();
+
 	// Functions for setting up different types of render options
 	static void SetInitialRenderOptions();
 
@@ -129,6 +148,12 @@ public:
 
     static bool IsArcadeModeEnabled() { return GameDisplay::arcadeMode; }
 
+    // The profiler overlay is available in every build so that release builds can be measured
+    static void ToggleDrawProfilerOverlay();
+    static bool IsDrawProfilerOverlayOn() {
+        return drawProfilerOverlay;
+    }
+
 #ifdef _DEBUG
 
 	static void ToggleDrawDebugBounds() {
@@ -168,17 +193,28 @@ private:
 
     MouseRenderer* mouseRenderer;
     MenuBackgroundRenderer* menuBGRenderer;
+    ProfilerOverlay* profilerOverlay;
 
 	GameEventsListener* gameListener;
 
+    ModelUpdateMode modelUpdateMode;
+    GameModelThread* modelThread;           // Ticks the model in threaded mode, NULL otherwise
+    unsigned long numModelStepsSeen;        // How many of the model thread's steps the view has been told about
+    GameModelSnapshot drawnModelSnapshot;   // Where the view draws the model between the last two fixed steps (read by the assets)
+
 	bool gameReinitialized;		// Whether or not we should reinitialize the whole game (recreate the window, etc.)
 	bool gameExited;  				// Whether or not the game has been exited
 
     static bool arcadeMode; // Whether arcade mode is enabled or not
+    static bool drawProfilerOverlay;
+    static bool profilerEnabledByOverlay;   // Whether showing the overlay is what turned the FrameProfiler on
 
     GameModel::Difficulty cachedDifficulty; // Bit of a hack - used to cache difficulty for when we need to back it up
                                             // for the tutorial level
 
+    void DispatchModelThreadEvents();
+    void DrawProfilerOverlay();
+
 	// Functions for Action Listeners
 	void SetupActionListeners();
 	void RemoveActionListeners();
@@ -196,18 +232,36 @@ private:
 
 inline void GameDisplay::Render(double dT) {
     // Dilate time if necessary...
+    double timeScale = 1.0;
     if (this->currState->GetType() == DisplayState::InGame || 
         this->currState->GetType() == DisplayState::InGameBossLevel ||
         this->currState->GetType() == DisplayState::InTutorialGame) {
-        dT *= this->model->GetTimeDialationFactor();
+        timeScale = this->model->GetTimeDialationFactor();
+        dT *= timeScale;
+    }
+
+    // When the model is being stepped on its own thread, whatever happened in its steps since the
+    // last frame is heard about first and the model is drawn part way between its last two steps
+    // based on how much time has built up towards the next one
+    if (this->modelThread != NULL) {
+        this->DispatchModelThreadEvents();
+        this->modelThread->SetStepping(this->currState->AllowsGameModelUpdates(), timeScale);
+        if (this->modelThread->HasSnapshots()) {
+            this->drawnModelSnapshot.CaptureInterpolated(*this->model, this->modelThread->GetPreviousSnapshot(),
+                this->modelThread->GetCurrentSnapshot(), this->modelThread->GetInterpolationAlpha());
+        }
     }
 
 	// Render the current state
-	this->currState->RenderFrame(dT);
+    {
+        PROFILE_SCOPE("GameDisplay::RenderFrame");
+        this->currState->RenderFrame(dT);
+    }
+    this->drawnModelSnapshot.Clear();
 	debug_opengl_state();
 
 	// Update the game model
-    if (this->currState->AllowsGameModelUpdates()) {
+    if (this->modelThread == NULL && this->currState->AllowsGameModelUpdates()) {
         this->UpdateModel(dT);
     }
 
@@ -215,15 +269,37 @@ inline void GameDisplay::Render(double dT) {
     this->sound->SetListenerPosition(this->gameCamera);
     this->sound->Tick(dT);
 
-
+    if (GameDisplay::drawProfilerOverlay) {
+        this->DrawProfilerOverlay();
+    }
 }
 
 inline void GameDisplay::UpdateModel(double dT) {
+    // Any ticks other than the model thread's steps break up the run of consecutive snapshots
+    if (this->modelThread != NULL) {
+        this->modelThread->ResetSnapshots();
+    }
+
+    PROFILE_SCOPE("GameDisplay::UpdateModel");
     this->model->Tick(dT);
     this->model->UpdateState();
+    // Any events that were recorded during the update go out together, before the frame is drawn
+    GameEventManager::Instance()->DispatchDeferredEvents();
     GameViewEventManager::Instance()->ActionGameModelUpdated();
 }
 
+inline void GameDisplay::LockModel() {
+    if (this->modelThread != NULL) {
+        this->modelThread->Lock();
+    }
+}
+
+inline void GameDisplay::UnlockModel() {
+    if (this->modelThread != NULL) {
+        this->modelThread->Unlock();
+    }
+}
+
 inline void GameDisplay::ButtonPressed(const GameControl::ActionButton& pressedButton, const GameControl::ActionMagnitude& magnitude) {
 	this->currState->ButtonPressed(pressedButton, magnitude);
 }
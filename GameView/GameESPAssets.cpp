@@ -68,16 +68,19 @@
 #include "../GameModel/PortalSpawnEffectInfo.h"
 #include "../GameModel/GenericEmitterEffectInfo.h"
 #include "../GameModel/EnumGeneralEffectInfo.h"
+#include "../GameModel/GameModelSnapshot.h"
 
 #include "../GameSound/GameSound.h"
 
 #include "../BlammoEngine/Texture.h"
 #include "../BlammoEngine/Plane.h"
+#include "../BlammoEngine/FrameProfiler.h"
 
 #include "../ResourceManager.h"
 #include "../Blammopedia.h"
 
-GameESPAssets::GameESPAssets() : 
+GameESPAssets::GameESPAssets(const GameModelSnapshot& drawnModelState) : 
+drawnModelState(drawnModelState),
 particleFader(1, 0),
 particleBoostFader(ColourRGBA(1.0f, 1.0f, 1.0f, 0.8f), ColourRGBA(0.85f,1.0f,1.0f, 0.0f)),
 particleFireColourFader(ColourRGBA(1.0f, 1.0f, 0.1f, 1.0f), ColourRGBA(0.5f, 0.0f, 0.0f, 0.0f)),
@@ -142,12 +145,12 @@ stickyPaddleBeamGlowSparks2(NULL),
 paddleFlameBlasterOrigin(NULL),
 paddleIceBlasterOrigin(NULL),
 
-explosionRayRotatorCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.5f, ESPParticleRotateEffector::CLOCKWISE),
-explosionRayRotatorCCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.5f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
-smokeRotatorCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
-smokeRotatorCCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
-fastRotatorCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 4.0f, ESPParticleRotateEffector::CLOCKWISE),
-fastRotatorCCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 4.0f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
+explosionRayRotatorCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.5f, ESPParticleRotateEffector::CLOCKWISE),
+explosionRayRotatorCCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.5f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
+smokeRotatorCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
+smokeRotatorCCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
+fastRotatorCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 4.0f, ESPParticleRotateEffector::CLOCKWISE),
+fastRotatorCCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 4.0f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
 loopRotateEffectorCW(90.0f, ESPParticleRotateEffector::CLOCKWISE),
 loopRotateEffectorCCW(90.0f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
 moderateSpdLoopRotateEffectorCW(180.0f, ESPParticleRotateEffector::CLOCKWISE),
@@ -240,6 +243,7 @@ GameESPAssets::~GameESPAssets() {
 }
 
 void GameESPAssets::Update(const GameModel& gameModel) {
+    PROFILE_SCOPE("GameESPAssets::Update");
     this->gravity.SetAcceleration(9.8f*gameModel.GetGravityDir());
 }
 
@@ -710,7 +714,7 @@ void GameESPAssets::AddIceBallESPEffects(const GameBall* ball, std::vector<ESPPo
 		snowFlakeEmitterTrail->SetEmitPosition(Point3D(0, 0, 0));
 		snowFlakeEmitterTrail->AddEffector(&this->particleFader);
 		snowFlakeEmitterTrail->AddEffector(&this->particleMediumGrowth);
-		if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+		if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 			snowFlakeEmitterTrail->AddEffector(&this->smokeRotatorCW);
 		}
 		else {
@@ -2005,7 +2009,7 @@ void GameESPAssets::AddBasicBlockBreakEffect(const LevelPiece& block) {
 	assert(this->bangTextures.size() != 0);
 
 	// Choose a random bang texture
-	unsigned int randomBangTexIndex = Randomizer::GetInstance()->RandomUnsignedInt() % this->bangTextures.size();
+	unsigned int randomBangTexIndex = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->bangTextures.size();
 	Texture2D* randomBangTex = this->bangTextures[randomBangTexIndex];
 	
 	ESPInterval bangLifeInterval		= ESPInterval(0.8f, 1.1f);
@@ -2027,7 +2031,7 @@ void GameESPAssets::AddBasicBlockBreakEffect(const LevelPiece& block) {
 	// Figure out some random proper orientation...
 	// Two base rotations (for variety) : 180 or 0...
 	float baseBangRotation = 0.0f;
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		baseBangRotation = 180.0f;
 	}
 	bangEffect->SetParticleRotation(ESPInterval(baseBangRotation - 10.0f, baseBangRotation + 10.0f));
@@ -2246,7 +2250,7 @@ void GameESPAssets::AddBallSafetyNetDestroyedEffect(const Point2D& pos) {
 	assert(this->bangTextures.size() != 0);
 
 	// Choose a random bang texture
-	unsigned int randomBangTexIndex = Randomizer::GetInstance()->RandomUnsignedInt() % this->bangTextures.size();
+	unsigned int randomBangTexIndex = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->bangTextures.size();
 	Texture2D* randomBangTex = this->bangTextures[randomBangTexIndex];
 	
 	ESPInterval bangLifeInterval		= ESPInterval(1.0f, 1.25f);
@@ -2268,7 +2272,7 @@ void GameESPAssets::AddBallSafetyNetDestroyedEffect(const Point2D& pos) {
 	// Figure out some random proper orientation...
 	// Two base rotations (for variety) : 180 or 0...
 	float baseBangRotation = 0.0f;
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		baseBangRotation = 180.0f;
 	}
 	bangEffect->SetParticleRotation(ESPInterval(baseBangRotation - 10.0f, baseBangRotation + 10.0f));
@@ -2340,7 +2344,7 @@ void GameESPAssets::AddBallExplodedEffect(const GameBall* ball) {
 	// Smokey firey clouds
 	ESPInterval smokeColour(0.3f, 0.8f);
 	for (int i = 0; i < 3; i++) {
-		size_t randomTexIndex = Randomizer::GetInstance()->RandomUnsignedInt() % this->smokeTextures.size();
+		size_t randomTexIndex = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->smokeTextures.size();
 
 		ESPPointEmitter* smokeClouds = new ESPPointEmitter();
 		smokeClouds->SetSpawnDelta(ESPInterval(0.0f));
@@ -2352,11 +2356,11 @@ void GameESPAssets::AddBallExplodedEffect(const GameBall* ball) {
 		smokeClouds->SetParticleAlignment(ESP::ScreenPlaneAligned);
 		smokeClouds->SetEmitPosition(emitCenter);
 		smokeClouds->SetEmitAngleInDegrees(180);
-		smokeClouds->SetParticles(GameESPAssets::NUM_EXPLOSION_SMOKE_PART_PARTICLES, this->smokeTextures[randomTexIndex]);
+		smokeClouds->SetBatchedParticles(GameESPAssets::NUM_EXPLOSION_SMOKE_PART_PARTICLES, this->smokeTextures[randomTexIndex]);
 		smokeClouds->AddEffector(&this->particleLargeGrowth);
 		smokeClouds->AddEffector(&this->particleFireColourFader);
 		
-		if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+		if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 			smokeClouds->AddEffector(&this->smokeRotatorCW);
 		}
 		else {
@@ -2366,7 +2370,7 @@ void GameESPAssets::AddBallExplodedEffect(const GameBall* ball) {
 	}
 
 	// Bang star
-	unsigned int randomBangTexIndex = Randomizer::GetInstance()->RandomUnsignedInt() % this->bangTextures.size();
+	unsigned int randomBangTexIndex = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->bangTextures.size();
 	Texture2D* randomBangTex = this->bangTextures[randomBangTexIndex];
 
 	ESPPointEmitter* bangEffect = new ESPPointEmitter();
@@ -2379,7 +2383,7 @@ void GameESPAssets::AddBallExplodedEffect(const GameBall* ball) {
 	// Figure out some random proper orientation...
 	// Two base rotations (for variety) : 180 or 0...
 	float baseBangRotation = 0.0f;
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		baseBangRotation = 180.0f;
 	}
 	bangEffect->SetParticleRotation(ESPInterval(baseBangRotation - 10.0f, baseBangRotation + 10.0f));
@@ -2437,7 +2441,7 @@ void GameESPAssets::AddBombBlockBreakEffect(const LevelPiece& bomb) {
 	bombExplodeRayEffect->SetParticleAlignment(ESP::ScreenAligned);
 	bombExplodeRayEffect->SetEmitPosition(emitCenter);
 	bombExplodeRayEffect->SetParticles(1, PersistentTextureManager::GetInstance()->GetLoadedTexture(GameViewConstants::GetInstance()->TEXTURE_EXPLOSION_RAYS));
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		bombExplodeRayEffect->AddEffector(&this->explosionRayRotatorCW);
 	}
 	else {
@@ -2488,7 +2492,7 @@ void GameESPAssets::AddBombBlockBreakEffect(const LevelPiece& bomb) {
 
 	// Set the severity of the effect...
 	Onomatoplex::Extremeness severity = Onomatoplex::SUPER_AWESOME;
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		severity = Onomatoplex::UBER;
 	}
 	bombOnoParticle->SetOnomatoplexSound(Onomatoplex::EXPLOSION, severity);
@@ -2609,7 +2613,7 @@ void GameESPAssets::AddInkBlockBreakEffect(const Camera& camera, const LevelPiec
 	assert(this->splatTextures.size() != 0);
 
 	// Choose a random bang texture
-	unsigned int randomSplatTexIndex = Randomizer::GetInstance()->RandomUnsignedInt() % this->splatTextures.size();
+	unsigned int randomSplatTexIndex = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->splatTextures.size();
 	Texture2D* randomSplatTex = this->splatTextures[randomSplatTexIndex];
 
 	// Create an emitter for the splat
@@ -2625,7 +2629,7 @@ void GameESPAssets::AddInkBlockBreakEffect(const Camera& camera, const LevelPiec
 	// Figure out some random proper orientation...
 	// Two base rotations (for variety) : 180 or 0...
 	float baseSplatRotation = 0.0f;
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		baseSplatRotation = 180.0f;
 	}
 	splatEffect->SetParticleRotation(ESPInterval(baseSplatRotation - 10.0f, baseSplatRotation + 10.0f));
@@ -2662,7 +2666,7 @@ void GameESPAssets::AddRegenBlockSpecialBreakEffect(const GameModel& gameModel,
 
     lifeInfoEmitter->AddEffector(&this->particleFader);
     lifeInfoEmitter->AddEffector(&this->gravity);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 	    lifeInfoEmitter->AddEffector(&this->fastRotatorCCW);
     }
     else {
@@ -2719,7 +2723,7 @@ void GameESPAssets::AddFragileCannonBreakEffect(const LevelPiece& block) {
     smashedCannonPieceEmitter->AddEffector(&this->gravity);
     smashedCannonPieceEmitter->AddEffector(&this->particleFader);
     smashedCannonPieceEmitter->AddEffector(
-        Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->moderateSpdLoopRotateEffectorCW : &this->moderateSpdLoopRotateEffectorCCW);
+        Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->moderateSpdLoopRotateEffectorCW : &this->moderateSpdLoopRotateEffectorCCW);
    
     smashedCannonPieceEmitter->AddParticle(new ESPMeshParticle(this->fragileCannonBaseBarMesh));
     smashedCannonPieceEmitter->AddParticle(new ESPMeshParticle(this->fragileCannonBasePostMesh));
@@ -2738,7 +2742,7 @@ void GameESPAssets::AddFragileCannonBreakEffect(const LevelPiece& block) {
     smashedCannonBarrelEmitter->AddEffector(&this->gravity);
     smashedCannonBarrelEmitter->AddEffector(&this->particleFader);
     smashedCannonBarrelEmitter->AddEffector(
-        Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->loopRotateEffectorCW : &this->loopRotateEffectorCCW);
+        Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->loopRotateEffectorCW : &this->loopRotateEffectorCCW);
 
     smashedCannonBarrelEmitter->AddParticle(new ESPMeshParticle(this->fragileCannonBarrelMesh));
 
@@ -2815,7 +2819,7 @@ void GameESPAssets::AddBlockDisintegrationEffect(const LevelPiece& block) {
         ESPInterval(1.0f));
 	smashBitsEffect->AddEffector(&this->gravity);
 	smashBitsEffect->AddEffector(&this->particleFader);
-    smashBitsEffect->SetRandomTextureParticles(2, this->rockTextures);
+    smashBitsEffect->SetBatchedRandomTextureParticles(2, this->rockTextures);
 
     ESPPointEmitter* puffOfSmokeEffect = new ESPPointEmitter();
     puffOfSmokeEffect->SetNumParticleLives(1);
@@ -2829,7 +2833,7 @@ void GameESPAssets::AddBlockDisintegrationEffect(const LevelPiece& block) {
     puffOfSmokeEffect->SetParticleColour(ESPInterval(0.5f), ESPInterval(0.5f), ESPInterval(0.5f), ESPInterval(1.0f));
     puffOfSmokeEffect->AddEffector(&this->particleMediumGrowth);
     puffOfSmokeEffect->AddEffector(&this->particleFader);
-    puffOfSmokeEffect->SetRandomTextureParticles(4, this->smokeTextures);
+    puffOfSmokeEffect->SetBatchedRandomTextureParticles(4, this->smokeTextures);
 
 	this->activeGeneralEmitters.push_back(smashBitsEffect);
     this->activeGeneralEmitters.push_back(puffOfSmokeEffect);
@@ -2857,7 +2861,7 @@ void GameESPAssets::AddIceBitsBreakEffect(const Point2D& pos, float baseSize) {
         ESPInterval(iceColour.B(), 1.0f), ESPInterval(1.0f));
 	snowflakeBitsEffect->AddEffector(&this->particleFader);
 
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		snowflakeBitsEffect->AddEffector(&this->smokeRotatorCCW);
 	}
 	else {
@@ -2892,7 +2896,7 @@ void GameESPAssets::AddIceCubeBreakEffect(const Point2D& pos, float baseSize, co
 	    ESPInterval(0.5f * colour.B(), 0.75f * colour.B()), ESPInterval(0.8f, 1.0f));
 	smashBitsEffect->AddEffector(&this->gravity);
 	smashBitsEffect->AddEffector(&this->particleFader);
-    smashBitsEffect->SetRandomTextureParticles(7, this->rockTextures);
+    smashBitsEffect->SetBatchedRandomTextureParticles(7, this->rockTextures);
 	this->activeGeneralEmitters.push_back(smashBitsEffect);
 
 	// Create an emitter for a single large snowflake
@@ -2959,7 +2963,7 @@ void GameESPAssets::AddIceMeltedByFireEffect(const Point3D& pos, float width, fl
     waterVapourEffect->SetEmitPosition(pos);
 	waterVapourEffect->AddEffector(&this->particleWaterVapourColourFader);
     waterVapourEffect->AddEffector(&this->particleMediumGrowth);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         waterVapourEffect->AddEffector(&this->smokeRotatorCW);
     }
     else {
@@ -3009,7 +3013,7 @@ void GameESPAssets::AddFirePutOutByIceEffect(const Point3D& pos, float width, fl
     puffOfSmokeEffect1->SetEmitPosition(pos);
 	puffOfSmokeEffect1->AddEffector(&this->particleSmokeColourFader);
     puffOfSmokeEffect1->AddEffector(&this->particleLargeGrowth);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         puffOfSmokeEffect1->AddEffector(&this->smokeRotatorCW);
     }
     else {
@@ -3030,7 +3034,7 @@ void GameESPAssets::AddFirePutOutByIceEffect(const Point3D& pos, float width, fl
     puffOfSmokeEffect2->SetEmitPosition(pos);
 	puffOfSmokeEffect2->AddEffector(&this->particleSmokeColourFader);
     puffOfSmokeEffect2->AddEffector(&this->particleMediumGrowth);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         puffOfSmokeEffect2->AddEffector(&this->smokeRotatorCW);
     }
     else {
@@ -3057,7 +3061,7 @@ void GameESPAssets::AddFireballCanceledEffect(const GameBall& ball) {
     fireDisperseEffect1->SetEmitPosition(ball.GetCenterPosition());
     fireDisperseEffect1->AddEffector(&this->particleLargeGrowth);
     fireDisperseEffect1->AddEffector(&this->particleFireColourFader);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         fireDisperseEffect1->AddEffector(&this->smokeRotatorCW);
     }
     else {
@@ -3078,7 +3082,7 @@ void GameESPAssets::AddFireballCanceledEffect(const GameBall& ball) {
     fireDisperseEffect2->SetEmitPosition(ball.GetCenterPosition());
 	fireDisperseEffect2->AddEffector(&this->particleFireColourFader);
     fireDisperseEffect2->AddEffector(&this->particleMediumGrowth);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         fireDisperseEffect2->AddEffector(&this->smokeRotatorCW);
     }
     else {
@@ -3119,7 +3123,7 @@ void GameESPAssets::AddIceballCanceledEffect(const GameBall& ball) {
     iceDisperseEffect1->SetEmitPosition(ball.GetCenterPosition());
     iceDisperseEffect1->AddEffector(&this->particleLargeGrowth);
     iceDisperseEffect1->AddEffector(&this->particleWaterVapourColourFader);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         iceDisperseEffect1->AddEffector(&this->smokeRotatorCW);
     }
     else {
@@ -3140,7 +3144,7 @@ void GameESPAssets::AddIceballCanceledEffect(const GameBall& ball) {
     iceDisperseEffect2->SetEmitPosition(ball.GetCenterPosition());
 	iceDisperseEffect2->AddEffector(&this->particleWaterVapourColourFader);
     iceDisperseEffect2->AddEffector(&this->particleMediumGrowth);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         iceDisperseEffect2->AddEffector(&this->smokeRotatorCW);
     }
     else {
@@ -3185,7 +3189,7 @@ void GameESPAssets::AddFireBlasterCanceledEffect(const PlayerPaddle& paddle) {
     fireDisperseEffect1->SetParticleRotation(ESPInterval(0.0f, 359.9999f));
     fireDisperseEffect1->AddEffector(&this->particleLargeGrowth);
     fireDisperseEffect1->AddEffector(&this->particleFireColourFader);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         fireDisperseEffect1->AddEffector(&this->smokeRotatorCW);
     }
     else {
@@ -3206,7 +3210,7 @@ void GameESPAssets::AddFireBlasterCanceledEffect(const PlayerPaddle& paddle) {
     fireDisperseEffect2->SetEmitPosition(pos);
     fireDisperseEffect2->AddEffector(&this->particleFireColourFader);
     fireDisperseEffect2->AddEffector(&this->particleMediumGrowth);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         fireDisperseEffect2->AddEffector(&this->smokeRotatorCW);
     }
     else {
@@ -3251,7 +3255,7 @@ void GameESPAssets::AddIceBlasterCanceledEffect(const PlayerPaddle& paddle) {
     iceDisperseEffect1->SetParticleRotation(ESPInterval(0.0f, 359.9999f));
     iceDisperseEffect1->AddEffector(&this->particleLargeGrowth);
     iceDisperseEffect1->AddEffector(&this->particleWaterVapourColourFader);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         iceDisperseEffect1->AddEffector(&this->smokeRotatorCW);
     }
     else {
@@ -3272,7 +3276,7 @@ void GameESPAssets::AddIceBlasterCanceledEffect(const PlayerPaddle& paddle) {
     iceDisperseEffect2->SetEmitPosition(pos);
     iceDisperseEffect2->AddEffector(&this->particleWaterVapourColourFader);
     iceDisperseEffect2->AddEffector(&this->particleMediumGrowth);
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         iceDisperseEffect2->AddEffector(&this->smokeRotatorCW);
     }
     else {
@@ -3319,7 +3323,7 @@ void GameESPAssets::AddFireGlobDestroyedEffect(const GameModel& model, const Pro
     fireDisperseEffect->AddEffector(&this->particleMediumGrowth);
     fireDisperseEffect->SetRandomTextureParticles(8, this->smokeTextures);
 
-    size_t randomRockIdx = Randomizer::GetInstance()->RandomUnsignedInt() % this->moltenRockEffects.size();
+    size_t randomRockIdx = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->moltenRockEffects.size();
     ESPPointEmitter* debrisEmitter = new ESPPointEmitter();
     debrisEmitter->SetSpawnDelta(ESPInterval(ESPPointEmitter::ONLY_SPAWN_ONCE));
     debrisEmitter->SetInitialSpd(ESPInterval(3.0f, 5.0f));
@@ -3332,7 +3336,7 @@ void GameESPAssets::AddFireGlobDestroyedEffect(const GameModel& model, const Pro
     debrisEmitter->SetEmitDirection(-projectile.GetVelocityDirection());
     debrisEmitter->AddEffector(&this->gravity);
     debrisEmitter->AddEffector(&this->particleFader);
-    debrisEmitter->AddEffector(Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->moderateSpdLoopRotateEffectorCW : &this->moderateSpdLoopRotateEffectorCCW);
+    debrisEmitter->AddEffector(Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->moderateSpdLoopRotateEffectorCW : &this->moderateSpdLoopRotateEffectorCCW);
     debrisEmitter->SetParticles(3, this->moltenRockEffects[randomRockIdx]);
     debrisEmitter->AddParticles(3, this->moltenRockEffects[(randomRockIdx+1) % this->moltenRockEffects.size()]);
     debrisEmitter->AddParticles(3, this->moltenRockEffects[(randomRockIdx+2) % this->moltenRockEffects.size()]);
@@ -3582,7 +3586,7 @@ void GameESPAssets::AddBasicPaddleHitByProjectileEffect(const PlayerPaddle& padd
 	starEmitter->SetEmitDirection(Vector3D(-projectile.GetVelocityDirection()));
 	starEmitter->SetEmitPosition(worldHitPos);
 
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		starEmitter->AddEffector(&this->explosionRayRotatorCCW);
 	}
 	else {
@@ -3654,7 +3658,7 @@ void GameESPAssets::AddPaddleHitByProjectileEffect(const PlayerPaddle& paddle,
 void GameESPAssets::AddPaddleHitByBeamEffect(const PlayerPaddle& paddle, const BeamSegment& beamSegment) {
    
     // Choose a random bang texture
-    Texture2D* randomBangTex = this->bangTextures[Randomizer::GetInstance()->RandomUnsignedInt() % this->bangTextures.size()];
+    Texture2D* randomBangTex = this->bangTextures[Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->bangTextures.size()];
 
     ESPInterval bangLifeInterval    = ESPInterval(2.25f);
     ESPInterval bangOnoLifeInterval	= ESPInterval(bangLifeInterval.minValue + 0.3f, bangLifeInterval.maxValue + 0.3f);
@@ -3676,7 +3680,7 @@ void GameESPAssets::AddPaddleHitByBeamEffect(const PlayerPaddle& paddle, const B
     // Figure out some random proper orientation...
     // Two base rotations (for variety) : 180 or 0...
     float baseBangRotation = 0.0f;
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         baseBangRotation = 180.0f;
     }
     bangEffect->SetParticleRotation(ESPInterval(baseBangRotation - 10.0f, baseBangRotation + 10.0f));
@@ -3719,7 +3723,7 @@ void GameESPAssets::AddPaddleHitByBeamEffect(const PlayerPaddle& paddle, const B
     starEmitter->SetEmitDirection(Vector3D(-beamSegment.GetBeamSegmentRay().GetUnitDirection()));
     starEmitter->SetEmitPosition(emitCenter);
 
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         starEmitter->AddEffector(&this->explosionRayRotatorCCW);
     }
     else {
@@ -3735,7 +3739,7 @@ void GameESPAssets::AddPaddleHitByBeamEffect(const PlayerPaddle& paddle, const B
 
 void GameESPAssets::AddPaddleHitByBossPartEffect(const PlayerPaddle& paddle, const BossBodyPart& bossPart) {
     // Choose a random bang texture
-    Texture2D* randomBangTex = this->bangTextures[Randomizer::GetInstance()->RandomUnsignedInt() % this->bangTextures.size()];
+    Texture2D* randomBangTex = this->bangTextures[Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->bangTextures.size()];
 
     ESPInterval bangLifeInterval    = ESPInterval(2.25f);
     ESPInterval bangOnoLifeInterval	= ESPInterval(bangLifeInterval.minValue + 0.3f, bangLifeInterval.maxValue + 0.3f);
@@ -3758,7 +3762,7 @@ void GameESPAssets::AddPaddleHitByBossPartEffect(const PlayerPaddle& paddle, con
     // Figure out some random proper orientation...
     // Two base rotations (for variety) : 180 or 0...
     float baseBangRotation = 0.0f;
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         baseBangRotation = 180.0f;
     }
     bangEffect->SetParticleRotation(ESPInterval(baseBangRotation - 10.0f, baseBangRotation + 10.0f));
@@ -3801,7 +3805,7 @@ void GameESPAssets::AddPaddleHitByBossPartEffect(const PlayerPaddle& paddle, con
     starEmitter->SetEmitDirection(Vector3D(-bossPart.GetCollisionVelocity(), 0.0f));
     starEmitter->SetEmitPosition(emitCenter);
 
-    if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+    if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
         starEmitter->AddEffector(&this->explosionRayRotatorCCW);
     }
     else {
@@ -3845,7 +3849,7 @@ void GameESPAssets::AddPaddleFrozeEffect(const PlayerPaddle& paddle) {
     particleClouds->SetEmitPosition(paddlePos);
     particleClouds->AddEffector(&this->iceOriginColourEffector);
     particleClouds->AddEffector(&this->particleLargeGrowth);
-    particleClouds->AddEffector(Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
+    particleClouds->AddEffector(Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
     particleClouds->SetRandomTextureEffectParticles(8, &this->iceBlasterCloudEffect, this->cloudTextures);
 
     this->activeGeneralEmitters.push_back(particleClouds);
@@ -4874,7 +4878,7 @@ void GameESPAssets::AddStarSmashEffect(const Point3D& pos, const Vector3D& dir,
     }
 
     wallStarEmitter->AddEffector(&this->particleFader);
-    wallStarEmitter->SetParticles(3 + (Randomizer::GetInstance()->RandomUnsignedInt() % 3), PersistentTextureManager::GetInstance()->GetLoadedTexture(GameViewConstants::GetInstance()->TEXTURE_STAR));
+    wallStarEmitter->SetParticles(3 + (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 3), PersistentTextureManager::GetInstance()->GetLoadedTexture(GameViewConstants::GetInstance()->TEXTURE_STAR));
 
     this->activeGeneralEmitters.push_back(wallStarEmitter);
     this->activeGeneralEmitters.push_back(wallOnoEffect);
@@ -4925,7 +4929,7 @@ void GameESPAssets::AddGeneralEnumEffect(const EnumGeneralEffectInfo& enumEffect
         case EnumGeneralEffectInfo::FuturismBarrierBlockDisintegrationEffect: {
             this->AddDebrisEffect(0.25f*LevelPiece::PIECE_WIDTH, 0.85f*LevelPiece::PIECE_WIDTH, 0.66f*enumEffect.GetTimeInSecs(), 
                 enumEffect.GetTimeInSecs(), enumEffect.GetPosition(), enumEffect.GetColour(), 1.0f, 
-                Vector3D(enumEffect.GetDirection()), 5 + (Randomizer::GetInstance()->RandomUnsignedInt() % 5));
+                Vector3D(enumEffect.GetDirection()), 5 + (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 5));
             break;
         }
 
@@ -5059,7 +5063,7 @@ void GameESPAssets::AddFireGlobProjectileEffects(const Projectile& projectile) {
     bool result = smokeyTrailEmitter->SetRandomTextureParticles(NUM_SMOKE_PARTICLES_PER_EMITTER, this->smokeTextures);
 	assert(result);
 
-	size_t randomRockIdx = Randomizer::GetInstance()->RandomUnsignedInt() % this->moltenRockEffects.size();
+	size_t randomRockIdx = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->moltenRockEffects.size();
 	ESPPointEmitter* fireRock = new ESPPointEmitter();
 	fireRock->SetSpawnDelta(ESPInterval(ESPEmitter::ONLY_SPAWN_ONCE));
 	fireRock->SetInitialSpd(ESPInterval(0));
@@ -5073,7 +5077,7 @@ void GameESPAssets::AddFireGlobProjectileEffects(const Projectile& projectile) {
 	result = fireRock->SetParticles(1, this->moltenRockEffects[randomRockIdx]);
 	assert(result);
 
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		fireRock->AddEffector(&this->loopRotateEffectorCW);
 	}
 	else {
@@ -5182,7 +5186,7 @@ void GameESPAssets::AddFlameBlastProjectileEffects(const GameModel& gameModel,
     smokeTrail->SetEmitDirection(Vector3D(0, -1, 0));
     smokeTrail->SetParticleAlignment(ESP::ScreenAligned);
     smokeTrail->AddEffector(&this->particleMediumGrowth);
-    smokeTrail->AddEffector(Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCCW : &this->smokeRotatorCW);
+    smokeTrail->AddEffector(Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCCW : &this->smokeRotatorCW);
     smokeTrail->AddEffector(&this->flameBlastSmokeColourFader);
     smokeTrail->SetRandomTextureParticles(10, this->smokeTextures);
 
@@ -5198,7 +5202,7 @@ void GameESPAssets::AddFlameBlastProjectileEffects(const GameModel& gameModel,
     shimmerTrailEmitter->SetEmitPosition(projectilePos);
     shimmerTrailEmitter->AddEffector(&this->particleLargeGrowth);
     shimmerTrailEmitter->AddEffector(&this->particleFader);
-    shimmerTrailEmitter->AddEffector(Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCCW : &this->smokeRotatorCW);
+    shimmerTrailEmitter->AddEffector(Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCCW : &this->smokeRotatorCW);
     shimmerTrailEmitter->SetParticles(10, &this->refractFireEffect);
 
     ProjectileEmitterCollection& emitters = this->activeBlasterProjectileEffects[&projectile];
@@ -5295,7 +5299,7 @@ void GameESPAssets::AddIceBlastProjectileEffects(const GameModel& gameModel, con
     iceCloudTrail->SetParticleAlignment(ESP::ScreenAligned);
     iceCloudTrail->AddEffector(&this->particleMediumShrink);
     iceCloudTrail->AddEffector(&this->iceBallColourFader);
-    iceCloudTrail->AddEffector(Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
+    iceCloudTrail->AddEffector(Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
     iceCloudTrail->SetRandomTextureEffectParticles(18, &this->iceBlasterCloudEffect, this->cloudTextures);
 
     ESPPointEmitter* iceBits = new ESPPointEmitter();
@@ -5318,7 +5322,7 @@ void GameESPAssets::AddIceBlastProjectileEffects(const GameModel& gameModel, con
     iceBits->SetParticleAlignment(ESP::ScreenAligned);
     iceBits->AddEffector(&this->particleShrinkToNothing);
     iceBits->AddEffector(&this->gravity);
-    iceBits->AddEffector(Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
+    iceBits->AddEffector(Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
     iceBits->SetParticles(15, PersistentTextureManager::GetInstance()->GetLoadedTexture(GameViewConstants::GetInstance()->TEXTURE_SPARKLE));
 
     ESPPointEmitter* snowflakeTrail = new ESPPointEmitter();
@@ -5337,7 +5341,7 @@ void GameESPAssets::AddIceBlastProjectileEffects(const GameModel& gameModel, con
         ESPInterval(iceColour.R(), 1.0f), ESPInterval(iceColour.G(), 1.0f), 
         ESPInterval(iceColour.B()), ESPInterval(1.0f));
     snowflakeTrail->AddEffector(&this->particleLargeGrowth);
-    snowflakeTrail->AddEffector(Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCCW : &this->smokeRotatorCW);
+    snowflakeTrail->AddEffector(Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCCW : &this->smokeRotatorCW);
     snowflakeTrail->AddEffector(&this->particleFader);
     snowflakeTrail->SetRandomTextureParticles(10, this->snowflakeTextures);
 
@@ -5765,10 +5769,10 @@ void GameESPAssets::AddLightningBoltESPEffects(const GameModel& gameModel, const
     boltEmitter->SetEmitAngleInDegrees(0);
     boltEmitter->SetRadiusDeviationFromCenter(ESPInterval(0.0f));
     boltEmitter->SetParticleAlignment(ESP::ScreenAlignedGlobalUpVec);
-    boltEmitter->SetParticleRotation(ESPInterval(Randomizer::GetInstance()->RandomTrueOrFalse() ? 180.0f : 0.0f));
+    boltEmitter->SetParticleRotation(ESPInterval(Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? 180.0f : 0.0f));
     boltEmitter->SetEmitPosition(Point3D(0,0,0));
     boltEmitter->SetParticleColour(ESPInterval(0.75f, 1.0f), ESPInterval(0.9f, 1.0f), ESPInterval(1.0f), ESPInterval(1.0f));
-    boltEmitter->SetParticles(1, this->boltTextures[Randomizer::GetInstance()->RandomUnsignedInt() % this->boltTextures.size()]);
+    boltEmitter->SetParticles(1, this->boltTextures[Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->boltTextures.size()]);
 
     // Create the slightly-pulsing-sparkle aura
     ESPPointEmitter* auraEmitter = new ESPPointEmitter();
@@ -5823,7 +5827,7 @@ void GameESPAssets::AddShockOrbESPEffects(const GameModel& gameModel, const Proj
     electricBGEffect->SetEmitPosition(Point3D(0,0,0));
     electricBGEffect->SetParticleRotation(ESPInterval(0.0f, 359.9999f));
     electricBGEffect->SetParticleColour(ESPInterval(1.0f), ESPInterval(1.0f), ESPInterval(1.0f), ESPInterval(1.0f));
-    electricBGEffect->AddEffector(Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->loopRotateEffectorCCW : &this->loopRotateEffectorCW);
+    electricBGEffect->AddEffector(Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->loopRotateEffectorCCW : &this->loopRotateEffectorCW);
     electricBGEffect->SetAnimatedParticles(3, 
         PersistentTextureManager::GetInstance()->GetLoadedTexture(GameViewConstants::GetInstance()->TEXTURE_LIGHTNING_ANIMATION), 64, 64);
 
@@ -5936,7 +5940,7 @@ void GameESPAssets::AddLaserHitPrismBlockEffect(const Point2D& loc) {
 	shinyGlowEmitter->SetEmitPosition(Point3D(loc[0], loc[1], 0.0f));
 	shinyGlowEmitter->SetParticleColour(ESPInterval(0.75f, 0.9f), ESPInterval(1.0f), ESPInterval(1.0f), ESPInterval(1.0f));
 	shinyGlowEmitter->AddEffector(&this->particleMediumShrink);
-	shinyGlowEmitter->AddEffector(Randomizer::GetInstance()->RandomNegativeOrPositive() < 0 ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
+	shinyGlowEmitter->AddEffector(Randomizer::GetPresentationInstance()->RandomNegativeOrPositive() < 0 ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
 	shinyGlowEmitter->SetParticles(1, PersistentTextureManager::GetInstance()->GetLoadedTexture(GameViewConstants::GetInstance()->TEXTURE_CIRCLE_GRADIENT));
 
 	// Create a brief lens-flare effect
@@ -5952,7 +5956,7 @@ void GameESPAssets::AddLaserHitPrismBlockEffect(const Point2D& loc) {
 	lensFlareEmitter->SetParticleColour(ESPInterval(1.0f), ESPInterval(1.0f), ESPInterval(1.0f), ESPInterval(1.0f));
 	lensFlareEmitter->AddEffector(&this->particleFader);
 	lensFlareEmitter->AddEffector(&this->particleLargeGrowth);
-	lensFlareEmitter->AddEffector(Randomizer::GetInstance()->RandomNegativeOrPositive() < 0 ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
+	lensFlareEmitter->AddEffector(Randomizer::GetPresentationInstance()->RandomNegativeOrPositive() < 0 ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
 	lensFlareEmitter->SetParticles(1, PersistentTextureManager::GetInstance()->GetLoadedTexture(GameViewConstants::GetInstance()->TEXTURE_LENSFLARE));
 
 	this->activeGeneralEmitters.push_back(lensFlareEmitter);
@@ -5978,7 +5982,7 @@ void GameESPAssets::AddLaserHitWallEffect(const Point2D& loc) {
 	lensFlareEmitter->SetParticleColour(ESPInterval(1.0f), ESPInterval(1.0f), ESPInterval(1.0f), ESPInterval(1.0f));
 	lensFlareEmitter->AddEffector(&this->particleFader);
 	lensFlareEmitter->AddEffector(&this->particleMediumGrowth);
-	lensFlareEmitter->AddEffector(Randomizer::GetInstance()->RandomNegativeOrPositive() < 0 ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
+	lensFlareEmitter->AddEffector(Randomizer::GetPresentationInstance()->RandomNegativeOrPositive() < 0 ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
 	lensFlareEmitter->SetParticles(1, PersistentTextureManager::GetInstance()->GetLoadedTexture(GameViewConstants::GetInstance()->TEXTURE_LENSFLARE));
 
 	// Create a dispersion of particle bits
@@ -6030,7 +6034,7 @@ void GameESPAssets::AddFlameBlastHitWallEffect(float size, const Point2D& loc, G
     particleClouds->SetEmitPosition(EMITTER_LOCATION);
     particleClouds->AddEffector(&this->particleFireFastColourFader);
     particleClouds->AddEffector(&this->particleMediumGrowth);
-    particleClouds->AddEffector(Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
+    particleClouds->AddEffector(Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
     particleClouds->SetRandomTextureParticles(8, this->smokeTextures);
 
     this->activeGeneralEmitters.push_back(particleClouds);
@@ -6072,7 +6076,7 @@ void GameESPAssets::AddIceBlastHitWallEffect(float size, const Point2D& loc, Gam
     particleClouds->SetEmitPosition(EMITTER_LOCATION);
     particleClouds->AddEffector(&this->iceBallColourFader);
     particleClouds->AddEffector(&this->particleLargeGrowth);
-    particleClouds->AddEffector(Randomizer::GetInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
+    particleClouds->AddEffector(Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? &this->smokeRotatorCW : &this->smokeRotatorCCW);
     particleClouds->SetRandomTextureEffectParticles(8, &this->iceBlasterCloudEffect, this->cloudTextures);
 
     this->activeGeneralEmitters.push_back(particleClouds);
@@ -6317,7 +6321,7 @@ void GameESPAssets::AddPuffOfSmokeEffect(const PuffOfSmokeEffectInfo& info) {
         ESPInterval(info.GetColour().R()), ESPInterval(info.GetColour().G()), ESPInterval(info.GetColour().B()), ESPInterval(1.0f));
     puffOfSmokeEffect->AddEffector(&this->particleMediumGrowth);
     puffOfSmokeEffect->AddEffector(&this->particleFader);
-    puffOfSmokeEffect->SetRandomTextureParticles(8, this->smokeTextures);
+    puffOfSmokeEffect->SetBatchedRandomTextureParticles(8, this->smokeTextures);
 
     this->activeGeneralEmitters.push_back(puffOfSmokeEffect);
 }
@@ -6374,7 +6378,7 @@ void GameESPAssets::AddDebrisEffect(float minSize, float maxSize, float minLife,
 
     debrisBits->AddEffector(&this->gravity);
     debrisBits->AddEffector(&this->particleFader);
-    debrisBits->SetRandomTextureParticles(numParticles, this->rockTextures);
+    debrisBits->SetBatchedRandomTextureParticles(numParticles, this->rockTextures);
 
     this->activeGeneralEmitters.push_back(debrisBits);
 }
@@ -6545,7 +6549,7 @@ void GameESPAssets::AddRocketBlastEffect(float rocketSizeFactor, const Point2D&
 	explodeRayEffect->SetParticleAlignment(ESP::ScreenPlaneAligned);
 	explodeRayEffect->SetEmitPosition(emitCenter);
 	explodeRayEffect->SetParticles(1, PersistentTextureManager::GetInstance()->GetLoadedTexture(GameViewConstants::GetInstance()->TEXTURE_EXPLOSION_RAYS));
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		explodeRayEffect->AddEffector(&this->explosionRayRotatorCW);
 	}
 	else {
@@ -7433,7 +7437,8 @@ void GameESPAssets::SetItemEffect(const GameItem& item, const GameModel& gameMod
  * shmancy type stuffs.
  */
 void GameESPAssets::DrawParticleEffects(double dT, const Camera& camera) {
-	// Go through all the other particles and do book keeping and drawing
+	PROFILE_SCOPE("GameESPAssets::DrawParticleEffects");
+	// Go through all the other particles and do book keeping
 	for (std::list<ESPAbstractEmitter*>::iterator iter = this->activeGeneralEmitters.begin(); iter != this->activeGeneralEmitters.end();) {
 		ESPAbstractEmitter* curr = *iter;
 		assert(curr != NULL);
@@ -7446,17 +7451,23 @@ void GameESPAssets::DrawParticleEffects(double dT, const Camera& camera) {
 		}
 		else {
 			// Not dead yet
-			curr->Tick(dT);
-            curr->Draw(camera);
+			this->emitterTicker.AddEmitter(curr);
 			++iter;
 		}
 	}
+
+	// Tick all of the emitters (spread across threads), then draw them
+	this->emitterTicker.Tick(dT);
+	for (std::list<ESPAbstractEmitter*>::iterator iter = this->activeGeneralEmitters.begin(); iter != this->activeGeneralEmitters.end(); ++iter) {
+		(*iter)->Draw(camera);
+	}
 }
 
 /**
  * Update and draw all projectile effects that are currently active.
  */
 void GameESPAssets::DrawProjectileEffects(double dT, const Camera& camera) {
+	PROFILE_SCOPE("GameESPAssets::DrawProjectileEffects");
 	for (ProjectileEmitterMapIter iter = this->activeProjectileEmitters.begin();
 		 iter != this->activeProjectileEmitters.end(); ++iter) {
 		
@@ -7481,6 +7492,7 @@ void GameESPAssets::DrawProjectileEffects(double dT, const Camera& camera) {
 }
 
 void GameESPAssets::DrawPostProjectileEffects(double dT, const Camera& camera) {
+    PROFILE_SCOPE("GameESPAssets::DrawPostProjectileEffects");
     for (ProjectileEmitterMapIter iter = this->activePostProjectileEmitters.begin();
          iter != this->activePostProjectileEmitters.end(); ++iter) {
 
@@ -7511,9 +7523,10 @@ void GameESPAssets::DrawProjectileEmitter(double dT, const Camera& camera,
 	// In the case where the particle only spawns once, we have a stationary particle that needs to move
 	// to its current position and have an orientation to its current direction
 	bool movesWithProjectile = projectileEmitter->OnlySpawnsOnce();
+    const Point2D projectilePos = this->drawnModelState.GetProjectilePosition(projectile);
 	if (movesWithProjectile) {
 		glPushMatrix();
-		glTranslatef(projectile.GetPosition()[0], projectile.GetPosition()[1], 0.0f);
+		glTranslatef(projectilePos[0], projectilePos[1], 0.0f);
 
 		// If the projectile is not square then we rotate it so that it doesn't look strange in paddle camera mode
 		if (projectileEmitter->GetParticleSizeX() != projectileEmitter->GetParticleSizeY()) {
@@ -7529,7 +7542,7 @@ void GameESPAssets::DrawProjectileEmitter(double dT, const Camera& camera,
 	else if (projectile.GetVelocityMagnitude() != 0) {
 		// We want all the emitting, moving particles attached to the projectile to move with the projectile and
 		// fire opposite its trajectory
-        Point3D emitPos = Point3D(projectile.GetPosition() - projectile.GetHalfHeight() * projectile.GetVelocityDirection(), projectile.GetZOffset());
+        Point3D emitPos = Point3D(projectilePos - projectile.GetHalfHeight() * projectile.GetVelocityDirection(), projectile.GetZOffset());
 		projectileEmitter->SetEmitPosition(emitPos);
 		projectileEmitter->SetEmitDirection(Vector3D(-projectile.GetVelocityDirection()[0], -projectile.GetVelocityDirection()[1], 0.0f));
         projectileEmitter->Tick(dT);
@@ -7537,7 +7550,7 @@ void GameESPAssets::DrawProjectileEmitter(double dT, const Camera& camera,
         projectileEmitter->Draw(camera);   
     }
     else {
-        Point3D emitPos = Point3D(projectile.GetPosition(), projectile.GetZOffset());
+        Point3D emitPos = Point3D(projectilePos, projectile.GetZOffset());
         projectileEmitter->SetEmitPosition(emitPos);
         projectileEmitter->Tick(dT);
         projectileEmitter->SetAliveParticleAlphaMax(projectile.GetAlpha());
@@ -7838,10 +7851,10 @@ void GameESPAssets::DrawUberBallEffects(double dT, const Camera& camera, const G
 	}
 	std::vector<ESPPointEmitter*>& uberBallEffectList = this->ballEffects[&ball][GameItem::UberBallItem];
 
-	Point2D ballPos  = ball.GetBounds().Center();
+	Point2D ballPos  = this->drawnModelState.GetBallPosition(ball);
 
 	glPushMatrix();
-	const Point2D& loc = ball.GetBounds().Center();
+	const Point2D& loc = ballPos;
 	glTranslatef(loc[0], loc[1], 0);
 
 	uberBallEffectList[1]->SetParticleSize(ESPInterval(3.0f*ball.GetBounds().Radius()));
@@ -7875,12 +7888,12 @@ void GameESPAssets::DrawGhostBallEffects(double dT, const Camera& camera, const
 	std::vector<ESPPointEmitter*>& ghostBallEffectList = this->ballEffects[&ball][GameItem::GhostBallItem];
 
 	glPushMatrix();
-	const Point2D& loc = ball.GetBounds().Center();
+	const Point2D loc = this->drawnModelState.GetBallPosition(ball);
 	glTranslatef(loc[0], loc[1], 0);
 
 	// Rotate the negative ball velocity direction by some random amount and then affect the particle's velocities
 	// by it, this gives the impression that the particles are waving around mysteriously (ghostlike... one might say)
-	double randomDegrees = Randomizer::GetInstance()->RandomNumNegOneToOne() * 90;
+	double randomDegrees = Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * 90;
 	const Vector2D& ballDir = ball.GetDirection();
 
 	Vector2D accelVec = Vector2D::Rotate(static_cast<float>(randomDegrees), -ballDir);
@@ -7910,12 +7923,12 @@ void GameESPAssets::DrawFireBallEffects(double dT, const Camera& camera, const G
 	std::vector<ESPPointEmitter*>& fireBallEffectList = this->ballEffects[&ball][GameItem::FireBallItem];
 
 	glPushMatrix();
-	const Point2D& loc = ball.GetBounds().Center();
+	const Point2D loc = this->drawnModelState.GetBallPosition(ball);
 	glTranslatef(loc[0], loc[1], 0);
 
 	// Rotate the negative ball velocity direction by some random amount and then affect the particle's velocities
 	// by it, this gives the impression that the particles are flickering like fire
-	double randomDegrees = Randomizer::GetInstance()->RandomNumNegOneToOne() * 30;
+	double randomDegrees = Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * 30;
 	const Vector2D& ballDir = ball.GetDirection();
 
 	Vector2D accelVec = Vector2D::Rotate(static_cast<float>(randomDegrees), -ballDir);
@@ -7948,7 +7961,7 @@ void GameESPAssets::DrawIceBallEffects(double dT, const Camera& camera, const Ga
 	std::vector<ESPPointEmitter*>& iceBallEffectList = this->ballEffects[&ball][GameItem::IceBallItem];
 	assert(iceBallEffectList.size() >= (3 + this->snowflakeTextures.size()));
 	size_t lastIdx = iceBallEffectList.size()-1;
-	const Point2D& loc  = ball.GetBounds().Center();
+	const Point2D loc  = this->drawnModelState.GetBallPosition(ball);
 	const Vector2D& dir = ball.GetDirection();
 
 	iceBallEffectList[0]->SetParticleSize(ESPInterval(3.0f * ball.GetBounds().Radius()));
@@ -7960,7 +7973,7 @@ void GameESPAssets::DrawIceBallEffects(double dT, const Camera& camera, const Ga
 
 	// Rotate the negative ball velocity direction by some random amount and then affect the particle's velocities
 	// by it, this gives the impression that the particles are flickering like fire
-	double randomDegrees = Randomizer::GetInstance()->RandomNumNegOneToOne() * 20;
+	double randomDegrees = Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * 20;
 	Vector2D accelVec = Vector2D::Rotate(static_cast<float>(randomDegrees), -dir);
 	accelVec = ball.GetSpeed() * 2.75f * accelVec;
 	this->iceBallAccel.SetAcceleration(Vector3D(accelVec, 0.0f));
@@ -8004,7 +8017,7 @@ void GameESPAssets::DrawGravityBallEffects(double dT, const Camera& camera, cons
 	std::vector<ESPPointEmitter*>& gravityBallEffectList = this->ballEffects[&ball][GameItem::GravityBallItem];
 
 	glPushMatrix();
-	const Point2D& loc = ball.GetBounds().Center();
+	const Point2D loc = this->drawnModelState.GetBallPosition(ball);
 	glTranslatef(loc[0], loc[1], 0);
 
 	for (std::vector<ESPPointEmitter*>::iterator iter = gravityBallEffectList.begin();
@@ -8050,7 +8063,7 @@ void GameESPAssets::DrawCrazyBallEffects(double dT, const Camera& camera, const
 	}
 
 	glPushMatrix();
-	const Point2D& loc = ball.GetBounds().Center();
+	const Point2D loc = this->drawnModelState.GetBallPosition(ball);
 	glTranslatef(loc[0], loc[1], 0);
 
 	this->crazyBallAura->SetParticleSize(ESPInterval(2.75f*ball.GetBounds().Radius()));
@@ -8063,7 +8076,7 @@ void GameESPAssets::DrawCrazyBallEffects(double dT, const Camera& camera, const
          iter != crazyBallEffectList.end(); ++iter) {
 
 		ESPPointEmitter* emitter = *iter;
-		emitter->SetEmitPosition(ball.GetCenterPosition());
+		emitter->SetEmitPosition(Point3D(loc, ball.GetCenterPosition()[2]));
 		emitter->SetEmitDirection(-Vector3D(ball.GetDirection()));
 		emitter->Tick(dT);
         emitter->SetAliveParticleAlphaMax(ball.GetAlpha());
@@ -8085,7 +8098,7 @@ void GameESPAssets::DrawSlowBallEffects(double dT, const Camera& camera, const G
 
 	std::vector<ESPPointEmitter*>& slowBallEffectList = this->ballEffects[&ball][GameItem::BallSlowDownItem];
 
-    const Point2D& loc = ball.GetBounds().Center();
+    const Point2D loc = this->drawnModelState.GetBallPosition(ball);
 	glPushMatrix();
 	glTranslatef(loc[0], loc[1], 0);
 
@@ -8133,7 +8146,7 @@ void GameESPAssets::DrawFastBallEffects(double dT, const Camera& camera, const G
 
 	std::vector<ESPPointEmitter*>& fastBallEffectList = this->ballEffects[&ball][GameItem::BallSpeedUpItem];
 
-	const Point2D& loc = ball.GetBounds().Center();
+	const Point2D loc = this->drawnModelState.GetBallPosition(ball);
 	glPushMatrix();
 	glTranslatef(loc[0], loc[1], 0);
 
@@ -8189,8 +8202,8 @@ void GameESPAssets::DrawPaddleCamEffects(double dT, const Camera& camera, const
 	std::vector<ESPPointEmitter*>& paddleCamBallEffectList = this->ballEffects[&ball][GameItem::PaddleCamItem];
 
 	glPushMatrix();
-	const Point2D& ballLoc		= ball.GetBounds().Center();
-	const Point2D& paddleLoc	= paddle.GetCenterPosition();
+	const Point2D ballLoc		= this->drawnModelState.GetBallPosition(ball);
+	const Point2D paddleLoc	    = this->drawnModelState.GetPaddlePosition(paddle);
 	
 	// The only effect so far is a spinning target on the ball...
 	glTranslatef(ballLoc[0], ballLoc[1], 0);
@@ -8229,8 +8242,8 @@ void GameESPAssets::DrawBallCamEffects(double dT, const Camera& camera, const Ga
 	std::vector<ESPPointEmitter*>& ballCamPaddleEffectList = this->paddleEffects[GameItem::BallCamItem];
 
 	glPushMatrix();
-	const Point2D& ballLoc		= ball.GetBounds().Center();
-	const Point2D& paddleLoc	= paddle.GetCenterPosition();
+	const Point2D ballLoc		= this->drawnModelState.GetBallPosition(ball);
+	const Point2D paddleLoc	    = this->drawnModelState.GetPaddlePosition(paddle);
 	
 	// The only effect so far is a spinning target on the paddle...
 	glTranslatef(paddleLoc[0], paddleLoc[1], 0);
@@ -8294,7 +8307,7 @@ void GameESPAssets::DrawBulletTimeBallsBoostEffects(double dT, const Camera& cam
         if (!currBall->IsBallAllowedToBoost()) {
             continue;
         }
-        emitterPos = currBall->GetCenterPosition2D() - (currBall->GetBounds().Radius() * boostDir);
+        emitterPos = this->drawnModelState.GetBallPosition(*currBall) - (currBall->GetBounds().Radius() * boostDir);
 
         glPushMatrix();
         glTranslatef(emitterPos[0], emitterPos[1], 0);
@@ -8311,6 +8324,7 @@ void GameESPAssets::DrawBulletTimeBallsBoostEffects(double dT, const Camera& cam
 }
 
 void GameESPAssets::DrawBallBoostingEffects(double dT, const Camera& camera) {
+    PROFILE_SCOPE("GameESPAssets::DrawBallBoostingEffects");
     for (BallEffectsMapIter iter1 = this->boostBallEmitters.begin(); iter1 != this->boostBallEmitters.end();) {
         const GameBall* currBall = iter1->first;
 
@@ -8337,7 +8351,7 @@ void GameESPAssets::DrawBallBoostingEffects(double dT, const Camera& camera) {
 		    else {
 			    // Not dead yet, update its position based on the current ball's positon
                 // and draw/tick it
-                currEmitter->SetEmitPosition(currBall->GetCenterPosition());
+                currEmitter->SetEmitPosition(Point3D(this->drawnModelState.GetBallPosition(*currBall), currBall->GetCenterPosition()[2]));
                 if (!currBall->GetDirection().IsZero()) {
                     currEmitter->SetEmitDirection(Vector3D(-currBall->GetDirection()));
                 }
@@ -8381,13 +8395,17 @@ void GameESPAssets::DrawBackgroundBallEffects(double dT, const Camera& camera, c
 			iter = ballEmitters.erase(iter);
 		}
 		else {
-			// Not dead yet so we draw and tick
-			curr->Tick(dT);
-            curr->Draw(camera);
+			// Not dead yet so we tick and then draw
+			this->emitterTicker.AddEmitter(curr);
 			++iter;
 		}
 	}
 
+	this->emitterTicker.Tick(dT);
+	for (std::list<ESPEmitter*>::iterator iter = ballEmitters.begin(); iter != ballEmitters.end(); ++iter) {
+		(*iter)->Draw(camera);
+	}
+
 	// If there are no background emitters left for the ball then remove that ball from
 	// the ball background emitter mapping
 	if (tempIter->second.size() == 0) {
@@ -8416,15 +8434,22 @@ void GameESPAssets::DrawBackgroundPaddleEffects(double dT, const Camera& camera,
             curr = NULL;
 		}
 		else {
-            // Not dead yet so we draw and tick
-            curr->Tick(dT);
-            if (paddle.GetAlpha() < 1.0f) {
-                curr->SetAliveParticleAlphaMax(paddle.GetAlpha());
-            }
-            curr->DrawWithAddedTransform(camera, paddleRotMat);
+            // Not dead yet so we tick and then draw
+            this->emitterTicker.AddEmitter(curr);
             ++iter;
 		}
 	}
+
+    this->emitterTicker.Tick(dT);
+	for (std::list<ESPEmitter*>::iterator iter = this->activePaddleEmitters.begin();
+		iter != this->activePaddleEmitters.end(); ++iter) {
+
+        ESPEmitter* curr = *iter;
+        if (paddle.GetAlpha() < 1.0f) {
+            curr->SetAliveParticleAlphaMax(paddle.GetAlpha());
+        }
+        curr->DrawWithAddedTransform(camera, paddleRotMat);
+	}
 }
 
 void GameESPAssets::TickButDontDrawBackgroundPaddleEffects(double dT) {
@@ -8442,10 +8467,11 @@ void GameESPAssets::TickButDontDrawBackgroundPaddleEffects(double dT) {
 		}
 		else {
 			// Not dead yet so we tick
-			curr->Tick(dT);
+			this->emitterTicker.AddEmitter(curr);
             ++iter;
 		}
 	}
+    this->emitterTicker.Tick(dT);
 }
 
 /**
@@ -8514,6 +8540,7 @@ void GameESPAssets::DrawPaddleLaserBeamBeforeFiringEffects(double dT, const Came
 }
 
 void GameESPAssets::DrawTeslaLightningArcs(double dT, const Camera& camera) {
+	PROFILE_SCOPE("GameESPAssets::DrawTeslaLightningArcs");
 
 	for (std::map<std::pair<const TeslaBlock*, const TeslaBlock*>, 
          std::list<ESPPointToPointBeam*> >::iterator iter = this->teslaLightningArcs.begin();
@@ -8532,6 +8559,7 @@ void GameESPAssets::DrawTeslaLightningArcs(double dT, const Camera& camera) {
  * Draw all the beams that are currently active in the game.
  */
 void GameESPAssets::DrawBeamEffects(double dT, const GameModel& gameModel, const Camera& camera) {
+    PROFILE_SCOPE("GameESPAssets::DrawBeamEffects");
 	
     for (std::map<const Beam*, std::list<ESPEmitter*> >::iterator iter = this->activeBeamEmitters.begin();
 		 iter != this->activeBeamEmitters.end(); ++iter) {
@@ -69,6 +69,7 @@ class DebrisEffectInfo;
 class PortalSpawnEffectInfo;
 class GenericEmitterEffectInfo;
 class EnumGeneralEffectInfo;
+class GameModelSnapshot;
 
 /**
  * Stores, draws and changes emitter/sprite/particle assets for the game.
@@ -84,10 +85,18 @@ private:
     typedef std::map<const Projectile*, ProjectileEmitterCollection> ProjectileEmitterMap;
     typedef ProjectileEmitterMap::iterator ProjectileEmitterMapIter;
 
+    // Where the balls, paddle and projectiles that effects follow around are drawn
+    const GameModelSnapshot& drawnModelState;
+
 	// Currently active particle systems
 	std::list<ESPAbstractEmitter*> activeGeneralEmitters;
 	std::list<ESPEmitter*> activePaddleEmitters;
 
+    // Ticks the independent emitters above (general, paddle and ball background emitters) across threads
+    // before they're drawn, the emitters that follow projectiles and balls are positioned while drawing and
+    // so are still ticked as they're drawn
+    ESPParallelTicker emitterTicker;
+
 	std::map<const GameBall*, std::list<ESPEmitter*> > activeBallBGEmitters;
     BallEffectsMap boostBallEmitters;
 	std::map<const GameItem*, std::list<ESPEmitter*> > activeItemDropEmitters;
@@ -337,7 +346,7 @@ private:
     void RemoveProjectileEffectFromMap(const Projectile& projectile, ProjectileEmitterMap& projectileMap);
 
 public:
-	GameESPAssets();
+	GameESPAssets(const GameModelSnapshot& drawnModelState);
 	~GameESPAssets();
 
     void Update(const GameModel& gameModel);
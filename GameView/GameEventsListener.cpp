@@ -145,6 +145,9 @@ void GameEventsListener::WorldStartedEvent(const GameWorld& world) {
     this->display->GetSound()->LoadWorldSounds(world.GetStyle());
 	LoadingScreen::GetInstance()->EndShowingLoadingScreen();
 
+    // Anything streamed in for the world that wasn't used by now won't be
+    ResourceManager::GetInstance()->ClearPrefetchedResources();
+
     debug_output("EVENT: Movement/World started");
 }
 
@@ -1845,13 +1848,13 @@ void GameEventsListener::RemoteControlRocketFuelWarningEvent(const PaddleRemoteC
     // Vibrate the controller a bit to indicate a dying rocket...
     if (rocket.GetCurrentFuelAmount() < 10.0f) {
         GameControllerManager::GetInstance()->VibrateControllers(0.075, 
-            Randomizer::GetInstance()->RandomTrueOrFalse() ? BBBGameController::SoftVibration : BBBGameController::MediumVibration, 
-            Randomizer::GetInstance()->RandomTrueOrFalse() ? BBBGameController::SoftVibration : BBBGameController::MediumVibration);
+            Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? BBBGameController::SoftVibration : BBBGameController::MediumVibration, 
+            Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? BBBGameController::SoftVibration : BBBGameController::MediumVibration);
     }
     else {
         GameControllerManager::GetInstance()->VibrateControllers(0.1, 
-            Randomizer::GetInstance()->RandomTrueOrFalse() ? BBBGameController::SoftVibration : BBBGameController::VerySoftVibration,
-            Randomizer::GetInstance()->RandomTrueOrFalse() ? BBBGameController::SoftVibration : BBBGameController::VerySoftVibration);
+            Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? BBBGameController::SoftVibration : BBBGameController::VerySoftVibration,
+            Randomizer::GetPresentationInstance()->RandomTrueOrFalse() ? BBBGameController::SoftVibration : BBBGameController::VerySoftVibration);
     }
 
 	debug_output("EVENT: Remote controlled rocket warning.");
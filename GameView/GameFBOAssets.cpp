@@ -40,6 +40,7 @@
 #include "../GameModel/GameItem.h"
 
 #include "../GameSound/GameSound.h"
+#include "../BlammoEngine/FrameProfiler.h"
 
 GameFBOAssets::GameFBOAssets(int displayWidth, int displayHeight, GameSound* sound) :
 sound(sound), bgFBO(NULL), fgAndBgFBO(NULL), finalFSEffectFBO(NULL), tempFBO(NULL), colourAndDepthTexFBO(NULL),
@@ -240,6 +241,7 @@ void GameFBOAssets::DeactivateItemEffects(const GameItem& item) {
  * end of the 3D pipeline.
  */
 void GameFBOAssets::RenderFinalFullscreenEffects(int width, int height, double dT, const GameModel& gameModel) {
+    PROFILE_SCOPE("GameFBOAssets::RenderFinalFullscreenEffects");
 	
     this->blurEffect->Tick(dT);
 
@@ -294,6 +294,13 @@ void GameMenu::Draw(double dT, int windowWidth, int windowHeight) {
     Point2D currPosItem      = this->topLeftCorner;
     Point2D currPosIndicator = this->topLeftCorner;
 
+	// The item labels never overlap each other so their text can all be drawn together - unless an item
+	// is activated, it may draw over the other items (e.g., a verify popup)
+	bool isItemTextBatched = !this->isSelectedItemActivated;
+	if (isItemTextBatched) {
+		TextureFontSet::BeginBatch();
+	}
+
 	// Draw the menu items
 	for (size_t i = 0; i < this->menuItems.size(); i++) {
 		GameMenuItem* currItem = this->menuItems[i];
@@ -334,6 +341,10 @@ void GameMenu::Draw(double dT, int windowWidth, int windowHeight) {
 		currPosItem = currPosItem - diff;
         currPosIndicator = currPosIndicator - diff;
 	}
+
+	if (isItemTextBatched) {
+		TextureFontSet::EndBatch();
+	}
 	
 	// If there was a submenu then we draw it (this can lead to a nest of menu/submenus)
 	if (subMenu != NULL) {
@@ -784,6 +795,6 @@ void GameSubMenu::AnimateMenuOpen() {
 	this->menuBGOpenGhostFade.ResetToStart();
 	
 	// Choose a new colour for the menu
-	const int randColourIdx = Randomizer::GetInstance()->RandomUnsignedInt() % GameMenu::NUM_RAND_COLOURS;
+	const int randColourIdx = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % GameMenu::NUM_RAND_COLOURS;
 	this->bgColour = GameMenu::RAND_COLOUR_LIST[randColourIdx];
 }
\ No newline at end of file
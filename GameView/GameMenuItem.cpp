@@ -1095,7 +1095,7 @@ void VerifyMenuItem::Activate() {
     GameMenuItem::Activate();
 
 	// Assign a random colour for the background of the verify menu
-	const int randomColourIdx = (Randomizer::GetInstance()->RandomUnsignedInt() % GameMenu::NUM_RAND_COLOURS);
+	const int randomColourIdx = (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % GameMenu::NUM_RAND_COLOURS);
 	this->randomMenuBGColour = GameMenu::RAND_COLOUR_LIST[randomColourIdx];
 
 	// Setup any animations that occur within the verify menu
@@ -210,6 +210,77 @@ GameWorldAssets* GameWorldAssets::CreateWorldAssets(GameWorld::WorldStyle world,
 	return NULL;
 }
 
+/**
+ * Start streaming in the meshes and textures that CreateWorldAssets will load for the given world
+ * on the resource manager's background threads (these need to be kept in sync with the
+ * resources that each of the world asset classes load).
+ */
+void GameWorldAssets::PrefetchWorldAssets(GameWorld::WorldStyle world) {
+	ResourceManager* resourceMgr = ResourceManager::GetInstance();
+	const GameViewConstants* viewConsts = GameViewConstants::GetInstance();
+
+	// All worlds share the skybox
+	resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_STARFIELD_FG);
+	resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_STARFIELD_BG);
+
+	switch (world) {
+		case GameWorld::Classical:
+			resourceMgr->PrefetchObjMeshResource(viewConsts->CLASSICAL_BACKGROUND_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->CLASSICAL_PADDLE_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->CLASSICAL_BLOCK_MESH);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_CLOUD1);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_CLOUD2);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_CLOUD3);
+			break;
+
+		case GameWorld::GothicRomantic:
+			resourceMgr->PrefetchObjMeshResource(viewConsts->GOTHIC_ROMANTIC_BACKGROUND_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->GOTHIC_ROMANTIC_PADDLE_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->GOTHIC_ROMANTIC_BLOCK_MESH);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_CLOUD1);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_CLOUD2);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_CLOUD3);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_MOON);
+			break;
+
+		case GameWorld::Nouveau:
+			resourceMgr->PrefetchObjMeshResource(viewConsts->NOUVEAU_BACKGROUND_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->NOUVEAU_PADDLE_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->NOUVEAU_BLOCK_MESH);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_CLEAN_CIRCLE_GRADIENT);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_HALO);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_LENSFLARE);
+			break;
+
+		case GameWorld::Deco:
+			resourceMgr->PrefetchObjMeshResource(viewConsts->DECO_BACKGROUND_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->DECO_PADDLE_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->DECO_BLOCK_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->SKYBEAM_MESH);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_SPIRAL_SMALL);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_SPIRAL_MEDIUM);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_SPIRAL_LARGE);
+			break;
+
+		case GameWorld::Futurism:
+			resourceMgr->PrefetchObjMeshResource(viewConsts->FUTURISM_BACKGROUND_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->FUTURISM_PADDLE_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->FUTURISM_BLOCK_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->SKYBEAM_MESH);
+			resourceMgr->PrefetchImgTextureResource(viewConsts->TEXTURE_FUTURISM_TRIANGLE);
+			break;
+
+		case GameWorld::SurrealismDada:
+			resourceMgr->PrefetchObjMeshResource(viewConsts->SURREALISM_DADA_BACKGROUND_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->SURREALISM_DADA_PADDLE_MESH);
+			resourceMgr->PrefetchObjMeshResource(viewConsts->SURREALISM_DADA_BLOCK_MESH);
+			break;
+
+		default:
+			break;
+	}
+}
+
 void GameWorldAssets::UpdateColourChangeList(const std::vector<Colour>& newList) {
     this->colourChangeList = newList;
 
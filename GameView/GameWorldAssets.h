@@ -101,6 +101,7 @@ public:
 
 	// Factory methods
 	static GameWorldAssets* CreateWorldAssets(GameWorld::WorldStyle world, GameAssets* assets);
+	static void PrefetchWorldAssets(GameWorld::WorldStyle world);
 
 protected:
 	static const float COLOUR_CHANGE_TIME;
@@ -268,7 +268,7 @@ void GothicRomanticWorldAssets::ApplyRandomFireAccel(ESPParticleAccelEffector& a
 	
     // Rotate the up direction by some random amount and then affect the fire particle's velocities
 	// by it, this gives the impression that the particles are flickering like fire
-	double randomDegrees = Randomizer::GetInstance()->RandomNumNegOneToOne() * CONE_SIZE_IN_DEGREES;
+	double randomDegrees = Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * CONE_SIZE_IN_DEGREES;
 	Vector2D accelVec = ACCEL_MAG * Vector2D::Rotate(static_cast<float>(randomDegrees), Vector2D(0, 1));
 	accelEffector.SetAcceleration(Vector3D(accelVec, 0.0f));
 }
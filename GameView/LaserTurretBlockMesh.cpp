@@ -33,9 +33,11 @@
 #include "GameViewConstants.h"
 #include "GameFontAssetsManager.h"
 
+#include "../GameModel/GameModelSnapshot.h"
+
 #include "../ResourceManager.h"
 
-LaserTurretBlockMesh::LaserTurretBlockMesh() : TurretBlockMesh(), barrel1Mesh(NULL), barrel2Mesh(NULL), headMesh(NULL) {
+LaserTurretBlockMesh::LaserTurretBlockMesh(const GameModelSnapshot& drawnModelState) : TurretBlockMesh(drawnModelState), barrel1Mesh(NULL), barrel2Mesh(NULL), headMesh(NULL) {
     this->LoadMesh();
 
     std::vector<float> values;
@@ -95,14 +97,13 @@ void LaserTurretBlockMesh::RemoveLaserTurretBlock(const LaserTurretBlock* laserT
 }
 
 void LaserTurretBlockMesh::Draw(double dT, const Camera& camera, const BasicPointLight& keyLight,
-                                const BasicPointLight& fillLight, const BasicPointLight& ballLight) {
+                                const BasicPointLight& fillLight, const BasicPointLight& ballLight,
+                                const Matrix4x4& worldTransform, RenderCommandQueue& queue) {
     if (this->blocks.empty()) {
         return;
     }
 
-    glPushAttrib(GL_CURRENT_BIT);
-
-	// Go through each block and draw the barrels
+	// Go through each block and record the barrels
     for (BlockCollectionConstIter iter = this->blocks.begin(); iter != this->blocks.end(); ++iter) {
 
 		const LaserTurretBlock* currBlock = iter->first;
@@ -115,27 +116,26 @@ void LaserTurretBlockMesh::Draw(double dT, const Camera& camera, const BasicPoin
 
         // Draw any effects for the current block...
         currBlockData->DrawBlockEffects(dT, camera);
-        float invFlashIntensity = 1.0f - currBlockData->GetFlashIntensity();
-        glColor4f(1.0f, invFlashIntensity, invFlashIntensity, 1.0f);
-
-        glRotatef(currBlock->GetRotationDegreesFromX(), 0, 0, 1);
-
-        // Draw moving geometry for the current block...
-        glPushMatrix();
-        glTranslatef(currBlock->GetBarrel1RecoilAmount(), 0, 0);
-        this->barrel1Mesh->Draw(camera, keyLight, fillLight, ballLight);
         glPopMatrix();
 
-        glPushMatrix();
-        glTranslatef(currBlock->GetBarrel2RecoilAmount(), 0, 0);
-        this->barrel2Mesh->Draw(camera, keyLight, fillLight, ballLight);
-        glPopMatrix();
-
-        this->headMesh->Draw(camera, keyLight, fillLight, ballLight);
-        glPopMatrix();
+        float invFlashIntensity = 1.0f - currBlockData->GetFlashIntensity();
+        const float colour[4] = { 1.0f, invFlashIntensity, invFlashIntensity, 1.0f };
+
+        // The moving geometry is only recorded here, so its transforms are built up on the CPU
+        const Matrix4x4 blockTransform = worldTransform *
+            Matrix4x4::translationMatrix(Vector3D(blockCenter[0], blockCenter[1], 0.0f)) *
+            Matrix4x4::rotationZMatrix(this->drawnModelState.GetTurretRotation(*currBlock));
+
+        // Record moving geometry for the current block...
+        this->barrel1Mesh->Record(queue, 0,
+            blockTransform * Matrix4x4::translationMatrix(Vector3D(this->drawnModelState.GetTurretBarrelRecoil(*currBlock, 0), 0, 0)),
+            colour, keyLight, fillLight, ballLight);
+        this->barrel2Mesh->Record(queue, 0,
+            blockTransform * Matrix4x4::translationMatrix(Vector3D(this->drawnModelState.GetTurretBarrelRecoil(*currBlock, 1), 0, 0)),
+            colour, keyLight, fillLight, ballLight);
+
+        this->headMesh->Record(queue, 0, blockTransform, colour, keyLight, fillLight, ballLight);
     }
-
-    glPopAttrib();
 }
 
 void LaserTurretBlockMesh::DrawPostEffects(double dT, const Camera& camera) {
@@ -220,8 +220,8 @@ particleMediumGrowth(1.0f, 1.6f), particleLargeGrowth(1.0f, 2.2f),
 smokeColourFader(ColourRGBA(0.7f, 0.7f, 0.7f, 1.0f), ColourRGBA(0.1f, 0.1f, 0.1f, 0.1f)),
 particleFireColourFader(ColourRGBA(1.0f, 1.0f, 0.1f, 1.0f), ColourRGBA(1.0f, 0.1f, 0.1f, 0.0f)),
 particleFader(1.0f, 0.0f),
-rotateEffectorCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
-rotateEffectorCCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
+rotateEffectorCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
+rotateEffectorCCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
 alpha(1.0f) {
     
     assert(glowTexture != NULL);
@@ -46,7 +46,7 @@
 // level's blocks and draws the interactive parts of them.
 class LaserTurretBlockMesh : public TurretBlockMesh {
 public:
-	LaserTurretBlockMesh();
+	LaserTurretBlockMesh(const GameModelSnapshot& drawnModelState);
 	~LaserTurretBlockMesh();
 
 	void Flush();
@@ -54,7 +54,8 @@ public:
 	void RemoveLaserTurretBlock(const LaserTurretBlock* laserTurretBlock);
 
 	void Draw(double dT, const Camera& camera, const BasicPointLight& keyLight,
-        const BasicPointLight& fillLight, const BasicPointLight& ballLight);
+        const BasicPointLight& fillLight, const BasicPointLight& ballLight,
+        const Matrix4x4& worldTransform, RenderCommandQueue& queue);
     void DrawPostEffects(double dT, const Camera& camera);
 	void SetAlphaMultiplier(float alpha);
 
@@ -31,6 +31,7 @@
 
 #include "LevelCompleteSummaryDisplayState.h"
 #include "GameDisplay.h"
+#include "GameAssets.h"
 #include "GameFontAssetsManager.h"
 #include "GameViewConstants.h"
 #include "MenuBackgroundRenderer.h"
@@ -494,6 +495,13 @@ pointTallySoundID(INVALID_SOUND_ID), firstTimeDisplayingAnyKeyLabel(true) {
         }
     }
 
+    // When this was the last level of the world the player is headed into the next world, start
+    // streaming in its assets while they're looking at their score
+    const GameWorld* currWorld = gameModel->GetCurrentWorld();
+    if (currWorld->IsLastLevel() && !gameModel->IsLastWorld()) {
+        this->display->GetAssets()->PrefetchWorldAssets(*gameModel->GetWorldByIndex(currWorld->GetWorldIndex() + 1));
+    }
+
     GameSound* sound = this->display->GetSound();
     // Play the background music
     this->bgLoopSoundID = sound->PlaySound(GameSound::LevelSummaryBackgroundLoop, true, false);
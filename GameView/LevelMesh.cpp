@@ -64,8 +64,13 @@
 #include "../GameModel/RegenBlock.h"
 #include "../GameModel/OneWayBlock.h"
 #include "../GameModel/TriangleBlocks.h"
+#include "../BlammoEngine/FrameProfiler.h"
 
-LevelMesh::LevelMesh(GameSound* sound, const GameWorldAssets& gameWorldAssets, const GameItemAssets& gameItemAssets, const GameLevel& level) :
+// Keeps the batches small enough that compacting one after a lot of pieces are destroyed stays cheap
+const size_t LevelMesh::NUM_ROWS_PER_BATCH_CHUNK = 8;
+
+LevelMesh::LevelMesh(GameSound* sound, const GameWorldAssets& gameWorldAssets, const GameItemAssets& gameItemAssets, const GameLevel& level,
+                     const GameModelSnapshot& drawnModelState) :
 currLevel(NULL), styleBlock(NULL), basicBlock(NULL), bombBlock(NULL), triangleBlockUR(NULL), inkBlock(NULL), portalBlock(NULL),
 prismBlockDiamond(NULL), prismBlockTriangleRight(NULL), prismBlockTriangleLeft(NULL),
 cannonBlock(NULL), fragileCannonBlock(NULL), collateralBlock(NULL),
@@ -95,9 +100,9 @@ remainingPiecePulser(0,0), bossMesh(NULL), levelAlpha(1.0f) {
 	this->teslaBlock                    = new TeslaBlockMesh();
 	this->itemDropBlock					= new ItemDropBlockMesh();
     this->switchBlock                   = new SwitchBlockMesh();
-    this->laserTurretBlock              = new LaserTurretBlockMesh();
-    this->rocketTurretBlock             = new RocketTurretBlockMesh();
-    this->mineTurretBlock               = new MineTurretBlockMesh();
+    this->laserTurretBlock              = new LaserTurretBlockMesh(drawnModelState);
+    this->rocketTurretBlock             = new RocketTurretBlockMesh(drawnModelState);
+    this->mineTurretBlock               = new MineTurretBlockMesh(drawnModelState);
     this->alwaysDropBlock               = new AlwaysDropBlockMesh();
     this->regenBlock                    = new RegenBlockMesh();
     this->oneWayBlock                   = new OneWayBlockMesh();
@@ -218,29 +223,28 @@ void LevelMesh::Flush() {
 		}
 	}
 	
-	// Delete each of the display lists loaded for the previous level and clear up the
-	// relevant mappings to those display lists.
-	for (std::map<CgFxAbstractMaterialEffect*, std::vector<GLuint> >::iterator iter = this->firstPassDisplayListsPerMaterial.begin();
-		iter != this->firstPassDisplayListsPerMaterial.end(); ++iter) {
+	// Delete each of the geometry batches loaded for the previous level and clear up the
+	// relevant mappings to those batches.
+	for (BatchesPerMaterialMap::iterator iter = this->firstPassBatchesPerMaterial.begin();
+		iter != this->firstPassBatchesPerMaterial.end(); ++iter) {
 		
-		for (std::vector<GLuint>::iterator dispListIter = iter->second.begin(); dispListIter != iter->second.end(); ++dispListIter) {
-			glDeleteLists((*dispListIter), 1);
-			(*dispListIter) = 0;
+		for (std::vector<StaticGeometryBatch*>::iterator batchIter = iter->second.begin(); batchIter != iter->second.end(); ++batchIter) {
+			delete *batchIter;
+			*batchIter = NULL;
 		}
 	}
-	this->firstPassDisplayListsPerMaterial.clear();
-    this->firstPassPieceDisplayLists.clear();
+	this->firstPassBatchesPerMaterial.clear();
 
-    for (std::map<CgFxAbstractMaterialEffect*, std::vector<GLuint> >::iterator iter = this->secondPassDisplayListsPerMaterial.begin();
-        iter != this->secondPassDisplayListsPerMaterial.end(); ++iter) {
+    for (BatchesPerMaterialMap::iterator iter = this->secondPassBatchesPerMaterial.begin();
+        iter != this->secondPassBatchesPerMaterial.end(); ++iter) {
 
-            for (std::vector<GLuint>::iterator dispListIter = iter->second.begin(); dispListIter != iter->second.end(); ++dispListIter) {
-                glDeleteLists((*dispListIter), 1);
-                (*dispListIter) = 0;
-            }
+        for (std::vector<StaticGeometryBatch*>::iterator batchIter = iter->second.begin(); batchIter != iter->second.end(); ++batchIter) {
+            delete *batchIter;
+            *batchIter = NULL;
+        }
     }
-    this->secondPassDisplayListsPerMaterial.clear();
-    this->secondPassPieceDisplayLists.clear();
+    this->secondPassBatchesPerMaterial.clear();
+    this->pieceBatches.clear();
 
 	// Delete all of the emitter effects for any of the level pieces
 	for (std::map<const LevelPiece*, std::list<ESPEmitter*> >::iterator pieceIter = this->pieceEmitterEffects.begin();
@@ -317,18 +321,18 @@ void LevelMesh::LoadNewLevel(GameSound* sound, const GameWorldAssets& gameWorldA
 	Vector2D levelDimensions = Vector2D(level.GetLevelUnitWidth(), level.GetLevelUnitHeight());
 	Vector3D worldTransform(-levelDimensions[0]/2.0f, -levelDimensions[1]/2.0f, 0.0f);
 
-	// Go through each piece and create an appropriate display list for it
+	// Go through each piece and add its geometry to the batches for its materials
 	for (size_t h = 0; h < levelPieces.size(); h++) {
 		for (size_t w = 0; w < levelPieces[h].size(); w++) {
 			
-			// Obtain the current level piece and create a display list for it if necessary
+			// Obtain the current level piece and batch its geometry if necessary
 			LevelPiece* currPiece	= levelPieces[h][w];
 
             // Unlock the blammopedia entry for the piece
             ResourceManager::GetInstance()->GetBlammopedia()->UnlockBlock(currPiece->GetType());
 
-			// Create the appropriate display lists for the piece...
-			this->CreateDisplayListsForPiece(currPiece, worldTransform);
+			// Add the piece to the appropriate geometry batches...
+			this->AddPieceToBatches(currPiece, worldTransform);
 			// Create the emitters/effects for the piece...
 			this->CreateEmitterEffectsForPiece(currPiece, worldTransform);
 
@@ -456,62 +460,13 @@ void LevelMesh::LevelPieceStatusRemoved(const LevelPiece& piece, const LevelPiec
 }
 
 /**
- * Adjust the level mesh to change the given piece.
- * Please note that this can be an EXPENSIVE operation!!
- * (Do not call > 1 per frame!!)
+ * Adjust the level mesh to change the given piece. The old piece's geometry is patched out of
+ * its batches and the new piece's geometry is appended to them.
  */
 void LevelMesh::ChangePiece(const LevelPiece& pieceBefore, const LevelPiece& pieceAfter) {
 
-	// Find the changed piece and change its display list...
-	std::map<const LevelPiece*, std::map<CgFxAbstractMaterialEffect*, GLuint> >::iterator pieceInfoIter =
-        this->firstPassPieceDisplayLists.find(&pieceBefore);
-    
-    bool foundPieceInfo = false;
-    std::map<const LevelPiece*, std::map<CgFxAbstractMaterialEffect*, GLuint> >* displayListMap = NULL;
-    std::map<CgFxAbstractMaterialEffect*, std::vector<GLuint> >* displayListPerMaterialMap = NULL;
-
-    if (pieceInfoIter == this->firstPassPieceDisplayLists.end()) {
-        pieceInfoIter = this->secondPassPieceDisplayLists.find(&pieceBefore);
-        if (pieceInfoIter != this->secondPassPieceDisplayLists.end()) {
-            foundPieceInfo = true;
-            displayListMap = &this->secondPassPieceDisplayLists;
-            displayListPerMaterialMap = &this->secondPassDisplayListsPerMaterial;
-        }
-    }
-    else {
-        foundPieceInfo = true;
-        displayListMap = &this->firstPassPieceDisplayLists;
-        displayListPerMaterialMap = &this->firstPassDisplayListsPerMaterial;
-    }
-
-	if (foundPieceInfo) {
-		
-        // Go through each of the materials and clear up previous display lists and materials...
-		for (std::map<CgFxAbstractMaterialEffect*, GLuint>::iterator iter = pieceInfoIter->second.begin();
-			iter != pieceInfoIter->second.end(); ++iter) {
-			
-			// Delete any previous display list...
-			glDeleteLists(iter->second, 1);
-
-			// ... and remove it from other relevant maps/arrays/etc.
-			std::vector<GLuint>& displayLists = (*displayListPerMaterialMap)[iter->first];
-			for (std::vector<GLuint>::iterator iterDL = displayLists.begin(); iterDL != displayLists.end(); ++iterDL) {
-				if (*iterDL == iter->second)	{
-					displayLists.erase(iterDL);
-					break;
-				}
-			}
-			if (displayLists.size() == 0) {
-				displayListPerMaterialMap->erase(iter->first);
-			}
-
-			// Clean up
-			iter->second = 0;
-		}
-		pieceInfoIter->second.clear();
-		displayListMap->erase(pieceInfoIter);
-	}
-	else {
+	// Take the changed piece out of its batches, this only patches the vertices it held...
+	if (!this->RemovePieceFromBatches(&pieceBefore)) {
         
 		// The piece is a special type that must be handled in a very specific way...
 		switch (pieceBefore.GetType()) {
@@ -531,9 +486,9 @@ void LevelMesh::ChangePiece(const LevelPiece& pieceBefore, const LevelPiece& pie
 		}
 	}
 
-	// Based on the new piece type we re-create a display list
+	// Based on the new piece type we add its geometry back into the batches
 	Vector3D translation(-this->currLevel->GetLevelUnitWidth()/2.0f, -this->currLevel->GetLevelUnitHeight()/2.0f, 0.0f);
-	this->CreateDisplayListsForPiece(&pieceAfter, translation);
+	this->AddPieceToBatches(&pieceAfter, translation);
 
     // Remove any last-remaining-piece special effects as well (if the piece became empty)
     if (pieceAfter.GetType() == LevelPiece::Empty) {
@@ -633,6 +588,7 @@ void LevelMesh::RemovePiece(const LevelPiece& piece) {
 void LevelMesh::DrawFirstPassPieces(const Vector3D& worldTranslation, double dT, const Camera& camera,
                                     const GameModel* gameModel, const BasicPointLight& keyLight, 
                                     const BasicPointLight& fillLight, const BasicPointLight& ballLight) {
+    PROFILE_SCOPE("LevelMesh::DrawFirstPassPieces");
 
     // Draw any 'remaining pieces' effects
 
@@ -640,17 +596,8 @@ void LevelMesh::DrawFirstPassPieces(const Vector3D& worldTranslation, double dT,
     // so that they get hidden by any blocks in front of them
     this->itemDropBlock->DrawEffects(worldTranslation, dT, camera);
 
-	// Go through each material and draw all the display lists corresponding to it
-	CgFxAbstractMaterialEffect* currEffect = NULL;
-	for (std::map<CgFxAbstractMaterialEffect*, std::vector<GLuint> >::const_iterator iter = this->firstPassDisplayListsPerMaterial.begin();
-		iter != this->firstPassDisplayListsPerMaterial.end(); ++iter) {
-		
-		currEffect = iter->first;
-		currEffect->SetKeyLight(keyLight);
-		currEffect->SetFillLight(fillLight);
-		currEffect->SetBallLight(ballLight);
-		currEffect->Draw(camera, iter->second);
-	}
+	// Go through each material and draw all the geometry batches corresponding to it
+	this->DrawBatches(this->firstPassBatchesPerMaterial, camera, keyLight, fillLight, ballLight);
 
 	glPushMatrix();
 	glTranslatef(worldTranslation[0], worldTranslation[1], worldTranslation[2]);
@@ -658,9 +605,16 @@ void LevelMesh::DrawFirstPassPieces(const Vector3D& worldTranslation, double dT,
     this->fragileCannonBlock->Draw(dT, camera, keyLight, fillLight, ballLight);
 	this->collateralBlock->Draw(dT, camera, keyLight, fillLight, ballLight);
     this->switchBlock->Draw(dT, camera, keyLight, fillLight, ballLight);
-    this->laserTurretBlock->Draw(dT, camera, keyLight, fillLight, ballLight);
-    this->rocketTurretBlock->Draw(dT, camera, keyLight, fillLight, ballLight);
-    this->mineTurretBlock->Draw(dT, camera, keyLight, fillLight, ballLight);
+
+    // The turrets only record their moving geometry, relative to the world transform read here once per frame
+    float worldModelView[16];
+    glGetFloatv(GL_MODELVIEW_MATRIX, worldModelView);
+    const Matrix4x4 worldTransform(worldModelView);
+    this->laserTurretBlock->Draw(dT, camera, keyLight, fillLight, ballLight, worldTransform, this->firstPassQueue);
+    this->rocketTurretBlock->Draw(dT, camera, keyLight, fillLight, ballLight, worldTransform, this->firstPassQueue);
+    this->mineTurretBlock->Draw(dT, camera, keyLight, fillLight, ballLight, worldTransform, this->firstPassQueue);
+    this->firstPassQueue.Execute(this->renderBackend, camera);
+
     this->regenBlock->Draw(dT, camera, gameModel, keyLight, fillLight, ballLight);
     this->itemDropBlock->DrawBloomPass(dT, camera, keyLight, fillLight, ballLight);
     this->alwaysDropBlock->DrawBloomPass(dT, camera, keyLight, fillLight, ballLight);
@@ -695,17 +649,8 @@ void LevelMesh::DrawSecondPassPieces(double dT, const Camera& camera, const Game
     this->portalBlock->SetSceneTexture(sceneTexture);
     this->portalBlock->Tick(dT);
 
-    // Draw all of the second pass display lists
-    CgFxAbstractMaterialEffect* currEffect = NULL;
-    for (std::map<CgFxAbstractMaterialEffect*, std::vector<GLuint> >::const_iterator iter = this->secondPassDisplayListsPerMaterial.begin();
-         iter != this->secondPassDisplayListsPerMaterial.end(); ++iter) {
-
-        currEffect = iter->first;
-        currEffect->SetKeyLight(keyLight);
-        currEffect->SetFillLight(fillLight);
-        currEffect->SetBallLight(ballLight);
-        currEffect->Draw(camera, iter->second);
-    }
+    // Draw all of the second pass geometry batches
+    this->DrawBatches(this->secondPassBatchesPerMaterial, camera, keyLight, fillLight, ballLight);
 
     ESPEmitter* emitter = NULL;
     for (std::map<const LevelPiece*, std::list<ESPEmitter*> >::iterator pieceIter = this->pieceEmitterEffects.begin();
@@ -734,19 +679,37 @@ void LevelMesh::DrawTransparentNoBloomPieces(double dT, const Camera& camera, co
 }
 
 /**
- * Private helper function that will create the appropriate display lists for drawing the given piece
- * at the given translation in the world.
+ * Private helper function that adds the geometry for drawing the given piece at the given translation
+ * in the world to the batch of each of its materials.
  */
-void LevelMesh::CreateDisplayListsForPiece(const LevelPiece* piece, const Vector3D &worldTranslation) {
+void LevelMesh::AddPieceToBatches(const LevelPiece* piece, const Vector3D &worldTranslation) {
 	assert(piece != NULL);
 	const std::map<std::string, MaterialGroup*>* pieceMatGrps = this->GetMaterialGrpsForPieceType(piece);
 	if (pieceMatGrps == NULL) {
 		return;
 	}
 
-	glPushAttrib(GL_CURRENT_BIT);
+	// Based on the type of block we decide whether this is a first or second pass piece
+	BatchesPerMaterialMap* batchesPerMaterial = &this->firstPassBatchesPerMaterial;
+	switch (piece->GetType()) {
+		case LevelPiece::Portal:
+		case LevelPiece::Prism:
+		case LevelPiece::PrismTriangle:
+			batchesPerMaterial = &this->secondPassBatchesPerMaterial;
+			break;
+		default:
+			break;
+	}
+
+	Matrix4x4 worldTransform = Matrix4x4::translationMatrix(worldTranslation);
+	Matrix4x4 localTransform = piece->GetPieceToLevelTransform();
+	Matrix4x4 fullTransform  = worldTransform * localTransform;
+	const ColourRGBA& currColour = piece->GetColour();
+	size_t chunkIdx = piece->GetHeightIndex() / NUM_ROWS_PER_BATCH_CHUNK;
+
+	std::vector<StaticGeometryBatch*>& currPieceBatches = this->pieceBatches[piece];
 
-	// Go through each of the material groups ensuring that the material is associated with an appropriate display list
+	// Go through each of the material groups and add the piece's geometry to that material's batch for its chunk
 	for (std::map<std::string, MaterialGroup*>::const_iterator iter = pieceMatGrps->begin(); iter != pieceMatGrps->end(); ++iter) {
 		
 		// Make sure that the material exists in our set of available level materials
@@ -754,64 +717,70 @@ void LevelMesh::CreateDisplayListsForPiece(const LevelPiece* piece, const Vector
 		assert(currMaterialIter != this->levelMaterials.end());
 
 		CgFxAbstractMaterialEffect* currMaterial = currMaterialIter->second;
-		PolygonGroup* currPolyGrp        = iter->second->GetPolygonGroup();
-		const ColourRGBA& currColour     = piece->GetColour();
+		const PolygonGroup* currPolyGrp = iter->second->GetPolygonGroup();
 
 		assert(currMaterial != NULL);
 		assert(currPolyGrp != NULL);
 
-		// Transform the polygon group to its position in the level, draw it and then transform it back
-		Matrix4x4 worldTransform = Matrix4x4::translationMatrix(worldTranslation);
-		Matrix4x4 localTransform = piece->GetPieceToLevelTransform();
-		Matrix4x4 fullTransform =  worldTransform * localTransform;
-		
-		GLuint newDisplayList = glGenLists(1);
-		assert(newDisplayList != 0);
+		std::vector<StaticGeometryBatch*>& materialBatches = (*batchesPerMaterial)[currMaterial];
+		if (materialBatches.size() <= chunkIdx) {
+			materialBatches.resize(chunkIdx + 1, NULL);
+		}
+		if (materialBatches[chunkIdx] == NULL) {
+			materialBatches[chunkIdx] = new StaticGeometryBatch();
+		}
 
-		currPolyGrp->TransformVerticesAndNormals(fullTransform);
+		StaticGeometryBatch* currBatch = materialBatches[chunkIdx];
+		currBatch->AddGeometry(piece, *currPolyGrp, fullTransform, currColour);
+		currPieceBatches.push_back(currBatch);
+	}
+}
 
-		glNewList(newDisplayList, GL_COMPILE);
-		glColor4f(currColour.R(), currColour.G(), currColour.B(), currColour.A());
-		currPolyGrp->Draw();
-		glEndList();
-		
-		Matrix4x4 localInvTransform = piece->GetPieceToLevelInvTransform();
-		Matrix4x4 worldInvTransform = Matrix4x4::translationMatrix(-worldTranslation);
-		Matrix4x4 fullInvTransform = localInvTransform * worldInvTransform;
-		
-		currPolyGrp->TransformVerticesAndNormals(fullInvTransform);
-	
-		// Insert the new display list into the list of display lists...
-        
-        // Based on the type of block we decide whether this is a first or second pass piece
-        std::map<const LevelPiece*, std::map<CgFxAbstractMaterialEffect*, GLuint> >* pieceDisplayListMap = &this->firstPassPieceDisplayLists;
-        std::map<CgFxAbstractMaterialEffect*, std::vector<GLuint> >* displayListsPerMaterialMap = &this->firstPassDisplayListsPerMaterial;
-        switch (piece->GetType()) {
-            
-            case LevelPiece::Portal:
-            case LevelPiece::Prism:
-                pieceDisplayListMap = &this->secondPassPieceDisplayLists;
-                displayListsPerMaterialMap = &this->secondPassDisplayListsPerMaterial;
-                break;
+/**
+ * Private helper function that removes the geometry of the given piece from all of the batches it's in.
+ * Returns: true if the piece had any batched geometry, false otherwise.
+ */
+bool LevelMesh::RemovePieceFromBatches(const LevelPiece* piece) {
+	std::map<const LevelPiece*, std::vector<StaticGeometryBatch*> >::iterator findIter = this->pieceBatches.find(piece);
+	if (findIter == this->pieceBatches.end()) {
+		return false;
+	}
 
-            case LevelPiece::PrismTriangle: {
-                pieceDisplayListMap = &this->secondPassPieceDisplayLists;
-                displayListsPerMaterialMap = &this->secondPassDisplayListsPerMaterial;
-                break;
-            }
+	std::vector<StaticGeometryBatch*>& batches = findIter->second;
+	for (std::vector<StaticGeometryBatch*>::iterator iter = batches.begin(); iter != batches.end(); ++iter) {
+		bool wasRemoved = (*iter)->RemoveGeometry(piece);
+		assert(wasRemoved);
+		UNUSED_VARIABLE(wasRemoved);
+	}
 
-            default:
-                break;
-        }
+	bool hadGeometry = !batches.empty();
+	this->pieceBatches.erase(findIter);
+	return hadGeometry;
+}
 
-		std::map<CgFxAbstractMaterialEffect*, GLuint>& currPieceMatMap = (*pieceDisplayListMap)[piece];
-        currPieceMatMap.insert(std::make_pair(currMaterial, newDisplayList));
+/**
+ * Private helper function for drawing every batch with its material, any changes to the batches
+ * are sent to the GPU first.
+ */
+void LevelMesh::DrawBatches(BatchesPerMaterialMap& batchesPerMaterial, const Camera& camera, const BasicPointLight& keyLight,
+							const BasicPointLight& fillLight, const BasicPointLight& ballLight) {
+
+	CgFxAbstractMaterialEffect* currEffect = NULL;
+	for (BatchesPerMaterialMap::iterator iter = batchesPerMaterial.begin(); iter != batchesPerMaterial.end(); ++iter) {
 		
-        std::vector<GLuint>& currDisplayListVec = (*displayListsPerMaterialMap)[currMaterial];
-        currDisplayListVec.push_back(newDisplayList);
-	}
+		std::vector<StaticGeometryBatch*>& batches = iter->second;
+		for (std::vector<StaticGeometryBatch*>::iterator batchIter = batches.begin(); batchIter != batches.end(); ++batchIter) {
+			if (*batchIter != NULL) {
+				(*batchIter)->UpdateBuffer();
+			}
+		}
 
-	glPopAttrib();
+		currEffect = iter->first;
+		currEffect->SetKeyLight(keyLight);
+		currEffect->SetFillLight(fillLight);
+		currEffect->SetBallLight(ballLight);
+		currEffect->Draw(camera, batches);
+	}
 }
 
 /**
@@ -1035,13 +1004,13 @@ void LevelMesh::SetLevelAlpha(float alpha) {
     this->levelAlpha = alpha;
 
 	// First go through each stored material effect and change its alpha multiplier
-	std::map<CgFxAbstractMaterialEffect*, std::vector<GLuint> >::iterator iter = this->firstPassDisplayListsPerMaterial.begin();
-	for (; iter != this->firstPassDisplayListsPerMaterial.end(); ++iter) {
+	BatchesPerMaterialMap::iterator iter = this->firstPassBatchesPerMaterial.begin();
+	for (; iter != this->firstPassBatchesPerMaterial.end(); ++iter) {
 		CgFxAbstractMaterialEffect* currMatEffect = iter->first;
         currMatEffect->SetAlphaMultiplier(alpha);
 	}
-    iter = this->secondPassDisplayListsPerMaterial.begin();
-    for (; iter != this->secondPassDisplayListsPerMaterial.end(); ++iter) {
+    iter = this->secondPassBatchesPerMaterial.begin();
+    for (; iter != this->secondPassBatchesPerMaterial.end(); ++iter) {
         CgFxAbstractMaterialEffect* currMatEffect = iter->first;
         currMatEffect->SetAlphaMultiplier(alpha);
     }
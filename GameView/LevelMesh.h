@@ -44,6 +44,8 @@
 #include "BossMesh.h"
 
 #include "../BlammoEngine/CgFxEffect.h"
+#include "../BlammoEngine/StaticGeometryBatch.h"
+#include "../BlammoEngine/RenderCommandQueue.h"
 #include "../BlammoEngine/ObjReader.h"
 #include "../BlammoEngine/Light.h"
 
@@ -57,6 +59,7 @@
 #include "../GameModel/MineTurretBlock.h"
 
 class GameWorldAssets;
+class GameModelSnapshot;
 class Mesh;
 class PrismBlockMesh;
 class PortalBlockMesh;
@@ -76,7 +79,8 @@ class GameAssets;
 
 class LevelMesh {
 public:
-	LevelMesh(GameSound* sound, const GameWorldAssets& gameWorldAssets, const GameItemAssets& gameItemAssets, const GameLevel& level);
+	LevelMesh(GameSound* sound, const GameWorldAssets& gameWorldAssets, const GameItemAssets& gameItemAssets, const GameLevel& level,
+        const GameModelSnapshot& drawnModelState);
 	~LevelMesh();
 	
 	void ChangePiece(const LevelPiece& pieceBefore, const LevelPiece& pieceAfter);
@@ -172,12 +176,18 @@ private:
 	// The unique identifiers of, and associated materials of the level piece meshes
 	std::map<std::string, CgFxAbstractMaterialEffect*> levelMaterials;
 
-	// Which display lists correspond to a given material
-	std::map<CgFxAbstractMaterialEffect*, std::vector<GLuint> > firstPassDisplayListsPerMaterial;
-    std::map<CgFxAbstractMaterialEffect*, std::vector<GLuint> > secondPassDisplayListsPerMaterial;
-	// The display lists associated with each level piece
-	std::map<const LevelPiece*, std::map<CgFxAbstractMaterialEffect*, GLuint> > firstPassPieceDisplayLists;
-    std::map<const LevelPiece*, std::map<CgFxAbstractMaterialEffect*, GLuint> > secondPassPieceDisplayLists;
+	// The level piece geometry is merged into one batch per material for every chunk of
+	// NUM_ROWS_PER_BATCH_CHUNK rows in the level (indexed by chunk, NULL where a chunk has none)
+	static const size_t NUM_ROWS_PER_BATCH_CHUNK;
+	typedef std::map<CgFxAbstractMaterialEffect*, std::vector<StaticGeometryBatch*> > BatchesPerMaterialMap;
+	BatchesPerMaterialMap firstPassBatchesPerMaterial;
+	BatchesPerMaterialMap secondPassBatchesPerMaterial;
+	// The moving geometry of every turret in the level is recorded into this queue during the first
+	// pass and then drawn all at once, so that each material is only set up once per frame
+	RenderCommandQueue firstPassQueue;
+	CgFxRenderBackend renderBackend;
+	// The batches that hold the geometry of each level piece
+	std::map<const LevelPiece*, std::vector<StaticGeometryBatch*> > pieceBatches;
 	// Special effects always present for specific level pieces
 	std::map<const LevelPiece*, std::list<ESPEmitter*> > pieceEmitterEffects;
     // Effects for the last couple of pieces left in the level, to highlight them for the player
@@ -189,7 +199,10 @@ private:
     float levelAlpha;
         
 	const std::map<std::string, MaterialGroup*>* GetMaterialGrpsForPieceType(const LevelPiece* piece) const;
-	void CreateDisplayListsForPiece(const LevelPiece* piece, const Vector3D &worldTranslation);
+	void AddPieceToBatches(const LevelPiece* piece, const Vector3D &worldTranslation);
+	bool RemovePieceFromBatches(const LevelPiece* piece);
+	void DrawBatches(BatchesPerMaterialMap& batchesPerMaterial, const Camera& camera, const BasicPointLight& keyLight,
+		const BasicPointLight& fillLight, const BasicPointLight& ballLight);
 	void CreateEmitterEffectsForPiece(const LevelPiece* piece, const Vector3D &worldTranslation);
 	void CreateDisplayListForBallSafetyNet(float levelWidth);
 	void Flush();	
@@ -157,7 +157,7 @@ void LivesLeftHUD::LivesGained(int numLives) {
 		this->elementCurrAnimationTypes[i] = LivesLeftHUD::CreationAnimation;
 
 		// Reset the idle animation for the gained life elements
-		double midTimeValue =  1.25 + Randomizer::GetInstance()->RandomNumZeroToOne();
+		double midTimeValue =  1.25 + Randomizer::GetPresentationInstance()->RandomNumZeroToOne();
 		std::vector<double> timeValues(3);
 		timeValues[0] = 0.0;
 		timeValues[1] = midTimeValue;
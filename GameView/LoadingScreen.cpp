@@ -86,7 +86,7 @@ numExpectedUpdates(0), numCallsToUpdate(0), starryBG(NULL) {
     this->absurdLoadingDescriptions.push_back("Adhering to reasonably consistent art style ...");
     this->absurdLoadingDescriptions.push_back("Transfixing art movements ...");
 
-	this->lastRandomAbsurdity = Randomizer::GetInstance()->RandomUnsignedInt() % this->absurdLoadingDescriptions.size();
+	this->lastRandomAbsurdity = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->absurdLoadingDescriptions.size();
 
 }
 
@@ -832,7 +832,7 @@ void MainMenuDisplayState::RenderBackgroundEffects(double dT, Camera& menuCam) {
  */
 void MainMenuDisplayState::InsertBangEffectIntoBGEffects(float minX, float maxX, float minY, float maxY, float minZ, float maxZ) {
 	// Choose a random bang texture
-	unsigned int randomBangTexIndex = Randomizer::GetInstance()->RandomUnsignedInt() % this->bangTextures.size();
+	unsigned int randomBangTexIndex = Randomizer::GetPresentationInstance()->RandomUnsignedInt() % this->bangTextures.size();
 	Texture2D* randomBangTex = static_cast<Texture2D*>(this->bangTextures[randomBangTexIndex]);
 	
 	// Establish some of the values we will use to create the emitter for a 'BANG!" effect
@@ -864,7 +864,7 @@ void MainMenuDisplayState::InsertBangEffectIntoBGEffects(float minX, float maxX,
 	// Figure out some random proper orientation...
 	// Two base rotations (for variety) : 180 or 0...
 	float baseBangRotation = 0.0f;
-	if (Randomizer::GetInstance()->RandomUnsignedInt() % 2 == 0) {
+	if (Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 2 == 0) {
 		baseBangRotation = 180.0f;
 	}
 	bangEffect->SetParticleRotation(ESPInterval(baseBangRotation - 10.0f, baseBangRotation + 10.0f));
@@ -34,8 +34,9 @@
 
 #include "../GameModel/PaddleMineProjectile.h"
 #include "../GameModel/PlayerPaddle.h"
+#include "../GameModel/GameModelSnapshot.h"
 
-MineMeshManager::MineMeshManager() : mineMesh(NULL), trailTexture(NULL), pulseTexture(NULL),
+MineMeshManager::MineMeshManager(const GameModelSnapshot& drawnModelState) : drawnModelState(drawnModelState), mineMesh(NULL), trailTexture(NULL), pulseTexture(NULL),
 timeSinceLastMineLaunch(0.0) {
     
     this->mineMesh = ResourceManager::GetInstance()->GetObjMeshResource(GameViewConstants::GetInstance()->MINE_MESH);
@@ -189,7 +190,7 @@ MineMeshManager::MineInstance::~MineInstance() {
 void MineMeshManager::MineInstance::Draw(double dT, const Camera& camera, const BasicPointLight& keyLight,
                                          const BasicPointLight& fillLight, const BasicPointLight& ballLight) {
 
-    const Point2D& position = this->mine->GetPosition();
+    const Point2D position = this->manager->drawnModelState.GetProjectilePosition(*this->mine);
 
     if (!this->mine->GetIsInvisible()) {
 
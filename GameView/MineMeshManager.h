@@ -41,10 +41,11 @@
 
 class MineProjectile;
 class PlayerPaddle;
+class GameModelSnapshot;
 
 class MineMeshManager {
 public:
-    MineMeshManager();
+    MineMeshManager(const GameModelSnapshot& drawnModelState);
     ~MineMeshManager();
 
     void Draw(double dT, const Camera& camera, const BasicPointLight& keyLight,
@@ -56,6 +57,7 @@ public:
     void RemoveMineProjectile(const MineProjectile* mine);
 
 private:
+    const GameModelSnapshot& drawnModelState; // Where the mines are drawn
     Mesh* mineMesh;
 
     // Assets and emitters for each mine
@@ -47,7 +47,7 @@
 class MineTurretBlockMesh : public TurretBlockMesh {
 
 public:
-	MineTurretBlockMesh();
+	MineTurretBlockMesh(const GameModelSnapshot& drawnModelState);
 	~MineTurretBlockMesh();
 
 	void Flush();
@@ -55,7 +55,8 @@ public:
 	void RemoveMineTurretBlock(const MineTurretBlock* mineTurretBlock);
 
 	void Draw(double dT, const Camera& camera, const BasicPointLight& keyLight,
-        const BasicPointLight& fillLight, const BasicPointLight& ballLight);
+        const BasicPointLight& fillLight, const BasicPointLight& ballLight,
+        const Matrix4x4& worldTransform, RenderCommandQueue& queue);
     void DrawPostEffects(double dT, const Camera& camera);
 	void SetAlphaMultiplier(float alpha);
 
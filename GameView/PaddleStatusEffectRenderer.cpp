@@ -212,13 +212,13 @@ void PaddleStatusEffectRenderer::ToggleFrozen(const PlayerPaddle& paddle, bool i
         timeVals.reserve(10);
         timeVals.push_back(0.0);
         for (int i = 1; i < NUM_SHAKE_VALS; i++) {
-            timeVals.push_back(timeVals.back() + 0.02 + 0.03*Randomizer::GetInstance()->RandomNumZeroToOne());
+            timeVals.push_back(timeVals.back() + 0.02 + 0.03*Randomizer::GetPresentationInstance()->RandomNumZeroToOne());
         }
         std::vector<float> shakeVals;
         shakeVals.reserve(timeVals.size());
         float neg = 1.0f;
         for (int i = 0; i < NUM_SHAKE_VALS; i++) {
-            shakeVals.push_back(neg *(0.075f + Randomizer::GetInstance()->RandomNumZeroToOne() * 0.01f * paddle.GetHalfWidthTotal()));
+            shakeVals.push_back(neg *(0.075f + Randomizer::GetPresentationInstance()->RandomNumZeroToOne() * 0.01f * paddle.GetHalfWidthTotal()));
             neg = -neg;
         }
 
@@ -357,8 +357,8 @@ void PaddleStatusEffectRenderer::Draw(double dT, const Camera& camera,
     // Check to see if the paddle is currently on fire
     if (paddle.HasSpecialStatus(PlayerPaddle::OnFireStatus)) {
 
-        Vector2D accelVec = Vector2D::Rotate(static_cast<float>(Randomizer::GetInstance()->RandomNumNegOneToOne() * 45), Vector2D(0,1));
-        accelVec *= Randomizer::GetInstance()->RandomNumZeroToOne()*20.0f;
+        Vector2D accelVec = Vector2D::Rotate(static_cast<float>(Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * 45), Vector2D(0,1));
+        accelVec *= Randomizer::GetPresentationInstance()->RandomNumZeroToOne()*20.0f;
         this->fireAccel.SetAcceleration(Vector3D(accelVec, 0.0f));
 
         // Flash the fire colours in the fire status material
@@ -159,6 +159,10 @@ void PointsHUD::Draw(const Camera& camera, int displayWidth, int displayHeight,
 
     // Draw the multiplier gage
     this->multiplierGage->Draw(displayWidth - SCREEN_EDGE_HORIZONTAL_GAP, displayHeight - SCREEN_EDGE_VERTICAL_GAP, dT);
+
+    // The multiplier and score text is drawn together, on top of the gage and the multiplier's bang
+    TextureFontSet::BeginBatch();
+
     // Draw the multiplier
     this->multiplier->Draw(displayWidth - SCREEN_EDGE_HORIZONTAL_GAP - 20, displayHeight - SCREEN_EDGE_VERTICAL_GAP - 15, dT);
 
@@ -172,6 +176,8 @@ void PointsHUD::Draw(const Camera& camera, int displayWidth, int displayHeight,
         displayHeight - SCREEN_EDGE_VERTICAL_GAP - 20);
     this->ptScoreLabel->Draw();
 
+    TextureFontSet::EndBatch();
+
     // Draw the current star score
     Point2D starStartPos = this->GetStarStartPos(displayWidth);
     this->DrawIdleStars(camera, starStartPos[0], starStartPos[1], dT);
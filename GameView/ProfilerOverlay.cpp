@@ -0,0 +1,95 @@
+/**
+ * ProfilerOverlay.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ProfilerOverlay.h"
+#include "GameFontAssetsManager.h"
+#include "GameDisplay.h"
+
+#include "../BlammoEngine/Camera.h"
+
+static const float OVERLAY_BORDER = 10.0f;
+static const int INDENT_PER_DEPTH = 2;
+
+ProfilerOverlay::ProfilerOverlay() :
+lineLabel(GameFontAssetsManager::GetInstance()->GetFont(GameFontAssetsManager::AllPurpose, GameFontAssetsManager::Small), "") {
+    this->lineLabel.SetColour(Colour(1.0f, 1.0f, 0.0f));
+    this->lineLabel.SetDropShadow(Colour(0, 0, 0), 0.1f);
+    this->lineLabel.SetScale(0.75f * GameDisplay::GetTextScalingFactor());
+}
+
+ProfilerOverlay::~ProfilerOverlay() {
+}
+
+void ProfilerOverlay::Draw() {
+    if (!FrameProfiler::IsEnabled()) {
+        return;
+    }
+
+    FrameProfiler::GetFrameEntries(this->entries);
+
+    std::stringstream lineStream;
+    lineStream.setf(std::ios::fixed, std::ios::floatfield);
+    lineStream.precision(2);
+
+    float currY = Camera::GetWindowHeight() - OVERLAY_BORDER;
+
+    double frameTimeInSecs = FrameProfiler::GetLastFrameTimeInSecs();
+    lineStream << "Frame: " << frameTimeInSecs * 1000.0 << " ms";
+    if (frameTimeInSecs > 0.0) {
+        lineStream << " (" << static_cast<int>(1.0 / frameTimeInSecs + 0.5) << " fps)";
+    }
+    this->DrawLine(lineStream.str(), currY);
+    this->DrawLine("Scope: frame / avg / max (ms)", currY);
+
+    for (size_t i = 0; i < this->entries.size(); i++) {
+        const FrameProfiler::FrameEntry& entry = this->entries[i];
+
+        lineStream.str("");
+        lineStream << std::string(INDENT_PER_DEPTH * entry.depth, ' ');
+        if (entry.threadIdx != 0) {
+            lineStream << "[" << entry.threadIdx << "] ";
+        }
+        lineStream << entry.name;
+        if (entry.numCalls > 1) {
+            lineStream << " x" << entry.numCalls;
+        }
+        lineStream << ": " << entry.frameTimeInSecs * 1000.0 << " / " << entry.avgTimeInSecs * 1000.0
+                   << " / " << entry.maxTimeInSecs * 1000.0;
+        this->DrawLine(lineStream.str(), currY);
+    }
+}
+
+void ProfilerOverlay::DrawLine(const std::string& text, float& currY) {
+    this->lineLabel.SetText(text);
+    this->lineLabel.SetTopLeftCorner(OVERLAY_BORDER, currY);
+    this->lineLabel.Draw();
+    currY -= this->lineLabel.GetHeight();
+}
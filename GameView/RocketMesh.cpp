@@ -38,10 +38,11 @@
 #include "../ESPEngine/ESPPointEmitter.h"
 
 #include "../GameModel/PaddleRocketProjectile.h"
+#include "../GameModel/GameModelSnapshot.h"
 #include "../GameModel/PaddleRemoteControlRocketProjectile.h"
 #include "../GameModel/PlayerPaddle.h"
 
-RocketMesh::RocketMesh() : 
+RocketMesh::RocketMesh(const GameModelSnapshot& drawnModelState) : drawnModelState(drawnModelState),
 paddleRocketMesh(NULL), paddleRemoteControlRocketMesh(NULL), turretRocketMesh(NULL), sparkTex(NULL),
 rocketGlowEmitter(NULL), rocketThrustBurstEmitter(NULL), pulseEffector(0,0), particleFader(1, 0),
 rocketThrustHyperBurnEmitter(NULL), cloudNormalTex(NULL),
@@ -396,7 +397,7 @@ void RocketMesh::DrawBasicRocket(const RocketProjectile* rocket, Mesh* rocketMes
     float currZRotation = Trig::radiansToDegrees(-M_PI_DIV2 + atan2(rocketDir[1], rocketDir[0]));
     this->rocketGlowEmitter->SetParticleRotation(ESPInterval(-currZRotation));
 
-    const Point2D& rocketPos = rocket->GetPosition();
+    const Point2D rocketPos = this->drawnModelState.GetProjectilePosition(*rocket);
 
     glPushMatrix();
     glTranslatef(rocketPos[0], rocketPos[1], rocket->GetZOffset());
@@ -435,7 +436,7 @@ void RocketMesh::DrawRemoteControlRocket(const PaddleRemoteControlRocketProjecti
     float currZRotation = Trig::radiansToDegrees(-M_PI_DIV2 + atan2(rocketDir[1], rocketDir[0]));
     this->rocketGlowEmitter->SetParticleRotation(ESPInterval(-currZRotation));
 
-    const Point2D& rocketPos = rocket->GetPosition();
+    const Point2D rocketPos = this->drawnModelState.GetProjectilePosition(*rocket);
     float scaleFactor = rocket->GetVisualScaleFactor();
 
     glPushMatrix();
@@ -515,7 +516,7 @@ void RocketMesh::TickAndDrawExtraneousRocketEffects(const RocketProjectile* rock
     switch (rocket->GetType()) {
 
         case Projectile::PaddleRemoteCtrlRocketBulletProjectile: {
-            const Point2D& rocketPos = rocket->GetPosition();
+            const Point2D rocketPos = this->drawnModelState.GetProjectilePosition(*rocket);
 
             glPushMatrix();
             glTranslatef(rocketPos[0], rocketPos[1], rocket->GetZOffset());
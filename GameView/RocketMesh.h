@@ -46,13 +46,14 @@ class PlayerPaddle;
 class ESPPointEmitter;
 class Texture2D;
 class PaddleRemoteControlRocketProjectile;
+class GameModelSnapshot;
 
 /**
  * Class that holds and draws the various rocket bullet meshes.
  */
 class RocketMesh {
 public:
-	RocketMesh();
+	RocketMesh(const GameModelSnapshot& drawnModelState);
 	~RocketMesh();
 
 	void ActivateRocket(const RocketProjectile* rocketProjectile);
@@ -66,6 +67,7 @@ public:
     void ResetRemoteControlRocketEmitters();
 
 private:
+    const GameModelSnapshot& drawnModelState; // Where the rockets are drawn
 	ESPParticleScaleEffector pulseEffector;
 	Texture2D* glowTex;
 	ESPPointEmitter* rocketGlowEmitter;
@@ -34,10 +34,11 @@
 #include "GameFontAssetsManager.h"
 
 #include "../GameModel/RocketTurretProjectile.h"
+#include "../GameModel/GameModelSnapshot.h"
 
 #include "../ResourceManager.h"
 
-RocketTurretBlockMesh::RocketTurretBlockMesh() : TurretBlockMesh(), barrelMesh(NULL), headMesh(NULL), rocketMesh(NULL) {
+RocketTurretBlockMesh::RocketTurretBlockMesh(const GameModelSnapshot& drawnModelState) : TurretBlockMesh(drawnModelState), barrelMesh(NULL), headMesh(NULL), rocketMesh(NULL) {
     this->LoadMesh();
 
     std::vector<float> values;
@@ -98,15 +99,14 @@ void RocketTurretBlockMesh::RemoveRocketTurretBlock(const RocketTurretBlock* roc
 }
 
 void RocketTurretBlockMesh::Draw(double dT, const Camera& camera, const BasicPointLight& keyLight,
-                                 const BasicPointLight& fillLight, const BasicPointLight& ballLight) {
+                                 const BasicPointLight& fillLight, const BasicPointLight& ballLight,
+                                 const Matrix4x4& worldTransform, RenderCommandQueue& queue) {
 
     if (this->blocks.empty()) {
         return;
     }
 
-    glPushAttrib(GL_CURRENT_BIT);
-
-	// Go through each block and draw the barrels
+	// Go through each block and record the barrels
     for (BlockCollectionConstIter iter = this->blocks.begin(); iter != this->blocks.end(); ++iter) {
 
 		const RocketTurretBlock* currBlock = iter->first;
@@ -119,32 +119,32 @@ void RocketTurretBlockMesh::Draw(double dT, const Camera& camera, const BasicPoi
 
         // Draw any effects for the current block...
         currBlockData->DrawBlockEffects(dT, camera);
+        glPopMatrix();
+
         float invFlashIntensity = 1.0f - currBlockData->GetFlashIntensity();
-        glColor4f(1.0f, invFlashIntensity, invFlashIntensity, 1.0f);
+        const float colour[4] = { 1.0f, invFlashIntensity, invFlashIntensity, 1.0f };
 
-        glRotatef(currBlock->GetRotationDegreesFromX(), 0, 0, 1);
+        // The moving geometry is only recorded here, so its transforms are built up on the CPU
+        const Matrix4x4 blockTransform = worldTransform *
+            Matrix4x4::translationMatrix(Vector3D(blockCenter[0], blockCenter[1], 0.0f)) *
+            Matrix4x4::rotationZMatrix(this->drawnModelState.GetTurretRotation(*currBlock));
 
-        // Draw the rocket geometry in the block...
+        // Record the rocket geometry in the block...
         if (currBlock->HasRocketLoaded()) {
-            glPushMatrix();
-            glTranslatef(currBlock->GetRocketTranslationFromCenter(), 0, RocketTurretBlock::BARREL_OFFSET_EXTENT_ALONG_Z);
-            glRotatef(-90, 0, 0, 1);
-            this->rocketMesh->Draw(camera, keyLight, fillLight, ballLight);
-            glPopMatrix();
+            this->rocketMesh->Record(queue, 0, blockTransform *
+                Matrix4x4::translationMatrix(Vector3D(currBlock->GetRocketTranslationFromCenter(), 0,
+                                                      RocketTurretBlock::BARREL_OFFSET_EXTENT_ALONG_Z)) *
+                Matrix4x4::rotationZMatrix(-90), colour, keyLight, fillLight, ballLight);
         }
 
-        // Draw moving geometry for the current block...
-        glPushMatrix();
-        glTranslatef(currBlock->GetBarrelRecoilAmount(), 0, 0);
-        this->barrelMesh->Draw(camera, keyLight, fillLight, ballLight);
-        glPopMatrix();
+        // Record moving geometry for the current block...
+        this->barrelMesh->Record(queue, 0,
+            blockTransform * Matrix4x4::translationMatrix(Vector3D(this->drawnModelState.GetTurretBarrelRecoil(*currBlock, 0), 0, 0)),
+            colour, keyLight, fillLight, ballLight);
 
-        this->headMesh->Draw(camera, keyLight, fillLight, ballLight);
-        glPopMatrix();
+        this->headMesh->Record(queue, 0, blockTransform, colour, keyLight, fillLight, ballLight);
     }
 
-    glPopAttrib();
-
 }
 
 void RocketTurretBlockMesh::DrawPostEffects(double dT, const Camera& camera) {
@@ -227,8 +227,8 @@ emoteLabel(new TextLabel2D(GameFontAssetsManager::GetInstance()->GetFont(GameFon
 particleMediumGrowth(1.0f, 1.6f), particleLargeGrowth(1.0f, 2.2f),
 smokeColourFader(ColourRGBA(0.7f, 0.7f, 0.7f, 1.0f), ColourRGBA(0.1f, 0.1f, 0.1f, 0.1f)),
 particleFireColourFader(ColourRGBA(1.0f, 1.0f, 0.1f, 1.0f), ColourRGBA(1.0f, 0.1f, 0.1f, 0.0f)),
-rotateEffectorCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
-rotateEffectorCCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
+rotateEffectorCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
+rotateEffectorCCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
 alpha(1.0f) {
     
     assert(glowTexture != NULL);
@@ -46,7 +46,7 @@
 // level's blocks and draws the interactive parts of them.
 class RocketTurretBlockMesh : public TurretBlockMesh {
 public:
-	RocketTurretBlockMesh();
+	RocketTurretBlockMesh(const GameModelSnapshot& drawnModelState);
 	~RocketTurretBlockMesh();
 
 	void Flush();
@@ -54,7 +54,8 @@ public:
 	void RemoveRocketTurretBlock(const RocketTurretBlock* rocketTurretBlock);
 
 	void Draw(double dT, const Camera& camera, const BasicPointLight& keyLight,
-        const BasicPointLight& fillLight, const BasicPointLight& ballLight);
+        const BasicPointLight& fillLight, const BasicPointLight& ballLight,
+        const Matrix4x4& worldTransform, RenderCommandQueue& queue);
     void DrawPostEffects(double dT, const Camera& camera);
 	void SetAlphaMultiplier(float alpha);
 
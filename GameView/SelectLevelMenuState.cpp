@@ -59,8 +59,8 @@ selectionAlphaOrangeAnim(0.0f), selectionAlphaYellowAnim(0.0f), selectionBorderA
 particleFader(1, 0), particleMediumGrowth(1.0f, 2.0f), particleSuperGrowth(1.0f, 10.0f), particleSmallGrowth(1.0f, 1.3f),
 lockBreakGravityEffector(Vector3D(0, -125, 0)),
 particleFireFastColourFader(ColourRGBA(1.0f, 1.0f, 0.1f, 0.8f), ColourRGBA(0.5f, 0.0f, 0.0f, 0.0f)), levelWasUnlockedViaStarCost(false),
-smokeRotatorCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE), 
-smokeRotatorCCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
+smokeRotatorCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE), 
+smokeRotatorCCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE),
 fiveStarFGSparkleEmitter(NULL), fiveStarBGGlowEmitter(NULL) {
 
     if (this->bgSoundLoopID == INVALID_SOUND_ID) {
@@ -1708,14 +1708,14 @@ void SelectLevelMenuState::AbstractLevelMenuItem::ExecuteUnlockStarsPaidForAnima
         std::vector<float> rotVals(timeVals.size());
         rotVals[0] = 0.0f;
 
-        int sign = Randomizer::GetInstance()->RandomNegativeOrPositive();
+        int sign = Randomizer::GetPresentationInstance()->RandomNegativeOrPositive();
         for (int i = 0; i < NUM_ROTS-1; i++) {
 
-            double randomIntervalTime = MIN_INTERVAL_TIME + 0.1 * Randomizer::GetInstance()->RandomNumZeroToOne(); 
+            double randomIntervalTime = MIN_INTERVAL_TIME + 0.1 * Randomizer::GetPresentationInstance()->RandomNumZeroToOne(); 
             timeVals[2*i+1] = timeVals[2*i]   + randomIntervalTime;
             timeVals[2*i+2] = timeVals[2*i+1] + randomIntervalTime;
             
-            float currRot = sign * Randomizer::GetInstance()->RandomNumZeroToOne() * 20.0f;
+            float currRot = sign * Randomizer::GetPresentationInstance()->RandomNumZeroToOne() * 20.0f;
             rotVals[2*i+1]   = currRot;
             rotVals[2*i+2] = currRot;
             sign *= -1;
@@ -1739,10 +1739,10 @@ void SelectLevelMenuState::AbstractLevelMenuItem::ExecuteUnlockStarsPaidForAnima
         timeVals[0] = 0.0;
         shakeVals[0] = Vector2D(0,0);
         for (int i = 1; i <= NUM_SHAKES; i++) {
-            timeVals[i] = timeVals[i-1] + 0.01 + 0.015*Randomizer::GetInstance()->RandomNumZeroToOne();
+            timeVals[i] = timeVals[i-1] + 0.01 + 0.015*Randomizer::GetPresentationInstance()->RandomNumZeroToOne();
             shakeVals[i] = Vector2D(
-                Randomizer::GetInstance()->RandomNegativeOrPositive() * MAX_MOVE_PERCENT * (0.005f + Randomizer::GetInstance()->RandomNumZeroToOne()), 
-                Randomizer::GetInstance()->RandomNegativeOrPositive() * MAX_MOVE_PERCENT * (0.005f + Randomizer::GetInstance()->RandomNumZeroToOne()));
+                Randomizer::GetPresentationInstance()->RandomNegativeOrPositive() * MAX_MOVE_PERCENT * (0.005f + Randomizer::GetPresentationInstance()->RandomNumZeroToOne()), 
+                Randomizer::GetPresentationInstance()->RandomNegativeOrPositive() * MAX_MOVE_PERCENT * (0.005f + Randomizer::GetPresentationInstance()->RandomNumZeroToOne()));
         }
         
         this->lockShakeTranslateAnim->SetLerp(timeVals, shakeVals);
@@ -34,6 +34,7 @@
 #include "KeyboardHelperLabel.h"
 #include "GameFontAssetsManager.h"
 #include "GameDisplay.h"
+#include "GameAssets.h"
 #include "GameViewConstants.h"
 #include "MenuBackgroundRenderer.h"
 #include "GameViewEventManager.h"
@@ -482,6 +483,7 @@ void SelectWorldMenuState::MoveToNextWorld() {
     this->selectedItemIdx += 1;
     this->selectedItemIdx %= this->worldItems.size();
     this->worldItems[this->selectedItemIdx]->SetIsSelected(true);
+    this->PrefetchSelectedWorld();
 
     this->display->GetSound()->PlaySound(GameSound::WorldMenuItemChangedSelectionEvent, false);
 }
@@ -493,10 +495,26 @@ void SelectWorldMenuState::MoveToPrevWorld() {
         this->selectedItemIdx = this->worldItems.size()-1;
     }
     this->worldItems[this->selectedItemIdx]->SetIsSelected(true);
+    this->PrefetchSelectedWorld();
 
     this->display->GetSound()->PlaySound(GameSound::WorldMenuItemChangedSelectionEvent, false);
 }
 
+/**
+ * Start streaming in the selected world's assets in the background so that they're ready (or at least
+ * well on their way) by the time the player picks a level in it.
+ */
+void SelectWorldMenuState::PrefetchSelectedWorld() {
+    // Only one world's assets are ever kept around, drop whatever was streamed for the previous selection
+    ResourceManager::GetInstance()->ClearPrefetchedResources();
+
+    const WorldSelectItem* selectedItem = this->worldItems[this->selectedItemIdx];
+    if (selectedItem->GetIsLocked()) {
+        return;
+    }
+    this->display->GetAssets()->PrefetchWorldAssets(*selectedItem->GetWorld());
+}
+
 void SelectWorldMenuState::GoIntoWorld() {
     static const float ANIMATION_TIME_S = 0.5;
 
@@ -679,6 +697,7 @@ void SelectWorldMenuState::Init(const DisplayStateInfo& info) {
         this->worldUnlockAnim = new WorldUnlockAnimationTracker(this, this->worldItems[this->selectedItemIdx+1]);
     }
     this->worldItems[this->selectedItemIdx]->SetIsSelected(true);
+    this->PrefetchSelectedWorld();
 
     GameViewEventManager::Instance()->ActionArcadeWaitingForPlayerState(true);
 }
@@ -693,8 +712,8 @@ countdownWaitToShake(0.75), countdownWaitToEnergySuck(0.75), sparkleTex(NULL), d
 lensFlareTex(NULL), hugeExplosionTex(NULL), sphereNormalsTex(NULL), particleFader(1, 0), particleHalfFader(1, 0.5f), 
 particleMediumGrowth(1.0f, 2.0f), particleMediumShrink(1.0f, 0.25f), particleSmallGrowth(1.0f, 1.5f), unlockAnimExecuted(false),
 particleSuperGrowth(1.0f, 10.0f), particleFireFastColourFader(ColourRGBA(1.0f, 1.0f, 0.1f, 0.8f), ColourRGBA(0.5f, 0.0f, 0.0f, 0.0f)),
-smokeRotatorCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
-smokeRotatorCCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE) {
+smokeRotatorCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::CLOCKWISE),
+smokeRotatorCCW(Randomizer::GetPresentationInstance()->RandomUnsignedInt() % 360, 0.25f, ESPParticleRotateEffector::COUNTER_CLOCKWISE) {
 
     assert(worldItem != NULL);
 
@@ -903,8 +922,8 @@ smokeRotatorCCW(Randomizer::GetInstance()->RandomUnsignedInt() % 360, 0.25f, ESP
     timeVals.push_back(0.0);
     shakeVals.push_back(Vector2D(0.0f, 0.0f));
     for (int i = 1; i < NUM_SHAKES; i++) {
-        timeVals.push_back(timeVals.back() + 0.005 + 0.01f * Randomizer::GetInstance()->RandomNumZeroToOne());
-        shakeVals.push_back(Vector2D(Randomizer::GetInstance()->RandomNumNegOneToOne() * SHAKE_AMT, Randomizer::GetInstance()->RandomNumNegOneToOne() * SHAKE_AMT));
+        timeVals.push_back(timeVals.back() + 0.005 + 0.01f * Randomizer::GetPresentationInstance()->RandomNumZeroToOne());
+        shakeVals.push_back(Vector2D(Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * SHAKE_AMT, Randomizer::GetPresentationInstance()->RandomNumNegOneToOne() * SHAKE_AMT));
     }
 
     this->lockShakeAnim.SetLerp(timeVals, shakeVals);
@@ -231,6 +231,7 @@ private:
     void MoveToNextWorld();
     void MoveToPrevWorld();
     void GoIntoWorld();
+    void PrefetchSelectedWorld();
 
     void Init(const DisplayStateInfo& info);
 
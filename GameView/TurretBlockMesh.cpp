@@ -36,7 +36,8 @@
 
 #include "../ResourceManager.h"
 
-TurretBlockMesh::TurretBlockMesh() : glowTexture(NULL), sparkleTexture(NULL), baseMesh(NULL) {
+TurretBlockMesh::TurretBlockMesh(const GameModelSnapshot& drawnModelState) : drawnModelState(drawnModelState),
+glowTexture(NULL), sparkleTexture(NULL), baseMesh(NULL) {
 	
     assert(this->materialGroups.size() == 0);
 
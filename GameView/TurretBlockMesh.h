@@ -33,26 +33,34 @@
 #define __TURRETBLOCKMESH_H__
 
 #include "../BlammoEngine/BasicIncludes.h"
+#include "../BlammoEngine/RenderCommandQueue.h"
 
 class Texture2D;
 class MaterialGroup;
 class Mesh;
 class BasicPointLight;
 class Camera;
+class Matrix4x4;
+class GameModelSnapshot;
 
 class TurretBlockMesh {
 public:
     virtual ~TurretBlockMesh();
 
     virtual void Flush() = 0;
+    // The moving geometry of the turrets is recorded into the given queue relative to the given
+    // world transform (the modelview the level's pieces are drawn with) rather than drawn here
     virtual void Draw(double dT, const Camera& camera, const BasicPointLight& keyLight,
-        const BasicPointLight& fillLight, const BasicPointLight& ballLight) = 0;
+        const BasicPointLight& fillLight, const BasicPointLight& ballLight,
+        const Matrix4x4& worldTransform, RenderCommandQueue& queue) = 0;
 	virtual void SetAlphaMultiplier(float alpha) = 0;
 
     const std::map<std::string, MaterialGroup*>& GetMaterialGroups() const;
 
 protected:
-    TurretBlockMesh();
+    TurretBlockMesh(const GameModelSnapshot& drawnModelState);
+
+    const GameModelSnapshot& drawnModelState; // How the turrets are aimed when they're drawn
 
     std::map<std::string, MaterialGroup*> materialGroups; // Material groups for the static parts of the laser turret block mesh
 
@@ -0,0 +1,141 @@
+/**
+ * AllocationBenchmark.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "AllocationBenchmark.h"
+#include "TickTimingStats.h"
+
+#include "../BlammoEngine/BlammoTime.h"
+#include "../BlammoEngine/FreeListPool.h"
+#include "../BlammoEngine/IntrusiveList.h"
+
+#include "../GameModel/PaddleLaserProjectile.h"
+#include "../GameModel/LaserTurretProjectile.h"
+#include "../GameModel/BossOrbProjectile.h"
+#include "../GameModel/PaddleRocketProjectile.h"
+
+static const int NUM_PROJECTILE_KINDS = 4;
+
+// Allocates straight from the heap, skipping the class' own pool (i.e., how projectiles were allocated before pooling)
+#define HEAP_NEW(className, ctorArgs) ::new (::operator new(sizeof(className))) className ctorArgs
+
+static Projectile* BuildProjectile(unsigned int idx, bool fromHeap) {
+    Point2D spawnLoc(static_cast<float>(idx % 32), static_cast<float>(idx % 24));
+    Vector2D dir(0.0f, 1.0f);
+
+    switch (idx % NUM_PROJECTILE_KINDS) {
+        case 0:
+            return fromHeap ? HEAP_NEW(PaddleLaserProjectile, (spawnLoc, dir)) : new PaddleLaserProjectile(spawnLoc, dir);
+        case 1:
+            return fromHeap ? HEAP_NEW(LaserTurretProjectile, (spawnLoc, dir)) : new LaserTurretProjectile(spawnLoc, dir);
+        case 2:
+            return fromHeap ? HEAP_NEW(BossOrbProjectile, (spawnLoc, dir)) : new BossOrbProjectile(spawnLoc, dir);
+        default:
+            return fromHeap ? HEAP_NEW(PaddleRocketProjectile, (spawnLoc, dir, 1.0f, 2.0f)) :
+                new PaddleRocketProjectile(spawnLoc, dir, 1.0f, 2.0f);
+    }
+}
+
+static void DestroyHeapProjectile(Projectile* projectile) {
+    projectile->~Projectile();
+    ::operator delete(projectile);
+}
+
+#undef HEAP_NEW
+
+static void WriteResult(std::ostream& out, const char* label, const TickTimingStats& stats, 
+                        double numProjectiles, double numHeapAllocations) {
+    double totalTimeInSecs = stats.GetMeanTickTimeInSecs() * stats.GetNumTicks();
+    out << label << ": "
+        << "projectiles/s="       << (totalTimeInSecs > 0.0 ? numProjectiles / totalTimeInSecs : 0.0)
+        << ", heap allocs/s="     << (totalTimeInSecs > 0.0 ? numHeapAllocations / totalTimeInSecs : 0.0)
+        << ", heap allocs total=" << numHeapAllocations
+        << ", mean tick(us)="     << stats.GetMeanTickTimeInSecs() * 1000000.0
+        << std::endl;
+}
+
+AllocationBenchmark::AllocationBenchmark(unsigned int numProjectilesPerTick, size_t numTicks) :
+numProjectilesPerTick(numProjectilesPerTick), numTicks(numTicks) {
+    assert(numProjectilesPerTick > 0);
+    assert(numTicks > 0);
+}
+
+void AllocationBenchmark::Run(std::ostream& out) const {
+    out << "Projectile allocation: projectiles/tick=" << this->numProjectilesPerTick 
+        << ", ticks=" << this->numTicks << std::endl;
+
+    double numProjectiles = static_cast<double>(this->numProjectilesPerTick) * static_cast<double>(this->numTicks);
+
+    // Before: every projectile and every std::list node is a heap allocation
+    {
+        TickTimingStats stats;
+        stats.Reserve(this->numTicks);
+        std::list<Projectile*> projectiles;
+        for (size_t i = 0; i < this->numTicks; i++) {
+            double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+            for (unsigned int j = 0; j < this->numProjectilesPerTick; j++) {
+                projectiles.push_back(BuildProjectile(j, true));
+            }
+            for (std::list<Projectile*>::iterator iter = projectiles.begin(); iter != projectiles.end();) {
+                Projectile* projectile = *iter;
+                iter = projectiles.erase(iter);
+                DestroyHeapProjectile(projectile);
+            }
+            stats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+        }
+        WriteResult(out, "heap + std::list", stats, numProjectiles, 2.0 * numProjectiles);
+    }
+
+    // After: projectiles come from their pools and link themselves into the list
+    {
+        FreeListPool::ResetAllCounters();
+        unsigned long heapAllocationsBefore = FreeListPool::GetTotalNumHeapAllocations();
+
+        TickTimingStats stats;
+        stats.Reserve(this->numTicks);
+        IntrusiveList<Projectile> projectiles;
+        for (size_t i = 0; i < this->numTicks; i++) {
+            double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+            for (unsigned int j = 0; j < this->numProjectilesPerTick; j++) {
+                projectiles.push_back(BuildProjectile(j, false));
+            }
+            for (IntrusiveList<Projectile>::iterator iter = projectiles.begin(); iter != projectiles.end();) {
+                Projectile* projectile = *iter;
+                iter = projectiles.erase(iter);
+                delete projectile;
+            }
+            stats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+        }
+        WriteResult(out, "pooled + IntrusiveList", stats, numProjectiles, 
+            static_cast<double>(FreeListPool::GetTotalNumHeapAllocations() - heapAllocationsBefore));
+    }
+
+    FreeListPool::WriteAllStats(out);
+}
@@ -0,0 +1,212 @@
+/**
+ * ESPThreadBenchmark.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ESPThreadBenchmark.h"
+#include "TickTimingStats.h"
+
+#include "../BlammoEngine/Algebra.h"
+#include "../BlammoEngine/BlammoTime.h"
+#include "../BlammoEngine/JobSystem.h"
+
+#include "../ESPEngine/ESPPointEmitter.h"
+#include "../ESPEngine/ESPParallelTicker.h"
+#include "../ESPEngine/ESPParticleAccelEffector.h"
+#include "../ESPEngine/ESPParticleColourEffector.h"
+#include "../ESPEngine/ESPAnimatedAlphaEffector.h"
+
+static const unsigned int NUM_PARTICLES_PER_EMITTER = 64;
+// Every so often an emitter shares an animated effector, which keeps it off the worker threads
+static const int SERIAL_EMITTER_FREQUENCY = 16;
+
+/**
+ * Point emitter that can sum up the positions of its alive particles, so that runs with different
+ * numbers of threads can be compared.
+ */
+class ChecksumPointEmitter : public ESPPointEmitter {
+public:
+    ChecksumPointEmitter() : ESPPointEmitter() {}
+    ~ChecksumPointEmitter() {}
+
+    double GetPositionChecksum() const {
+        double checksum = 0.0;
+        if (this->batchedParticles != NULL) {
+            for (unsigned int i = 0; i < this->batchedParticles->GetNumAlive(); i++) {
+                checksum += this->batchedParticles->posX[i] + 3.0 * this->batchedParticles->posY[i] + 
+                    7.0 * this->batchedParticles->posZ[i];
+            }
+        }
+        else {
+            for (std::list<ESPParticle*>::const_iterator iter = this->aliveParticles.begin();
+                 iter != this->aliveParticles.end(); ++iter) {
+                const Point3D& pos = (*iter)->GetPosition();
+                checksum += pos[0] + 3.0 * pos[1] + 7.0 * pos[2];
+            }
+        }
+        return checksum;
+    }
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(ChecksumPointEmitter);
+};
+
+ESPThreadBenchmark::ESPThreadBenchmark(int numEmitters, size_t numTicks, double dT, unsigned long seed) :
+numEmitters(numEmitters), numTicks(numTicks), dT(dT), seed(seed) {
+    assert(numEmitters > 0);
+    assert(numTicks > 0);
+    assert(dT > 0.0);
+}
+
+// Builds the scene, ticks it with the given number of threads and returns the checksum of where all the particles ended up
+double ESPThreadBenchmark::RunWithThreads(int numThreads, TickTimingStats& stats) const {
+    JobSystem::GetInstance()->SetNumThreads(numThreads);
+
+    ESPParticleAccelEffector gravity(Vector3D(0.0f, -9.8f, 0.0f));
+    ESPParticleColourEffector fader(1.0f, 0.0f);
+    ESPAnimatedAlphaEffector flicker;
+    std::vector<double> flickerTimes;
+    flickerTimes.push_back(0.0);
+    flickerTimes.push_back(0.25);
+    flickerTimes.push_back(0.5);
+    std::vector<float> flickerAlphas;
+    flickerAlphas.push_back(1.0f);
+    flickerAlphas.push_back(0.25f);
+    flickerAlphas.push_back(1.0f);
+    AnimationMultiLerp<float> flickerAnim;
+    flickerAnim.SetLerp(flickerTimes, flickerAlphas);
+    flickerAnim.SetRepeat(true);
+    flicker.SetAnimation0(flickerAnim);
+
+    // Every emitter seeds its own random stream from the presentation random stream when it's created,
+    // so reseeding here gives every run the same scene
+    Randomizer::GetPresentationInstance()->SetSeed(this->seed);
+
+    // The particles keep respawning for the whole run so that the emitters' random streams get used on every tick
+    float runTimeInSecs = static_cast<float>(this->numTicks * this->dT);
+    ESPInterval lifetime(0.1f * runTimeInSecs, 0.3f * runTimeInSecs);
+    float spawnDelta = lifetime.minValue / NUM_PARTICLES_PER_EMITTER;
+
+    std::vector<ChecksumPointEmitter*> emitters;
+    emitters.reserve(this->numEmitters);
+    for (int i = 0; i < this->numEmitters; i++) {
+        ChecksumPointEmitter* emitter = new ChecksumPointEmitter();
+        emitter->SetSpawnDelta(ESPInterval(spawnDelta, 2.0f * spawnDelta));
+        emitter->SetNumParticleLives(ESPParticle::INFINITE_PARTICLE_LIVES);
+        emitter->SetInitialSpd(ESPInterval(3.0f, 7.0f));
+        emitter->SetParticleLife(lifetime);
+        emitter->SetEmitAngleInDegrees(55);
+        emitter->SetParticleSize(ESPInterval(0.1f, 0.5f));
+        emitter->SetParticleRotation(ESPInterval(-180.0f, 180.0f));
+        emitter->SetRadiusDeviationFromCenter(ESPInterval(0.0f, 0.5f));
+        emitter->SetEmitPosition(Point3D(static_cast<float>(i % 20), static_cast<float>(i / 20), 0.0f));
+        emitter->SetEmitDirection(Vector3D(0, 1, 0));
+        emitter->AddEffector(&gravity);
+        emitter->AddEffector(&fader);
+        if (i % SERIAL_EMITTER_FREQUENCY == SERIAL_EMITTER_FREQUENCY - 1) {
+            emitter->AddEffector(&flicker);
+        }
+
+        // Nothing gets drawn so the particles are left untextured
+        if (i % 2 == 0) {
+            bool success = emitter->SetBatchedParticles(NUM_PARTICLES_PER_EMITTER, NULL);
+            assert(success);
+            UNUSED_VARIABLE(success);
+        }
+        else {
+            for (unsigned int j = 0; j < NUM_PARTICLES_PER_EMITTER; j++) {
+                emitter->AddParticle(new ESPParticle());
+            }
+        }
+        emitters.push_back(emitter);
+    }
+
+    ESPParallelTicker ticker;
+    stats.Reserve(this->numTicks);
+    for (size_t tick = 0; tick < this->numTicks; tick++) {
+        double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        for (std::vector<ChecksumPointEmitter*>::iterator iter = emitters.begin(); iter != emitters.end(); ++iter) {
+            ticker.AddEmitter(*iter);
+        }
+        ticker.Tick(this->dT);
+        stats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+    }
+
+    double checksum = 0.0;
+    for (std::vector<ChecksumPointEmitter*>::iterator iter = emitters.begin(); iter != emitters.end(); ++iter) {
+        checksum += (*iter)->GetPositionChecksum();
+        delete *iter;
+    }
+    return checksum;
+}
+
+bool ESPThreadBenchmark::Run(std::ostream& out) const {
+    int numProcessors = JobSystem::GetNumProcessors();
+    out << "Parallel emitter ticking: " << this->numEmitters << " emitters of " << NUM_PARTICLES_PER_EMITTER 
+        << " particles, ticks=" << this->numTicks << ", processors=" << numProcessors << std::endl;
+
+    std::vector<int> threadCounts;
+    for (int numThreads = 1; numThreads < numProcessors; numThreads *= 2) {
+        threadCounts.push_back(numThreads);
+    }
+    threadCounts.push_back(numProcessors);
+
+    bool isDeterministic = true;
+    double singleThreadTime = 0.0;
+    double singleThreadChecksum = 0.0;
+    for (size_t i = 0; i < threadCounts.size(); i++) {
+        TickTimingStats stats;
+        double checksum = this->RunWithThreads(threadCounts[i], stats);
+
+        std::stringstream label;
+        label << "Emitters (" << threadCounts[i] << " thread" << (threadCounts[i] == 1 ? "" : "s") << ")";
+        stats.WriteSummary(out, label.str());
+
+        if (i == 0) {
+            singleThreadTime = stats.GetTotalTimeInSecs();
+            singleThreadChecksum = checksum;
+        }
+        else {
+            if (stats.GetTotalTimeInSecs() > 0.0) {
+                out << "  speedup over 1 thread: " << singleThreadTime / stats.GetTotalTimeInSecs() << "x" << std::endl;
+            }
+            // Each emitter runs the exact same operations no matter which thread ticks it, so this is exact
+            if (checksum != singleThreadChecksum) {
+                out << "  particle positions differ from the single threaded run (checksum " << checksum 
+                    << " vs. " << singleThreadChecksum << ")" << std::endl;
+                isDeterministic = false;
+            }
+        }
+    }
+
+    JobSystem::GetInstance()->SetNumThreads(numProcessors);
+    out << (isDeterministic ? "Particle positions are identical for every thread count." :
+        "Particle positions depend on the number of threads!") << std::endl;
+    return isDeterministic;
+}
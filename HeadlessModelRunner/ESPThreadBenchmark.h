@@ -0,0 +1,65 @@
+/**
+ * ESPThreadBenchmark.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ESPTHREADBENCHMARK_H__
+#define __ESPTHREADBENCHMARK_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+class TickTimingStats;
+
+/**
+ * CPU-only scaling benchmark for ticking ESP emitters in parallel: a scene of the given number of
+ * continuously spawning emitters (a mix of list based and batched ones, plus a few that share an
+ * animated effector and have to stay on the calling thread) is ticked through the ESPParallelTicker
+ * with the JobSystem limited to 1, 2, 4, ... threads up to the number of processors. The time per tick
+ * and the speedup over a single thread are reported, and the particles are checked to end up in the
+ * exact same place no matter how many threads were used.
+ */
+class ESPThreadBenchmark {
+public:
+    ESPThreadBenchmark(int numEmitters, size_t numTicks, double dT, unsigned long seed);
+    ~ESPThreadBenchmark() {}
+
+    bool Run(std::ostream& out) const;
+
+private:
+    int numEmitters;
+    size_t numTicks;
+    double dT;
+    unsigned long seed;
+
+    double RunWithThreads(int numThreads, TickTimingStats& stats) const;
+
+    DISALLOW_COPY_AND_ASSIGN(ESPThreadBenchmark);
+};
+
+#endif // __ESPTHREADBENCHMARK_H__
@@ -0,0 +1,257 @@
+/**
+ * GeometryBatchBenchmark.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "GeometryBatchBenchmark.h"
+#include "TickTimingStats.h"
+
+#include "../BlammoEngine/Algebra.h"
+#include "../BlammoEngine/BlammoTime.h"
+#include "../BlammoEngine/Mesh.h"
+#include "../BlammoEngine/StaticGeometryBatch.h"
+
+// Matches the usual level width and the LevelMesh's batch chunks
+static const int NUM_COLUMNS = 20;
+static const int NUM_ROWS_PER_CHUNK = 8;
+// Most blocks are drawn with a couple of materials (e.g., the outline and the block face)
+static const int NUM_MATERIALS = 2;
+
+// A unit cube made of 12 triangles, the same kind of geometry as a basic block
+static PolygonGroup* BuildCubePolygonGroup() {
+    static const float CORNERS[8][3] = {
+        {-0.5f, -0.5f, -0.5f}, {0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, -0.5f}, {-0.5f, 0.5f, -0.5f},
+        {-0.5f, -0.5f,  0.5f}, {0.5f, -0.5f,  0.5f}, {0.5f, 0.5f,  0.5f}, {-0.5f, 0.5f,  0.5f}
+    };
+    static const unsigned short FACES[6][4] = {
+        {4, 5, 6, 7}, {1, 0, 3, 2}, {5, 1, 2, 6}, {0, 4, 7, 3}, {7, 6, 2, 3}, {0, 1, 5, 4}
+    };
+    static const float NORMALS[6][3] = {
+        {0, 0, 1}, {0, 0, -1}, {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}
+    };
+
+    std::vector<Point3D> vertexStream;
+    for (int i = 0; i < 8; i++) {
+        vertexStream.push_back(Point3D(CORNERS[i][0], CORNERS[i][1], CORNERS[i][2]));
+    }
+    std::vector<Vector3D> normalStream;
+    for (int i = 0; i < 6; i++) {
+        normalStream.push_back(Vector3D(NORMALS[i][0], NORMALS[i][1], NORMALS[i][2]));
+    }
+    std::vector<Point2D> texCoordStream;
+    texCoordStream.push_back(Point2D(0, 0));
+    texCoordStream.push_back(Point2D(1, 0));
+    texCoordStream.push_back(Point2D(1, 1));
+    texCoordStream.push_back(Point2D(0, 1));
+
+    static const unsigned short QUAD_TO_TRIANGLES[6] = {0, 1, 2, 0, 2, 3};
+    PolyGrpIndexer indexer;
+    for (unsigned short face = 0; face < 6; face++) {
+        for (int i = 0; i < 6; i++) {
+            unsigned short corner = QUAD_TO_TRIANGLES[i];
+            indexer.vertexIndices.push_back(FACES[face][corner]);
+            indexer.normalIndices.push_back(face);
+            indexer.texCoordIndices.push_back(corner);
+        }
+    }
+
+    return new PolygonGroup(indexer, vertexStream, normalStream, texCoordStream);
+}
+
+struct BenchmarkLevel {
+    std::vector<StaticGeometryBatch*> batches;      // Indexed by chunk * NUM_MATERIALS + material
+    std::vector<Point3D> firstVertices;             // Where the first vertex of each piece should be
+    std::vector<char> isPieceAlive;   // Not a vector<bool>, the address of each element is used
+    size_t numVerticesPerPiece;
+
+    ~BenchmarkLevel() {
+        for (size_t i = 0; i < this->batches.size(); i++) {
+            delete this->batches[i];
+        }
+    }
+
+    // The address of an element is as good an owner key as a level piece is
+    const void* GetPieceOwner(int pieceIdx) const {
+        return &this->isPieceAlive[0] + pieceIdx;
+    }
+    size_t GetBatchIndex(int pieceIdx, int materialIdx) const {
+        return static_cast<size_t>((pieceIdx / NUM_COLUMNS) / NUM_ROWS_PER_CHUNK) * NUM_MATERIALS + materialIdx;
+    }
+};
+
+static void BuildLevel(BenchmarkLevel& level, const PolygonGroup& cube, int numRows) {
+    int numPieces = numRows * NUM_COLUMNS;
+    int numChunks = (numRows + NUM_ROWS_PER_CHUNK - 1) / NUM_ROWS_PER_CHUNK;
+
+    level.batches.resize(numChunks * NUM_MATERIALS, NULL);
+    level.firstVertices.resize(numPieces);
+    level.isPieceAlive.assign(numPieces, 1);
+    level.numVerticesPerPiece = cube.GetVertexStream().size();
+
+    const Point3D& cubeFirstVertex = cube.GetVertexStream()[0];
+    ColourRGBA colour(1.0f, 0.5f, 0.0f, 1.0f);
+
+    for (int pieceIdx = 0; pieceIdx < numPieces; pieceIdx++) {
+        Vector3D translation(static_cast<float>(pieceIdx % NUM_COLUMNS), static_cast<float>(pieceIdx / NUM_COLUMNS), 0.0f);
+        Matrix4x4 transform = Matrix4x4::translationMatrix(translation);
+        level.firstVertices[pieceIdx] = cubeFirstVertex + translation;
+
+        for (int materialIdx = 0; materialIdx < NUM_MATERIALS; materialIdx++) {
+            StaticGeometryBatch*& batch = level.batches[level.GetBatchIndex(pieceIdx, materialIdx)];
+            if (batch == NULL) {
+                batch = new StaticGeometryBatch();
+            }
+            batch->AddGeometry(level.GetPieceOwner(pieceIdx), cube, transform, colour);
+        }
+    }
+}
+
+// Make sure every batch holds exactly the pieces that are still alive, where they should be
+static bool CheckLevel(const BenchmarkLevel& level, std::ostream& out) {
+    std::vector<size_t> expectedNumLiveVertices(level.batches.size(), 0);
+
+    for (int pieceIdx = 0; pieceIdx < static_cast<int>(level.isPieceAlive.size()); pieceIdx++) {
+        for (int materialIdx = 0; materialIdx < NUM_MATERIALS; materialIdx++) {
+            size_t batchIdx = level.GetBatchIndex(pieceIdx, materialIdx);
+            const StaticGeometryBatch* batch = level.batches[batchIdx];
+
+            size_t firstVertex = 0;
+            size_t numVertices = 0;
+            bool hasGeometry = batch->GetGeometryRange(level.GetPieceOwner(pieceIdx), firstVertex, numVertices);
+            if (hasGeometry != (level.isPieceAlive[pieceIdx] != 0)) {
+                out << "  piece " << pieceIdx << " is " << (hasGeometry ? "still" : "not") << " in its batch" << std::endl;
+                return false;
+            }
+            if (!hasGeometry) {
+                continue;
+            }
+
+            const float* vertex = batch->GetVertex(firstVertex);
+            const Point3D& expected = level.firstVertices[pieceIdx];
+            if (numVertices != level.numVerticesPerPiece || vertex[0] != expected[0] ||
+                vertex[1] != expected[1] || vertex[2] != expected[2]) {
+                out << "  piece " << pieceIdx << " has the wrong geometry in its batch" << std::endl;
+                return false;
+            }
+            expectedNumLiveVertices[batchIdx] += numVertices;
+        }
+    }
+
+    for (size_t batchIdx = 0; batchIdx < level.batches.size(); batchIdx++) {
+        if (level.batches[batchIdx]->GetNumLiveVertices() != expectedNumLiveVertices[batchIdx]) {
+            out << "  batch " << batchIdx << " has " << level.batches[batchIdx]->GetNumLiveVertices() 
+                << " live vertices, expected " << expectedNumLiveVertices[batchIdx] << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+static size_t GetNumDrawCalls(const BenchmarkLevel& level) {
+    size_t numDrawCalls = 0;
+    for (size_t i = 0; i < level.batches.size(); i++) {
+        if (!level.batches[i]->IsEmpty()) {
+            numDrawCalls++;
+        }
+    }
+    return numDrawCalls;
+}
+
+GeometryBatchBenchmark::GeometryBatchBenchmark(int numRows, size_t numRepetitions, unsigned long seed) :
+numRows(numRows), numRepetitions(numRepetitions), seed(seed) {
+    assert(numRows > 0);
+    assert(numRepetitions > 0);
+}
+
+bool GeometryBatchBenchmark::Run(std::ostream& out) const {
+    int numPieces = this->numRows * NUM_COLUMNS;
+    out << "Level geometry batching: " << NUM_COLUMNS << "x" << this->numRows << " pieces, " 
+        << NUM_MATERIALS << " materials per piece, repetitions=" << this->numRepetitions << std::endl;
+
+    PolygonGroup* cube = BuildCubePolygonGroup();
+    Randomizer::GetInstance()->SetSeed(this->seed);
+
+    TickTimingStats buildStats;
+    TickTimingStats removeStats;
+    buildStats.Reserve(this->numRepetitions);
+    removeStats.Reserve(this->numRepetitions * numPieces);
+
+    size_t numDrawCallsAfterBuild = 0;
+    bool isConsistent = true;
+
+    for (size_t repetition = 0; repetition < this->numRepetitions && isConsistent; repetition++) {
+        BenchmarkLevel level;
+
+        double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        BuildLevel(level, *cube, this->numRows);
+        buildStats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+
+        numDrawCallsAfterBuild = GetNumDrawCalls(level);
+        isConsistent = CheckLevel(level, out);
+
+        // Destroy all the pieces in a random order, just like the ball would
+        std::vector<int> removalOrder(numPieces);
+        for (int i = 0; i < numPieces; i++) {
+            removalOrder[i] = i;
+        }
+        for (int i = numPieces - 1; i > 0; i--) {
+            std::swap(removalOrder[i], removalOrder[Randomizer::GetInstance()->RandomUnsignedInt() % (i + 1)]);
+        }
+
+        for (int i = 0; i < numPieces && isConsistent; i++) {
+            int pieceIdx = removalOrder[i];
+
+            startTime = BlammoTime::GetHighResolutionTimeInSecs();
+            for (int materialIdx = 0; materialIdx < NUM_MATERIALS; materialIdx++) {
+                level.batches[level.GetBatchIndex(pieceIdx, materialIdx)]->RemoveGeometry(level.GetPieceOwner(pieceIdx));
+            }
+            removeStats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+
+            level.isPieceAlive[pieceIdx] = 0;
+            // Checking every removal is quadratic, every so often (and the end) is enough to catch a bad patch or compaction
+            if (i % NUM_COLUMNS == 0 || i == numPieces - 1) {
+                isConsistent = CheckLevel(level, out);
+            }
+        }
+    }
+
+    delete cube;
+    cube = NULL;
+
+    out << "build: mean(ms)=" << buildStats.GetMeanTickTimeInSecs() * 1000.0
+        << ", max(ms)=" << buildStats.GetMaxTickTimeInSecs() * 1000.0 << std::endl;
+    out << "remove piece: mean(us)=" << removeStats.GetMeanTickTimeInSecs() * 1000000.0
+        << ", p99(us)=" << removeStats.GetPercentileTickTimeInSecs(99.0) * 1000000.0
+        << ", max(us)=" << removeStats.GetMaxTickTimeInSecs() * 1000000.0 << std::endl;
+    out << "draw calls per pass: batched=" << numDrawCallsAfterBuild 
+        << ", display lists=" << numPieces * NUM_MATERIALS << std::endl;
+    out << (isConsistent ? "Batches stayed consistent" : "Batches became INCONSISTENT") << std::endl;
+
+    return isConsistent;
+}
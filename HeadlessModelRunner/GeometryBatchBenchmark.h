@@ -0,0 +1,60 @@
+/**
+ * GeometryBatchBenchmark.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __GEOMETRYBATCHBENCHMARK_H__
+#define __GEOMETRYBATCHBENCHMARK_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+/**
+ * CPU-only benchmark and consistency check for the StaticGeometryBatch used to draw level pieces:
+ * a level of the given number of rows (with the usual level width) is batched the way the LevelMesh
+ * does it and then every piece is destroyed in a random order. Each removal is checked to leave
+ * every batch holding exactly the geometry of the pieces that remain, and the times to build the
+ * batches and to patch out each piece are reported along with how many draw calls a pass needs
+ * compared to one display list per piece and material.
+ */
+class GeometryBatchBenchmark {
+public:
+    GeometryBatchBenchmark(int numRows, size_t numRepetitions, unsigned long seed);
+    ~GeometryBatchBenchmark() {}
+
+    bool Run(std::ostream& out) const;
+
+private:
+    int numRows;
+    size_t numRepetitions;
+    unsigned long seed;
+
+    DISALLOW_COPY_AND_ASSIGN(GeometryBatchBenchmark);
+};
+
+#endif // __GEOMETRYBATCHBENCHMARK_H__
@@ -0,0 +1,235 @@
+/**
+ * GlyphAtlasBenchmark.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "GlyphAtlasBenchmark.h"
+#include "TickTimingStats.h"
+
+#include "../BlammoEngine/Algebra.h"
+#include "../BlammoEngine/BlammoTime.h"
+#include "../BlammoEngine/GlyphAtlas.h"
+
+// Roughly the glyph sizes of the huge (60 point at 96 dpi) game font
+static const unsigned int FONT_HEIGHT_IN_PIXELS = 60;
+static const int MAX_GLYPH_SIZE     = 80;
+static const int MIN_STRING_LENGTH  = 4;
+static const int MAX_STRING_LENGTH  = 32;
+
+// Printable characters get a bitmap, everything else (like the space) only has an advance
+static void BuildFont(TextureFontSet::BakedFont& font) {
+    Randomizer* randomizer = Randomizer::GetInstance();
+    font.heightInPixels = FONT_HEIGHT_IN_PIXELS;
+    font.glyphs.clear();
+    font.glyphs.resize(GlyphAtlas::MAX_NUM_GLYPHS);
+
+    for (int i = 0; i < GlyphAtlas::MAX_NUM_GLYPHS; i++) {
+        TextureFontSet::BakedGlyph& glyph = font.glyphs[i];
+        glyph.advance = 10 + static_cast<int>(randomizer->RandomUnsignedInt() % MAX_GLYPH_SIZE);
+        if (i <= ' ' || i == 127) {
+            continue;
+        }
+
+        glyph.width = 1 + static_cast<int>(randomizer->RandomUnsignedInt() % MAX_GLYPH_SIZE);
+        glyph.rows  = 1 + static_cast<int>(randomizer->RandomUnsignedInt() % MAX_GLYPH_SIZE);
+        glyph.left  = static_cast<int>(randomizer->RandomUnsignedInt() % 5);
+        glyph.top   = glyph.rows - static_cast<int>(randomizer->RandomUnsignedInt() % (glyph.rows / 4 + 1));
+        glyph.bitmap.resize(glyph.width * glyph.rows);
+        for (size_t j = 0; j < glyph.bitmap.size(); j++) {
+            // Never zero so that misplaced texels are easy to spot
+            glyph.bitmap[j] = static_cast<unsigned char>(1 + (randomizer->RandomUnsignedInt() % 255));
+        }
+    }
+}
+
+static bool CheckAtlas(const GlyphAtlas& atlas, const TextureFontSet::BakedFont& font, std::ostream& out) {
+    const std::vector<unsigned char>& pixels = atlas.GetPixels();
+    std::vector<char> isTexelUsed(pixels.size(), 0);
+    size_t numTexelsUsed = 0;
+
+    for (size_t i = 0; i < atlas.GetNumGlyphs(); i++) {
+        const GlyphAtlas::Glyph& glyph = atlas.GetGlyph(i);
+        const TextureFontSet::BakedGlyph& bakedGlyph = font.glyphs[i];
+        if (glyph.width != bakedGlyph.width || glyph.rows != bakedGlyph.rows || 
+            glyph.advance != static_cast<float>(bakedGlyph.advance)) {
+            out << "  glyph " << i << " has the wrong metrics" << std::endl;
+            return false;
+        }
+        if (glyph.width == 0) {
+            // Nothing to draw, so it isn't in the atlas
+            continue;
+        }
+        if (glyph.x < GlyphAtlas::GLYPH_PADDING || glyph.y < GlyphAtlas::GLYPH_PADDING ||
+            glyph.x + glyph.width + GlyphAtlas::GLYPH_PADDING > atlas.GetWidth() ||
+            glyph.y + glyph.rows + GlyphAtlas::GLYPH_PADDING > atlas.GetHeight()) {
+            out << "  glyph " << i << " is outside of the atlas" << std::endl;
+            return false;
+        }
+
+        // Each glyph, with its padding, must have the texels to itself
+        for (int y = glyph.y - GlyphAtlas::GLYPH_PADDING; y < glyph.y + glyph.rows; y++) {
+            for (int x = glyph.x - GlyphAtlas::GLYPH_PADDING; x < glyph.x + glyph.width; x++) {
+                size_t texelIdx = y * atlas.GetWidth() + x;
+                if (isTexelUsed[texelIdx]) {
+                    out << "  glyph " << i << " overlaps another glyph" << std::endl;
+                    return false;
+                }
+                isTexelUsed[texelIdx] = 1;
+
+                bool isPadding = (x < glyph.x || y < glyph.y);
+                unsigned char expected = isPadding ? 0 : bakedGlyph.bitmap[(y - glyph.y) * glyph.width + (x - glyph.x)];
+                if (pixels[texelIdx] != expected) {
+                    out << "  glyph " << i << " was copied into the atlas incorrectly" << std::endl;
+                    return false;
+                }
+            }
+        }
+        numTexelsUsed += glyph.width * glyph.rows;
+    }
+
+    out << "atlas: " << atlas.GetWidth() << "x" << atlas.GetHeight() << ", " << atlas.GetNumGlyphs() << " glyphs, "
+        << (100.0 * numTexelsUsed) / static_cast<double>(pixels.size()) << "% of texels used" << std::endl;
+    return true;
+}
+
+static bool CheckLayout(const GlyphAtlas& atlas, const std::string& s, const TextLayout& layout, std::ostream& out) {
+    float penX = 0.0f;
+    size_t vertexIdx = 0;
+    for (size_t i = 0; i < s.size(); i++) {
+        const GlyphAtlas::Glyph& glyph = atlas.GetGlyph(static_cast<unsigned char>(s[i]));
+        if (glyph.width > 0) {
+            if (vertexIdx >= layout.GetNumVertices()) {
+                out << "  layout of \"" << s << "\" is missing glyphs" << std::endl;
+                return false;
+            }
+            // The second vertex of each quad is the bottom-left of the glyph's bitmap
+            const float* bottomLeft = &layout.vertices[(vertexIdx + 1) * TextLayout::NUM_FLOATS_PER_VERTEX];
+            if (bottomLeft[0] != penX + glyph.left || bottomLeft[1] != static_cast<float>(glyph.top - glyph.rows) ||
+                bottomLeft[2] != glyph.u0 || bottomLeft[3] != glyph.v1) {
+                out << "  layout of \"" << s << "\" put glyph " << i << " in the wrong place" << std::endl;
+                return false;
+            }
+            vertexIdx += TextLayout::NUM_VERTICES_PER_GLYPH;
+        }
+        penX += glyph.advance;
+    }
+
+    if (vertexIdx != layout.GetNumVertices() || penX != layout.width) {
+        out << "  layout of \"" << s << "\" has the wrong number of glyphs or width" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+GlyphAtlasBenchmark::GlyphAtlasBenchmark(int numStrings, size_t numRepetitions, unsigned long seed) :
+numStrings(numStrings), numRepetitions(numRepetitions), seed(seed) {
+    assert(numStrings > 0);
+    assert(numRepetitions > 0);
+}
+
+bool GlyphAtlasBenchmark::Run(std::ostream& out) const {
+    out << "Glyph atlas: " << this->numStrings << " strings of " << MIN_STRING_LENGTH << "-" << MAX_STRING_LENGTH
+        << " characters, repetitions=" << this->numRepetitions << std::endl;
+
+    Randomizer::GetInstance()->SetSeed(this->seed);
+    TextureFontSet::BakedFont font;
+    BuildFont(font);
+
+    GlyphAtlas atlas;
+    double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+    if (!atlas.Pack(font)) {
+        out << "Glyph atlas packing FAILED" << std::endl;
+        return false;
+    }
+    out << "pack(us)=" << (BlammoTime::GetHighResolutionTimeInSecs() - startTime) * 1000000.0 << std::endl;
+
+    bool isCorrect = CheckAtlas(atlas, font, out);
+
+    // Strings of printable characters, with the odd space
+    std::vector<std::string> strings(this->numStrings);
+    size_t numGlyphsInStrings = 0;
+    for (int i = 0; i < this->numStrings; i++) {
+        int length = MIN_STRING_LENGTH + static_cast<int>(Randomizer::GetInstance()->RandomUnsignedInt() % 
+            (MAX_STRING_LENGTH - MIN_STRING_LENGTH + 1));
+        for (int j = 0; j < length; j++) {
+            strings[i] += static_cast<char>(' ' + (Randomizer::GetInstance()->RandomUnsignedInt() % 95));
+        }
+        numGlyphsInStrings += strings[i].size();
+    }
+
+    TickTimingStats layoutStats;
+    TickTimingStats batchStats;
+    layoutStats.Reserve(this->numRepetitions);
+    batchStats.Reserve(this->numRepetitions);
+
+    static const float WHITE[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    std::vector<TextLayout> layouts(this->numStrings);
+    std::vector<float> batchVertices;
+    size_t numLayoutVertices = 0;
+    for (size_t repetition = 0; repetition < this->numRepetitions && isCorrect; repetition++) {
+        startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        for (int i = 0; i < this->numStrings; i++) {
+            atlas.LayoutText(strings[i], layouts[i]);
+        }
+        layoutStats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+
+        // Batching a frame's text reuses the layouts (they're cached by the font)
+        batchVertices.clear();
+        startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        for (int i = 0; i < this->numStrings; i++) {
+            GlyphAtlas::AppendTransformedLayout(layouts[i], 10.0f, 20.0f * static_cast<float>(i), 0.0f,
+                0.0f, 0.5f, WHITE, batchVertices);
+        }
+        batchStats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+
+        if (repetition == 0) {
+            numLayoutVertices = 0;
+            for (int i = 0; i < this->numStrings && isCorrect; i++) {
+                isCorrect = CheckLayout(atlas, strings[i], layouts[i], out);
+                numLayoutVertices += layouts[i].GetNumVertices();
+            }
+            if (batchVertices.size() != numLayoutVertices * GlyphAtlas::NUM_FLOATS_PER_BATCH_VERTEX) {
+                out << "  expected " << numLayoutVertices << " batched vertices, got "
+                    << batchVertices.size() / GlyphAtlas::NUM_FLOATS_PER_BATCH_VERTEX << std::endl;
+                isCorrect = false;
+            }
+        }
+    }
+
+    // Every character used to be its own display list call (and texture bind)
+    out << "draws: per glyph=" << numGlyphsInStrings << ", per string=" << this->numStrings
+        << ", batched=1 (" << numLayoutVertices / TextLayout::NUM_VERTICES_PER_GLYPH << " quads)" << std::endl;
+    out << "layout: mean(us)=" << layoutStats.GetMeanTickTimeInSecs() * 1000000.0
+        << ", max(us)=" << layoutStats.GetMaxTickTimeInSecs() * 1000000.0 << std::endl;
+    out << "batch: mean(us)=" << batchStats.GetMeanTickTimeInSecs() * 1000000.0
+        << ", max(us)=" << batchStats.GetMaxTickTimeInSecs() * 1000000.0 << std::endl;
+    out << (isCorrect ? "Glyph atlas and layouts were correct" : "Glyph atlas or layouts were INCORRECT") << std::endl;
+
+    return isCorrect;
+}
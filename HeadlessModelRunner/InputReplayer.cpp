@@ -0,0 +1,303 @@
+/**
+ * InputReplayer.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "InputReplayer.h"
+#include "TickTimingStats.h"
+
+#include "../BlammoEngine/Algebra.h"
+#include "../BlammoEngine/BlammoTime.h"
+#include "../BlammoEngine/FrameProfiler.h"
+
+#include "../GameModel/GameModel.h"
+#include "../GameModel/GameEventManager.h"
+#include "../GameModel/SimulationClock.h"
+#include "../GameModel/GameEvents.h"
+#include "../GameModel/GameItemFactory.h"
+
+#include "../ResourceManager.h"
+#include "../Blammopedia.h"
+
+// Unlocks items in the blammopedia as the paddle catches them, the same way that the game's view does
+class ItemUnlockListener : public GameEvents {
+public:
+    void ItemPaddleCollsionEvent(const GameItem& item, const PlayerPaddle& paddle) {
+        UNUSED_PARAMETER(paddle);
+        Blammopedia* blammopedia = ResourceManager::GetInstance()->GetBlammopedia();
+        if (blammopedia != NULL) {
+            blammopedia->UnlockItem(item.GetItemType());
+        }
+    }
+};
+
+bool InputReplayer::Load(const std::string& filepath) {
+    std::ifstream inFile(filepath.c_str());
+    if (!inFile.is_open()) {
+        debug_output("Failed to open input recording file: " << filepath);
+        return false;
+    }
+
+    this->records.clear();
+    this->numTicks = 0;
+    this->hasResult = false;
+    this->hasUnlockedItems = false;
+    this->unlockedItemNames.clear();
+
+    std::string line;
+    int lineNum = 0;
+    bool hasSession = false;
+    while (std::getline(inFile, line)) {
+        lineNum++;
+        if (line.empty()) {
+            continue;
+        }
+
+        std::istringstream lineStream(line);
+        std::string typeStr;
+        Record record;
+        record.frameID = 0;
+        record.intValues[0] = record.intValues[1] = 0;
+        record.floatValues[0] = record.floatValues[1] = 0.0f;
+        record.dT = 0.0;
+
+        if (!(lineStream >> typeStr) || !InputRecorder::StringToRecordType(typeStr, record.type)) {
+            debug_output("Unknown record on input recording line " << lineNum << ": " << line);
+            return false;
+        }
+        if (hasSession == (record.type == InputRecorder::SessionRecord) || this->hasResult) {
+            debug_output("Input recordings must begin with a session record and end with a result record (line " 
+                << lineNum << ")");
+            return false;
+        }
+        if (record.type == InputRecorder::UnlockedItemsRecord && (this->hasUnlockedItems || !this->records.empty())) {
+            debug_output("The unlocked items record must directly follow the session record (line " << lineNum << ")");
+            return false;
+        }
+
+        bool isValid = true;
+        switch (record.type) {
+            case InputRecorder::SessionRecord: {
+                int isInverted = 0;
+                isValid = static_cast<bool>(lineStream >> this->seed >> this->difficulty >> this->ballBoostMode >> 
+                    isInverted >> this->pauseBitField);
+                this->ballBoostIsInverted = (isInverted != 0);
+                hasSession = true;
+                break;
+            }
+            case InputRecorder::UnlockedItemsRecord: {
+                size_t numUnlockedItems = 0;
+                isValid = static_cast<bool>(lineStream >> numUnlockedItems);
+                std::string itemName;
+                for (size_t j = 0; j < numUnlockedItems && isValid; j++) {
+                    isValid = static_cast<bool>(lineStream >> itemName);
+                    this->unlockedItemNames.push_back(itemName);
+                }
+                this->hasUnlockedItems = true;
+                break;
+            }
+            case InputRecorder::StartGameRecord:
+                isValid = static_cast<bool>(lineStream >> record.intValues[0] >> record.intValues[1]);
+                break;
+            case InputRecorder::TickRecord:
+                isValid = static_cast<bool>(lineStream >> record.dT);
+                this->numTicks++;
+                break;
+            case InputRecorder::MovePaddleRecord:
+            case InputRecorder::MoveOtherRecord:
+                isValid = static_cast<bool>(lineStream >> record.frameID >> record.intValues[0] >> record.floatValues[0]);
+                break;
+            case InputRecorder::ShootContinuousRecord:
+                isValid = static_cast<bool>(lineStream >> record.dT >> record.floatValues[0]);
+                break;
+            case InputRecorder::BoostPressedRecord:
+                isValid = static_cast<bool>(lineStream >> record.floatValues[0] >> record.floatValues[1] >> record.intValues[0]);
+                break;
+            case InputRecorder::AllowLaunchRecord:
+            case InputRecorder::PauseStateRecord:
+            case InputRecorder::DifficultyRecord:
+            case InputRecorder::BoostModeRecord:
+            case InputRecorder::InvertBoostRecord:
+                isValid = static_cast<bool>(lineStream >> record.intValues[0]);
+                break;
+            case InputRecorder::ResultRecord:
+                isValid = static_cast<bool>(lineStream >> this->resultScore >> this->resultNumLives >> 
+                    this->resultNumBalls >> this->resultPaddleX >> this->resultPaddleY);
+                this->hasResult = true;
+                break;
+            default:
+                break;
+        }
+
+        if (!isValid) {
+            debug_output("Malformed input recording line " << lineNum << ": " << line);
+            return false;
+        }
+        if (record.type != InputRecorder::SessionRecord && record.type != InputRecorder::UnlockedItemsRecord &&
+            record.type != InputRecorder::ResultRecord) {
+            this->records.push_back(record);
+        }
+    }
+
+    if (!hasSession) {
+        debug_output("Input recording is empty: " << filepath);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Locks every item in the given blammopedia except for those that were unlocked when the session was
+ * recorded. This has to be done before the model is built since it decides which items levels can drop.
+ * Returns: false if the recording names an item that doesn't exist, true otherwise.
+ */
+bool InputReplayer::ApplyItemUnlocks(Blammopedia& blammopedia) const {
+    if (!this->hasUnlockedItems) {
+        // Older recordings don't have the record, the replay can only hope the blammopedia hasn't changed
+        debug_output("Input recording has no unlocked items record, using the blammopedia as it is");
+        return true;
+    }
+
+    const Blammopedia::ItemEntryMap& itemEntries = blammopedia.GetItemEntries();
+    for (Blammopedia::ItemEntryMapConstIter iter = itemEntries.begin(); iter != itemEntries.end(); ++iter) {
+        iter->second->SetIsLocked(true);
+    }
+    for (std::vector<std::string>::const_iterator iter = this->unlockedItemNames.begin(); 
+         iter != this->unlockedItemNames.end(); ++iter) {
+
+        if (!GameItemFactory::GetInstance()->IsValidItemTypeName(*iter)) {
+            debug_output("Unknown unlocked item in input recording: " << *iter);
+            return false;
+        }
+        blammopedia.UnlockItem(GameItemFactory::GetInstance()->GetItemTypeFromName(*iter));
+    }
+    return true;
+}
+
+bool InputReplayer::Run(GameModel& model, TickTimingStats& stats, std::ostream& out) const {
+    // Start from the same state that the recording did (see GameModel::StartInputRecording)
+    Randomizer::GetInstance()->SetSeed(this->seed);
+    SimulationClock::Reset();
+    model.SetPauseState(this->pauseBitField);
+
+    // The game's view unlocks items as they're caught, levels loaded later in the session depend on that
+    ItemUnlockListener itemUnlockListener;
+    GameEventManager::Instance()->RegisterGameEventListener(&itemUnlockListener);
+
+    stats.Reserve(this->numTicks);
+    for (size_t i = 0; i < this->records.size(); i++) {
+        const Record& record = this->records[i];
+
+        switch (record.type) {
+            case InputRecorder::StartGameRecord:
+                model.StartGameAtWorldAndLevel(record.intValues[0], record.intValues[1]);
+                break;
+            case InputRecorder::ResetLevelRecord:
+                model.ResetCurrentLevel();
+                break;
+            case InputRecorder::TickRecord: {
+                double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+                model.Tick(record.dT);
+                model.UpdateState();
+                GameEventManager::Instance()->DispatchDeferredEvents();
+                stats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+                FrameProfiler::EndFrame();
+                break;
+            }
+            case InputRecorder::MovePaddleRecord:
+                model.MovePaddle(record.frameID, record.intValues[0], record.floatValues[0]);
+                break;
+            case InputRecorder::MoveOtherRecord:
+                model.MoveOther(record.frameID, record.intValues[0], record.floatValues[0]);
+                break;
+            case InputRecorder::ShootReleaseRecord:
+                model.ShootActionReleaseUse();
+                break;
+            case InputRecorder::ShootContinuousRecord:
+                model.ShootActionContinuousUse(record.dT, record.floatValues[0]);
+                break;
+            case InputRecorder::BoostPressedRecord:
+                model.BallBoostDirectionPressed(record.floatValues[0], record.floatValues[1], record.intValues[0] != 0);
+                break;
+            case InputRecorder::BoostReleasedRecord:
+                model.BallBoostDirectionReleased();
+                break;
+            case InputRecorder::AllowLaunchRecord:
+                model.ToggleAllowPaddleBallLaunching(record.intValues[0] != 0);
+                break;
+            case InputRecorder::PauseStateRecord:
+                model.SetPauseState(record.intValues[0]);
+                break;
+            case InputRecorder::DifficultyRecord:
+                model.SetDifficulty(static_cast<GameModel::Difficulty>(record.intValues[0]));
+                break;
+            case InputRecorder::BoostModeRecord:
+                model.SetBallBoostMode(static_cast<BallBoostModel::BallBoostMode>(record.intValues[0]));
+                break;
+            case InputRecorder::InvertBoostRecord:
+                model.SetInvertBallBoostDir(record.intValues[0] != 0);
+                break;
+            default:
+                assert(false);
+                break;
+        }
+    }
+
+    GameEventManager::Instance()->UnregisterGameEventListener(&itemUnlockListener);
+    return this->CheckResult(model, out);
+}
+
+bool InputReplayer::CheckResult(const GameModel& model, std::ostream& out) const {
+    if (!this->hasResult) {
+        out << "Replay finished, the recording has no result to check against (was it cut short?)" << std::endl;
+        return true;
+    }
+
+    const Point2D& paddlePos = model.GetPlayerPaddle()->GetCenterPosition();
+    long score   = model.GetScore();
+    int numLives = model.GetLivesLeft();
+    int numBalls = static_cast<int>(model.GetGameBalls().size());
+
+    // Everything must match exactly, the replay is only useful if it's the same session bit-for-bit
+    if (score == this->resultScore && numLives == this->resultNumLives && numBalls == this->resultNumBalls &&
+        paddlePos[0] == this->resultPaddleX && paddlePos[1] == this->resultPaddleY) {
+
+        out << "Replay matches the recording (score " << score << ", " << numLives << " lives, " 
+            << numBalls << " ball(s))" << std::endl;
+        return true;
+    }
+
+    out << "Replay DIVERGED from the recording:" << std::endl
+        << "  score:  " << score    << " (recorded " << this->resultScore    << ")" << std::endl
+        << "  lives:  " << numLives << " (recorded " << this->resultNumLives << ")" << std::endl
+        << "  balls:  " << numBalls << " (recorded " << this->resultNumBalls << ")" << std::endl
+        << "  paddle: " << paddlePos[0] << ", " << paddlePos[1] << " (recorded " 
+        << this->resultPaddleX << ", " << this->resultPaddleY << ")" << std::endl;
+    return false;
+}
@@ -0,0 +1,102 @@
+/**
+ * InputReplayer.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __INPUTREPLAYER_H__
+#define __INPUTREPLAYER_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+#include "../GameModel/InputRecorder.h"
+
+class GameModel;
+class TickTimingStats;
+class Blammopedia;
+
+/**
+ * Drives a game model through a session that was recorded with the InputRecorder (e.g., by running
+ * the game with -record), reproducing it exactly. The model must be freshly built with the session's
+ * difficulty and ball boost settings, after the session's item unlocks have been applied to the
+ * blammopedia (see ApplyItemUnlocks). Once the recording has been replayed the model is checked
+ * against the result that the recording ended with, so that any divergence is caught.
+ */
+class InputReplayer {
+public:
+    InputReplayer() : seed(0), difficulty(0), ballBoostMode(0), ballBoostIsInverted(false), 
+        pauseBitField(0), hasUnlockedItems(false), hasResult(false), resultScore(0), resultNumLives(0), resultNumBalls(0), 
+        resultPaddleX(0.0f), resultPaddleY(0.0f), numTicks(0) {}
+    ~InputReplayer() {}
+
+    bool Load(const std::string& filepath);
+
+    unsigned long GetSeed() const { return this->seed; }
+    int GetDifficulty() const { return this->difficulty; }
+    int GetBallBoostMode() const { return this->ballBoostMode; }
+    bool GetIsBallBoostInverted() const { return this->ballBoostIsInverted; }
+    size_t GetNumTicks() const { return this->numTicks; }
+
+    bool ApplyItemUnlocks(Blammopedia& blammopedia) const;
+    bool Run(GameModel& model, TickTimingStats& stats, std::ostream& out) const;
+
+private:
+    struct Record {
+        InputRecorder::RecordType type;
+        size_t frameID;
+        int intValues[2];
+        float floatValues[2];
+        double dT;
+    };
+
+    // The session record
+    unsigned long seed;
+    int difficulty;
+    int ballBoostMode;
+    bool ballBoostIsInverted;
+    int pauseBitField;
+
+    // The unlocked items record
+    bool hasUnlockedItems;
+    std::vector<std::string> unlockedItemNames;
+
+    // The result record
+    bool hasResult;
+    long resultScore;
+    int resultNumLives;
+    int resultNumBalls;
+    float resultPaddleX, resultPaddleY;
+
+    std::vector<Record> records;
+    size_t numTicks;
+
+    bool CheckResult(const GameModel& model, std::ostream& out) const;
+
+    DISALLOW_COPY_AND_ASSIGN(InputReplayer);
+};
+
+#endif // __INPUTREPLAYER_H__
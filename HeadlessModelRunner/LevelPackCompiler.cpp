@@ -0,0 +1,180 @@
+/**
+ * LevelPackCompiler.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "LevelPackCompiler.h"
+
+#include "../BlammoEngine/BlammoTime.h"
+
+#include "../GameModel/GameModel.h"
+#include "../GameModel/GameModelConstants.h"
+#include "../GameModel/LevelPack.h"
+
+static void HashValue(unsigned long& hash, unsigned long value) {
+    hash = (hash ^ value) * 16777619UL;
+}
+static void HashString(unsigned long& hash, const std::string& str) {
+    for (size_t i = 0; i < str.size(); i++) {
+        HashValue(hash, static_cast<unsigned char>(str[i]));
+    }
+}
+
+static void HashLevel(unsigned long& hash, const GameLevel& level) {
+    HashString(hash, level.GetName());
+    HashValue(hash, level.GetHasBoss() ? 1 : 0);
+
+    const std::vector<std::vector<LevelPiece*> >& pieces = level.GetCurrentLevelLayout();
+    for (size_t h = 0; h < pieces.size(); h++) {
+        for (size_t w = 0; w < pieces[h].size(); w++) {
+            HashValue(hash, pieces[h][w]->GetType());
+            HashValue(hash, static_cast<unsigned long>(pieces[h][w]->GetTriggerID()));
+        }
+    }
+}
+
+// Loads all of the model's worlds along with the pieces of every level and checksums their layouts (this is used to make
+// sure that the pack builds the same levels as the text files), returns the time it took to load in seconds or a negative value on failure
+static double LoadAllWorlds(GameModel& model, unsigned long& checksum) {
+    double totalTimeInSecs = 0.0;
+    checksum = 2166136261UL;
+
+    const std::vector<GameWorld*>& worlds = model.GetGameWorlds();
+    for (std::vector<GameWorld*>::const_iterator iter = worlds.begin(); iter != worlds.end(); ++iter) {
+        GameWorld* world = *iter;
+
+        double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        bool success = world->Load(&model);
+        totalTimeInSecs += BlammoTime::GetHighResolutionTimeInSecs() - startTime;
+        if (!success) {
+            return -1.0;
+        }
+
+        HashString(checksum, world->GetName());
+        HashValue(checksum, world->GetStyle());
+
+        for (size_t i = 0; i < world->GetNumLevels(); i++) {
+            GameLevel* level = world->GetLevelByIndex(static_cast<int>(i));
+
+            startTime = BlammoTime::GetHighResolutionTimeInSecs();
+            success = level->LoadPieces(&model, world->GetStyle());
+            totalTimeInSecs += BlammoTime::GetHighResolutionTimeInSecs() - startTime;
+            if (!success) {
+                return -1.0;
+            }
+
+            HashLevel(checksum, *level);
+            level->UnloadPieces();
+        }
+    }
+
+    return totalTimeInSecs;
+}
+
+LevelPackCompiler::LevelPackCompiler(const std::string& outputFilepath, size_t numLoadRepetitions) : 
+outputFilepath(outputFilepath), numLoadRepetitions(std::max<size_t>(1, numLoadRepetitions)) {
+}
+
+bool LevelPackCompiler::Run(GameModel& model, std::ostream& out) const {
+    // Compile everything from the text files...
+    double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+    LevelPack* compiledPack = LevelPack::CompileFromText(model.GetWorldDefinitionFilepath(), 
+        GameModelConstants::GetInstance()->GetResourceWorldDir());
+    double compileTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs() - startTime;
+
+    if (compiledPack == NULL) {
+        out << "Failed to compile the worlds in " << model.GetWorldDefinitionFilepath() << std::endl;
+        return false;
+    }
+
+    bool success = compiledPack->WriteToFile(this->outputFilepath);
+    out << "Compiled " << compiledPack->GetNumWorlds() << " world(s) and " << compiledPack->GetNumLevels() 
+        << " level(s) in " << compileTimeInSecs << "s" << std::endl;
+    if (!success) {
+        out << "Failed to write the level pack to " << this->outputFilepath << std::endl;
+        delete compiledPack;
+        return false;
+    }
+
+    // ... and read the pack back in exactly as the game will
+    std::ifstream inFile(this->outputFilepath.c_str(), std::ios::in | std::ios::binary);
+    std::vector<char> packBytes((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+    inFile.close();
+
+    LevelPack* loadedPack = new LevelPack();
+    success = !packBytes.empty() && loadedPack->ReadFromMemory(&packBytes[0], packBytes.size()) &&
+        loadedPack->GetNumWorlds() == compiledPack->GetNumWorlds() && loadedPack->GetNumLevels() == compiledPack->GetNumLevels();
+    delete compiledPack;
+    compiledPack = NULL;
+
+    if (!success) {
+        out << "Failed to read back the level pack from " << this->outputFilepath << std::endl;
+        delete loadedPack;
+        return false;
+    }
+    out << "Wrote " << packBytes.size() << " bytes to " << this->outputFilepath << std::endl;
+
+    // Time loading all of the worlds from their text files and then from the pack
+    double textTimeInSecs = 0.0;
+    double packTimeInSecs = 0.0;
+    unsigned long textChecksum = 0;
+    unsigned long packChecksum = 0;
+
+    for (size_t i = 0; i < this->numLoadRepetitions && success; i++) {
+        model.SetLevelPack(NULL);
+        double loadTimeInSecs = LoadAllWorlds(model, textChecksum);
+        success = (loadTimeInSecs >= 0.0);
+        textTimeInSecs += loadTimeInSecs;
+    }
+
+    model.SetLevelPack(loadedPack);
+    loadedPack = NULL;
+
+    for (size_t i = 0; i < this->numLoadRepetitions && success; i++) {
+        double loadTimeInSecs = LoadAllWorlds(model, packChecksum);
+        success = (loadTimeInSecs >= 0.0);
+        packTimeInSecs += loadTimeInSecs;
+    }
+
+    if (!success) {
+        out << "Failed to load the worlds" << std::endl;
+        return false;
+    }
+
+    textTimeInSecs /= static_cast<double>(this->numLoadRepetitions);
+    packTimeInSecs /= static_cast<double>(this->numLoadRepetitions);
+    out << "Load all worlds (mean of " << this->numLoadRepetitions << "): "
+        << "text=" << 1000.0 * textTimeInSecs << "ms"
+        << ", pack=" << 1000.0 * packTimeInSecs << "ms"
+        << ", saved=" << 1000.0 * (textTimeInSecs - packTimeInSecs) << "ms"
+        << ", checksum=" << (textChecksum == packChecksum ? "match" : "MISMATCH")
+        << std::endl;
+
+    return (textChecksum == packChecksum);
+}
@@ -0,0 +1,150 @@
+/**
+ * LevelRestartBenchmark.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "LevelRestartBenchmark.h"
+#include "PaddleInputDriver.h"
+#include "TickTimingStats.h"
+
+#include "../BlammoEngine/BlammoTime.h"
+
+#include "../GameModel/GameModel.h"
+#include "../GameModel/GameEventManager.h"
+#include "../GameModel/PortalBlock.h"
+
+// The level is played for this many ticks before each restart so that there's something to undo
+static const size_t NUM_TICKS_BEFORE_RESTART = 120;
+
+static void HashValue(unsigned long& hash, unsigned long value) {
+    hash = (hash ^ value) * 16777619UL;
+}
+
+// Checksums the state of a level that a restart has to bring back
+static unsigned long HashLevelState(const GameLevel& level) {
+    unsigned long hash = 2166136261UL;
+    HashValue(hash, static_cast<unsigned long>(level.GetNumPiecesLeft()));
+    HashValue(hash, level.GetBoss() != NULL ? 1 : 0);
+
+    const std::vector<std::vector<LevelPiece*> >& pieces = level.GetCurrentLevelLayout();
+    for (size_t h = 0; h < pieces.size(); h++) {
+        for (size_t w = 0; w < pieces[h].size(); w++) {
+            const LevelPiece* piece = pieces[h][w];
+            HashValue(hash, piece->GetType());
+            HashValue(hash, static_cast<unsigned long>(piece->GetTriggerID()));
+            if (piece->GetHasTriggerID()) {
+                const std::vector<LevelPiece*>* triggerPieces = level.GetTriggerableLevelPieces(piece->GetTriggerID());
+                HashValue(hash, triggerPieces == NULL ? 0 : static_cast<unsigned long>(triggerPieces->size()));
+            }
+            if (piece->GetType() == LevelPiece::Portal) {
+                const PortalBlock* sibling = static_cast<const PortalBlock*>(piece)->GetSiblingPortal();
+                HashValue(hash, static_cast<unsigned long>(sibling->GetWidthIndex()));
+                HashValue(hash, static_cast<unsigned long>(sibling->GetHeightIndex()));
+            }
+        }
+    }
+    return hash;
+}
+
+// Re-parses every level in the given world, which is what restarting a level used to cost
+static double TimeWorldReparse(GameModel& model, const GameWorld& world) {
+    double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+    const std::vector<GameLevel*>& levels = world.GetAllLevelsInWorld();
+    for (size_t i = 0; i < levels.size(); i++) {
+        GameLevel* level = GameLevel::CreateGameLevelFromFile(&model, i, levels[i]->GetNumStarsRequiredToUnlock(),
+            levels[i]->GetFilepath());
+        delete level;
+    }
+    return BlammoTime::GetHighResolutionTimeInSecs() - startTime;
+}
+
+LevelRestartBenchmark::LevelRestartBenchmark(size_t numRestarts, int worldIdx, int levelIdx, double dT) :
+numRestarts(numRestarts), worldIdx(worldIdx), levelIdx(levelIdx), dT(dT) {
+    assert(numRestarts > 0);
+    assert(dT > 0.0);
+}
+
+bool LevelRestartBenchmark::Run(GameModel& model, PaddleInputDriver& input, std::ostream& out) const {
+    out << "Level restarts: " << this->numRestarts << " restart(s) per level, " << NUM_TICKS_BEFORE_RESTART 
+        << " ticks played before each" << std::endl;
+
+    TickTimingStats restartStats;
+    TickTimingStats reparseStats;
+    restartStats.Reserve(this->numRestarts);
+    reparseStats.Reserve(this->numRestarts);
+
+    bool isCorrect = true;
+    size_t tickID = 1;
+    for (int worldIdx = 0; worldIdx <= model.GetLastWorldIndex(); worldIdx++) {
+        if (this->worldIdx >= 0 && worldIdx != this->worldIdx) {
+            continue;
+        }
+        const GameWorld* world = model.GetWorldByIndex(worldIdx);
+        for (int levelIdx = 0; levelIdx < static_cast<int>(world->GetNumLevels()); levelIdx++) {
+            if (this->levelIdx >= 0 && levelIdx != this->levelIdx) {
+                continue;
+            }
+
+            model.StartGameAtWorldAndLevel(worldIdx, levelIdx);
+            input.Reset();
+            unsigned long startHash = HashLevelState(*model.GetCurrentLevel());
+
+            for (size_t restart = 0; restart < this->numRestarts; restart++) {
+                for (size_t i = 0; i < NUM_TICKS_BEFORE_RESTART; i++, tickID++) {
+                    input.ApplyInput(model, tickID, this->dT);
+                    model.Tick(this->dT * model.GetTimeDialationFactor());
+                    model.UpdateState();
+                    GameEventManager::Instance()->DispatchDeferredEvents();
+                }
+
+                double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+                model.ResetCurrentLevel();
+                restartStats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+                model.UpdateState();
+                input.Reset();
+
+                reparseStats.AddTickTime(TimeWorldReparse(model, *world));
+
+                if (HashLevelState(*model.GetCurrentLevel()) != startHash) {
+                    out << "  " << world->GetName() << " [" << worldIdx << ", " << levelIdx 
+                        << "] was restarted with different pieces than it started with" << std::endl;
+                    isCorrect = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    restartStats.WriteSummary(out, "Restart from template");
+    reparseStats.WriteSummary(out, "World re-parse (previous restart cost)");
+    if (restartStats.GetTotalTimeInSecs() > 0.0) {
+        out << "Restart speedup: " << reparseStats.GetTotalTimeInSecs() / restartStats.GetTotalTimeInSecs() << "x" << std::endl;
+    }
+    return isCorrect;
+}
@@ -0,0 +1,63 @@
+/**
+ * LevelRestartBenchmark.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __LEVELRESTARTBENCHMARK_H__
+#define __LEVELRESTARTBENCHMARK_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+class GameModel;
+class PaddleInputDriver;
+
+/**
+ * Benchmark and check for restarting levels (GameModel::ResetCurrentLevel): every level that's run is
+ * started, played for a little while and then restarted the given number of times. Each restart is timed
+ * and compared against the cost of re-parsing the level's world (which is what a restart used to do), and
+ * the restarted level is checked to have the exact same pieces, portals, triggers and boss as it had when
+ * it was first started.
+ */
+class LevelRestartBenchmark {
+public:
+    LevelRestartBenchmark(size_t numRestarts, int worldIdx, int levelIdx, double dT);
+    ~LevelRestartBenchmark() {}
+
+    bool Run(GameModel& model, PaddleInputDriver& input, std::ostream& out) const;
+
+private:
+    size_t numRestarts;
+    int worldIdx;
+    int levelIdx;
+    double dT;
+
+    DISALLOW_COPY_AND_ASSIGN(LevelRestartBenchmark);
+};
+
+#endif // __LEVELRESTARTBENCHMARK_H__
@@ -0,0 +1,193 @@
+/**
+ * MathBenchmark.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "MathBenchmark.h"
+
+#include "../BlammoEngine/Algebra.h"
+#include "../BlammoEngine/BlammoTime.h"
+#include "../BlammoEngine/BatchMath.h"
+#include "../BlammoEngine/Matrix.h"
+
+// All the data that the benchmark cases work on, every case transforms it in place
+struct MathBenchmarkData {
+    Matrix4x4 transform;
+    std::vector<Matrix4x4> matrices;
+    std::vector<Point3D> pts3D;
+    std::vector<Vector3D> vecs3D;
+    std::vector<Point2D> pts2D;
+    std::vector<Vector2D> vecs2D;
+};
+
+typedef void (*MathBenchmarkFunc)(MathBenchmarkData& data);
+
+struct MathBenchmarkCase {
+    const char* name;
+    MathBenchmarkFunc func;
+};
+
+static const float ROTATION_ANGLE_IN_DEGS = 0.5f;
+
+static void MatrixMultiplyScalar(MathBenchmarkData& data) {
+    Matrix4x4 temp;
+    for (size_t i = 0; i < data.matrices.size(); i++) {
+        BatchMath::MultiplyMatrix4x4Scalar(data.transform.begin(), data.matrices[i].begin(), &temp[0]);
+        data.matrices[i] = temp;
+    }
+}
+static void MatrixMultiplyBatch(MathBenchmarkData& data) {
+    Matrix4x4 temp;
+    for (size_t i = 0; i < data.matrices.size(); i++) {
+        BatchMath::MultiplyMatrix4x4(data.transform.begin(), data.matrices[i].begin(), &temp[0]);
+        data.matrices[i] = temp;
+    }
+}
+
+static void TransformPoints3DOperator(MathBenchmarkData& data) {
+    for (size_t i = 0; i < data.pts3D.size(); i++) {
+        data.pts3D[i] = data.transform * data.pts3D[i];
+    }
+}
+static void TransformPoints3DBatch(MathBenchmarkData& data) {
+    BatchMath::TransformPoints(data.transform, &data.pts3D[0], data.pts3D.size());
+}
+
+static void TransformVectors3DOperator(MathBenchmarkData& data) {
+    for (size_t i = 0; i < data.vecs3D.size(); i++) {
+        data.vecs3D[i] = data.transform * data.vecs3D[i];
+    }
+}
+static void TransformVectors3DBatch(MathBenchmarkData& data) {
+    BatchMath::TransformVectors(data.transform, &data.vecs3D[0], data.vecs3D.size());
+}
+
+static void TransformPoints2DOperator(MathBenchmarkData& data) {
+    for (size_t i = 0; i < data.pts2D.size(); i++) {
+        data.pts2D[i] = data.transform * data.pts2D[i];
+    }
+}
+static void TransformPoints2DBatch(MathBenchmarkData& data) {
+    BatchMath::TransformPoints(data.transform, &data.pts2D[0], data.pts2D.size());
+}
+
+static void RotateVectors2DOperator(MathBenchmarkData& data) {
+    for (size_t i = 0; i < data.vecs2D.size(); i++) {
+        data.vecs2D[i].Rotate(ROTATION_ANGLE_IN_DEGS);
+    }
+}
+static void RotateVectors2DBatch(MathBenchmarkData& data) {
+    BatchMath::RotateVectors(ROTATION_ANGLE_IN_DEGS, &data.vecs2D[0], data.vecs2D.size());
+}
+
+// Pairs of (per-element, batched) cases over the same data
+static const MathBenchmarkCase BENCHMARK_CASES[] = {
+    { "Matrix4x4 multiply/scalar",   MatrixMultiplyScalar },
+    { "Matrix4x4 multiply/batch",    MatrixMultiplyBatch },
+    { "Point3D transform/operator",  TransformPoints3DOperator },
+    { "Point3D transform/batch",     TransformPoints3DBatch },
+    { "Vector3D transform/operator", TransformVectors3DOperator },
+    { "Vector3D transform/batch",    TransformVectors3DBatch },
+    { "Point2D transform/operator",  TransformPoints2DOperator },
+    { "Point2D transform/batch",     TransformPoints2DBatch },
+    { "Vector2D rotate/operator",    RotateVectors2DOperator },
+    { "Vector2D rotate/batch",       RotateVectors2DBatch }
+};
+static const size_t NUM_BENCHMARK_CASES = sizeof(BENCHMARK_CASES) / sizeof(BENCHMARK_CASES[0]);
+
+static float RandomFloat() {
+    return static_cast<float>(Randomizer::GetInstance()->RandomNumNegOneToOne());
+}
+
+static void BuildData(unsigned int numItems, MathBenchmarkData& data) {
+    // Keep the transform close to a rotation so that repeated application doesn't blow up
+    data.transform = Matrix4x4::rotationMatrix('z', 0.25f) * Matrix4x4::rotationMatrix('x', 0.25f);
+
+    data.matrices.clear();
+    data.pts3D.clear();
+    data.vecs3D.clear();
+    data.pts2D.clear();
+    data.vecs2D.clear();
+    for (unsigned int i = 0; i < numItems; i++) {
+        data.matrices.push_back(Matrix4x4::translationMatrix(Vector3D(RandomFloat(), RandomFloat(), RandomFloat())));
+        data.pts3D.push_back(Point3D(RandomFloat(), RandomFloat(), RandomFloat()));
+        data.vecs3D.push_back(Vector3D(RandomFloat(), RandomFloat(), RandomFloat()));
+        data.pts2D.push_back(Point2D(RandomFloat(), RandomFloat()));
+        data.vecs2D.push_back(Vector2D(RandomFloat(), RandomFloat()));
+    }
+}
+
+// Sum of all the data, printed so that none of the work can be optimized away and so that
+// the per-element and batched cases can be compared
+static double Checksum(const MathBenchmarkData& data) {
+    double sum = 0.0;
+    for (size_t i = 0; i < data.matrices.size(); i++) {
+        for (int j = 0; j < 16; j++) {
+            sum += data.matrices[i][j];
+        }
+        sum += data.pts3D[i][0] + data.pts3D[i][1] + data.pts3D[i][2];
+        sum += data.vecs3D[i][0] + data.vecs3D[i][1] + data.vecs3D[i][2];
+        sum += data.pts2D[i][0] + data.pts2D[i][1];
+        sum += data.vecs2D[i][0] + data.vecs2D[i][1];
+    }
+    return sum;
+}
+
+MathBenchmark::MathBenchmark(unsigned int numItems, size_t numIterations, unsigned long seed) :
+numItems(numItems), numIterations(numIterations), seed(seed) {
+    assert(numItems > 0);
+    assert(numIterations > 0);
+}
+
+void MathBenchmark::Run(std::ostream& out) const {
+    out << "BatchMath: items=" << this->numItems << ", iterations=" << this->numIterations 
+        << ", simd=" << (BatchMath::IsSIMDEnabled() ? "on" : "off") << std::endl;
+
+    MathBenchmarkData data;
+    for (size_t i = 0; i < NUM_BENCHMARK_CASES; i++) {
+        const MathBenchmarkCase& currCase = BENCHMARK_CASES[i];
+
+        // Every case starts from the same data
+        Randomizer::GetInstance()->SetSeed(this->seed);
+        BuildData(this->numItems, data);
+
+        double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        for (size_t j = 0; j < this->numIterations; j++) {
+            currCase.func(data);
+        }
+        double totalTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs() - startTime;
+
+        double numItemsProcessed = static_cast<double>(this->numItems) * static_cast<double>(this->numIterations);
+        out << currCase.name << ": "
+            << "ns/item="    << 1e9 * totalTimeInSecs / numItemsProcessed
+            << ", items/s="  << (totalTimeInSecs > 0.0 ? numItemsProcessed / totalTimeInSecs : 0.0)
+            << ", checksum=" << Checksum(data)
+            << std::endl;
+    }
+}
@@ -0,0 +1,273 @@
+/**
+ * MeshPackCompiler.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "MeshPackCompiler.h"
+
+#include "../BlammoEngine/BlammoTime.h"
+#include "../BlammoEngine/Mesh.h"
+#include "../BlammoEngine/MeshPack.h"
+#include "../BlammoEngine/ObjReader.h"
+
+#include "../GameView/GameViewConstants.h"
+
+#include "../ResourceManager.h"
+
+static bool IsObjFilepath(const std::string& filepath) {
+    static const std::string OBJ_FILE_EXTENSION(".obj");
+    if (filepath.size() < OBJ_FILE_EXTENSION.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < OBJ_FILE_EXTENSION.size(); i++) {
+        if (tolower(filepath[filepath.size() - OBJ_FILE_EXTENSION.size() + i]) != OBJ_FILE_EXTENSION[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Recursively finds every .obj file under the given directory of the resource archive
+static void FindObjFiles(const std::string& dir, std::vector<std::string>& filepaths) {
+    char** filenames = PHYSFS_enumerateFiles(dir.c_str());
+    if (filenames == NULL) {
+        return;
+    }
+    for (char** currFilename = filenames; *currFilename != NULL; ++currFilename) {
+        std::string currFilepath = dir + std::string("/") + std::string(*currFilename);
+        if (PHYSFS_isDirectory(currFilepath.c_str())) {
+            FindObjFiles(currFilepath, filepaths);
+        }
+        else if (IsObjFilepath(currFilepath)) {
+            filepaths.push_back(currFilepath);
+        }
+    }
+    PHYSFS_freeList(filenames);
+}
+
+// Reads and parses an obj file the same way that the resource manager does when there's no mesh pack,
+// the contents of the file are also handed back through objFileContents when it's given
+static bool ParseObjFile(const std::string& filepath, ObjMeshData& meshData, std::string* objFileContents = NULL) {
+    long length = 0;
+    char* buffer = ResourceManager::FilepathToMemoryBuffer(filepath, length);
+    if (buffer == NULL) {
+        return false;
+    }
+    std::istringstream inStream(std::string(buffer, length), std::ios_base::in | std::ios_base::binary);
+    if (objFileContents != NULL) {
+        objFileContents->assign(buffer, length);
+    }
+    delete[] buffer;
+    buffer = NULL;
+
+    return ObjReader::ParseMeshFromStream(filepath, inStream, meshData) && !meshData.mtlFilepath.empty();
+}
+
+static bool ReadFileBytes(const std::string& filepath, std::vector<char>& bytes) {
+    std::ifstream inFile(filepath.c_str(), std::ios::in | std::ios::binary);
+    if (!inFile.is_open()) {
+        return false;
+    }
+    bytes.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+    return !bytes.empty();
+}
+
+// Expands the geometry of each material group into a polygon group exactly as building the mesh would,
+// the groups are in material order with NULL for any material without faces
+static void ExpandObjGeometry(const ObjMeshData& meshData, std::vector<PolygonGroup*>& polyGrps) {
+    polyGrps.clear();
+    for (size_t i = 0; i < meshData.materialNames.size(); i++) {
+        std::map<std::string, PolyGrpIndexer>::const_iterator findIter = meshData.polyGrps.find(meshData.materialNames[i]);
+        polyGrps.push_back(findIter == meshData.polyGrps.end() ? NULL :
+            new PolygonGroup(findIter->second, meshData.vertices, meshData.normals, meshData.texCoords));
+    }
+}
+static void ExpandPackedGeometry(const CompiledMesh& mesh, std::vector<PolygonGroup*>& polyGrps) {
+    polyGrps.clear();
+    for (size_t i = 0; i < mesh.materialGeometry.size(); i++) {
+        const CompiledMesh::MaterialGeometry& geometry = mesh.materialGeometry[i];
+        polyGrps.push_back(geometry.indices.empty() ? NULL : new PolygonGroup(geometry.polyType, 
+            &geometry.vertices[0], geometry.GetNumVertices(), &geometry.indices[0], geometry.indices.size()));
+    }
+}
+static void DeletePolygonGroups(std::vector<PolygonGroup*>& polyGrps) {
+    for (size_t i = 0; i < polyGrps.size(); i++) {
+        delete polyGrps[i];
+    }
+    polyGrps.clear();
+}
+
+// The geometry must be bit-for-bit the same since the pack only reorders where the vertices are stored
+static bool PolygonGroupsMatch(const PolygonGroup* a, const PolygonGroup* b) {
+    if (a == NULL || b == NULL) {
+        return a == b;
+    }
+    if (a->GetPolygonType() != b->GetPolygonType() || a->GetVertexStream().size() != b->GetVertexStream().size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a->GetVertexStream().size(); i++) {
+        const Point3D& aVertex    = a->GetVertexStream()[i];
+        const Point3D& bVertex    = b->GetVertexStream()[i];
+        const Vector3D& aNormal   = a->GetNormalStream()[i];
+        const Vector3D& bNormal   = b->GetNormalStream()[i];
+        const Point2D& aTexCoord  = a->GetTexCoordStream()[i];
+        const Point2D& bTexCoord  = b->GetTexCoordStream()[i];
+        if (aVertex[0] != bVertex[0] || aVertex[1] != bVertex[1] || aVertex[2] != bVertex[2] ||
+            aNormal[0] != bNormal[0] || aNormal[1] != bNormal[1] || aNormal[2] != bNormal[2] ||
+            aTexCoord[0] != bTexCoord[0] || aTexCoord[1] != bTexCoord[1]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+MeshPackCompiler::MeshPackCompiler(const std::string& outputFilepath, size_t numLoadRepetitions) : 
+outputFilepath(outputFilepath), numLoadRepetitions(std::max<size_t>(1, numLoadRepetitions)) {
+}
+
+bool MeshPackCompiler::Run(std::ostream& out) const {
+    const std::string meshDir(GameViewConstants::GetInstance()->MESH_DIR);
+    std::vector<std::string> objFilepaths;
+    FindObjFiles(meshDir, objFilepaths);
+    std::sort(objFilepaths.begin(), objFilepaths.end());
+    if (objFilepaths.empty()) {
+        out << "No obj files found under " << meshDir << std::endl;
+        return false;
+    }
+
+    // Compile every obj file, any that can't be compiled are left out and will keep loading from their obj files
+    MeshPack compiledPack;
+    size_t numObjVertices = 0;
+    size_t numPackedVertices = 0;
+
+    double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+    for (size_t i = 0; i < objFilepaths.size(); i++) {
+        ObjMeshData meshData;
+        CompiledMesh mesh;
+        std::string objFileContents;
+        if (!ParseObjFile(objFilepaths[i], meshData, &objFileContents) ||
+            !CompiledMesh::CompileFromObj(objFilepaths[i], objFileContents.data(), objFileContents.size(), meshData, mesh)) {
+            out << "Skipped (will load from obj): " << objFilepaths[i] << std::endl;
+            continue;
+        }
+
+        for (size_t j = 0; j < mesh.materialGeometry.size(); j++) {
+            numObjVertices    += mesh.materialGeometry[j].indices.size();
+            numPackedVertices += mesh.materialGeometry[j].GetNumVertices();
+        }
+        compiledPack.AddMesh(mesh);
+    }
+    double compileTimeInSecs = BlammoTime::GetHighResolutionTimeInSecs() - startTime;
+
+    out << "Compiled " << compiledPack.GetNumMeshes() << " of " << objFilepaths.size() << " mesh(es) in " 
+        << compileTimeInSecs << "s, " << numObjVertices << " face vertices -> " << numPackedVertices << " unique vertices" << std::endl;
+    if (!compiledPack.WriteToFile(this->outputFilepath)) {
+        out << "Failed to write the mesh pack to " << this->outputFilepath << std::endl;
+        return false;
+    }
+
+    // Read the pack back in exactly as the game will...
+    std::vector<char> packBytes;
+    MeshPack loadedPack;
+    if (!ReadFileBytes(this->outputFilepath, packBytes) || !loadedPack.ReadFromMemory(&packBytes[0], packBytes.size()) ||
+        loadedPack.GetNumMeshes() != compiledPack.GetNumMeshes()) {
+        out << "Failed to read back the mesh pack from " << this->outputFilepath << std::endl;
+        return false;
+    }
+    out << "Wrote " << packBytes.size() << " bytes to " << this->outputFilepath << std::endl;
+
+    // ... and make sure every mesh in it gives the same geometry as its obj file
+    size_t numMismatches = 0;
+    for (size_t i = 0; i < loadedPack.GetNumMeshes(); i++) {
+        const CompiledMesh& mesh = loadedPack.GetMeshAt(i);
+        ObjMeshData meshData;
+        if (!ParseObjFile(mesh.objFilepath, meshData)) {
+            numMismatches++;
+            continue;
+        }
+
+        std::vector<PolygonGroup*> objPolyGrps;
+        std::vector<PolygonGroup*> packPolyGrps;
+        ExpandObjGeometry(meshData, objPolyGrps);
+        ExpandPackedGeometry(mesh, packPolyGrps);
+
+        bool isMatch = (mesh.mtlFilepath == meshData.mtlFilepath) && (objPolyGrps.size() == packPolyGrps.size());
+        for (size_t j = 0; j < objPolyGrps.size() && isMatch; j++) {
+            isMatch = (mesh.materialGeometry[j].materialName == meshData.materialNames[j]) &&
+                PolygonGroupsMatch(objPolyGrps[j], packPolyGrps[j]);
+        }
+        if (!isMatch) {
+            out << "Geometry mismatch: " << mesh.objFilepath << std::endl;
+            numMismatches++;
+        }
+
+        DeletePolygonGroups(objPolyGrps);
+        DeletePolygonGroups(packPolyGrps);
+    }
+
+    // Time getting the geometry of all the packed meshes from their obj files and then from the pack,
+    // for the pack this includes reading and decoding the whole file
+    double objTimeInSecs  = 0.0;
+    double packTimeInSecs = 0.0;
+    std::vector<PolygonGroup*> polyGrps;
+
+    for (size_t i = 0; i < this->numLoadRepetitions; i++) {
+        for (size_t j = 0; j < loadedPack.GetNumMeshes(); j++) {
+            startTime = BlammoTime::GetHighResolutionTimeInSecs();
+            ObjMeshData meshData;
+            ParseObjFile(loadedPack.GetMeshAt(j).objFilepath, meshData);
+            ExpandObjGeometry(meshData, polyGrps);
+            objTimeInSecs += BlammoTime::GetHighResolutionTimeInSecs() - startTime;
+            DeletePolygonGroups(polyGrps);
+        }
+
+        startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        MeshPack timedPack;
+        ReadFileBytes(this->outputFilepath, packBytes);
+        timedPack.ReadFromMemory(&packBytes[0], packBytes.size());
+        std::vector<PolygonGroup*> allPolyGrps;
+        for (size_t j = 0; j < timedPack.GetNumMeshes(); j++) {
+            ExpandPackedGeometry(timedPack.GetMeshAt(j), polyGrps);
+            allPolyGrps.insert(allPolyGrps.end(), polyGrps.begin(), polyGrps.end());
+        }
+        packTimeInSecs += BlammoTime::GetHighResolutionTimeInSecs() - startTime;
+        DeletePolygonGroups(allPolyGrps);
+    }
+
+    objTimeInSecs  /= static_cast<double>(this->numLoadRepetitions);
+    packTimeInSecs /= static_cast<double>(this->numLoadRepetitions);
+    out << "Load all mesh geometry (mean of " << this->numLoadRepetitions << "): "
+        << "obj=" << 1000.0 * objTimeInSecs << "ms"
+        << ", pack=" << 1000.0 * packTimeInSecs << "ms"
+        << ", saved=" << 1000.0 * (objTimeInSecs - packTimeInSecs) << "ms"
+        << ", geometry=" << (numMismatches == 0 ? "match" : "MISMATCH")
+        << std::endl;
+
+    return (numMismatches == 0);
+}
@@ -0,0 +1,57 @@
+/**
+ * MeshPackCompiler.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MESHPACKCOMPILER_H__
+#define __MESHPACKCOMPILER_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+/**
+ * Offline compiler for the game's mesh pack: parses every .obj file in the resource archive's mesh
+ * directory, compiles them into the binary pack, writes it, reads it back and checks that every material
+ * group expands to exactly the same geometry as its obj file. It then reports how long getting the
+ * geometry of all the meshes takes from their obj files versus from the pack.
+ */
+class MeshPackCompiler {
+public:
+    MeshPackCompiler(const std::string& outputFilepath, size_t numLoadRepetitions);
+    ~MeshPackCompiler() {}
+
+    bool Run(std::ostream& out) const;
+
+private:
+    std::string outputFilepath;
+    size_t numLoadRepetitions;
+
+    DISALLOW_COPY_AND_ASSIGN(MeshPackCompiler);
+};
+
+#endif // __MESHPACKCOMPILER_H__
@@ -0,0 +1,248 @@
+/**
+ * PaddleInputDriver.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "PaddleInputDriver.h"
+
+#include "../BlammoEngine/Algebra.h"
+
+#include "../GameModel/GameModel.h"
+#include "../GameModel/PlayerPaddle.h"
+#include "../GameModel/GameBall.h"
+
+PaddleInputDriver* PaddleInputDriver::Build(const DriverType& type, const std::string& scriptFilepath) {
+    switch (type) {
+
+        case PaddleInputDriver::RandomDriver:
+            return new RandomPaddleInputDriver();
+
+        case PaddleInputDriver::TrackingDriver:
+            return new TrackingPaddleInputDriver();
+
+        case PaddleInputDriver::ScriptedDriver: {
+            ScriptedPaddleInputDriver* driver = new ScriptedPaddleInputDriver();
+            if (!driver->LoadScript(scriptFilepath)) {
+                delete driver;
+                return NULL;
+            }
+            return driver;
+        }
+
+        default:
+            assert(false);
+            break;
+    }
+
+    return NULL;
+}
+
+bool PaddleInputDriver::StringToDriverType(const std::string& str, DriverType& type) {
+    if (str == "random") {
+        type = PaddleInputDriver::RandomDriver;
+    }
+    else if (str == "track") {
+        type = PaddleInputDriver::TrackingDriver;
+    }
+    else if (str == "script") {
+        type = PaddleInputDriver::ScriptedDriver;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+const double RandomPaddleInputDriver::SHOOT_PROBABILITY_PER_TICK = 0.02;
+
+void RandomPaddleInputDriver::Reset() {
+    this->currDir = 0;
+    this->ticksUntilDirChange = 0;
+}
+
+void RandomPaddleInputDriver::ApplyInput(GameModel& model, size_t tickID, double dT) {
+    UNUSED_PARAMETER(dT);
+    Randomizer* randomizer = Randomizer::GetInstance();
+
+    if (this->ticksUntilDirChange <= 0) {
+        this->currDir = static_cast<int>(randomizer->RandomUnsignedInt() % 3) - 1;
+        this->ticksUntilDirChange = 1 + static_cast<int>(randomizer->RandomUnsignedInt() % MAX_TICKS_TO_HOLD_DIR);
+    }
+    this->ticksUntilDirChange--;
+
+    model.MovePaddle(tickID, this->currDir);
+    if (randomizer->RandomNumZeroToOne() < SHOOT_PROBABILITY_PER_TICK) {
+        model.ShootActionReleaseUse();
+    }
+}
+
+void TrackingPaddleInputDriver::ApplyInput(GameModel& model, size_t tickID, double dT) {
+    UNUSED_PARAMETER(dT);
+
+    const PlayerPaddle* paddle = model.GetPlayerPaddle();
+    if (paddle == NULL) {
+        return;
+    }
+    if (paddle->HasBallAttached()) {
+        model.MovePaddle(tickID, 0);
+        model.ShootActionReleaseUse();
+        return;
+    }
+
+    // Find the lowest ball that's on its way down towards the paddle
+    const GameBall* targetBall = NULL;
+    const std::list<GameBall*>& balls = model.GetGameBalls();
+    for (std::list<GameBall*>::const_iterator iter = balls.begin(); iter != balls.end(); ++iter) {
+        const GameBall* currBall = *iter;
+        if (currBall->GetVelocity()[1] > 0.0f) {
+            continue;
+        }
+        if (targetBall == NULL || currBall->GetCenterPosition2D()[1] < targetBall->GetCenterPosition2D()[1]) {
+            targetBall = currBall;
+        }
+    }
+
+    int dir = 0;
+    if (targetBall != NULL) {
+        // Leave a bit of slack so the paddle doesn't jitter back and forth under the ball
+        float diffX = targetBall->GetCenterPosition2D()[0] - paddle->GetCenterPosition()[0];
+        float slack = 0.25f * paddle->GetHalfWidthTotal();
+        if (diffX > slack) {
+            dir = 1;
+        }
+        else if (diffX < -slack) {
+            dir = -1;
+        }
+    }
+
+    model.MovePaddle(tickID, dir);
+}
+
+bool ScriptedPaddleInputDriver::LoadScript(const std::string& filepath) {
+    std::ifstream inFile(filepath.c_str());
+    if (!inFile.good()) {
+        std::cerr << "Failed to open input script file: " << filepath << std::endl;
+        return false;
+    }
+
+    this->commands.clear();
+
+    std::string line;
+    int lineNum = 0;
+    while (std::getline(inFile, line)) {
+        lineNum++;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream lineStream(line);
+        ScriptCommand cmd;
+        std::string cmdStr;
+        cmd.x = 0.0f;
+        cmd.y = 0.0f;
+
+        if (!(lineStream >> cmd.tick >> cmdStr)) {
+            std::cerr << "Malformed input script line " << lineNum << ": " << line << std::endl;
+            return false;
+        }
+
+        if (cmdStr == "move") {
+            int dir = 0;
+            if (!(lineStream >> dir) || dir < -1 || dir > 1) {
+                std::cerr << "Invalid move direction on input script line " << lineNum << std::endl;
+                return false;
+            }
+            cmd.type = ScriptedPaddleInputDriver::MoveCmd;
+            cmd.x = static_cast<float>(dir);
+        }
+        else if (cmdStr == "shoot") {
+            cmd.type = ScriptedPaddleInputDriver::ShootCmd;
+        }
+        else if (cmdStr == "boost") {
+            if (!(lineStream >> cmd.x >> cmd.y)) {
+                std::cerr << "Invalid boost direction on input script line " << lineNum << std::endl;
+                return false;
+            }
+            cmd.type = ScriptedPaddleInputDriver::BoostCmd;
+        }
+        else if (cmdStr == "boostrelease") {
+            cmd.type = ScriptedPaddleInputDriver::BoostReleaseCmd;
+        }
+        else {
+            std::cerr << "Unknown command '" << cmdStr << "' on input script line " << lineNum << std::endl;
+            return false;
+        }
+
+        if (!this->commands.empty() && cmd.tick < this->commands.back().tick) {
+            std::cerr << "Input script commands must be in tick order (line " << lineNum << ")" << std::endl;
+            return false;
+        }
+        this->commands.push_back(cmd);
+    }
+
+    this->Reset();
+    return true;
+}
+
+void ScriptedPaddleInputDriver::Reset() {
+    this->nextCmdIdx = 0;
+    this->levelTickCount = 0;
+    this->currDir = 0;
+}
+
+void ScriptedPaddleInputDriver::ApplyInput(GameModel& model, size_t tickID, double dT) {
+    UNUSED_PARAMETER(dT);
+
+    while (this->nextCmdIdx < this->commands.size() && 
+           this->commands[this->nextCmdIdx].tick <= this->levelTickCount) {
+
+        const ScriptCommand& cmd = this->commands[this->nextCmdIdx];
+        switch (cmd.type) {
+            case ScriptedPaddleInputDriver::MoveCmd:
+                this->currDir = static_cast<int>(cmd.x);
+                break;
+            case ScriptedPaddleInputDriver::ShootCmd:
+                model.ShootActionReleaseUse();
+                break;
+            case ScriptedPaddleInputDriver::BoostCmd:
+                model.BallBoostDirectionPressed(cmd.x, cmd.y, true);
+                break;
+            case ScriptedPaddleInputDriver::BoostReleaseCmd:
+                model.BallBoostDirectionReleased();
+                break;
+            default:
+                assert(false);
+                break;
+        }
+        this->nextCmdIdx++;
+    }
+
+    model.MovePaddle(tickID, this->currDir);
+    this->levelTickCount++;
+}
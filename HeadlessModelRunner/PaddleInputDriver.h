@@ -0,0 +1,138 @@
+/**
+ * PaddleInputDriver.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __PADDLEINPUTDRIVER_H__
+#define __PADDLEINPUTDRIVER_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+class GameModel;
+
+/**
+ * Abstract stand-in for the game controllers when running the game model without
+ * a display: every tick the driver is asked to feed player input into the model.
+ */
+class PaddleInputDriver {
+public:
+    enum DriverType { RandomDriver, TrackingDriver, ScriptedDriver };
+
+    static PaddleInputDriver* Build(const DriverType& type, const std::string& scriptFilepath);
+    static bool StringToDriverType(const std::string& str, DriverType& type);
+
+    virtual ~PaddleInputDriver() {}
+
+    // Called once each time a level is (re)started
+    virtual void Reset() {}
+    // Called once per simulation tick, before the model is ticked
+    virtual void ApplyInput(GameModel& model, size_t tickID, double dT) = 0;
+
+protected:
+    PaddleInputDriver() {}
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(PaddleInputDriver);
+};
+
+/**
+ * Mashes buttons: holds a random paddle direction for a random number of ticks and
+ * randomly fires/releases. Uses the game's Randomizer so that runs are reproducible
+ * for a given seed.
+ */
+class RandomPaddleInputDriver : public PaddleInputDriver {
+public:
+    RandomPaddleInputDriver() : currDir(0), ticksUntilDirChange(0) {}
+    ~RandomPaddleInputDriver() {}
+
+    void Reset();
+    void ApplyInput(GameModel& model, size_t tickID, double dT);
+
+private:
+    static const int MAX_TICKS_TO_HOLD_DIR = 90;
+    static const double SHOOT_PROBABILITY_PER_TICK;
+
+    int currDir;
+    int ticksUntilDirChange;
+
+    DISALLOW_COPY_AND_ASSIGN(RandomPaddleInputDriver);
+};
+
+/**
+ * Plays the game (poorly, but plausibly): keeps the paddle under the lowest ball that
+ * is heading downwards and releases the ball whenever it's sitting on the paddle.
+ */
+class TrackingPaddleInputDriver : public PaddleInputDriver {
+public:
+    TrackingPaddleInputDriver() {}
+    ~TrackingPaddleInputDriver() {}
+
+    void ApplyInput(GameModel& model, size_t tickID, double dT);
+
+private:
+    DISALLOW_COPY_AND_ASSIGN(TrackingPaddleInputDriver);
+};
+
+/**
+ * Replays input from a plain text script, each line has the form
+ * "<tick> <command> [arguments]" where tick is relative to the start of the level.
+ * Commands are:
+ *  move <-1|0|1>       - Hold the paddle movement in the given direction until the next move command
+ *  shoot               - Release the ball/fire weapons
+ *  boost <x> <y>       - Press the ball boost direction
+ *  boostrelease        - Release the ball boost direction
+ * Lines beginning with '#' are comments.
+ */
+class ScriptedPaddleInputDriver : public PaddleInputDriver {
+public:
+    ScriptedPaddleInputDriver() : nextCmdIdx(0), levelTickCount(0), currDir(0) {}
+    ~ScriptedPaddleInputDriver() {}
+
+    bool LoadScript(const std::string& filepath);
+
+    void Reset();
+    void ApplyInput(GameModel& model, size_t tickID, double dT);
+
+private:
+    enum CommandType { MoveCmd, ShootCmd, BoostCmd, BoostReleaseCmd };
+    struct ScriptCommand {
+        size_t tick;
+        CommandType type;
+        float x, y;
+    };
+
+    std::vector<ScriptCommand> commands;
+    size_t nextCmdIdx;
+    size_t levelTickCount;
+    int currDir;
+
+    DISALLOW_COPY_AND_ASSIGN(ScriptedPaddleInputDriver);
+};
+
+#endif // __PADDLEINPUTDRIVER_H__
@@ -0,0 +1,112 @@
+/**
+ * ParticleBenchmark.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "ParticleBenchmark.h"
+#include "TickTimingStats.h"
+
+#include "../BlammoEngine/Algebra.h"
+#include "../BlammoEngine/BlammoTime.h"
+
+#include "../ESPEngine/ESPPointEmitter.h"
+#include "../ESPEngine/ESPParticleAccelEffector.h"
+#include "../ESPEngine/ESPParticleColourEffector.h"
+#include "../ESPEngine/ESPParticleScaleEffector.h"
+
+ParticleBenchmark::ParticleBenchmark(unsigned int numParticles, size_t numTicks, double dT, unsigned long seed) :
+numParticles(numParticles), numTicks(numTicks), dT(dT), seed(seed) {
+    assert(numParticles > 0);
+    assert(numTicks > 0);
+    assert(dT > 0.0);
+}
+
+// Time every tick of the given emitter (the particles all spawn on the first tick)
+static void TimeEmitterTicks(ESPEmitter& emitter, size_t numTicks, double dT, TickTimingStats& stats) {
+    stats.Reserve(numTicks);
+    for (size_t i = 0; i < numTicks; i++) {
+        double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        emitter.Tick(dT);
+        stats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+    }
+}
+
+void ParticleBenchmark::Run(std::ostream& out) const {
+    ESPParticleAccelEffector gravity(Vector3D(0.0f, -9.8f, 0.0f));
+    ESPParticleColourEffector fader(1.0f, 0.0f);
+    ESPParticleScaleEffector growth(1.0f, 2.0f);
+
+    // Lifetimes cover the whole run so that every particle is ticked on every tick
+    float runTimeInSecs = static_cast<float>(this->numTicks * this->dT);
+    ESPInterval lifetime(1.5f * runTimeInSecs, 2.0f * runTimeInSecs);
+
+    TickTimingStats stats[2];
+    for (int i = 0; i < 2; i++) {
+        bool isBatched = (i == 1);
+        Randomizer::GetPresentationInstance()->SetSeed(this->seed);
+
+        ESPPointEmitter emitter;
+        emitter.SetSpawnDelta(ESPInterval(ESPEmitter::ONLY_SPAWN_ONCE));
+        emitter.SetInitialSpd(ESPInterval(3.0f, 7.0f));
+        emitter.SetParticleLife(lifetime);
+        emitter.SetEmitAngleInDegrees(55);
+        emitter.SetParticleSize(ESPInterval(0.1f, 0.5f));
+        emitter.SetParticleRotation(ESPInterval(-180.0f, 180.0f));
+        emitter.SetRadiusDeviationFromCenter(ESPInterval(0.0f, 0.5f));
+        emitter.SetEmitPosition(Point3D(0, 0, 0));
+        emitter.SetEmitDirection(Vector3D(0, 1, 0));
+        emitter.AddEffector(&gravity);
+        emitter.AddEffector(&fader);
+        emitter.AddEffector(&growth);
+
+        // Nothing gets drawn so the particles are left untextured
+        if (isBatched) {
+            bool success = emitter.SetBatchedParticles(this->numParticles, NULL);
+            assert(success);
+            UNUSED_VARIABLE(success);
+        }
+        else {
+            for (unsigned int j = 0; j < this->numParticles; j++) {
+                emitter.AddParticle(new ESPParticle());
+            }
+        }
+
+        TimeEmitterTicks(emitter, this->numTicks, this->dT, stats[i]);
+    }
+
+    std::stringstream listLabel, batchedLabel;
+    listLabel    << "Particles (list, "    << this->numParticles << ")";
+    batchedLabel << "Particles (batched, " << this->numParticles << ")";
+    stats[0].WriteSummary(out, listLabel.str());
+    stats[1].WriteSummary(out, batchedLabel.str());
+
+    if (stats[1].GetTotalTimeInSecs() > 0.0) {
+        out << "Batched speedup: " << stats[0].GetTotalTimeInSecs() / stats[1].GetTotalTimeInSecs() << "x" << std::endl;
+    }
+}
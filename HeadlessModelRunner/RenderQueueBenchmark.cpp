@@ -0,0 +1,216 @@
+/**
+ * RenderQueueBenchmark.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "RenderQueueBenchmark.h"
+#include "TickTimingStats.h"
+
+#include "../BlammoEngine/Algebra.h"
+#include "../BlammoEngine/BlammoTime.h"
+#include "../BlammoEngine/Camera.h"
+#include "../BlammoEngine/RenderCommandQueue.h"
+
+// Each instance is drawn like a turret block: a few meshes that each have a couple of materials
+static const int NUM_MESHES_PER_INSTANCE    = 3;
+static const int NUM_MATERIALS_PER_MESH     = 2;
+static const int NUM_EFFECTS                = NUM_MESHES_PER_INSTANCE * NUM_MATERIALS_PER_MESH;
+// Cel shaded materials draw an outline pass and a shading pass
+static const int NUM_PASSES_PER_EFFECT      = 2;
+static const int NUM_COLUMNS                = 20;
+
+/**
+ * Null backend that also checks that the commands arrive in sort key order and that each
+ * effect is only set up once.
+ */
+class CheckingRenderBackend : public NullRenderBackend {
+public:
+    CheckingRenderBackend() : NullRenderBackend(NUM_PASSES_PER_EFFECT), currPassIdx(0), lastSortKey(0), isInOrder(true) {}
+
+    bool IsInOrder() const { return this->isInOrder; }
+    bool WasEachEffectBoundOnce() const { return this->boundEffects.size() == this->GetNumEffectBinds(); }
+
+    void BindEffect(CgFxEffectBase* effect, const Camera& camera) {
+        this->boundEffects.insert(effect);
+        NullRenderBackend::BindEffect(effect, camera);
+    }
+    bool BeginPass(CgFxEffectBase* effect, int passIdx) {
+        this->currPassIdx = passIdx;
+        return NullRenderBackend::BeginPass(effect, passIdx);
+    }
+    void DrawGeometry(const RenderCommand& cmd) {
+        // Every pass of an effect goes back over the same commands, so only the first one is checked
+        if (this->currPassIdx == 0) {
+            if (cmd.sortKey < this->lastSortKey) {
+                this->isInOrder = false;
+            }
+            this->lastSortKey = cmd.sortKey;
+        }
+        NullRenderBackend::DrawGeometry(cmd);
+    }
+
+private:
+    std::set<const CgFxEffectBase*> boundEffects;
+    int currPassIdx;
+    unsigned long long lastSortKey;
+    bool isInOrder;
+
+    DISALLOW_COPY_AND_ASSIGN(CheckingRenderBackend);
+};
+
+// Record every instance's meshes, one instance at a time, the way the turret meshes traverse their blocks
+static void RecordScene(RenderCommandQueue& queue, CgFxEffectBase** effects, const std::vector<Matrix4x4>& instanceXfs,
+                        const std::vector<char>& isInstanceFlashing) {
+
+    static const float WHITE[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+    static const float FLASH[4] = {1.0f, 0.25f, 0.25f, 1.0f};
+
+    // Display list ids just need to be non-zero, nothing is ever drawn
+    for (size_t instanceIdx = 0; instanceIdx < instanceXfs.size(); instanceIdx++) {
+        const float* colour = isInstanceFlashing[instanceIdx] ? FLASH : WHITE;
+        for (int meshIdx = 0; meshIdx < NUM_MESHES_PER_INSTANCE; meshIdx++) {
+            for (int materialIdx = 0; materialIdx < NUM_MATERIALS_PER_MESH; materialIdx++) {
+                int effectIdx = meshIdx * NUM_MATERIALS_PER_MESH + materialIdx;
+                queue.Add(0, effects[effectIdx], effectIdx % 2, static_cast<GLuint>(effectIdx + 1),
+                    instanceXfs[instanceIdx].begin(), colour);
+            }
+        }
+    }
+}
+
+RenderQueueBenchmark::RenderQueueBenchmark(int numInstances, size_t numRepetitions, unsigned long seed) :
+numInstances(numInstances), numRepetitions(numRepetitions), seed(seed) {
+    assert(numInstances > 0);
+    assert(numRepetitions > 0);
+}
+
+bool RenderQueueBenchmark::Run(std::ostream& out) const {
+    out << "Render command queue: " << this->numInstances << " instances of " << NUM_MESHES_PER_INSTANCE 
+        << " meshes with " << NUM_MATERIALS_PER_MESH << " materials each, " << NUM_PASSES_PER_EFFECT
+        << " passes per effect, repetitions=" << this->numRepetitions << std::endl;
+
+    // The null backend only ever compares the effect pointers, they're never dereferenced
+    // so any distinct addresses will do
+    std::vector<char> effectStandIns(NUM_EFFECTS);
+    CgFxEffectBase* effects[NUM_EFFECTS];
+    for (int i = 0; i < NUM_EFFECTS; i++) {
+        effects[i] = reinterpret_cast<CgFxEffectBase*>(&effectStandIns[i]);
+    }
+
+    // Lay the instances out on a grid in front of the camera with the odd one flashing
+    Randomizer::GetInstance()->SetSeed(this->seed);
+    std::vector<Matrix4x4> instanceXfs(this->numInstances);
+    std::vector<char> isInstanceFlashing(this->numInstances);
+    for (int i = 0; i < this->numInstances; i++) {
+        instanceXfs[i] = Matrix4x4::translationMatrix(Vector3D(static_cast<float>(i % NUM_COLUMNS),
+            static_cast<float>(i / NUM_COLUMNS), -20.0f - 5.0f * Randomizer::GetInstance()->RandomNumZeroToOne()));
+        isInstanceFlashing[i] = (Randomizer::GetInstance()->RandomUnsignedInt() % 8) == 0 ? 1 : 0;
+    }
+
+    Camera camera;
+    RenderCommandQueue queue;
+
+    // Recorded order, i.e., what drawing each mesh right away does
+    NullRenderBackend unsortedBackend(NUM_PASSES_PER_EFFECT);
+    queue.SetSortingEnabled(false);
+    RecordScene(queue, effects, instanceXfs, isInstanceFlashing);
+    queue.Execute(unsortedBackend, camera);
+
+    TickTimingStats recordStats;
+    TickTimingStats sortStats;
+    TickTimingStats executeStats;
+    recordStats.Reserve(this->numRepetitions);
+    sortStats.Reserve(this->numRepetitions);
+    executeStats.Reserve(this->numRepetitions);
+
+    queue.SetSortingEnabled(true);
+    bool isCorrect = true;
+    size_t numCommands = 0;
+    for (size_t repetition = 0; repetition < this->numRepetitions; repetition++) {
+        CheckingRenderBackend sortedBackend;
+
+        double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        RecordScene(queue, effects, instanceXfs, isInstanceFlashing);
+        recordStats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+        numCommands = queue.GetNumCommands();
+
+        startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        queue.Sort();
+        sortStats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+
+        // Execute sorts again, which is cheap on already sorted keys but still counted
+        startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        queue.Execute(sortedBackend, camera);
+        executeStats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+
+        if (repetition == 0) {
+            // A full effect setup uploads every parameter, a transform update only the matrices
+            out << "recorded order: effect setups=" << unsortedBackend.GetNumEffectBinds()
+                << ", pass changes=" << unsortedBackend.GetNumPassChanges()
+                << ", transform updates=" << unsortedBackend.GetNumEffectTransformUpdates()
+                << ", modelview loads=" << unsortedBackend.GetNumTransformChanges()
+                << ", colour changes=" << unsortedBackend.GetNumColourChanges() << std::endl;
+            out << "sorted:         effect setups=" << sortedBackend.GetNumEffectBinds()
+                << ", pass changes=" << sortedBackend.GetNumPassChanges()
+                << ", transform updates=" << sortedBackend.GetNumEffectTransformUpdates()
+                << ", modelview loads=" << sortedBackend.GetNumTransformChanges()
+                << ", colour changes=" << sortedBackend.GetNumColourChanges() << std::endl;
+        }
+
+        size_t expectedNumDraws = numCommands * NUM_PASSES_PER_EFFECT;
+        if (sortedBackend.GetNumDraws() != expectedNumDraws || unsortedBackend.GetNumDraws() != expectedNumDraws) {
+            out << "  expected " << expectedNumDraws << " draws, got " << sortedBackend.GetNumDraws()
+                << " sorted and " << unsortedBackend.GetNumDraws() << " in recorded order" << std::endl;
+            isCorrect = false;
+        }
+        if (!sortedBackend.IsInOrder()) {
+            out << "  the sorted commands were not executed in sort key order" << std::endl;
+            isCorrect = false;
+        }
+        if (!sortedBackend.WasEachEffectBoundOnce() || sortedBackend.GetNumEffectBinds() != static_cast<size_t>(NUM_EFFECTS)) {
+            out << "  expected each of the " << NUM_EFFECTS << " effects to be set up once, got "
+                << sortedBackend.GetNumEffectBinds() << " setups" << std::endl;
+            isCorrect = false;
+        }
+        if (!isCorrect) {
+            break;
+        }
+    }
+
+    out << "record: mean(us)=" << recordStats.GetMeanTickTimeInSecs() * 1000000.0
+        << ", max(us)=" << recordStats.GetMaxTickTimeInSecs() * 1000000.0 << std::endl;
+    out << "sort " << numCommands << " commands: mean(us)=" << sortStats.GetMeanTickTimeInSecs() * 1000000.0
+        << ", p99(us)=" << sortStats.GetPercentileTickTimeInSecs(99.0) * 1000000.0
+        << ", max(us)=" << sortStats.GetMaxTickTimeInSecs() * 1000000.0 << std::endl;
+    out << "execute: mean(us)=" << executeStats.GetMeanTickTimeInSecs() * 1000000.0
+        << ", max(us)=" << executeStats.GetMaxTickTimeInSecs() * 1000000.0 << std::endl;
+    out << (isCorrect ? "Sorted execution was correct" : "Sorted execution was INCORRECT") << std::endl;
+
+    return isCorrect;
+}
@@ -0,0 +1,60 @@
+/**
+ * RenderQueueBenchmark.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __RENDERQUEUEBENCHMARK_H__
+#define __RENDERQUEUEBENCHMARK_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+/**
+ * CPU-only benchmark and check for the RenderCommandQueue: a scene of the given number of
+ * instanced meshes (like the turret blocks, each made of a few meshes with a couple of materials)
+ * is recorded in traversal order and executed against the NullRenderBackend, once in recorded
+ * order and once sorted. The state changes of both are reported along with the time taken to
+ * record, sort and execute the commands. The sorted execution is checked to draw every command
+ * once, in sort key order, with a single setup per effect.
+ */
+class RenderQueueBenchmark {
+public:
+    RenderQueueBenchmark(int numInstances, size_t numRepetitions, unsigned long seed);
+    ~RenderQueueBenchmark() {}
+
+    bool Run(std::ostream& out) const;
+
+private:
+    int numInstances;
+    size_t numRepetitions;
+    unsigned long seed;
+
+    DISALLOW_COPY_AND_ASSIGN(RenderQueueBenchmark);
+};
+
+#endif // __RENDERQUEUEBENCHMARK_H__
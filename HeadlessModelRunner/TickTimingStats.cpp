@@ -0,0 +1,78 @@
+/**
+ * TickTimingStats.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "TickTimingStats.h"
+
+void TickTimingStats::Merge(const TickTimingStats& other) {
+    this->tickTimesInSecs.insert(this->tickTimesInSecs.end(), 
+        other.tickTimesInSecs.begin(), other.tickTimesInSecs.end());
+    this->totalTimeInSecs += other.totalTimeInSecs;
+}
+
+double TickTimingStats::GetMaxTickTimeInSecs() const {
+    if (this->tickTimesInSecs.empty()) {
+        return 0.0;
+    }
+    return *std::max_element(this->tickTimesInSecs.begin(), this->tickTimesInSecs.end());
+}
+
+/**
+ * Get the tick time at the given percentile (in [0,100]) using the nearest-rank method.
+ */
+double TickTimingStats::GetPercentileTickTimeInSecs(double percentile) const {
+    if (this->tickTimesInSecs.empty()) {
+        return 0.0;
+    }
+    percentile = std::max<double>(0.0, std::min<double>(100.0, percentile));
+
+    size_t rank = static_cast<size_t>(ceil(percentile / 100.0 * static_cast<double>(this->tickTimesInSecs.size())));
+    if (rank > 0) {
+        rank--;
+    }
+
+    // Partial sort a copy so that we don't disturb the order the ticks were recorded in
+    std::vector<double> sortedTimes(this->tickTimesInSecs);
+    std::nth_element(sortedTimes.begin(), sortedTimes.begin() + rank, sortedTimes.end());
+    return sortedTimes[rank];
+}
+
+void TickTimingStats::WriteSummary(std::ostream& out, const std::string& label) const {
+    static const double SECS_TO_MICROSECS = 1000000.0;
+
+    out << label << ": "
+        << "ticks="         << this->GetNumTicks()
+        << ", ticks/s="     << this->GetTicksPerSecond()
+        << ", mean(us)="    << this->GetMeanTickTimeInSecs() * SECS_TO_MICROSECS
+        << ", p50(us)="     << this->GetPercentileTickTimeInSecs(50.0) * SECS_TO_MICROSECS
+        << ", p99(us)="     << this->GetPercentileTickTimeInSecs(99.0) * SECS_TO_MICROSECS
+        << ", max(us)="     << this->GetMaxTickTimeInSecs() * SECS_TO_MICROSECS
+        << std::endl;
+}
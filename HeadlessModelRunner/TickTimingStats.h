@@ -0,0 +1,90 @@
+/**
+ * TickTimingStats.h
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __TICKTIMINGSTATS_H__
+#define __TICKTIMINGSTATS_H__
+
+#include "../BlammoEngine/BasicIncludes.h"
+
+/**
+ * Accumulates the wall-clock cost of individual simulation ticks so that throughput
+ * (ticks per second) and tick cost percentiles can be reported for a run.
+ */
+class TickTimingStats {
+public:
+    TickTimingStats() : totalTimeInSecs(0.0) {}
+    ~TickTimingStats() {}
+
+    void Reserve(size_t numTicks) { this->tickTimesInSecs.reserve(numTicks); }
+    void Clear();
+
+    void AddTickTime(double tickTimeInSecs);
+    void Merge(const TickTimingStats& other);
+
+    size_t GetNumTicks() const { return this->tickTimesInSecs.size(); }
+    double GetTotalTimeInSecs() const { return this->totalTimeInSecs; }
+    double GetTicksPerSecond() const;
+    double GetMeanTickTimeInSecs() const;
+    double GetMaxTickTimeInSecs() const;
+    double GetPercentileTickTimeInSecs(double percentile) const;
+
+    void WriteSummary(std::ostream& out, const std::string& label) const;
+
+private:
+    std::vector<double> tickTimesInSecs;
+    double totalTimeInSecs;
+};
+
+inline void TickTimingStats::Clear() {
+    this->tickTimesInSecs.clear();
+    this->totalTimeInSecs = 0.0;
+}
+
+inline void TickTimingStats::AddTickTime(double tickTimeInSecs) {
+    this->tickTimesInSecs.push_back(tickTimeInSecs);
+    this->totalTimeInSecs += tickTimeInSecs;
+}
+
+inline double TickTimingStats::GetTicksPerSecond() const {
+    if (this->totalTimeInSecs <= 0.0) {
+        return 0.0;
+    }
+    return static_cast<double>(this->tickTimesInSecs.size()) / this->totalTimeInSecs;
+}
+
+inline double TickTimingStats::GetMeanTickTimeInSecs() const {
+    if (this->tickTimesInSecs.empty()) {
+        return 0.0;
+    }
+    return this->totalTimeInSecs / static_cast<double>(this->tickTimesInSecs.size());
+}
+
+#endif // __TICKTIMINGSTATS_H__
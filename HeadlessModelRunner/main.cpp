@@ -0,0 +1,636 @@
+/**
+ * main.cpp
+ * 
+ * Copyright (c) 2014, Callum Hay
+ * All rights reserved.
+ * 
+ * Redistribution and use of the Biff! Bam!! Blammo!?! code or any derivative
+ * works are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution.
+ * 3. The names of its contributors may not be used to endorse or promote products
+ * derived from this software without specific prior written permission.
+ * 4. Redistributions may not be sold, nor may they be used in a commercial
+ * product or activity without specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL CALLUM HAY BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Headless driver for the game model: runs levels at a fixed timestep with no window,
+// graphics or audio and reports how fast the simulation ticks. Useful for profiling
+// model-side changes (collisions, projectiles, items, bosses) in isolation from the view.
+//
+// Usage: HeadlessModelRunner [options]
+//  -world <idx>        Only run the given world (default: all worlds)
+//  -level <idx>        Only run the given level of each world that's run (default: all levels)
+//  -ticks <n>          Number of ticks to simulate per level (default: 3600)
+//  -dt <secs>          Fixed timestep for each tick (default: 1/60)
+//  -input <type>       Paddle input: random, track or script (default: track)
+//  -script <file>      Input script file for the 'script' input type
+//  -seed <n>           Random seed, reapplied at the start of every level (default: 1)
+//  -difficulty <d>     easy, medium or hard (default: medium)
+//  -worlds <file>      Alternate world definition file
+//  -zip <file>         Alternate resource zip
+//  -orbs <n>           Stress test: keep n boss orb projectiles flying around the level at all times, along with
+//                      a portal pair for every 10 orbs and -balls balls, these collide with the balls and the other
+//                      projectiles; every level is run once with the collision broad phase and once testing all pairs
+//  -portals <n>        Stress test: keep n pairs of portal projectiles in the level at all times
+//  -balls <n>          Stress test: keep n balls in play at all times (default: 8 with -orbs)
+//  -events <mode>      Game event dispatch: immediate or deferred (default: immediate), per-event
+//                      statistics are reported after the run
+//  -particles <n>      Particle benchmark: instead of running levels, tick n particles through the list
+//                      and the batched ESPEmitter paths for -ticks ticks and compare them
+//  -mathbench <n>      Math benchmark: instead of running levels, run the BatchMath kernels and the
+//                      per-element Matrix4x4 operators over n items for -ticks iterations each
+//  -allocbench <n>     Allocation benchmark: instead of running levels, spawn and destroy n projectiles per tick
+//                      for -ticks ticks, once with heap allocation and a std::list and once with the pools
+//  -batchbench <rows>  Level geometry benchmark: instead of running levels, batch a level with the given number of
+//                      rows and destroy every piece in it, -ticks times, checking the batches along the way
+//  -renderbench <n>    Render queue benchmark: instead of running levels, record n instanced meshes into a render
+//                      command queue and execute it against a null backend -ticks times, sorted vs. recorded order
+//  -espthreads <n>     Parallel particle benchmark: instead of running levels, tick n emitters for -ticks ticks with
+//                      1, 2, 4, ... threads up to the number of processors and check that they all agree
+//  -restartbench <n>   Level restart benchmark: instead of running levels, restart each level that would be run n times
+//                      (playing it for a bit before each restart) and check that it comes back exactly as it started
+//  -textbench <n>      Text benchmark: instead of running levels, pack a font into a glyph atlas and lay out and batch
+//                      n strings -ticks times, checking the atlas and the layouts
+//  -replay <file>      Replay a session recorded by the game (see GameMain's -record option) instead of running
+//                      levels, the model is checked against how the recorded session ended
+//  -profile <file>     Profile every tick and write the most recent profiled scopes to the file when the run
+//                      ends, as a Chrome trace (chrome://tracing) or as CSV if the file ends in .csv
+//  -compilelevels <file> Compile the worlds and levels of the world definition file into a level pack at the
+//                      given path (e.g., mod/worlds/worlds.lvlpack), then compare loading them from text vs. the pack
+//  -compilemeshes <file> Compile every .obj mesh in the resource archive into a mesh pack at the given path
+//                      (e.g., mod/models/meshes.meshpack), then check it and compare loading the meshes from obj vs. the pack
+
+#include "../BlammoEngine/BasicIncludes.h"
+#include "../BlammoEngine/Algebra.h"
+#include "../BlammoEngine/BlammoTime.h"
+#include "../BlammoEngine/FreeListPool.h"
+#include "../BlammoEngine/FrameProfiler.h"
+#include "../BlammoEngine/JobSystem.h"
+#include "../BlammoEngine/AsyncFileWriter.h"
+
+#include "../GameModel/GameModel.h"
+#include "../GameModel/GameModelConstants.h"
+#include "../GameModel/GameEventManager.h"
+#include "../GameModel/GameItemFactory.h"
+#include "../GameModel/BossOrbProjectile.h"
+#include "../GameModel/PortalProjectile.h"
+#include "../GameModel/SimulationClock.h"
+#include "../GameSound/GameSound.h"
+
+#include "../ResourceManager.h"
+#include "../Blammopedia.h"
+
+#include "AllocationBenchmark.h"
+#include "ESPThreadBenchmark.h"
+#include "GeometryBatchBenchmark.h"
+#include "GlyphAtlasBenchmark.h"
+#include "InputReplayer.h"
+#include "LevelRestartBenchmark.h"
+#include "LevelPackCompiler.h"
+#include "MathBenchmark.h"
+#include "MeshPackCompiler.h"
+#include "PaddleInputDriver.h"
+#include "ParticleBenchmark.h"
+#include "RenderQueueBenchmark.h"
+#include "TickTimingStats.h"
+
+struct RunnerOptions {
+    RunnerOptions() : worldIdx(-1), levelIdx(-1), numTicksPerLevel(3600), dT(1.0 / 60.0),
+        inputType(PaddleInputDriver::TrackingDriver), seed(1), difficulty(GameModel::MediumDifficulty),
+        numStressOrbs(0), numStressPortalPairs(0), numStressBalls(-1), numBenchmarkParticles(0), numBenchmarkMathItems(0),
+        numBenchmarkAllocProjectiles(0), numBenchmarkBatchRows(0), numBenchmarkRenderInstances(0),
+        numBenchmarkThreadedEmitters(0), numBenchmarkLevelRestarts(0), numBenchmarkTextStrings(0),
+        eventDispatchMode(GameEventManager::ImmediateDispatch) {}
+
+    int worldIdx;
+    int levelIdx;
+    size_t numTicksPerLevel;
+    double dT;
+    PaddleInputDriver::DriverType inputType;
+    std::string scriptFilepath;
+    unsigned long seed;
+    GameModel::Difficulty difficulty;
+    std::string worldsFilepath;
+    std::string resourceZipFilepath;
+    int numStressOrbs;
+    int numStressPortalPairs;
+    int numStressBalls;         // Negative for the default
+    int numBenchmarkParticles;
+    int numBenchmarkMathItems;
+    int numBenchmarkAllocProjectiles;
+    int numBenchmarkBatchRows;
+    int numBenchmarkRenderInstances;
+    int numBenchmarkThreadedEmitters;
+    int numBenchmarkLevelRestarts;
+    int numBenchmarkTextStrings;
+    std::string levelPackFilepath;
+    std::string meshPackFilepath;
+    std::string replayFilepath;
+    std::string profileFilepath;
+    GameEventManager::DispatchMode eventDispatchMode;
+};
+
+static const size_t NUM_LEVEL_PACK_LOAD_REPETITIONS = 5;
+static const int NUM_STRESS_ORBS_PER_PORTAL_PAIR = 10;
+static const int DEFAULT_NUM_STRESS_BALLS_WITH_ORBS = 8;
+static const size_t NUM_MESH_PACK_LOAD_REPETITIONS  = 5;
+
+static bool ParseArguments(int argc, char *argv[], RunnerOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for argument " << arg << std::endl;
+            return false;
+        }
+        std::string value(argv[++i]);
+
+        if (arg == "-world") {
+            options.worldIdx = atoi(value.c_str());
+        }
+        else if (arg == "-level") {
+            options.levelIdx = atoi(value.c_str());
+        }
+        else if (arg == "-ticks") {
+            options.numTicksPerLevel = static_cast<size_t>(std::max<int>(1, atoi(value.c_str())));
+        }
+        else if (arg == "-dt") {
+            options.dT = atof(value.c_str());
+            if (options.dT <= 0.0) {
+                std::cerr << "Timestep must be positive." << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "-input") {
+            if (!PaddleInputDriver::StringToDriverType(value, options.inputType)) {
+                std::cerr << "Unknown input type: " << value << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "-script") {
+            options.scriptFilepath = value;
+        }
+        else if (arg == "-seed") {
+            options.seed = strtoul(value.c_str(), NULL, 10);
+        }
+        else if (arg == "-difficulty") {
+            if (value == "easy") {
+                options.difficulty = GameModel::EasyDifficulty;
+            }
+            else if (value == "medium") {
+                options.difficulty = GameModel::MediumDifficulty;
+            }
+            else if (value == "hard") {
+                options.difficulty = GameModel::HardDifficulty;
+            }
+            else {
+                std::cerr << "Unknown difficulty: " << value << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "-worlds") {
+            options.worldsFilepath = value;
+        }
+        else if (arg == "-zip") {
+            options.resourceZipFilepath = value;
+        }
+        else if (arg == "-orbs") {
+            options.numStressOrbs = std::max<int>(0, atoi(value.c_str()));
+        }
+        else if (arg == "-portals") {
+            options.numStressPortalPairs = std::max<int>(0, atoi(value.c_str()));
+        }
+        else if (arg == "-balls") {
+            options.numStressBalls = std::max<int>(0, atoi(value.c_str()));
+        }
+        else if (arg == "-events") {
+            if (value == "immediate") {
+                options.eventDispatchMode = GameEventManager::ImmediateDispatch;
+            }
+            else if (value == "deferred") {
+                options.eventDispatchMode = GameEventManager::DeferredDispatch;
+            }
+            else {
+                std::cerr << "Unknown event dispatch mode: " << value << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "-particles") {
+            options.numBenchmarkParticles = std::max<int>(0, atoi(value.c_str()));
+        }
+        else if (arg == "-mathbench") {
+            options.numBenchmarkMathItems = std::max<int>(0, atoi(value.c_str()));
+        }
+        else if (arg == "-allocbench") {
+            options.numBenchmarkAllocProjectiles = std::max<int>(0, atoi(value.c_str()));
+        }
+        else if (arg == "-batchbench") {
+            options.numBenchmarkBatchRows = std::max<int>(0, atoi(value.c_str()));
+        }
+        else if (arg == "-renderbench") {
+            options.numBenchmarkRenderInstances = std::max<int>(0, atoi(value.c_str()));
+        }
+        else if (arg == "-espthreads") {
+            options.numBenchmarkThreadedEmitters = std::max<int>(0, atoi(value.c_str()));
+        }
+        else if (arg == "-restartbench") {
+            options.numBenchmarkLevelRestarts = std::max<int>(0, atoi(value.c_str()));
+        }
+        else if (arg == "-textbench") {
+            options.numBenchmarkTextStrings = std::max<int>(0, atoi(value.c_str()));
+        }
+        else if (arg == "-replay") {
+            options.replayFilepath = value;
+        }
+        else if (arg == "-profile") {
+            options.profileFilepath = value;
+        }
+        else if (arg == "-compilelevels") {
+            options.levelPackFilepath = value;
+        }
+        else if (arg == "-compilemeshes") {
+            options.meshPackFilepath = value;
+        }
+        else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+static Point2D GetRandomStressSpawnPosition(const GameLevel& level) {
+    Randomizer* randomizer = Randomizer::GetInstance();
+    // Keep clear of the bottom of the level so that the paddle isn't instantly swamped
+    return Point2D(randomizer->RandomNumZeroToOne() * level.GetLevelUnitWidth(),
+        (0.3 + 0.7 * randomizer->RandomNumZeroToOne()) * level.GetLevelUnitHeight());
+}
+
+static int GetNumActiveProjectiles(const GameModel& model, Projectile::ProjectileType type) {
+    const GameModel::ProjectileList* projectiles = model.GetActiveProjectilesWithType(type);
+    return projectiles == NULL ? 0 : static_cast<int>(projectiles->size());
+}
+
+// The orb stress test also fills the level with things that the orbs are tested against through the
+// collision broad phase: portals (the only projectiles that collide with balls and other projectiles) and balls
+static int GetNumStressPortalPairs(const RunnerOptions& options) {
+    if (options.numStressOrbs <= 0) {
+        return options.numStressPortalPairs;
+    }
+    return std::max<int>(options.numStressPortalPairs, std::max<int>(1, options.numStressOrbs / NUM_STRESS_ORBS_PER_PORTAL_PAIR));
+}
+static int GetNumStressBalls(const RunnerOptions& options) {
+    if (options.numStressBalls >= 0) {
+        return options.numStressBalls;
+    }
+    return options.numStressOrbs > 0 ? DEFAULT_NUM_STRESS_BALLS_WITH_ORBS : 0;
+}
+static bool IsStressRun(const RunnerOptions& options) {
+    return options.numStressOrbs > 0 || GetNumStressPortalPairs(options) > 0 || GetNumStressBalls(options) > 0;
+}
+
+static Vector2D GetRandomStressDirection() {
+    Randomizer* randomizer = Randomizer::GetInstance();
+    Vector2D dir(randomizer->RandomNumNegOneToOne(), randomizer->RandomNumNegOneToOne());
+    if (dir.IsZero()) {
+        dir[1] = -1.0f;
+    }
+    return Vector2D::Normalize(dir);
+}
+
+// Keep the requested number of stress test projectiles and balls in play, replacing any that were destroyed
+static void TopUpStressProjectiles(GameModel& model, const RunnerOptions& options) {
+    if (!GameState::IsGameInPlayState(model)) {
+        return;
+    }
+    const GameLevel* level = model.GetCurrentLevel();
+
+    for (int i = GetNumActiveProjectiles(model, Projectile::BossOrbBulletProjectile); i < options.numStressOrbs; i++) {
+        model.AddProjectile(new BossOrbProjectile(GetRandomStressSpawnPosition(*level), GetRandomStressDirection()));
+    }
+
+    static const double PORTAL_LIFETIME_IN_SECS = 1000000.0;
+    int numPortalPairs = GetNumStressPortalPairs(options);
+    for (int i = GetNumActiveProjectiles(model, Projectile::PortalBlobProjectile) / 2; i < numPortalPairs; i++) {
+        std::pair<PortalProjectile*, PortalProjectile*> portalPair = PortalProjectile::BuildSiblingPortalProjectiles(
+            GetRandomStressSpawnPosition(*level), GetRandomStressSpawnPosition(*level), 
+            LevelPiece::PIECE_WIDTH, LevelPiece::PIECE_HEIGHT, Colour(1.0f, 0.0f, 1.0f), PORTAL_LIFETIME_IN_SECS);
+        model.AddProjectile(portalPair.first);
+        model.AddProjectile(portalPair.second);
+    }
+
+    // Extra balls are only added while the balls are in flight
+    if (model.GetCurrentStateType() == GameState::BallInPlayStateType) {
+        std::list<GameBall*>& balls = model.GetGameBalls();
+        for (int i = static_cast<int>(balls.size()); i < GetNumStressBalls(options); i++) {
+            GameBall* ball = new GameBall();
+            ball->SetCenterPosition(GetRandomStressSpawnPosition(*level));
+            ball->SetVelocity(GameBall::GetNormalSpeed(), GetRandomStressDirection());
+            balls.push_back(ball);
+        }
+    }
+}
+
+// Simulate a single level for the given number of ticks, the level is restarted
+// whenever it ends (completed or game over) so that every tick is spent in-game.
+static void RunLevel(GameModel& model, PaddleInputDriver& input, const RunnerOptions& options,
+                     int worldIdx, int levelIdx, size_t& tickID, TickTimingStats& stats) {
+
+    Randomizer::GetInstance()->SetSeed(options.seed);
+    SimulationClock::Reset();
+    model.StartGameAtWorldAndLevel(worldIdx, levelIdx);
+    input.Reset();
+
+    int numRestarts = 0;
+    for (size_t i = 0; i < options.numTicksPerLevel; i++, tickID++) {
+        
+        GameState::GameStateType stateType = model.GetCurrentStateType();
+        if (stateType == GameState::LevelCompleteStateType || stateType == GameState::WorldCompleteStateType ||
+            stateType == GameState::GameCompleteStateType  || stateType == GameState::GameOverStateType) {
+            
+            model.StartGameAtWorldAndLevel(worldIdx, levelIdx);
+            input.Reset();
+            numRestarts++;
+        }
+
+        input.ApplyInput(model, tickID, options.dT);
+        TopUpStressProjectiles(model, options);
+
+        double startTime = BlammoTime::GetHighResolutionTimeInSecs();
+        model.Tick(options.dT * model.GetTimeDialationFactor());
+        model.UpdateState();
+        GameEventManager::Instance()->DispatchDeferredEvents();
+        stats.AddTickTime(BlammoTime::GetHighResolutionTimeInSecs() - startTime);
+        FrameProfiler::EndFrame();
+    }
+
+    if (numRestarts > 0) {
+        std::cout << "  (level restarted " << numRestarts << " time(s))" << std::endl;
+    }
+}
+
+// Reports the event and object pool statistics gathered over a run
+static void WriteRunStats(const RunnerOptions& options) {
+    std::cout << "Game events (" << (options.eventDispatchMode == GameEventManager::DeferredDispatch ? 
+        "deferred" : "immediate") << " dispatch):" << std::endl;
+    GameEventManager::Instance()->WriteEventStats(std::cout);
+
+    std::cout << "Object pools:" << std::endl;
+    FreeListPool::WriteAllStats(std::cout);
+}
+
+static void RunWorlds(GameModel& model, PaddleInputDriver& input, const RunnerOptions& options) {
+    int firstWorld = 0;
+    int lastWorld  = model.GetLastWorldIndex();
+
+    if (options.worldIdx >= 0) {
+        if (options.worldIdx > lastWorld) {
+            std::cerr << "Invalid world index: " << options.worldIdx << std::endl;
+            lastWorld = -1;
+        }
+        else {
+            firstWorld = lastWorld = options.worldIdx;
+        }
+    }
+
+    std::cout << "Running " << options.numTicksPerLevel << " ticks per level at dT = " << options.dT << "s" << std::endl;
+
+    // Stress runs are repeated without the collision broad phase to measure what it saves
+    // over testing every projectile against every ball and projectile
+    bool compareBroadPhase = IsStressRun(options);
+
+    TickTimingStats totalStats;
+    TickTimingStats totalAllPairsStats;
+    TickTimingStats levelStats;
+    levelStats.Reserve(options.numTicksPerLevel);
+    size_t tickID = 1;
+
+    for (int worldIdx = firstWorld; worldIdx <= lastWorld; worldIdx++) {
+        const GameWorld* world = model.GetWorldByIndex(worldIdx);
+        
+        int firstLevel = 0;
+        int lastLevel  = static_cast<int>(world->GetNumLevels()) - 1;
+        if (options.levelIdx >= 0) {
+            if (options.levelIdx > lastLevel) {
+                continue;
+            }
+            firstLevel = lastLevel = options.levelIdx;
+        }
+
+        for (int levelIdx = firstLevel; levelIdx <= lastLevel; levelIdx++) {
+            std::stringstream label;
+            label << world->GetName() << " [" << worldIdx << ", " << levelIdx << "] " 
+                  << world->GetLevelByIndex(levelIdx)->GetName();
+
+            levelStats.Clear();
+            model.SetCollisionBroadPhaseEnabled(true);
+            RunLevel(model, input, options, worldIdx, levelIdx, tickID, levelStats);
+            levelStats.WriteSummary(std::cout, compareBroadPhase ? label.str() + " (broad phase)" : label.str());
+            totalStats.Merge(levelStats);
+
+            if (compareBroadPhase) {
+                levelStats.Clear();
+                model.SetCollisionBroadPhaseEnabled(false);
+                RunLevel(model, input, options, worldIdx, levelIdx, tickID, levelStats);
+                model.SetCollisionBroadPhaseEnabled(true);
+                levelStats.WriteSummary(std::cout, label.str() + " (all pairs)");
+                totalAllPairsStats.Merge(levelStats);
+            }
+        }
+    }
+
+    if (compareBroadPhase) {
+        totalStats.WriteSummary(std::cout, "TOTAL (broad phase)");
+        totalAllPairsStats.WriteSummary(std::cout, "TOTAL (all pairs)");
+    }
+    else {
+        totalStats.WriteSummary(std::cout, "TOTAL");
+    }
+    WriteRunStats(options);
+}
+
+static bool RunReplay(GameModel& model, const InputReplayer& replayer, const RunnerOptions& options) {
+    std::cout << "Replaying " << options.replayFilepath << " (" << replayer.GetNumTicks() << " ticks)" << std::endl;
+
+    TickTimingStats stats;
+    bool isMatch = replayer.Run(model, stats, std::cout);
+    stats.WriteSummary(std::cout, "REPLAY");
+    WriteRunStats(options);
+    return isMatch;
+}
+
+int main(int argc, char *argv[]) {
+    assert(argc > 0 && argv != NULL);
+
+    RunnerOptions options;
+    if (!ParseArguments(argc, argv, options)) {
+        return 1;
+    }
+
+    // The benchmarks don't need the game model or any resources
+    if (options.numBenchmarkParticles > 0) {
+        ParticleBenchmark benchmark(options.numBenchmarkParticles, options.numTicksPerLevel, options.dT, options.seed);
+        benchmark.Run(std::cout);
+        Randomizer::DeleteInstance();
+        return 0;
+    }
+    if (options.numBenchmarkMathItems > 0) {
+        MathBenchmark benchmark(options.numBenchmarkMathItems, options.numTicksPerLevel, options.seed);
+        benchmark.Run(std::cout);
+        Randomizer::DeleteInstance();
+        return 0;
+    }
+    if (options.numBenchmarkAllocProjectiles > 0) {
+        AllocationBenchmark benchmark(options.numBenchmarkAllocProjectiles, options.numTicksPerLevel);
+        benchmark.Run(std::cout);
+        Randomizer::DeleteInstance();
+        return 0;
+    }
+    if (options.numBenchmarkBatchRows > 0) {
+        GeometryBatchBenchmark benchmark(options.numBenchmarkBatchRows, options.numTicksPerLevel, options.seed);
+        bool isConsistent = benchmark.Run(std::cout);
+        Randomizer::DeleteInstance();
+        return isConsistent ? 0 : 1;
+    }
+    if (options.numBenchmarkRenderInstances > 0) {
+        RenderQueueBenchmark benchmark(options.numBenchmarkRenderInstances, options.numTicksPerLevel, options.seed);
+        bool isCorrect = benchmark.Run(std::cout);
+        Randomizer::DeleteInstance();
+        return isCorrect ? 0 : 1;
+    }
+    if (options.numBenchmarkThreadedEmitters > 0) {
+        ESPThreadBenchmark benchmark(options.numBenchmarkThreadedEmitters, options.numTicksPerLevel, options.dT, options.seed);
+        bool isDeterministic = benchmark.Run(std::cout);
+        JobSystem::DeleteInstance();
+        Randomizer::DeleteInstance();
+        return isDeterministic ? 0 : 1;
+    }
+    if (options.numBenchmarkTextStrings > 0) {
+        GlyphAtlasBenchmark benchmark(options.numBenchmarkTextStrings, options.numTicksPerLevel, options.seed);
+        bool isCorrect = benchmark.Run(std::cout);
+        Randomizer::DeleteInstance();
+        return isCorrect ? 0 : 1;
+    }
+
+    PaddleInputDriver* input = PaddleInputDriver::Build(options.inputType, options.scriptFilepath);
+    if (input == NULL) {
+        std::cerr << "Failed to create the paddle input driver." << std::endl;
+        return 1;
+    }
+
+    if (SDL_Init(SDL_INIT_TIMER) < 0) {
+        std::cerr << "Failed to initialize SDL: " << SDL_GetError() << std::endl;
+        delete input;
+        return 1;
+    }
+
+    // Resources are loaded exactly as they are for the game, minus anything graphics related
+    ResourceManager::SetLoadDir(argv[0]);
+    if (options.resourceZipFilepath.empty()) {
+        options.resourceZipFilepath = ResourceManager::GetLoadDir() + std::string(ResourceManager::RESOURCE_ZIP);
+    }
+    ResourceManager::InitResourceManager(options.resourceZipFilepath, argv[0], false);
+
+    // A replayed session decides how the model is set up
+    InputReplayer replayer;
+    bool ballBoostIsInverted = false;
+    BallBoostModel::BallBoostMode ballBoostMode = BallBoostModel::Slingshot;
+    if (!options.replayFilepath.empty()) {
+        if (!replayer.Load(options.replayFilepath)) {
+            delete input;
+            ResourceManager::DeleteInstance();
+            SDL_Quit();
+            return 1;
+        }
+        options.difficulty  = static_cast<GameModel::Difficulty>(replayer.GetDifficulty());
+        ballBoostMode       = static_cast<BallBoostModel::BallBoostMode>(replayer.GetBallBoostMode());
+        ballBoostIsInverted = replayer.GetIsBallBoostInverted();
+
+        // The levels need the blammopedia's item unlocks from the session before they're loaded
+        Blammopedia* blammopedia = Blammopedia::ReadFromBlammopediaFile(ResourceManager::GetLoadDir() + 
+            std::string(ResourceManager::BLAMMOPEDIA_FILE));
+        if (blammopedia == NULL || !replayer.ApplyItemUnlocks(*blammopedia)) {
+            std::cerr << "Failed to set up the blammopedia for the replay." << std::endl;
+            delete blammopedia;
+            delete input;
+            ResourceManager::DeleteInstance();
+            SDL_Quit();
+            return 1;
+        }
+        ResourceManager::GetInstance()->SetBlammopedia(blammopedia);
+    }
+
+    Randomizer::GetInstance()->SetSeed(options.seed);
+    GameSound* sound = new GameSound(true);
+    GameModel* model = new GameModel(sound, options.difficulty, ballBoostIsInverted, ballBoostMode, options.worldsFilepath);
+
+    GameEventManager::Instance()->SetDispatchMode(options.eventDispatchMode);
+    GameEventManager::Instance()->SetDispatchTimingEnabled(true);
+    if (!options.profileFilepath.empty()) {
+        FrameProfiler::SetEnabled(true);
+    }
+
+    int exitCode = 0;
+    if (!options.meshPackFilepath.empty()) {
+        // Compiling the mesh pack replaces running the levels
+        MeshPackCompiler compiler(options.meshPackFilepath, NUM_MESH_PACK_LOAD_REPETITIONS);
+        exitCode = compiler.Run(std::cout) ? 0 : 1;
+    }
+    else if (!options.levelPackFilepath.empty()) {
+        // Compiling the level pack replaces running the levels
+        LevelPackCompiler compiler(options.levelPackFilepath, NUM_LEVEL_PACK_LOAD_REPETITIONS);
+        exitCode = compiler.Run(*model, std::cout) ? 0 : 1;
+    }
+    else if (!options.replayFilepath.empty()) {
+        exitCode = RunReplay(*model, replayer, options) ? 0 : 1;
+    }
+    else if (options.numBenchmarkLevelRestarts > 0) {
+        LevelRestartBenchmark benchmark(options.numBenchmarkLevelRestarts, options.worldIdx, options.levelIdx, options.dT);
+        exitCode = benchmark.Run(*model, *input, std::cout) ? 0 : 1;
+    }
+    else {
+        RunWorlds(*model, *input, options);
+    }
+
+    if (!options.profileFilepath.empty()) {
+        FrameProfiler::SetEnabled(false);
+        if (FrameProfiler::WriteToFile(options.profileFilepath)) {
+            std::cout << "Wrote profile to " << options.profileFilepath << std::endl;
+        }
+    }
+
+    delete model;
+    model = NULL;
+    delete sound;
+    sound = NULL;
+    delete input;
+    input = NULL;
+
+    GameModelConstants::DeleteInstance();
+    GameEventManager::DeleteInstance();
+    GameItemFactory::DeleteInstance();
+    Randomizer::DeleteInstance();
+    AsyncFileWriter::DeleteInstance();
+
+    // Drop the blammopedia without writing it, a replay's unlocks must never replace the player's
+    ResourceManager::GetInstance()->SetBlammopedia(NULL);
+    ResourceManager::DeleteInstance();
+
+    SDL_Quit();
+    return exitCode;
+}
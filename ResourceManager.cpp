@@ -32,12 +32,15 @@
 #include "ResourceManager.h"
 #include "ConfigOptions.h"
 #include "Blammopedia.h"
+#include "AssetStreamer.h"
+#include "DecodedAssetCache.h"
 
 #include "BlammoEngine/ObjReader.h"
 #include "BlammoEngine/MtlReader.h"
 #include "BlammoEngine/CgFxEffect.h"
 #include "BlammoEngine/GeometryMaker.h"
 #include "BlammoEngine/Mesh.h"
+#include "BlammoEngine/MeshPack.h"
 #include "BlammoEngine/Texture1D.h"
 #include "BlammoEngine/Texture2D.h"
 #include "BlammoEngine/TextureFontSet.h"
@@ -57,6 +60,7 @@ ArcadeLeaderboard* ResourceManager::leaderboard = NULL;
 // Initialization Constants for the application
 const char* ResourceManager::RESOURCE_ZIP     = "BBBResources.zip";
 const char* ResourceManager::BLAMMOPEDIA_FILE = "blammopedia.dat";
+const char* ResourceManager::MESH_PACK_FILE   = "meshes.meshpack";
 
 const char* ResourceManager::RESOURCE_DIRECTORY			= "resources";
 const char* ResourceManager::TEXTURE_DIRECTORY			= "textures";
@@ -68,15 +72,13 @@ const char* ResourceManager::MOD_DIRECTORY = "mod";
 
 std::string ResourceManager::baseLoadDir;
 
-ResourceManager::ResourceManager(const std::string& resourceZip, const char* argv0) : 
-cgContext(NULL), inkBlockMesh(NULL), portalBlockMesh(NULL), celShadingTexture(NULL), blammopedia(NULL) {
-	// Initialize DevIL and make sure it loaded correctly
-	ilInit();
-	iluInit();
-	ILboolean ilResult = ilutRenderer(ILUT_OPENGL);
-	assert(ilResult);
-	ilResult = ilutEnable(ILUT_OPENGL_CONV);
-	assert(ilResult);
+ResourceManager::ResourceManager(const std::string& resourceZip, const char* argv0, bool initGraphics) : 
+cgContext(NULL), inkBlockMesh(NULL), portalBlockMesh(NULL), celShadingTexture(NULL), blammopedia(NULL), assetCache(NULL), assetStreamer(NULL), meshPack(NULL) {
+	// Initialize DevIL and make sure it loaded correctly (this requires an OpenGL context, so
+	// we skip it when there are no graphics, e.g., for headless runs of the game model)
+	if (initGraphics) {
+		Texture::InitImageLibrary();
+	}
 
 	//ilEnable(IL_ORIGIN_SET);
 	//ilOriginFunc(IL_ORIGIN_LOWER_LEFT);
@@ -101,9 +103,35 @@ cgContext(NULL), inkBlockMesh(NULL), portalBlockMesh(NULL), celShadingTexture(NU
 	debug_physfs_state(result);
 
 	debug_output("PHYSFS Base Path: " << PHYSFS_getBaseDir());
+
+	// The streaming threads read through physfs so they can only be started once it's initialized
+	if (initGraphics) {
+		this->assetCache = new DecodedAssetCache(ResourceManager::GetLoadDir() + std::string(DecodedAssetCache::CACHE_DIRECTORY));
+		this->assetStreamer = new AssetStreamer(AssetStreamer::DEFAULT_NUM_WORKER_THREADS, this->assetCache);
+	}
+
+	// Meshes that were compiled into the mesh pack are built from it rather than parsed from their obj files
+	std::string meshPackFilepath = ResourceManager::GetMeshPackFilepath();
+	if (ResourceManager::FilepathExists(meshPackFilepath)) {
+		this->meshPack = MeshPack::LoadFromResource(meshPackFilepath);
+	}
 }
 
 ResourceManager::~ResourceManager() {
+	// Stop any background streaming first, it depends on physfs
+	if (this->assetStreamer != NULL) {
+		delete this->assetStreamer;
+		this->assetStreamer = NULL;
+	}
+	if (this->assetCache != NULL) {
+		delete this->assetCache;
+		this->assetCache = NULL;
+	}
+	if (this->meshPack != NULL) {
+		delete this->meshPack;
+		this->meshPack = NULL;
+	}
+
 	// Clean up blammopedia - this should always be done first since it depends
 	// on physfs and various textures / resources
 	if (this->blammopedia != NULL) {
@@ -148,8 +176,10 @@ ResourceManager::~ResourceManager() {
 	this->loadedEffectTechniques.clear();
 
 	// Destroy the cg context
-	cgDestroyContext(this->cgContext);
-	this->cgContext = NULL;
+	if (this->cgContext != NULL) {
+		cgDestroyContext(this->cgContext);
+		this->cgContext = NULL;
+	}
 
 	// Clean up all loaded textures
 	assert(this->numRefPerTexture.empty());
@@ -176,6 +206,8 @@ ResourceManager::~ResourceManager() {
         delete ResourceManager::leaderboard;
         ResourceManager::leaderboard = NULL;
     }
+
+	Texture::ShutdownImageLibrary();
 }
 
 /**
@@ -200,22 +232,18 @@ void ResourceManager::InitCgContext() {
  * Initialize the resource manager (must be called before obtaining an instance of the class)
  * so that it loads resources from the given zip file.
  * Also must be provided with the directory that the application is running in: argv[0].
+ * If initGraphics is false then only file resources (i.e., no textures, meshes or effects) may be loaded.
  */
-void ResourceManager::InitResourceManager(const std::string& resourceZip, const char* argv0) {
+void ResourceManager::InitResourceManager(const std::string& resourceZip, const char* argv0, bool initGraphics) {
 	assert(ResourceManager::instance == NULL);
 	if (ResourceManager::instance == NULL) {
-		ResourceManager::instance = new ResourceManager(resourceZip, argv0);
+		ResourceManager::instance = new ResourceManager(resourceZip, argv0, initGraphics);
 	}
 }
 
 bool ResourceManager::LoadBlammopedia(const std::string& blammopediaFile) {
-	if (this->blammopedia != NULL) {
-		delete this->blammopedia;
-        this->blammopedia = NULL;
-	}
-
 	// Initialize blammopedia
-	this->blammopedia = Blammopedia::BuildFromBlammopediaFile(blammopediaFile);
+	this->SetBlammopedia(Blammopedia::BuildFromBlammopediaFile(blammopediaFile));
 	if (this->blammopedia == NULL) {
 		assert(false);
 		debug_output("Could not load blammopedia!!!");
@@ -224,6 +252,17 @@ bool ResourceManager::LoadBlammopedia(const std::string& blammopediaFile) {
 	return true;
 }
 
+/**
+ * Hands an already built blammopedia over to the resource manager, which takes ownership
+ * of it and deletes any blammopedia it previously had.
+ */
+void ResourceManager::SetBlammopedia(Blammopedia* blammopedia) {
+	if (this->blammopedia != NULL && this->blammopedia != blammopedia) {
+		delete this->blammopedia;
+	}
+	this->blammopedia = blammopedia;
+}
+
 /**
  * Obtain the mesh resource for the ink block, load it into memory
  * if it hasn't been loaded already.
@@ -324,21 +363,58 @@ Mesh* ResourceManager::GetObjMeshResource(const std::string &filepath) {
 	Mesh* mesh = NULL;
 
 	if (needToReadFromFile) {
-		std::istringstream* iStrStream = this->FilepathToInStream(filepath);
-		if (iStrStream == NULL) {
-			debug_output("Mesh file not found: " << filepath);
-			return NULL;
+		// If the mesh is in the mesh pack then its geometry is already compiled, otherwise if it
+		// was streamed in then it's already parsed and we only have to build it
+		const CompiledMesh* compiledMesh = NULL;
+		if (this->meshPack != NULL) {
+			compiledMesh = this->meshPack->GetCurrentMesh(filepath);
+		}
+		ObjMeshData* meshData = NULL;
+		if (compiledMesh == NULL && this->assetStreamer != NULL) {
+			meshData = this->assetStreamer->TakeObjMeshData(filepath);
+		}
+
+		if (compiledMesh != NULL) {
+			mesh = ObjReader::BuildMesh(filepath, *compiledMesh);
+		}
+		else if (meshData != NULL) {
+			mesh = ObjReader::BuildMesh(filepath, *meshData);
+			delete meshData;
+			meshData = NULL;
+		}
+		else if (this->assetCache != NULL) {
+			long fileBufferLength = 0;
+			char* fileBuffer = this->FilepathToMemoryBuffer(filepath, fileBufferLength);
+			if (fileBuffer == NULL) {
+				debug_output("Mesh file not found: " << filepath);
+				return NULL;
+			}
+
+			ObjMeshData cachedMeshData;
+			if (this->assetCache->GetObjMeshData(filepath, fileBuffer, fileBufferLength, cachedMeshData)) {
+				mesh = ObjReader::BuildMesh(filepath, cachedMeshData);
+			}
+
+			delete[] fileBuffer;
+			fileBuffer = NULL;
+		}
+		else {
+			std::istringstream* iStrStream = this->FilepathToInStream(filepath);
+			if (iStrStream == NULL) {
+				debug_output("Mesh file not found: " << filepath);
+				return NULL;
+			}
+			mesh = ObjReader::ReadMeshFromStream(filepath, *iStrStream);
+
+			// Clean-up the stream
+			delete iStrStream;
+			iStrStream = NULL;
 		}
-		mesh = ObjReader::ReadMeshFromStream(filepath, *iStrStream);
 		assert(mesh != NULL);
 
 		// First reference to the mesh...
 		this->numRefPerMesh[mesh] = 1;
 		this->loadedMeshes[filepath] = mesh;
-
-		// Clean-up the stream
-		delete iStrStream;
-		iStrStream = NULL;
 	}
 	else {
 		// The mesh has already been loaded from file - all we have to do is either return it
@@ -429,32 +505,56 @@ Texture* ResourceManager::GetImgTextureResource(const std::string &filepath, Tex
 	Texture* texture = NULL;
 
 	if (needToReadFromFile) {
-		long texBufferLength;
-		unsigned char* texBuffer = (unsigned char*)this->FilepathToMemoryBuffer(filepath, texBufferLength);
-		if (texBuffer == NULL) {
-			debug_output("Texture file not found: " << filepath);
-			return NULL;
+		// If the image was streamed in then it's already decoded and we only have to upload it
+		Texture::DecodedImage* image = NULL;
+		if (this->assetStreamer != NULL && textureType == GL_TEXTURE_2D) {
+			image = this->assetStreamer->TakeDecodedImage(filepath);
 		}
 
-		// Load the texture based on its type
-		switch (textureType) {
-
-			case GL_TEXTURE_1D:
-				texture = Texture1D::CreateTexture1DFromBuffer(texBuffer, texBufferLength, filter);
-				break;
-
-			case GL_TEXTURE_2D:
-				texture = Texture2D::CreateTexture2DFromBuffer(texBuffer, texBufferLength, filter);
-				break;
-
-			default:
-				assert(false);
+		if (image != NULL) {
+			texture = Texture2D::CreateTexture2DFromDecodedImage(*image, filter);
+			delete image;
+			image = NULL;
+		}
+		else {
+			long texBufferLength;
+			unsigned char* texBuffer = (unsigned char*)this->FilepathToMemoryBuffer(filepath, texBufferLength);
+			if (texBuffer == NULL) {
+				debug_output("Texture file not found: " << filepath);
 				return NULL;
+			}
+
+			// Load the texture based on its type
+			switch (textureType) {
+
+				case GL_TEXTURE_1D:
+					texture = Texture1D::CreateTexture1DFromBuffer(texBuffer, texBufferLength, filter);
+					break;
+
+				case GL_TEXTURE_2D:
+					if (this->assetCache != NULL) {
+						image = this->assetCache->GetDecodedImage(filepath, texBuffer, texBufferLength);
+						if (image != NULL) {
+							texture = Texture2D::CreateTexture2DFromDecodedImage(*image, filter);
+							delete image;
+							image = NULL;
+						}
+					}
+					else {
+						texture = Texture2D::CreateTexture2DFromBuffer(texBuffer, texBufferLength, filter);
+					}
+					break;
+
+				default:
+					assert(false);
+					delete[] texBuffer;
+					return NULL;
+			}
+			
+			// Clean up the texture buffer...
+			delete[] texBuffer;
+			texBuffer = NULL;
 		}
-		
-		// Clean up the texture buffer...
-		delete[] texBuffer;
-		texBuffer = NULL;
 
         if (texture == NULL) {
             debug_output("Failed to load texture into memory: " << filepath);
@@ -515,6 +615,72 @@ bool ResourceManager::ReleaseTextureResource(Texture* texture) {
 	return true;
 }
 
+/**
+ * Start streaming in the given .obj mesh (along with its material file and textures) on the
+ * background threads, GetObjMeshResource will then only need to build the mesh. Does nothing
+ * if the mesh is already loaded.
+ */
+void ResourceManager::PrefetchObjMeshResource(const std::string &filepath) {
+	if (this->assetStreamer == NULL || this->loadedMeshes.find(filepath) != this->loadedMeshes.end()) {
+		return;
+	}
+
+	// Meshes in the mesh pack don't need their obj file, only their materials (and their textures)
+	const CompiledMesh* compiledMesh = NULL;
+	if (this->meshPack != NULL) {
+		compiledMesh = this->meshPack->GetCurrentMesh(filepath);
+	}
+	if (compiledMesh != NULL) {
+		this->assetStreamer->Prefetch(compiledMesh->mtlFilepath, AssetStreamer::MaterialFileAsset);
+	}
+	else {
+		this->assetStreamer->Prefetch(filepath, AssetStreamer::ObjMeshAsset);
+	}
+}
+
+/**
+ * Start streaming in and decoding the given 2D texture image on the background threads,
+ * GetImgTextureResource will then only need to upload it. Does nothing if the texture is already loaded.
+ */
+void ResourceManager::PrefetchImgTextureResource(const std::string &filepath) {
+	if (this->assetStreamer == NULL || this->loadedTextures.find(filepath) != this->loadedTextures.end()) {
+		return;
+	}
+	this->assetStreamer->Prefetch(filepath, AssetStreamer::ImageAsset);
+}
+
+/**
+ * Start reading the given file into memory on the background threads, the next call to
+ * FilepathToMemoryBuffer for the file will take the streamed bytes.
+ */
+void ResourceManager::PrefetchFile(const std::string &filepath) {
+	if (this->assetStreamer == NULL) {
+		return;
+	}
+	this->assetStreamer->Prefetch(filepath, AssetStreamer::FileAsset);
+}
+
+/**
+ * Throw away anything that was streamed in but never used.
+ */
+void ResourceManager::ClearPrefetchedResources() {
+	if (this->assetStreamer == NULL) {
+		return;
+	}
+	this->assetStreamer->ClearPrefetched();
+}
+
+/**
+ * Writes out how long loading took along with how the decoded asset cache did while loading (and
+ * how that compares to previous loads), does nothing when there's no cache.
+ */
+void ResourceManager::ReportLoadTime(double loadTimeInSecs, std::ostream& out) {
+	if (this->assetCache == NULL) {
+		return;
+	}
+	this->assetCache->WriteLoadTimeReport(loadTimeInSecs, out);
+}
+
 /**
  * Return the cel-shader texture used as the step function for cel-shading.
  * Returns: cel shading texture.
@@ -576,8 +742,16 @@ std::map<unsigned int, TextureFontSet*> ResourceManager::LoadFont(const std::str
 		return fontSets;
 	}
 
-	// Load the font sets using the file buffer
-	fontSets = TextureFontSet::CreateTextureFontFromBuffer(fileBuffer, bufferLength, heights, filterType);
+	// Load the font sets using the file buffer, going through the decoded asset cache for the glyphs when there is one
+	if (ResourceManager::instance != NULL && ResourceManager::instance->assetCache != NULL) {
+		std::vector<TextureFontSet::BakedFont> bakedFonts;
+		if (ResourceManager::instance->assetCache->GetBakedFonts(filepath, fileBuffer, bufferLength, heights, bakedFonts)) {
+			fontSets = TextureFontSet::CreateTextureFontFromBakedFonts(bakedFonts, filterType);
+		}
+	}
+	else {
+		fontSets = TextureFontSet::CreateTextureFontFromBuffer(fileBuffer, bufferLength, heights, filterType);
+	}
 	
 	// Clean up the file buffer
 	delete[] fileBuffer;
@@ -881,6 +1055,11 @@ std::stringstream* ResourceManager::FilepathToInOutStream(const std::string &fil
 	return inFile;
 }
 
+// The mesh pack (see MeshPack) lives alongside the meshes that were compiled into it
+std::string ResourceManager::GetMeshPackFilepath() {
+	return std::string(GameViewConstants::GetInstance()->MESH_DIR) + std::string("/") + std::string(ResourceManager::MESH_PACK_FILE);
+}
+
 // Convert a filepath with the resource directory in it into one with the mod directory instead
 std::string ResourceManager::ConvertResourceFilepathToModFilepath(const std::string& resourceFilepath) {
 	// On failure then we return an empty string...
@@ -898,9 +1077,54 @@ std::string ResourceManager::ConvertResourceFilepathToModFilepath(const std::str
 }
 
 /**
- * Convert a file stored in the resource zip filesystem into a memory stream of type T.
+ * Check whether the given file is read from the modifications directory instead of the resource zip
+ * filesystem, this can only happen in debug.
+ */
+bool ResourceManager::IsFilepathOverriddenByMod(const std::string &filepath) {
+#ifdef _DEBUG
+	std::ifstream iStream(ResourceManager::ConvertResourceFilepathToModFilepath(filepath).c_str(), std::ios::binary);
+	return iStream.is_open();
+#else
+	UNUSED_PARAMETER(filepath);
+	return false;
+#endif
+}
+
+/**
+ * Check whether the given file exists in the resource zip filesystem (or, in debug, the modifications directory).
+ */
+bool ResourceManager::FilepathExists(const std::string &filepath) {
+#ifdef _DEBUG
+	std::ifstream iStream(ResourceManager::ConvertResourceFilepathToModFilepath(filepath).c_str(), std::ios::binary);
+	if (iStream.is_open()) {
+		iStream.close();
+		return true;
+	}
+#endif
+
+	return (PHYSFS_exists(filepath.c_str()) != 0);
+}
+
+/**
+ * Convert a file stored in the resource zip filesystem into a memory stream of type T, if the file
+ * was streamed in on the background threads then those bytes are used instead of reading it again.
  */
 char* ResourceManager::FilepathToMemoryBuffer(const std::string &filepath, long &length) {
+	if (ResourceManager::instance != NULL && ResourceManager::instance->assetStreamer != NULL) {
+		char* streamedBuffer = ResourceManager::instance->assetStreamer->TakeFileBuffer(filepath, length);
+		if (streamedBuffer != NULL) {
+			return streamedBuffer;
+		}
+	}
+
+	return ResourceManager::ReadFileToMemoryBuffer(filepath, length);
+}
+
+/**
+ * Read a file stored in the resource zip filesystem (or, in debug, the modifications directory) directly
+ * into a new null-terminated buffer. This is safe to call from the asset streaming threads.
+ */
+char* ResourceManager::ReadFileToMemoryBuffer(const std::string &filepath, long &length) {
 
 #ifdef _DEBUG
 	// Get the corresponding file path in the modifications directory...
@@ -42,6 +42,9 @@ class TextureFontSet;
 class Blammopedia;
 class GameModel;
 class ArcadeLeaderboard;
+class AssetStreamer;
+class DecodedAssetCache;
+class MeshPack;
 
 /**
  * This class is important for the quick loading of all resources relevant to BiffBlamBlammo
@@ -55,6 +58,7 @@ class ResourceManager {
 public:
     static const char* RESOURCE_ZIP;
     static const char* BLAMMOPEDIA_FILE;
+    static const char* MESH_PACK_FILE;
 
 	static ResourceManager* GetInstance() {
 		if (ResourceManager::instance == NULL) {
@@ -72,10 +76,11 @@ public:
 		}
 	}
 
-	static void InitResourceManager(const std::string& resourceZip, const char* argv0);
+	static void InitResourceManager(const std::string& resourceZip, const char* argv0, bool initGraphics = true);
 
 	// Resource Management and loading functions *******************************************************************************
 	bool LoadBlammopedia(const std::string& blammopediaFile);
+	void SetBlammopedia(Blammopedia* blammopedia);
 	Blammopedia* GetBlammopedia() const;
 
 	// Mesh Resource Functions
@@ -95,6 +100,16 @@ public:
 	void GetCgFxEffectResource(const std::string &filepath, CGeffect &effect, std::map<std::string, CGtechnique> &techniques);
 	bool ReleaseCgFxEffectResource(CGeffect &effect);
 
+	// Asynchronous streaming functions - these start reading and decoding resources on background threads so that
+	// the resource functions above only have to do the work that needs the graphics context when they're called
+	void PrefetchObjMeshResource(const std::string &filepath);
+	void PrefetchImgTextureResource(const std::string &filepath);
+	void PrefetchFile(const std::string &filepath);
+	void ClearPrefetchedResources();
+
+	// Report on how long loading took and how the decoded asset cache did during it
+	void ReportLoadTime(double loadTimeInSecs, std::ostream& out);
+
 	// Initialization configuration loading
     static void SetLoadDir(const char* loadDir);
     static inline const std::string& GetLoadDir() { return baseLoadDir; }
@@ -110,15 +125,19 @@ public:
 	static std::istringstream* FilepathToInStream(const std::string &filepath);
     static std::stringstream* FilepathToInOutStream(const std::string &filepath);
 	static char* FilepathToMemoryBuffer(const std::string &filepath, long &length);
+	static char* ReadFileToMemoryBuffer(const std::string &filepath, long &length);
+    static bool FilepathExists(const std::string &filepath);
+    static bool IsFilepathOverriddenByMod(const std::string &filepath);
 
 	// Public Resource Directories
 	static std::string GetTextureResourceDir();
 	static std::string GetBlammopediaResourceDir();
+	static std::string GetMeshPackFilepath();
 
 private:
 	static ResourceManager* instance;
 
-	ResourceManager(const std::string& resourceZip, const char* argv0);
+	ResourceManager(const std::string& resourceZip, const char* argv0, bool initGraphics);
 	~ResourceManager();
 
 	static const char* RESOURCE_DIRECTORY;
@@ -148,6 +167,13 @@ private:
 	// Blammopedia - where all information and textures for items, blocks, etc. are archived for easy lookup
 	Blammopedia* blammopedia;
 
+	// On-disk cache of decoded resources and background streaming of resources (both NULL when there are no graphics)
+	DecodedAssetCache* assetCache;
+	AssetStreamer* assetStreamer;
+
+	// Compiled geometry for meshes, used instead of parsing their obj files (NULL when there's no mesh pack)
+	MeshPack* meshPack;
+
 	static ConfigOptions* configOptions;	// The configuration options read from the game's ini file
     static ArcadeLeaderboard* leaderboard;  // The arcade leaderboard read from file
 